@@ -222,12 +222,20 @@ add_h3_test(testConstructCell src/apps/testapps/testConstructCell.c)
 add_h3_test(testCellsToLinkedMultiPolygon
             src/apps/testapps/testCellsToLinkedMultiPolygon.c)
 add_h3_test(testCellsToMultiPoly src/apps/testapps/testCellsToMultiPoly.c)
+add_h3_test(testGeoFormat src/apps/testapps/testGeoFormat.c)
+add_h3_test(testWorkspace src/apps/testapps/testWorkspace.c)
+add_h3_test(testParentGroups src/apps/testapps/testParentGroups.c)
+add_h3_test(testCellBitmap src/apps/testapps/testCellBitmap.c)
+add_h3_test(testCellAdjacency src/apps/testapps/testCellAdjacency.c)
+add_h3_test(testCellToChildrenRange src/apps/testapps/testCellToChildrenRange.c)
 add_h3_test(testCellsToMultiPolyInternal src/apps/testapps/testCellsToMultiPolyInternal.c)
 add_h3_test(testLinkedGeoInternal src/apps/testapps/testLinkedGeoInternal.c)
 add_h3_test(testLinkedGeoConvert src/apps/testapps/testLinkedGeoConvert.c)
 add_h3_test(testPolygonToCells src/apps/testapps/testPolygonToCells.c)
 add_h3_test(testPolygonToCellsExperimental
             src/apps/testapps/testPolygonToCellsExperimental.c)
+add_h3_test(testMultiPolygonToCellsExperimental
+            src/apps/testapps/testMultiPolygonToCellsExperimental.c)
 add_h3_test(testPolygonToCellsReported
             src/apps/testapps/testPolygonToCellsReported.c)
 add_h3_test(testPolygonToCellsReportedExperimental
@@ -0,0 +1,118 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <inttypes.h>
+#include <stdio.h>
+#include "benchmark.h"
+#include "directedEdge.h"
+#include "h3Index.h"
+#include "h3api.h"
+
+// Pairs of cells from the disks around all res 2 cells, grouped by how the
+// neighbor check resolves them: siblings share a parent, cousins share a
+// base cell, and the rest cross base cells. Non-neighbors are at distance 2.
+// Pairs are listed origin by origin, as when building a graph.
+
+enum { SIBLING, COUSIN, CROSS_BASE_CELL, NON_NEIGHBOR, NUM_KINDS };
+
+typedef struct {
+    H3Index *origins;
+    H3Index *destinations;
+    int64_t numPairs;
+} Pairs;
+
+static void addPair(Pairs *pairs, H3Index origin, H3Index destination) {
+    pairs->origins[pairs->numPairs] = origin;
+    pairs->destinations[pairs->numPairs] = destination;
+    pairs->numPairs++;
+}
+
+static void runPairsBatch(const Pairs *pairs, uint64_t *neighbors) {
+    H3_EXPORT(areNeighborCellPairs)
+    (pairs->origins, pairs->destinations, pairs->numPairs, neighbors, NULL);
+}
+
+static void runPairs(const Pairs *pairs, int *out) {
+    for (int64_t i = 0; i < pairs->numPairs; i++) {
+        H3_EXPORT(areNeighborCells)
+        (pairs->origins[i], pairs->destinations[i], out);
+    }
+}
+
+BEGIN_BENCHMARKS();
+
+int64_t numCells;
+H3_EXPORT(getNumCells)(2, &numCells);
+H3Index *cells = calloc(numCells, sizeof(H3Index));
+H3Index *res0 = calloc(NUM_BASE_CELLS, sizeof(H3Index));
+H3_EXPORT(getRes0Cells)(res0);
+for (int i = 0; i < NUM_BASE_CELLS; i++) {
+    int64_t offset = 0;
+    for (int j = 0; j < i; j++) {
+        int64_t size;
+        H3_EXPORT(cellToChildrenSize)(res0[j], 2, &size);
+        offset += size;
+    }
+    H3_EXPORT(cellToChildren)(res0[i], 2, cells + offset);
+}
+
+Pairs pairs[NUM_KINDS];
+for (int k = 0; k < NUM_KINDS; k++) {
+    pairs[k].origins = calloc(numCells * 19, sizeof(H3Index));
+    pairs[k].destinations = calloc(numCells * 19, sizeof(H3Index));
+    pairs[k].numPairs = 0;
+}
+for (int64_t i = 0; i < numCells; i++) {
+    H3Index disk[19];
+    int distances[19];
+    H3_EXPORT(gridDiskDistances)(cells[i], 2, disk, distances);
+    for (int j = 0; j < 19; j++) {
+        if (disk[j] == H3_NULL || distances[j] == 0) continue;
+        int kind;
+        if (distances[j] == 2) {
+            kind = NON_NEIGHBOR;
+        } else if (H3_GET_BASE_CELL(disk[j]) != H3_GET_BASE_CELL(cells[i])) {
+            kind = CROSS_BASE_CELL;
+        } else if (H3_GET_INDEX_DIGIT(disk[j], 1) ==
+                   H3_GET_INDEX_DIGIT(cells[i], 1)) {
+            kind = SIBLING;
+        } else {
+            kind = COUSIN;
+        }
+        addPair(&pairs[kind], cells[i], disk[j]);
+    }
+}
+
+int out;
+uint64_t *neighbors = calloc((numCells * 19 + 63) / 64, sizeof(uint64_t));
+
+const char *names[NUM_KINDS] = {"Sibling", "Cousin", "CrossBaseCell",
+                                 "NonNeighbor"};
+for (int k = 0; k < NUM_KINDS; k++) {
+    printf("-- %s: %" PRId64 " pairs\n", names[k], pairs[k].numPairs);
+    BENCHMARK(areNeighborCells, 100, { runPairs(&pairs[k], &out); });
+    BENCHMARK(areNeighborCellPairs, 100,
+              { runPairsBatch(&pairs[k], neighbors); });
+}
+
+for (int k = 0; k < NUM_KINDS; k++) {
+    free(pairs[k].destinations);
+    free(pairs[k].origins);
+}
+free(neighbors);
+free(res0);
+free(cells);
+
+END_BENCHMARKS();
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <string.h>
+
+#include "benchmark.h"
+#include "cellAdjacency.h"
+#include "h3api.h"
+
+// Adjacency of the res 10 cells within distance 400 of a cell. The baseline
+// puts the cells in an open addressing hash table, then looks up the
+// destination of each directed edge of each cell.
+
+static int64_t hashFind(const H3Index *keys, int64_t size, H3Index cell) {
+    int64_t loc = (int64_t)(cell % size);
+    while (keys[loc] != 0 && keys[loc] != cell) {
+        loc = (loc + 1) % size;
+    }
+    return loc;
+}
+
+static void hashAdjacency(const H3Index *cells, int64_t numCells,
+                          H3Index *keys, int64_t *values, int64_t size,
+                          int64_t *offsets, int64_t *neighbors) {
+    memset(keys, 0, size * sizeof(H3Index));
+    for (int64_t i = 0; i < numCells; i++) {
+        int64_t loc = hashFind(keys, size, cells[i]);
+        keys[loc] = cells[i];
+        values[loc] = i;
+    }
+    int64_t numEdges = 0;
+    for (int64_t i = 0; i < numCells; i++) {
+        offsets[i] = numEdges;
+        H3Index edges[6] = {0};
+        H3_EXPORT(originToDirectedEdges)(cells[i], edges);
+        for (int e = 0; e < 6; e++) {
+            H3Index destination;
+            if (edges[e] == 0 ||
+                H3_EXPORT(getDirectedEdgeDestination)(edges[e],
+                                                      &destination)) {
+                continue;
+            }
+            int64_t loc = hashFind(keys, size, destination);
+            if (keys[loc] == destination) {
+                neighbors[numEdges++] = values[loc];
+            }
+        }
+    }
+    offsets[numCells] = numEdges;
+}
+
+BEGIN_BENCHMARKS();
+
+int64_t numCells;
+H3_EXPORT(maxGridDiskSize)(400, &numCells);
+H3Index *cells = calloc(numCells, sizeof(H3Index));
+H3_EXPORT(gridDisk)(0x8a283470d95ffff, 400, cells);
+
+int64_t size = numCells * 2;
+H3Index *keys = calloc(size, sizeof(H3Index));
+int64_t *values = calloc(size, sizeof(int64_t));
+int64_t *offsets = calloc(numCells + 1, sizeof(int64_t));
+int64_t *neighbors = calloc(numCells * 6, sizeof(int64_t));
+
+BENCHMARK(originToDirectedEdgesHashLookup, 3, {
+    hashAdjacency(cells, numCells, keys, values, size, offsets, neighbors);
+});
+
+BENCHMARK(cellsToAdjacency, 3, {
+    CellAdjacency adjacency;
+    H3_EXPORT(cellsToAdjacency)(cells, numCells, false, &adjacency);
+    H3_EXPORT(destroyCellAdjacency)(&adjacency);
+});
+
+BENCHMARK(cellsToAdjacencyEdgeLengths, 1, {
+    CellAdjacency adjacency;
+    H3_EXPORT(cellsToAdjacency)(cells, numCells, true, &adjacency);
+    H3_EXPORT(destroyCellAdjacency)(&adjacency);
+});
+
+free(neighbors);
+free(offsets);
+free(values);
+free(keys);
+free(cells);
+
+END_BENCHMARKS();
@@ -13,12 +13,35 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <inttypes.h>
+#include <stdio.h>
+
 #include "benchmark.h"
 #include "h3Index.h"
 #include "h3api.h"
+#include "iterators.h"
 
 // Fixtures
 H3Index hex = 0x89283080ddbffff;
+H3Index pentagon = 0x89080000003ffff;
+
+// Children per second is the number of children times 1e6 divided by the
+// microseconds per iteration.
+static void printChildrenCount(H3Index h, int childRes) {
+    int64_t count;
+    H3_EXPORT(cellToChildrenSize)(h, childRes, &count);
+    printf("\t-- %" PRId64 " children at res %d\n", count, childRes);
+}
+
+// The per-child stepping that cellToChildren used before writing blocks
+static void iterChildren(H3Index h, int childRes, H3Index *children) {
+    int64_t i = 0;
+    for (IterCellsChildren iter = iterInitParent(h, childRes); iter.h;
+         iterStepChild(&iter)) {
+        children[i] = iter.h;
+        i++;
+    }
+}
 
 BEGIN_BENCHMARKS();
 
@@ -35,6 +58,13 @@ BENCHMARK(cellToChildren3, 10000, { H3_EXPORT(cellToChildren)(hex, 12, out); });
 BENCHMARK(cellToChildren4, 10000, { H3_EXPORT(cellToChildren)(hex, 13, out); });
 BENCHMARK(cellToChildren5, 10000, { H3_EXPORT(cellToChildren)(hex, 14, out); });
 
+printChildrenCount(hex, 14);
+BENCHMARK(iterChildren5, 10000, { iterChildren(hex, 14, out); });
+printChildrenCount(pentagon, 14);
+BENCHMARK(cellToChildrenPentagon5, 10000,
+          { H3_EXPORT(cellToChildren)(pentagon, 14, out); });
+BENCHMARK(iterChildrenPentagon5, 10000, { iterChildren(pentagon, 14, out); });
+
 free(out);
 
 END_BENCHMARKS();
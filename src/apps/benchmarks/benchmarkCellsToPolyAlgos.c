@@ -14,7 +14,10 @@
  * limitations under the License.
  */
 /** @file benchmarkCellsToPolyAlgos.c
- * @brief Benchmarks comparing cellsToLinkedMultiPolygon and cellsToMultiPolygon
+ * @brief Benchmarks comparing cellsToLinkedMultiPolygon, cellsToMultiPolygon
+ * and the cellsToMultiPolygonSorted and cellsToMultiPolygonParallel variants,
+ * compactCellsToMultiPolygon on the compacted input, and
+ * cellsToMultiPolygonSimplified
  */
 
 #include <stdlib.h>
@@ -41,6 +44,25 @@
         });                                                          \
     } while (0)
 
+#define BENCHMARK_SORTED(NAME, ITERS)                                       \
+    do {                                                                   \
+        BENCHMARK(sorted_##NAME, ITERS, {                                  \
+            GeoMultiPolygon mpoly;                                         \
+            H3_EXPORT(cellsToMultiPolygonSorted)(cells, numCells, &mpoly); \
+            H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);                     \
+        });                                                                \
+    } while (0)
+
+#define BENCHMARK_PARALLEL(NAME, THREADS, ITERS)                     \
+    do {                                                             \
+        BENCHMARK(parallel##THREADS##_##NAME, ITERS, {               \
+            GeoMultiPolygon mpoly;                                   \
+            H3_EXPORT(cellsToMultiPolygonParallel)(cells, numCells,  \
+                                                   THREADS, &mpoly); \
+            H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);               \
+        });                                                          \
+    } while (0)
+
 BEGIN_BENCHMARKS();
 
 {
@@ -58,6 +80,7 @@ BEGIN_BENCHMARKS();
 
     BENCHMARK_LINKED(disk2, 10000);
     BENCHMARK_DIRECT(disk2, 10000);
+    BENCHMARK_SORTED(disk2, 10000);
 }
 
 {
@@ -70,6 +93,7 @@ BEGIN_BENCHMARKS();
 
     BENCHMARK_LINKED(donut, 10000);
     BENCHMARK_DIRECT(donut, 10000);
+    BENCHMARK_SORTED(donut, 10000);
 }
 
 {
@@ -88,6 +112,7 @@ BEGIN_BENCHMARKS();
 
     BENCHMARK_LINKED(nestedDonuts, 10000);
     BENCHMARK_DIRECT(nestedDonuts, 10000);
+    BENCHMARK_SORTED(nestedDonuts, 10000);
 }
 
 {
@@ -103,6 +128,13 @@ BEGIN_BENCHMARKS();
 
     BENCHMARK_LINKED(manyChildren, 10);
     BENCHMARK_DIRECT(manyChildren, 10);
+    BENCHMARK_SORTED(manyChildren, 10);
+
+    BENCHMARK(compact_manyChildren, 10, {
+        GeoMultiPolygon mpoly;
+        H3_EXPORT(compactCellsToMultiPolygon)(&h, 1, &mpoly);
+        H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+    });
 
     free(cells);
 }
@@ -146,6 +178,72 @@ BEGIN_BENCHMARKS();
 
     BENCHMARK_LINKED(colorado, 100);
     BENCHMARK_DIRECT(colorado, 100);
+    BENCHMARK_SORTED(colorado, 100);
+
+    // Simplify to within about 100m
+    BENCHMARK(simplified_colorado, 100, {
+        GeoMultiPolygon mpoly;
+        H3_EXPORT(cellsToMultiPolygonSimplified)(cells, numCells, 1.6e-5,
+                                                 &mpoly);
+        H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+    });
+
+    // Reuse one arena, as a worker converting many cell sets would
+    Arena arena;
+    H3_EXPORT(initArena)(&arena, NULL, 0);
+    BENCHMARK(arena_colorado, 100, {
+        GeoMultiPolygon mpoly;
+        H3_EXPORT(cellsToMultiPolygonArena)(cells, numCells, &arena, &mpoly);
+        H3_EXPORT(resetArena)(&arena);
+    });
+    H3_EXPORT(destroyArena)(&arena);
+
+    free(cells);
+}
+
+{
+    // About 1M cells: a filled-in 577-disk at res 9
+    H3Index origin = 0x89283082837ffff;
+    int k = 577;
+
+    int64_t maxCells;
+    H3_EXPORT(maxGridDiskSize)(k, &maxCells);
+
+    H3Index *cells = calloc(maxCells, sizeof(H3Index));
+    H3_EXPORT(gridDisk)(origin, k, cells);
+
+    int64_t numCells = 0;
+    for (int64_t i = 0; i < maxCells; i++) {
+        if (cells[i] != H3_NULL) {
+            cells[numCells++] = cells[i];
+        }
+    }
+
+    BENCHMARK_DIRECT(disk1M, 3);
+    BENCHMARK_SORTED(disk1M, 3);
+
+    H3Index *compacted = calloc(numCells, sizeof(H3Index));
+    H3_EXPORT(compactCells)(cells, compacted, numCells);
+    int64_t numCompacted = 0;
+    for (int64_t i = 0; i < numCells; i++) {
+        if (compacted[i] != H3_NULL) {
+            compacted[numCompacted++] = compacted[i];
+        }
+    }
+
+    BENCHMARK(compact_disk1M, 3, {
+        GeoMultiPolygon mpoly;
+        H3_EXPORT(compactCellsToMultiPolygon)(compacted, numCompacted, &mpoly);
+        H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+    });
+
+    free(compacted);
+
+    // Only uses more than one thread when built with ENABLE_THREADS. All of
+    // the cells are in one base cell.
+    BENCHMARK_PARALLEL(disk1M, 1, 3);
+    BENCHMARK_PARALLEL(disk1M, 2, 3);
+    BENCHMARK_PARALLEL(disk1M, 4, 3);
 
     free(cells);
 }
@@ -0,0 +1,98 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "benchmark.h"
+#include "h3Index.h"
+#include "h3api.h"
+
+// Converts all res 14 descendants of a res 9 hexagon, and all res 5
+// descendants of a res 0 pentagon, to and from their child positions.
+
+H3Index hex = 0x89283080ddbffff;
+H3Index pentagon = 0x8009fffffffffff;
+
+BEGIN_BENCHMARKS();
+
+int64_t numHexChildren;
+H3_EXPORT(cellToChildrenSize)(hex, 14, &numHexChildren);
+H3Index *hexChildren = calloc(numHexChildren, sizeof(H3Index));
+H3_EXPORT(cellToChildren)(hex, 14, hexChildren);
+
+int64_t numPentChildren;
+H3_EXPORT(cellToChildrenSize)(pentagon, 5, &numPentChildren);
+H3Index *pentChildren = calloc(numPentChildren, sizeof(H3Index));
+H3_EXPORT(cellToChildren)(pentagon, 5, pentChildren);
+
+int64_t numPos =
+    numHexChildren > numPentChildren ? numHexChildren : numPentChildren;
+int64_t *pos = calloc(numPos, sizeof(int64_t));
+H3Index *cells = calloc(numPos, sizeof(H3Index));
+uint64_t *errors = calloc((numPos + 63) / 64, sizeof(uint64_t));
+for (int64_t i = 0; i < numPos; i++) {
+    pos[i] = i;
+}
+
+BENCHMARK(cellToChildPosHexagon, 100, {
+    for (int64_t i = 0; i < numHexChildren; i++) {
+        H3_EXPORT(cellToChildPos)(hexChildren[i], 9, &pos[i]);
+    }
+});
+
+BENCHMARK(cellsToChildPosHexagon, 100, {
+    H3_EXPORT(cellsToChildPos)(hexChildren, numHexChildren, 9, pos, errors);
+});
+
+BENCHMARK(cellToChildPosPentagon, 100, {
+    for (int64_t i = 0; i < numPentChildren; i++) {
+        H3_EXPORT(cellToChildPos)(pentChildren[i], 0, &pos[i]);
+    }
+});
+
+BENCHMARK(cellsToChildPosPentagon, 100, {
+    H3_EXPORT(cellsToChildPos)(pentChildren, numPentChildren, 0, pos, errors);
+});
+
+for (int64_t i = 0; i < numPos; i++) {
+    pos[i] = i;
+}
+
+BENCHMARK(childPosToCellHexagon, 100, {
+    for (int64_t i = 0; i < numHexChildren; i++) {
+        H3_EXPORT(childPosToCell)(pos[i], hex, 14, &cells[i]);
+    }
+});
+
+BENCHMARK(childPosToCellsHexagon, 100, {
+    H3_EXPORT(childPosToCells)(pos, numHexChildren, hex, 14, cells, errors);
+});
+
+BENCHMARK(childPosToCellPentagon, 100, {
+    for (int64_t i = 0; i < numPentChildren; i++) {
+        H3_EXPORT(childPosToCell)(pos[i], pentagon, 5, &cells[i]);
+    }
+});
+
+BENCHMARK(childPosToCellsPentagon, 100, {
+    H3_EXPORT(childPosToCells)(pos, numPentChildren, pentagon, 5, cells,
+                               errors);
+});
+
+free(errors);
+free(cells);
+free(pos);
+free(pentChildren);
+free(hexChildren);
+
+END_BENCHMARKS();
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "benchmark.h"
+#include "directedEdge.h"
 #include "h3api.h"
 
 // Fixtures (arbitrary res 9 hexagon)
@@ -24,6 +25,8 @@ BEGIN_BENCHMARKS();
 
 H3Index outEdge;
 CellBoundary outBoundary;
+H3Index outEdges[6];
+CellBoundary outBoundaries[6];
 H3_EXPORT(originToDirectedEdges)(hex, edges);
 
 BENCHMARK(directedEdgeToBoundary, 10000, {
@@ -32,6 +35,18 @@ BENCHMARK(directedEdgeToBoundary, 10000, {
     }
 });
 
+BENCHMARK(originToDirectedEdgesToBoundary, 10000, {
+    H3_EXPORT(originToDirectedEdges)(hex, outEdges);
+    for (int i = 0; i < 6; i++) {
+        H3_EXPORT(directedEdgeToBoundary)(outEdges[i], &outBoundaries[i]);
+    }
+});
+
+BENCHMARK(originToDirectedEdgesWithBoundaries, 10000, {
+    H3_EXPORT(originToDirectedEdgesWithBoundaries)(hex, outEdges,
+                                                   outBoundaries);
+});
+
 BENCHMARK(reverseDirectedEdge, 10000, {
     for (int i = 0; i < 6; i++) {
         H3_EXPORT(reverseDirectedEdge)(edges[i], &outEdge);
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "benchmark.h"
+#include "h3Index.h"
 #include "h3api.h"
 #include "latLng.h"
 
@@ -35,4 +36,36 @@ BENCHMARK(cellToBoundary, 10000, {
     H3_EXPORT(cellToBoundary)(hex, &outBoundary);
 });
 
+// Res 14 descendants of the hexagon, rolled up to res 9
+int64_t numChildren;
+H3_EXPORT(cellToChildrenSize)(hex, 14, &numChildren);
+H3Index *children = calloc(numChildren, sizeof(H3Index));
+H3Index *parents = calloc(numChildren, sizeof(H3Index));
+uint64_t *errors = calloc((numChildren + 63) / 64, sizeof(uint64_t));
+H3_EXPORT(cellToChildren)(hex, 14, children);
+
+BENCHMARK(cellToParent, 100, {
+    for (int64_t i = 0; i < numChildren; i++) {
+        H3_EXPORT(cellToParent)(children[i], 9, &parents[i]);
+    }
+});
+
+BENCHMARK(cellsToParent, 100, {
+    H3_EXPORT(cellsToParent)(children, numChildren, 9, parents, errors);
+});
+
+BENCHMARK(cellToCenterChild, 100, {
+    for (int64_t i = 0; i < numChildren; i++) {
+        H3_EXPORT(cellToCenterChild)(children[i], 15, &parents[i]);
+    }
+});
+
+BENCHMARK(cellsToCenterChild, 100, {
+    H3_EXPORT(cellsToCenterChild)(children, numChildren, 15, parents, errors);
+});
+
+free(errors);
+free(parents);
+free(children);
+
 END_BENCHMARKS();
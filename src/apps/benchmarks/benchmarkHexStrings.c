@@ -0,0 +1,81 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <inttypes.h>
+#include <stdio.h>
+
+#include "benchmark.h"
+#include "h3Index.h"
+#include "h3api.h"
+
+// Each iteration converts all N strings, so strings per second is
+// N * 1e6 / (microseconds per iteration).
+
+BEGIN_BENCHMARKS();
+
+// All res 9 descendants of a res 4 cell
+H3Index parent = 0x8428309ffffffff;
+int64_t N;
+H3_EXPORT(cellToChildrenSize)(parent, 9, &N);
+H3Index *cells = calloc(N, sizeof(H3Index));
+H3Index *parsed = calloc(N, sizeof(H3Index));
+H3_EXPORT(cellToChildren)(parent, 9, cells);
+printf("\t-- %" PRId64 " strings per iteration\n", N);
+
+// Null terminated strings for stringToH3, one per 17 bytes
+char *strings = calloc(N, 17);
+// Newline separated strings for stringsToH3
+size_t csvSize = N * 17;
+char *csv = calloc(csvSize, 1);
+size_t csvWritten;
+H3_EXPORT(h3sToStrings)(cells, N, '\n', csv, csvSize, &csvWritten);
+// Packed 15 character strings for stringsToH3Fixed
+char *packed = calloc(N, 15);
+
+BENCHMARK(h3ToString, 20, {
+    for (int64_t j = 0; j < N; j++) {
+        H3_EXPORT(h3ToString)(cells[j], strings + j * 17, 17);
+    }
+});
+
+BENCHMARK(h3sToStrings, 20, {
+    size_t written;
+    H3_EXPORT(h3sToStrings)(cells, N, '\n', csv, csvSize, &written);
+});
+
+BENCHMARK(h3sToStringsFixed, 20,
+          { H3_EXPORT(h3sToStringsFixed)(cells, N, 15, packed); });
+
+BENCHMARK(stringToH3, 20, {
+    for (int64_t j = 0; j < N; j++) {
+        H3_EXPORT(stringToH3)(strings + j * 17, &parsed[j]);
+    }
+});
+
+BENCHMARK(stringsToH3, 20, {
+    int64_t numOut;
+    H3_EXPORT(stringsToH3)(csv, csvWritten, '\n', parsed, N, &numOut, NULL);
+});
+
+BENCHMARK(stringsToH3Fixed, 20,
+          { H3_EXPORT(stringsToH3Fixed)(packed, N, 15, parsed, NULL); });
+
+free(packed);
+free(csv);
+free(strings);
+free(parsed);
+free(cells);
+
+END_BENCHMARKS();
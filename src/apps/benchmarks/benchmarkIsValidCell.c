@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "benchmark.h"
+#include "h3Index.h"
 #include "h3api.h"
 
 typedef struct {
@@ -54,33 +55,70 @@ static inline void runValidation(const CellArray ca) {
     }
 }
 
+static inline void runBatchValidation(const CellArray ca, uint64_t *bitmap) {
+    // Apply `areValidCells` to all of `ca.cells`, filling `bitmap` if given.
+    int allValid;
+    H3_EXPORT(areValidCells)(ca.cells, ca.N, bitmap, &allValid);
+}
+
 CellArray ca;
+uint64_t *bitmap;
 
 BEGIN_BENCHMARKS();
 
 // pentagon 2->8
 ca = pentagonSetup(2, 8, 0);
 BENCHMARK(pentagonChildren_2_8, 1000, { runValidation(ca); });
+bitmap = calloc((ca.N + 63) / 64, sizeof(uint64_t));
+BENCHMARK(pentagonChildren_2_8_batch, 1000,
+          { runBatchValidation(ca, bitmap); });
+BENCHMARK(pentagonChildren_2_8_batchNoBitmap, 1000,
+          { runBatchValidation(ca, NULL); });
+free(bitmap);
 free(ca.cells);
 
 // pentagon 8->14
 ca = pentagonSetup(8, 14, 0);
 BENCHMARK(pentagonChildren_8_14, 1000, { runValidation(ca); });
+bitmap = calloc((ca.N + 63) / 64, sizeof(uint64_t));
+BENCHMARK(pentagonChildren_8_14_batch, 1000,
+          { runBatchValidation(ca, bitmap); });
+BENCHMARK(pentagonChildren_8_14_batchNoBitmap, 1000,
+          { runBatchValidation(ca, NULL); });
+free(bitmap);
 free(ca.cells);
 
 // pentagon 8->14; H3_NULL every 2
 ca = pentagonSetup(8, 14, 2);
 BENCHMARK(pentagonChildren_8_14_null_2, 1000, { runValidation(ca); });
+bitmap = calloc((ca.N + 63) / 64, sizeof(uint64_t));
+BENCHMARK(pentagonChildren_8_14_null_2_batch, 1000,
+          { runBatchValidation(ca, bitmap); });
+BENCHMARK(pentagonChildren_8_14_null_2_batchNoBitmap, 1000,
+          { runBatchValidation(ca, NULL); });
+free(bitmap);
 free(ca.cells);
 
 // pentagon 8->14; H3_NULL every 10
 ca = pentagonSetup(8, 14, 10);
 BENCHMARK(pentagonChildren_8_14_null_10, 1000, { runValidation(ca); });
+bitmap = calloc((ca.N + 63) / 64, sizeof(uint64_t));
+BENCHMARK(pentagonChildren_8_14_null_10_batch, 1000,
+          { runBatchValidation(ca, bitmap); });
+BENCHMARK(pentagonChildren_8_14_null_10_batchNoBitmap, 1000,
+          { runBatchValidation(ca, NULL); });
+free(bitmap);
 free(ca.cells);
 
 // pentagon 8->14; H3_NULL every 100
 ca = pentagonSetup(8, 14, 100);
 BENCHMARK(pentagonChildren_8_14_null_100, 1000, { runValidation(ca); });
+bitmap = calloc((ca.N + 63) / 64, sizeof(uint64_t));
+BENCHMARK(pentagonChildren_8_14_null_100_batch, 1000,
+          { runBatchValidation(ca, bitmap); });
+BENCHMARK(pentagonChildren_8_14_null_100_batchNoBitmap, 1000,
+          { runBatchValidation(ca, NULL); });
+free(bitmap);
 free(ca.cells);
 
 END_BENCHMARKS();
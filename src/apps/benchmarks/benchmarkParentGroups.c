@@ -0,0 +1,78 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <string.h>
+
+#include "benchmark.h"
+#include "h3api.h"
+#include "parentGroups.h"
+
+// Roll up res 11 cells to res 7, 8 and 9, counting the cells per parent.
+// The baseline finds the parent of every cell at every resolution and
+// counts them in an open addressing hash table.
+
+static void hashCount(const H3Index *cells, int64_t numCells, int res,
+                      H3Index *keys, int64_t *counts, int64_t size) {
+    for (int64_t i = 0; i < numCells; i++) {
+        H3Index parent;
+        H3_EXPORT(cellToParent)(cells[i], res, &parent);
+        int64_t loc = (int64_t)(parent % size);
+        while (keys[loc] != 0 && keys[loc] != parent) {
+            loc = (loc + 1) % size;
+        }
+        keys[loc] = parent;
+        counts[loc]++;
+    }
+}
+
+BEGIN_BENCHMARKS();
+
+int64_t numCells;
+H3_EXPORT(maxGridDiskSize)(100, &numCells);
+H3Index *cells = calloc(numCells, sizeof(H3Index));
+H3_EXPORT(gridDisk)(0x8b283470d959fff, 100, cells);
+H3_EXPORT(sortCells)(cells, numCells);
+
+int64_t size = numCells * 2;
+H3Index *keys = calloc(size, sizeof(H3Index));
+int64_t *counts = calloc(size, sizeof(int64_t));
+
+ParentGroups groups[3] = {{.res = 7}, {.res = 8}, {.res = 9}};
+for (int r = 0; r < 3; r++) {
+    groups[r].parents = calloc(numCells, sizeof(H3Index));
+    groups[r].counts = calloc(numCells, sizeof(int64_t));
+}
+
+BENCHMARK(cellToParentHashCount, 100, {
+    for (int res = 7; res <= 9; res++) {
+        memset(keys, 0, size * sizeof(H3Index));
+        memset(counts, 0, size * sizeof(int64_t));
+        hashCount(cells, numCells, res, keys, counts, size);
+    }
+});
+
+BENCHMARK(cellsToParentGroups, 100, {
+    H3_EXPORT(cellsToParentGroups)(cells, numCells, groups, 3);
+});
+
+for (int r = 0; r < 3; r++) {
+    free(groups[r].parents);
+    free(groups[r].counts);
+}
+free(counts);
+free(keys);
+free(cells);
+
+END_BENCHMARKS();
@@ -13,9 +13,13 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <stdlib.h>
+
 #include "bbox.h"
 #include "benchmark.h"
+#include "cellsToMultiPoly.h"
 #include "h3api.h"
+#include "linkedGeo.h"
 #include "polygon.h"
 
 // Fixtures
@@ -125,6 +129,30 @@ LatLng largeVerts[] = {{0.659094230575688, -2.1371021015485354},
 GeoLoop largeGeoLoop;
 BBox largeBBox;
 
+// Build a single linked polygon holding every loop of a multipolygon, the
+// input expected by normalizeMultiPolygon
+static void flattenToLinkedPolygon(const GeoMultiPolygon *mpoly,
+                                   LinkedGeoPolygon *out) {
+    LinkedGeoPolygon linked;
+    geoMultiPolygonToLinkedGeoPolygon(mpoly, &linked);
+    *out = (LinkedGeoPolygon){0};
+    LinkedGeoPolygon *polygon = &linked;
+    while (polygon) {
+        LinkedGeoLoop *loop = polygon->first;
+        while (loop) {
+            LinkedGeoLoop *next = loop->next;
+            loop->next = NULL;
+            addLinkedLoop(out, loop);
+            loop = next;
+        }
+        LinkedGeoPolygon *next = polygon->next;
+        if (polygon != &linked) {
+            free(polygon);
+        }
+        polygon = next;
+    }
+}
+
 BEGIN_BENCHMARKS();
 
 smallGeoLoop.numVerts = 6;
@@ -147,4 +175,39 @@ BENCHMARK(bboxFromGeoLoopSmall, 100000,
 BENCHMARK(bboxFromGeoLoopLarge, 100000,
           { bboxFromGeoLoop(&largeGeoLoop, &largeBBox); });
 
+{
+    // Fragmented input: a separate donut (a 1-ring at res 9) around the
+    // center child of each cell in a res 7 disk, for 2 * 3367 loops
+    H3Index origin = 0x872830828ffffff;
+    int k = 33;
+    int64_t maxCells;
+    H3_EXPORT(maxGridDiskSize)(k, &maxCells);
+    H3Index *disk = calloc(maxCells, sizeof(H3Index));
+    H3_EXPORT(gridDisk)(origin, k, disk);
+
+    H3Index *cells = calloc(maxCells * 6, sizeof(H3Index));
+    int64_t numCells = 0;
+    for (int64_t i = 0; i < maxCells; i++) {
+        if (disk[i] == H3_NULL) continue;
+        H3Index center;
+        H3_EXPORT(cellToCenterChild)(disk[i], 9, &center);
+        H3_EXPORT(gridRing)(center, 1, &cells[numCells]);
+        numCells += 6;
+    }
+
+    GeoMultiPolygon mpoly;
+    H3_EXPORT(cellsToMultiPolygon)(cells, numCells, &mpoly);
+
+    BENCHMARK(normalizeMultiPolygonFragmented, 10, {
+        LinkedGeoPolygon polygon;
+        flattenToLinkedPolygon(&mpoly, &polygon);
+        normalizeMultiPolygon(&polygon);
+        H3_EXPORT(destroyLinkedMultiPolygon)(&polygon);
+    });
+
+    H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+    free(cells);
+    free(disk);
+}
+
 END_BENCHMARKS();
@@ -13,9 +13,12 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <string.h>
+
 #include "algos.h"
 #include "benchmark.h"
 #include "h3api.h"
+#include "workspace.h"
 
 // Fixtures
 LatLng sfVerts[] = {
@@ -142,4 +145,38 @@ BENCHMARK(polygonToCellsSouthernExpansion, 10, {
     free(hexagons);
 });
 
+// Small fills, where the temporary allocations are a large part of the cost.
+// The output and workspace are reused across calls.
+H3_EXPORT(maxPolygonToCellsSize)(&sfGeoPolygon, 7, 0, &numHexagons);
+hexagons = calloc(numHexagons, sizeof(H3Index));
+int64_t workspaceSize;
+H3_EXPORT(polygonToCellsWorkspaceSize)(&sfGeoPolygon, 7, 0, &workspaceSize);
+void *workspace = malloc(workspaceSize);
+
+BENCHMARK(polygonToCellsSFRes7, 10000, {
+    memset(hexagons, 0, numHexagons * sizeof(H3Index));
+    H3_EXPORT(polygonToCells)(&sfGeoPolygon, 7, 0, hexagons);
+});
+
+BENCHMARK(polygonToCellsWithWorkspaceSFRes7, 10000, {
+    memset(hexagons, 0, numHexagons * sizeof(H3Index));
+    H3_EXPORT(polygonToCellsWithWorkspace)(&sfGeoPolygon, 7, 0, hexagons,
+                                           workspace, workspaceSize);
+});
+
+// The res 7 output and workspace are big enough for res 5
+BENCHMARK(polygonToCellsSFRes5, 10000, {
+    memset(hexagons, 0, numHexagons * sizeof(H3Index));
+    H3_EXPORT(polygonToCells)(&sfGeoPolygon, 5, 0, hexagons);
+});
+
+BENCHMARK(polygonToCellsWithWorkspaceSFRes5, 10000, {
+    memset(hexagons, 0, numHexagons * sizeof(H3Index));
+    H3_EXPORT(polygonToCellsWithWorkspace)(&sfGeoPolygon, 5, 0, hexagons,
+                                           workspace, workspaceSize);
+});
+
+free(workspace);
+free(hexagons);
+
 END_BENCHMARKS();
@@ -204,4 +204,31 @@ BENCHMARK(polygonToCellsSouthernExpansion_Overlapping, 10, {
     free(hexagons);
 });
 
+// Coarse fills spend most of their time near the top of the descent, where
+// cellToBBox can use the precomputed table (see cellBBoxTable.h)
+BENCHMARK(polygonToCellsSouthernExpansion_Res4, 500, {
+    H3_EXPORT(maxPolygonToCellsSize)
+    (&southernGeoPolygon, 4, CONTAINMENT_OVERLAPPING, &numHexagons);
+    hexagons = calloc(numHexagons, sizeof(H3Index));
+    H3_EXPORT(polygonToCellsExperimental)
+    (&southernGeoPolygon, 4, CONTAINMENT_OVERLAPPING, numHexagons, hexagons);
+    free(hexagons);
+});
+
+BBox bbox;
+
+BENCHMARK(cellToBBoxRes2_CoverChildren, 100, {
+    for (IterCellsResolution iter = iterInitRes(2); iter.h;
+         iterStepRes(&iter)) {
+        cellToBBox(iter.h, &bbox, true);
+    }
+});
+
+BENCHMARK(cellToBBoxRes3_CoverChildren, 10, {
+    for (IterCellsResolution iter = iterInitRes(3); iter.h;
+         iterStepRes(&iter)) {
+        cellToBBox(iter.h, &bbox, true);
+    }
+});
+
 END_BENCHMARKS();
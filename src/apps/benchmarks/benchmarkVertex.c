@@ -41,6 +41,13 @@ int ring2PentCount = 16;
 BEGIN_BENCHMARKS();
 
 H3Index *vertexes = calloc(6, sizeof(H3Index));
+H3Index *ringVertexes = calloc(6 * ring2Count, sizeof(H3Index));
+
+BENCHMARK(cellToVertex, 10000, {
+    for (int i = 0; i < NUM_HEX_VERTS; i++) {
+        H3_EXPORT(cellToVertex)(hex, i, &vertexes[i]);
+    }
+});
 
 BENCHMARK(cellToVertexes, 10000, { H3_EXPORT(cellToVertexes)(hex, vertexes); });
 
@@ -60,6 +67,15 @@ BENCHMARK(cellToVertexesRingPent, 10000, {
     }
 });
 
+BENCHMARK(cellsToVertexesRing, 10000, {
+    H3_EXPORT(cellsToVertexes)(ring2, ring2Count, ringVertexes, NULL);
+});
+
+BENCHMARK(cellsToVertexesRingPent, 10000, {
+    H3_EXPORT(cellsToVertexes)(ring2Pent, ring2PentCount, ringVertexes, NULL);
+});
+
+free(ringVertexes);
 free(vertexes);
 
 END_BENCHMARKS();
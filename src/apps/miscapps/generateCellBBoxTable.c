@@ -0,0 +1,130 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file generateCellBBoxTable.c
+ * @brief Generates the table of cell bounding boxes used by cellToBBox
+ *
+ *  usage: `generateCellBBoxTable > src/h3lib/include/cellBBoxTable.h`
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "baseCells.h"
+#include "h3Index.h"
+#include "polyfill.h"
+
+/** Finest resolution in the table */
+#define CELL_BBOX_TABLE_RES 2
+
+/**
+ * Generates and prints the cell bounding box table, holding the boxes
+ * covering the children of every cell up to CELL_BBOX_TABLE_RES. Cells at
+ * each resolution are indexed by base cell followed by the index digits as a
+ * base-7 number. Pentagon slots for the deleted subsequence hold whatever
+ * _cellToBBoxComputed computes for them, so lookups match the computed path
+ * for any index.
+ */
+static int generate(void) {
+    printf("/*\n");
+    printf(" * Copyright 2026 Uber Technologies, Inc.\n");
+    printf(" *\n");
+    printf(" * Licensed under the Apache License, Version 2.0 (the "
+           "\"License\");\n");
+    printf(" * you may not use this file except in compliance with the "
+           "License.\n");
+    printf(" * You may obtain a copy of the License at\n");
+    printf(" *\n");
+    printf(" *         http://www.apache.org/licenses/LICENSE-2.0\n");
+    printf(" *\n");
+    printf(" * Unless required by applicable law or agreed to in writing, "
+           "software\n");
+    printf(" * distributed under the License is distributed on an \"AS IS\" "
+           "BASIS,\n");
+    printf(" * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express "
+           "or implied.\n");
+    printf(" * See the License for the specific language governing "
+           "permissions and\n");
+    printf(" * limitations under the License.\n");
+    printf(" */\n");
+    printf("/** @file cellBBoxTable.h\n");
+    printf(" * @brief   Bounding boxes covering the children of coarse "
+           "cells\n");
+    printf(" *\n");
+    printf(" * Generated by generateCellBBoxTable. Do not edit.\n");
+    printf(" */\n\n");
+    printf("#ifndef CELL_BBOX_TABLE_H\n");
+    printf("#define CELL_BBOX_TABLE_H\n\n");
+    printf("#include \"bbox.h\"\n\n");
+    printf("/** Finest resolution in the table */\n");
+    printf("#define CELL_BBOX_TABLE_RES %d\n\n", CELL_BBOX_TABLE_RES);
+
+    int64_t offsets[CELL_BBOX_TABLE_RES + 1] = {0};
+    int64_t numCells = NUM_BASE_CELLS;
+    int64_t total = 0;
+    for (int res = 0; res <= CELL_BBOX_TABLE_RES; res++) {
+        offsets[res] = total;
+        total += numCells;
+        numCells *= 7;
+    }
+
+    printf("/** Offset of each resolution in CELL_BBOXES */\n");
+    printf("static const int64_t CELL_BBOXES_OFFSETS[%d] = {",
+           CELL_BBOX_TABLE_RES + 1);
+    for (int res = 0; res <= CELL_BBOX_TABLE_RES; res++) {
+        printf("%s%lld", res ? ", " : "", (long long)offsets[res]);
+    }
+    printf("};\n\n");
+
+    printf("/** Bounding boxes covering the children of each cell */\n");
+    printf("static const BBox CELL_BBOXES[%lld] = {\n", (long long)total);
+    numCells = NUM_BASE_CELLS;
+    for (int res = 0; res <= CELL_BBOX_TABLE_RES; res++) {
+        for (int64_t i = 0; i < numCells; i++) {
+            // Decode the table index into a cell
+            H3Index cell;
+            int64_t remainder = i;
+            setH3Index(&cell, res, 0, CENTER_DIGIT);
+            for (int r = res; r >= 1; r--) {
+                H3_SET_INDEX_DIGIT(cell, r, remainder % 7);
+                remainder /= 7;
+            }
+            H3_SET_BASE_CELL(cell, remainder);
+
+            BBox bbox;
+            if (_cellToBBoxComputed(cell, &bbox, true) != E_SUCCESS) {
+                fprintf(stderr, "failed to get bbox for %llx\n",
+                        (unsigned long long)cell);
+                return 1;
+            }
+            printf("    {%.17g, %.17g,\n     %.17g, %.17g},\n", bbox.north,
+                   bbox.south, bbox.east, bbox.west);
+        }
+        numCells *= 7;
+    }
+    printf("};\n\n");
+    printf("#endif\n");
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    // check command line args
+    if (argc > 1) {
+        fprintf(stderr, "usage: %s\n", argv[0]);
+        exit(1);
+    }
+
+    return generate();
+}
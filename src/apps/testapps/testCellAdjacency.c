@@ -0,0 +1,136 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+
+#include "cellAdjacency.h"
+#include "constants.h"
+#include "h3api.h"
+#include "test.h"
+#include "utility.h"
+
+/** Removes H3_NULL gaps, e.g. from gridDisk around a pentagon */
+static int64_t removeNull(H3Index *cells, int64_t numCells) {
+    int64_t out = 0;
+    for (int64_t i = 0; i < numCells; i++) {
+        if (cells[i]) {
+            cells[out++] = cells[i];
+        }
+    }
+    return out;
+}
+
+/**
+ * Checks that the graph has an edge between exactly the pairs of cells that
+ * are neighbors, with the lengths of their directed edges.
+ */
+static void assertAdjacency(const H3Index *cells, int64_t numCells,
+                            const CellAdjacency *adjacency) {
+    t_assert(adjacency->numCells == numCells, "number of cells");
+    t_assert(adjacency->offsets[0] == 0, "offsets start at 0");
+    t_assert(adjacency->offsets[numCells] == adjacency->numEdges,
+             "offsets end at the number of edges");
+    int64_t numNeighborPairs = 0;
+    for (int64_t i = 0; i < numCells; i++) {
+        for (int64_t j = 0; j < numCells; j++) {
+            int isNeighbor;
+            t_assertSuccess(
+                H3_EXPORT(areNeighborCells)(cells[i], cells[j], &isNeighbor));
+            numNeighborPairs += isNeighbor;
+        }
+        for (int64_t e = adjacency->offsets[i]; e < adjacency->offsets[i + 1];
+             e++) {
+            H3Index neighbor = cells[adjacency->neighbors[e]];
+            int isNeighbor;
+            t_assertSuccess(
+                H3_EXPORT(areNeighborCells)(cells[i], neighbor, &isNeighbor));
+            t_assert(isNeighbor, "edge is between neighbors");
+            if (adjacency->edgeLengths) {
+                H3Index edge;
+                t_assertSuccess(
+                    H3_EXPORT(cellsToDirectedEdge)(cells[i], neighbor, &edge));
+                double length;
+                t_assertSuccess(H3_EXPORT(edgeLengthRads)(edge, &length));
+                t_assert(adjacency->edgeLengths[e] == length, "edge length");
+            }
+        }
+    }
+    t_assert(adjacency->numEdges == numNeighborPairs, "all neighbors found");
+}
+
+SUITE(cellAdjacency) {
+    TEST(gridDisks) {
+        // Disks around a hexagon and a pentagon, with and without lengths
+        H3Index pentagons[NUM_PENTAGONS] = {0};
+        t_assertSuccess(H3_EXPORT(getPentagons)(7, pentagons));
+        H3Index origins[2] = {0x8a283470d95ffff, pentagons[0]};
+        for (int o = 0; o < 2; o++) {
+            int64_t numCells;
+            t_assertSuccess(H3_EXPORT(maxGridDiskSize)(4, &numCells));
+            H3Index *cells = calloc(numCells, sizeof(H3Index));
+            t_assertSuccess(H3_EXPORT(gridDisk)(origins[o], 4, cells));
+            numCells = removeNull(cells, numCells);
+            for (int lengths = 0; lengths < 2; lengths++) {
+                CellAdjacency adjacency;
+                t_assertSuccess(H3_EXPORT(cellsToAdjacency)(
+                    cells, numCells, lengths, &adjacency));
+                t_assert((adjacency.edgeLengths != NULL) == lengths,
+                         "lengths only when requested");
+                assertAdjacency(cells, numCells, &adjacency);
+                H3_EXPORT(destroyCellAdjacency)(&adjacency);
+            }
+            free(cells);
+        }
+    }
+
+    TEST(sparseSet) {
+        // Every other cell of a ring, so that no cells are neighbors, and
+        // a cell of another resolution
+        H3Index ring[6];
+        t_assertSuccess(H3_EXPORT(gridRing)(0x8a283470d95ffff, 1, ring));
+        H3Index cells[] = {ring[0], ring[2], ring[4], 0x8928347043bffff};
+        CellAdjacency adjacency;
+        t_assertSuccess(
+            H3_EXPORT(cellsToAdjacency)(cells, 4, false, &adjacency));
+        t_assert(adjacency.numEdges == 0, "no edges");
+        for (int i = 0; i <= 4; i++) {
+            t_assert(adjacency.offsets[i] == 0, "empty rows");
+        }
+        H3_EXPORT(destroyCellAdjacency)(&adjacency);
+
+        t_assertSuccess(
+            H3_EXPORT(cellsToAdjacency)(NULL, 0, true, &adjacency));
+        t_assert(adjacency.numCells == 0 && adjacency.offsets[0] == 0,
+                 "empty graph");
+        H3_EXPORT(destroyCellAdjacency)(&adjacency);
+    }
+
+    TEST(invalidInputs) {
+        CellAdjacency adjacency;
+        H3Index duplicates[] = {0x8a283470d95ffff, 0x8a283470d947fff,
+                                0x8a283470d95ffff};
+        t_assert(H3_EXPORT(cellsToAdjacency)(duplicates, 3, false,
+                                             &adjacency) == E_DUPLICATE_INPUT,
+                 "duplicate cells");
+        H3Index invalid[] = {0x8a283470d95ffff, 0x7fffffffffffffff};
+        t_assert(H3_EXPORT(cellsToAdjacency)(invalid, 2, false, &adjacency) ==
+                     E_CELL_INVALID,
+                 "invalid cell");
+        t_assert(H3_EXPORT(cellsToAdjacency)(invalid, -1, false,
+                                             &adjacency) == E_DOMAIN,
+                 "negative count");
+    }
+}
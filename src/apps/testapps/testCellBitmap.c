@@ -0,0 +1,225 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+
+#include "cellBitmap.h"
+#include "cellsToMultiPoly.h"
+#include "h3Index.h"
+#include "test.h"
+
+/** Removes H3_NULL gaps, e.g. from compactCells output */
+static int64_t removeNull(H3Index *cells, int64_t numCells) {
+    int64_t out = 0;
+    for (int64_t i = 0; i < numCells; i++) {
+        if (cells[i]) {
+            cells[out++] = cells[i];
+        }
+    }
+    return out;
+}
+
+/**
+ * Checks that a set round trips through its cells and compacted cells, and
+ * that the compacted cells match compactCells.
+ */
+static void assertRoundTrip(const CellBitmap *bitmap) {
+    int64_t count = H3_EXPORT(cellBitmapCount)(bitmap);
+    H3Index *cells = calloc(count + 1, sizeof(H3Index));
+    t_assertSuccess(H3_EXPORT(cellBitmapToCells)(bitmap, cells));
+    for (int64_t i = 0; i < count; i++) {
+        t_assert(H3_EXPORT(cellBitmapContains)(bitmap, cells[i]),
+                 "cell is in the set");
+        if (i > 0) {
+            int64_t prev, pos;
+            t_assertSuccess(H3_EXPORT(cellToChildPos)(
+                cells[i - 1], H3_GET_RESOLUTION(bitmap->parent), &prev));
+            t_assertSuccess(H3_EXPORT(cellToChildPos)(
+                cells[i], H3_GET_RESOLUTION(bitmap->parent), &pos));
+            t_assert(prev < pos, "cells are in position order");
+        }
+    }
+
+    H3Index *compact = calloc(count + 1, sizeof(H3Index));
+    int64_t numCompact;
+    t_assertSuccess(
+        H3_EXPORT(cellBitmapToCompactCells)(bitmap, compact, &numCompact));
+    H3Index *expected = calloc(count + 1, sizeof(H3Index));
+    t_assertSuccess(H3_EXPORT(compactCells)(cells, expected, count));
+    int64_t numExpected = removeNull(expected, count);
+    t_assert(numCompact == numExpected, "same number of compacted cells");
+    qsort(compact, numCompact, sizeof(H3Index), cmp_uint64);
+    qsort(expected, numExpected, sizeof(H3Index), cmp_uint64);
+    for (int64_t i = 0; i < numCompact && i < numExpected; i++) {
+        t_assert(compact[i] == expected[i], "same compacted cells");
+    }
+
+    CellBitmap copy;
+    t_assertSuccess(
+        H3_EXPORT(initCellBitmap)(bitmap->parent, bitmap->res, &copy));
+    t_assertSuccess(H3_EXPORT(cellBitmapAddCells)(&copy, compact, numCompact));
+    for (int64_t i = 0; i < (bitmap->numBits + 63) / 64; i++) {
+        t_assert(copy.words[i] == bitmap->words[i], "compacted round trips");
+    }
+    H3_EXPORT(destroyCellBitmap)(&copy);
+    free(expected);
+    free(compact);
+    free(cells);
+}
+
+SUITE(cellBitmap) {
+    TEST(gridDisks) {
+        // Disks clipped to a res 5 hexagon and a res 2 pentagon
+        H3Index pentagons[NUM_PENTAGONS] = {0};
+        t_assertSuccess(H3_EXPORT(getPentagons)(2, pentagons));
+        H3Index parents[] = {0x85283473fffffff, pentagons[0]};
+        int resolutions[] = {9, 5};
+        for (int p = 0; p < 2; p++) {
+            H3Index origin;
+            t_assertSuccess(H3_EXPORT(cellToCenterChild)(
+                parents[p], resolutions[p], &origin));
+            int64_t numCells;
+            t_assertSuccess(H3_EXPORT(maxGridDiskSize)(6, &numCells));
+            H3Index *cells = calloc(numCells, sizeof(H3Index));
+            t_assertSuccess(H3_EXPORT(gridDisk)(origin, 6, cells));
+
+            CellBitmap bitmap;
+            t_assertSuccess(H3_EXPORT(initCellBitmap)(
+                parents[p], resolutions[p], &bitmap));
+            int64_t numInside = 0;
+            for (int64_t i = 0; i < numCells; i++) {
+                H3Index parent;
+                if (cells[i] &&
+                    !H3_EXPORT(cellToParent)(cells[i],
+                                             H3_GET_RESOLUTION(parents[p]),
+                                             &parent) &&
+                    parent == parents[p]) {
+                    cells[numInside++] = cells[i];
+                }
+            }
+            t_assertSuccess(
+                H3_EXPORT(cellBitmapAddCells)(&bitmap, cells, numInside));
+            t_assert(H3_EXPORT(cellBitmapCount)(&bitmap) == numInside,
+                     "count matches");
+            assertRoundTrip(&bitmap);
+            H3_EXPORT(destroyCellBitmap)(&bitmap);
+            free(cells);
+        }
+    }
+
+    TEST(compactedInput) {
+        // Adding a coarser cell adds all of its descendants
+        H3Index parent = 0x85283473fffffff;
+        CellBitmap bitmap;
+        t_assertSuccess(H3_EXPORT(initCellBitmap)(parent, 8, &bitmap));
+        H3Index child;
+        t_assertSuccess(H3_EXPORT(childPosToCell)(3, parent, 6, &child));
+        H3Index cells[] = {child, H3_NULL};
+        t_assertSuccess(H3_EXPORT(cellBitmapAddCells)(&bitmap, cells, 2));
+        t_assert(H3_EXPORT(cellBitmapCount)(&bitmap) == 49, "49 descendants");
+        t_assert(H3_EXPORT(cellBitmapContains)(&bitmap, child),
+                 "contains the coarse cell");
+        t_assert(!H3_EXPORT(cellBitmapContains)(&bitmap, parent),
+                 "does not contain the parent");
+        H3Index compact[49];
+        int64_t numCompact;
+        t_assertSuccess(
+            H3_EXPORT(cellBitmapToCompactCells)(&bitmap, compact, &numCompact));
+        t_assert(numCompact == 1 && compact[0] == child, "compacts back");
+
+        t_assertSuccess(H3_EXPORT(cellBitmapAddCells)(&bitmap, &parent, 1));
+        t_assert(H3_EXPORT(cellBitmapCount)(&bitmap) == bitmap.numBits,
+                 "parent fills the set");
+        t_assertSuccess(
+            H3_EXPORT(cellBitmapToCompactCells)(&bitmap, compact, &numCompact));
+        t_assert(numCompact == 1 && compact[0] == parent, "compacts to parent");
+        assertRoundTrip(&bitmap);
+        H3_EXPORT(destroyCellBitmap)(&bitmap);
+    }
+
+    TEST(unionIntersect) {
+        H3Index parent = 0x85283473fffffff;
+        CellBitmap a, b;
+        t_assertSuccess(H3_EXPORT(initCellBitmap)(parent, 7, &a));
+        t_assertSuccess(H3_EXPORT(initCellBitmap)(parent, 7, &b));
+        H3Index children[49];
+        t_assertSuccess(H3_EXPORT(cellToChildren)(parent, 7, children));
+        t_assertSuccess(H3_EXPORT(cellBitmapAddCells)(&a, children, 30));
+        t_assertSuccess(H3_EXPORT(cellBitmapAddCells)(&b, children + 20, 29));
+
+        CellBitmap both;
+        t_assertSuccess(H3_EXPORT(initCellBitmap)(parent, 7, &both));
+        t_assertSuccess(H3_EXPORT(cellBitmapUnion)(&both, &a));
+        t_assertSuccess(H3_EXPORT(cellBitmapIntersect)(&both, &b));
+        t_assert(H3_EXPORT(cellBitmapCount)(&both) == 10, "intersection");
+        t_assert(H3_EXPORT(cellBitmapContains)(&both, children[25]) &&
+                     !H3_EXPORT(cellBitmapContains)(&both, children[19]),
+                 "intersection cells");
+        t_assertSuccess(H3_EXPORT(cellBitmapUnion)(&a, &b));
+        t_assert(H3_EXPORT(cellBitmapCount)(&a) == 49, "union");
+
+        CellBitmap other;
+        t_assertSuccess(H3_EXPORT(initCellBitmap)(parent, 8, &other));
+        t_assert(H3_EXPORT(cellBitmapUnion)(&a, &other) == E_RES_MISMATCH,
+                 "different resolution");
+        H3_EXPORT(destroyCellBitmap)(&other);
+        t_assertSuccess(
+            H3_EXPORT(initCellBitmap)(0x8528340bfffffff, 7, &other));
+        t_assert(H3_EXPORT(cellBitmapIntersect)(&a, &other) == E_DOMAIN,
+                 "different parent");
+        H3_EXPORT(destroyCellBitmap)(&other);
+        H3_EXPORT(destroyCellBitmap)(&both);
+        H3_EXPORT(destroyCellBitmap)(&b);
+        H3_EXPORT(destroyCellBitmap)(&a);
+    }
+
+    TEST(invalidInputs) {
+        CellBitmap bitmap;
+        t_assert(H3_EXPORT(initCellBitmap)(0x85283473fffffff, 4, &bitmap) ==
+                     E_RES_DOMAIN,
+                 "coarser resolution");
+        t_assert(H3_EXPORT(initCellBitmap)(0x7fffffffffffffff, 4, &bitmap) ==
+                     E_CELL_INVALID,
+                 "invalid parent");
+        t_assertSuccess(
+            H3_EXPORT(initCellBitmap)(0x85283473fffffff, 6, &bitmap));
+        H3Index finer = 0x872834709ffffff;
+        H3Index coarser = 0x84283473fffffff;
+        H3Index outside;
+        t_assertSuccess(
+            H3_EXPORT(cellToCenterChild)(0x8528340bfffffff, 6, &outside));
+        t_assert(H3_EXPORT(cellBitmapAddCells)(&bitmap, &finer, 1) ==
+                     E_RES_MISMATCH,
+                 "finer cell");
+        t_assert(H3_EXPORT(cellBitmapAddCells)(&bitmap, &coarser, 1) ==
+                     E_RES_MISMATCH,
+                 "coarser cell");
+        t_assert(H3_EXPORT(cellBitmapAddCells)(&bitmap, &outside, 1) ==
+                     E_DOMAIN,
+                 "cell outside the parent");
+        t_assert(H3_EXPORT(cellBitmapAddCells)(&bitmap, &outside, -1) ==
+                     E_DOMAIN,
+                 "negative count");
+        t_assert(!H3_EXPORT(cellBitmapContains)(&bitmap, outside),
+                 "outside cell is not contained");
+        t_assert(H3_EXPORT(cellBitmapCount)(&bitmap) == 0, "still empty");
+        int64_t numCompact;
+        t_assertSuccess(
+            H3_EXPORT(cellBitmapToCompactCells)(&bitmap, NULL, &numCompact));
+        t_assert(numCompact == 0, "empty set compacts to nothing");
+        H3_EXPORT(destroyCellBitmap)(&bitmap);
+    }
+}
@@ -86,6 +86,18 @@ static void childBBox_assertions(H3Index h3) {
     }
 }
 
+static void tableBBox_assertions(H3Index h3) {
+    // Whether or not the precomputed table covers this resolution, the
+    // result must match computing the box directly
+    for (int coverChildren = 0; coverChildren <= 1; coverChildren++) {
+        BBox bbox;
+        t_assertSuccess(cellToBBox(h3, &bbox, coverChildren));
+        BBox expected;
+        t_assertSuccess(_cellToBBoxComputed(h3, &expected, coverChildren));
+        t_assert(bboxEquals(&bbox, &expected), "BBox matches computed bbox");
+    }
+}
+
 SUITE(cellToBBox) {
     TEST(cellBBox_correctness) {
         iterateAllIndexesAtRes(0, cellBBox_assertions);
@@ -97,4 +109,10 @@ SUITE(cellToBBox) {
         iterateAllIndexesAtRes(1, childBBox_assertions);
         iterateAllIndexesAtRes(2, childBBox_assertions);
     }
+    TEST(tableBBox_matchesComputed) {
+        iterateAllIndexesAtRes(0, tableBBox_assertions);
+        iterateAllIndexesAtRes(1, tableBBox_assertions);
+        iterateAllIndexesAtRes(2, tableBBox_assertions);
+        iterateAllIndexesAtRes(3, tableBBox_assertions);
+    }
 }
@@ -79,4 +79,40 @@ SUITE(cellToCenterChild) {
                                               &child) == E_RES_DOMAIN,
                  "should fail beyond finest resolution");
     }
+
+    TEST(cellsToCenterChild) {
+        // One cell at each resolution, so some fail for every child res
+        H3Index cells[MAX_H3_RES + 1];
+        for (int res = 0; res <= MAX_H3_RES; res++) {
+            t_assertSuccess(
+                H3_EXPORT(latLngToCell)(&baseCentroid, res, &cells[res]));
+        }
+        H3Index children[MAX_H3_RES + 1];
+        uint64_t errors;
+        for (int childRes = 0; childRes <= MAX_H3_RES; childRes++) {
+            H3Error expectedErr =
+                childRes < MAX_H3_RES ? E_RES_DOMAIN : E_SUCCESS;
+            t_assert(H3_EXPORT(cellsToCenterChild)(cells, MAX_H3_RES + 1,
+                                                   childRes, children,
+                                                   &errors) == expectedErr,
+                     "fails if any cell fails");
+            for (int i = 0; i <= MAX_H3_RES; i++) {
+                H3Index child = H3_NULL;
+                H3Error err =
+                    H3_EXPORT(cellToCenterChild)(cells[i], childRes, &child);
+                t_assert(children[i] == child,
+                         "same child as cellToCenterChild");
+                t_assert(((errors >> i) & 1) == (err != E_SUCCESS),
+                         "same error as cellToCenterChild");
+            }
+        }
+        t_assertSuccess(H3_EXPORT(cellsToCenterChild)(cells, 8, 7, children,
+                                                      NULL));
+        t_assert(H3_EXPORT(cellsToCenterChild)(cells, 1, -1, children,
+                                               &errors) == E_RES_DOMAIN,
+                 "should fail for negative resolution");
+        t_assert(H3_EXPORT(cellsToCenterChild)(cells, -1, 15, children,
+                                               &errors) == E_DOMAIN,
+                 "should fail for negative count");
+    }
 }
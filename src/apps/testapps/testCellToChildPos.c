@@ -14,7 +14,8 @@
  * limitations under the License.
  */
 /** @file
- * @brief tests H3 functions `cellToChildPos` and `childPosToCell`
+ * @brief tests H3 functions `cellToChildPos` and `childPosToCell`, and their
+ * array variants
  *
  *  usage: `testCellToChildPos`
  */
@@ -51,6 +52,20 @@ static void childPos_assertions(H3Index h3) {
             t_assert(cell == children[i], "cell matches expected");
         }
 
+        // Array variants
+        int64_t *positions = calloc(numChildren, sizeof(int64_t));
+        H3Index *cells = calloc(numChildren, sizeof(H3Index));
+        t_assertSuccess(H3_EXPORT(cellsToChildPos)(children, numChildren,
+                                                   parentRes, positions, NULL));
+        t_assertSuccess(H3_EXPORT(childPosToCells)(positions, numChildren, h3,
+                                                   childRes, cells, NULL));
+        for (int64_t i = 0; i < numChildren; i++) {
+            t_assert(positions[i] == i, "batch childPos matches index");
+            t_assert(cells[i] == children[i], "batch cell matches expected");
+        }
+
+        free(cells);
+        free(positions);
         free(children);
     }
 }
@@ -140,4 +155,78 @@ SUITE(cellToChildPos) {
             H3_EXPORT(cellToChildPos)(child, 0, &childPos) == E_CELL_INVALID,
             "error matches expected for invalid cell");
     }
+
+    TEST(childPos_finestResolution) {
+        // Positions of res 15 descendants of res 0 cells need all 15 digits
+        H3Index cells[] = {0x8029fffffffffff, 0x8009fffffffffff};
+        for (int c = 0; c < 2; c++) {
+            int64_t numChildren;
+            t_assertSuccess(
+                H3_EXPORT(cellToChildrenSize)(cells[c], 15, &numChildren));
+            int64_t positions[] = {0, 1, 7, 123456789, numChildren / 2,
+                                   numChildren - 2, numChildren - 1};
+            for (int i = 0; i < 7; i++) {
+                H3Index child;
+                t_assertSuccess(H3_EXPORT(childPosToCell)(
+                    positions[i], cells[c], 15, &child));
+                t_assert(H3_EXPORT(isValidCell)(child), "child is valid");
+                H3Index parent;
+                t_assertSuccess(H3_EXPORT(cellToParent)(child, 0, &parent));
+                t_assert(parent == cells[c], "child has the parent");
+                int64_t pos;
+                t_assertSuccess(H3_EXPORT(cellToChildPos)(child, 0, &pos));
+                t_assert(pos == positions[i], "position round trips");
+            }
+        }
+    }
+
+    TEST(cellsToChildPos_errors) {
+        H3Index invalidDigit = 0x88283080ddfffff;
+        H3_SET_INDEX_DIGIT(invalidDigit, 6, INVALID_DIGIT);
+        H3Index deleted;
+        setH3Index(&deleted, 8, 4, CENTER_DIGIT);
+        H3_SET_INDEX_DIGIT(deleted, 7, K_AXES_DIGIT);
+        H3Index cells[] = {0x88283080ddfffff, invalidDigit, 0x84283473fffffff,
+                           deleted};
+        int64_t positions[4];
+        uint64_t errors;
+        t_assert(H3_EXPORT(cellsToChildPos)(cells, 4, 5, positions, &errors) ==
+                     E_CELL_INVALID,
+                 "first error is returned");
+        t_assert(errors == 0xe, "errors are marked");
+        t_assert(positions[1] == -1 && positions[2] == -1 &&
+                     positions[3] == -1,
+                 "failed positions are -1");
+        t_assert(H3_EXPORT(cellsToChildPos)(cells, 1, 16, positions, NULL) ==
+                     E_RES_DOMAIN,
+                 "invalid resolution");
+        t_assert(H3_EXPORT(cellsToChildPos)(cells, -1, 5, positions, NULL) ==
+                     E_DOMAIN,
+                 "negative count");
+    }
+
+    TEST(childPosToCells_errors) {
+        H3Index parent = 0x88283080ddfffff;
+        int64_t positions[] = {48, -1, 49, 0};
+        H3Index cells[4];
+        uint64_t errors;
+        t_assert(H3_EXPORT(childPosToCells)(positions, 4, parent, 10, cells,
+                                            &errors) == E_DOMAIN,
+                 "positions out of range fail");
+        t_assert(errors == 0x6, "errors are marked");
+        t_assert(cells[1] == H3_NULL && cells[2] == H3_NULL,
+                 "failed cells are H3_NULL");
+        H3Index center;
+        t_assertSuccess(H3_EXPORT(cellToCenterChild)(parent, 10, &center));
+        t_assert(cells[3] == center, "position 0 is the center child");
+        t_assert(H3_EXPORT(childPosToCells)(positions, 4, parent, 7, cells,
+                                            NULL) == E_RES_MISMATCH,
+                 "coarser child resolution");
+        t_assert(H3_EXPORT(childPosToCells)(positions, 4, parent, 16, cells,
+                                            NULL) == E_RES_DOMAIN,
+                 "invalid resolution");
+        t_assert(H3_EXPORT(childPosToCells)(positions, -1, parent, 10, cells,
+                                            NULL) == E_DOMAIN,
+                 "negative count");
+    }
 }
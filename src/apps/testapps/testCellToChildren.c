@@ -22,6 +22,7 @@
 #include <stdlib.h>
 
 #include "h3api.h"
+#include "iterators.h"
 #include "test.h"
 
 static void assertNoDuplicates(H3Index *cells, int n) {
@@ -80,6 +81,26 @@ static void checkChildren(H3Index h, int res, H3Error expectedError,
     free(children);
 }
 
+// assert that cellToChildren gives the same cells in the same order as the
+// children iterator
+static void assertChildrenMatchIterator(H3Index h, int res) {
+    int64_t numChildren;
+    t_assertSuccess(H3_EXPORT(cellToChildrenSize)(h, res, &numChildren));
+    H3Index *children = calloc(numChildren, sizeof(H3Index));
+    t_assertSuccess(H3_EXPORT(cellToChildren)(h, res, children));
+
+    int64_t i = 0;
+    for (IterCellsChildren iter = iterInitParent(h, res); iter.h;
+         iterStepChild(&iter)) {
+        t_assert(i < numChildren, "iterator no longer than children");
+        t_assert(children[i] == iter.h, "same child in same order");
+        i++;
+    }
+    t_assert(i == numChildren, "iterator no shorter than children");
+
+    free(children);
+}
+
 SUITE(cellToChildren_new) {
     TEST(oneResStep) {
         H3Index h = 0x88283080ddfffff;
@@ -174,4 +195,19 @@ SUITE(cellToChildren_new) {
         checkChildren(h, res, E_SUCCESS, expected,
                       sizeof(expected) / sizeof(H3Index));
     }
+
+    TEST(matchesIterator) {
+        // Four or more levels down, children are written in blocks of 343
+        // with a carry into the higher digits
+        H3Index pentagons[NUM_PENTAGONS] = {0};
+        t_assertSuccess(H3_EXPORT(getPentagons)(2, pentagons));
+        H3Index parents[] = {0x85283473fffffff, 0x8009fffffffffff,
+                             pentagons[0]};
+        for (size_t i = 0; i < sizeof(parents) / sizeof(H3Index); i++) {
+            int parentRes = H3_EXPORT(getResolution)(parents[i]);
+            for (int res = parentRes; res <= parentRes + 5; res++) {
+                assertChildrenMatchIterator(parents[i], res);
+            }
+        }
+    }
 }
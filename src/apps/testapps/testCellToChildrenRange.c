@@ -0,0 +1,168 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file
+ * @brief tests H3 functions `cellToChildrenRange` and
+ * `compactCellsToChildrenRanges`
+ *
+ *  usage: `testCellToChildrenRange`
+ */
+
+#include <stdlib.h>
+
+#include "h3Index.h"
+#include "test.h"
+
+/** Returns whether h is in one of the ranges */
+static bool inRanges(H3Index h, const H3Index *ranges, int64_t numRanges) {
+    for (int64_t i = 0; i < numRanges; i++) {
+        if (h >= ranges[2 * i] && h <= ranges[2 * i + 1]) return true;
+    }
+    return false;
+}
+
+SUITE(cellToChildrenRange) {
+    TEST(childrenInRange) {
+        H3Index cells[] = {0x85283473fffffff, 0x8508000ffffffff,
+                           0x8029fffffffffff, 0x8f283470d921c64};
+        for (int c = 0; c < 4; c++) {
+            int res = H3_EXPORT(getResolution)(cells[c]);
+            for (int childRes = res; childRes <= res + 3 && childRes <= 15;
+                 childRes++) {
+                H3Index min, max;
+                t_assertSuccess(H3_EXPORT(cellToChildrenRange)(
+                    cells[c], childRes, &min, &max));
+                H3Index center;
+                t_assertSuccess(
+                    H3_EXPORT(cellToCenterChild)(cells[c], childRes, &center));
+                t_assert(min == center, "min is the center child");
+
+                int64_t numChildren;
+                t_assertSuccess(H3_EXPORT(cellToChildrenSize)(
+                    cells[c], childRes, &numChildren));
+                H3Index *children = calloc(numChildren, sizeof(H3Index));
+                t_assertSuccess(
+                    H3_EXPORT(cellToChildren)(cells[c], childRes, children));
+                bool foundMax = false;
+                for (int64_t i = 0; i < numChildren; i++) {
+                    t_assert(children[i] >= min && children[i] <= max,
+                             "child is in range");
+                    foundMax |= children[i] == max;
+                }
+                t_assert(foundMax, "max is a child");
+                free(children);
+            }
+        }
+    }
+
+    TEST(invalidRes) {
+        H3Index min, max;
+        t_assert(H3_EXPORT(cellToChildrenRange)(0x85283473fffffff, 4, &min,
+                                                &max) == E_RES_DOMAIN,
+                 "coarser resolution fails");
+        t_assert(H3_EXPORT(cellToChildrenRange)(0x85283473fffffff, 16, &min,
+                                                &max) == E_RES_DOMAIN,
+                 "invalid resolution fails");
+    }
+
+    TEST(compactedRanges) {
+        // A disk compacts to cells of mixed resolution, whose children
+        // ranges at the disk's resolution merge where they are adjacent.
+        H3Index origin = 0x89283470c27ffff;
+        int64_t numCells;
+        t_assertSuccess(H3_EXPORT(maxGridDiskSize)(20, &numCells));
+        H3Index *cells = calloc(numCells, sizeof(H3Index));
+        H3Index *compacted = calloc(numCells, sizeof(H3Index));
+        t_assertSuccess(H3_EXPORT(gridDisk)(origin, 20, cells));
+        t_assertSuccess(H3_EXPORT(compactCells)(cells, compacted, numCells));
+        int64_t numCompacted = 0;
+        while (numCompacted < numCells && compacted[numCompacted]) {
+            numCompacted++;
+        }
+
+        H3Index *ranges = calloc(2 * numCells, sizeof(H3Index));
+        int64_t numRanges;
+        // H3_NULL gaps in the input are skipped
+        t_assertSuccess(H3_EXPORT(compactCellsToChildrenRanges)(
+            compacted, numCells, 9, ranges, &numRanges));
+        t_assert(numRanges > 0 && numRanges < numCompacted,
+                 "some ranges are merged");
+        for (int64_t i = 0; i < numRanges; i++) {
+            t_assert(ranges[2 * i] <= ranges[2 * i + 1], "range is ordered");
+            if (i > 0) {
+                t_assert(ranges[2 * i - 1] < ranges[2 * i],
+                         "ranges are sorted and disjoint");
+            }
+        }
+
+        // Every cell of the disk is in a range, and every valid res 9 cell
+        // at the ends of the ranges is in the disk.
+        for (int64_t i = 0; i < numCells; i++) {
+            t_assert(inRanges(cells[i], ranges, numRanges), "cell in range");
+        }
+        for (int64_t i = 0; i < 2 * numRanges; i++) {
+            bool found = false;
+            for (int64_t j = 0; j < numCells; j++) {
+                found |= cells[j] == ranges[i];
+            }
+            t_assert(found, "range ends are in the disk");
+        }
+
+        t_assert(H3_EXPORT(compactCellsToChildrenRanges)(
+                     compacted, numCompacted, 8, ranges, &numRanges) ==
+                     E_RES_MISMATCH,
+                 "finer cells than the resolution fail");
+        t_assert(H3_EXPORT(compactCellsToChildrenRanges)(
+                     compacted, numCompacted, MAX_H3_RES + 1, ranges,
+                     &numRanges) == E_RES_DOMAIN,
+                 "invalid resolution fails");
+        t_assert(H3_EXPORT(compactCellsToChildrenRanges)(
+                     compacted, numCompacted, -1, ranges, &numRanges) ==
+                     E_RES_DOMAIN,
+                 "negative resolution fails");
+        free(ranges);
+        free(compacted);
+        free(cells);
+    }
+
+    TEST(siblingsMerge) {
+        // The children of a cell, as separate inputs, merge into its range
+        H3Index parent = 0x85283473fffffff;
+        H3Index children[7];
+        t_assertSuccess(H3_EXPORT(cellToChildren)(parent, 6, children));
+        H3Index ranges[14];
+        int64_t numRanges;
+        t_assertSuccess(H3_EXPORT(compactCellsToChildrenRanges)(
+            children, 7, 8, ranges, &numRanges));
+        H3Index min, max;
+        t_assertSuccess(H3_EXPORT(cellToChildrenRange)(parent, 8, &min, &max));
+        t_assert(numRanges == 1, "one range");
+        t_assert(ranges[0] == min && ranges[1] == max, "parent's range");
+
+        // Without the center child there is a gap
+        t_assertSuccess(H3_EXPORT(compactCellsToChildrenRanges)(
+            children + 1, 6, 8, ranges, &numRanges));
+        t_assert(numRanges == 1, "one range without the center");
+        t_assert(ranges[0] > min && ranges[1] == max, "center is excluded");
+        H3Index withoutOne[] = {children[0], children[1], children[3]};
+        t_assertSuccess(H3_EXPORT(compactCellsToChildrenRanges)(
+            withoutOne, 3, 8, ranges, &numRanges));
+        t_assert(numRanges == 2, "gap between ranges");
+
+        t_assertSuccess(H3_EXPORT(compactCellsToChildrenRanges)(
+            NULL, 0, 8, ranges, &numRanges));
+        t_assert(numRanges == 0, "no cells, no ranges");
+    }
+}
@@ -54,4 +54,37 @@ SUITE(cellToParent) {
         t_assert(H3_EXPORT(cellToParent)(child, 16, &parent) == E_RES_DOMAIN,
                  "Invalid resolution fails");
     }
+
+    TEST(cellsToParent) {
+        // One cell at each resolution, so some fail for every parent res
+        H3Index cells[MAX_H3_RES + 1];
+        for (int res = 0; res <= MAX_H3_RES; res++) {
+            t_assertSuccess(H3_EXPORT(latLngToCell)(&sf, res, &cells[res]));
+        }
+        H3Index parents[MAX_H3_RES + 1];
+        uint64_t errors;
+        for (int parentRes = 0; parentRes <= MAX_H3_RES; parentRes++) {
+            H3Error expectedErr = parentRes > 0 ? E_RES_MISMATCH : E_SUCCESS;
+            t_assert(H3_EXPORT(cellsToParent)(cells, MAX_H3_RES + 1,
+                                              parentRes, parents,
+                                              &errors) == expectedErr,
+                     "fails if any cell fails");
+            for (int i = 0; i <= MAX_H3_RES; i++) {
+                H3Index parent = H3_NULL;
+                H3Error err =
+                    H3_EXPORT(cellToParent)(cells[i], parentRes, &parent);
+                t_assert(parents[i] == parent, "same parent as cellToParent");
+                t_assert(((errors >> i) & 1) == (err != E_SUCCESS),
+                         "same error as cellToParent");
+            }
+        }
+        t_assertSuccess(H3_EXPORT(cellsToParent)(cells + 5, 11, 5, parents,
+                                                 NULL));
+        t_assert(H3_EXPORT(cellsToParent)(cells, 1, 16, parents, &errors) ==
+                     E_RES_DOMAIN,
+                 "Invalid resolution fails");
+        t_assert(H3_EXPORT(cellsToParent)(cells, -1, 0, parents, &errors) ==
+                     E_DOMAIN,
+                 "Negative count fails");
+    }
 }
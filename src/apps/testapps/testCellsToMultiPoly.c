@@ -18,6 +18,7 @@
 #include <inttypes.h>
 #include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "adder.h"
 #include "algos.h"
@@ -79,10 +80,58 @@ static void check_poly(GeoPolygon poly) {
     }
 }
 
+static void check_same_loop(GeoLoop a, GeoLoop b) {
+    t_assert(a.numVerts == b.numVerts, "Loops have same number of verts");
+    for (int i = 0; i < a.numVerts; i++) {
+        t_assert(a.verts[i].lat == b.verts[i].lat &&
+                     a.verts[i].lng == b.verts[i].lng,
+                 "Loops have same verts");
+    }
+}
+
+static void check_same_mpoly(GeoMultiPolygon a, GeoMultiPolygon b) {
+    t_assert(a.numPolygons == b.numPolygons, "Same number of polygons");
+    for (int i = 0; i < a.numPolygons; i++) {
+        GeoPolygon pa = a.polygons[i];
+        GeoPolygon pb = b.polygons[i];
+        check_same_loop(pa.geoloop, pb.geoloop);
+        t_assert(pa.numHoles == pb.numHoles, "Same number of holes");
+        for (int j = 0; j < pa.numHoles; j++) {
+            check_same_loop(pa.holes[j], pb.holes[j]);
+        }
+    }
+}
+
+// Check that the sorted, arena and parallel pipelines give exactly the same
+// output as the hash-based one
+static void check_alternate_mpolys(H3Index *cells, uint64_t num_cells,
+                                   GeoMultiPolygon mpoly) {
+    GeoMultiPolygon other;
+    t_assertSuccess(
+        H3_EXPORT(cellsToMultiPolygonSorted)(cells, num_cells, &other));
+    check_same_mpoly(mpoly, other);
+    H3_EXPORT(destroyGeoMultiPolygon)(&other);
+
+    Arena arena;
+    H3_EXPORT(initArena)(&arena, NULL, 0);
+    t_assertSuccess(H3_EXPORT(cellsToMultiPolygonArena)(cells, num_cells,
+                                                        &arena, &other));
+    check_same_mpoly(mpoly, other);
+    H3_EXPORT(destroyArena)(&arena);
+
+    for (int numThreads = 1; numThreads <= 3; numThreads += 2) {
+        t_assertSuccess(H3_EXPORT(cellsToMultiPolygonParallel)(
+            cells, num_cells, numThreads, &other));
+        check_same_mpoly(mpoly, other);
+        H3_EXPORT(destroyGeoMultiPolygon)(&other);
+    }
+}
+
 static GeoMultiPolygon get_mpoly(H3Index *cells, uint64_t num_cells) {
     double rel_tol = 1e-8;
     GeoMultiPolygon mpoly;
     t_assertSuccess(H3_EXPORT(cellsToMultiPolygon)(cells, num_cells, &mpoly));
+    check_alternate_mpolys(cells, num_cells, mpoly);
 
     for (int i = 0; i < mpoly.numPolygons - 1; i++) {
         t_assert(get_outer_loop_area(mpoly.polygons[i]) >=
@@ -114,6 +163,75 @@ static GeoMultiPolygon get_mpoly(H3Index *cells, uint64_t num_cells) {
     return mpoly;
 }
 
+// Check that two loops have the same vertexes, up to a cyclic rotation
+static void check_same_loop_rotated(GeoLoop a, GeoLoop b) {
+    t_assert(a.numVerts == b.numVerts, "Loops have same number of verts");
+    int start = -1;
+    for (int i = 0; i < b.numVerts; i++) {
+        if (a.verts[0].lat == b.verts[i].lat &&
+            a.verts[0].lng == b.verts[i].lng) {
+            start = i;
+            break;
+        }
+    }
+    t_assert(start >= 0, "Loops share a starting vertex");
+    for (int i = 0; i < a.numVerts; i++) {
+        LatLng v = b.verts[(start + i) % b.numVerts];
+        t_assert(a.verts[i].lat == v.lat && a.verts[i].lng == v.lng,
+                 "Loops have same verts");
+    }
+}
+
+// Check that a compacted set gives the same polygons as its uncompacted form
+static void check_compact_mpoly(H3Index *cells, int64_t num_cells) {
+    int res = 0;
+    for (int64_t i = 0; i < num_cells; i++) {
+        res = MAX(res, H3_EXPORT(getResolution)(cells[i]));
+    }
+    int64_t num_uncompacted;
+    t_assertSuccess(H3_EXPORT(uncompactCellsSize)(cells, num_cells, res,
+                                                  &num_uncompacted));
+    H3Index *uncompacted = calloc(num_uncompacted, sizeof(H3Index));
+    t_assertSuccess(H3_EXPORT(uncompactCells)(cells, num_cells, uncompacted,
+                                              num_uncompacted, res));
+
+    GeoMultiPolygon expected = get_mpoly(uncompacted, num_uncompacted);
+    GeoMultiPolygon mpoly;
+    t_assertSuccess(
+        H3_EXPORT(compactCellsToMultiPolygon)(cells, num_cells, &mpoly));
+
+    t_assert(mpoly.numPolygons == expected.numPolygons,
+             "Same number of polygons");
+    for (int i = 0; i < mpoly.numPolygons; i++) {
+        GeoPolygon pa = mpoly.polygons[i];
+        GeoPolygon pb = expected.polygons[i];
+        check_same_loop_rotated(pa.geoloop, pb.geoloop);
+        t_assert(pa.numHoles == pb.numHoles, "Same number of holes");
+        for (int j = 0; j < pa.numHoles; j++) {
+            check_same_loop_rotated(pa.holes[j], pb.holes[j]);
+        }
+    }
+
+    H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+    H3_EXPORT(destroyGeoMultiPolygon)(&expected);
+    free(uncompacted);
+}
+
+// Check that `simple` keeps a subsequence of the vertexes of `loop`,
+// starting from the same vertex
+static void check_simplified_loop(GeoLoop loop, GeoLoop simple) {
+    t_assert(simple.numVerts >= 3, "Simplified loop has at least 3 verts");
+    t_assert(simple.numVerts <= loop.numVerts, "Simplified loop is no larger");
+    int j = 0;
+    for (int i = 0; i < loop.numVerts && j < simple.numVerts; i++) {
+        if (loop.verts[i].lat == simple.verts[j].lat &&
+            loop.verts[i].lng == simple.verts[j].lng) {
+            j++;
+        }
+    }
+    t_assert(j == simple.numVerts, "Simplified verts are original verts");
+}
+
 static void check_cell(H3Index cell) {
     GeoMultiPolygon mpoly = get_mpoly(&cell, 1);
     t_assert(mpoly.numPolygons == 1, "Exactly one polygon.");
@@ -493,6 +611,58 @@ SUITE(edgeCellToPoly) {
         t_assert(err == E_CELL_INVALID, "Can't have invalid cells.");
     }
 
+    TEST(sorted_invalid_input) {
+        GeoMultiPolygon mpoly;
+        t_assert(H3_EXPORT(cellsToMultiPolygonSorted)(NULL, -1, &mpoly) ==
+                     E_DOMAIN,
+                 "Can't pass in negative number of cells.");
+
+        H3Index cells[] = {
+            0x8027fffffffffff,
+            0x81efbffffffffff,
+        };
+        t_assert(H3_EXPORT(cellsToMultiPolygonSorted)(
+                     cells, ARRAY_SIZE(cells), &mpoly) == E_RES_MISMATCH,
+                 "Can't have multiple cell resolutions.");
+    }
+
+    TEST(parallel_invalid_input) {
+        GeoMultiPolygon mpoly;
+        H3Index cells[] = {
+            0x8027fffffffffff,
+            0x81efbffffffffff,
+        };
+        t_assert(H3_EXPORT(cellsToMultiPolygonParallel)(cells, 1, 0, &mpoly) ==
+                     E_DOMAIN,
+                 "Need at least one thread.");
+        t_assert(H3_EXPORT(cellsToMultiPolygonParallel)(NULL, -1, 1, &mpoly) ==
+                     E_DOMAIN,
+                 "Can't pass in negative number of cells.");
+        t_assert(H3_EXPORT(cellsToMultiPolygonParallel)(
+                     cells, ARRAY_SIZE(cells), 2, &mpoly) == E_RES_MISMATCH,
+                 "Can't have multiple cell resolutions.");
+
+        H3Index invalid[] = {0x8027fffffffffff, 0x8027fffffffffff + 1};
+        t_assert(H3_EXPORT(cellsToMultiPolygonParallel)(
+                     invalid, ARRAY_SIZE(invalid), 2, &mpoly) ==
+                     E_CELL_INVALID,
+                 "Can't have invalid cells.");
+
+        // Duplicates are found while pairing edges, both for an isolated
+        // cell and for cells with neighbors in the set
+        H3Index isolated[] = {0x81efbffffffffff, 0x81efbffffffffff};
+        t_assert(H3_EXPORT(cellsToMultiPolygonParallel)(
+                     isolated, ARRAY_SIZE(isolated), 2, &mpoly) ==
+                     E_DUPLICATE_INPUT,
+                 "Can't have duplicated cells.");
+        H3Index neighbors[] = {0x8928308280fffff, 0x8928308280bffff,
+                               0x8928308280fffff};
+        t_assert(H3_EXPORT(cellsToMultiPolygonParallel)(
+                     neighbors, ARRAY_SIZE(neighbors), 1, &mpoly) ==
+                     E_DUPLICATE_INPUT,
+                 "Can't have duplicated neighboring cells.");
+    }
+
     TEST(overflow_check) {
         // Test an absurdly large numCells returns
         // Use 1000x the number of cells at resolution 15
@@ -506,5 +676,293 @@ SUITE(edgeCellToPoly) {
             H3_EXPORT(cellsToMultiPolygon)(NULL, absurdNumCells, &mpoly);
         t_assert(err == E_MEMORY_BOUNDS,
                  "Should return E_MEMORY_BOUNDS for absurdly large numCells");
+
+        err = H3_EXPORT(cellsToMultiPolygonSorted)(NULL, absurdNumCells,
+                                                   &mpoly);
+        t_assert(err == E_MEMORY_BOUNDS,
+                 "Sorted pairing also returns E_MEMORY_BOUNDS");
+
+        err = H3_EXPORT(cellsToMultiPolygonParallel)(NULL, absurdNumCells, 1,
+                                                     &mpoly);
+        t_assert(err == E_MEMORY_BOUNDS,
+                 "Parallel version also returns E_MEMORY_BOUNDS");
+    }
+
+    TEST(compact_disk) {
+        H3Index origin = 0x85283473fffffff;
+        int k = 6;
+        int64_t max_size;
+        t_assertSuccess(H3_EXPORT(maxGridDiskSize)(k, &max_size));
+        H3Index *disk = calloc(max_size, sizeof(H3Index));
+        t_assertSuccess(H3_EXPORT(gridDisk)(origin, k, disk));
+
+        // Drop one cell to make a hole
+        disk[1] = H3_NULL;
+        H3Index *cells = calloc(max_size, sizeof(H3Index));
+        int64_t num_cells = 0;
+        for (int64_t i = 0; i < max_size; i++) {
+            if (disk[i]) {
+                cells[num_cells++] = disk[i];
+            }
+        }
+
+        H3Index *compacted = calloc(num_cells, sizeof(H3Index));
+        t_assertSuccess(H3_EXPORT(compactCells)(cells, compacted, num_cells));
+        int64_t num_compacted = 0;
+        for (int64_t i = 0; i < num_cells; i++) {
+            if (compacted[i]) {
+                compacted[num_compacted++] = compacted[i];
+            }
+        }
+        t_assert(num_compacted < num_cells, "Disk compacts");
+
+        check_compact_mpoly(compacted, num_compacted);
+
+        free(compacted);
+        free(cells);
+        free(disk);
+    }
+
+    TEST(compact_pentagon) {
+        // Children of a pentagon, with a hole at the center, compact to a
+        // mix of the pentagon's res 2 and res 3 descendants
+        H3Index pentagons[12];
+        t_assertSuccess(H3_EXPORT(getPentagons)(1, pentagons));
+        H3Index center;
+        t_assertSuccess(H3_EXPORT(cellToCenterChild)(pentagons[3], 3, &center));
+
+        H3Index cells[64];
+        int64_t num_cells = 0;
+        H3Index children[7];
+        t_assertSuccess(H3_EXPORT(cellToChildren)(pentagons[3], 2, children));
+        for (int i = 0; i < 6; i++) {
+            if (H3_EXPORT(isPentagon)(children[i])) {
+                H3Index grandchildren[7];
+                t_assertSuccess(
+                    H3_EXPORT(cellToChildren)(children[i], 3, grandchildren));
+                for (int j = 0; j < 6; j++) {
+                    if (grandchildren[j] != center) {
+                        cells[num_cells++] = grandchildren[j];
+                    }
+                }
+            } else {
+                cells[num_cells++] = children[i];
+            }
+        }
+
+        check_compact_mpoly(cells, num_cells);
+    }
+
+    TEST(compact_mixed_res0) {
+        // Replace one res 0 cell of a multipolygon with its children
+        H3Index cells[] = {
+            0x8027fffffffffff, 0x802bfffffffffff, 0x804dfffffffffff,
+            0x8067fffffffffff, 0x806dfffffffffff, 0x8049fffffffffff,
+            0x805ffffffffffff, 0x8057fffffffffff, 0x807dfffffffffff,
+            0x80a5fffffffffff, 0x80a9fffffffffff, 0x808bfffffffffff,
+            0x801bfffffffffff, 0x8035fffffffffff, 0x803ffffffffffff,
+            0x8053fffffffffff, 0x8043fffffffffff, 0x8021fffffffffff,
+            0x8011fffffffffff, 0x801ffffffffffff, 0x8097fffffffffff,
+            0,                 0,                 0,
+            0,                 0,                 0,
+        };
+        int64_t num_cells = 21;
+        H3Index children[7];
+        t_assertSuccess(H3_EXPORT(cellToChildren)(cells[0], 1, children));
+        for (int i = 0; i < 7; i++) {
+            cells[i == 0 ? 0 : num_cells++] = children[i];
+        }
+
+        check_compact_mpoly(cells, num_cells);
+        check_compact_mpoly(&cells[1], 20);
+    }
+
+    TEST(compact_all_cells) {
+        H3Index cells[122];
+        H3_EXPORT(getRes0Cells)(cells);
+
+        GeoMultiPolygon mpoly;
+        t_assertSuccess(
+            H3_EXPORT(compactCellsToMultiPolygon)(cells, 122, &mpoly));
+        check_global_poly(mpoly);
+        H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+    }
+
+    TEST(compact_invalid_input) {
+        GeoMultiPolygon mpoly;
+        t_assert(H3_EXPORT(compactCellsToMultiPolygon)(NULL, -1, &mpoly) ==
+                     E_DOMAIN,
+                 "Can't pass in negative number of cells.");
+
+        t_assertSuccess(
+            H3_EXPORT(compactCellsToMultiPolygon)(NULL, 0, &mpoly));
+        t_assert(mpoly.numPolygons == 0, "expecting 0 polygons");
+
+        H3Index invalid[] = {0x8027fffffffffff, 0x81efbffffffffff + 1};
+        t_assert(H3_EXPORT(compactCellsToMultiPolygon)(
+                     invalid, ARRAY_SIZE(invalid), &mpoly) == E_CELL_INVALID,
+                 "Can't have invalid cells.");
+
+        H3Index duplicates[] = {0x8027fffffffffff, 0x81efbffffffffff,
+                                0x8027fffffffffff};
+        t_assert(H3_EXPORT(compactCellsToMultiPolygon)(
+                     duplicates, ARRAY_SIZE(duplicates), &mpoly) ==
+                     E_DUPLICATE_INPUT,
+                 "Can't have duplicated cells.");
+
+        H3Index overlapping[] = {0x8027fffffffffff, 0x81efbffffffffff,
+                                 0x8928308280fffff, 0};
+        t_assertSuccess(H3_EXPORT(cellToParent)(overlapping[2], 5,
+                                                &overlapping[3]));
+        t_assert(H3_EXPORT(compactCellsToMultiPolygon)(
+                     overlapping, ARRAY_SIZE(overlapping), &mpoly) ==
+                     E_DUPLICATE_INPUT,
+                 "Can't have a cell and its descendant.");
+    }
+
+    TEST(simplified_zero_tolerance) {
+        H3Index origin = 0x89283082837ffff;
+        H3Index cells[91];
+        t_assertSuccess(H3_EXPORT(gridDisk)(origin, 5, cells));
+
+        GeoMultiPolygon mpoly = get_mpoly(cells, ARRAY_SIZE(cells));
+        GeoMultiPolygon simple;
+        t_assertSuccess(H3_EXPORT(cellsToMultiPolygonSimplified)(
+            cells, ARRAY_SIZE(cells), 0, &simple));
+        check_same_mpoly(mpoly, simple);
+
+        H3_EXPORT(destroyGeoMultiPolygon)(&simple);
+        H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+    }
+
+    TEST(simplified_disk) {
+        // A disk with a hole, from cells along the boundary of a 20-disk
+        H3Index origin = 0x89283082837ffff;
+        int64_t max_size;
+        t_assertSuccess(H3_EXPORT(maxGridDiskSize)(20, &max_size));
+        H3Index *cells = calloc(max_size, sizeof(H3Index));
+        int *distances = calloc(max_size, sizeof(int));
+        t_assertSuccess(H3_EXPORT(gridDiskDistances)(origin, 20, cells,
+                                                     distances));
+        int64_t num_cells = 0;
+        for (int64_t i = 0; i < max_size; i++) {
+            if (cells[i] && distances[i] >= 15) {
+                cells[num_cells++] = cells[i];
+            }
+        }
+
+        GeoMultiPolygon mpoly = get_mpoly(cells, num_cells);
+        double tolerance = H3_EXPORT(degsToRads)(0.005);
+        GeoMultiPolygon simple;
+        t_assertSuccess(H3_EXPORT(cellsToMultiPolygonSimplified)(
+            cells, num_cells, tolerance, &simple));
+
+        t_assert(simple.numPolygons == 1, "Same number of polygons");
+        t_assert(simple.polygons[0].numHoles == 1, "Same number of holes");
+        check_simplified_loop(mpoly.polygons[0].geoloop,
+                              simple.polygons[0].geoloop);
+        check_simplified_loop(mpoly.polygons[0].holes[0],
+                              simple.polygons[0].holes[0]);
+        t_assert(simple.polygons[0].geoloop.numVerts * 4 <
+                     mpoly.polygons[0].geoloop.numVerts,
+                 "Outer loop is much smaller");
+
+        double area, simpleArea;
+        t_assertSuccess(geoMultiPolygonAreaRads2(mpoly, &area));
+        t_assertSuccess(geoMultiPolygonAreaRads2(simple, &simpleArea));
+        t_assert(relative_diff(area, simpleArea) < 0.05,
+                 "Simplified area is close");
+
+        H3_EXPORT(destroyGeoMultiPolygon)(&simple);
+        H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+        free(distances);
+        free(cells);
+    }
+
+    TEST(simplified_large_tolerance) {
+        H3Index cell = 0x8928308280fffff;
+        GeoMultiPolygon simple;
+        t_assertSuccess(
+            H3_EXPORT(cellsToMultiPolygonSimplified)(&cell, 1, 1.0, &simple));
+        t_assert(simple.numPolygons == 1, "One polygon");
+        t_assert(simple.polygons[0].geoloop.numVerts == 3,
+                 "Loops keep 3 vertexes");
+        H3_EXPORT(destroyGeoMultiPolygon)(&simple);
+    }
+
+    TEST(arena_caller_buffer) {
+        H3Index origin = 0x89283082837ffff;
+        int64_t max_size;
+        t_assertSuccess(H3_EXPORT(maxGridDiskSize)(10, &max_size));
+        H3Index *cells = calloc(max_size, sizeof(H3Index));
+        t_assertSuccess(H3_EXPORT(gridDisk)(origin, 10, cells));
+        GeoMultiPolygon mpoly;
+        t_assertSuccess(
+            H3_EXPORT(cellsToMultiPolygon)(cells, max_size, &mpoly));
+
+        // Large enough for the output, so no blocks are allocated
+        static uint8_t buffer[16384];
+        Arena arena;
+        H3_EXPORT(initArena)(&arena, buffer, sizeof(buffer));
+        GeoMultiPolygon other;
+        t_assertSuccess(H3_EXPORT(cellsToMultiPolygonArena)(cells, max_size,
+                                                            &arena, &other));
+        check_same_mpoly(mpoly, other);
+        t_assert(arena.blocks == NULL, "Output fits in the caller buffer");
+        t_assert((uint8_t *)other.polygons >= buffer &&
+                     (uint8_t *)other.polygons < buffer + sizeof(buffer),
+                 "Output is in the caller buffer");
+        t_assert((uintptr_t)other.polygons % ARENA_ALIGNMENT == 0,
+                 "Output is aligned");
+        H3_EXPORT(destroyArena)(&arena);
+
+        // Too small, so the output spills into allocated blocks
+        H3_EXPORT(initArena)(&arena, buffer, 100);
+        for (int i = 0; i < 3; i++) {
+            t_assertSuccess(H3_EXPORT(cellsToMultiPolygonArena)(
+                cells, max_size, &arena, &other));
+            check_same_mpoly(mpoly, other);
+            t_assert(arena.blocks != NULL, "Blocks were allocated");
+            H3_EXPORT(resetArena)(&arena);
+            t_assert(arena.blocks->next == NULL,
+                     "Reset keeps only the newest block");
+        }
+        H3_EXPORT(destroyArena)(&arena);
+        t_assert(arena.blocks == NULL && arena.base == buffer &&
+                     arena.used == 0,
+                 "Destroy returns to the caller buffer");
+
+        H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+        free(cells);
+    }
+
+    TEST(arena_invalid_input) {
+        H3Index cells[] = {0x8928308280fffff, 0x8928308280fffff};
+        Arena arena;
+        H3_EXPORT(initArena)(&arena, NULL, 0);
+        GeoMultiPolygon mpoly;
+        t_assertSuccess(
+            H3_EXPORT(cellsToMultiPolygonArena)(cells, 1, &arena, &mpoly));
+        size_t used = arena.used;
+        t_assert(H3_EXPORT(cellsToMultiPolygonArena)(cells, 2, &arena,
+                                                     &mpoly) ==
+                     E_DUPLICATE_INPUT,
+                 "Duplicate cells are rejected");
+        t_assert(arena.used == used, "Arena is unchanged after an error");
+        H3_EXPORT(destroyArena)(&arena);
+    }
+
+    TEST(simplified_invalid_tolerance) {
+        H3Index cell = 0x8928308280fffff;
+        GeoMultiPolygon simple;
+        t_assert(H3_EXPORT(cellsToMultiPolygonSimplified)(&cell, 1, -1.0,
+                                                          &simple) == E_DOMAIN,
+                 "Negative tolerance is rejected");
+        t_assert(H3_EXPORT(cellsToMultiPolygonSimplified)(&cell, 1, NAN,
+                                                          &simple) == E_DOMAIN,
+                 "NaN tolerance is rejected");
+        t_assert(H3_EXPORT(cellsToMultiPolygonSimplified)(
+                     &cell, 1, INFINITY, &simple) == E_DOMAIN,
+                 "Infinite tolerance is rejected");
     }
 }
@@ -19,6 +19,7 @@
  * usage: `testDirectedEdge`
  */
 
+#include "directedEdge.h"
 #include "h3Index.h"
 #include "h3api.h"
 #include "test.h"
@@ -117,6 +118,39 @@ SUITE(directedEdge) {
         // rejected as the same cell.
     }
 
+    TEST(areNeighborCellPairs) {
+        H3Index sfHex = 0x89283082877ffff;
+        H3Index ring[7] = {0};
+        t_assertSuccess(H3_EXPORT(gridDisk)(sfHex, 1, ring));
+        H3Index farAway;
+        setH3Index(&farAway, 9, 100, CENTER_DIGIT);
+        H3Index finer = 0x8a283082877ffff;
+        H3Index origins[] = {sfHex, sfHex, sfHex, sfHex, ring[1], ring[2]};
+        H3Index destinations[] = {sfHex, ring[1], farAway, finer, ring[2],
+                                  ring[1]};
+        uint64_t neighbors;
+        uint64_t errors;
+        t_assert(H3_EXPORT(areNeighborCellPairs)(origins, destinations, 6,
+                                                 &neighbors, &errors) ==
+                     E_RES_MISMATCH,
+                 "resolution mismatch is returned");
+        t_assert(errors == 0x8, "mismatched pair is marked");
+        for (int i = 0; i < 6; i++) {
+            int isNeighbor = 0;
+            H3_EXPORT(areNeighborCells)
+            (origins[i], destinations[i], &isNeighbor);
+            t_assert(((neighbors >> i) & 1) == (uint64_t)isNeighbor,
+                     "batch matches areNeighborCells");
+        }
+        t_assert(neighbors == 0x32, "expected neighbors");
+
+        t_assert(H3_EXPORT(areNeighborCellPairs)(origins, destinations, -1,
+                                                 &neighbors, NULL) == E_DOMAIN,
+                 "negative count");
+        t_assertSuccess(H3_EXPORT(areNeighborCellPairs)(origins, destinations,
+                                                        0, &neighbors, NULL));
+    }
+
     TEST(cellsToDirectedEdgeAndFriends) {
         H3Index sf;
         t_assertSuccess(H3_EXPORT(latLngToCell)(&sfGeo, 9, &sf));
@@ -434,6 +468,48 @@ SUITE(directedEdge) {
         }
     }
 
+    TEST(originsToDirectedEdgesWithBoundaries) {
+        // A hexagon, a Class III pentagon, and an invalid cell
+        H3Index origins[] = {0x89283082803ffff, 0x81083ffffffffff,
+                             0x7fffffffffffffff};
+        H3Index edges[18];
+        CellBoundary boundaries[18];
+        uint64_t errors;
+        t_assert(H3_EXPORT(originsToDirectedEdgesWithBoundaries)(
+                     origins, 3, edges, boundaries, &errors) == E_CELL_INVALID,
+                 "invalid origin fails");
+        t_assert(errors == 0x4, "invalid origin is marked");
+        for (int o = 0; o < 2; o++) {
+            for (int i = 0; i < 6; i++) {
+                H3Index edge = edges[6 * o + i];
+                if (o == 1 && i == 0) {
+                    t_assert(edge == H3_NULL, "pentagon has no K edge");
+                    t_assert(boundaries[6 * o + i].numVerts == 0,
+                             "no boundary for no edge");
+                    continue;
+                }
+                CellBoundary expected;
+                t_assertSuccess(
+                    H3_EXPORT(directedEdgeToBoundary)(edge, &expected));
+                t_assert(boundaries[6 * o + i].numVerts == expected.numVerts,
+                         "same numVerts as directedEdgeToBoundary");
+            }
+        }
+        for (int i = 12; i < 18; i++) {
+            t_assert(edges[i] == H3_NULL && boundaries[i].numVerts == 0,
+                     "no edges for invalid origin");
+        }
+
+        t_assert(H3_EXPORT(originToDirectedEdgesWithBoundaries)(
+                     origins[2], edges, boundaries) == E_CELL_INVALID,
+                 "invalid origin fails");
+        t_assert(H3_EXPORT(originsToDirectedEdgesWithBoundaries)(
+                     origins, -1, edges, boundaries, NULL) == E_DOMAIN,
+                 "negative count fails");
+        t_assertSuccess(H3_EXPORT(originsToDirectedEdgesWithBoundaries)(
+            origins, 2, edges, boundaries, NULL));
+    }
+
     TEST(directedEdgeToBoundary_invalid) {
         H3Index sf;
         t_assertSuccess(H3_EXPORT(latLngToCell)(&sfGeo, 9, &sf));
@@ -26,6 +26,7 @@
 
 #include "baseCells.h"
 #include "constants.h"
+#include "directedEdge.h"
 #include "h3Index.h"
 #include "latLng.h"
 #include "test.h"
@@ -60,15 +61,31 @@ static void directedEdge_correctness_assertions(H3Index h3) {
 static void directedEdge_boundary_assertions(H3Index h3) {
     H3Index edges[6] = {H3_NULL};
     t_assertSuccess(H3_EXPORT(originToDirectedEdges)(h3, edges));
+    H3Index edgesWithBoundaries[6];
+    CellBoundary boundaries[6];
+    t_assertSuccess(H3_EXPORT(originToDirectedEdgesWithBoundaries)(
+        h3, edgesWithBoundaries, boundaries));
     H3Index destination;
     H3Index revEdge;
     CellBoundary edgeBoundary;
     CellBoundary revEdgeBoundary;
 
     for (int i = 0; i < 6; i++) {
-        if (edges[i] == H3_NULL) continue;
+        t_assert(edgesWithBoundaries[i] == edges[i], "same edges");
+        if (edges[i] == H3_NULL) {
+            t_assert(boundaries[i].numVerts == 0, "no boundary for no edge");
+            continue;
+        }
         t_assertSuccess(
             H3_EXPORT(directedEdgeToBoundary)(edges[i], &edgeBoundary));
+        t_assert(boundaries[i].numVerts == edgeBoundary.numVerts,
+                 "same numVerts as directedEdgeToBoundary");
+        for (int j = 0; j < edgeBoundary.numVerts; j++) {
+            t_assert(boundaries[i].verts[j].lat == edgeBoundary.verts[j].lat &&
+                         boundaries[i].verts[j].lng ==
+                             edgeBoundary.verts[j].lng,
+                     "same vertexes as directedEdgeToBoundary");
+        }
         t_assertSuccess(
             H3_EXPORT(getDirectedEdgeDestination)(edges[i], &destination));
         t_assertSuccess(
@@ -89,6 +106,41 @@ static void directedEdge_boundary_assertions(H3Index h3) {
     }
 }
 
+/**
+ * Checks areNeighborCells and areNeighborCellPairs against the distances
+ * from gridDiskDistances.
+ */
+static void areNeighborCells_assertions(H3Index h3) {
+    H3Index disk[19] = {H3_NULL};
+    int distances[19] = {0};
+    t_assertSuccess(H3_EXPORT(gridDiskDistances)(h3, 2, disk, distances));
+
+    H3Index origins[19];
+    H3Index destinations[19];
+    int numPairs = 0;
+    for (int i = 0; i < 19; i++) {
+        if (disk[i] == H3_NULL) continue;
+        int isNeighbor;
+        t_assertSuccess(H3_EXPORT(areNeighborCells)(h3, disk[i], &isNeighbor));
+        t_assert(isNeighbor == (distances[i] == 1),
+                 "neighbors are at distance 1");
+        origins[numPairs] = h3;
+        destinations[numPairs] = disk[i];
+        distances[numPairs] = distances[i];
+        numPairs++;
+    }
+
+    uint64_t neighbors;
+    uint64_t errors;
+    t_assertSuccess(H3_EXPORT(areNeighborCellPairs)(
+        origins, destinations, numPairs, &neighbors, &errors));
+    t_assert(errors == 0, "no errors");
+    for (int i = 0; i < numPairs; i++) {
+        t_assert(((neighbors >> i) & 1) == (distances[i] == 1),
+                 "batch neighbors are at distance 1");
+    }
+}
+
 SUITE(directedEdge) {
     TEST(directedEdge_correctness) {
         iterateAllIndexesAtRes(0, directedEdge_correctness_assertions);
@@ -98,6 +150,15 @@ SUITE(directedEdge) {
         iterateAllIndexesAtRes(4, directedEdge_correctness_assertions);
     }
 
+    TEST(areNeighborCells_correctness) {
+        iterateAllIndexesAtRes(0, areNeighborCells_assertions);
+        iterateAllIndexesAtRes(1, areNeighborCells_assertions);
+        iterateAllIndexesAtRes(2, areNeighborCells_assertions);
+        iterateAllIndexesAtRes(3, areNeighborCells_assertions);
+        // Res 5: pentagon base cell
+        iterateBaseCellIndexesAtRes(5, areNeighborCells_assertions, 14);
+    }
+
     TEST(directedEdge_boundary) {
         iterateAllIndexesAtRes(0, directedEdge_boundary_assertions);
         iterateAllIndexesAtRes(1, directedEdge_boundary_assertions);
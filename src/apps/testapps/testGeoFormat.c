@@ -0,0 +1,315 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <locale.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cellsToMultiPoly.h"
+#include "geoFormat.h"
+#include "h3api.h"
+#include "test.h"
+#include "utility.h"
+
+// Little-endian WKB Polygon: a triangle with a closing vertex
+static const uint8_t triangleWkb[] = {
+    0x01, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x00, 0x00,
+    // (0, 0)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // (10, 0)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x40, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // (0, 10)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x24, 0x40,
+    // (0, 0)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00};
+
+// The same triangle as big-endian EWKB with SRID 4326
+static const uint8_t triangleEwkbBigEndian[] = {
+    0x00, 0x20, 0x00, 0x00, 0x03, 0x00, 0x00, 0x10, 0xe6, 0x00, 0x00,
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x04,
+    // (0, 0)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // (10, 0)
+    0x40, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // (0, 10)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x24, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    // (0, 0)
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00};
+
+static void check_triangle(const GeoMultiPolygon *mpoly) {
+    t_assert(mpoly->numPolygons == 1, "One polygon");
+    t_assert(mpoly->polygons[0].numHoles == 0, "No holes");
+    const GeoLoop *loop = &mpoly->polygons[0].geoloop;
+    t_assert(loop->numVerts == 3, "Closing vertex dropped");
+    t_assert(loop->verts[0].lat == 0 && loop->verts[0].lng == 0,
+             "First vertex");
+    t_assert(loop->verts[1].lat == 0 &&
+                 loop->verts[1].lng == H3_EXPORT(degsToRads)(10),
+             "Second vertex is (lng, lat)");
+    t_assert(loop->verts[2].lat == H3_EXPORT(degsToRads)(10) &&
+                 loop->verts[2].lng == 0,
+             "Third vertex is (lng, lat)");
+}
+
+static void check_close_loop(const GeoLoop *a, const GeoLoop *b) {
+    t_assert(a->numVerts == b->numVerts, "Same number of verts");
+    for (int i = 0; i < a->numVerts; i++) {
+        t_assert(fabs(a->verts[i].lat - b->verts[i].lat) < 1e-12 &&
+                     fabs(a->verts[i].lng - b->verts[i].lng) < 1e-12,
+                 "Same verts");
+    }
+}
+
+SUITE(geoFormat) {
+    TEST(wkbToGeoMultiPolygon_triangle) {
+        GeoMultiPolygon mpoly;
+        t_assertSuccess(H3_EXPORT(wkbToGeoMultiPolygon)(
+            triangleWkb, sizeof(triangleWkb), &mpoly));
+        check_triangle(&mpoly);
+        H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+
+        t_assertSuccess(H3_EXPORT(wkbToGeoMultiPolygon)(
+            triangleEwkbBigEndian, sizeof(triangleEwkbBigEndian), &mpoly));
+        check_triangle(&mpoly);
+        H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+    }
+
+    TEST(wkbToGeoMultiPolygon_invalid) {
+        GeoMultiPolygon mpoly;
+        // Every truncation of valid input is rejected
+        for (size_t size = 0; size < sizeof(triangleWkb); size++) {
+            t_assert(H3_EXPORT(wkbToGeoMultiPolygon)(triangleWkb, size,
+                                                     &mpoly) == E_DOMAIN,
+                     "Truncated input is rejected");
+        }
+
+        uint8_t wkb[sizeof(triangleWkb) + 1];
+        memcpy(wkb, triangleWkb, sizeof(triangleWkb));
+        t_assert(H3_EXPORT(wkbToGeoMultiPolygon)(wkb, sizeof(wkb), &mpoly) ==
+                     E_DOMAIN,
+                 "Trailing bytes are rejected");
+
+        wkb[0] = 2;
+        t_assert(H3_EXPORT(wkbToGeoMultiPolygon)(wkb, sizeof(triangleWkb),
+                                                 &mpoly) == E_DOMAIN,
+                 "Invalid byte order is rejected");
+
+        memcpy(wkb, triangleWkb, sizeof(triangleWkb));
+        wkb[1] = 1;
+        t_assert(H3_EXPORT(wkbToGeoMultiPolygon)(wkb, sizeof(triangleWkb),
+                                                 &mpoly) == E_DOMAIN,
+                 "Points are rejected");
+
+        // ISO Polygon Z
+        wkb[1] = 0xeb;
+        wkb[2] = 0x03;
+        t_assert(H3_EXPORT(wkbToGeoMultiPolygon)(wkb, sizeof(triangleWkb),
+                                                 &mpoly) == E_DOMAIN,
+                 "Z coordinates are rejected");
+
+        // EWKB Polygon Z
+        memcpy(wkb, triangleWkb, sizeof(triangleWkb));
+        wkb[4] = 0x80;
+        t_assert(H3_EXPORT(wkbToGeoMultiPolygon)(wkb, sizeof(triangleWkb),
+                                                 &mpoly) == E_DOMAIN,
+                 "EWKB Z coordinates are rejected");
+
+        // A polygon with no rings
+        memcpy(wkb, triangleWkb, sizeof(triangleWkb));
+        wkb[5] = 0;
+        t_assert(H3_EXPORT(wkbToGeoMultiPolygon)(wkb, 9, &mpoly) == E_DOMAIN,
+                 "Polygons need an outer ring");
+
+        // A huge ring count fails before allocating
+        memcpy(wkb, triangleWkb, sizeof(triangleWkb));
+        wkb[8] = 0x7f;
+        t_assert(H3_EXPORT(wkbToGeoMultiPolygon)(wkb, sizeof(triangleWkb),
+                                                 &mpoly) == E_DOMAIN,
+                 "Counts are bounded by the input size");
+
+        // NaN longitude
+        memcpy(wkb, triangleWkb, sizeof(triangleWkb));
+        wkb[19] = 0xf8;
+        wkb[20] = 0x7f;
+        t_assert(H3_EXPORT(wkbToGeoMultiPolygon)(wkb, sizeof(triangleWkb),
+                                                 &mpoly) == E_LATLNG_DOMAIN,
+                 "Non-finite coordinates are rejected");
+    }
+
+    TEST(wkbRoundTrip) {
+        // Three polygons with 3, 1 and 0 holes
+        H3Index cells[] = {
+            0x8027fffffffffff, 0x802bfffffffffff, 0x804dfffffffffff,
+            0x8067fffffffffff, 0x806dfffffffffff, 0x8049fffffffffff,
+            0x805ffffffffffff, 0x8057fffffffffff, 0x807dfffffffffff,
+            0x80a5fffffffffff, 0x80a9fffffffffff, 0x808bfffffffffff,
+            0x801bfffffffffff, 0x8035fffffffffff, 0x803ffffffffffff,
+            0x8053fffffffffff, 0x8043fffffffffff, 0x8021fffffffffff,
+            0x8011fffffffffff, 0x801ffffffffffff, 0x8097fffffffffff,
+        };
+        GeoMultiPolygon mpoly;
+        t_assertSuccess(H3_EXPORT(cellsToMultiPolygon)(
+            cells, ARRAY_SIZE(cells), &mpoly));
+
+        // Append after existing content
+        ByteBuffer buffer = {0};
+        t_assertSuccess(H3_EXPORT(geoMultiPolygonToWkb)(&mpoly, &buffer));
+        size_t first = buffer.size;
+        t_assertSuccess(H3_EXPORT(geoMultiPolygonToWkb)(&mpoly, &buffer));
+        t_assert(buffer.size == 2 * first, "Second copy appended");
+        t_assert(memcmp(buffer.data, buffer.data + first, first) == 0,
+                 "Output is deterministic");
+
+        GeoMultiPolygon parsed;
+        t_assertSuccess(H3_EXPORT(wkbToGeoMultiPolygon)(
+            buffer.data + first, first, &parsed));
+        t_assert(parsed.numPolygons == mpoly.numPolygons,
+                 "Same number of polygons");
+        for (int i = 0; i < mpoly.numPolygons; i++) {
+            t_assert(parsed.polygons[i].numHoles == mpoly.polygons[i].numHoles,
+                     "Same number of holes");
+            check_close_loop(&parsed.polygons[i].geoloop,
+                             &mpoly.polygons[i].geoloop);
+            for (int j = 0; j < mpoly.polygons[i].numHoles; j++) {
+                check_close_loop(&parsed.polygons[i].holes[j],
+                                 &mpoly.polygons[i].holes[j]);
+            }
+        }
+
+        H3_EXPORT(destroyGeoMultiPolygon)(&parsed);
+        H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+        H3_EXPORT(destroyByteBuffer)(&buffer);
+        t_assert(buffer.data == NULL && buffer.capacity == 0,
+                 "Buffer is reset");
+    }
+
+    TEST(geoMultiPolygonToGeoJson) {
+        GeoMultiPolygon mpoly;
+        t_assertSuccess(H3_EXPORT(wkbToGeoMultiPolygon)(
+            triangleWkb, sizeof(triangleWkb), &mpoly));
+
+        ByteBuffer buffer = {0};
+        t_assertSuccess(
+            H3_EXPORT(geoMultiPolygonToGeoJson)(&mpoly, 6, &buffer));
+        const char *expected =
+            "{\"type\":\"MultiPolygon\",\"coordinates\":"
+            "[[[[0,0],[10,0],[0,10],[0,0]]]]}";
+        t_assert(buffer.size == strlen(expected) &&
+                     memcmp(buffer.data, expected, buffer.size) == 0,
+                 "Expected GeoJSON");
+
+        t_assert(H3_EXPORT(geoMultiPolygonToGeoJson)(&mpoly, 0, &buffer) ==
+                     E_DOMAIN,
+                 "Too few digits");
+        t_assert(H3_EXPORT(geoMultiPolygonToGeoJson)(
+                     &mpoly, GEOJSON_MAX_DIGITS + 1, &buffer) == E_DOMAIN,
+                 "Too many digits");
+
+        size_t size = buffer.size;
+        mpoly.polygons[0].geoloop.verts[1].lng = NAN;
+        t_assert(H3_EXPORT(geoMultiPolygonToGeoJson)(&mpoly, 6, &buffer) ==
+                     E_LATLNG_DOMAIN,
+                 "Non-finite coordinates are rejected");
+        t_assert(buffer.size == size, "Size is unchanged on error");
+
+        H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+
+        GeoMultiPolygon empty = {0};
+        buffer.size = 0;
+        t_assertSuccess(
+            H3_EXPORT(geoMultiPolygonToGeoJson)(&empty, 6, &buffer));
+        expected = "{\"type\":\"MultiPolygon\",\"coordinates\":[]}";
+        t_assert(buffer.size == strlen(expected) &&
+                     memcmp(buffer.data, expected, buffer.size) == 0,
+                 "Expected empty GeoJSON");
+
+        H3_EXPORT(destroyByteBuffer)(&buffer);
+    }
+
+    TEST(geoMultiPolygonToGeoJson_locale) {
+        // Numbers use "." whatever the locale's decimal separator. The test
+        // only checks this if a locale with a comma separator is installed.
+        const char *locales[] = {"de_DE.UTF-8", "de_DE.utf8", "de_DE",
+                                 "fr_FR.UTF-8", "fr_FR.utf8", "fr_FR"};
+        bool found = false;
+        for (int i = 0; !found && i < 6; i++) {
+            found = setlocale(LC_NUMERIC, locales[i]) != NULL &&
+                    strcmp(localeconv()->decimal_point, ",") == 0;
+        }
+
+        LatLng verts[] = {{H3_EXPORT(degsToRads)(2.5), 0},
+                          {0, H3_EXPORT(degsToRads)(1.5)},
+                          {0, 0}};
+        GeoPolygon polygon = {.geoloop = {.numVerts = 3, .verts = verts}};
+        GeoMultiPolygon mpoly = {.numPolygons = 1, .polygons = &polygon};
+        ByteBuffer buffer = {0};
+        t_assertSuccess(
+            H3_EXPORT(geoMultiPolygonToGeoJson)(&mpoly, 6, &buffer));
+        setlocale(LC_NUMERIC, "C");
+        const char *expected =
+            "{\"type\":\"MultiPolygon\",\"coordinates\":"
+            "[[[[0,2.5],[1.5,0],[0,0],[0,2.5]]]]}";
+        t_assert(buffer.size == strlen(expected) &&
+                     memcmp(buffer.data, expected, buffer.size) == 0,
+                 "Expected GeoJSON with decimal points");
+        H3_EXPORT(destroyByteBuffer)(&buffer);
+    }
+
+    TEST(polygonToCellsWkb) {
+        GeoMultiPolygon mpoly;
+        t_assertSuccess(H3_EXPORT(wkbToGeoMultiPolygon)(
+            triangleWkb, sizeof(triangleWkb), &mpoly));
+
+        int res = 3;
+        int64_t expectedSize;
+        t_assertSuccess(H3_EXPORT(maxPolygonToCellsSizeExperimental)(
+            &mpoly.polygons[0], res, 0, &expectedSize));
+        int64_t size;
+        t_assertSuccess(H3_EXPORT(maxPolygonToCellsSizeWkb)(
+            triangleWkb, sizeof(triangleWkb), res, 0, &size));
+        t_assert(size == expectedSize, "Same size as the parsed polygon");
+
+        H3Index *expected = calloc(size, sizeof(H3Index));
+        H3Index *cells = calloc(size, sizeof(H3Index));
+        t_assertSuccess(H3_EXPORT(polygonToCellsExperimental)(
+            &mpoly.polygons[0], res, 0, size, expected));
+        t_assertSuccess(H3_EXPORT(polygonToCellsWkb)(
+            triangleWkb, sizeof(triangleWkb), res, 0, size, cells));
+        t_assert(memcmp(cells, expected, size * sizeof(H3Index)) == 0,
+                 "Same cells as the parsed polygon");
+
+        t_assert(H3_EXPORT(polygonToCellsWkb)(triangleWkb, 1, res, 0, size,
+                                              cells) == E_DOMAIN,
+                 "Invalid WKB is rejected");
+        t_assert(H3_EXPORT(maxPolygonToCellsSizeWkb)(triangleWkb, 1, res, 0,
+                                                     &size) == E_DOMAIN,
+                 "Invalid WKB is rejected");
+
+        free(cells);
+        free(expected);
+        H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+    }
+}
@@ -187,6 +187,144 @@ SUITE(h3Index) {
         t_assert(h3 == 0xffffffffffffffff, "got expected on large input");
     }
 
+    TEST(stringsToH3) {
+        H3Index out[6];
+        int64_t numOut;
+        uint64_t errorBitmap;
+        const char *csv = "8928308280fffff\n85283473FFFFFFF\r\n";
+        t_assertSuccess(H3_EXPORT(stringsToH3)(csv, strlen(csv), '\n', out, 6,
+                                               &numOut, &errorBitmap));
+        t_assert(numOut == 2, "parsed all strings");
+        t_assert(errorBitmap == 0, "no errors");
+        t_assert(out[0] == 0x8928308280fffff, "parsed lowercase");
+        t_assert(out[1] == 0x85283473fffffff, "parsed uppercase and CRLF");
+        t_assertSuccess(
+            H3_EXPORT(stringsToH3)("", 0, ',', out, 6, &numOut, NULL));
+        t_assert(numOut == 0, "nothing parsed from nothing");
+
+        const char *list = "8928308280fffff,0,cafe,,12g4,85283473fffffff";
+        t_assert(H3_EXPORT(stringsToH3)(list, strlen(list), ',', out, 6,
+                                        &numOut,
+                                        &errorBitmap) == E_INDEX_INVALID,
+                 "first error returned");
+        t_assert(numOut == 6, "parsed past failing strings");
+        t_assert(errorBitmap == 0x1e, "failing strings marked");
+        t_assert(out[0] == 0x8928308280fffff &&
+                     out[5] == 0x85283473fffffff,
+                 "valid strings parsed");
+        for (int i = 1; i < 5; i++) {
+            t_assert(out[i] == H3_NULL, "failing string gives H3_NULL");
+        }
+
+        t_assert(H3_EXPORT(stringsToH3)(csv, strlen(csv), '\n', out, 1,
+                                        &numOut, NULL) == E_MEMORY_BOUNDS,
+                 "output too small");
+        t_assert(numOut == 1, "parsed strings before running out of space");
+
+        const char *invalid[] = {",", "0x1234", " 8928308280fffff",
+                                 "8928308280ffffz", "10000000000000000"};
+        for (size_t i = 0; i < ARRAY_SIZE(invalid); i++) {
+            t_assert(H3_EXPORT(stringsToH3)(invalid[i], strlen(invalid[i]),
+                                            ',', out, 6, &numOut,
+                                            NULL) == E_FAILED,
+                     "invalid string rejected");
+        }
+    }
+
+    TEST(stringsToH3Fixed) {
+        const char *packed = "8928308280fffff85283473fffffff";
+        H3Index out[2];
+        uint64_t errorBitmap;
+        t_assertSuccess(
+            H3_EXPORT(stringsToH3Fixed)(packed, 2, 15, out, &errorBitmap));
+        t_assert(out[0] == 0x8928308280fffff && out[1] == 0x85283473fffffff,
+                 "parsed fixed width strings");
+        t_assert(errorBitmap == 0, "no errors");
+        t_assert(H3_EXPORT(stringsToH3Fixed)("8928308280ffffz", 1, 15, out,
+                                             &errorBitmap) == E_FAILED,
+                 "invalid string rejected");
+        t_assert(out[0] == H3_NULL && errorBitmap == 1,
+                 "invalid string marked");
+        t_assert(H3_EXPORT(stringsToH3Fixed)("0000000000000008928308280fffff",
+                                             2, 15, out,
+                                             &errorBitmap) == E_INDEX_INVALID,
+                 "invalid index rejected");
+        t_assert(out[0] == H3_NULL && out[1] == 0x8928308280fffff &&
+                     errorBitmap == 1,
+                 "only invalid index marked");
+        t_assert(H3_EXPORT(stringsToH3Fixed)(packed, 1, 17, out, NULL) ==
+                     E_DOMAIN,
+                 "invalid width rejected");
+        t_assert(H3_EXPORT(stringsToH3Fixed)(packed, -1, 15, out, NULL) ==
+                     E_DOMAIN,
+                 "invalid count rejected");
+    }
+
+    TEST(h3sToStrings) {
+        H3Index h3s[] = {0x8928308280fffff, 0, 0xffffffffffffffff};
+        char buf[64];
+        size_t written;
+        t_assertSuccess(H3_EXPORT(h3sToStrings)(h3s, 3, '\n', buf,
+                                                sizeof(buf), &written));
+        const char *expected = "8928308280fffff\n0\nffffffffffffffff";
+        t_assert(written == strlen(expected) &&
+                     memcmp(buf, expected, written) == 0,
+                 "formatted as h3ToString");
+
+        // Round trip every res 0 cell
+        H3Index cells[122];
+        H3Index parsed[122];
+        char cellBuf[122 * 17];
+        int64_t numOut;
+        H3_EXPORT(getRes0Cells)(cells);
+        t_assertSuccess(H3_EXPORT(h3sToStrings)(cells, 122, ',', cellBuf,
+                                                sizeof(cellBuf), &written));
+        uint64_t errorBitmap[2];
+        t_assertSuccess(H3_EXPORT(stringsToH3)(cellBuf, written, ',', parsed,
+                                               122, &numOut, errorBitmap));
+        t_assert(numOut == 122 && memcmp(cells, parsed, sizeof(cells)) == 0,
+                 "round trip");
+        t_assert(errorBitmap[0] == 0 && errorBitmap[1] == 0, "no errors");
+        for (int i = 0; i < 122; i++) {
+            char str[17];
+            t_assertSuccess(H3_EXPORT(h3ToString)(cells[i], str, sizeof(str)));
+            t_assert(strncmp(cellBuf + i * 16, str, 15) == 0,
+                     "same string as h3ToString");
+        }
+        cellBuf[100 * 16] = 'z';
+        t_assert(H3_EXPORT(stringsToH3)(cellBuf, written, ',', parsed, 122,
+                                        &numOut, errorBitmap) == E_FAILED,
+                 "invalid string in second word rejected");
+        t_assert(errorBitmap[0] == 0 && errorBitmap[1] == (uint64_t)1 << 36 &&
+                     parsed[100] == H3_NULL,
+                 "invalid string marked in second word");
+
+        t_assert(H3_EXPORT(h3sToStrings)(h3s, 3, ',', buf, 18, &written) ==
+                     E_MEMORY_BOUNDS,
+                 "buffer too small");
+        t_assert(written == 0, "nothing written on error");
+        t_assertSuccess(
+            H3_EXPORT(h3sToStrings)(h3s, 0, ',', buf, 0, &written));
+        t_assert(written == 0, "nothing written for no indexes");
+    }
+
+    TEST(h3sToStringsFixed) {
+        H3Index h3s[] = {0x8928308280fffff, 0xcafe};
+        char buf[32];
+        t_assertSuccess(H3_EXPORT(h3sToStringsFixed)(h3s, 2, 15, buf));
+        t_assert(memcmp(buf, "8928308280fffff00000000000cafe", 30) == 0,
+                 "formatted zero padded");
+        H3Index large = 0xffffffffffffffff;
+        t_assertSuccess(H3_EXPORT(h3sToStringsFixed)(&large, 1, 16, buf));
+        t_assert(memcmp(buf, "ffffffffffffffff", 16) == 0,
+                 "formatted full width");
+        t_assert(H3_EXPORT(h3sToStringsFixed)(h3s, 1, 14, buf) ==
+                     E_MEMORY_BOUNDS,
+                 "index wider than width rejected");
+        t_assert(H3_EXPORT(h3sToStringsFixed)(h3s, 1, 0, buf) == E_DOMAIN,
+                 "invalid width rejected");
+    }
+
     TEST(setH3Index) {
         H3Index h;
         setH3Index(&h, 5, 12, 1);
@@ -247,4 +385,62 @@ SUITE(h3Index) {
         t_assert(!H3_EXPORT(isValidIndex)(corrupted),
                  "isValidIndex returns false for corrupted index");
     }
+
+    TEST(areValidCells) {
+        // Pentagon descendants, with every other one corrupted
+        H3Index pentagon = 0x80c3fffffffffff;
+        int64_t numCells;
+        t_assertSuccess(
+            H3_EXPORT(cellToChildrenSize)(pentagon, 3, &numCells));
+        H3Index *cells = calloc(numCells, sizeof(H3Index));
+        t_assertSuccess(H3_EXPORT(cellToChildren)(pentagon, 3, cells));
+        uint64_t *bitmap = calloc((numCells + 63) / 64, sizeof(uint64_t));
+        int allValid;
+
+        t_assertSuccess(
+            H3_EXPORT(areValidCells)(cells, numCells, bitmap, &allValid));
+        t_assert(allValid, "all children are valid");
+        t_assertSuccess(
+            H3_EXPORT(areValidCells)(cells, numCells, NULL, &allValid));
+        t_assert(allValid, "all children are valid without bitmap");
+
+        for (int64_t i = 1; i < numCells; i += 2) {
+            cells[i] ^= (uint64_t)1 << (i % 64);
+        }
+        cells[0] = H3_NULL;
+        t_assertSuccess(
+            H3_EXPORT(areValidCells)(cells, numCells, bitmap, &allValid));
+        t_assert(!allValid, "corrupted children are not all valid");
+        for (int64_t i = 0; i < numCells; i++) {
+            int bit = (bitmap[i / 64] >> (i % 64)) & 1;
+            t_assert(bit == H3_EXPORT(isValidCell)(cells[i]),
+                     "bitmap matches isValidCell");
+        }
+        t_assertSuccess(
+            H3_EXPORT(areValidCells)(cells, numCells, NULL, &allValid));
+        t_assert(!allValid, "corrupted children are not all valid");
+
+        // Last partial block is checked, and bits past the end are clear
+        t_assertSuccess(
+            H3_EXPORT(areValidCells)(cells + 2, 65, bitmap, &allValid));
+        t_assert(bitmap[1] == (uint64_t)H3_EXPORT(isValidCell)(cells[66]),
+                 "partial block matches isValidCell");
+
+        // Res 15 pentagon with all zero digits, and invalid base cell
+        H3Index res15[2];
+        t_assertSuccess(H3_EXPORT(cellToCenterChild)(pentagon, 15, &res15[0]));
+        res15[1] = res15[0];
+        H3_SET_BASE_CELL(res15[1], NUM_BASE_CELLS);
+        t_assertSuccess(H3_EXPORT(areValidCells)(res15, 2, bitmap, &allValid));
+        t_assert(bitmap[0] == 1, "res 15 pentagon is valid");
+
+        t_assertSuccess(H3_EXPORT(areValidCells)(NULL, 0, NULL, &allValid));
+        t_assert(allValid, "no cells are all valid");
+        t_assert(H3_EXPORT(areValidCells)(cells, -1, bitmap, &allValid) ==
+                     E_DOMAIN,
+                 "negative count is rejected");
+
+        free(bitmap);
+        free(cells);
+    }
 }
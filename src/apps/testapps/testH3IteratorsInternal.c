@@ -20,6 +20,8 @@
  *  usage: `testH3IteratorsInternal`
  */
 
+#include <stdlib.h>
+
 #include "h3api.h"
 #include "iterators.h"
 #include "test.h"
@@ -72,6 +74,78 @@ static void assert_is_null_iterator(IterCellsChildren iter) {
     t_assert(iter._skipDigit == -1, "null iterator skipDigit is -1");
 }
 
+// checks the uncompact iterator against uncompactCells, and resuming from
+// every position
+static void test_uncompact(const H3Index *compacted, int64_t numCompacted,
+                           int res) {
+    int64_t numOut;
+    t_assertSuccess(H3_EXPORT(uncompactCellsSize)(compacted, numCompacted,
+                                                  res, &numOut));
+    H3Index *expected = calloc(numOut, sizeof(H3Index));
+    t_assertSuccess(H3_EXPORT(uncompactCells)(compacted, numCompacted,
+                                              expected, numOut, res));
+
+    IterCellsUncompact iter = iterInitUncompact(compacted, numCompacted, res);
+    for (int64_t i = 0; i < numOut; i++) {
+        t_assert(iter.h == expected[i], "iterator matches uncompactCells");
+
+        UncompactCursor cursor = iterUncompactCursor(&iter);
+        IterCellsUncompact resumed =
+            iterResumeUncompact(compacted, numCompacted, res, cursor);
+        for (int64_t j = i; j < numOut && j < i + 10; j++) {
+            t_assert(resumed.h == expected[j], "resumed iterator matches");
+            iterStepUncompact(&resumed);
+        }
+        iterStepUncompact(&iter);
+    }
+    t_assert(iter.h == H3_NULL, "iterator is exhausted");
+    t_assert(iter.error == E_SUCCESS, "iterator finished without error");
+    iterStepUncompact(&iter);
+    t_assert(iter.h == H3_NULL, "exhausted iterator returns null");
+
+    UncompactCursor end = iterUncompactCursor(&iter);
+    IterCellsUncompact resumed =
+        iterResumeUncompact(compacted, numCompacted, res, end);
+    t_assert(resumed.h == H3_NULL && resumed.error == E_SUCCESS,
+             "resuming at the end is exhausted");
+    free(expected);
+}
+
+/**
+ * Checks that the shards are contiguous, balanced runs of iterInitRes, and
+ * that each shard resumes from every few cells.
+ */
+static void test_shards(int res, int64_t numShards) {
+    IterCellsResolution itR = iterInitRes(res);
+    int64_t total;
+    t_assertSuccess(H3_EXPORT(getNumCells)(res, &total));
+    for (int64_t shard = 0; shard < numShards; shard++) {
+        int64_t count = 0;
+        for (IterCellsShard it = iterInitShard(res, shard, numShards); it.h;
+             iterStepShard(&it)) {
+            t_assert(it.h == itR.h, "shard follows resolution order");
+            if (count % 37 == 0) {
+                IterCellsShard resumed =
+                    iterResumeShard(shard, numShards, it.h);
+                t_assert(resumed.h == it.h &&
+                             resumed._remaining == it._remaining,
+                         "shard resumes at the cursor cell");
+                iterStepShard(&resumed);
+                iterStepRes(&itR);
+                t_assert(resumed.h == (it._remaining > 1 ? itR.h : H3_NULL),
+                         "resumed shard steps in order");
+            } else {
+                iterStepRes(&itR);
+            }
+            count++;
+        }
+        t_assert(count == total / numShards ||
+                     count == total / numShards + 1,
+                 "shards are balanced");
+    }
+    t_assert(itR.h == H3_NULL, "shards cover all cells");
+}
+
 SUITE(h3IteratorsInternal) {
     TEST(iterator_setup_invalid) {
         assert_is_null_iterator(iterInitBaseCellNum(-1, 0));
@@ -137,4 +211,128 @@ SUITE(h3IteratorsInternal) {
             iter.h == expected,
             "iterator returns a valid cell after h is set to a modified value");
     }
+
+    TEST(iterator_uncompact) {
+        // Compacted disks around a hexagon and a pentagon, with a gap
+        H3Index pentagons[NUM_PENTAGONS] = {0};
+        t_assertSuccess(H3_EXPORT(getPentagons)(5, pentagons));
+        H3Index origins[2] = {0x85283473fffffff, pentagons[0]};
+        for (int o = 0; o < 2; o++) {
+            int64_t numCells;
+            t_assertSuccess(H3_EXPORT(maxGridDiskSize)(4, &numCells));
+            H3Index *cells = calloc(numCells, sizeof(H3Index));
+            H3Index *compacted = calloc(numCells, sizeof(H3Index));
+            t_assertSuccess(H3_EXPORT(gridDisk)(origins[o], 4, cells));
+            int64_t numValid = 0;
+            for (int64_t i = 0; i < numCells; i++) {
+                if (cells[i]) cells[numValid++] = cells[i];
+            }
+            t_assertSuccess(
+                H3_EXPORT(compactCells)(cells, compacted, numValid));
+            test_uncompact(compacted, numValid, 7);
+            free(compacted);
+            free(cells);
+        }
+
+        // A pentagon resumed deep within its children
+        t_assertSuccess(H3_EXPORT(getPentagons)(1, pentagons));
+        test_uncompact(pentagons, 1, 4);
+    }
+
+    TEST(iterator_uncompact_errors) {
+        H3Index cells[] = {0x85283473fffffff, H3_NULL, 0x862834707ffffff};
+        IterCellsUncompact iter = iterInitUncompact(cells, 3, 5);
+        t_assert(iter.h == cells[0], "first cell is its own child");
+        iterStepUncompact(&iter);
+        t_assert(iter.h == H3_NULL, "stops at the finer cell");
+        t_assert(iter.error == E_RES_MISMATCH, "finer cell is an error");
+        UncompactCursor cursor = iterUncompactCursor(&iter);
+        IterCellsUncompact resumed = iterResumeUncompact(cells, 3, 5, cursor);
+        t_assert(resumed.error == E_RES_MISMATCH, "resuming fails again");
+
+        t_assert(iterInitUncompact(cells, 3, 16).error == E_DOMAIN,
+                 "invalid resolution");
+        UncompactCursor good = {.index = 0, .h = 0x862834707ffffff};
+        t_assert(iterResumeUncompact(cells, 3, 6, good).h == good.h,
+                 "resumes at the cursor cell");
+        UncompactCursor bad = {.index = 2, .h = 0x862834717ffffff};
+        t_assert(iterResumeUncompact(cells, 3, 6, bad).error == E_DOMAIN,
+                 "cursor cell is not a child at its index");
+        bad.index = 4;
+        t_assert(iterResumeUncompact(cells, 3, 6, bad).error == E_DOMAIN,
+                 "cursor index out of range");
+
+        IterCellsUncompact empty = iterInitUncompact(NULL, 0, 5);
+        t_assert(empty.h == H3_NULL && empty.error == E_SUCCESS,
+                 "empty set is exhausted");
+    }
+
+    TEST(iterator_resume_res) {
+        // Resuming anywhere, including within pentagon base cells, continues
+        // the same sequence
+        for (int res = 0; res <= 2; res++) {
+            IterCellsResolution iter = iterInitRes(res);
+            int64_t i = 0;
+            for (; iter.h; iterStepRes(&iter), i++) {
+                if (i % 5) continue;
+                IterCellsResolution resumed = iterResumeRes(iter.h);
+                IterCellsResolution expected = iter;
+                for (int j = 0; j < 10 && expected.h; j++) {
+                    t_assert(resumed.h == expected.h, "resumed in order");
+                    iterStepRes(&resumed);
+                    iterStepRes(&expected);
+                }
+                t_assert(resumed.h == expected.h, "resumed in order");
+            }
+        }
+        t_assert(iterResumeRes(0x7fffffffffffffff).h == H3_NULL,
+                 "invalid cursor");
+    }
+
+    TEST(iterator_resume_child) {
+        H3Index pentagons[NUM_PENTAGONS] = {0};
+        t_assertSuccess(H3_EXPORT(getPentagons)(2, pentagons));
+        H3Index parents[] = {0x85283473fffffff, pentagons[0]};
+        for (int p = 0; p < 2; p++) {
+            int res = H3_EXPORT(getResolution)(parents[p]) + 3;
+            IterCellsChildren iter = iterInitParent(parents[p], res);
+            for (; iter.h; iterStepChild(&iter)) {
+                IterCellsChildren resumed = iterResumeChild(parents[p], iter.h);
+                IterCellsChildren expected = iter;
+                for (; expected.h; iterStepChild(&expected)) {
+                    t_assert(resumed.h == expected.h, "resumed in order");
+                    iterStepChild(&resumed);
+                }
+                t_assert(resumed.h == H3_NULL, "resumed iterator finishes");
+            }
+        }
+        assert_is_null_iterator(
+            iterResumeChild(0x8528340bfffffff, 0x862834707ffffff));
+        assert_is_null_iterator(
+            iterResumeChild(0x85283473fffffff, 0x84283473fffffff));
+        assert_is_null_iterator(iterResumeChild(H3_NULL, 0x862834707ffffff));
+    }
+
+    TEST(iterator_shards) {
+        test_shards(0, 1);
+        test_shards(0, 7);
+        test_shards(1, 3);
+        test_shards(2, 16);
+        test_shards(0, 200);
+    }
+
+    TEST(iterator_shard_invalid) {
+        t_assert(iterInitShard(16, 0, 1).h == H3_NULL, "invalid resolution");
+        t_assert(iterInitShard(1, 0, 0).h == H3_NULL, "no shards");
+        t_assert(iterInitShard(1, 3, 3).h == H3_NULL, "shard out of range");
+        t_assert(iterInitShard(0, 150, 200).h == H3_NULL, "empty shard");
+        IterCellsShard first = iterInitShard(1, 0, 2);
+        IterCellsShard second = iterInitShard(1, 1, 2);
+        t_assert(iterResumeShard(0, 2, second.h).h == H3_NULL,
+                 "cursor in another shard");
+        t_assert(iterResumeShard(1, 2, first.h).h == H3_NULL,
+                 "cursor in an earlier shard");
+        t_assert(iterResumeShard(0, 2, H3_NULL).h == H3_NULL,
+                 "invalid cursor");
+    }
 }
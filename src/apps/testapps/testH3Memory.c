@@ -23,6 +23,7 @@
 #include <string.h>
 
 #include "cellsToMultiPoly.h"
+#include "geoFormat.h"
 #include "h3Index.h"
 #include "h3api.h"
 #include "latLng.h"
@@ -31,6 +32,7 @@
 #include "polygon.h"
 #include "test.h"
 #include "utility.h"
+#include "workspace.h"
 
 // Whether to fail all allocations
 static bool failAlloc = false;
@@ -86,6 +88,39 @@ void test_prefix_free(void *ptr) {
     free(ptr);
 }
 
+#ifdef H3_THREAD_ALLOCATOR
+// Context of the allocator set with setThreadAllocator
+typedef struct {
+    int allocCalls;
+    int freeCalls;
+    bool fail;
+} CountingContext;
+
+static void *countingMalloc(void *context, size_t size) {
+    CountingContext *counts = context;
+    counts->allocCalls++;
+    return counts->fail ? NULL : malloc(size);
+}
+
+static void *countingCalloc(void *context, size_t num, size_t size) {
+    CountingContext *counts = context;
+    counts->allocCalls++;
+    return counts->fail ? NULL : calloc(num, size);
+}
+
+static void *countingRealloc(void *context, void *ptr, size_t size) {
+    CountingContext *counts = context;
+    counts->allocCalls++;
+    return counts->fail ? NULL : realloc(ptr, size);
+}
+
+static void countingFree(void *context, void *ptr) {
+    CountingContext *counts = context;
+    counts->freeCalls++;
+    free(ptr);
+}
+#endif
+
 H3Index sunnyvale = 0x89283470c27ffff;
 H3Index pentagon = 0x89080000003ffff;
 
@@ -322,6 +357,234 @@ SUITE(h3Memory) {
         }
     }
 
+    TEST(cellsToMultiPolygonSorted) {
+        // Exercise error paths at each allocation point of sorted pairing
+        H3Index cells[] = {
+            0x8027fffffffffff, 0x802bfffffffffff, 0x804dfffffffffff,
+            0x8067fffffffffff, 0x806dfffffffffff, 0x8049fffffffffff,
+        };
+        int numCells = 6;
+        GeoMultiPolygon mpoly;
+        H3Error err;
+
+        int successPoint = 0;
+        for (int permitted = 1; permitted < 50; permitted++) {
+            resetMemoryCounters(permitted);
+            err = H3_EXPORT(cellsToMultiPolygonSorted)(cells, numCells,
+                                                       &mpoly);
+            if (err == E_SUCCESS) {
+                successPoint = permitted;
+                H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+                break;
+            }
+        }
+        t_assert(successPoint > 0, "Should eventually succeed");
+
+        for (int permitted = 1; permitted < successPoint; permitted++) {
+            resetMemoryCounters(permitted);
+            err = H3_EXPORT(cellsToMultiPolygonSorted)(cells, numCells,
+                                                       &mpoly);
+            t_assert(err == E_MEMORY_ALLOC, "Should fail with memory error");
+        }
+    }
+
+    TEST(compactCellsToMultiPolygon) {
+        // Exercise error paths at each allocation point, including the sort
+        // used to check for overlapping cells
+        H3Index cells[] = {
+            0x8027fffffffffff, 0x812bbffffffffff, 0x804dfffffffffff,
+            0x8067fffffffffff, 0x806dfffffffffff, 0x8049fffffffffff,
+        };
+        int numCells = 6;
+        GeoMultiPolygon mpoly;
+        H3Error err;
+
+        int successPoint = 0;
+        for (int permitted = 1; permitted < 50; permitted++) {
+            resetMemoryCounters(permitted);
+            err = H3_EXPORT(compactCellsToMultiPolygon)(cells, numCells,
+                                                        &mpoly);
+            if (err == E_SUCCESS) {
+                successPoint = permitted;
+                H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+                break;
+            }
+        }
+        t_assert(successPoint > 0, "Should eventually succeed");
+
+        for (int permitted = 1; permitted < successPoint; permitted++) {
+            resetMemoryCounters(permitted);
+            err = H3_EXPORT(compactCellsToMultiPolygon)(cells, numCells,
+                                                        &mpoly);
+            t_assert(err == E_MEMORY_ALLOC, "Should fail with memory error");
+        }
+    }
+
+    TEST(cellsToMultiPolygonSimplified) {
+        // Exercise error paths at each allocation point, including the
+        // simplification buffers
+        H3Index cells[] = {
+            0x8027fffffffffff, 0x802bfffffffffff, 0x804dfffffffffff,
+            0x8067fffffffffff, 0x806dfffffffffff, 0x8049fffffffffff,
+        };
+        int numCells = 6;
+        GeoMultiPolygon mpoly;
+        H3Error err;
+
+        int successPoint = 0;
+        for (int permitted = 1; permitted < 50; permitted++) {
+            resetMemoryCounters(permitted);
+            err = H3_EXPORT(cellsToMultiPolygonSimplified)(cells, numCells,
+                                                           0.01, &mpoly);
+            if (err == E_SUCCESS) {
+                successPoint = permitted;
+                H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+                break;
+            }
+        }
+        t_assert(successPoint > 0, "Should eventually succeed");
+
+        for (int permitted = 1; permitted < successPoint; permitted++) {
+            resetMemoryCounters(permitted);
+            err = H3_EXPORT(cellsToMultiPolygonSimplified)(cells, numCells,
+                                                           0.01, &mpoly);
+            t_assert(err == E_MEMORY_ALLOC, "Should fail with memory error");
+        }
+    }
+
+    TEST(cellsToMultiPolygonArena) {
+        H3Index cells[] = {
+            0x8027fffffffffff, 0x802bfffffffffff, 0x804dfffffffffff,
+            0x8067fffffffffff, 0x806dfffffffffff, 0x8049fffffffffff,
+        };
+        int numCells = 6;
+        GeoMultiPolygon mpoly;
+        Arena arena;
+        H3Error err;
+
+        int successPoint = 0;
+        for (int permitted = 1; permitted < 50; permitted++) {
+            resetMemoryCounters(permitted);
+            H3_EXPORT(initArena)(&arena, NULL, 0);
+            err = H3_EXPORT(cellsToMultiPolygonArena)(cells, numCells, &arena,
+                                                      &mpoly);
+            if (err == E_SUCCESS) {
+                successPoint = permitted;
+                H3_EXPORT(destroyArena)(&arena);
+                break;
+            }
+            t_assert(arena.blocks == NULL, "Failed call frees its blocks");
+        }
+        t_assert(successPoint > 0, "Should eventually succeed");
+
+        for (int permitted = 1; permitted < successPoint; permitted++) {
+            resetMemoryCounters(permitted);
+            H3_EXPORT(initArena)(&arena, NULL, 0);
+            err = H3_EXPORT(cellsToMultiPolygonArena)(cells, numCells, &arena,
+                                                      &mpoly);
+            t_assert(err == E_MEMORY_ALLOC, "Should fail with memory error");
+            t_assert(arena.blocks == NULL, "Failed call frees its blocks");
+        }
+    }
+
+    TEST(geoFormat) {
+        H3Index cells[] = {
+            0x8027fffffffffff, 0x802bfffffffffff, 0x804dfffffffffff,
+            0x8067fffffffffff, 0x806dfffffffffff, 0x8049fffffffffff,
+        };
+        GeoMultiPolygon mpoly;
+        resetMemoryCounters(0);
+        t_assertSuccess(H3_EXPORT(cellsToMultiPolygon)(cells, 6, &mpoly));
+
+        // Serializers fail on their first allocation and leave the buffer
+        // size unchanged
+        ByteBuffer buffer = {0};
+        resetMemoryCounters(1);
+        failAlloc = true;
+        t_assert(H3_EXPORT(geoMultiPolygonToWkb)(&mpoly, &buffer) ==
+                     E_MEMORY_ALLOC,
+                 "WKB fails with memory error");
+        t_assert(H3_EXPORT(geoMultiPolygonToGeoJson)(&mpoly, 6, &buffer) ==
+                     E_MEMORY_ALLOC,
+                 "GeoJSON fails with memory error");
+        t_assert(buffer.size == 0, "Nothing written");
+
+        // GeoJSON grows the buffer several times
+        for (int permitted = 1; permitted < 20; permitted++) {
+            resetMemoryCounters(permitted);
+            buffer.size = 0;
+            H3Error err =
+                H3_EXPORT(geoMultiPolygonToGeoJson)(&mpoly, 17, &buffer);
+            t_assert(err == E_SUCCESS || (err == E_MEMORY_ALLOC &&
+                                          buffer.size == 0),
+                     "GeoJSON succeeds or leaves the size unchanged");
+        }
+
+        resetMemoryCounters(0);
+        buffer.size = 0;
+        t_assertSuccess(H3_EXPORT(geoMultiPolygonToWkb)(&mpoly, &buffer));
+
+        GeoMultiPolygon parsed;
+        int successPoint = 0;
+        for (int permitted = 1; permitted < 100; permitted++) {
+            resetMemoryCounters(permitted);
+            H3Error err = H3_EXPORT(wkbToGeoMultiPolygon)(
+                buffer.data, buffer.size, &parsed);
+            if (err == E_SUCCESS) {
+                successPoint = permitted;
+                H3_EXPORT(destroyGeoMultiPolygon)(&parsed);
+                break;
+            }
+            t_assert(err == E_MEMORY_ALLOC, "Should fail with memory error");
+        }
+        t_assert(successPoint > 0, "Should eventually succeed");
+
+        resetMemoryCounters(0);
+        H3_EXPORT(destroyByteBuffer)(&buffer);
+        H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+    }
+
+    TEST(cellsToMultiPolygonParallel) {
+        // Exercise error paths at each allocation point, on one thread so
+        // the allocation sequence is fixed
+        H3Index cells[] = {
+            0x8027fffffffffff, 0x802bfffffffffff, 0x804dfffffffffff,
+            0x8067fffffffffff, 0x806dfffffffffff, 0x8049fffffffffff,
+        };
+        int numCells = 6;
+        GeoMultiPolygon mpoly;
+        H3Error err;
+
+        int successPoint = 0;
+        for (int permitted = 1; permitted < 50; permitted++) {
+            resetMemoryCounters(permitted);
+            err = H3_EXPORT(cellsToMultiPolygonParallel)(cells, numCells, 1,
+                                                         &mpoly);
+            if (err == E_SUCCESS) {
+                successPoint = permitted;
+                H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+                break;
+            }
+        }
+        t_assert(successPoint > 0, "Should eventually succeed");
+
+        for (int permitted = 1; permitted < successPoint; permitted++) {
+            resetMemoryCounters(permitted);
+            err = H3_EXPORT(cellsToMultiPolygonParallel)(cells, numCells, 1,
+                                                         &mpoly);
+            t_assert(err == E_MEMORY_ALLOC, "Should fail with memory error");
+        }
+
+        // The whole globe has no loops
+        H3Index res0Cells[122];
+        H3_EXPORT(getRes0Cells)(res0Cells);
+        resetMemoryCounters(0);
+        t_assertSuccess(H3_EXPORT(cellsToMultiPolygonParallel)(res0Cells, 122,
+                                                               1, &mpoly));
+        t_assert(mpoly.numPolygons == 8, "Globe is 8 polygons");
+        H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+    }
+
     TEST(cellsToMultiPolygonWithHoles) {
         // Exercise error paths with polygons that have holes
         H3Index cells[] = {
@@ -551,4 +814,121 @@ SUITE(h3Memory) {
                      "Should fail with memory error before success");
         }
     }
+
+#ifdef H3_THREAD_ALLOCATOR
+    TEST(threadAllocator) {
+        CountingContext counts = {0};
+        H3Allocator allocator = {.context = &counts,
+                                 .mallocFn = countingMalloc,
+                                 .callocFn = countingCalloc,
+                                 .reallocFn = countingRealloc,
+                                 .freeFn = countingFree};
+        t_assert(H3_EXPORT(getThreadAllocator)() == NULL,
+                 "No allocator is set by default");
+        t_assert(H3_EXPORT(setThreadAllocator)(&allocator) == NULL,
+                 "Previous allocator is the default");
+        t_assert(H3_EXPORT(getThreadAllocator)() == &allocator,
+                 "Allocator is set");
+        resetMemoryCounters(0);
+
+        // compactCells
+        int64_t hexCount;
+        t_assertSuccess(H3_EXPORT(maxGridDiskSize)(9, &hexCount));
+        H3Index *cells = calloc(hexCount, sizeof(H3Index));
+        H3Index *compacted = calloc(hexCount, sizeof(H3Index));
+        t_assertSuccess(H3_EXPORT(gridDisk)(sunnyvale, 9, cells));
+        t_assertSuccess(H3_EXPORT(compactCells)(cells, compacted, hexCount));
+        t_assert(counts.allocCalls == 4, "compactCells used the allocator");
+
+        // gridDiskDistances allocates distances around pentagons when the
+        // caller does not need them, as for gridDisk
+        H3Index *disk = calloc(hexCount, sizeof(H3Index));
+        counts.allocCalls = 0;
+        t_assertSuccess(H3_EXPORT(gridDisk)(pentagon, 2, disk));
+        t_assert(counts.allocCalls == 1,
+                 "gridDiskDistances used the allocator");
+
+        // polygonToCells
+        sfGeoPolygon.geoloop = sfGeoLoop;
+        sfGeoPolygon.numHoles = 0;
+        int64_t numHexagons;
+        t_assertSuccess(H3_EXPORT(maxPolygonToCellsSize)(&sfGeoPolygon, 9, 0,
+                                                         &numHexagons));
+        H3Index *hexagons = calloc(numHexagons, sizeof(H3Index));
+        counts.allocCalls = 0;
+        t_assertSuccess(
+            H3_EXPORT(polygonToCells)(&sfGeoPolygon, 9, 0, hexagons));
+        t_assert(counts.allocCalls == 3, "polygonToCells used the allocator");
+
+        // cellsToMultiPolygon, including the output and destroying it
+        GeoMultiPolygon mpoly;
+        t_assertSuccess(H3_EXPORT(cellsToMultiPolygon)(compacted, 1, &mpoly));
+        H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+
+        t_assert(counts.freeCalls > 0, "Memory was freed by the allocator");
+        t_assert(actualAllocCalls == 0 && actualFreeCalls == 0,
+                 "Default allocator was not used");
+
+        counts.fail = true;
+        t_assert(H3_EXPORT(compactCells)(cells, compacted, hexCount) ==
+                     E_MEMORY_ALLOC,
+                 "Allocator failures are reported");
+        t_assert(H3_EXPORT(cellsToMultiPolygon)(compacted, 1, &mpoly) ==
+                     E_MEMORY_ALLOC,
+                 "Allocator failures are reported");
+
+        t_assert(H3_EXPORT(setThreadAllocator)(NULL) == &allocator,
+                 "Previous allocator is returned");
+        t_assertSuccess(H3_EXPORT(compactCells)(cells, compacted, hexCount));
+        t_assert(actualAllocCalls == 4, "Default allocator is restored");
+
+        free(hexagons);
+        free(disk);
+        free(compacted);
+        free(cells);
+    }
+#endif
+
+    TEST(workspace) {
+        // Each workspace variant makes no allocations
+        int64_t hexCount;
+        t_assertSuccess(H3_EXPORT(maxGridDiskSize)(9, &hexCount));
+        H3Index *cells = calloc(hexCount, sizeof(H3Index));
+        H3Index *compacted = calloc(hexCount, sizeof(H3Index));
+        int64_t workspaceSize;
+        t_assertSuccess(
+            H3_EXPORT(compactCellsWorkspaceSize)(hexCount, &workspaceSize));
+        void *workspace = malloc(workspaceSize);
+
+        resetMemoryCounters(0);
+        failAlloc = true;
+        t_assertSuccess(H3_EXPORT(gridDiskDistancesWithWorkspace)(
+            pentagon, 2, cells, NULL, workspace, workspaceSize));
+        t_assertSuccess(H3_EXPORT(gridDisk)(sunnyvale, 9, cells));
+        t_assertSuccess(H3_EXPORT(compactCellsWithWorkspace)(
+            cells, compacted, hexCount, workspace, workspaceSize));
+        t_assert(actualAllocCalls == 0, "No allocations for compactCells");
+        free(workspace);
+
+        sfGeoPolygon.geoloop = sfGeoLoop;
+        sfGeoPolygon.numHoles = 0;
+        int64_t numHexagons;
+        t_assertSuccess(H3_EXPORT(maxPolygonToCellsSize)(&sfGeoPolygon, 9, 0,
+                                                         &numHexagons));
+        H3Index *hexagons = calloc(numHexagons, sizeof(H3Index));
+        t_assertSuccess(H3_EXPORT(polygonToCellsWorkspaceSize)(
+            &sfGeoPolygon, 9, 0, &workspaceSize));
+        workspace = malloc(workspaceSize);
+        t_assertSuccess(H3_EXPORT(polygonToCellsWithWorkspace)(
+            &sfGeoPolygon, 9, 0, hexagons, workspace, workspaceSize));
+        t_assert(actualAllocCalls == 0 && actualFreeCalls == 0,
+                 "No allocations for polygonToCells");
+        t_assert(countNonNullIndexes(hexagons, numHexagons) == 1253,
+                 "got expected polygonToCells size");
+
+        free(workspace);
+        free(hexagons);
+        free(compacted);
+        free(cells);
+    }
 }
@@ -78,4 +78,35 @@ SUITE(indexDigits) {
             }
         }
     }
+
+    TEST(getIndexDigits) {
+        H3Index cells[MAX_H3_RES + 1];
+        LatLng anywhere = {0, 0};
+        for (int res = 0; res <= MAX_H3_RES; res++) {
+            t_assertSuccess(
+                H3_EXPORT(latLngToCell)(&anywhere, res, &cells[res]));
+        }
+        int out[MAX_H3_RES + 1];
+        t_assertSuccess(
+            H3_EXPORT(getResolutions)(cells, MAX_H3_RES + 1, out));
+        for (int i = 0; i <= MAX_H3_RES; i++) {
+            t_assert(out[i] == i, "resolution should be expected");
+        }
+        for (int resDigit = 1; resDigit <= MAX_H3_RES; resDigit++) {
+            t_assertSuccess(H3_EXPORT(getIndexDigits)(cells, MAX_H3_RES + 1,
+                                                      resDigit, out));
+            for (int i = 0; i <= MAX_H3_RES; i++) {
+                int digit;
+                t_assertSuccess(
+                    H3_EXPORT(getIndexDigit)(cells[i], resDigit, &digit));
+                t_assert(out[i] == digit, "same digit as getIndexDigit");
+            }
+        }
+        t_assert(H3_EXPORT(getIndexDigits)(cells, 1, 0, out) == E_RES_DOMAIN,
+                 "too low resolution");
+        t_assert(H3_EXPORT(getIndexDigits)(cells, 1, 16, out) == E_RES_DOMAIN,
+                 "too high resolution");
+        t_assert(H3_EXPORT(getResolutions)(cells, -1, out) == E_DOMAIN,
+                 "negative count");
+    }
 }
@@ -0,0 +1,246 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+
+#include "h3api.h"
+#include "polyfill.h"
+#include "test.h"
+#include "utility.h"
+
+// Fixtures
+static LatLng sfVerts[] = {
+    {0.659966917655, -2.1364398519396},  {0.6595011102219, -2.1359434279405},
+    {0.6583348114025, -2.1354884206045}, {0.6581220034068, -2.1382437718946},
+    {0.6594479998527, -2.1384597563896}, {0.6599990002976, -2.1376771158464}};
+
+static LatLng holeVerts[] = {{0.6595072188743, -2.1371053983433},
+                             {0.6591482046471, -2.1373141048153},
+                             {0.6592295020837, -2.1365222838402}};
+
+// A triangle overlapping the southern edge of the SF polygon
+static LatLng overlapVerts[] = {{0.6585, -2.1375},
+                                {0.6575, -2.1380},
+                                {0.6575, -2.1360}};
+
+// A square well away from the SF polygon
+static LatLng farVerts[] = {
+    {0.5, 0.5}, {0.5, 0.501}, {0.501, 0.501}, {0.501, 0.5}};
+
+static GeoPolygon makePolygon(LatLng *verts, int numVerts) {
+    GeoPolygon polygon = {.geoloop = {.numVerts = numVerts, .verts = verts},
+                          .numHoles = 0,
+                          .holes = NULL};
+    return polygon;
+}
+
+/**
+ * Fill the multipolygon, checking the output against separately filling
+ * each part: every cell must be found in the lowest-indexed part whose
+ * single-polygon fill contains it, and the total count must match the
+ * deduplicated union.
+ */
+static void assertMatchesPerPartFill(const GeoMultiPolygon *multiPolygon,
+                                     int res, uint32_t flags) {
+    int64_t size;
+    t_assertSuccess(H3_EXPORT(maxMultiPolygonToCellsSizeExperimental)(
+        multiPolygon, res, flags, &size));
+    H3Index *cells = calloc(size, sizeof(H3Index));
+    int *parts = calloc(size, sizeof(int));
+    t_assertSuccess(H3_EXPORT(multiPolygonToCellsExperimental)(
+        multiPolygon, res, flags, size, cells, parts));
+
+    // Per-part fills, for comparison
+    H3Index **partCells = calloc(multiPolygon->numPolygons, sizeof(H3Index *));
+    int64_t *partSizes = calloc(multiPolygon->numPolygons, sizeof(int64_t));
+    for (int p = 0; p < multiPolygon->numPolygons; p++) {
+        t_assertSuccess(H3_EXPORT(maxPolygonToCellsSizeExperimental)(
+            &multiPolygon->polygons[p], res, flags, &partSizes[p]));
+        partCells[p] = calloc(partSizes[p], sizeof(H3Index));
+        t_assertSuccess(H3_EXPORT(polygonToCellsExperimental)(
+            &multiPolygon->polygons[p], res, flags, partSizes[p],
+            partCells[p]));
+    }
+
+    // The single traversal counts a cell once, however many parts it is in
+    int64_t partSizesSum = 0;
+    for (int p = 0; p < multiPolygon->numPolygons; p++) {
+        partSizesSum += partSizes[p];
+    }
+    t_assert(size <= partSizesSum, "size no larger than sum of part sizes");
+
+    int64_t expectedCount = 0;
+    for (int p = 0; p < multiPolygon->numPolygons; p++) {
+        for (int64_t i = 0; i < partSizes[p]; i++) {
+            H3Index cell = partCells[p][i];
+            if (cell == H3_NULL) continue;
+            // Lowest-indexed part wins
+            bool inEarlier = false;
+            for (int q = 0; q < p && !inEarlier; q++) {
+                for (int64_t j = 0; j < partSizes[q]; j++) {
+                    if (partCells[q][j] == cell) {
+                        inEarlier = true;
+                        break;
+                    }
+                }
+            }
+            if (inEarlier) continue;
+            expectedCount++;
+            bool found = false;
+            for (int64_t j = 0; j < size; j++) {
+                if (cells[j] == cell) {
+                    t_assert(parts[j] == p, "cell tagged with lowest part");
+                    found = true;
+                    break;
+                }
+            }
+            t_assert(found, "cell from part fill found in multipolygon fill");
+        }
+    }
+    t_assert(countNonNullIndexes(cells, size) == expectedCount,
+             "got expected deduplicated cell count");
+
+    for (int p = 0; p < multiPolygon->numPolygons; p++) {
+        free(partCells[p]);
+    }
+    free(partCells);
+    free(partSizes);
+    free(cells);
+    free(parts);
+}
+
+SUITE(multiPolygonToCellsExperimental) {
+    GeoPolygon sfPolygon = makePolygon(sfVerts, 6);
+    GeoPolygon sfWithHole = makePolygon(sfVerts, 6);
+    GeoLoop hole = {.numVerts = 3, .verts = holeVerts};
+    sfWithHole.numHoles = 1;
+    sfWithHole.holes = &hole;
+    GeoPolygon overlapPolygon = makePolygon(overlapVerts, 3);
+    GeoPolygon farPolygon = makePolygon(farVerts, 4);
+
+    TEST(singlePartMatchesPolygonFill) {
+        GeoMultiPolygon multi = {.numPolygons = 1, .polygons = &sfPolygon};
+        for (uint32_t mode = 0; mode < CONTAINMENT_INVALID; mode++) {
+            assertMatchesPerPartFill(&multi, 9, mode);
+        }
+    }
+
+    TEST(disjointParts) {
+        GeoPolygon polygons[] = {sfWithHole, farPolygon};
+        GeoMultiPolygon multi = {.numPolygons = 2, .polygons = polygons};
+        for (uint32_t mode = 0; mode < CONTAINMENT_INVALID; mode++) {
+            assertMatchesPerPartFill(&multi, 9, mode);
+        }
+    }
+
+    TEST(overlappingPartsDeduplicated) {
+        GeoPolygon polygons[] = {sfPolygon, overlapPolygon};
+        GeoMultiPolygon multi = {.numPolygons = 2, .polygons = polygons};
+        for (uint32_t mode = 0; mode < CONTAINMENT_INVALID; mode++) {
+            assertMatchesPerPartFill(&multi, 9, mode);
+        }
+        // Reversing the order changes the part assignment, not the cells
+        GeoPolygon reversed[] = {overlapPolygon, sfPolygon};
+        GeoMultiPolygon multiReversed = {.numPolygons = 2,
+                                         .polygons = reversed};
+        assertMatchesPerPartFill(&multiReversed, 9, CONTAINMENT_OVERLAPPING);
+    }
+
+    TEST(nullPartIds) {
+        GeoPolygon polygons[] = {sfPolygon, farPolygon};
+        GeoMultiPolygon multi = {.numPolygons = 2, .polygons = polygons};
+        int64_t size;
+        t_assertSuccess(H3_EXPORT(maxMultiPolygonToCellsSizeExperimental)(
+            &multi, 9, CONTAINMENT_CENTER, &size));
+        H3Index *cells = calloc(size, sizeof(H3Index));
+        t_assertSuccess(H3_EXPORT(multiPolygonToCellsExperimental)(
+            &multi, 9, CONTAINMENT_CENTER, size, cells, NULL));
+        t_assert(countNonNullIndexes(cells, size) > 0, "got cells");
+        free(cells);
+    }
+
+    TEST(emptyAndZeroVertParts) {
+        GeoMultiPolygon empty = {.numPolygons = 0, .polygons = NULL};
+        int64_t size;
+        t_assertSuccess(H3_EXPORT(maxMultiPolygonToCellsSizeExperimental)(
+            &empty, 9, CONTAINMENT_CENTER, &size));
+        t_assert(size == 0, "empty multipolygon has no cells");
+        H3Index cell = H3_NULL;
+        t_assertSuccess(H3_EXPORT(multiPolygonToCellsExperimental)(
+            &empty, 9, CONTAINMENT_CENTER, 0, &cell, NULL));
+
+        GeoPolygon nullPolygon = makePolygon(NULL, 0);
+        GeoPolygon polygons[] = {nullPolygon, sfPolygon};
+        GeoMultiPolygon multi = {.numPolygons = 2, .polygons = polygons};
+        assertMatchesPerPartFill(&multi, 9, CONTAINMENT_CENTER);
+    }
+
+    TEST(invalidArgs) {
+        GeoMultiPolygon multi = {.numPolygons = 1, .polygons = &sfPolygon};
+        int64_t size;
+        H3Index cells[10] = {0};
+        t_assert(H3_EXPORT(maxMultiPolygonToCellsSizeExperimental)(
+                     &multi, -1, CONTAINMENT_CENTER, &size) == E_RES_DOMAIN,
+                 "invalid res rejected by size");
+        t_assert(H3_EXPORT(multiPolygonToCellsExperimental)(
+                     &multi, 16, CONTAINMENT_CENTER, 10, cells, NULL) ==
+                     E_RES_DOMAIN,
+                 "invalid res rejected");
+        t_assert(H3_EXPORT(multiPolygonToCellsExperimental)(
+                     &multi, 9, CONTAINMENT_INVALID, 10, cells, NULL) ==
+                     E_OPTION_INVALID,
+                 "invalid flags rejected");
+
+        GeoMultiPolygon negative = {.numPolygons = -1, .polygons = NULL};
+        t_assert(H3_EXPORT(maxMultiPolygonToCellsSizeExperimental)(
+                     &negative, 9, CONTAINMENT_CENTER, &size) == E_DOMAIN,
+                 "negative part count rejected by size");
+        t_assert(H3_EXPORT(multiPolygonToCellsExperimental)(
+                     &negative, 9, CONTAINMENT_CENTER, 10, cells, NULL) ==
+                     E_DOMAIN,
+                 "negative part count rejected");
+    }
+
+    TEST(outOfMemoryBounds) {
+        GeoMultiPolygon multi = {.numPolygons = 1, .polygons = &sfPolygon};
+        H3Index cells[2] = {0};
+        t_assert(H3_EXPORT(multiPolygonToCellsExperimental)(
+                     &multi, 9, CONTAINMENT_CENTER, 2, cells, NULL) ==
+                     E_MEMORY_BOUNDS,
+                 "too-small buffer rejected");
+    }
+
+    TEST(iteratorPartIndex) {
+        GeoPolygon polygons[] = {farPolygon, sfPolygon};
+        GeoMultiPolygon multi = {.numPolygons = 2, .polygons = polygons};
+        int count = 0;
+        for (IterCellsMultiPolygon iter =
+                 iterInitMultiPolygon(&multi, 9, CONTAINMENT_CENTER);
+             iter.cell; iterStepMultiPolygon(&iter)) {
+            t_assert(iter.part == 0 || iter.part == 1, "part in range");
+            count++;
+        }
+        t_assert(count > 0, "iterated cells");
+
+        IterCellsMultiPolygon iter =
+            iterInitMultiPolygon(&multi, 9, CONTAINMENT_CENTER);
+        iterDestroyMultiPolygon(&iter);
+        t_assert(iter.cell == H3_NULL, "destroyed iterator is exhausted");
+        t_assert(iter.part == -1, "destroyed iterator has no part");
+        iterStepMultiPolygon(&iter);
+        t_assert(iter.cell == H3_NULL, "stepping destroyed iterator is safe");
+    }
+}
@@ -0,0 +1,163 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+
+#include "h3api.h"
+#include "parentGroups.h"
+#include "test.h"
+#include "utility.h"
+
+/**
+ * Checks that the groups cover the cells in order, that each cell has its
+ * group's parent, and that no parent appears in more than one group.
+ */
+static void assertGroups(const H3Index *cells, int64_t numCells,
+                         const ParentGroups *groups) {
+    int64_t cell = 0;
+    for (int64_t g = 0; g < groups->numGroups; g++) {
+        t_assert(groups->counts[g] > 0, "group is not empty");
+        for (int64_t i = 0; i < groups->counts[g]; i++) {
+            H3Index parent;
+            t_assertSuccess(
+                H3_EXPORT(cellToParent)(cells[cell], groups->res, &parent));
+            t_assert(parent == groups->parents[g], "cell has group parent");
+            cell++;
+        }
+        for (int64_t other = 0; other < g; other++) {
+            t_assert(groups->parents[other] != groups->parents[g],
+                     "parent appears once");
+        }
+    }
+    t_assert(cell == numCells, "groups cover all cells");
+}
+
+/** Removes H3_NULL gaps, e.g. from gridDisk around a pentagon */
+static int64_t removeNull(H3Index *cells, int64_t numCells) {
+    int64_t out = 0;
+    for (int64_t i = 0; i < numCells; i++) {
+        if (cells[i]) {
+            cells[out++] = cells[i];
+        }
+    }
+    return out;
+}
+
+static void initGroups(ParentGroups *groups, int res, int64_t numCells) {
+    groups->res = res;
+    groups->parents = calloc(numCells, sizeof(H3Index));
+    groups->counts = calloc(numCells, sizeof(int64_t));
+}
+
+static void freeGroups(ParentGroups *groups) {
+    free(groups->parents);
+    free(groups->counts);
+}
+
+SUITE(parentGroups) {
+    TEST(gridDiskRollUp) {
+        // Res 11 cells spanning several res 7 parents, around a pentagon
+        H3Index origins[] = {0x8b283470d959fff, 0x8b0800000000fff};
+        for (int o = 0; o < 2; o++) {
+            int64_t numCells;
+            t_assertSuccess(H3_EXPORT(maxGridDiskSize)(30, &numCells));
+            H3Index *cells = calloc(numCells, sizeof(H3Index));
+            t_assertSuccess(H3_EXPORT(gridDisk)(origins[o], 30, cells));
+            numCells = removeNull(cells, numCells);
+            H3_EXPORT(sortCells)(cells, numCells);
+
+            ParentGroups groups[3];
+            initGroups(&groups[0], 7, numCells);
+            initGroups(&groups[1], 9, numCells);
+            initGroups(&groups[2], 8, numCells);
+            t_assertSuccess(
+                H3_EXPORT(cellsToParentGroups)(cells, numCells, groups, 3));
+            for (int r = 0; r < 3; r++) {
+                assertGroups(cells, numCells, &groups[r]);
+                freeGroups(&groups[r]);
+            }
+            t_assert(groups[0].numGroups < groups[2].numGroups &&
+                         groups[2].numGroups < groups[1].numGroups,
+                     "finer parents make more groups");
+            free(cells);
+        }
+    }
+
+    TEST(mixedResolutions) {
+        // Compacted cells have mixed resolutions but still group by parent
+        int64_t numCells;
+        t_assertSuccess(H3_EXPORT(maxGridDiskSize)(40, &numCells));
+        H3Index *cells = calloc(numCells, sizeof(H3Index));
+        H3Index *compacted = calloc(numCells, sizeof(H3Index));
+        t_assertSuccess(H3_EXPORT(gridDisk)(0x8b283470d959fff, 40, cells));
+        t_assertSuccess(H3_EXPORT(compactCells)(cells, compacted, numCells));
+        int64_t numCompacted = removeNull(compacted, numCells);
+        H3_EXPORT(sortCells)(compacted, numCompacted);
+
+        ParentGroups groups;
+        initGroups(&groups, 6, numCompacted);
+        t_assertSuccess(H3_EXPORT(cellsToParentGroups)(compacted, numCompacted,
+                                                       &groups, 1));
+        assertGroups(compacted, numCompacted, &groups);
+        freeGroups(&groups);
+        free(compacted);
+        free(cells);
+    }
+
+    TEST(unsortedRuns) {
+        // Without sorting, groups are runs and a parent may repeat
+        H3Index parent = 0x85283473fffffff;
+        H3Index cells[3];
+        t_assertSuccess(H3_EXPORT(cellToCenterChild)(parent, 7, &cells[0]));
+        t_assertSuccess(
+            H3_EXPORT(cellToCenterChild)(0x8528340bfffffff, 7, &cells[1]));
+        cells[2] = cells[0];
+        ParentGroups groups;
+        initGroups(&groups, 5, 3);
+        t_assertSuccess(H3_EXPORT(cellsToParentGroups)(cells, 3, &groups, 1));
+        t_assert(groups.numGroups == 3, "each run is a group");
+        t_assert(groups.parents[0] == parent && groups.parents[2] == parent,
+                 "parent repeats");
+        H3_EXPORT(sortCells)(cells, 3);
+        t_assertSuccess(H3_EXPORT(cellsToParentGroups)(cells, 3, &groups, 1));
+        t_assert(groups.numGroups == 2, "sorted cells group by parent");
+        freeGroups(&groups);
+    }
+
+    TEST(invalidInputs) {
+        H3Index cells[] = {0x85283473fffffff};
+        ParentGroups groups;
+        initGroups(&groups, 6, 1);
+        t_assert(H3_EXPORT(cellsToParentGroups)(cells, 1, &groups, 1) ==
+                     E_RES_MISMATCH,
+                 "cell coarser than parent resolution");
+        groups.res = 16;
+        t_assert(H3_EXPORT(cellsToParentGroups)(cells, 1, &groups, 1) ==
+                     E_RES_DOMAIN,
+                 "invalid parent resolution");
+        groups.res = 0;
+        t_assert(H3_EXPORT(cellsToParentGroups)(cells, -1, &groups, 1) ==
+                     E_DOMAIN,
+                 "negative count");
+        t_assertSuccess(H3_EXPORT(cellsToParentGroups)(cells, 0, &groups, 1));
+        t_assert(groups.numGroups == 0, "no cells, no groups");
+        t_assertSuccess(H3_EXPORT(cellsToParentGroups)(cells, 1, &groups, 1));
+        t_assert(groups.numGroups == 1 && groups.counts[0] == 1 &&
+                     groups.parents[0] == 0x8029fffffffffff,
+                 "res 0 parent");
+        freeGroups(&groups);
+    }
+}
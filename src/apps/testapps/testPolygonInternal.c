@@ -669,6 +669,75 @@ SUITE(polygonInternal) {
         H3_EXPORT(destroyLinkedMultiPolygon)(&polygon);
     }
 
+    TEST(normalizeMultiPolygonManyDonuts) {
+        // A grid of small donuts inside the hole of a large donut, plus a
+        // donut crossing the antimeridian, so holes are found both through
+        // the grid index and through the list of large loops
+        const int n = 12;
+        const double step = 0.01;
+        LinkedGeoLoop *outers[12 * 12 + 2];
+        LinkedGeoLoop *inners[12 * 12 + 2];
+        int numDonuts = 0;
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                double lat = i * step;
+                double lng = j * step;
+                LatLng outerVerts[] = {{lat, lng},
+                                       {lat, lng + 0.008},
+                                       {lat + 0.008, lng + 0.008},
+                                       {lat + 0.008, lng}};
+                LatLng innerVerts[] = {{lat + 0.002, lng + 0.002},
+                                       {lat + 0.006, lng + 0.006},
+                                       {lat + 0.002, lng + 0.006}};
+                outers[numDonuts] = malloc(sizeof(LinkedGeoLoop));
+                createLinkedLoop(outers[numDonuts], outerVerts, 4);
+                inners[numDonuts] = malloc(sizeof(LinkedGeoLoop));
+                createLinkedLoop(inners[numDonuts], innerVerts, 3);
+                numDonuts++;
+            }
+        }
+
+        LatLng bigOuterVerts[] = {
+            {-0.1, -0.1}, {-0.1, 0.3}, {0.3, 0.3}, {0.3, -0.1}};
+        LatLng bigInnerVerts[] = {
+            {-0.05, -0.05}, {0.25, -0.05}, {0.25, 0.25}, {-0.05, 0.25}};
+        outers[numDonuts] = malloc(sizeof(LinkedGeoLoop));
+        createLinkedLoop(outers[numDonuts], bigOuterVerts, 4);
+        inners[numDonuts] = malloc(sizeof(LinkedGeoLoop));
+        createLinkedLoop(inners[numDonuts], bigInnerVerts, 4);
+        numDonuts++;
+
+        LatLng amOuterVerts[] = {
+            {0.5, 3.1}, {0.5, -3.1}, {0.6, -3.1}, {0.6, 3.1}};
+        LatLng amInnerVerts[] = {{0.52, 3.12}, {0.58, -3.12}, {0.52, -3.12}};
+        outers[numDonuts] = malloc(sizeof(LinkedGeoLoop));
+        createLinkedLoop(outers[numDonuts], amOuterVerts, 4);
+        inners[numDonuts] = malloc(sizeof(LinkedGeoLoop));
+        createLinkedLoop(inners[numDonuts], amInnerVerts, 3);
+        numDonuts++;
+
+        LinkedGeoPolygon polygon = {0};
+        for (int i = numDonuts - 1; i >= 0; i--) {
+            addLinkedLoop(&polygon, inners[i]);
+        }
+        for (int i = 0; i < numDonuts; i++) {
+            addLinkedLoop(&polygon, outers[i]);
+        }
+
+        t_assertSuccess(normalizeMultiPolygon(&polygon));
+
+        t_assert(countLinkedPolygons(&polygon) == numDonuts,
+                 "Polygon count correct");
+        int i = 0;
+        for (LinkedGeoPolygon *p = &polygon; p; p = p->next, i++) {
+            t_assert(countLinkedLoops(p) == 2, "Each donut has one hole");
+            t_assert(p->first == outers[i], "Got expected outer loop");
+            t_assert(p->first->next == inners[i], "Got expected inner loop");
+        }
+
+        H3_EXPORT(destroyLinkedMultiPolygon)(&polygon);
+    }
+
     TEST(lineCrossesLine) {
         LatLng lines1[4] = {{0, 0}, {1, 1}, {0, 1}, {1, 0}};
         t_assert(
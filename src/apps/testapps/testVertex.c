@@ -139,4 +139,34 @@ SUITE(Vertex) {
         t_assert(H3_EXPORT(cellToVertexes)(invalid, verts) == E_FAILED,
                  "cellToVertexes fails for invalid cell");
     }
+
+    TEST(cellsToVertexes) {
+        // A hexagon, a pentagon, and cells that fail as in cellToVertex
+        H3Index cells[] = {0x89283080ddbffff, 0x89080000003ffff,
+                           0xFFFFFFFFFFFFFFFF, 0x685b2396e900fff9};
+        H3Index verts[24];
+        uint64_t errors;
+        t_assert(H3_EXPORT(cellsToVertexes)(cells, 4, verts, &errors) ==
+                     E_FAILED,
+                 "first error is returned");
+        t_assert(errors == 0xc, "invalid cells are marked");
+        for (int c = 0; c < 2; c++) {
+            H3Index expected[6];
+            t_assertSuccess(H3_EXPORT(cellToVertexes)(cells[c], expected));
+            for (int i = 0; i < 6; i++) {
+                t_assert(verts[6 * c + i] == expected[i],
+                         "same vertexes as cellToVertexes");
+            }
+        }
+        for (int i = 12; i < 24; i++) {
+            t_assert(verts[i] == H3_NULL, "no vertexes for invalid cells");
+        }
+
+        t_assert(H3_EXPORT(cellToVertexes)(cells[3], verts) == E_CELL_INVALID,
+                 "cellToVertexes fails as cellToVertex");
+        t_assert(H3_EXPORT(cellsToVertexes)(cells, -1, verts, NULL) ==
+                     E_DOMAIN,
+                 "negative count fails");
+        t_assertSuccess(H3_EXPORT(cellsToVertexes)(cells, 2, verts, NULL));
+    }
 }
@@ -103,6 +103,20 @@ static void cellToVertex_neighbor_assertions(H3Index h3) {
     }
 }
 
+static void cellToVertexes_cellToVertex_assertions(H3Index h3) {
+    H3Index verts[NUM_HEX_VERTS] = {0};
+    t_assertSuccess(H3_EXPORT(cellToVertexes)(h3, verts));
+    int numVerts = H3_EXPORT(isPentagon)(h3) ? NUM_PENT_VERTS : NUM_HEX_VERTS;
+    for (int i = 0; i < numVerts; i++) {
+        H3Index vertex;
+        t_assertSuccess(H3_EXPORT(cellToVertex)(h3, i, &vertex));
+        t_assert(verts[i] == vertex, "cellToVertexes matches cellToVertex");
+    }
+    if (numVerts == NUM_PENT_VERTS) {
+        t_assert(verts[5] == H3_NULL, "last pentagon vertex is empty");
+    }
+}
+
 SUITE(Vertex) {
     TEST(directionForVertexNum_symmetry) {
         iterateAllIndexesAtRes(0, directionForVertexNum_symmetry_assertions);
@@ -135,6 +149,17 @@ SUITE(Vertex) {
         iterateAllIndexesAtRes(4, cellToVertex_neighbor_assertions);
     }
 
+    TEST(cellToVertexes_cellToVertex) {
+        iterateAllIndexesAtRes(0, cellToVertexes_cellToVertex_assertions);
+        iterateAllIndexesAtRes(1, cellToVertexes_cellToVertex_assertions);
+        iterateAllIndexesAtRes(2, cellToVertexes_cellToVertex_assertions);
+        iterateAllIndexesAtRes(3, cellToVertexes_cellToVertex_assertions);
+        iterateAllIndexesAtRes(4, cellToVertexes_cellToVertex_assertions);
+        // Res 5: pentagon base cell
+        iterateBaseCellIndexesAtRes(5, cellToVertexes_cellToVertex_assertions,
+                                    14);
+    }
+
     TEST(cellToVertex_uniqueness) {
         iterateAllIndexesAtRes(0, cellToVertex_uniqueness_assertions);
         iterateAllIndexesAtRes(1, cellToVertex_uniqueness_assertions);
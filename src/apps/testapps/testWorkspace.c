@@ -0,0 +1,201 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "h3api.h"
+#include "test.h"
+#include "utility.h"
+#include "workspace.h"
+
+static LatLng sfVerts[] = {
+    {0.659966917655, -2.1364398519396},  {0.6595011102219, -2.1359434279405},
+    {0.6583348114025, -2.1354884206045}, {0.6581220034068, -2.1382437718946},
+    {0.6594479998527, -2.1384597563896}, {0.6599990002976, -2.1376771158464}};
+
+static LatLng holeVerts[] = {{0.6595072188743, -2.1371053983433},
+                             {0.6591482046471, -2.1373141048153},
+                             {0.6592295020837, -2.1365222838402}};
+
+SUITE(workspace) {
+    H3Index sunnyvale = 0x89283470c27ffff;
+    H3Index pentagon = 0x89080000003ffff;
+
+    TEST(compactCells) {
+        int k = 9;
+        int64_t hexCount;
+        t_assertSuccess(H3_EXPORT(maxGridDiskSize)(k, &hexCount));
+        H3Index *cells = calloc(hexCount, sizeof(H3Index));
+        t_assertSuccess(H3_EXPORT(gridDisk)(sunnyvale, k, cells));
+
+        int64_t workspaceSize;
+        t_assertSuccess(
+            H3_EXPORT(compactCellsWorkspaceSize)(hexCount, &workspaceSize));
+        void *workspace = malloc(workspaceSize);
+        // The workspace does not need to be zeroed by the caller
+        memset(workspace, 0xff, workspaceSize);
+
+        H3Index *expected = calloc(hexCount, sizeof(H3Index));
+        H3Index *compacted = calloc(hexCount, sizeof(H3Index));
+        t_assertSuccess(H3_EXPORT(compactCells)(cells, expected, hexCount));
+        // Reuse the workspace, which is dirty after the first call
+        for (int i = 0; i < 2; i++) {
+            memset(compacted, 0, hexCount * sizeof(H3Index));
+            t_assertSuccess(H3_EXPORT(compactCellsWithWorkspace)(
+                cells, compacted, hexCount, workspace, workspaceSize));
+            t_assert(memcmp(expected, compacted, hexCount * sizeof(H3Index)) ==
+                         0,
+                     "Same output as compactCells");
+        }
+
+        t_assert(H3_EXPORT(compactCellsWithWorkspace)(
+                     cells, compacted, hexCount, workspace,
+                     workspaceSize - 1) == E_MEMORY_BOUNDS,
+                 "Workspace too small");
+
+        // Errors are reported as for compactCells
+        for (int i = 0; i < 10; i++) {
+            cells[i] = cells[0];
+        }
+        t_assert(H3_EXPORT(compactCellsWithWorkspace)(
+                     cells, compacted, 10, workspace, workspaceSize) ==
+                     E_DUPLICATE_INPUT,
+                 "Duplicate input is rejected");
+
+        free(compacted);
+        free(expected);
+        free(workspace);
+        free(cells);
+    }
+
+    TEST(compactCellsEdgeCases) {
+        int64_t workspaceSize;
+        t_assertSuccess(
+            H3_EXPORT(compactCellsWorkspaceSize)(0, &workspaceSize));
+        t_assert(workspaceSize == 0, "No workspace for no cells");
+        t_assertSuccess(
+            H3_EXPORT(compactCellsWithWorkspace)(NULL, NULL, 0, NULL, 0));
+        t_assert(H3_EXPORT(compactCellsWorkspaceSize)(-1, &workspaceSize) ==
+                     E_DOMAIN,
+                 "Negative size is rejected");
+        t_assert(H3_EXPORT(compactCellsWorkspaceSize)(INT64_MAX,
+                                                      &workspaceSize) ==
+                     E_MEMORY_BOUNDS,
+                 "Overflowing size is rejected");
+
+        H3Index res0[122];
+        H3Index out[122];
+        H3_EXPORT(getRes0Cells)(res0);
+        t_assertSuccess(
+            H3_EXPORT(compactCellsWorkspaceSize)(122, &workspaceSize));
+        void *workspace = malloc(workspaceSize);
+        t_assertSuccess(H3_EXPORT(compactCellsWithWorkspace)(
+            res0, out, 122, workspace, workspaceSize));
+        t_assert(memcmp(res0, out, sizeof(res0)) == 0,
+                 "Resolution 0 cells are copied");
+        free(workspace);
+    }
+
+    TEST(polygonToCells) {
+        GeoPolygon polygon = {.geoloop = {.numVerts = 6, .verts = sfVerts},
+                              .numHoles = 1,
+                              .holes = &(GeoLoop){.numVerts = 3,
+                                                  .verts = holeVerts}};
+        int64_t numHexagons;
+        t_assertSuccess(
+            H3_EXPORT(maxPolygonToCellsSize)(&polygon, 9, 0, &numHexagons));
+        int64_t workspaceSize;
+        t_assertSuccess(H3_EXPORT(polygonToCellsWorkspaceSize)(
+            &polygon, 9, 0, &workspaceSize));
+        void *workspace = malloc(workspaceSize);
+        // The workspace does not need to be zeroed by the caller
+        memset(workspace, 0xff, workspaceSize);
+
+        H3Index *expected = calloc(numHexagons, sizeof(H3Index));
+        H3Index *hexagons = calloc(numHexagons, sizeof(H3Index));
+        t_assertSuccess(H3_EXPORT(polygonToCells)(&polygon, 9, 0, expected));
+        for (int i = 0; i < 2; i++) {
+            memset(hexagons, 0, numHexagons * sizeof(H3Index));
+            t_assertSuccess(H3_EXPORT(polygonToCellsWithWorkspace)(
+                &polygon, 9, 0, hexagons, workspace, workspaceSize));
+            t_assert(memcmp(expected, hexagons,
+                            numHexagons * sizeof(H3Index)) == 0,
+                     "Same output as polygonToCells");
+        }
+
+        t_assert(H3_EXPORT(polygonToCellsWithWorkspace)(
+                     &polygon, 9, 0, hexagons, workspace, workspaceSize - 1) ==
+                     E_MEMORY_BOUNDS,
+                 "Workspace too small");
+        t_assert(H3_EXPORT(polygonToCellsWorkspaceSize)(
+                     &polygon, 9, 42, &workspaceSize) == E_OPTION_INVALID,
+                 "Invalid flags are rejected");
+        t_assert(H3_EXPORT(polygonToCellsWorkspaceSize)(
+                     &polygon, 16, 0, &workspaceSize) == E_RES_DOMAIN,
+                 "Invalid resolution is rejected");
+
+        free(hexagons);
+        free(expected);
+        free(workspace);
+    }
+
+    TEST(gridDiskDistances) {
+        int k = 3;
+        int64_t maxSize;
+        t_assertSuccess(H3_EXPORT(maxGridDiskSize)(k, &maxSize));
+        int64_t workspaceSize;
+        t_assertSuccess(
+            H3_EXPORT(gridDiskDistancesWorkspaceSize)(k, &workspaceSize));
+        t_assert(workspaceSize == maxSize * (int64_t)sizeof(int),
+                 "Workspace holds the distances");
+        void *workspace = malloc(workspaceSize);
+        // The workspace does not need to be zeroed by the caller
+        memset(workspace, 0xff, workspaceSize);
+
+        H3Index *expected = calloc(maxSize, sizeof(H3Index));
+        H3Index *out = calloc(maxSize, sizeof(H3Index));
+        // The pentagon takes the fallback path that needs the distances
+        t_assertSuccess(H3_EXPORT(gridDisk)(pentagon, k, expected));
+        t_assertSuccess(H3_EXPORT(gridDiskDistancesWithWorkspace)(
+            pentagon, k, out, NULL, workspace, workspaceSize));
+        t_assert(memcmp(expected, out, maxSize * sizeof(H3Index)) == 0,
+                 "Same output as gridDisk");
+
+        memset(out, 0, maxSize * sizeof(H3Index));
+        t_assert(H3_EXPORT(gridDiskDistancesWithWorkspace)(
+                     pentagon, k, out, NULL, workspace, workspaceSize - 1) ==
+                     E_MEMORY_BOUNDS,
+                 "Workspace too small");
+
+        // With distances the workspace is not needed
+        int *distances = calloc(maxSize, sizeof(int));
+        t_assertSuccess(H3_EXPORT(gridDiskDistancesWithWorkspace)(
+            pentagon, k, out, distances, NULL, 0));
+        t_assert(memcmp(expected, out, maxSize * sizeof(H3Index)) == 0,
+                 "Same output with distances");
+
+        t_assert(H3_EXPORT(gridDiskDistancesWorkspaceSize)(-1,
+                                                           &workspaceSize) ==
+                     E_DOMAIN,
+                 "Negative k is rejected");
+
+        free(distances);
+        free(out);
+        free(expected);
+        free(workspace);
+    }
+}
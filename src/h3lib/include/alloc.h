@@ -18,32 +18,72 @@
  *
  * This file contains macros and the necessary declarations to be able
  * to point H3 at different memory management functions than the standard
- * malloc/free/etc functions.
+ * malloc/free/etc functions, either for the whole library at compile time
+ * (H3_ALLOC_PREFIX) or, with the ENABLE_THREAD_ALLOCATOR build option, for
+ * one thread at run time (setThreadAllocator).
  */
 
 #ifndef ALLOC_H
 #define ALLOC_H
 
-#include "h3api.h"  // for TJOIN
+#include <stddef.h>
 
-#ifdef H3_ALLOC_PREFIX
-#define H3_MEMORY(name) TJOIN(H3_ALLOC_PREFIX, name)
+#include "h3api.h"  // for TJOIN
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-void *H3_MEMORY(malloc)(size_t size);
-void *H3_MEMORY(calloc)(size_t num, size_t size);
-void *H3_MEMORY(realloc)(void *ptr, size_t size);
-void H3_MEMORY(free)(void *ptr);
+#ifdef H3_ALLOC_PREFIX
+#define H3_BASE_MEMORY(name) TJOIN(H3_ALLOC_PREFIX, name)
 
-#ifdef __cplusplus
-}
+void *H3_BASE_MEMORY(malloc)(size_t size);
+void *H3_BASE_MEMORY(calloc)(size_t num, size_t size);
+void *H3_BASE_MEMORY(realloc)(void *ptr, size_t size);
+void H3_BASE_MEMORY(free)(void *ptr);
+#else
+#define H3_BASE_MEMORY(name) name
 #endif
 
+#ifdef H3_THREAD_ALLOCATOR
+/**
+ * Memory management functions registered for a thread with
+ * setThreadAllocator. Each function receives `context` as its first argument,
+ * so a worker can point H3 at its own pool or arena. All four functions must
+ * be set, and memory from one must be accepted by the others.
+ */
+typedef struct {
+    void *context;  ///< Passed to each function
+    void *(*mallocFn)(void *context, size_t size);
+    void *(*callocFn)(void *context, size_t num, size_t size);
+    void *(*reallocFn)(void *context, void *ptr, size_t size);
+    void (*freeFn)(void *context, void *ptr);
+} H3Allocator;
+
+/** @brief Set the allocator used by H3 on the calling thread */
+DECLSPEC const H3Allocator *H3_EXPORT(setThreadAllocator)(
+    const H3Allocator *allocator);
+
+/** @brief Get the allocator used by H3 on the calling thread, or NULL */
+DECLSPEC const H3Allocator *H3_EXPORT(getThreadAllocator)(void);
+
+/*
+With the ENABLE_THREAD_ALLOCATOR build option, all allocations in H3 go
+through H3_MEMORY to the calling thread's allocator if one is set, and the
+H3_ALLOC_PREFIX (or standard) functions otherwise.
+*/
+#define H3_MEMORY(name) H3_EXPORT(TJOIN(h3Memory_, name))
+
+DECLSPEC void *H3_MEMORY(malloc)(size_t size);
+DECLSPEC void *H3_MEMORY(calloc)(size_t num, size_t size);
+DECLSPEC void *H3_MEMORY(realloc)(void *ptr, size_t size);
+DECLSPEC void H3_MEMORY(free)(void *ptr);
 #else
-#define H3_MEMORY(name) name
+#define H3_MEMORY(name) H3_BASE_MEMORY(name)
+#endif
+
+#ifdef __cplusplus
+}
 #endif
 
 #endif
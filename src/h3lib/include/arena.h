@@ -0,0 +1,77 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file arena.h
+ * @brief   Bump allocator for output that is freed all at once
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "h3api.h"
+
+/** Alignment of every arena allocation */
+#define ARENA_ALIGNMENT 16
+
+/** Smallest block allocated when an arena runs out of space */
+#define ARENA_MIN_BLOCK_SIZE 4096
+
+/** A block of memory allocated by an arena, followed by its data */
+typedef struct ArenaBlock {
+    struct ArenaBlock *next;  ///< Previously allocated block
+    size_t capacity;          ///< Size of the data following this header
+} ArenaBlock;
+
+/**
+ * A bump allocator. Allocations come from the current region, which is either
+ * a caller-provided buffer or the most recent block allocated with
+ * H3_MEMORY(malloc). Individual allocations are never freed; resetArena and
+ * destroyArena release everything at once.
+ */
+typedef struct {
+    uint8_t *base;        ///< Start of the current region
+    size_t used;          ///< Bytes used in the current region
+    size_t capacity;      ///< Size of the current region
+    ArenaBlock *blocks;   ///< Allocated blocks, most recent first
+    uint8_t *buffer;      ///< Caller-provided buffer, or NULL
+    size_t bufferSize;    ///< Size of the caller-provided buffer
+} Arena;
+
+/** Position in an arena, for undoing allocations with rewindArena */
+typedef struct {
+    uint8_t *base;
+    size_t used;
+    size_t capacity;
+    ArenaBlock *blocks;
+} ArenaMark;
+
+/** @brief Initialize an arena, optionally starting from a caller buffer */
+DECLSPEC void H3_EXPORT(initArena)(Arena *arena, void *buffer, size_t size);
+
+/** @brief Free all allocations, keeping the newest block for reuse */
+DECLSPEC void H3_EXPORT(resetArena)(Arena *arena);
+
+/** @brief Free all memory allocated by an arena */
+DECLSPEC void H3_EXPORT(destroyArena)(Arena *arena);
+
+void *arenaAlloc(Arena *arena, size_t size);
+void arenaShrinkLast(Arena *arena, void *ptr, size_t oldSize, size_t newSize);
+ArenaMark arenaMark(const Arena *arena);
+void rewindArena(Arena *arena, ArenaMark mark);
+
+#endif
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file cellAdjacency.h
+ * @brief   Adjacency graphs of cell sets in compressed sparse row form
+ */
+
+#ifndef CELLADJACENCY_H
+#define CELLADJACENCY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "h3api.h"
+
+/**
+ * Adjacency of a cell set in compressed sparse row form: the neighbors of
+ * cell i that are in the set are `neighbors[offsets[i]]` up to (excluding)
+ * `neighbors[offsets[i + 1]]`, as indexes into the input cells. Free with
+ * destroyCellAdjacency.
+ */
+typedef struct {
+    int64_t numCells;      ///< Number of input cells
+    int64_t numEdges;      ///< Number of directed edges, offsets[numCells]
+    int64_t *offsets;      ///< numCells + 1 offsets into neighbors
+    int64_t *neighbors;    ///< Index of the neighbor of each edge
+    double *edgeLengths;   ///< Length of each edge in radians, or NULL
+} CellAdjacency;
+
+/** @brief adjacency graph of a set of cells */
+DECLSPEC H3Error H3_EXPORT(cellsToAdjacency)(const H3Index *cells,
+                                             int64_t numCells,
+                                             bool withEdgeLengths,
+                                             CellAdjacency *out);
+
+/** @brief Free the memory held by a CellAdjacency */
+DECLSPEC void H3_EXPORT(destroyCellAdjacency)(CellAdjacency *adjacency);
+
+#endif
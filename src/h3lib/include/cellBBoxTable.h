@@ -0,0 +1,13945 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file cellBBoxTable.h
+ * @brief   Bounding boxes covering the children of coarse cells
+ *
+ * Generated by generateCellBBoxTable. Do not edit.
+ */
+
+#ifndef CELL_BBOX_TABLE_H
+#define CELL_BBOX_TABLE_H
+
+#include "bbox.h"
+
+/** Finest resolution in the table */
+#define CELL_BBOX_TABLE_RES 2
+
+/** Offset of each resolution in CELL_BBOXES */
+static const int64_t CELL_BBOXES_OFFSETS[3] = {0, 122, 976};
+
+/** Bounding boxes covering the children of each cell */
+static const BBox CELL_BBOXES[6954] = {
+    {1.5707963267948966, 1.138705345282752,
+     3.1415926535897931, -3.1415926535897931},
+    {1.5707963267948966, 1.1095087745318399,
+     3.1415926535897931, -3.1415926535897931},
+    {1.5707963267948966, 1.0038723308988602,
+     3.1415926535897931, -3.1415926535897931},
+    {1.499573339027396, 0.93173114329619389,
+     0.24036032652919195, -1.4023811501352219},
+    {1.340952429348824, 0.91081887469876599,
+     0.70313262949258004, -0.32987122811090003},
+    {1.4113571973690058, 0.83692787585599404,
+     2.2498418307617558, 0.89451316145290416},
+    {1.4062454020142721, 0.86546361238848801,
+     -2.1052664299246047, 2.8235136142807549},
+    {1.3436693495380001, 0.75945277325921001,
+     -0.72772769335633813, -1.931664576402242},
+    {1.2810348844172021, 0.79181786334293791,
+     1.3420018733205519, 0.287071792738538},
+    {1.2853193148725321, 0.76339230976538808,
+     -1.5766867859044158, -2.5814805891658743},
+    {1.22859346038655, 0.71669640275186008,
+     2.6724946798487061, 1.7211907769563841},
+    {1.2330584833559539, 0.688640254557916,
+     -2.9315172454810989, 2.4005932758974087},
+    {1.178799535125896, 0.635717836881454,
+     0.21999601183834394, -0.64513533801928391},
+    {1.149301775543168, 0.59716244030254195,
+     -0.35519811487487601, -1.2277055095569041},
+    {1.0945300273330898, 0.66173584842865996,
+     -2.1508612228634383, -2.8441423735795919},
+    {1.0921766298157798, 0.58203494477734008,
+     0.74935283069583192, -0.083626787323821949},
+    {1.1037771773510201, 0.50235956571394003,
+     1.6509672967823139, 0.81768674650066597},
+    {1.0548250825663459, 0.53674989412332397,
+     -2.5616035037638967, 2.9557617678659369},
+    {1.059912605170148, 0.50794599247329209,
+     2.1312884446329718, 1.4103529672144379},
+    {1.0461216380057239, 0.46948879726957599,
+     -1.3220162507036999, -2.0762729877339301},
+    {0.95041572900409199, 0.42503516072605807,
+     -1.825944676417574, -2.5148248914946558},
+    {0.95784899391309997, 0.45569307771018008,
+     -0.85412542327846808, -1.5799837030227721},
+    {0.94103498498095406, 0.43548411775329593,
+     1.1381469778952158, 0.39769381733743403},
+    {0.97326512839636792, 0.40690390234653195,
+     2.8571841920357381, 2.207015996126072},
+    {0.886500627573094, 0.46093608238350603,
+     2.3846630938791762, 1.856539139024904},
+    {0.88689032610391405, 0.32061117407473605,
+     -2.9605322529717806, 2.5971496667834706},
+    {0.90255135519092, 0.29753744818915007,
+     -0.11853224725771203, -0.80181303888245803},
+    {0.82998624744966998, 0.32767710490215007,
+     -2.2444649893715001, -2.9174085296999301},
+    {0.86885265500263598, 0.30718143771135398,
+     0.32258723495195596, -0.31742526849609598},
+    {0.79216512722653398, 0.25311806057778602,
+     -0.5616762577155181, -1.1693007851283019},
+    {0.786011266219524, 0.20906597607183605,
+     1.8004062855235601, 1.1984380168658599},
+    {0.77267092816905403, 0.20731849912293601,
+     0.74562217237064998, 0.066740612901390023},
+    {0.72577798772269397, 0.18575856949626607,
+     2.18470493412386, 1.6140372740433699},
+    {0.73222940073701392, 0.20722605517133608,
+     1.3958354868822218, 0.78929560868928816},
+    {0.72871224144330804, 0.16029639304103202,
+     -1.2258491693681879, -1.7639584570097921},
+    {0.69751792761351794, 0.181504616305352,
+     -2.6333069613612547, 3.0130374634692947},
+    {0.72832801806198, 0.12602412032973001,
+     -1.5881261583701698, -2.20598991922395},
+    {0.67578918266061205, 0.13960717931654798,
+     2.5684137128650977, 1.9910185099477122},
+    {0.61709576734214799, 0.19204387554399205,
+     -0.93333968335044992, -1.3919390952958801},
+    {0.63740135696594202, 0.070952789250898041,
+     2.9551004201051541, 2.3616436688617557},
+    {0.62406607262266189, 0.077861722195528033,
+     -1.9832955535407981, -2.5755173034494119},
+    {0.58343213227811597, 0.083851549020094007,
+     1.0364746835711238, 0.46242561069297605},
+    {0.57532562066405402, 0.031802883612745997,
+     0.033778589196841985, -0.50613289361611202},
+    {0.54639660852861194, -0.020716467314701989,
+     -0.33368011694472, -0.88476225827115007},
+    {0.52238897788634597, -0.0062514926318559816,
+     0.39865091534112196, -0.14817555640009195},
+    {0.50291461654848801, 0.0071393748535519969,
+     -2.9793573755005665, 2.7230578446067866},
+    {0.51139184720084996, -0.051078602135189985,
+     -2.3275992435171622, -2.9456512421865679},
+    {0.45747876302774998, -0.079711649037480001,
+     -0.69489814884456003, -1.2233798772179001},
+    {0.47240333005176804, -0.096452812210738009,
+     1.5601335000268581, 1.078316286919152},
+    {0.39599953084831996, -0.036522765120659981,
+     1.2116909784216998, 0.78972640998222998},
+    {0.475730756993892, -0.13028765746261201,
+     1.96009578443747, 1.4026700687021201},
+    {0.41512043016843597, -0.12559612319152597,
+     -1.048379354877738, -1.5689048773757821},
+    {0.41656716354512602, -0.147303656007166,
+     2.3140614044271461, 1.7810963677496041},
+    {0.39370372818403199, -0.13354010364076199,
+     0.74180110284690992, 0.17331316714465006},
+    {0.41874821972052595, -0.15833601532116595,
+     -1.403524509465288, -1.935866165135532},
+    {0.36539908400377397, -0.16765729142174399,
+     -1.759031368694244, -2.2951469080343658},
+    {0.34025976501143396, -0.17405433239535395,
+     -2.690652668955257, 3.0504956815116566},
+    {0.37838937953860996, -0.22036848935056996,
+     2.6959447747417982, 2.122784138179592},
+    {0.262363818925412, -0.16365891833479201,
+     0.13043321499833599, -0.30086654588446604},
+    {0.29265943013887796, -0.26608965156520792,
+     3.0106637877676778, 2.5020480913543222},
+    {0.26952543076691793, -0.24601959200962795,
+     -2.0924912133148177, -2.6309784000245422},
+    {0.24601959200962795, -0.26952543076691793,
+     1.0491014402749839, 0.51061425356524603},
+    {0.26608965156520792, -0.29265943013887796,
+     -0.13092886582211199, -0.63954456223546807},
+    {0.16365891833479201, -0.262363818925412,
+     -3.0111594385914549, 2.840726107705335},
+    {0.22036848935056996, -0.37838937953860996,
+     -0.44564787884799006, -1.01880851541021},
+    {0.17405433239535395, -0.34025976501143396,
+     0.450939984634534, -0.091096972078143976},
+    {0.16765729142174399, -0.36539908400377397,
+     1.382561284895546, 0.84644574555542396},
+    {0.15833601532116595, -0.41874821972052595,
+     1.7380681441245021, 1.205726488454258},
+    {0.13354010364076199, -0.39370372818403199,
+     -2.3997915507428802, -2.9682794864451401},
+    {0.147303656007166, -0.41656716354512602,
+     -0.82753124916265408, -1.3604962858401959},
+    {0.12559612319152597, -0.41512043016843597,
+     2.093213298712052, 1.5726877762140079},
+    {0.13028765746261201, -0.475730756993892,
+     -1.18149686915232, -1.7389225848876699},
+    {0.036522765120659981, -0.39599953084831996,
+     -1.9299016751681002, -2.3518662436075699},
+    {0.096452812210736011, -0.47240333005175605,
+     -1.5814591535629439, -2.0632763666706362},
+    {0.079711649037480001, -0.45747876302774998,
+     2.44669450474523, 1.9182127763718899},
+    {0.051078602135189985, -0.51139184720084996,
+     0.81399341007263804, 0.19594141140323204},
+    {-0.0071393748535519969, -0.50291461654848801,
+     0.162235278089222, -0.41853480898300199},
+    {0.0062514926318559816, -0.52238897788634597,
+     -2.7429417382486689, 2.9934170971897087},
+    {0.020716467314701989, -0.54639660852861194,
+     2.8079125366450679, 2.2568303953186519},
+    {-0.031802883612745997, -0.57532562066405402,
+     -3.1078140643929544, 2.6354597599736782},
+    {-0.083851549020094007, -0.58343213227811597,
+     -2.1051179700186662, -2.6791670428968137},
+    {-0.077861722195528033, -0.62406607262266189,
+     1.1582971000489919, 0.56607535014037813},
+    {-0.070952789250898041, -0.63740135696594202,
+     -0.18649223348463603, -0.77994898472803398},
+    {-0.19204387554399005, -0.61709576734215998,
+     2.2082529702393376, 1.7496535582939219},
+    {-0.13960717931654798, -0.67578918266061205,
+     -0.57317894072470399, -1.150574143642076},
+    {-0.12602412032973001, -0.72832801806198,
+     1.553466495219632, 0.93560273436583818},
+    {-0.181504616305352, -0.69751792761351794,
+     0.50828569222853603, -0.12855519012050601},
+    {-0.16029639304103202, -0.72871224144330804,
+     1.9157434842216021, 1.3776341965799979},
+    {-0.20722605517133608, -0.73222940073701392,
+     -1.745757166707568, -2.3522970449005021},
+    {-0.18575856949626607, -0.72577798772269397,
+     -0.95688771946594209, -1.5275553795464178},
+    {-0.20731849912293601, -0.77267092816905403,
+     -2.3959704812191398, -3.0748520406884001},
+    {-0.20906597607183605, -0.786011266219524,
+     -1.3411863680662399, -1.9431546367239401},
+    {-0.25311806057778602, -0.79216512722653398,
+     2.5799163958742701, 1.9722918684615003},
+    {-0.30718143771135398, -0.86885265500263598,
+     -2.8190054186378468, 2.8241673850937068},
+    {-0.32767710490215007, -0.82998624744966998,
+     0.89712766421828993, 0.22418412388986006},
+    {-0.29753744818915007, -0.90255135519092,
+     3.0230604063320783, 2.3397796147073322},
+    {-0.32061117407473605, -0.88689032610391405,
+     0.18106040061800802, -0.54444298680631809},
+    {-0.46093608238350603, -0.886500627573094,
+     -0.75692955971061404, -1.285053514564886},
+    {-0.40690390234653195, -0.97326512839636792,
+     -0.28440846155406396, -0.93457665746371599},
+    {-0.43548411775329593, -0.94103498498095406,
+     -2.003445675694584, -2.7438988362523657},
+    {-0.45569307771018008, -0.95784899391309997,
+     2.2874672303113197, 1.5616089505670299},
+    {-0.42503516072605807, -0.95041572900409199,
+     1.315647977172216, 0.62676776209513396},
+    {-0.46948879726957599, -1.0461216380057239,
+     1.8195764028860881, 1.0653196658558719},
+    {-0.50794599247329209, -1.059912605170148,
+     -1.0103042089568179, -1.7312396863753521},
+    {-0.53674989412332397, -1.0548250825663459,
+     0.579989149825892, -0.18583088572385195},
+    {-0.50235956571394003, -1.1037771773510201,
+     -1.4906253568074739, -2.3239059070891361},
+    {-0.58203494477734008, -1.0921766298157798,
+     -2.3922398228939561, 3.0579658662659623},
+    {-0.66173584842865996, -1.0945300273330898,
+     0.99073143072635195, 0.29745028001019802},
+    {-0.59716244030254195, -1.149301775543168,
+     2.7863945387149256, 1.913887144032884},
+    {-0.635717836881454, -1.178799535125896,
+     -2.9215966417514445, 2.4964573155705048},
+    {-0.688640254557916, -1.2330584833559539,
+     0.21007540810869194, -0.74099937769239199},
+    {-0.71669640275186008, -1.22859346038655,
+     -0.46909797374108403, -1.4204018766334059},
+    {-0.76339230976538808, -1.2853193148725321,
+     1.564905867685374, 0.56011206442391592},
+    {-0.79181786334293791, -1.2810348844172021,
+     -1.7995907802692503, -2.8545208608512498},
+    {-0.75945277325921001, -1.3436693495380001,
+     2.4138649602334499, 1.20992807718756},
+    {-0.86546361238848801, -1.4062454020142721,
+     1.036326223665184, -0.31807903930903397},
+    {-0.83692787585599404, -1.4113571973690058,
+     -0.89175082282803197, -2.2470794921368977},
+    {-0.91081887469876599, -1.340952429348824,
+     -2.438460024097211, 2.8117214254789009},
+    {-0.93173114329619389, -1.499573339027396,
+     -2.9012323270606091, 1.7392115034545688},
+    {-1.0038723308988602, -1.5707963267948966,
+     3.1415926535897931, -3.1415926535897931},
+    {-1.1095087745318399, -1.5707963267948966,
+     3.1415926535897931, -3.1415926535897931},
+    {-1.138705345282752, -1.5707963267948966,
+     3.1415926535897931, -3.1415926535897931},
+    {1.499363500131673, 1.2667180222138132,
+     1.2868322048345431, 0.040435085395374049},
+    {1.5707963267948966, 1.3437788874188628,
+     3.1415926535897931, -3.1415926535897931},
+    {1.4628971179487957, 1.230251640030936,
+     1.8300638526889936, 0.78375072778053179},
+    {1.5707963267948966, 1.3693395359215859,
+     3.1415926535897931, -3.1415926535897931},
+    {1.3848366181505736, 1.1521911402327139,
+     0.89065615075799298, 0.10917975025532367},
+    {1.4566137095654019, 1.2239682316475422,
+     0.59826273820532005, -0.42001512555864745},
+    {1.3818912427954571, 1.1492457648775973,
+     1.3104829189022491, 0.53631530489296697},
+    {1.4989897875534528, 1.2663443096355931,
+     -1.2530180994931088, -2.4969684843706546},
+    {1.4147879487448887, 1.1821424708270289,
+     -0.98435891098333483, -1.8492847432831319},
+    {1.4011122433245189, 1.1684667654066592,
+     -1.8695935544144546, -2.6942163294856085},
+    {1.3650467431225901, 1.1324012652047304,
+     -1.4980675601331175, -2.2330477159506175},
+    {1.5707963267948966, 1.4001918412776861,
+     3.1415926535897931, -3.1415926535897931},
+    {1.5286220263030668, 1.295976548385207,
+     -0.35213822024174857, -1.8261241131225905},
+    {1.5103156251190841, 1.2776701472012244,
+     -1.9565212561348639, 3.003941066252553},
+    {1.4240706224145678, 1.1914251444967081,
+     2.9842965637684409, 2.0895934559874019},
+    {1.4327762317681745, 1.2001307538503148,
+     -2.7173430856194143, 2.6412128473788297},
+    {1.2824020199853674, 1.0497565420675077,
+     2.7634603063859067, 2.1726276737921846},
+    {1.3144232391668054, 1.0817777612489456,
+     -3.1258186273756179, 2.5184545598302419},
+    {1.4869757110712487, 1.254330233153389,
+     2.5480999450424662, 1.3779089000041234},
+    {1.5619241267015873, 1.3292786487837276,
+     -2.5958328227873295, 1.8242234189175657},
+    {1.3495372459872526, 1.1168917680693928,
+     2.4681577544352185, 1.765739262637489},
+    {1.3321793612414647, 1.099533883323605,
+     -0.20578523001533633, -0.87520345256216892},
+    {1.198026324881361, 0.96538084696350102,
+     -0.32951512348774864, -0.82468967530914372},
+    {1.4000994760553702, 1.1674539981375105,
+     -0.49948364353696989, -1.3212766050034122},
+    {1.2630727177271797, 1.0304272398093199,
+     -0.55677762062467706, -1.1222034832544159},
+    {1.3611188625909374, 1.1284733846730777,
+     0.176049289908807, -0.55038561544881093},
+    {1.242154524295886, 1.0095090463780263,
+     -0.047051923084981101, -0.5875526028850967},
+    {1.4630424213402493, 1.2303969434223896,
+     0.059084422949047866, -0.98789578295561797},
+    {1.2455507672321458, 1.012905289314286,
+     0.45608183875916503, -0.088299109734178122},
+    {1.3451376838330682, 1.1124922059152085,
+     0.50024934990660253, -0.19348087259229813},
+    {1.166857674693154, 0.9342121967752941,
+     0.55267088392982966, 0.084672050378832214},
+    {1.2764371492958919, 1.0437916713780322,
+     0.7065755974006791, 0.12384690229538281},
+    {1.2560838719886855, 1.0234383940708258,
+     0.22590538317590261, -0.33091380123350855},
+    {1.3451376838330682, 1.1124922059152085,
+     0.50024934990660253, -0.19348087259229813},
+    {1.1566113136879348, 0.92396583577007485,
+     0.31432043035524082, -0.14547925909172427},
+    {1.24095350819124, 1.0083080302733802,
+     1.8329165600889863, 1.2937733742287043},
+    {1.3655050148797898, 1.1328595369619301,
+     2.0515691827085143, 1.3155781822011416},
+    {1.1347204180520127, 0.90207494013415279,
+     1.9599924776100992, 1.5166307508083707},
+    {1.2456961175419852, 1.0130506396241254,
+     2.1484682184773778, 1.6039198205229712},
+    {1.2004742755358386, 0.96782879761797891,
+     1.5270750902943004, 1.0296109739136758},
+    {1.3289493271301929, 1.0963038492123331,
+     1.6315602778048668, 0.96792207662974294},
+    {1.1131219999655, 0.88047652204763993,
+     1.7076917454120326, 1.2792414030131187},
+    {1.2406299924133646, 1.0079845144955049,
+     -2.5042439441683446, -3.0430227617468435},
+    {1.1661175869330902, 0.93347210901523026,
+     -2.3345044326942874, -2.8018996099829021},
+    {1.1665514459090136, 0.93390596799115366,
+     -2.78357311262589, 3.0318633581212695},
+    {1.1164804575239382, 0.88383497960607826,
+     -2.5815733352595505, -3.0122630390149325},
+    {1.3736321614113594, 1.1409866834934996,
+     -2.3526009984286627, -3.1070188778410439},
+    {1.2839425277025958, 1.051297049784736,
+     -2.1718167859493644, -2.7647825765953828},
+    {1.2968106867552525, 1.0641652088373927,
+     -2.7640824513351894, 2.9076400212323485},
+    {1.1710739924828819, 0.93842851456502197,
+     -1.1117809521593727, -1.5832537656414205},
+    {1.0480956312139798, 0.81545015329611981,
+     -1.0166956451084621, -1.4067708505414562},
+    {1.1427203343258556, 0.91007485640799568,
+     -1.4015900506684611, -1.850795987946936},
+    {1.0390731056397411, 0.80642762772188104,
+     -1.2572585433161005, -1.6426694811275111},
+    {1.2958880254627698, 1.0632425475449101,
+     -0.87986765395223143, -1.4899625185404215},
+    {1.1640023309072582, 0.9313568529893983,
+     -0.8254927874993343, -1.2911726023829466},
+    {1.2819267203474312, 1.0492812424295714,
+     -1.2586965743456211, -1.8488744311960039},
+    {1.1667529912630035, 0.93410751334514353,
+     1.0247047469089623, 0.55679140914756109},
+    {1.2603135047993834, 1.0276680268815237,
+     1.2863356621396607, 0.72434261252173737},
+    {1.0372589763715303, 0.80461349845367025,
+     1.045470373556985, 0.66098006984031676},
+    {1.1289698864596971, 0.89632440854183715,
+     1.2577813697293592, 0.8185103446517048},
+    {1.175842510785158, 0.94319703286729806,
+     0.78369024762316242, 0.30821553167398863},
+    {1.2849131555176998, 1.0522676775998401,
+     0.99794251868212902, 0.40362403467585661},
+    {1.0611121602316334, 0.82846668231377341,
+     0.84094718927934842, 0.44388266993219816},
+    {1.1461508485166894, 0.91350537059882941,
+     -1.8561309728044915, -2.3078994159180688},
+    {1.0867560173058703, 0.85411053938801029,
+     -1.6532306098321965, -2.0650347381492837},
+    {1.0589318488863553, 0.82628637096849533,
+     -2.0361573437537781, -2.4320290239267721},
+    {1.0159202837882724, 0.78327480587041232,
+     -1.8512777734008219, -2.2253508748517814},
+    {1.2773886605126243, 1.0447431825947646,
+     -1.859502370967743, -2.4435074753634725},
+    {1.2259032733562873, 0.99325779543842763,
+     -1.6000622736285195, -2.1228174093579919},
+    {1.1782023823292767, 0.94555690441141671,
+     -2.0841893529453821, -2.5616738278883591},
+    {1.0807474330462354, 0.84810195512837538,
+     2.4222140661872928, 2.0139851173937431},
+    {1.1455125789466947, 0.91286710102883473,
+     2.6603189985587257, 2.2090299403929592},
+    {0.9606946646801835, 0.72804918676232333,
+     2.4157972214854695, 2.0655335190824831},
+    {1.0183733855555588, 0.78572790763769862,
+     2.6026447512224324, 2.2274115230522895},
+    {1.1223251436777242, 0.88967966575986424,
+     2.2026012326075821, 1.7679462820872878},
+    {1.2117137566552416, 0.97906827873738189,
+     2.4364268855668985, 1.9281331048062749},
+    {1.0042402259266749, 0.77159474800881489,
+     2.2382787786489993, 1.8696023684525358},
+    {1.0806249224579738, 0.84797944454011387,
+     3.0589514013539967, 2.6507945493516507},
+    {1.074527112171161, 0.84188163425330098,
+     -2.9901226178205151, 2.8884548377330006},
+    {0.961574316296125, 0.72892883837826483,
+     2.9303917862275934, 2.5797808284642878},
+    {0.96713291892479714, 0.73448744100693697,
+     -3.1412623235426165, 2.7890953209813394},
+    {1.1861966195638771, 0.95355114164601718,
+     2.9449102783992953, 2.4604692295528285},
+    {1.1931149070426321, 0.96046942912477218,
+     -3.0431183695299584, 2.7494142490424194},
+    {1.0608115719196465, 0.82816609400178653,
+     2.8220136398000761, 2.4251141102949232},
+    {1.0356880320434765, 0.80304255412561643,
+     -0.010637742943931661, -0.39433538807268886},
+    {0.93537165133165134, 0.70272617341379118,
+     0.10811731774776551, -0.23254739317098411},
+    {0.99591860295337631, 0.76327312503551614,
+     -0.22596964471202682, -0.59092515247485089},
+    {0.90694349498945948, 0.67429801707159931,
+     -0.083312240926633918, -0.41405446564199244},
+    {1.1521073706067628, 0.91946189268890288,
+     0.083950638424163421, -0.37235018695935818},
+    {1.0527409974470934, 0.82009551952923332,
+     0.20000628894873562, -0.19252724222020762},
+    {1.1223461583287817, 0.88970068041092176,
+     -0.16129485873746907, -0.59596422496860524},
+    {0.99177564752278324, 0.75913016960492308,
+     -0.59701663088346801, -0.96015684939909118},
+    {0.93490395917771996, 0.70225848125985979,
+     -0.42780034550128876, -0.76829475202492392},
+    {0.90272434770447008, 0.67007886978660991,
+     -0.76465822819453211, -1.0939992597685002},
+    {0.85831417099960328, 0.62566869308174311,
+     -0.60395671464438216, -0.91956899189768293},
+    {1.1250445239534348, 0.89239904603557485,
+     -0.58359222183771875, -1.0201222076879959},
+    {1.0671311643358699, 0.8344856864180098,
+     -0.39477907449843586, -0.79518413848532754},
+    {1.0305352743986249, 0.79788979648076486,
+     -0.790389294670933, -1.1715163443084771},
+    {0.9907885706141446, 0.75814309269628444,
+     -2.3228164091484826, -2.6855277039555121},
+    {0.97357593505393702, 0.74093045713607686,
+     -2.1739322224605528, -2.5293784562822168},
+    {0.93723238279627263, 0.70458690487841247,
+     -2.4617019200700043, -2.8030466247861416},
+    {0.89232782391049503, 0.65968234599263487,
+     -2.3133013915107057, -2.6392644101659437},
+    {1.0807999949001184, 0.8481545169822583,
+     -2.2270563373012662, -2.6353162281371336},
+    {0.97357593505393702, 0.74093045713607686,
+     -2.1739322224605528, -2.5293784562822168},
+    {1.0549443277434642, 0.82229884982560419,
+     -2.4324623080455523, -2.8261756895909564},
+    {0.96731647947434574, 0.73467100155648557,
+     0.4958991538395171, 0.14299762481269895},
+    {0.96063304680600192, 0.72798756888814176,
+     0.69847696042062957, 0.34823754664554274},
+    {0.8502474894763794, 0.61760201155851924,
+     0.38311304893060499, 0.069807483278225391},
+    {0.85286918541935042, 0.62022370750149025,
+     0.57119525572526686, 0.25714594872736918},
+    {1.0669499195556316, 0.83430444163777162,
+     0.40914585977452489, 0.0088424194824452962},
+    {1.0713018326131327, 0.83865635469527278,
+     0.63217997452344565, 0.2294184145265615},
+    {0.95381300967507099, 0.72116753175721082,
+     0.29453063004813718, -0.053049227174756089},
+    {0.91990538867792004, 0.68725991076005988,
+     1.4159775111582389, 1.0808173280765534},
+    {0.97603355472712283, 0.74338807680926267,
+     1.6227676780770526, 1.2663084329128875},
+    {0.77668653437488488, 0.54404105645702472,
+     1.3865520112966452, 1.0919779781473744},
+    {0.83527551009645162, 0.60263003217859146,
+     1.5631072810002449, 1.2539421474647119},
+    {0.98942415520771854, 0.75677867728985837,
+     1.2416004636568698, 0.8794798153286767},
+    {1.0630679164874448, 0.83042243856958486,
+     1.4598119490907151, 1.0616696961928831},
+    {0.84685782871196158, 0.61421235079410141,
+     1.2329614297173042, 0.92060908805958408},
+    {0.91576478010490192, 0.68311930218704175,
+     -2.753833724936892, -3.087563734755931},
+    {0.95081780416602235, 0.71817232624816219,
+     -2.9365849779462052, 3.0001706985358854},
+    {0.99553604958053388, 0.76289057166267371,
+     -2.6021589967601844, -2.9669458609081834},
+    {1.044024682372513, 0.81137920445465306,
+     -2.7784779438761995, 3.1167544809628995},
+    {0.78412903082794527, 0.55148355291008511,
+     -2.7323179768861405, -3.0286129324936701},
+    {0.81960763604537135, 0.58696215812751118,
+     -2.892631203392829, 3.0855340364298818},
+    {0.86830871160025436, 0.63566323368239419,
+     -2.5998157518031375, -2.9183625673773497},
+    {0.90147485091298873, 0.66882937299512857,
+     1.9359859976162961, 1.6070565311323624},
+    {0.9083173140497417, 0.67567183613188153,
+     2.1084139804778923, 1.7772116536049396},
+    {0.77672833944587505, 0.54408286152801488,
+     1.8499555464935911, 1.5553719481056369},
+    {0.79549717534180486, 0.5628516974239447,
+     2.0094314798614157, 1.71043649113097},
+    {1.0099246970710662, 0.77727921915320608,
+     1.8391064973231128, 1.4678295300900326},
+    {1.0210473062075727, 0.78840182828971261,
+     2.0462637895146218, 1.6697551906325181},
+    {0.87759918637411216, 0.644953708456252,
+     1.7503152567527833, 1.4289622154958808},
+    {0.87419383012951535, 0.64154835221165518,
+     -1.5402233238627663, -1.8605388296223466},
+    {0.78502237235773542, 0.55237689443987525,
+     -1.4179638464008488, -1.7144678278963301},
+    {0.8242313160071103, 0.59158583808925014,
+     -1.7146524014592381, -2.0208762909383542},
+    {0.74316175482952695, 0.51051627691166679,
+     -1.5799841037149589, -1.8672412621210861},
+    {1.0048797595600378, 0.77223428164217767,
+     -1.4860562806496147, -1.8550228531954533},
+    {0.90893577071044407, 0.6762902927925839,
+     -1.3533790638998828, -1.6847891389409548},
+    {0.95279632636795386, 0.72015084845009369,
+     -1.6840630504457823, -2.0312512736809483},
+    {0.81675332876324025, 0.58410785084538008,
+     -2.0253430791239078, -2.3296279499447152},
+    {0.85867647663858382, 0.62603099872072365,
+     -2.1706817978171773, -2.4863989590187265},
+    {0.89125426196023483, 0.65860878404237466,
+     -1.8624062115595008, -2.1880263507518003},
+    {0.94111846610281435, 0.70847298818495419,
+     -2.0179587420896836, -2.3607362263967491},
+    {0.68304452098669599, 0.45039904306883594,
+     -2.0293570499167428, -2.3051126468103931},
+    {0.73381173610892558, 0.50116625819106542,
+     -2.1657539087544424, -2.4510912424090523},
+    {0.75901297670885759, 0.52636749879099742,
+     -1.8800825204675906, -2.1707127157234343},
+    {0.81432493970692732, 0.58167946178906715,
+     -1.0724988840095522, -1.3761629920722815},
+    {0.7084344265881779, 0.47578894867031774,
+     -1.0111474059878942, -1.2915228950183781},
+    {0.80767380248939702, 0.57502832457153685,
+     -1.2488986799143977, -1.5508845500309332},
+    {0.70812255299436722, 0.47547707507650705,
+     -1.1659653790815465, -1.4462820791783328},
+    {0.92402415408483562, 0.69137867616697546,
+     -0.95044856804583866, -1.2870493426053571},
+    {0.80605091624393088, 0.57340543832607072,
+     -0.90135316596693393, -1.2029343745825709},
+    {0.9265556452882362, 0.69391016737037603,
+     -1.1517454134295191, -1.4892406208650995},
+    {0.80820867497501347, 0.57556319705715331,
+     0.92273535503532877, 0.62061570366243846},
+    {0.90135083627190771, 0.66870535835404754,
+     1.0632601856495458, 0.73437148358428583},
+    {0.67833580143052807, 0.44569032351266802,
+     0.95458974730218604, 0.67965491655830612},
+    {0.76465369847744391, 0.53200822055958374,
+     1.0793524472484033, 0.78748494234455413},
+    {0.83806297196118396, 0.60541749404332379,
+     0.75479147514172185, 0.44486904141604555},
+    {0.93682167340281963, 0.70417619548495947,
+     0.88586266165826577, 0.5446683833672451},
+    {0.70829081264835048, 0.47564533473049031,
+     0.80355409917299192, 0.52320568817077406},
+    {0.80655948716224435, 0.57391400924438418,
+     2.6577707004083013, 2.3560628834595514},
+    {0.76973399257807995, 0.53708851466021978,
+     2.5062735982713402, 2.2132746522912434},
+    {0.93600794643691598, 0.70336246851905582,
+     2.7299599556733405, 2.3890631521017962},
+    {0.89613251223674095, 0.66348703431888079,
+     2.5534720934892783, 2.2262850337780642},
+    {0.70390967058800591, 0.47126419267014574,
+     2.7540511137192039, 2.4745234842129382},
+    {0.67834936734922346, 0.44570388943136341,
+     2.6027253695569428, 2.3277881899340489},
+    {0.83395479375730408, 0.60130931583944391,
+     2.8311365719751831, 2.5223281247447624},
+    {0.79874647708170488, 0.56610099916384471,
+     2.28442915523339, 1.9846462093791926},
+    {0.84858025094102274, 0.61593477302316257,
+     2.4054699675566136, 2.0926344298169992},
+    {0.70534081091966205, 0.47269533300180189,
+     2.2291260139134157, 1.9493313880715157},
+    {0.73195478675929693, 0.49930930884143676,
+     2.3709274260450179, 2.0859653706845265},
+    {0.89580060322103205, 0.66315512530317189,
+     2.2642757053595126, 1.9371959817106847},
+    {0.84858025094102274, 0.61593477302316257,
+     2.4054699675566136, 2.0926344298169992},
+    {0.80183158126798848, 0.56918610335012831,
+     2.1554820097484804, 1.8549441274246403},
+    {0.72225206053028068, 0.48960658261242052,
+     3.095439795113216, 2.8124068645116074},
+    {0.71964434710011715, 0.48699886918225699,
+     2.9208669698533116, 2.638343548255075},
+    {0.84180636376723783, 0.60916088584937766,
+     -3.072964964858274, 2.8992712321373828},
+    {0.84676073453089407, 0.6141152566130339,
+     3.0193271218027604, 2.7070019462446071},
+    {0.59450765285287233, 0.36186217493501244,
+     -3.1221283197037355, 2.8990191528085258},
+    {0.59867804777778821, 0.36603256985992833,
+     3.0001204814929125, 2.7375127274816129},
+    {0.71068874739486032, 0.47804326947700015,
+     -3.015615840711817, 2.9867674849328543},
+    {0.71651433449711699, 0.48386885657925682,
+     -0.30964550625484066, -0.59156231268467085},
+    {0.62891168115241025, 0.3962662032345502,
+     -0.18334012699040261, -0.45029529080618924},
+    {0.65175642887382323, 0.41911095095596318,
+     -0.46718496312254426, -0.73768804042417746},
+    {0.57375307669560416, 0.3411075987777441,
+     -0.33637585883632015, -0.5956803441295615},
+    {0.85914052037072974, 0.62649504245286958,
+     -0.2738899352367109, -0.58974159501871348},
+    {0.76960498636608288, 0.53695950844822271,
+     -0.13956515490897675, -0.43253516747174853},
+    {0.79475737913803979, 0.56211190122017962,
+     -0.45106341212297485, -0.74988001885926725},
+    {0.70814208829453995, 0.47549661037667978,
+     -2.4355967641106369, -2.7159171451350175},
+    {0.65793216765867801, 0.42528668974081796,
+     -2.2914354709166282, -2.5629384225923504},
+    {0.62251143221536109, 0.38986595429750104,
+     -2.5636233151438481, -2.8296258401792627},
+    {0.57815955514815098, 0.34551407723029093,
+     -2.4176260642255811, -2.6774967560590013},
+    {0.82655434946807693, 0.59390887155021677,
+     -2.4527794169020258, -2.7596142075870751},
+    {0.78108244070243482, 0.54843696278457466,
+     -2.3029100798924778, -2.5984961698658489},
+    {0.74688582111218038, 0.51424034319432022,
+     -2.5866145708644148, -2.8746506396955698},
+    {0.70469088393054846, 0.4720454060126883,
+     0.13050753675221388, -0.14916570324681366},
+    {0.72498950838546838, 0.49234403046760822,
+     0.29068412166308533, 0.0071122744700356372},
+    {0.57663988440192748, 0.34399440648406743,
+     0.071164554124224816, -0.18851002011534049},
+    {0.59736752779855029, 0.36472204988069024,
+     0.21516484754278828, -0.047263054107194516},
+    {0.80738713841789778, 0.57474166050003761,
+     0.034262045569010802, -0.267652208986627},
+    {0.83140755458718973, 0.59876207666932957,
+     0.20329292695593276, -0.10483142087917159},
+    {0.67320581181204808, 0.44056033389418803,
+     -0.025176035540845437, -0.2992291069833819},
+    {0.64019623709090479, 0.40755075917304473,
+     -0.73905018145871337, -1.0077286655979885},
+    {0.58074850176421933, 0.34810302384635933,
+     -0.60686183835540675, -0.86706870925025292},
+    {0.56221474605671595, 0.32956926813885595,
+     -0.84887886419442615, -1.1067359771233329},
+    {0.50889851418566434, 0.27625303626780434,
+     -0.72707912172093281, -0.9788799135877192},
+    {0.77365848970345663, 0.54101301178559646,
+     -0.75069842762130434, -1.0445826387504609},
+    {0.71956691451077104, 0.48692143659291087,
+     -0.60691681462503499, -0.88942516442266584},
+    {0.68782662644682513, 0.45518114852896507,
+     -0.87008225091201508, -1.146682732470909},
+    {0.61388650183021221, 0.38124102391235221,
+     1.6334452638959758, 1.3686987256727643},
+    {0.6529734290760123, 0.42032795115815225,
+     1.7850893968720376, 1.5143906821127855},
+    {0.48351623244142511, 0.25087075452356516,
+     1.5917237731135823, 1.3424621538831223},
+    {0.52542230057848527, 0.29277682266062538,
+     1.7372674894720133, 1.4836972354883291},
+    {0.69683740785163373, 0.46419192993377367,
+     1.5200869142968518, 1.2418629169890425},
+    {0.74369843521852785, 0.51105295730066769,
+     1.6839326971697259, 1.3965637944295493},
+    {0.56595077159675289, 0.333305293678893,
+     1.4884094200587255, 1.230089193359468},
+    {0.60803816715770376, 0.37539268923984387,
+     0.53394457373560045, 0.27003183208701342},
+    {0.59725770827310209, 0.36461223035524221,
+     0.69495861393781566, 0.43254575198803491},
+    {0.48526433292640503, 0.25261885500854508,
+     0.44513169252264123, 0.19570197927193939},
+    {0.48024532998136726, 0.24759985206350732,
+     0.59799615857691646, 0.34904641402317865},
+    {0.73338967629032381, 0.50074419837246364,
+     0.46262808723680277, 0.17737622250167678},
+    {0.72765594899073827, 0.4950104710728781,
+     0.63697926077140199, 0.35287844861662748},
+    {0.60785792224479596, 0.37521244432693607,
+     0.37125088084891411, 0.10736361007054016},
+    {0.58419495435039825, 0.3515494764325382,
+     2.0356613002748682, 1.7750028345400828},
+    {0.55957456680486262, 0.32692908888700256,
+     1.8874309893009114, 1.6298979855233628},
+    {0.69865771065368321, 0.46601223273582315,
+     2.0894829589920256, 1.8109259187477209},
+    {0.68151723172483714, 0.44887175380697708,
+     1.9394701237095517, 1.6639819510942544},
+    {0.48110056657085476, 0.24845508865299482,
+     2.1251655700748593, 1.8761346128179828},
+    {0.45813092076464301, 0.22548544284678307,
+     1.9852936396046508, 1.7383632692414601},
+    {0.59917667006780695, 0.36653119214994706,
+     2.1758839494570554, 1.9132075825335959},
+    {0.57505859832673001, 0.34241312040887012,
+     1.2284951041240648, 0.96902364942687202},
+    {0.6390946540823419, 0.40644917616448184,
+     1.3664897803572287, 1.0979820123681954},
+    {0.45441600382808101, 0.22177052591022106,
+     1.2298360901070426, 0.98322994822715815},
+    {0.51156766262149367, 0.27892218470363372,
+     1.3526991776553914, 1.1006188860248505},
+    {0.63261032464265665, 0.3999648467247966,
+     1.094275824993078, 0.82676201380780445},
+    {0.70703634371824386, 0.4743908658003837,
+     1.2291583800065859, 0.94904602811779382},
+    {0.50949152275597509, 0.27684604483811509,
+     1.1082196513903104, 0.8563569712352701},
+    {0.5608430718755546, 0.3281975939576946,
+     -1.3574675421441604, -1.6151559420287271},
+    {0.65335591809872096, 0.4207104401808609,
+     -1.4608718672234118, -1.7316322098775201},
+    {0.59506052762800865, 0.3624150497101486,
+     -1.2257657670379263, -1.4878787524136616},
+    {0.69005613782954267, 0.45741065991168262,
+     -1.3138450704811886, -1.5908433952821497},
+    {0.42888117308483897, 0.19623569516697903,
+     -1.3945867655320723, -1.639077840552186},
+    {0.51623252138361164, 0.2835870434657517,
+     -1.4965348177012685, -1.7491094102994911},
+    {0.47087570332712192, 0.23823022540926198,
+     -1.2685545046918734, -1.5166298259159039},
+    {0.55788401343878569, 0.32523853552092569,
+     -2.8230079904220418, -3.0803348300197184},
+    {0.52763702943927659, 0.29499155152141665,
+     -2.6833364495763008, -2.9371510437580768},
+    {0.45595484004692227, 0.22330936212906233,
+     -2.9240454525312938, 3.112399923510301},
+    {0.42841661964340144, 0.1957711417255415,
+     -2.7923966699144791, -3.0368510736214813},
+    {0.68675175064862937, 0.45410627273076931,
+     -2.8553597003383664, -3.1317692750397215},
+    {0.65591911162187067, 0.42327363370401061,
+     -2.7108245685987291, -2.9819996515198155},
+    {0.58020798587203493, 0.34756250795417487,
+     -2.9665780206877308, 3.0564708183622322},
+    {0.54369325728790963, 0.31104777937004974,
+     -1.7610572681426342, -2.0166951325299367},
+    {0.61885526924505219, 0.38620979132719213,
+     -1.8928211291204953, -2.1582873692163309},
+    {0.60405646065433682, 0.37141098273647694,
+     -1.6121720497739356, -1.8755252595898624},
+    {0.68681373802125489, 0.45416826010339484,
+     -1.7408504381210985, -2.0172710064573494},
+    {0.40054091254196822, 0.16789543462410828,
+     -1.7762979838625412, -2.0186670226739412},
+    {0.47584530409887332, 0.24319982618101338,
+     -1.9014230879420246, -2.1499587147708898},
+    {0.46197021452132803, 0.22932473660346808,
+     -1.6379845459473898, -1.8852544877519875},
+    {0.53614062901095361, 0.30349515109309361,
+     2.4001504498434847, 2.1453816610877854},
+    {0.56010334086632985, 0.32745786294846985,
+     2.5478412368140995, 2.2902435296116477},
+    {0.41037644996496536, 0.17773097204710542,
+     2.3450094672527211, 2.1019302611460997},
+    {0.43705718060458371, 0.20441170268672376,
+     2.4893469317580701, 2.2441999716528924},
+    {0.62358751645790389, 0.39094203854004383,
+     2.3125263683453516, 2.0463649122132903},
+    {0.65227164144556271, 0.41962616352770266,
+     2.4591444788188195, 2.188558662560335},
+    {0.5050375516940554, 0.27239207377619545,
+     2.2582776709434071, 2.0068769199719281},
+    {0.53027862668373971, 0.29763314876587976,
+     -1.0446259911930111, -1.2987342680423959},
+    {0.49047692340452248, 0.25783144548666254,
+     -0.94704200048830001, -1.1969788365313805},
+    {0.50446341991006549, 0.27181794199220555,
+     -1.1512452635670409, -1.4025869560826103},
+    {0.43029083482307157, 0.19764535690521162,
+     -1.0572170959471814, -1.3018198386530146},
+    {0.60576078345035866, 0.37311530553249878,
+     -0.96651442192858428, -1.2301063305935607},
+    {0.49047692340452248, 0.25783144548666254,
+     -0.94704200048830001, -1.1969788365313805},
+    {0.61487409399968862, 0.38222861608182856,
+     -1.0992018881266801, -1.364090642927974},
+    {0.47080410260625327, 0.23815862468839333,
+     2.7781723006482317, 2.5301035541863244},
+    {0.45750162230021613, 0.22485614438235618,
+     2.6357682649642915, 2.388893117890778},
+    {0.59240664494839501, 0.35976116703053496,
+     2.8418660799818913, 2.5801127076358878},
+    {0.57728065731221623, 0.34463517939435634,
+     2.6935978127635858, 2.4338406543034452},
+    {0.36187119709540294, 0.12922571917754294,
+     2.8575265719785867, 2.6176868984898252},
+    {0.3482408643335812, 0.11559538641572119,
+     2.7217458510333752, 2.4827004867924569},
+    {0.47751515025653246, 0.24486967233867252,
+     2.9213419741570883, 2.6726499153665584},
+    {0.46788533579495956, 0.23523985787709961,
+     -2.1512586319959186, -2.3990607386258183},
+    {0.52535850813905394, 0.29271303022119394,
+     -2.2787358298798446, -2.5322990713477593},
+    {0.54411402654383356, 0.31146854862597367,
+     -2.0304463873865934, -2.2861332732489119},
+    {0.60210018908392937, 0.36945471116606932,
+     -2.1592276849395784, -2.4223083826185885},
+    {0.3335991551574074, 0.10095367723954739,
+     -2.1419012474494634, -2.3801483444866296},
+    {0.38748866783404134, 0.1548431899161814,
+     -2.2647690077407794, -2.5062379412322211},
+    {0.40515694967009519, 0.17251147175223525,
+     -2.0290676886105583, -2.2717665837465404},
+    {0.4495703332101737, 0.21692485529231376,
+     0.8847358700837975, 0.63854627040778422},
+    {0.4277361452326191, 0.19509066731475916,
+     1.0091731253853735, 0.76477232249452354},
+    {0.34474035617206134, 0.11209487825420139,
+     0.79253390892842801, 0.55368453922552363},
+    {0.33051539723390549, 0.097869919316045551,
+     0.91909832403712577, 0.6810121777080711},
+    {0.5769514706040777, 0.3443059926862177,
+     0.84648110071374372, 0.58676638843930029},
+    {0.55000592166569451, 0.31736044374783451,
+     0.98319184394574077, 0.72681176947482218},
+    {0.46781333951014031, 0.23516786159228037,
+     0.74647654217367654, 0.49868097875117406},
+    {0.40784278537382301, 0.17519730745596307,
+     -0.11198827438672525, -0.35488189365762446},
+    {0.32937982242031222, 0.096734344502452274,
+     -0.019464052926668973, -0.25749155493808379},
+    {0.36008639833044109, 0.12744092041258109,
+     -0.2444879559210639, -0.48422078351280706},
+    {0.28625316062763406, 0.053607682709774104,
+     -0.14367392109135313, -0.37971926970224024},
+    {0.53823965068859758, 0.30559417277073769,
+     -0.073131989892875185, -0.32814025927713747},
+    {0.45003799886099138, 0.21739252094313144,
+     0.021772572473903296, -0.22445691523120839},
+    {0.49068888317465609, 0.25804340525679614,
+     -0.2175679977011982, -0.4675256423366565},
+    {0.37937110604492102, 0.14672562812706108,
+     -0.48496043183721438, -0.72589357291213308},
+    {0.30807100197102782, 0.075425524053167867,
+     -0.36927363293028087, -0.6062625103858803},
+    {0.31829838448055148, 0.085652906562691519,
+     -0.60924560683569884, -0.84671839229695012},
+    {0.24713561752292407, 0.014490139605064109,
+     -0.48937322825101753, -0.72402351378619589},
+    {0.51160615857205372, 0.27896068065419372,
+     -0.47801900327622426, -0.7301033436905241},
+    {0.43655379314271203, 0.20390831522485209,
+     -0.35635883369239135, -0.60146483634560688},
+    {0.44706543286157158, 0.21441995494371163,
+     -0.60458171649480008, -0.85055880378430404},
+    {0.36294251785058756, 0.13029703993272762,
+     0.23093381399798307, -0.0089704063640257403},
+    {0.3654157362988783, 0.13277025838101836,
+     0.36917768502042975, 0.12912326821038794},
+    {0.2529576459468374, 0.020312168028977437,
+     0.17734397843796018, -0.057490162038042615},
+    {0.25331659349316427, 0.020671115575304308,
+     0.30437500542535967, 0.069529259650194644},
+    {0.47306908106056184, 0.24042360314270189,
+     0.15334469623997418, -0.094932818742291591},
+    {0.48252974809802379, 0.24988427018016385,
+     0.29482048666425542, 0.045653290010988917},
+    {0.35659265644386079, 0.12394717852600078,
+     0.10245960188541037, -0.13706655732768169},
+    {0.36118211591976707, 0.12853663800190707,
+     3.1319536954756675, 2.8921553752307334},
+    {0.36478202177176866, 0.13213654385390872,
+     2.99292413096178, 2.7529083569223602},
+    {0.46985034565221639, 0.23720486773435645,
+     -3.0651035142972263, 2.9701004710442729},
+    {0.47732691350181111, 0.24468143558395117,
+     3.0700948767306304, 2.8214204965762386},
+    {0.25417250936789487, 0.021527031450034914,
+     -3.0964512781664206, 2.9518604834719913},
+    {0.25869993956382031, 0.026054461645960314,
+     3.0572050633918644, 2.8221814940001591},
+    {0.35323081508058912, 0.12058533716272918,
+     -3.0151993109511754, 3.0286556111906475},
+    {0.34728438341431367, 0.11463890549645366,
+     -2.5156013223373357, -2.7545928101775523},
+    {0.29902677300260461, 0.066381295084744607,
+     -2.3788315922567538, -2.6154147617525343},
+    {0.25172111393587016, 0.019075636018010156,
+     -2.6264546884313442, -2.8612490903771204},
+    {0.20655462591417373, -0.02609085200368623,
+     -2.4904822205940231, -2.7240779977688163},
+    {0.48782984890214548, 0.25518437098428554,
+     -2.5399905893955217, -2.7896687914848237},
+    {0.44009448040087379, 0.20744900248301384,
+     -2.3987131632171468, -2.6441088604036236},
+    {0.39121201657569549, 0.15856653865783554,
+     -2.6552265878967205, -2.8969474117701752},
+    {0.31720621807402921, 0.084560740156169212,
+     -0.84993145455572883, -1.0873512849640616},
+    {0.37459344234727093, 0.14194796442941099,
+     -0.95757490886052554, -1.1982012150617229},
+    {0.38401347018947773, 0.15136799227161779,
+     -0.72742417389552272, -0.96866149245145894},
+    {0.44176977849450622, 0.20912430057664627,
+     -0.84081684837722248, -1.0863509287214428},
+    {0.18334089612953053, -0.049304581788329457,
+     -0.85721607352023454, -1.0903849868008737},
+    {0.2488930680154765, 0.016247590097616546,
+     -0.96651982095720457, -1.2012247368139521},
+    {0.25182946748441204, 0.019183989566552082,
+     -0.73462199105035397, -0.96941986027491356},
+    {0.30429823449509991, 0.071652756577239948,
+     1.4259257340533837, 1.1891086203977399},
+    {0.26201695624159582, 0.029371478323735864,
+     1.3102630162339626, 1.075126349582034},
+    {0.43687543042963528, 0.20422995251177534,
+     1.4562405145054096, 1.2111083510055338},
+    {0.3888274694421926, 0.15618199152433265,
+     1.3341563405387746, 1.092597281030701},
+    {0.21172683702332362, -0.020918640894536392,
+     1.5222220360482468, 1.2885137650655523},
+    {0.17396586193545466, -0.058679615982405321,
+     1.3996079623955877, 1.1665754396323229},
+    {0.34772773251411221, 0.11508225459625226,
+     1.5547444486369837, 1.315728018154976},
+    {0.29866331057338191, 0.066017832655521913,
+     1.1333271015355486, 0.8967598030782008},
+    {0.34214884636022647, 0.10950336844236645,
+     1.2266541727659692, 0.98794781257060627},
+    {0.20979483706690666, -0.022850640850953341,
+     1.0850087225295661, 0.85134321596946583},
+    {0.2264282023135234, -0.0062172756043366029,
+     1.2023628542688196, 0.96830001228510154},
+    {0.39786544458742373, 0.16521996666956379,
+     1.1212335113452161, 0.87905288810588189},
+    {0.34214884636022647, 0.10950336844236645,
+     1.2266541727659692, 0.98794781257060627},
+    {0.31476033858585223, 0.08211486066799227,
+     1.0329162357832942, 0.79561388492703233},
+    {0.28906806637454863, 0.056422588456688669,
+     1.7962270595954504, 1.5600667109654172},
+    {0.25085677798261619, 0.018211300064756228,
+     1.6556778763638471, 1.4209110305455432},
+    {0.42728116236728086, 0.19463568444942092,
+     1.8396498706255291, 1.5952848304115586},
+    {0.38969096331650432, 0.15704548539864438,
+     1.6941676243759831, 1.4525501703178447},
+    {0.18665197940510969, -0.045993498512750267,
+     1.8958921455965774, 1.6626701237567616},
+    {0.15060561092727326, -0.082039866990586713,
+     1.7570822144289191, 1.5242999536312114},
+    {0.32392967714899235, 0.091284199231132346,
+     1.9386640847083112, 1.7009133790423272},
+    {0.27310534551487525, 0.040459867597015253,
+     -1.1883154870852854, -1.4238498499864403},
+    {0.19332082556502245, -0.039324652352837511,
+     -1.0797732887873028, -1.3131101176877409},
+    {0.22284825371689981, -0.0097972242009601862,
+     -1.3143744005255893, -1.54834614241004},
+    {0.14141899169437261, -0.091226486223487377,
+     -1.2018854381749302, -1.4346041979323367},
+    {0.39343264825285412, 0.16078717033499418,
+     -1.1735885444262453, -1.4154614453542911},
+    {0.31768361520291627, 0.085038137285056312,
+     -1.0690405095733755, -1.3064834494291462},
+    {0.3496260387274871, 0.11698056080962715,
+     -1.2968943164227473, -1.5360181353956717},
+    {0.25100412833681168, 0.018358650418951683,
+     2.1628079882694471, 1.9280364575934064},
+    {0.27908383333063125, 0.04643835541277129,
+     2.2939777408569171, 2.0582163527780288},
+    {0.12237665891319545, -0.11026881900466455,
+     2.1207333401363262, 1.8880835989311664},
+    {0.14744766658975234, -0.085197811328107678,
+     2.2471161676791707, 2.0143579553095594},
+    {0.35356516406954697, 0.12091968615168695,
+     2.0773600711006077, 1.8380103509594088},
+    {0.3793998305113519, 0.14675435259349195,
+     2.2083649492774091, 1.9674299444316699},
+    {0.22067303138259003, -0.011972446535269951,
+     2.032733921703795, 1.7988160350103526},
+    {0.24687537717186603, 0.014229899254006029,
+     0.57415479305698103, 0.33951253333009479},
+    {0.24002953156053236, 0.0073840536426723613,
+     0.70994556349821791, 0.47550853369428903},
+    {0.13692770659868386, -0.095717771319176137,
+     0.49638797857983807, 0.26369310539612301},
+    {0.13007581635887788, -0.10256966155898213,
+     0.63537838258101964, 0.40271090081585614},
+    {0.36315996099829206, 0.13051448308043212,
+     0.51264025799870172, 0.27272289886585172},
+    {0.3560399429997107, 0.12339446508185069,
+     0.65562202953103921, 0.41612826510439166},
+    {0.25133738099126429, 0.018691903073404292,
+     0.43813005795856741, 0.20334791235436508},
+    {0.24653354449794623, 0.013888066580086275,
+     -1.5502913952575923, -1.7849231378479813},
+    {0.16891967633065302, -0.063725801587206976,
+     -1.4435770615780228, -1.6765447104709137},
+    {0.19111542543202759, -0.041530052485832372,
+     -1.6746912830117522, -1.9079889841680064},
+    {0.11412761794821938, -0.11851785996964062,
+     -1.5717052345136739, -1.8043512729403202},
+    {0.37888387901940185, 0.1462384011015419,
+     -1.5260107463770318, -1.7669123086697829},
+    {0.29995469228424232, 0.067309214366382361,
+     -1.4237891587067617, -1.660412998402816},
+    {0.32262939544265795, 0.089983917524797952,
+     -1.6584975141052625, -1.8961833200388778},
+    {0.20344626771488655, -0.029199210202973447,
+     -1.9091522157001195, -2.1426834436051139},
+    {0.2713670919966058, 0.038721614078745803,
+     -2.0257006607998829, -2.2611706762974517},
+    {0.2630260888834578, 0.03038061096559784,
+     -1.7875032307646888, -2.0226748399522223},
+    {0.33568758233397983, 0.10304210441611988,
+     -1.9066324130167578, -2.14498992308922},
+    {0.082591539603283456, -0.15005393831457653,
+     -1.9096241251743684, -2.1424020171588212},
+    {0.14686236967175159, -0.085783108246108408,
+     -2.0208257715487243, -2.2535797822610975},
+    {0.13557960235566405, -0.097065875562195952,
+     -1.7955153883514061, -2.028204008522847},
+    {0.19974398731483878, -0.03290149060302118,
+     -2.8566075882524133, -3.0900649222027958},
+    {0.15846929591615533, -0.07417618200170463,
+     -2.7292032367372161, -2.9620554955330083},
+    {0.11336616938875728, -0.11927930852910272,
+     -2.9416345546299039, 3.1089042578157389},
+    {0.071643173310699318, -0.1610023046071607,
+     -2.8227575721114677, -3.0556354541818473},
+    {0.33006542752211032, 0.097419949604250308,
+     -2.8898343702238858, -3.1278972386571668},
+    {0.29354614747602348, 0.060900669558163478,
+     -2.7611140489048642, -2.9974614379415661},
+    {0.23694313858981458, 0.0042976606719545701,
+     -2.9757713524862388, 3.0730657437762496},
+    {0.19538885750814283, -0.037256620409717167,
+     2.5248504216155343, 2.2914758588023165},
+    {0.21772698420281072, -0.014918493715049289,
+     2.6672972039292082, 2.4334504537819184},
+    {0.061208175269158352, -0.17143730264870161,
+     2.47409333506568, 2.241094065665199},
+    {0.084287843098997728, -0.14835763481886227,
+     2.6152490032025995, 2.3824840998052084},
+    {0.30583103395348116, 0.073185556035621199,
+     2.4342923405560524, 2.1974058794127544},
+    {0.32936388278943035, 0.096718404871570338,
+     2.5788380160226021, 2.3408113347892474},
+    {0.1714667334617147, -0.061178744456145288,
+     2.3829709110092452, 2.1499712631838062},
+    {0.1564807075070565, -0.076164770410803509,
+     0.024867265449892567, -0.20796592791174615},
+    {0.15293813468992074, -0.079707343227939265,
+     0.12511821208212509, -0.10768330540905986},
+    {0.10021862466500529, -0.13242685325285469,
+     -0.058208741985641077, -0.29088439059332027},
+    {0.060148001733880532, -0.17249747618397943,
+     0.052738552634367233, -0.18027447670054625},
+    {0.25069992474348679, 0.018054446825626791,
+     0.060237553987526705, -0.17452431064447566},
+    {0.15293813468992074, -0.079707343227939265,
+     0.12511821208212509, -0.10768330540905986},
+    {0.21789346803781595, -0.014752009880044034,
+     -0.054080205869613748, -0.28793092075242394},
+    {0.12961743755447913, -0.10302804036338087,
+     2.8838354960727015, 2.6511694567115489},
+    {0.14961658084817858, -0.083028897069681418,
+     3.0031126317189156, 2.7703381528015094},
+    {0.0036000729352494293, -0.22904540498261056,
+     2.8361426623937138, 2.6020112753936804},
+    {0.029355479043720614, -0.2032899988741394,
+     2.9584251992229822, 2.7248971559481356},
+    {0.23726516306360973, 0.0046196851457497717,
+     2.8047249518135882, 2.5703675812611593},
+    {0.25336138661630681, 0.020715908698446847,
+     2.9326389872506113, 2.6977917910441334},
+    {0.1075282161152068, -0.1251172618026532,
+     2.7534432868907355, 2.5207888118598096},
+    {0.11666100279713969, -0.11598447512072031,
+     -2.2334657388547638, -2.4661112300825545},
+    {0.0764149745449859, -0.15623050337287409,
+     -2.1193863100019259, -2.3522171699808228},
+    {0.030116022783706065, -0.20252945513415394,
+     -2.3367289712939154, -2.5702415979616831},
+    {-0.0069747990938017063, -0.23962027701166172,
+     -2.2165956057097724, -2.4510207258573167},
+    {0.24952313885666078, 0.016877660938800776,
+     -2.2496142775195391, -2.4843389618864871},
+    {0.20166624146587664, -0.030979236451983361,
+     -2.131194235667405, -2.3646895306501423},
+    {0.16067503034744629, -0.071970447570413695,
+     -2.3580943192413089, -2.5909688063148431},
+    {0.11598447512072048, -0.11666100279713952,
+     0.90812691473502904, 0.67548142350723861},
+    {0.12295869853675463, -0.10968677938110537,
+     0.77434742291471914, 0.54169682251944651},
+    {0.2207806851683819, -0.011864792749478117,
+     0.96907053983764979, 0.73515001441504224},
+    {0.23111090611548779, -0.0015345718023721672,
+     0.84303222693556634, 0.60884558290569757},
+    {-0.0012252318878146901, -0.23387070980567465,
+     0.97601118160671763, 0.74174910532415717},
+    {0.0013298256039296352, -0.23131565231393036,
+     0.84285943014187592, 0.60866725281282186},
+    {0.10949744231923174, -0.12314803559862826,
+     1.0326208303683597, 0.79996993348841738},
+    {0.10302804036338074, -0.12961743755447924,
+     -0.25775715751709216, -0.49042319687824387},
+    {0.17410824666156199, -0.058537231256297992,
+     -0.37117516912284065, -0.60420960899973408},
+    {0.16541001026070901, -0.067235467657150952,
+     -0.15408353726358942, -0.38700958350320286},
+    {0.23558602353356656, 0.0029405456157065579,
+     -0.25823756611341286, -0.49254745017498047},
+    {-0.031933943189042135, -0.26457942110690214,
+     -0.25514624493066873, -0.49037212881208658},
+    {0.034956187647612005, -0.19768929027024795,
+     -0.37090611540678575, -0.60432383997951267},
+    {0.037019414067157586, -0.19562606385070241,
+     -0.15151926827297577, -0.38489822381443778},
+    {0.076164770410803495, -0.1564807075070565,
+     -3.1167253881399004, 2.9336267256780468},
+    {0.053805440638931654, -0.17884003727892833,
+     3.0687323800118449, 2.8356315232788232},
+    {0.15188391181328875, -0.08076156610457122,
+     -3.0510201141379865, 2.9993725361854304},
+    {0.16209758614787434, -0.070547891769985646,
+     3.114831838338048, 2.8819424121474762},
+    {-0.023709412609161651, -0.25635489052702165,
+     -3.124443415774107, 2.9237966541877682},
+    {0.053805440638931654, -0.17884003727892833,
+     3.0687323800118449, 2.8356315232788232},
+    {0.037251450305960943, -0.19539402761189906,
+     -3.0238888535267248, 3.025921795238331},
+    {0.037256620409717167, -0.19538885750814283,
+     -0.6167422319742587, -0.8501167947874767},
+    {0.11173029976979026, -0.12091517814806974,
+     -0.73976161072890378, -0.97240954197278184},
+    {0.1069838519485564, -0.12566162596930358,
+     -0.49167127423485896, -0.72432689758704449},
+    {0.18060913475778995, -0.052036343160070039,
+     -0.61411141882674647, -0.84723845766219275},
+    {-0.10609528268412471, -0.33874076060198466,
+     -0.61698732924976829, -0.85550831538427485},
+    {-0.031219830636187329, -0.26386530855404733,
+     -0.74263907329643142, -0.97783993191432406},
+    {-0.036020023278747912, -0.26866550119660787,
+     -0.49164442658401258, -0.72701591427719359},
+    {0.032901490603021111, -0.19974398731483889,
+     0.28498506533737999, 0.051527731386997053},
+    {0.043587439446540158, -0.18905803847131986,
+     0.164137199121556, -0.069125034852517697},
+    {0.14315003561156858, -0.089495442306291403,
+     0.36254904729991316, 0.12981982634708727},
+    {0.14851136896488981, -0.08413410895297016,
+     0.23796924967465921, 0.0052031967947475666},
+    {-0.091123795508447014, -0.32376927342630701,
+     0.33833657244048343, 0.10059389650628776},
+    {-0.074887550515864806, -0.30753302843372476,
+     0.20879736493556583, -0.028166798601912194},
+    {0.022601841219910865, -0.21004363669794912,
+     0.41745171368933842, 0.18378074980453363},
+    {0.029199210202973433, -0.20344626771488655,
+     1.2324404378896734, 0.99890920998467925},
+    {0.05379611974563836, -0.17884935817222164,
+     1.3653099295989746, 1.132208936846661},
+    {-0.094448026580278566, -0.32709350449813851,
+     1.1824674188815092, 0.94455697097950631},
+    {-0.07054707172556883, -0.30319254964342879,
+     1.3217429862938044, 1.084975525961775},
+    {0.12094828676258193, -0.11169719115527807,
+     1.1532403027405109, 0.92059233599491175},
+    {0.14447327132137577, -0.088172206596484212,
+     1.2795436259547159, 1.0468059373481142},
+    {0.0065365849890193367, -0.22610889292884062,
+     1.1014498739763459, 0.86739528229880203},
+    {-0.013888066580086109, -0.24653354449794607,
+     1.591301258332201, 1.356669515741812},
+    {-0.043114864285404841, -0.27576034220326484,
+     1.4596766223129138, 1.2240425329798728},
+    {0.11463783076934227, -0.11800764714851773,
+     1.6215245657346642, 1.3888787575859747},
+    {0.080718497754966867, -0.15192698016289313,
+     1.4937525091976891, 1.2609594954385424},
+    {-0.10726339853406845, -0.33990887645192847,
+     1.6923184927410002, 1.4537343144948549},
+    {-0.14228420186232626, -0.37492967978018621,
+     1.562018904482676, 1.3213712093675918},
+    {0.017565609143402661, -0.21507986877445734,
+     1.7219604361401921, 1.4881758373217555},
+    {-0.014229899254005973, -0.24687537717186597,
+     -2.5674378605328125, -2.8020801202596988},
+    {0.028383467814272187, -0.2042620101035878,
+     -2.6968290164443283, -2.93037696251309},
+    {0.071319043996158307, -0.16132643392170165,
+     -2.4647979527307342, -2.6976792218567853},
+    {0.11488159586585581, -0.11776388205200419,
+     -2.5971193996560182, -2.8297651191640179},
+    {-0.14323152688909696, -0.3758770048069569,
+     -2.5347273455794328, -2.7754354692633356},
+    {-0.098365598357175607, -0.33101107627503562,
+     -2.6715571931970294, -2.9096690431450898},
+    {-0.054679809789576303, -0.28732528770743626,
+     -2.4364607905725619, -2.6725497060465817},
+    {-0.018358650418951503, -0.25100412833681146,
+     -0.97878466532034558, -1.2135561959963868},
+    {0.059670405452037209, -0.17297507246582278,
+     -1.0890821280025209, -1.3221014421362525},
+    {0.044288243192315835, -0.18835723472554416,
+     -0.86243899376266975, -1.0956893744926599},
+    {0.11646800349817905, -0.11617747441968095,
+     -0.9736428137275368, -1.2062882941000144},
+    {-0.15317998968513252, -0.38582546760299247,
+     -0.98192884014582782, -1.2232865055223574},
+    {-0.079151971277829414, -0.31179744919568941,
+     -1.0966688118412196, -1.3338309052086406},
+    {-0.094762380273335875, -0.32740785819119589,
+     -0.86547200727414753, -1.1033984687844067},
+    {-0.040459867597015253, -0.27310534551487525,
+     1.9532771665045079, 1.7177428036033531},
+    {-0.074956900390241818, -0.30760237830810178,
+     1.8214968865976313, 1.5845295413423968},
+    {0.087603988573857372, -0.14504148934400263,
+     1.9913932315646272, 1.758651781553296},
+    {0.052001350720174491, -0.18064412719768547,
+     1.8569127580120999, 1.6237851938810077},
+    {-0.12372622372987484, -0.35637170164773485,
+     2.0446429852989985, 1.8051297861770941},
+    {-0.15940920165829753, -0.39205467957615747,
+     1.91818844117706, 1.6764100715165529},
+    {-0.0039707654379946833, -0.23661624335585468,
+     2.081365093689683, 1.8470261553650618},
+    {-0.056422588456688669, -0.28906806637454863,
+     -1.3453655939943434, -1.5815259426243757},
+    {-0.14054764720522844, -0.37319312512308839,
+     -1.224297013941243, -1.464834575675628},
+    {-0.11166764759270341, -0.34431312551056342,
+     -1.4790657423660338, -1.7178914136087351},
+    {-0.19881932911848266, -0.4314648070363426,
+     -1.3583798626040338, -1.603076051751966},
+    {0.086022256697807137, -0.14662322122005284,
+     -1.3306310602994704, -1.5633833772311585},
+    {0.0018458465245023842, -0.23079963139335763,
+     -1.2139671161677035, -1.4481453672554416},
+    {0.030023136299697106, -0.20262234161816289,
+     -1.4620817853015997, -1.6955962874756216},
+    {-0.066017832655521913, -0.29866331057338191,
+     -2.0082655520542438, -2.2448328505115924},
+    {-0.039057864402113715, -0.27170334231997367,
+     -2.1067680241484936, -2.3422504288567945},
+    {-0.029525353290780473, -0.26217083120864043,
+     -1.9143221494716107, -2.1494641281021245},
+    {0.034112371030742897, -0.19853310688711712,
+     -2.0148876705051726, -2.2483215408521739},
+    {-0.14966547898173399, -0.38231095689959393,
+     -2.0626893519406613, -2.3038144255931989},
+    {-0.039057864402113715, -0.27170334231997367,
+     -2.1067680241484936, -2.3422504288567945},
+    {-0.14363339944879527, -0.37627887736665522,
+     -1.9411204598996261, -2.1818542929274614},
+    {-0.07165275657723974, -0.30429823449509974,
+     -1.7156669195364096, -1.9524840331920534},
+    {-0.1608741190051759, -0.39351959692303584,
+     -1.6104007929685251, -1.8522796766264402},
+    {-0.11322236070991414, -0.34586783862777415,
+     -1.8306307688292534, -2.069542911948083},
+    {-0.20224016334828815, -0.43488564126614809,
+     -1.7351705562503339, -1.9801413732205035},
+    {0.061402252276789929, -0.17124322564107008,
+     -1.6947450382241871, -1.9277418172431737},
+    {-0.023405577387360474, -0.25605105530522043,
+     -1.591795223919301, -1.8267304104125131},
+    {0.013072704625632314, -0.21957277329222769,
+     -1.8095793010662502, -2.0434703778782857},
+    {-0.084560740156169101, -0.3172062180740291,
+     2.2916611990340643, 2.054241368625731},
+    {-0.067542029195532136, -0.30018750711339209,
+     2.4266485167597871, 2.1900144387450196},
+    {-0.1977078116371927, -0.43035328955505264,
+     2.2513101257984047, 2.0067024220756249},
+    {-0.1864581491688948, -0.41910362708675475,
+     2.3824217657331399, 2.138689130965826},
+    {0.020657418010043296, -0.21198805990781672,
+     2.2042959965936242, 1.9705818753397026},
+    {0.039651940809579081, -0.19299353710828093,
+     2.335464595135722, 2.1021336454626907},
+    {-0.097168506024070775, -0.32981398394193079,
+     2.1652414519428271, 1.9271915682510155},
+    {-0.11463890549645366, -0.34728438341431367,
+     0.62599133125245754, 0.38699984341224047},
+    {-0.10484627796057704, -0.33749175587843705,
+     0.47893639623173301, 0.24048258122526125},
+    {0.0062361667558684247, -0.22640931116199159,
+     0.70182930507105024, 0.46776695187670619},
+    {0.013471656635335519, -0.21917382128252449,
+     0.55809689993791778, 0.32421547289328295},
+    {-0.24173924516571849, -0.47438472308357843,
+     0.70009700340639625, 0.45169747567958374},
+    {-0.23406848508303935, -0.46671396300089929,
+     0.54746988096498517, 0.29977402935401981},
+    {-0.11961960134570808, -0.35226507926356809,
+     0.77342803750819034, 0.53415333239002893},
+    {-0.12853663800190707, -0.36118211591976707,
+     -0.009638958114125698, -0.24943727835905954},
+    {-0.16778662187967497, -0.40043209979753491,
+     0.12544733007214676, -0.11691400620381807},
+    {-0.2121831553407883, -0.44482863325864824,
+     -0.11577927520842608, -0.36156820766686087},
+    {-0.25743793692696015, -0.4900834148448201,
+     0.026444156208543332, -0.22345408711907944},
+    {-0.010545596268694113, -0.24319107418655411,
+     -0.038901545191437334, -0.27343194358145956},
+    {-0.048267433021669789, -0.28091291093952975,
+     0.085820439298469747, -0.15001217783808812},
+    {-0.085969539239541912, -0.31861501715740187,
+     -0.13955829284378965, -0.37704648802790375},
+    {-0.13029703993272779, -0.36294251785058773,
+     -2.9106588395918105, 3.132622247225767},
+    {-0.078748078999544724, -0.31139355691740472,
+     -3.0240869608320815, 3.021955198428905},
+    {-0.051626326065834782, -0.28427180398369478,
+     -2.8005243312701027, -3.0364899215396943},
+    {-0.0057364192603931441, -0.23838189717825314,
+     -2.9184592550160984, 3.1303367234606938},
+    {-0.26414673125326193, -0.49679220917112188,
+     -2.8995383945707718, 3.1330837633973698},
+    {-0.20456438749481992, -0.43720986541267987,
+     -3.0224505435467077, 3.0155753655453021},
+    {-0.18318683628576687, -0.41583231420362682,
+     -2.7829765177858032, -3.0264616354785963},
+    {-0.14672562812706114, -0.37937110604492108,
+     2.6566322217525786, 2.4156990806776597},
+    {-0.16933439766850705, -0.401979875586367,
+     2.5191583718457391, 2.2766871568956093},
+    {-0.022186319096874005, -0.25483179701473396,
+     2.7040175668265718, 2.46912248609231},
+    {-0.046409165806451255, -0.27905464372431121,
+     2.5658472881791328, 2.3300870300775207},
+    {-0.24498225014933961, -0.47762772806719955,
+     2.7535708930163714, 2.504868255840083},
+    {-0.27058277095565275, -0.5032282488735127,
+     2.6078635239407983, 2.356648513527742},
+    {-0.11938678250227046, -0.35203226042013047,
+     2.7921975896813045, 2.5529362705808794},
+    {-0.17519730745596307, -0.40784278537382301,
+     3.0296043792030685, 2.7867107599321685},
+    {-0.21239771750944403, -0.44504319542730397,
+     2.8959005621467551, 2.6500936469732164},
+    {-0.055964150192975737, -0.28860962811083574,
+     3.0465165043154752, 2.8103750199027218},
+    {-0.08848050734920937, -0.32112598526706937,
+     2.9234858859458117, 2.6858745735243894},
+    {-0.26029386239161789, -0.49293934030947784,
+     -3.1389937326884545, 2.8940120896536903},
+    {-0.30552239372377998, -0.53816787164164004,
+     3.0116958869694299, 2.7566958329604905},
+    {-0.13615526566847019, -0.36880074358633014,
+     -3.131975087769538, 2.9109475448066959},
+    {-0.21692485529231376, -0.4495703332101737,
+     -2.2568567835059961, -2.5030463831820091},
+    {-0.1834415788849077, -0.41608705680276764,
+     -2.3947086319696371, -2.6382129126458373},
+    {-0.12349098123414576, -0.3561364591520057,
+     -2.1802504767015383, -2.4197498920798322},
+    {-0.091609688334721037, -0.324255166252581,
+     -2.3059739399530113, -2.5437409599140652},
+    {-0.34381187954320913, -0.57645735746106919,
+     -2.2001990862444045, -2.4598501651256828},
+    {-0.31671936371213605, -0.5493648416299961,
+     -2.3454141438133629, -2.6017181805719893},
+    {-0.24281560082701686, -0.47546107874487681,
+     -2.1260545185178699, -2.3745542768156169},
+    {-0.23523985787709945, -0.46788533579495939,
+     0.99033402159387429, 0.74253191496397575},
+    {-0.22225800367516174, -0.45490348159302169,
+     1.1296180085186418, 0.88296956332785859},
+    {-0.35550362090843918, -0.58814909882629918,
+     0.93011037942780261, 0.6689280315656202},
+    {-0.34894566996949528, -0.58159114788735533,
+     1.073838225599816, 0.81352137135666824},
+    {-0.11976125921659198, -0.35240673713445192,
+     0.91508020002876145, 0.67579734315158291},
+    {-0.11365210915826361, -0.34629758707612363,
+     1.0471079736065023, 0.80817181527790938},
+    {-0.24185515004124047, -0.47450062795910042,
+     0.84977161219358488, 0.6013613090789246},
+    {-0.23815862468839322, -0.47080410260625316,
+     -0.36342035294156128, -0.61148909940346929},
+    {-0.29498176858466113, -0.52762724650252113,
+     -0.23177728303365788, -0.48559079413811479},
+    {-0.30840642103347943, -0.54105189895133932,
+     -0.48442198679019965, -0.73975358181442818},
+    {-0.37212137614409713, -0.60476685406195718,
+     -0.35563888527125281, -0.6190914436343341},
+    {-0.10419587086967963, -0.33684134878753957,
+     -0.36832627837972309, -0.60674527689305013},
+    {-0.16312057059143686, -0.39576604850929681,
+     -0.2483265294883561, -0.49036072340548442},
+    {-0.1761715035582247, -0.40881698147608464,
+     -0.48921031614392008, -0.73217507561308093},
+    {-0.29763314876587998, -0.53027862668373993,
+     2.0969666623967824, 1.8428583855473974},
+    {-0.35114701484558497, -0.58379249276344503,
+     2.0064551275267171, 1.7458496375753472},
+    {-0.20355616776620639, -0.43620164568406633,
+     2.1295928577212933, 1.8845154620305045},
+    {-0.23380693222837368, -0.46645241014623362,
+     2.0104038667560613, 1.7627316817122816},
+    {-0.39412410241538987, -0.62676958033324992,
+     2.1336556294759221, 1.8670212798613184},
+    {-0.35114701484558497, -0.58379249276344503,
+     2.0064551275267171, 1.7458496375753472},
+    {-0.30000537455646742, -0.53265085247432742,
+     2.2066395472577804, 1.9522654412356653},
+    {-0.3034951510930935, -0.53614062901095338,
+     -0.74144220374630831, -0.99621099250200784},
+    {-0.22862161183349305, -0.461267089751353,
+     -0.86631298799370526, -1.113520398512226},
+    {-0.24378269772692435, -0.47642817564478429,
+     -0.61483699183087326, -0.86342712122928467},
+    {-0.17131638280833034, -0.40396186072619028,
+     -0.74317907345254908, -0.98579198684930092},
+    {-0.42428591221316592, -0.65693139013102597,
+     -0.73759590568178979, -1.0089356230853759},
+    {-0.35317501504518267, -0.58582049296304273,
+     -0.86507510727180859, -1.1259481913180414},
+    {-0.37137911075338731, -0.6040245886712472,
+     -0.61041012814877527, -0.8737588855374574},
+    {-0.31104777937004974, -0.54369325728790963,
+     1.3805353854471589, 1.1248975210598566},
+    {-0.27806153813539058, -0.51070701605325053,
+     1.5309461546409595, 1.2789562494696198},
+    {-0.44648487653172686, -0.67913035444958691,
+     1.336696702799177, 1.0616241456309563},
+    {-0.41604689525363703, -0.64869237317149708,
+     1.4978940597315775, 1.2278805228341194},
+    {-0.20189678896433783, -0.43454226688219777,
+     1.2752823366070949, 1.0303392433455336},
+    {-0.17465558921639956, -0.40730106713425951,
+     1.4214217339567434, 1.1785675556818869},
+    {-0.3350626959253038, -0.56770817384316385,
+     1.2257625179364875, 0.96722262028844275},
+    {-0.3252385355209258, -0.55788401343878569,
+     0.31858466316775091, 0.061257823570074726},
+    {-0.29579472766964315, -0.52844020558750304,
+     0.17327537855720496, -0.080628250400015672},
+    {-0.21935848631283833, -0.45200396423069827,
+     0.39879682827072377, 0.15239892869908839},
+    {-0.1993040097567888, -0.43194948767464875,
+     0.25998802165416979, 0.015253133425093005},
+    {-0.44998240041826798, -0.68262787833612804,
+     0.38668402050175632, 0.11100149190498698},
+    {-0.42798737816134658, -0.66063285607920663,
+     0.23130875288635719, -0.040637043915613583},
+    {-0.3465214135336398, -0.5791668914514998,
+     0.46699282794919472, 0.20699164219836164},
+    {-0.32819759395769466, -0.56084307187555471,
+     1.7841251114456327, 1.526436711561066},
+    {-0.27891919812103966, -0.51156467603889966,
+     1.9022017357957635, 1.6501217582558347},
+    {-0.46178134913123625, -0.69442682704909631,
+     1.772029412403469, 1.4942438172382375},
+    {-0.40690930014397109, -0.63955477806183114,
+     1.8988367061423252, 1.6302576971641933},
+    {-0.23885955876534037, -0.47150503668320032,
+     1.6709119528404881, 1.4227787731184769},
+    {-0.19682988519949435, -0.42947536311735429,
+     1.7966982674245777, 1.5521601947565844},
+    {-0.37529044784914628, -0.60793592576700628,
+     1.6487198611626952, 1.3848215691626375},
+    {-0.34241312040887012, -0.57505859832673001,
+     -1.9130975494657287, -2.1725690041629218},
+    {-0.24497445524922795, -0.4776199331670879,
+     -1.9964906933904285, -2.245192597987546},
+    {-0.32239797497498818, -0.55504345289284807,
+     -1.7661697817701481, -2.0231526071440906},
+    {-0.22969816451541913, -0.46234364243327908,
+     -1.8612643458739941, -2.1085675604797967},
+    {-0.46186332692111465, -0.6945088048389747,
+     -1.9738380795240005, -2.2516385344466068},
+    {-0.35345490012376712, -0.58610037804162718,
+     -2.0601479706869785, -2.3210581129600616},
+    {-0.4459523373357196, -0.67859781525357965,
+     -1.8109669548551262, -2.0859471681878321},
+    {-0.35154947643253848, -0.58419495435039837,
+     -1.1059313533149255, -1.3665898190497108},
+    {-0.41126097786285631, -0.64390645578071637,
+     -0.98199969470467496, -1.2512571720699979},
+    {-0.41160777064200815, -0.64425324855986821,
+     -1.2392414178673552, -1.50855333068144},
+    {-0.47581756136034725, -0.70846303927820742,
+     -1.1075196726269823, -1.3879005578202153},
+    {-0.21795556424168416, -0.45060104215954411,
+     -1.1023186739921362, -1.348596273280779},
+    {-0.28558869404853293, -0.51823417196639288,
+     -0.9830217227147735, -1.2358106991152205},
+    {-0.28005448904797531, -0.5126999669658352,
+     -1.2327269854164375, -1.4849265769364},
+    {-0.37539268923984387, -0.60803816715770376,
+     -2.6076480798541928, -2.8715608215027801},
+    {-0.32255876179869669, -0.55520423971655675,
+     -2.7603072708089416, -3.0173094888254139},
+    {-0.27969694126236011, -0.51234241918022005,
+     -2.4952084457010506, -2.7473703187654963},
+    {-0.23419307519801236, -0.4668385531158723,
+     -2.6430750089864765, -2.8907821416629615},
+    {-0.51623042074765202, -0.74887589866551219,
+     -2.5635561755929928, -2.8520118583361587},
+    {-0.46465200400289175, -0.6972974819207518,
+     -2.7311002774457735, -3.0094082876975303},
+    {-0.4184679069956031, -0.65111338491346316,
+     -2.4473594535953112, -2.7177594348804952},
+    {-0.38124102391235209, -0.61388650183021198,
+     -1.5081473896938176, -1.772893927917029},
+    {-0.29308606028785317, -0.52573153820571306,
+     -1.6274867303769192, -1.8810909980728492},
+    {-0.33550077182634258, -0.56814624974420247,
+     -1.3696118600237079, -1.6282066986743706},
+    {-0.25044489937971692, -0.48309037729757687,
+     -1.494413525415158, -1.7436343448624207},
+    {-0.51181353321659773, -0.74445901113445789,
+     -1.5215584124106716, -1.8090859685595349},
+    {-0.41817961323946728, -0.65082509115732734,
+     -1.6534410041574437, -1.923794826544484},
+    {-0.46343812453330913, -0.69608360245116918,
+     -1.3766714505994524, -1.6547580341933048},
+    {-0.40755075917304495, -0.64019623709090501,
+     2.4025424721310804, 2.1338639879918047},
+    {-0.40744408597759219, -0.64008956389545224,
+     2.262936944284895, 1.9942750154130215},
+    {-0.28797992332685918, -0.52062540124471912,
+     2.4648120403980065, 2.2117651470630082},
+    {-0.2973647573142853, -0.53001023523214519,
+     2.3298310030611336, 2.0757526769021557},
+    {-0.52359045829967221, -0.75623593621753238,
+     2.4934531740760213, 2.2034249050523109},
+    {-0.52262121396061989, -0.75526669187848006,
+     2.334246973826724, 2.0444276773522261},
+    {-0.39804057969866946, -0.63068605761652952,
+     2.5537639696697605, 2.2865415496450838},
+    {-0.4720454060126883, -0.70469088393054846,
+     -3.0110851168375792, 2.9924269503429795},
+    {-0.39363616746396202, -0.62628164538182207,
+     3.1381084258430523, 2.8715468736379881},
+    {-0.40316761256685363, -0.63581309048471368,
+     -2.8841005016695584, 3.1310823849682734},
+    {-0.33710476114499682, -0.56975023906285682,
+     -3.018357775038143, 3.0060309067083164},
+    {-0.60698050259108394, -0.8396259805089441,
+     -2.9995431183317223, 2.9732924329057244},
+    {-0.53203620127354045, -0.76468167919140062,
+     3.1334701455091718, 2.8415964535086289},
+    {-0.54216565987576926, -0.77481113779362942,
+     -2.8631418097249339, 3.1258973994064894},
+    {-0.47549661037667978, -0.70814208829453995,
+     0.70599588947915648, 0.4256755084547752},
+    {-0.46733675088310578, -0.69998222880096594,
+     0.54329355973844651, 0.26449310259406855},
+    {-0.36219331688688305, -0.59483879480474311,
+     0.78006534690918605, 0.51798251584904542},
+    {-0.35931415788079357, -0.59195963579865363,
+     0.62322746196275536, 0.36153438302810786},
+    {-0.57915534774068722, -0.81180082565854739,
+     0.7951254055104191, 0.49210196124503258},
+    {-0.57761680955316019, -0.81026228747102036,
+     0.62771261427281644, 0.32507740889513959},
+    {-0.47163621276487755, -0.70428169068273772,
+     0.86514259393531989, 0.58554566373365802},
+    {-0.48386885657925682, -0.71651433449711699,
+     2.8319471473349527, 2.5500303409051224},
+    {-0.51111595005280186, -0.74376142797066203,
+     2.6623954654175175, 2.3750134355786243},
+    {-0.34573238254571481, -0.57837786046357487,
+     2.8655659518561842, 2.6056670134784818},
+    {-0.3773426353157604, -0.60998811323362045,
+     2.7105976984112252, 2.4464085411431324},
+    {-0.58359316763506197, -0.81623864555292214,
+     2.9726559842615923, 2.6685030422735143},
+    {-0.6208825860437317, -0.85352806396159187,
+     2.7941407705447219, 2.4799036526282805},
+    {-0.44338310350242482, -0.67602858142028488,
+     2.9927686986653779, 2.7182320355764764},
+    {-0.48960658261242052, -0.72225206053028068,
+     -0.046152858476577588, -0.32918578907818563},
+    {-0.53195979858355114, -0.7646052765014113,
+     0.12752998702684121, -0.16432681196712567},
+    {-0.57714224150976556, -0.80978771942762573,
+     -0.17919133343058796, -0.48170713010755067},
+    {-0.63054254657551756, -0.86318802449337773,
+     0.0047253842785495159, -0.31230718451532974},
+    {-0.34822959016871319, -0.58087506808657308,
+     -0.085363636349534075, -0.34558700913483831},
+    {-0.39365599804646989, -0.62630147596432995,
+     0.071328576898158719, -0.19523593191673208},
+    {-0.43468504968574884, -0.66733052760360889,
+     -0.20941317324895201, -0.48247210132556539},
+    {-0.5661009991638446, -0.79874647708170476,
+     -0.85716349835640349, -1.1569464442106003},
+    {-0.52710386324686409, -0.75974934116472426,
+     -0.97888521811893059, -1.2696758169619979},
+    {-0.53612109330570223, -0.7687665712235624,
+     -0.73881593501292597, -1.0315981662921034},
+    {-0.46595576293907659, -0.69860124085693664,
+     -0.86194996557563519, -1.1404966482349375},
+    {-0.64247734318869754, -0.8751228211065577,
+     -0.93326893221139717, -1.2538664469167577},
+    {-0.52710386324686409, -0.75974934116472426,
+     -0.97888521811893059, -1.2696758169619979},
+    {-0.64861860499823487, -0.88126408291609504,
+     -0.76975246151998367, -1.0922338422315863},
+    {-0.57391400924438429, -0.80655948716224446,
+     -0.48382195318149157, -0.78552977013024239},
+    {-0.65042547054985878, -0.88307094846771894,
+     -0.3256041697972144, -0.64864636584678959},
+    {-0.62094733338543007, -0.85359281130329023,
+     -0.62492519404943159, -0.93918078744501376},
+    {-0.70592637067388175, -0.93857184859174192,
+     -0.48041549211161116, -0.822252113734942},
+    {-0.4393955060794188, -0.67204098399727885,
+     -0.48416305282524486, -0.75801769966603005},
+    {-0.51127342673092557, -0.74391890464878574,
+     -0.34354997487910854, -0.63096483161774353},
+    {-0.49424602458252709, -0.72689150250038725,
+     -0.61329167060855372, -0.89724042472309351},
+    {-0.57556319705715309, -0.80820867497501325,
+     -2.2188572985544646, -2.5209769499273547},
+    {-0.44920401555971379, -0.68184949347757384,
+     -2.2872498786509428, -2.5627961305634464},
+    {-0.58315764616510701, -0.81580312408296718,
+     -2.0458166921676408, -2.3498581490797656},
+    {-0.46534653848244656, -0.69799201640030661,
+     -2.1336646325523625, -2.4120996778015491},
+    {-0.68024037812191651, -0.91288585603977668,
+     -2.3195848628878917, -2.6523310103424755},
+    {-0.55372088071704473, -0.78636635863490489,
+     -2.3894602708011554, -2.6862797238432741},
+    {-0.70008182250440221, -0.93272730042226237,
+     -2.1321098587634184, -2.4718148726507421},
+    {-0.58167946178906715, -0.81432493970692732,
+     2.0690937695802409, 1.7654296615175111},
+    {-0.65775740565735896, -0.89040288357521913,
+     1.9309716443877381, 1.6056226437931123},
+    {-0.46269341923995411, -0.69533889715781416,
+     2.0298306909053858, 1.7518795738996973},
+    {-0.53025258502570627, -0.76289806294356644,
+     1.9067259256710218, 1.6152456471474261},
+    {-0.62066467902196998, -0.85331015693983014,
+     2.2459733699401117, 1.9317984055747548},
+    {-0.71138731388993171, -0.94403279180779187,
+     2.1249261114874702, 1.781062792963134},
+    {-0.50223944741504678, -0.73488492533290695,
+     2.1816019997811895, 1.8960468805972046},
+    {-0.58410785084538019, -0.81675332876324036,
+     1.1162495744658856, 0.81196470364507756},
+    {-0.57513530684327208, -0.80778078476113224,
+     1.2893700664090542, 0.98735745448831069},
+    {-0.69116498470687759, -0.92381046262473776,
+     1.0553015999720539, 0.71877601187663887},
+    {-0.6923792325271283, -0.92502471044498846,
+     1.2377803514324794, 0.90082688298125424},
+    {-0.46923250702843644, -0.70187798494629661,
+     1.0150082959631139, 0.73585784694349532},
+    {-0.46420264318256133, -0.69684812110042138,
+     1.1728942587172635, 0.89466830633706129},
+    {-0.57893016157552579, -0.81157563949338596,
+     0.95296480938445827, 0.6499982962357953},
+    {-0.64154835221165551, -0.87419383012951568,
+     1.6013693297270266, 1.2810538239674463},
+    {-0.67588328480709048, -0.90852876272495064,
+     1.4239766743284046, 1.0927033624757085},
+    {-0.51128531334997673, -0.7439307912678369,
+     1.6256415564529914, 1.338224221288},
+    {-0.55039924149196517, -0.78304471940982534,
+     1.4624652941799026, 1.1664233352179942},
+    {-0.7232188875380251, -0.95586436545588527,
+     1.7647298205845909, 1.4163559715007592},
+    {-0.77075003814989007, -1.0033955160677501,
+     1.5731694149848334, 1.2048753280784112},
+    {-0.59171802384910532, -0.82436350176696549,
+     1.7632651130259034, 1.4570065715111378},
+    {-0.66882937299512846, -0.90147485091298862,
+     -1.2056066559734975, -1.5345361224574312},
+    {-0.59720162440076141, -0.82984710231862158,
+     -1.3710313216984875, -1.6787390662632704},
+    {-0.59670894098712324, -0.8293544189049834,
+     -1.0837082069862558, -1.3912848062582461},
+    {-0.53647619841240446, -0.76912167633026463,
+     -1.2336045571694927, -1.5264662674262148},
+    {-0.80351595013720478, -1.0361614280550648,
+     -1.1648050702803889, -1.5487411350347724},
+    {-0.73609059920331366, -0.96873607712117382,
+     -1.3602533831313997, -1.713727619567107},
+    {-0.72325224576305025, -0.95589772368091042,
+     -1.0326323490426361, -1.381019151763458},
+    {-0.68311930218704175, -0.91576478010490192,
+     0.38775892865290101, 0.054028918833862002},
+    {-0.68281031895532329, -0.91545579687318346,
+     0.56115589509698438, 0.22753189041594435},
+    {-0.79163826000591642, -1.0242837379237766,
+     0.28747639739102804, -0.090591146296604558},
+    {-0.7960368892318439, -1.0286823671497041,
+     0.49179608907452255, 0.11158255553685931},
+    {-0.5589304487216441, -0.79157592663950427,
+     0.30190626546976163, 0.0038525053464783104},
+    {-0.57071605521088264, -0.80336153312874281,
+     0.46699467099676517, 0.16607992751147113},
+    {-0.66641537596200506, -0.89906085387986523,
+     0.19823242382457623, -0.12990626341660461},
+    {-0.68725991076005988, -0.91990538867792004,
+     -1.7256151424315544, -2.0607753255132404},
+    {-0.57522169515338728, -0.80786717307124745,
+     -1.8644453984761322, -2.1664796104147084},
+    {-0.6498119130151595, -0.88245739093301967,
+     -1.5359425158205835, -1.8587939389396873},
+    {-0.55066432325821124, -0.78330980117607141,
+     -1.6862200192255192, -1.982323756257357},
+    {-0.82154818109614292, -1.0541936590140029,
+     -1.7748417871897884, -2.1681521865905928},
+    {-0.70429490607231238, -0.93694038399017254,
+     -1.9297133813695342, -2.2709511190629743},
+    {-0.78992389265905838, -1.0225693705769185,
+     -1.5516488464704354, -1.928888506262523},
+    {-0.73467100155648557, -0.96731647947434574,
+     -2.6456934997502763, -2.9985950287770944},
+    {-0.67594505875460509, -0.90859053667246525,
+     -2.8351797294065717, 3.1167115193816857},
+    {-0.65094915014909938, -0.88359462806695954,
+     -2.5087389461448231, -2.8319442441722327},
+    {-0.60372698460898822, -0.83637246252684838,
+     -2.6936237851028078, -3.0030862107257703},
+    {-0.85394493660820425, -1.0865904145260643,
+     -2.5844070114484703, -2.9961115654277162},
+    {-0.80038219783173525, -1.0330276757495953,
+     -2.7982835012520009, 3.102536935461949},
+    {-0.77499647586100873, -1.0076419537788688,
+     -2.4406684820605973, -2.8108952958824229},
+    {-0.75814309269628444, -0.9907885706141446,
+     0.81877624444131059, 0.45606494963428068},
+    {-0.78282982467099249, -1.0154753025888525,
+     0.67046482445489253, 0.29660115561975742},
+    {-0.67552420967930749, -0.90816968759716765,
+     0.88756517728877227, 0.55641238296795148},
+    {-0.6748448442255689, -0.90749032214342906,
+     0.71983572356833136, 0.38891059044739107},
+    {-0.8583962188112213, -1.0910416967290812,
+     0.84349364785627512, 0.42909178052288444},
+    {-0.78282982467099249, -1.0154753025888525,
+     0.67046482445489253, 0.29660115561975742},
+    {-0.78407223468500198, -1.0167177126028621,
+     0.97813834197056648, 0.60368915342674501},
+    {-0.75913016960492308, -0.99177564752278324,
+     2.5445760227063259, 2.181435804190702},
+    {-0.7461807680147875, -0.97882624593264766,
+     2.33506616925259, 1.9774461375360664},
+    {-0.64022537203610341, -0.87287084995396358,
+     2.6076672347126344, 2.2877520078249605},
+    {-0.64167106440977362, -0.87431654232763378,
+     2.4258061051384732, 2.1054533925637684},
+    {-0.87042224445643002, -1.10306772237429,
+     2.7023581149436628, 2.2804466048820737},
+    {-0.87334574477957583, -1.1059912226974358,
+     2.4625920149452005, 2.0388042761867533},
+    {-0.75074512690595374, -0.98339060482381391,
+     2.750651493951791, 2.3911118518482049},
+    {-0.80304255412561676, -1.0356880320434767,
+     3.1309549106458623, 2.7472572655171041},
+    {-0.84808101752608678, -1.0807264954439468,
+     2.9265309043610404, 2.5183142794670776},
+    {-0.6702583200871679, -0.90290379800502807,
+     3.1308615836860971, 2.8014613170833922},
+    {-0.72026995589262299, -0.95291543381048316,
+     2.9508989677284236, 2.6036649276202763},
+    {-0.86528707755414702, -1.097932555472007,
+     -2.956178157518365, 2.9083427456722744},
+    {-0.92616149779217682, -1.1588069757100368,
+     3.1345780148785698, 2.6730496973672615},
+    {-0.73950322891350639, -0.97214870683136656,
+     -2.9820187876593716, 2.9463049576895743},
+    {-0.84797944454011387, -1.0806249224579738,
+     -0.08264125223579713, -0.49079810423814296},
+    {-0.78438820082737071, -1.0170336787452308,
+     -0.2996601933758839, -0.67425867454078681},
+    {-0.76521587022281667, -0.99786134814067684,
+     0.071189793490389119, -0.29462538790060944},
+    {-0.71661333888736567, -0.94925881680522584,
+     -0.13829725750621177, -0.48413243403229711},
+    {-0.97893250312463409, -1.2115779810424938,
+     0.0033568333746917811, -0.50480292380715075},
+    {-0.91282730267574941, -1.1454727805936094,
+     -0.27755370684260383, -0.72881291345096588},
+    {-0.88947470193037126, -1.1221201798482312,
+     0.16335352657116439, -0.27116088226374602},
+    {-0.84810195512837538, -1.0807474330462354,
+     -0.7193785874025006, -1.1276075361960509},
+    {-0.744636159460213, -0.97728163737807316,
+     -0.84742364725252861, -1.2044003832373744},
+    {-0.82820012940796106, -1.060845607325821,
+     -0.49372181440544771, -0.8906400169117018},
+    {-0.73742810690068983, -0.97007358481854999,
+     -0.65281486883699114, -1.0068310522652755},
+    {-0.96064254171100316, -1.1932880196288631,
+     -0.81783943588375474, -1.3086499011259256},
+    {-0.84242189865769768, -1.0750673765755576,
+     -0.95283875486649128, -1.3577579467589898},
+    {-0.95361585603444543, -1.1862613339523054,
+     -0.52889152340475787, -1.0133898407801238},
+    {-0.91350537059882964, -1.1461508485166896,
+     1.2854616807853017, 0.83369323767172399},
+    {-0.89797002429163042, -1.1306155022094904,
+     1.049628828510313, 0.60919639322650188},
+    {-0.79580633972790593, -1.028451817645766,
+     1.3671974727221137, 0.98709720672784074},
+    {-0.79870983963679731, -1.0313553175546575,
+     1.1636929560115623, 0.782159789018114},
+    {-1.0313439314909649, -1.2639894094088246,
+     1.4813600216998668, 0.91478342010558744},
+    {-1.0203944794937545, -1.2530399574116142,
+     1.1676787604365571, 0.61451838223080335},
+    {-0.90299395960470785, -1.1356394375225678,
+     1.5358679211306607, 1.0918440021114706},
+    {-0.93410751334514375, -1.1667529912630037,
+     -2.1168879066808306, -2.5848012444422319},
+    {-0.80615369542424675, -1.0387991733421067,
+     -2.2364929266671183, -2.6217644855325011},
+    {-0.94659428261594547, -1.1792397605338054,
+     -1.8397807741614942, -2.3181549520560054},
+    {-0.82621693364992654, -1.0588624115677865,
+     -2.0115240550981004, -2.4073578950382228},
+    {-1.0220371835919484, -1.2546826615098081,
+     -2.2549953950203285, -2.8101236819785349},
+    {-0.89578563958286272, -1.1284311175007227,
+     -2.3628159383847578, -2.8017083094433239},
+    {-1.0557635458164762, -1.288409023734336,
+     -1.9314510946753609, -2.5306977902825345},
+    {-0.93842851456502197, -1.1710739924828819,
+     2.0298117014304204, 1.5583388879483726},
+    {-1.0036424456691229, -1.2362879235869826,
+     1.7850730706419771, 1.2511320138955544},
+    {-0.79530391454548444, -1.0279493924633445,
+     1.9685008985201708, 1.5886471673674265},
+    {-0.86230773585086262, -1.0949532137687226,
+     1.7706935979131815, 1.353885293171903},
+    {-0.98536453657023593, -1.2180100144880956,
+     2.3389317521482629, 1.8243338399699831},
+    {-1.0813797938099843, -1.314025271727844,
+     2.1392549734515311, 1.5009924924501183},
+    {-0.84792423043691212, -1.0805697083547721,
+     2.2079491630403898, 1.79982479390036},
+    {-1.0079845144955051, -1.2406299924133648,
+     0.63734870942144872, 0.098569891842948759},
+    {-1.0128105790456126, -1.2454560569634723,
+     0.32743989768641268, -0.21683200231874802},
+    {-0.89121941576574848, -1.1238648936836084,
+     0.65067414783696798, 0.21495990563260303},
+    {-0.90378721640533444, -1.1364326943231944,
+     0.41784092077548685, -0.026756468122402788},
+    {-1.0959341313320867, -1.3285796092499464,
+     0.96293727342037272, 0.29995386844121968},
+    {-1.1325647312328748, -1.3652102091507345,
+     0.61571272690102186, -0.11962766185485024},
+    {-0.97128131421928132, -1.203926792137141,
+     0.88490751677518287, 0.38417291146762389},
+    {-1.0083080302733802, -1.24095350819124,
+     -1.308676093500807, -1.847819279361089},
+    {-0.87487932900208143, -1.1075248069199415,
+     -1.3413117876049265, -1.7660918864857738},
+    {-1.0644103154115818, -1.2970557933294415,
+     -0.97587186576963902, -1.5876992235637648},
+    {-0.93416674241626407, -1.166812220334124,
+     -1.1004037157359587, -1.5683654218831966},
+    {-1.0521193640283688, -1.2847648419462285,
+     -1.5927504386527291, -2.1868617932489167},
+    {-0.92600207515114796, -1.1586475530690079,
+     -1.5696816518863486, -2.0310839447043301},
+    {-1.1413195190005134, -1.3739649969183731,
+     -1.2442992415987255, -1.9994925278798934},
+    {-1.0129052893142865, -1.2455507672321462,
+     -2.6855108148306295, 3.0532935438556139},
+    {-1.082758343575422, -1.3154038214932817,
+     -2.4547693234708934, -3.095288230040703},
+    {-0.9812341730189007, -1.2138796509367604,
+     -2.9183300056394521, 2.8544126998607156},
+    {-1.095617127882601, -1.3282626058004607,
+     -2.7727585771397485, 2.8480036602216106},
+    {-0.9651784226601916, -1.1978239005780515,
+     -2.5132676885190399, -3.0082539888063247},
+    {-1.082758343575422, -1.3154038214932817,
+     -2.4547693234708934, -3.095288230040703},
+    {-0.91299676715885725, -1.1456422450767172,
+     -2.7497485548629075, 3.0820504030931173},
+    {-1.099533883323605, -1.3321793612414647,
+     2.9358074235744565, 2.2663892010276245},
+    {-1.2290410343491296, -1.4616865122669893,
+     2.9852289882663507, 1.9444399756408324},
+    {-0.99448124517366532, -1.227126723091525,
+     2.6513514079252229, 2.1273057594609903},
+    {-1.1159835542819061, -1.3486290321997658,
+     2.5629970044411494, 1.8623909489955235},
+    {-1.047269231078958, -1.2799147089968177,
+     -3.0938035154188697, 2.6019582297575345},
+    {-1.1753875898427886, -1.4080330677606483,
+     -2.9390221076241438, 2.4996448878389801},
+    {-0.96950507123405805, -1.2021505491519178,
+     2.9146465231086429, 2.415600607197983},
+    {-1.1914251444967081, -1.4240706224145678,
+     -0.15729608982135257, -1.0519991976023921},
+    {-1.0818938711765465, -1.3145393490944062,
+     -0.58655950968447945, -1.2256614349646999},
+    {-1.1167322642733775, -1.3493777421912372,
+     0.16596314183381303, -0.53613632285807156},
+    {-1.0497297037917181, -1.2823751817095779,
+     -0.24089070314352395, -0.83168632090392558},
+    {-1.3293633116145183, -1.562008789532378,
+     0.11028481205210705, -1.7540984516286677},
+    {-1.2003408494504313, -1.432986327368291,
+     -0.70872423638508408, -1.6341014687683946},
+    {-1.2541177164445367, -1.4867631943623965,
+     0.55394198736275646, -0.6150244672079288},
+    {-1.2663443096355931, -1.4989897875534528,
+     1.8885745540966834, 0.64462416921913768},
+    {-1.2298828362913115, -1.4625283142091712,
+     1.1468224272330758, 0.10219855315676385},
+    {-1.1408121369111279, -1.3734576148289876,
+     1.8167026611925281, 1.0626907534392092},
+    {-1.1466130870310816, -1.3792585649489413,
+     1.3883929847888896, 0.62063787543091475},
+    {-1.3435984432590782, -1.5707963267948966,
+     3.1415926535897931, -3.1415926535897931},
+    {-1.3689748463439764, -1.5707963267948966,
+     3.1415926535897931, -3.1415926535897931},
+    {-1.2182267722259992, -1.4508722501438589,
+     2.36989138304767, 1.3759150537627705},
+    {-1.2667180222138132, -1.499363500131673,
+     -1.8547604487552505, -3.1011575681944192},
+    {-1.1688559410345873, -1.4015014189524471,
+     -1.6574378760607225, -2.483153478270733},
+    {-1.4005713292597319, -1.5707963267948966,
+     3.1415926535897931, -3.1415926535897931},
+    {-1.2780238701742397, -1.5106693480920994,
+     -1.0708467726214406, -2.3961937178379342},
+    {-1.1912061309007305, -1.4238516088185902,
+     -2.4620786085463742, 2.9271306446472005},
+    {-1.1420767718051932, -1.3747222497230529,
+     -2.1082721645116793, -2.8652358882556159},
+    {-1.2965840139953406, -1.5292294919132003,
+     -2.5105469474578661, 2.293028917081068},
+    {1.4271263472828892, 1.338955175062597,
+     0.89982197780145901, 0.42744531242845818},
+    {1.4745136735841895, 1.3863425013638973,
+     0.86937287896194415, 0.23916349107403995},
+    {1.4076791241317341, 1.3195079519114419,
+     1.1167099431695031, 0.68811891888239685},
+    {1.458313245555005, 1.3701420733347127,
+     1.1641993565571629, 0.59874497193425769},
+    {1.3912055823487126, 1.3030344101284204,
+     0.71534329608566427, 0.31784614925448662},
+    {1.4342347778073534, 1.3460636055870612,
+     0.63981806539126151, 0.1490681940956268},
+    {1.3793100546337922, 1.2911388824134999,
+     0.91681349805664336, 0.53904350307061799},
+    {1.5041872124879387, 1.4160160402676465,
+     0.27133598134959747, -0.52681871364145061},
+    {1.5164896140746127, 1.4283184418543204,
+     -0.15857360115439784, -1.0561397618790189},
+    {1.5191729745144293, 1.4310018022941371,
+     0.79786432547879182, -0.12478645973865188},
+    {1.5528954124794132, 1.464724240259121,
+     0.53407642543596379, -0.88926027966131715},
+    {1.4569923390644159, 1.3688211668441237,
+     0.17162231900606945, -0.38914034938286751},
+    {1.4736039564387959, 1.3854327842185037,
+     -0.11447647173211875, -0.74065458932793382},
+    {1.473614025068074, 1.3854428528477818,
+     0.51139062843897887, -0.11483182162691913},
+    {1.3906599651000124, 1.3024887928797202,
+     1.5051803354671918, 1.1086342450023328},
+    {1.4384321952433157, 1.3502610230230234,
+     1.6592214846374032, 1.1569233320828101},
+    {1.3476037971475345, 1.2594326249272423,
+     1.5974817524007714, 1.2636355747361179},
+    {1.3921356208035458, 1.3039644485832536,
+     1.7381208663098631, 1.3389917514030347},
+    {1.3785003541406156, 1.2903291819203233,
+     1.2828563423125061, 0.90635629116116423},
+    {1.4287355738563778, 1.3405644016360856,
+     1.3691628728330327, 0.89275042259143944},
+    {1.3425214903489262, 1.254350318128634,
+     1.4062743473325401, 1.0785072939711731},
+    {1.5297478609906618, 1.4415766887703696,
+     1.8560563037104179, 0.81912961806971418},
+    {1.5707963267948966, 1.4860097638514325,
+     3.1415926535897931, -3.1415926535897931},
+    {1.4838909660377468, 1.3957197938174546,
+     1.921320496056012, 1.2462827976068342},
+    {1.5218573733313918, 1.4336862011110996,
+     2.3990883633724316, 1.4498929472552393},
+    {1.5096339608628504, 1.4214627886425582,
+     1.2594351323344926, 0.42013933864860697},
+    {1.5609796543288079, 1.4728084821085157,
+     1.5358300119841704, -0.10072261556855622},
+    {1.4795071056219515, 1.3913359334016593,
+     1.5219266402033176, 0.86862149402116806},
+    {1.3125994653017896, 1.2244282930814974,
+     0.6480052697004195, 0.35183063131289644},
+    {1.3534965173946836, 1.2653253451743913,
+     0.58533589003446129, 0.2441414521423165},
+    {1.3024850968742692, 1.2143139246539769,
+     0.79828087127655267, 0.51139638313573943},
+    {1.3468963724538865, 1.2587252002335942,
+     0.76421975449826562, 0.43123374452410523},
+    {1.2777529487530823, 1.1895817765327901,
+     0.55835241557784654, 0.29179631065446876},
+    {1.3155486161749474, 1.2273774439546552,
+     0.49091629610224569, 0.19191259662189025},
+    {1.2712171864931243, 1.1830460142728321,
+     0.69439556286898563, 0.43271327811911198},
+    {1.3843765567166182, 1.2962053844963259,
+     0.28208425777415574, -0.1038366451274831},
+    {1.4115082253858251, 1.3233370531655329,
+     0.119513275750502, -0.31703249841706926},
+    {1.3927438320896079, 1.3045726598693157,
+     0.49710671003525597, 0.096902892937142049},
+    {1.4283643619959492, 1.3401931897756569,
+     0.36745265560920459, -0.10802261473540009},
+    {1.3419960894506249, 1.2538249172303326,
+     0.22594498515758019, -0.10120669927804768},
+    {1.3678362260641133, 1.279665053843821,
+     0.087691405384797763, -0.27286728970353846},
+    {1.351614455969806, 1.2634432837495138,
+     0.401931667629916, 0.063120368470911584},
+    {1.3096540899466731, 1.2214829177263808,
+     1.0701014390459678, 0.77669678474924775},
+    {1.3580487606822709, 1.2698775884619786,
+     1.0885537375409149, 0.74144890864155077},
+    {1.2813127697972073, 1.1931415975769151,
+     1.1897407566132294, 0.92044798077849632},
+    {1.3292642661036638, 1.2410930938833715,
+     1.227767485154835, 0.91482646769329656},
+    {1.2855722834914098, 1.1974011112711176,
+     0.93574906281326831, 0.66310235702886078},
+    {1.3319684027143719, 1.2437972304940796,
+     0.92785611438581961, 0.61200533278518698},
+    {1.2626774853720149, 1.1745063131517226,
+     1.0571962085877142, 0.8016037023688497},
+    {1.4267526347046691, 1.3385814624843768,
+     -1.6392686077468284, -2.110717976116935},
+    {1.3894496943152643, 1.3012785220949721,
+     -1.5263296916850051, -1.9207827543842051},
+    {1.4072885351117075, 1.3191173628914152,
+     -1.8993819414396231, -2.3271781520804282},
+    {1.3780463470359883, 1.289875174815696,
+     -1.7520997307154764, -2.127891548227216},
+    {1.4741548392378163, 1.3859836670175241,
+     -1.4518144502673231, -2.0804274739350688},
+    {1.4339132658294045, 1.3457420936091122,
+     -1.3563477848196503, -1.8462352949014755},
+    {1.4579232562568218, 1.3697520840365296,
+     -1.8103976750290447, -2.3744586099081748},
+    {1.3425507958961049, 1.2543796236758127,
+     -1.2529211031647014, -1.5807225511017653},
+    {1.2930085188223244, 1.2048373466020321,
+     -1.2230586868793991, -1.5017777038959617},
+    {1.3471990478798026, 1.2590278756595104,
+     -1.446495631930097, -1.779849105691538},
+    {1.3014086572619896, 1.2132374850416974,
+     -1.3880231090530284, -1.673954776727363},
+    {1.3786350972950756, 1.2904639250747834,
+     -1.0803340480594128, -1.4570448223097328},
+    {1.3282744739257499, 1.2401033017054577,
+     -1.0757546610925537, -1.3876445460712257},
+    {1.389812565018228, 1.3016413927979358,
+     -1.2945168681634978, -1.6895950915595352},
+    {1.3288750904757352, 1.2407039182554429,
+     -2.1256415205237937, -2.4381683633762679},
+    {1.3070214121001582, 1.218850239879866,
+     -1.9915900457877631, -2.2825644011720185},
+    {1.2945410127621275, 1.2063698405418353,
+     -2.2684765059495855, -2.5484826474895486},
+    {1.2809229763071679, 1.1927518040868756,
+     -2.1312468557662787, -2.4002370682273946},
+    {1.378112245819878, 1.2899410735995858,
+     -2.1171987530892067, -2.4930932000142518},
+    {1.35765789313871, 1.2694867209184177,
+     -1.9525304054361587, -2.299119445270553},
+    {1.3421450210980241, 1.2539738488777319,
+     -2.2890938808188737, -2.6164197555376814},
+    {1.2928095902738068, 1.2046384180535146,
+     -1.7262812109282446, -2.0048340651554919},
+    {1.2531032322605329, 1.1649320600402406,
+     -1.6441619056783119, -1.893276406916272},
+    {1.277271743189917, 1.1891005709696247,
+     -1.8814923237402934, -2.1476830134544458},
+    {1.2425342147632059, 1.1543630425429137,
+     -1.7884057425000222, -2.0307652338638356},
+    {1.3420296085074999, 1.2538584362872076,
+     -1.6428331781978196, -1.9700240496816583},
+    {1.3012204619802037, 1.2130492897599114,
+     -1.5590130620466593, -1.8447788305011896},
+    {1.3280438798965484, 1.2398727076762561,
+     -1.8276941073823865, -2.1393401649015025},
+    {1.5606001663467641, 1.4724289941264719,
+     -1.1175082085428343, -2.7426306891850869},
+    {1.5188562090452384, 1.4306850368249462,
+     -1.0898694134130396, -2.0094859122988522},
+    {1.5293831714130524, 1.4412119991927601,
+     -2.0304238517761002, -3.0629383046649741},
+    {1.5092456699561489, 1.4210744977358567,
+     -1.6328872713132063, -2.4691094561595652},
+    {1.5707963267948966, 1.5134728376466227,
+     3.1415926535897931, -3.1415926535897931},
+    {1.5527320346125344, 1.4645608623922421,
+     -0.32907908874476377, -1.7486789657456292},
+    {1.5707963267948966, 1.485755263611692,
+     3.1415926535897931, -3.1415926535897931},
+    {1.456384873454283, 1.3682137012339908,
+     -0.80981547747422478, -1.3684468558901142},
+    {1.4075372403927673, 1.319366068172475,
+     -0.86474288179805769, -1.2930448365026934},
+    {1.4733320243244761, 1.3851608521041838,
+     -1.0984426606925668, -1.7234258466385861},
+    {1.4271795121874979, 1.3390083399672057,
+     -1.0869732172386517, -1.5594821030897814},
+    {1.4735342131969891, 1.3853630409766968,
+     -0.47295447386229877, -1.0988256838986559},
+    {1.4267679244181892, 1.338596752197897,
+     -0.61118677014053258, -1.0826740043147882},
+    {1.5040067683281542, 1.4158355961078619,
+     -0.68769864540544834, -1.4845596948308839},
+    {1.4380784722703004, 1.3499073000500081,
+     -2.3672309044984892, -2.868534592563408},
+    {1.4283495484585031, 1.3401783762382109,
+     -2.1036445699246498, -2.5790825191350928},
+    {1.3918066952073211, 1.3036355229870289,
+     -2.5490941793924882, -2.947644549306077},
+    {1.390291161360387, 1.3021199891400947,
+     -2.3191292258803711, -2.7150351009093741},
+    {1.4835718802405407, 1.3954007080202484,
+     -2.4561289737325618, -3.1295357225018607},
+    {1.4791260051808195, 1.3909548329605272,
+     -2.0796286998306472, -2.7311110898057107},
+    {1.4334317178993976, 1.3452605456791054,
+     -2.6654220215191553, 3.1291616376757712},
+    {1.3518334695657841, 1.2636622973454918,
+     2.7064884338641058, 2.367401585891737},
+    {1.3463324608478302, 1.258161288627538,
+     2.9099155894099882, 2.5776119602816676},
+    {1.3034744584420981, 1.2153032862218058,
+     2.5916814075404067, 2.303915264195965},
+    {1.30343966304832, 1.2152684908280278,
+     2.7697168582871261, 2.4819818190667893},
+    {1.3973926635424125, 1.3092214913221203,
+     2.6148291202861724, 2.2062106091429108},
+    {1.3973432580735956, 1.3091720858533034,
+     2.8679370442421166, 2.4594098669165683},
+    {1.3464128382638005, 1.2582416660435083,
+     2.4962653012638314, 2.1638645860645753},
+    {1.3605390789193907, 1.2723679066990985,
+     -3.004443415395845, 2.9283131771552613},
+    {1.329163007914582, 1.2409918356942897,
+     -2.8623436446506259, 3.1080085178291932},
+    {1.3306639815719237, 1.2424928093516314,
+     3.0914308070189795, 2.7769906495058923},
+    {1.3067000420400052, 1.218528869819713,
+     -3.0392396722783759, 2.9532650532586886},
+    {1.4145260415136127, 1.3263548692933205,
+     -2.9506184282040722, 2.8895359483589016},
+    {1.3816158502390854, 1.2934446780187931,
+     -2.785492108767964, 3.1162579949450651},
+    {1.3843068837544763, 1.2961357115341841,
+     3.094594575932391, 2.7087882139148332},
+    {1.2101648671365837, 1.1219936949162914,
+     2.5800049150724713, 2.3560830651056199},
+    {1.2101380288607941, 1.1219668566405019,
+     2.7172580523550374, 2.4933502307771005},
+    {1.1620763541811037, 1.0739051819608114,
+     2.5147049853305918, 2.3131663058932248},
+    {1.1650135683857741, 1.0768423961654818,
+     2.6380054127494383, 2.4352417373368485},
+    {1.2537079252890071, 1.1655367530687148,
+     2.5073847756977909, 2.2578715369982985},
+    {1.2576013245516671, 1.1694301523313748,
+     2.6627993769391161, 2.4106857021194532},
+    {1.2034646604042003, 1.1152934881839081,
+     2.4435332184511966, 2.223054974216581},
+    {1.2421860863180216, 1.1540149140977294,
+     2.958982456390101, 2.7168387832441092},
+    {1.2241243934499586, 1.1359532212296664,
+     3.0884731426416034, 2.8569852668766225},
+    {1.2033856186866025, 1.1152144464663103,
+     2.8502401443342888, 2.629801833252416},
+    {1.1903780951916445, 1.1022069229713523,
+     2.9747083704078738, 2.7606324417925494},
+    {1.2943521636554214, 1.2061809914351291,
+     2.9383568131281712, 2.6585099612311658},
+    {1.2771405893424534, 1.1889694171221612,
+     3.0895517026730746, 2.8234604234822553},
+    {1.2536478536840807, 1.1654766814637885,
+     2.8155690056711689, 2.5660954396518547},
+    {1.414738558222465, 1.3265673860021727,
+     2.1847519438723833, 1.7412569011742058},
+    {1.4376957766743987, 1.3495246044541065,
+     2.4746534030821494, 1.974421138163589},
+    {1.3607491745195073, 1.272578002299215,
+     2.1455358751036355, 1.7948237269224729},
+    {1.3844464691063929, 1.2962752968861007,
+     2.3653212492829283, 1.9792853416162997},
+    {1.433722236129152, 1.3455510639088597,
+     1.9450929949334834, 1.4557164080078921},
+    {1.468553781307204, 1.3803826090869118,
+     2.2530248390257004, 1.6483112311172925},
+    {1.3818883392337804, 1.2937171670134882,
+     1.9575807675855312, 1.5757075864618866},
+    {1.4896869738528036, 1.4015158016325113,
+     3.1088450477369616, 2.4027308555728615},
+    {1.4683371303468888, 1.3801659581265966,
+     -2.8572938605146971, 2.8220654491685151},
+    {1.4460655931550817, 1.3578944209347894,
+     2.7997562729834771, 2.274976638915863},
+    {1.4375753740679755, 1.3494042018476833,
+     3.0999263789423348, 2.6000302405431586},
+    {1.5386532226172647, 1.4504820503969724,
+     3.1176741412114506, 1.9598866881257599},
+    {1.5216320708324518, 1.4334608986121595,
+     -2.6583589978187541, 2.6779176329881031},
+    {1.4897716366835942, 1.401600464463302,
+     2.6729805964976245, 1.966391071105402},
+    {1.277300093138469, 1.1891289209181768,
+     2.2500546027645898, 1.9838424143081177},
+    {1.2944533980222463, 1.2062822258019541,
+     2.4151083714979622, 2.1351761546515622},
+    {1.2242897016795571, 1.1361185294592648,
+     2.2163592334965609, 1.9847784231987509},
+    {1.2423021962456224, 1.1541310240253302,
+     2.3565899853466101, 2.1143743771837977},
+    {1.3069085478875317, 1.2187373756672395,
+     2.1203077185035148, 1.8294366066364047},
+    {1.3308154390680269, 1.2426442668477347,
+     2.2967632654010801, 1.9821599934103256},
+    {1.2535289201306117, 1.1653577479103194,
+     2.102877653621356, 1.8534825942196704},
+    {1.259942208392681, 1.1717710361723888,
+     -0.41364169425725117, -0.66734698832025408},
+    {1.213725474412706, 1.1255543021924137,
+     -0.48333740262570568, -0.70913755223569586},
+    {1.302153740598196, 1.2139825683779037,
+     -0.48239663214056011, -0.76898710599301601},
+    {1.2544070967878798, 1.1662359245675875,
+     -0.5531158109055172, -0.80309179490127014},
+    {1.2593195751695883, 1.171148402949296,
+     -0.27941595292828103, -0.53269581067947225},
+    {1.2166609174506757, 1.1284897452303835,
+     -0.3604600577757745, -0.58783476584423733},
+    {1.3040670833164738, 1.2158959110961816,
+     -0.32643308269684201, -0.61473007048509976},
+    {1.125789172032577, 1.0376179998122848,
+     -0.48326837975942027, -0.67093641903747214},
+    {1.0786013850957876, 0.99043021287549549,
+     -0.5302840973129439, -0.70284993536134421},
+    {1.1659828538828783, 1.077811681662586,
+     -0.53987526230710303, -0.74304684889645678},
+    {1.1171951040859192, 1.0290239318656269,
+     -0.58639763191655658, -0.77109020789401661},
+    {1.1299133963031338, 1.0417422240828416,
+     -0.3819014574827253, -0.57103671939023459},
+    {1.0853107316154713, 0.99713955939517918,
+     -0.43610903066879764, -0.6106489685707529},
+    {1.1719681799159163, 1.083797007695624,
+     -0.42742552333050077, -0.63315709227488315},
+    {1.3278623232065869, 1.2396911509862947,
+     -0.75465294361881252, -1.066107304921569},
+    {1.2763918793509821, 1.1882207071306898,
+     -0.7961360336296095, -1.0616613201133036},
+    {1.3572156750202895, 1.2690445027999973,
+     -0.8993600060408754, -1.245367403295857},
+    {1.305625120732161, 1.2174539485118687,
+     -0.92298485976557176, -1.2126873371964162},
+    {1.3421166219639169, 1.2539454497436247,
+     -0.57350702157502231, -0.9007996658274201},
+    {1.2929421180929335, 1.2047709458726412,
+     -0.64150968540239695, -0.92017321536961005},
+    {1.3780877669841685, 1.2899165947638762,
+     -0.69680584995076544, -1.0726621673056991},
+    {1.1908355648783959, 1.1026643926581037,
+     -0.73234412992885112, -0.94663697395024204},
+    {1.1386522445025651, 1.0504810722822728,
+     -0.76389313858144581, -0.95622535398564001},
+    {1.2239684473728087, 1.1357972751525165,
+     -0.82718952082660424, -1.0585897995030451},
+    {1.1708925388093914, 1.0827213665890991,
+     -0.85119555516578038, -1.0564617741225424},
+    {1.2051674089819955, 1.1169962367617032,
+     -0.60856141137128517, -0.82990377509785884},
+    {1.1548895702427415, 1.0667183980224493,
+     -0.6529590682788422, -0.85156907151453054},
+    {1.2423854477186931, 1.1542142754984008,
+     -0.69266330933360909, -0.93493052363467977},
+    {1.2888817097421537, 1.2007105375218614,
+     -0.049511033733235121, -0.32482529180676772},
+    {1.2532320951684426, 1.1650609229481503,
+     -0.15461716928096497, -0.40381652880579777},
+    {1.3357959149118646, 1.2476247426915723,
+     -0.059655046867916214, -0.37972217291724703},
+    {1.299295511293745, 1.2111243390734527,
+     -0.18059149478957592, -0.46467193242081095},
+    {1.2740574342713573, 1.1858862620510651,
+     0.06495690041387088, -0.19881994571691064},
+    {1.242600947358939, 1.1544297751386468,
+     -0.041796743335116918, -0.28419765210740572},
+    {1.3205956591068495, 1.2324244868865573,
+     0.074317922467906736, -0.22966099925908368},
+    {1.1699173714471023, 1.08174619922681,
+     -0.21487908470029485, -0.41972544126978284},
+    {1.1298945709580128, 1.0417233987377206,
+     -0.28423372488813614, -0.47336223009608636},
+    {1.2144215080245042, 1.126250335804212,
+     -0.24336374185184517, -0.46953508908178854},
+    {1.1731210968977168, 1.0849499246774246,
+     -0.31833150861614812, -0.52456447312418086},
+    {1.1629659646476629, 1.0747947924273706,
+     -0.1186794997227424, -0.32058745129667393},
+    {1.1261915263359188, 1.0380203541156265,
+     -0.1918067800089101, -0.37961681656640051},
+    {1.2076775561480337, 1.1195063839277415,
+     -0.1346077259984417, -0.35723755966289272},
+    {1.390805268491466, 1.3026340962711738,
+     -0.26600622502086191, -0.66280513498570692},
+    {1.3478611309398543, 1.259689958719562,
+     -0.38998701594117069, -0.72414723427062966},
+    {1.4343049908096799, 1.3461338185893876,
+     -0.34318261331481559, -0.83412122113972453},
+    {1.3894493594182056, 1.3012781871979133,
+     -0.47953192830128416, -0.87398441497112},
+    {1.3829852857962766, 1.2948141135759843,
+     -0.073840849908218598, -0.4574876886716126},
+    {1.3453938715374489, 1.2572226993171567,
+     -0.21575015584683879, -0.54692442558186205},
+    {1.4299113878900442, 1.341740215669752,
+     -0.095522187018427601, -0.57492813140472399},
+    {1.173313614383362, 1.0851424421630698,
+     0.28704984150640117, 0.080732887518585705},
+    {1.2068833260601908, 1.1187121538398985,
+     0.32208710624464598, 0.099866406411828326},
+    {1.1396094094259186, 1.0514382372056263,
+     0.30452328911978249, 0.11183343225231711},
+    {1.1721842905758448, 1.0840131183555526,
+     0.36945674921621696, 0.16363140182670166},
+    {1.1930346259594033, 1.1048634537391111,
+     0.22134842811611546, 0.0060060730373314442},
+    {1.2068833260601908, 1.1187121538398985,
+     0.32208710624464598, 0.099866406411828326},
+    {1.1515458054782002, 1.0633746332579079,
+     0.21872324416664429, 0.021443594013809977},
+    {1.2729005309842845, 1.1847293587639922,
+     0.2848439331885203, 0.021924544125784068},
+    {1.3115521147369193, 1.2233809425166271,
+     0.33464221994610849, 0.039458830478688242},
+    {1.2418871751576381, 1.1537160029373459,
+     0.36539955567973192, 0.12344085922046548},
+    {1.2781929853558176, 1.1900218131355254,
+     0.42009406984250425, 0.15320287892013995},
+    {1.2560254529516768, 1.1678542807313845,
+     0.16314962913869438, -0.087904546056832192},
+    {1.3013732333367218, 1.2132020611164296,
+     0.1863815712195333, -0.099518853820244724},
+    {1.2358290343466694, 1.1476578621263771,
+     0.24664694920245764, 0.0083727228806010634},
+    {1.0946205218443703, 1.0064493496240781,
+     0.40735577368207232, 0.22998716062658955},
+    {1.1255867477292676, 1.0374155755089753,
+     0.4746301614927052, 0.287033468361517},
+    {1.0554887444030783, 0.96731757218278613,
+     0.41874045590453124, 0.25259040649113473},
+    {1.0818054174719127, 0.99363424525162058,
+     0.492071077224705, 0.31856908757996583},
+    {1.1038985612397088, 1.0157273890194165,
+     0.32067042244175492, 0.14037426456554608},
+    {1.1317482527976719, 1.0435770805773796,
+     0.39508511540157265, 0.20528864760647281},
+    {1.0661562453273872, 0.97798507310709504,
+     0.33564750897100243, 0.16660781624056614},
+    {1.2041999964471082, 1.1160288242268159,
+     0.52563650417422036, 0.30478599552184166},
+    {1.2392674800440573, 1.151096307823765,
+     0.61069054388043809, 0.37034008018729719},
+    {1.1608849012935347, 1.0727137290732425,
+     0.54155619985247794, 0.34050972613497688},
+    {1.1953303770679056, 1.1071592048476133,
+     0.62042491145449441, 0.40397475278649708},
+    {1.2093311201396806, 1.1211599479193883,
+     0.43160584899630228, 0.20811890487681953},
+    {1.243166668644498, 1.1549954964242057,
+     0.48794019441163516, 0.24518755925635616},
+    {1.1681618732221211, 1.0799907010018288,
+     0.45467901651364484, 0.25058369608249242},
+    {1.1838467191399018, 1.0956755469196096,
+     0.05301127453769644, -0.15801969259530238},
+    {1.2116249576560354, 1.1234537854357431,
+     0.14549754720225941, -0.079190395963941562},
+    {1.1416424980879767, 1.0534713258676844,
+     0.064768614161015037, -0.12868591993975204},
+    {1.1683140693512051, 1.0801428971309128,
+     0.13168905025964439, -0.072471139641982707},
+    {1.1972174336913655, 1.1090462614710732,
+     -0.035660986305237813, -0.25303116795542635},
+    {1.228418742570458, 1.1402475703501658,
+     0.058133318538613539, -0.17579533758055865},
+    {1.1529337581851906, 1.0647625859648984,
+     -0.030612574988490696, -0.22844199920896618},
+    {1.2729005309842845, 1.1847293587639922,
+     0.2848439331885203, 0.021924544125784068},
+    {1.2781929853558176, 1.1900218131355254,
+     0.42009406984250425, 0.15320287892013995},
+    {1.2358290343466694, 1.1476578621263771,
+     0.24664694920245764, 0.0083727228806010634},
+    {1.2418871751576381, 1.1537160029373459,
+     0.36539955567973192, 0.12344085922046548},
+    {1.3013732333367218, 1.2132020611164296,
+     0.1863815712195333, -0.099518853820244724},
+    {1.3115521147369193, 1.2233809425166271,
+     0.33464221994610849, 0.039458830478688242},
+    {1.2560254529516768, 1.1678542807313845,
+     0.16314962913869438, -0.087904546056832192},
+    {1.0843741608391508, 0.9962029886188587,
+     0.1715511801481473, -0.0027100088846304313},
+    {1.109660812661156, 1.0214896404408638,
+     0.23330350876236755, 0.051132015291950925},
+    {1.040552684083637, 0.95238151186334485,
+     0.18811386940242097, 0.02581724674077087},
+    {1.0734050922279332, 0.9852339200076411,
+     0.25168721712942949, 0.080614631100779877},
+    {1.0997233850026231, 1.0115522127823309,
+     0.089922864812782097, -0.0890421007675785},
+    {1.1270230389768459, 1.0388518667565536,
+     0.15289246831138215, -0.035211800974667688},
+    {1.0563827292475396, 0.96821155702724748,
+     0.11217682019577099, -0.054210872750199757},
+    {1.1687163553424562, 1.080545183122164,
+     1.6655109046129739, 1.4611790297047167},
+    {1.2064170934115011, 1.1182459211912088,
+     1.7478968640368813, 1.5259155710024437},
+    {1.1223144339911042, 1.034143261770812,
+     1.7010933886974804, 1.5146415137873224},
+    {1.1584919358285011, 1.0703207636082088,
+     1.7770041693698191, 1.576938180470367},
+    {1.1737301680764449, 1.0855589958561527,
+     1.5492980933631944, 1.3427991491943652},
+    {1.2141819192905465, 1.1260107470702543,
+     1.6223818178147136, 1.3963383942836458},
+    {1.1292209801453912, 1.0410498079250989,
+     1.5952097846807254, 1.4063226800745348},
+    {1.2932678620310061, 1.2050966898107138,
+     1.8230416614568363, 1.5441057034528196},
+    {1.32942332804037, 1.2412521558200778,
+     1.9655622041931793, 1.6524515774742088},
+    {1.2428872981132169, 1.1547161258929246,
+     1.8484245652368247, 1.605845760544913},
+    {1.2769227650382959, 1.1887515928180037,
+     1.9712976011672536, 1.7053712519365423},
+    {1.3017278440695894, 1.2135566718492972,
+     1.6628035205918925, 1.3765900171090748},
+    {1.3432911429167576, 1.2551199706964653,
+     1.7883749147353847, 1.4597020606384479},
+    {1.2543708076927413, 1.1661996354724491,
+     1.711006707974319, 1.4610547870809438},
+    {1.0624832652032297, 0.97431209298293753,
+     1.8223272665218995, 1.6542959618965696},
+    {1.0945750674853405, 1.0064038952650483,
+     1.8958853557817554, 1.718530813778675},
+    {1.0133292873598996, 0.92515811513960777,
+     1.8411365332008567, 1.6853359446581428},
+    {1.0471981053108474, 0.95902693309055531,
+     1.906388067814786, 1.742403775852627},
+    {1.0745901775609099, 0.98641900534061777,
+     1.7314132531016049, 1.5600027967191941},
+    {1.1110600660788192, 1.022888893858527,
+     1.8005611102695278, 1.61792740552155},
+    {1.0259387991168194, 0.93776762689652726,
+     1.7575428247024893, 1.5988138425876035},
+    {1.1734589646932017, 1.0852877924729094,
+     1.9793842276401201, 1.7730038113602293},
+    {1.2009048446132422, 1.11273367239295,
+     2.0902340346254515, 1.8710410472845209},
+    {1.1231334719943009, 1.0349622997740087,
+     1.9824727313258785, 1.7957358165349895},
+    {1.1493051806121879, 1.0611340083918956,
+     2.0807347342053819, 1.8843353906397953},
+    {1.1927129889511605, 1.1045418167308683,
+     1.8678695953525786, 1.6526814492916286},
+    {1.2248186404806578, 1.1366474682603656,
+     1.975746468277841, 1.7438677495683432},
+    {1.1431661424531421, 1.0549949702328498,
+     1.8832980912787731, 1.6892659722476984},
+    {1.1282371226870551, 1.0400659504667629,
+     1.3726109170235004, 1.1840751471844759},
+    {1.1733138012541913, 1.085142629033899,
+     1.429188907407428, 1.2228718718566463},
+    {1.0864104002202242, 0.99823922799993203,
+     1.4286441381074979, 1.2537755724814101},
+    {1.1312870475642831, 1.0431158753439909,
+     1.484872747162806, 1.2952429732314488},
+    {1.1200584758812631, 1.0318873036609708,
+     1.2612016303359845, 1.0755297468311933},
+    {1.1673112202254055, 1.0791400480051132,
+     1.3085403975203547, 1.1048068003205085},
+    {1.0810834462412948, 0.99291227402100268,
+     1.3238251273141117, 1.1505351234737746},
+    {1.2567121742814091, 1.1685410020611169,
+     1.4254985283841222, 1.1739838260504876},
+    {1.3021009538837083, 1.213929781663416,
+     1.4982663415455135, 1.2117226470980922},
+    {1.2159631321771036, 1.1277919599568114,
+     1.4951481957102755, 1.2681499402497414},
+    {1.2589263163182305, 1.1707551440979382,
+     1.56811515613969, 1.3151032216054046},
+    {1.2483634443386298, 1.1601922721183375,
+     1.2887295038754161, 1.0426937542304167},
+    {1.2949218516292613, 1.2067506794089691,
+     1.3381668483623725, 1.0578388958252769},
+    {1.2125276890974448, 1.1243565168771525,
+     1.3643687701262626, 1.139204305151678},
+    {1.040884847116716, 0.952713674896424,
+     1.5746565660954948, 1.4122765823296566},
+    {1.0829225678394443, 0.99475139561915216,
+     1.6344842506887971, 1.4606530394266406},
+    {0.99348070658215037, 0.90530953436185835,
+     1.6111167886266091, 1.459665468994009},
+    {1.0352876540711575, 0.9471164818508655,
+     1.6683853088281049, 1.507396324260782},
+    {1.0423512106345496, 0.95418003841425747,
+     1.47776214237027, 1.3150129127666959},
+    {1.0869776667137709, 0.9988064944934788,
+     1.5329320343102149, 1.3578933781750528},
+    {0.99656195594281505, 0.90839078372252302,
+     1.5209778647962342, 1.3688712696501459},
+    {1.1683928395645808, 1.0802216673442886,
+     -2.6715364621464781, -2.87573024376871},
+    {1.1303197025791716, 1.0421485303588793,
+     -2.6185624542454025, -2.8078436796876489},
+    {1.1581954692421024, 1.0700242970218101,
+     -2.787226973043198, -2.9871722337750319},
+    {1.1228426040858501, 1.0346714318655579,
+     -2.7241289069479491, -2.9107644804234658},
+    {1.2138469894683301, 1.1256758172480379,
+     -2.606698596951027, -2.8325634553487982},
+    {1.1733406259265162, 1.085169453706224,
+     -2.555377424576565, -2.761706168957712},
+    {1.2061106263018007, 1.1179394540815084,
+     -2.7361805766137923, -2.9580048082232526},
+    {1.0938804340843067, 1.0057092618640144,
+     -2.4796321057733355, -2.6567719369038532},
+    {1.0556824285799749, 0.96751125635968271,
+     -2.4510251906674121, -2.6172266572897041},
+    {1.0925096733104924, 1.0043385010902002,
+     -2.5746021147865075, -2.7513200155749717},
+    {1.055396889743182, 0.96722571752288988,
+     -2.5376680786396659, -2.7037937567558656},
+    {1.1316896392883573, 1.0435184670680651,
+     -2.4121648071869211, -2.601940071749858},
+    {1.0914837278206746, 1.0033125556003823,
+     -2.3878185182309615, -2.5642221546579202},
+    {1.1332009427885408, 1.0450297705682485,
+     -2.5138385720419696, -2.7041622727744374},
+    {1.0943142930602299, 1.0061431208399376,
+     -2.9288105979817836, -3.1060844637024232},
+    {1.0641955414744104, 0.97602436925411828,
+     -2.8618006208710356, -3.0303002336554656},
+    {1.0738495932933234, 0.98567842107303127,
+     -3.0241602152408142, 3.087825962101491},
+    {1.0469423916455665, 0.95877121942527432,
+     -2.9527207951802801, -3.1166393627723394},
+    {1.142899311366091, 1.0547281391457988,
+     -2.899504256661134, -3.093434943524485},
+    {1.1107720030569621, 1.0226008308366699,
+     -2.8282433033845402, -3.0107816322630532},
+    {1.1228974328752577, 1.0347262606549654,
+     -3.0059429143241903, 3.0905877260976058},
+    {1.0442433046751542, 0.95607213245486211,
+     -2.7153038433228098, -2.8785325309516741},
+    {1.0109828036961923, 0.92281163147590028,
+     -2.6703690847868367, -2.8256393186134914},
+    {1.0332390399178903, 0.94506786769759832,
+     -2.8035643228512854, -2.9640513809646847},
+    {1.0020006030128055, 0.91382943079251333,
+     -2.7528242335770332, -2.9061049597152961},
+    {1.0871345576344131, 0.998963385414121,
+     -2.6711208226338212, -2.8462065896879012},
+    {1.0516277408348245, 0.96345656861453233,
+     -2.6262091488128272, -2.7913421048971871},
+    {1.0776703340059681, 0.98949916178567598,
+     -2.7674287453299429, -2.9397247716959423},
+    {1.3013950085625752, 1.2132238363422829,
+     -2.5868501235554744, -2.8727697527142313},
+    {1.2585784485016187, 1.1704072762813265,
+     -2.5254880414109211, -2.7782634817502947},
+    {1.2929730563019508, 1.2048018840816586,
+     -2.7542054309446362, -3.0328948111887781},
+    {1.25405235466862, 1.1658811824483277,
+     -2.6713057144816648, -2.9210466835363458},
+    {1.3472539552009677, 1.2590827829806754,
+     -2.4739569440717029, -2.8073771683903121},
+    {1.3017388799188945, 1.2135677076986022,
+     -2.4221724076471149, -2.7083956660314943},
+    {1.3429815336825295, 1.2548103614622372,
+     -2.669774030715991, -2.998081882446086},
+    {1.2117053748538118, 1.1235342026335196,
+     -2.3559345295494358, -2.5806648329953124},
+    {1.1682280324685044, 1.0800568602482121,
+     -2.3334979802279823, -2.5376214935961818},
+    {1.2156051526550022, 1.12743398043471,
+     -2.4786198148977254, -2.7054254679078094},
+    {1.173160299385712, 1.0849891271654197,
+     -2.4417994053841832, -2.6480494665716106},
+    {1.247979896040319, 1.1598087238200268,
+     -2.2533625309586318, -2.4991527101823294},
+    {1.2027711457394594, 1.1145999735191672,
+     -2.241739982725921, -2.4618683916512438},
+    {1.2563424564011625, 1.1681712841808702,
+     -2.3845138133111794, -2.6357803520068153},
+    {1.2245735339064687, 1.1364023616861765,
+     -2.9539435852825964, 3.0975011551797547},
+    {1.1924387948553017, 1.1042676226350094,
+     -2.8628742225349662, -3.0779310979518471},
+    {1.2006982989820303, 1.112527126761738,
+     -3.0810847756328674, 2.9830105331626933},
+    {1.1732189041146881, 1.0850477318943959,
+     -2.9831508932574717, 3.0937587886251379},
+    {1.2766711474585726, 1.1884999752382803,
+     -2.915362398410323, 3.1020868067463643},
+    {1.2426039921568099, 1.1544328199365177,
+     -2.815990625956946, -3.0583934248383864},
+    {1.2533215380525078, 1.1651503658322155,
+     -3.063421700026566, 2.9705053116261104},
+    {1.0988368396340982, 1.0106656674138059,
+     -1.2581747441056477, -1.4368599736951455},
+    {1.0460903687543179, 0.9579191965340258,
+     -1.2389761407598683, -1.402676175498212},
+    {1.1101606036250051, 1.0219894314047129,
+     -1.3655515513355481, -1.5478878294888634},
+    {1.0588879231038288, 0.97071675088353671,
+     -1.336670192168659, -1.5037281780759324},
+    {1.136182544597778, 1.0480113723774858,
+     -1.1685067896436998, -1.3599231197049277},
+    {1.0826207019310852, 0.99444952971079303,
+     -1.156610193765478, -1.3303523013341811},
+    {1.1512149588608209, 1.0630437866405287,
+     -1.2810895788943393, -1.4782386859555725},
+    {0.9758584783651959, 0.88768730614490388,
+     -1.1378152236602219, -1.285651271989696},
+    {0.92333869094030729, 0.83516751872001527,
+     -1.1301928565971759, -1.2684514276025554},
+    {0.99338390919630559, 0.90521273697601357,
+     -1.2226249571086525, -1.374055805986715},
+    {0.94108993003903862, 0.8529187578187466,
+     -1.2085017247206997, -1.3498121531105725},
+    {1.0083325555059883, 0.92016138328569619,
+     -1.0603673912189491, -1.2150439590198872},
+    {0.95517819650591629, 0.86700702428562426,
+     -1.0584865175256368, -1.2023495489188596},
+    {1.0290613821494523, 0.94089020992916017,
+     -1.1465211543919449, -1.3059963546156164},
+    {1.0704831814770719, 0.98231200925677975,
+     -1.5410699074968983, -1.7113161311184988},
+    {1.0227160609199388, 0.93454488869964669,
+     -1.5003193456719706, -1.6582870704225312},
+    {1.0691658008841092, 0.98099462866381704,
+     -1.6436246824508811, -1.81350140846373},
+    {1.0240254460299645, 0.93585427380967234,
+     -1.5957985080103487, -1.7540744478501749},
+    {1.1162359881649573, 1.028064815944665,
+     -1.4765575267871511, -1.6609247161968452},
+    {1.0670763887114583, 0.97890521649116613,
+     -1.4380280211841627, -1.6073225895934329},
+    {1.1169770440252356, 1.0288058718049433,
+     -1.5885324105868617, -1.7731508924529011},
+    {0.96683595279095713, 0.8786647805706651,
+     -1.3769298520965181, -1.5229981723470936},
+    {0.91667246760373611, 0.82850129538344408,
+     -1.3523361929470963, -1.4894934788901035},
+    {0.97420899234403957, 0.88603782012374754,
+     -1.465043178273292, -1.6125519646523931},
+    {0.92544004868887664, 0.83726887646858461,
+     -1.4342593942249455, -1.5728700752309934},
+    {1.0072626049440083, 0.91909143272371618,
+     -1.3121405323516211, -1.4665790180234082},
+    {0.9557122396145602, 0.86754106739426817,
+     -1.2910375336982949, -1.434999707593694},
+    {1.0171147414412651, 0.92894356922097332,
+     -1.4052019674337013, -1.5618676547371326},
+    {1.2236508726139861, 1.1354797003936938,
+     -1.0693040289032871, -1.3005261435893658},
+    {1.1700738133503765, 1.0819026411300843,
+     -1.0667590132314, -1.2716725976895853},
+    {1.2417881188790603, 1.153616946658768,
+     -1.2005201886073147, -1.4424176526706218},
+    {1.189370769043866, 1.1011995968235737,
+     -1.1828307287472317, -1.396430722063448},
+    {1.2530041959420548, 1.1648330237217626,
+     -0.93998780950361693, -1.1890371358162155},
+    {1.1996222374404037, 1.1114510652201115,
+     -0.95269141571191684, -1.1712465744027099},
+    {1.2764969897382266, 1.1883258175179343,
+     -1.0722270329829979, -1.337831624111264},
+    {1.0917651780584743, 1.003594005838182,
+     -0.9700878351547112, -1.1465775547275694},
+    {1.0379135403495356, 0.94974236812924351,
+     -0.97616906266649417, -1.1378070153214412},
+    {1.1161041557121869, 1.0279329834918947,
+     -1.0644661126035304, -1.2487886798106036},
+    {1.0620799453749987, 0.97390877315470659,
+     -1.0623508826741908, -1.2302723292711362},
+    {1.1174746621338025, 1.0293034899135103,
+     -0.87022033379179164, -1.0550080000379356},
+    {1.0640302235555266, 0.97585905133523443,
+     -0.88559693634433856, -1.0540511992466999},
+    {1.1457728616393119, 1.0576016894190197,
+     -0.96244517221429882, -1.157474542847041},
+    {1.2096895674986474, 1.1215183952783552,
+     -1.4419486557306767, -1.6656223498109484},
+    {1.1606052323626279, 1.0724340601423357,
+     -1.4000540204721386, -1.6009853485556893},
+    {1.2099079534244266, 1.1217367812041343,
+     -1.5772972531830975, -1.8010848928352006},
+    {1.1640507707381988, 1.0758795985179066,
+     -1.5223099609669009, -1.7246702616751544},
+    {1.2530333795386579, 1.1648622073183657,
+     -1.343671589661501, -1.592740117642792},
+    {1.2027786362518322, 1.11460746403154,
+     -1.3089710622896944, -1.5291032432197764},
+    {1.2568037055933634, 1.1686325333730712,
+     -1.4937423515751473, -1.7453185729862191},
+    {1.0945158384142197, 1.0063446661939275,
+     0.87941618337286376, 0.70207997268365974},
+    {1.1187785962276111, 1.0306074240073189,
+     0.97459740211708901, 0.78936472108839262},
+    {1.0439826221534201, 0.95581144993312828,
+     0.86841631999775459, 0.70525389195603694},
+    {1.0683034495462196, 0.98013227732592745,
+     0.95576250128676632, 0.78612662021109547},
+    {1.1169279415619948, 1.0287567693417026,
+     0.79887919485749814, 0.6142773879906781},
+    {1.1441320502686545, 1.0559608780483623,
+     0.89252652789726838, 0.69812622747302611},
+    {1.0674873967448772, 0.97931622452458511,
+     0.79353554022727468, 0.62412682950901799},
+    {1.1880763519505997, 1.0999051797303074,
+     1.1118350520760614, 0.89884322258533667},
+    {1.2030987943653346, 1.1149276221450424,
+     1.2352688480982901, 1.0149753123381771},
+    {1.1394902736962895, 1.0513191014759973,
+     1.0787554956401917, 0.88611023551518209},
+    {1.1558865418225834, 1.0677153696022912,
+     1.1907583937349813, 0.99174782300680775},
+    {1.2161718708855527, 1.1280006986652604,
+     1.0240735745627751, 0.79696284765891512},
+    {1.2350615433905896, 1.1468903711702974,
+     1.1517305110939484, 0.91391444928152965},
+    {1.1681413455720042, 1.079970173351712,
+     0.99702555240776636, 0.79293897781391653},
+    {0.96502182352274657, 0.87685065130245454,
+     0.92608492455950786, 0.78036551883779348},
+    {0.98662525871900264, 0.89845408649871061,
+     1.007160945807503, 0.85714241123576063},
+    {0.91276733360562101, 0.82459616138532899,
+     0.91426891129850296, 0.77774585493899973},
+    {0.93423348568527742, 0.84606231346498539,
+     0.98968329560819845, 0.8495727286501793},
+    {0.9927731577392408, 0.90460198551894877,
+     0.85910327684565835, 0.70780142978563521},
+    {1.0169618348161404, 0.9287906625958483,
+     0.93977613032695717, 0.78314561686067008},
+    {0.9411481870433116, 0.85297701482301957,
+     0.85115932266708227, 0.70983858283987311},
+    {1.0567327336109134, 0.96856156139062122,
+     1.1213863343967574, 0.95490537998430658},
+    {1.0710885612732346, 0.98291738905294246,
+     1.2207301459374778, 1.0503134870893351},
+    {1.0053775206779245, 0.91720634845763249,
+     1.0940096680251599, 0.93998843919287856},
+    {1.0207274828416102, 0.93255631062131816,
+     1.1858598443569217, 1.0283574051552533},
+    {1.0895428058115388, 1.0013716335912466,
+     1.0509735353766037, 0.87516088398170166},
+    {1.1070026076850219, 1.0188314354647297,
+     1.1532751921187003, 0.97197438884338538},
+    {1.038494198146275, 0.95032302592598317,
+     1.0273830044498522, 0.86560068863500494},
+    {1.1036053579363745, 1.0154341857160822,
+     0.63605385236995438, 0.45585192692719617},
+    {1.1354369481953703, 1.0472657759750781,
+     0.71497103193131673, 0.52382926514010997},
+    {1.0561939646519387, 0.96802279243164657,
+     0.64249925313669187, 0.4761618062148133},
+    {1.0873661311913603, 0.99919495897106814,
+     0.7157965572641245, 0.54064119948628653},
+    {1.1162881457901548, 1.0281169735698625,
+     0.55530721360551816, 0.37092236320914218},
+    {1.1500499303928455, 1.0618787581725533,
+     0.62877246475339055, 0.43208150308073745},
+    {1.0706065815162005, 0.98243540929590834,
+     0.56733727407965695, 0.39705634183555705},
+    {1.2126760026689161, 1.1245048304486238,
+     0.81340475953781999, 0.58816179382016553},
+    {1.2397833928051565, 1.1516122205848642,
+     0.92762810148069552, 0.68696274177390237},
+    {1.1653881779056512, 1.0772170056853589,
+     0.80539361398097031, 0.6024725059697178},
+    {1.1926163083502721, 1.1044451361299799,
+     0.90832612930777601, 0.69318428929558751},
+    {1.2282116460389931, 1.1400404738187009,
+     0.7135785739953352, 0.47976890529729382},
+    {1.2586289485095934, 1.1704577762893011,
+     0.82337432180499337, 0.5705645789116609},
+    {1.1824455086610242, 1.0942743364407319,
+     0.71422817890980261, 0.50383805127091907},
+    {0.9888750073828495, 0.90070383516255748,
+     0.71765740676728007, 0.56717245244426562},
+    {1.017285247359744, 0.92911407513945188,
+     0.78912544852460953, 0.63242051597890092},
+    {0.93892106747633286, 0.85074989525604083,
+     0.71867543183480509, 0.57774748251925778},
+    {0.96656202049332263, 0.8783908482730306,
+     0.78547169574351683, 0.6394561992364507},
+    {1.0080307136094342, 0.91985954138914205,
+     0.64827764248227648, 0.49366833184376357},
+    {1.0384371333820477, 0.95026596116175588,
+     0.7166950039960388, 0.55492688946688584},
+    {0.95934555233646956, 0.87117438011617754,
+     0.65351538663800834, 0.50887396284236819},
+    {1.0739136956679056, 0.98574252344761348,
+     -1.9964064957569512, -2.1676238929656089},
+    {1.0404819428467267, 0.95231077062643488,
+     -1.9291306661532337, -2.0914095486471798},
+    {1.0548558582240759, 0.96668468600378377,
+     -2.08062500017052, -2.2466073026895952},
+    {1.0245259041059986, 0.93635473188570661,
+     -2.0125827394493023, -2.1709768714553968},
+    {1.1241554066898152, 1.0359842344695229,
+     -1.9767230642022255, -2.1638170312983682},
+    {1.0903754740241101, 1.0022043018038178,
+     -1.9042035122924033, -2.0802691332029597},
+    {1.1042813034381918, 1.0161101312178995,
+     -2.0701494358551931, -2.2505687747643086},
+    {1.0145188644570866, 0.92634769223679458,
+     -1.7810970873035734, -1.9371682606779073},
+    {0.97351742866243784, 0.88534625644214582,
+     -1.7291908442394359, -1.876562972552611},
+    {1.0044531956747307, 0.91628202345443854,
+     -1.868062740603899, -2.021880395401169},
+    {0.96631087994816245, 0.87813970772787042,
+     -1.8127898744958602, -1.9587569854875291},
+    {1.0634022846737841, 0.97523111245349192,
+     -1.74359555631426, -1.9118778276231945},
+    {1.0211889577231548, 0.93301778550286263,
+     -1.6899154854421636, -1.8475256001791658},
+    {1.0536495552532752, 0.96547838303298306,
+     -1.8392015534681823, -2.0048652443524229},
+    {0.98669469603757132, 0.89852352381727929,
+     -2.1590767459493292, -2.3091096217312219},
+    {0.95911816470587319, 0.87094699248558116,
+     -2.0963669463193271, -2.2409656158305826},
+    {0.96590900619525144, 0.87773783397495941,
+     -2.2224311498603022, -2.3683209204214792},
+    {0.94069313403745225, 0.85252196181716022,
+     -2.1608396955949085, -2.3020799442046678},
+    {1.0338915360639187, 0.94572036384362668,
+     -2.1568431364587539, -2.31748964806311},
+    {1.0064039848481992, 0.91823281262790701,
+     -2.0892216633915024, -2.2434697485057566},
+    {1.0116304384098993, 0.92345926618960728,
+     -2.2254093749513779, -2.3808255413111969},
+    {0.9436831309394883, 0.85551195871919627,
+     -1.9674286483199221, -2.1091999999326809},
+    {0.9091778347542423, 0.82100666253395027,
+     -1.9131989173178821, -2.0491459784183652},
+    {0.92918226662446168, 0.84101109440416966,
+     -2.0374555298742889, -2.1766992580410367},
+    {0.89720695058060562, 0.8090357783603136,
+     -1.9823876348428828, -2.1164607660832515},
+    {0.99150590769148361, 0.90333473547119159,
+     -1.9498998755397139, -2.100934935704184},
+    {0.95621466479698192, 0.86804349257668989,
+     -1.8924175093403013, -2.0364731183893308},
+    {0.97621815159054914, 0.88804697937025712,
+     -2.0260705823515166, -2.1739782371372036},
+    {1.2051515076638408, 1.1169803354435486,
+     -2.0408377932947528, -2.2621720530364615},
+    {1.1749927050544016, 1.0868215328341093,
+     -1.9523519384686996, -2.1594046650459093},
+    {1.1808028045628298, 1.0926316323425376,
+     -2.1456719309537751, -2.3553162335584505},
+    {1.1544606289119699, 1.0662894566916776,
+     -2.0571862898488118, -2.2556245075241486},
+    {1.2560948567370498, 1.1679236845167575,
+     -2.0197213783028838, -2.2708220148716034},
+    {1.2261373363085895, 1.1379661640882972,
+     -1.9215278956516935, -2.154152961273927},
+    {1.2308098627294688, 1.1426386905091765,
+     -2.1395072623547908, -2.3748192950606035},
+    {1.1536661205075036, 1.0654949482872114,
+     -1.7623793879784035, -1.9605002950081076},
+    {1.1125834053783177, 1.0244122331580254,
+     -1.698699845509698, -1.8818398333162956},
+    {1.1409072116690651, 1.0527360394487728,
+     -1.8738314334607977, -2.0670086227864952},
+    {1.1035061399900452, 1.015334967769753,
+     -1.8045631129155408, -1.9847331765705487},
+    {1.2037035124150968, 1.1155323401948045,
+     -1.7101340478306537, -1.9307330603049087},
+    {1.1616043585402829, 1.0734331863199906,
+     -1.6442544636030803, -1.8455978329182672},
+    {1.1917522565600409, 1.1035810843397487,
+     -1.8361564492630755, -2.0508854161110568},
+    {1.1059652294804929, 1.0177940572602007,
+     -2.2324497846893219, -2.4134133961444193},
+    {1.0821117361082839, 0.99394056388799179,
+     -2.1540035526815995, -2.3275956680125693},
+    {1.0796256549369097, 0.99145448271661751,
+     -2.3044247629563919, -2.4772885780501128},
+    {1.0583783493607064, 0.97020717714041427,
+     -2.2287194819351526, -2.3956406035076188},
+    {1.1541762745100461, 1.0660051022897539,
+     -2.2367271507562121, -2.4350516719042421},
+    {1.1311563300620104, 1.0429851578417182,
+     -2.1503698294686693, -2.3399524186168232},
+    {1.1261658637734799, 1.0379946915531877,
+     -2.315397565081827, -2.5031985375866808},
+    {1.0085102801974515, 0.92033910797715945,
+     2.2954576932062976, 2.1407414903747384},
+    {1.0199604631385077, 0.93178929091821594,
+     2.3839437448407503, 2.2266198745171666},
+    {0.96293528993713007, 0.87476411771683804,
+     2.2731701290568345, 2.1278493845191213},
+    {0.97462961922328284, 0.88645844700299081,
+     2.3541304783349855, 2.2065384144207423},
+    {1.04095800836588, 0.9527868361455879,
+     2.2295552657172477, 2.0671569071629268},
+    {1.0555962257300642, 0.96742505350977204,
+     2.3220473724155539, 2.1558687947053903},
+    {0.9939236235419735, 0.90575245132168147,
+     2.2114132591080802, 2.0598681824317717},
+    {1.0732754260979107, 0.98510425387761857,
+     2.520192326140815, 2.3491566128108698},
+    {1.0755486796716254, 0.98737750745133324,
+     2.6223877283289276, 2.4507028464752629},
+    {1.0278520397262261, 0.93968086750593405,
+     2.4757735181740461, 2.316588335278321},
+    {1.0318720545827993, 0.94370088236250715,
+     2.5695409116303729, 2.4093866652422316},
+    {1.1140241811035221, 1.0258530088832298,
+     2.4622628782987048, 2.2786410646960009},
+    {1.1191674677505066, 1.0309962955302143,
+     2.5734326628463764, 2.3880667889912459},
+    {1.0665226815701834, 0.97835150934989124,
+     2.4194391625376195, 2.2502980777451329},
+    {0.88845751183139932, 0.80028633961110729,
+     2.3070392398805195, 2.174291500687433},
+    {0.89783643196976592, 0.8096652597494739,
+     2.3788546459833433, 2.2446847400939771},
+    {0.84786630688129883, 0.7596951346610068,
+     2.288184695247113, 2.1611349952027035},
+    {0.85731269803392118, 0.76914152581362916,
+     2.3549882338603334, 2.226675331237475},
+    {0.91902072377772692, 0.8308495515574349,
+     2.2542560768358459, 2.1167135541620157},
+    {0.9307448833616806, 0.84257371114138857,
+     2.3287947096535402, 2.1892843490913996},
+    {0.87686605255328676, 0.78869488033299473,
+     2.238030872145417, 2.106983944406156},
+    {0.9461362327067746, 0.85796506048648258,
+     2.4861336533070051, 2.3439226209677178},
+    {0.94931156850052978, 0.86114039628023775,
+     2.567203736269497, 2.4244182270619259},
+    {0.90474050617965074, 0.81656933395935871,
+     2.4528776733674542, 2.3176335761970721},
+    {0.90896452184669407, 0.82079334962640205,
+     2.5283754381885277, 2.3924623987209861},
+    {0.98328849884693015, 0.89511732662663812,
+     2.4382972031760466, 2.2889637623624544},
+    {0.98860845447703716, 0.90043728225674513,
+     2.5246264885117222, 2.3741969873507163},
+    {0.93987840569608228, 0.85170723347579025,
+     2.4063491121012039, 2.265252673495826},
+    {1.0500879908289407, 0.96191681860864853,
+     2.0676395029482548, 1.9029080117466146},
+    {1.0713390403360032, 0.98316786811571111,
+     2.1557129061036955, 1.9852256106543906},
+    {1.0028302237267737, 0.91465905150648152,
+     2.0630252156733286, 1.9095633898807798},
+    {1.02316881228584, 0.9349976400655482,
+     2.143021489268135, 1.9849473582562802},
+    {1.0740823542039037, 0.98591118198361161,
+     1.9851676900851172, 1.813902207954365},
+    {1.0989663975836521, 1.0107952253633599,
+     2.0734074814398382, 1.8946814351316741},
+    {1.0264997421269531, 0.93832856990666091,
+     1.987567266351675, 1.8287048621209456},
+    {1.1394766038064579, 1.0513054315861656,
+     2.2786000674335356, 2.0859599229396379},
+    {1.1533961888334336, 1.0652250166131414,
+     2.3938288802856609, 2.1958155192783386},
+    {1.0895418308118394, 1.0013706585915472,
+     2.2515277510902756, 2.0757153954085279},
+    {1.1039845698108803, 1.0158133975905881,
+     2.3542271027912545, 2.1739032810326115},
+    {1.1721130081149813, 1.0839418358946891,
+     2.1910199523700062, 1.9852255475987992},
+    {1.1905052999701171, 1.1023341277498249,
+     2.3126533869510078, 2.0985171910657914},
+    {1.1210508667800789, 1.0328796945597867,
+     2.1713550240476192, 1.9853409461222871},
+    {0.93200307307789099, 0.84383190085759896,
+     2.1238035933436317, 1.9840775537579038},
+    {0.94858546007350397, 0.86041428785321195,
+     2.1962157947834515, 2.0535621878787595},
+    {0.88918256927296269, 0.80101139705267066,
+     2.1164007850281776, 1.983544593930858},
+    {0.90504448452928932, 0.81687331230899729,
+     2.1833266066844255, 2.0480346700052587},
+    {0.95731406472037606, 0.86914289250008403,
+     2.0592854123469131, 1.9150247989378686},
+    {0.97668799183013266, 0.88851681960984064,
+     2.132554726568173, 1.984553399031322},
+    {0.91362296939813081, 0.82545179717783879,
+     2.0562216181005057, 1.9195602790737314},
+    {1.0083877696091901, 0.92021659738889794,
+     2.9322174146535032, 2.7775285360521442},
+    {0.99347360110583693, 0.90530242888554491,
+     3.014502281591692, 2.8630524648648898},
+    {0.97389338452049812, 0.88572221230020609,
+     2.8652463357237949, 2.7177999559441104},
+    {0.96111729909653576, 0.87294612687624373,
+     2.9455070482026104, 2.8005313687206184},
+    {1.0554814826611021, 0.96731031044080995,
+     2.9171503454196768, 2.751002223036116},
+    {1.0408098889089028, 0.952638716688611,
+     3.0058214081464798, 2.8434602452704021},
+    {1.0198707768437609, 0.93169960462346879,
+     2.8463692852145268, 2.6890662621654347},
+    {1.0022899593223771, 0.91411878710208505,
+     -3.115754628738217, 3.0140868486507024},
+    {0.97849983744711855, 0.89032866522682652,
+     -3.0410706286114619, 3.0937506997068018},
+    {0.9751115263817598, 0.88694035416146777,
+     3.0937834056322058, 2.9460957838581865},
+    {0.95357126868637332, 0.86540009646608129,
+     -3.1139165146894849, 3.0257030109417493},
+    {1.0498830269994477, 0.96171185477915555,
+     -3.1131572180424669, 3.0053498623498873},
+    {1.026269703726161, 0.93809853150586919,
+     -3.0390064298360122, 3.0853712216593947},
+    {1.0229906994359319, 0.93481952721563977,
+     3.0879868417711265, 2.9299545920562506},
+    {0.88933716344734093, 0.8011659912270489,
+     2.8215259807407205, 2.6886466339511608},
+    {0.87702166395644165, 0.78885049173614963,
+     2.8959124856965528, 2.7648431299445249},
+    {0.85071689258435434, 0.76254572036406232,
+     2.766429765511325, 2.6390027002050243},
+    {0.83996471684439467, 0.75179354462410264,
+     2.8382757361873749, 2.7122551535347887},
+    {0.93715688700982736, 0.84898571478953533,
+     2.8034876870398273, 2.6628688407060581},
+    {0.92627487382605878, 0.83810370160576675,
+     2.8811787625533305, 2.7424275270627754},
+    {0.89859232363357422, 0.81042115141328219,
+     2.7467629529775879, 2.6124765833551402},
+    {0.89489576607601307, 0.80672459385572104,
+     3.0323688843067744, 2.8986494203115347},
+    {0.87471552151523857, 0.78654434929494654,
+     3.1042833564157095, 2.9735452733159478},
+    {0.86168782985771653, 0.7735166576374245,
+     2.969108924972911, 2.8401984921041974},
+    {0.84347477527200532, 0.75530360305171329,
+     3.0403771808341529, 2.9139024817929378},
+    {0.94496577960453942, 0.8567946073842474,
+     3.0237754222950262, 2.881774621935671},
+    {0.92562419529189277, 0.83745302307160074,
+     3.0991956823209845, 2.9605540304483817},
+    {0.91215178492920568, 0.82398061270891365,
+     2.9577581830114328, 2.8213343732227605},
+    {1.1139594667150934, 1.0257882944948011,
+     2.7944898085713668, 2.6108896993807571},
+    {1.1038792420617605, 1.0157080698414682,
+     2.8991888239251122, 2.7188988785377464},
+    {1.0732356277448256, 0.98506445552453348,
+     2.7239215433317732, 2.5528971435542447},
+    {1.0664442915390491, 0.97827311931875693,
+     2.8227554121375742, 2.6536360298208437},
+    {1.1620284612413496, 1.0738572890210574,
+     2.7600587885722447, 2.5585399463823304},
+    {1.153302484725373, 1.0651313125050808,
+     2.8773665186975581, 2.6793904605594996},
+    {1.1191456292683921, 1.0309744570480999,
+     2.6850887559481325, 2.4997303678355434},
+    {1.1208777541938486, 1.0327065819735564,
+     3.0877177341327657, 2.9017634525592815},
+    {1.0987610138621731, 1.0105898416418808,
+     -3.1048751430168404, 2.9996488131439114},
+    {1.0893992458826802, 1.001228073662388,
+     2.9973283197398417, 2.8215591969389568},
+    {1.071163180584229, 0.98299200836393685,
+     3.0877647744460215, 2.9173270797439543},
+    {1.1719433184713155, 1.0837721462510232,
+     3.087917924992071, 2.8821971382555742},
+    {1.1490992817944532, 1.0609281095741609,
+     -3.0944619517098211, 2.9924044630025177},
+    {1.1393408281937103, 1.051169655973418,
+     2.987164283574002, 2.7945749331731258},
+    {0.98857441907086263, 0.9004032468505706,
+     2.6987750871530438, 2.5483526629419555},
+    {0.98322118737636222, 0.89505001515607019,
+     2.7839930248015929, 2.6346733227216181},
+    {0.94929566142116573, 0.8611244892008737,
+     2.6485151075956805, 2.505732491432215},
+    {0.9447965258964468, 0.85662535367615478,
+     2.7256184532406666, 2.5836479860222501},
+    {1.0318536473208038, 0.94368247510051162,
+     2.6636405680088564, 2.503490791667438},
+    {1.0277973001861238, 0.93962612796583167,
+     2.7564242764763658, 2.5972521904376706},
+    {0.99039303698358971, 0.90222186476329769,
+     2.611890733955514, 2.4610889859950289},
+    {0.96345087919469252, 0.8752797069744005,
+     -0.12977706895597912, -0.27519606206064134},
+    {0.91808619506812428, 0.82991502284783225,
+     -0.097959132274376887, -0.23534799367600182},
+    {0.96730276636040002, 0.879131594140108,
+     -0.21280205695635715, -0.35896050861600859},
+    {0.92309531734469075, 0.83492414512439872,
+     -0.17652244050996796, -0.31474038603659688},
+    {1.0014246561849054, 0.91325348396461337,
+     -0.07980358292827458, -0.23295889751553636},
+    {0.95644605259792215, 0.86827488037763012,
+     -0.049701944400983689, -0.19380063728549279},
+    {1.0073217882766055, 0.91915061605631332,
+     -0.16482152644309145, -0.31927315764069131},
+    {0.86313449848286694, 0.77496332626257491,
+     0.0023398531992687849, -0.1267699286224872},
+    {0.81541190370965078, 0.72724073148935875,
+     0.024960297326131559, -0.098014322779265139},
+    {0.87154235233400179, 0.78337118011370976,
+     -0.068982242151666318, -0.19926836281730173},
+    {0.82414349826812849, 0.73597232604783647,
+     -0.0425087753142942, -0.16654105110188369},
+    {0.89991155398258249, 0.81174038176229046,
+     0.049388234507278597, -0.085102064477076245},
+    {0.85253874214860814, 0.76436756992831612,
+     0.070099700961145206, -0.057570264854534425},
+    {0.91024857394416947, 0.82207740172387744,
+     -0.022443174080234794, -0.15856136047570815},
+    {0.92368145010459246, 0.83551027788430043,
+     -0.33928947810494908, -0.47760531908192855},
+    {0.88067828096169909, 0.79250710874140706,
+     -0.29851094779176995, -0.43011046403911674},
+    {0.91903887935202255, 0.83086770713173053,
+     -0.4214142572783785, -0.55895976980326234},
+    {0.87772073870617306, 0.78954956648588104,
+     -0.37750401369898229, -0.50867425992520454},
+    {0.96776748417151259, 0.87959631195122057,
+     -0.29774258941945825, -0.44399091006941788},
+    {0.92501571135218019, 0.83684453913188817,
+     -0.25729722445408754, -0.39583660842418789},
+    {0.96472593018158559, 0.87655475796129356,
+     -0.38341231892157324, -0.52907501845524896},
+    {0.83470634214067541, 0.74653516992038338,
+     -0.18600874229059206, -0.31135796427803419},
+    {0.7878364490122659, 0.69966527679197388,
+     -0.1545655961128784, -0.27437409422747455},
+    {0.8360454888985388, 0.74787431667824678,
+     -0.2608225157849462, -0.3863417038333653},
+    {0.79013368533843809, 0.70196251311814606,
+     -0.22597069217666521, -0.34603325157332288},
+    {0.87743846186942298, 0.78926728964913095,
+     -0.14337137150845458, -0.2745008531344546},
+    {0.83066664515624422, 0.74249547293595219,
+     -0.11301088905157181, -0.23785151735852544},
+    {0.88054977294487213, 0.79237860072458011,
+     -0.22015591670113355, -0.35173669843577482},
+    {1.0798702177579791, 0.99169904553768695,
+     -0.057732203483013181, -0.23066734505218123},
+    {1.0368644135098568, 0.94869324128956467,
+     -0.026527854054496418, -0.18790576276672386},
+    {1.0865698228612528, 0.99839865064096067,
+     -0.15032063337095053, -0.32523696156280479},
+    {1.0448923200282851, 0.956721147807993,
+     -0.11317708077088463, -0.27657101567810383},
+    {1.1121459180660156, 1.0239747458457233,
+     0.0015870875547733809, -0.18140717042421611},
+    {1.0696563656438978, 0.98148519342360563,
+     0.030066777122730454, -0.13994731995982798},
+    {1.1211177823058345, 1.0329466100855422,
+     -0.092735410465521029, -0.2787726140765775},
+    {0.98050384459830942, 0.89233267237801739,
+     0.078123392521514651, -0.070644345792986507},
+    {0.93433338282078837, 0.84616221060049635,
+     0.098578598603367484, -0.041549256662527428},
+    {0.99235607617065613, 0.90418490395036411,
+     0.0014305899031841832, -0.1497833205557596},
+    {0.94661249761255772, 0.8584413253922657,
+     0.026606683078209882, -0.11569012814809107},
+    {1.0118337575512453, 0.92366258533095313,
+     0.13201081551691549, -0.023451235109174455},
+    {0.96630098201187231, 0.87812980979158028,
+     0.14980980170009567, 0.003844596830134682},
+    {1.0256954026232235, 0.93752423040293131,
+     0.055417881419960159, -0.1032532932660509},
+    {1.0501090054799977, 0.96193783325970561,
+     -0.29626106452036749, -0.46099801918570671},
+    {1.0097408998075403, 0.92156972758724831,
+     -0.25258167924543773, -0.40757301978607019},
+    {1.0468915451214624, 0.95872037290117029,
+     -0.38983438075917043, -0.55373988716593681},
+    {1.0084893425951629, 0.92031817037487085,
+     -0.34181429560015275, -0.49652582775131682},
+    {1.0893961996289574, 1.0012250274086651,
+     -0.24638144495899827, -0.42214964438256908},
+    {1.0493982452136257, 0.96122707299333354,
+     -0.20352811474983923, -0.36808052466768731},
+    {1.0881287318605395, 0.99995755964024735,
+     -0.34425720107575264, -0.51964218792097894},
+    {0.91953849467399917, 0.83136732245370715,
+     -0.70977281125382408, -0.84740066902873512},
+    {0.88646544133451111, 0.79829426911421908,
+     -0.65811833067570868, -0.79056936927484844},
+    {0.90106927388535185, 0.81289810166505982,
+     -0.78395431949559402, -0.91862428554196729},
+    {0.87028419475385221, 0.78211302253356019,
+     -0.73094855091499633, -0.86105669494634374},
+    {0.96862487730479518, 0.88045370508450316,
+     -0.68578062376857496, -0.83219512397379691},
+    {0.93529567565325877, 0.84712450343296675,
+     -0.63269459056169164, -0.77298927179402721},
+    {0.951046629562047, 0.86287545734175497,
+     -0.76564535137307088, -0.90874734176004079},
+    {0.86266680632893589, 0.77449563410864386,
+     -0.53352492999928636, -0.66257016752692621},
+    {0.82293195231682847, 0.73476078009653645,
+     -0.48795870387235307, -0.611842574163039},
+    {0.85088842729763536, 0.76271725507734334,
+     -0.60874606918887353, -0.73619594713585013},
+    {0.81301531851314979, 0.72484414629285776,
+     -0.56173207618456689, -0.68442117495169297},
+    {0.91115345197502995, 0.82298227975473792,
+     -0.50257934970419371, -0.63884261167539802},
+    {0.87168016031597406, 0.78350898809568204,
+     -0.45615857979138352, -0.58646423665033531},
+    {0.90020396299817673, 0.81203279077788471,
+     -0.58176991112677778, -0.71630552691285998},
+    {0.83048719485568612, 0.74231602263539409,
+     -0.86691965467961796, -0.99173783328341403},
+    {0.80207938947884971, 0.71390821725855769,
+     -0.81525707360785016, -0.93666873586949451},
+    {0.80673053056017985, 0.71855935833988782,
+     -0.93149849723128941, -1.0534484169073981},
+    {0.78253225267840776, 0.69436108045811573,
+     -0.87647669189197264, -0.99570505765131512},
+    {0.87980410570800616, 0.79163293348771413,
+     -0.8559203721765587, -0.98739259498796983},
+    {0.85204954859398729, 0.76387837637369527,
+     -0.79979170726202464, -0.92739631819516744},
+    {0.8559945322306981, 0.76782336001040608,
+     -0.9250736131797801, -1.0532080523142928},
+    {0.78607701815081932, 0.69790584593052729,
+     -0.70195531971913516, -0.82157038682293015},
+    {0.74974487517391486, 0.66157370295362283,
+     -0.65559006999598723, -0.77142429071575969},
+    {0.76967593113045418, 0.68150475891016216,
+     -0.76738099105738644, -0.88523990217334647},
+    {0.73509828678266742, 0.64692711456237539,
+     -0.7209119511913521, -0.83533066132770994},
+    {0.83663169881317934, 0.74846052659288731,
+     -0.68110780153376194, -0.80670160809551117},
+    {0.80063369710517951, 0.71246252488488748,
+     -0.63326010335143745, -0.75450596129055458},
+    {0.8202382807562516, 0.73206710853595958,
+     -0.75006690971122192, -0.87362274261533457},
+    {1.0528073711046508, 0.9646361988843587,
+     -0.71913615586629054, -0.88457827365942387},
+    {1.0181474619032169, 0.92997628968292512,
+     -0.657895587651398, -0.81479934699613088},
+    {1.033754069848652, 0.9455828976283599,
+     -0.8105880648611602, -0.97120095118647221},
+    {1.0017231461254192, 0.91355197390512721,
+     -0.74429167887218328, -0.89751195721890686},
+    {1.1039785346250479, 1.0158073624047557,
+     -0.68915931567701338, -0.86948119595201934},
+    {1.0677880500593053, 0.97961687783901319,
+     -0.62518146876844394, -0.79467379051098164},
+    {1.0861807312123162, 0.99800955899202404,
+     -0.78948415674313899, -0.96428396783931625},
+    {0.99489401148708589, 0.90672283926679387,
+     -0.51910610663125234, -0.67085710635251106},
+    {0.95818820189108878, 0.87001702967079675,
+     -0.46856740866507951, -0.61299156344087979},
+    {0.98286053576577004, 0.89468936354547801,
+     -0.60449505802314829, -0.75374120318172322},
+    {0.94829346039527618, 0.86012228817498415,
+     -0.55201223053321302, -0.69461288366869789},
+    {1.0397700234296303, 0.95159885120933818,
+     -0.48263069805150627, -0.64473130940598455},
+    {1.0035110645676852, 0.91533989234739321,
+     -0.43112180420878343, -0.58473265126237939},
+    {1.0308305695255062, 0.94265939730521409,
+     -0.57023938994928347, -0.73014119740456618},
+    {0.95829812154984095, 0.87012694932954893,
+     -0.90873044269528402, -1.0531751962841258},
+    {0.93028352029956807, 0.84211234807927604,
+     -0.84316246134359596, -0.98259395700355778},
+    {0.9318978080358834, 0.84372663581559137,
+     -0.9850415231921904, -1.1247494841920695},
+    {0.90658909308386348, 0.81841792086357146,
+     -0.91756862933868244, -1.053104371052247},
+    {1.0108714203436464, 0.92270024812335427,
+     -0.89822417284093292, -1.0534693426591635},
+    {0.98168966820077086, 0.89351849598047883,
+     -0.82823389746300702, -0.97724186980161054},
+    {0.9845267697501876, 0.89635559752989558,
+     -0.98106482069174183, -1.1306515739684999},
+    {0.91855141776536053, 0.83038024554506851,
+     -2.4354394073578294, -2.5729047057461654},
+    {0.90027362138870271, 0.81210244916841068,
+     -2.3901831284104014, -2.5247295458772254},
+    {0.91416925710344632, 0.82599808488315429,
+     -2.4903846581738911, -2.6271344839267252},
+    {0.88392978064423289, 0.79575860842394086,
+     -2.4492248470515121, -2.5813008915664883},
+    {0.94175369597853442, 0.8535825237582424,
+     -2.3912320406466656, -2.5326600726196591},
+    {0.90027362138870271, 0.81210244916841068,
+     -2.3901831284104014, -2.5247295458772254},
+    {0.95075931348946574, 0.86258814126917371,
+     -2.4559109596189863, -2.5989604158986159},
+    {0.90133878220515296, 0.81316760998486093,
+     -2.2842993963764191, -2.4190112823663505},
+    {0.87762668961741697, 0.78945551739712494,
+     -2.2373373796986566, -2.3684940399859018},
+    {0.87991375891505685, 0.79174258669476483,
+     -2.3446686395584417, -2.4761568105533764},
+    {0.85737833163059496, 0.76920715941030293,
+     -2.2990863540452788, -2.4274081614761163},
+    {0.94448055975407796, 0.85630938753378594,
+     -2.2797219627639156, -2.4216358490183585},
+    {0.92137288844008369, 0.83320171621979167,
+     -2.2197215846058058, -2.3576529254248508},
+    {0.92276551885321534, 0.83459434663292331,
+     -2.3314625180955377, -2.4696254626822074},
+    {0.86499522994748856, 0.77682405772719654,
+     -2.5676905248320039, -2.6970580200241412},
+    {0.83525316929464488, 0.74708199707435285,
+     -2.5245102250208244, -2.649928768143039},
+    {0.8551864051274356, 0.76701523290714357,
+     -2.6251075067441314, -2.7531328905142058},
+    {0.82094414392364878, 0.73277297170335676,
+     -2.586236444117362, -2.7098779827843007},
+    {0.90798748083806013, 0.81981630861776811,
+     -2.5476383330970815, -2.6833958389043371},
+    {0.87281313869080579, 0.78464196647051376,
+     -2.5120795057594552, -2.6425460943876762},
+    {0.89980117833681383, 0.81163000611652181,
+     -2.6069540759955068, -2.741427280168832},
+    {0.82009067106171096, 0.73191949884141894,
+     -2.4145139343565338, -2.5380518673201156},
+    {0.79096458531911218, 0.70279341309882015,
+     -2.3681060619787035, -2.4882609360824417},
+    {0.80897843693330296, 0.72080726471301093,
+     -2.4754353633337201, -2.5976480887357991},
+    {0.78080146772663084, 0.69263029550633881,
+     -2.4277517207769166, -2.5467927231358352},
+    {0.8574400636443591, 0.76926889142406707,
+     -2.4008373404451446, -2.5291675249710539},
+    {0.83593253474838358, 0.74776136252809156,
+     -2.3568514608192199, -2.4823562861036432},
+    {0.84741864005723955, 0.75924746783694752,
+     -2.4625540790552982, -2.5895448128233545},
+    {1.0085628420513342, 0.92039166983104215,
+     -2.3538223178837518, -2.5085502475546488},
+    {0.96518475449382768, 0.87701358227353565,
+     -2.3419327519619837, -2.4876834067318492},
+    {1.0188045438802971, 0.93063337166000526,
+     -2.4267720893425309, -2.5838277894578954},
+    {0.98336808525866903, 0.89519691303837701,
+     -2.4059612345798222, -2.5553109236621014},
+    {1.0336962352952976, 0.9455250630750055,
+     -2.2950363441618751, -2.4556350888300984},
+    {0.98858800147456993, 0.90041682925427791,
+     -2.2868857269289169, -2.4373109752156656},
+    {1.0527275870806128, 0.96455641486032062,
+     -2.367464527626836, -2.5328856915811291},
+    {0.90133878220515296, 0.81316760998486093,
+     -2.2842993963764191, -2.4190112823663505},
+    {0.85737833163059496, 0.76920715941030293,
+     -2.2990863540452788, -2.4274081614761163},
+    {0.92276551885321534, 0.83459434663292331,
+     -2.3314625180955377, -2.4696254626822074},
+    {0.87991375891505685, 0.79174258669476483,
+     -2.3446686395584417, -2.4761568105533764},
+    {0.92137288844008369, 0.83320171621979167,
+     -2.2197215846058058, -2.3576529254248508},
+    {0.87762668961741697, 0.78945551739712494,
+     -2.2373373796986566, -2.3684940399859018},
+    {0.94448055975407796, 0.85630938753378594,
+     -2.2797219627639156, -2.4216358490183585},
+    {0.98270717489468029, 0.89453600267438826,
+     -2.5547115517267409, -2.7039264459097678},
+    {0.94976995351350935, 0.86159878129321732,
+     -2.5259249227189762, -2.6687938650195844},
+    {0.97825254712609688, 0.89008137490580486,
+     -2.6313834978178607, -2.7796978466958921},
+    {0.94323814974006814, 0.85506697751977612,
+     -2.5872136745678649, -2.7289056525370707},
+    {1.019280298120921, 0.93110912590062922,
+     -2.506274950889857, -2.6634408885205003},
+    {0.9843592397235591, 0.89618806750326707,
+     -2.479305469453605, -2.6288578875194686},
+    {1.0167241362954593, 0.92855296407516752,
+     -2.5878175978589013, -2.7443934710212918},
+    {0.89507932662556167, 0.80690815440526964,
+     0.38632211876866784, 0.25257465988354821},
+    {0.87933000824617447, 0.79115883602588244,
+     0.45741689012150188, 0.32601355832464585},
+    {0.86169356403877773, 0.7735223918184857,
+     0.32733180170207765, 0.19842058041857685},
+    {0.84757998413579583, 0.7594088119155038,
+     0.3971687599094838, 0.27015678328601939},
+    {0.94077868056380276, 0.85260750834351073,
+     0.37483112968461785, 0.23357575856554491},
+    {0.92620175414288475, 0.83803058192259272,
+     0.44861190360107828, 0.30987299408518298},
+    {0.90793989148984955, 0.81976871926955752,
+     0.3140065325917698, 0.17825659006053157},
+    {0.88839589395721785, 0.80022472173692583,
+     0.58972652051105945, 0.45698798655511286},
+    {0.86561319155090888, 0.77744201933061685,
+     0.65591917046245707, 0.52646575991943989},
+    {0.86081764743592581, 0.77264647521563379,
+     0.52661857372133292, 0.39782762488300683},
+    {0.83974760800116743, 0.75157643578087541,
+     0.59336211712798514, 0.46736946511479277},
+    {0.93540480093008505, 0.84723362870979302,
+     0.58596758102023261, 0.44565394821633403},
+    {0.91331097073543921, 0.82513979851514718,
+     0.65468820786736015, 0.51807733619669505},
+    {0.90867888358911963, 0.82050771136882761,
+     0.52045790257868207, 0.38459038369792609},
+    {0.77801033662759544, 0.68983916440730342,
+     0.28583068506537457, 0.16708984714345571},
+    {0.76413530967806431, 0.67596413745777228,
+     0.351879811692277, 0.23459549965873186},
+    {0.74084794803267329, 0.65267677581238126,
+     0.23490206569332492, 0.11993476571773995},
+    {0.72819048056561664, 0.64001930834532461,
+     0.29920189256506186, 0.18543044279728732},
+    {0.82635072249705888, 0.73817955027676685,
+     0.27175688742032722, 0.14745285702879229},
+    {0.81370203716394018, 0.72553086494364816,
+     0.33993256102064512, 0.21716185650397477},
+    {0.7893875034676906, 0.70121633124739857,
+     0.21961977842047925, 0.099639930018747741},
+    {0.78063203257056635, 0.69246086035027432,
+     0.47368195783227468, 0.35465924662036136},
+    {0.76048288340566916, 0.67231171118537714,
+     0.53812926420869445, 0.42121872335166516},
+    {0.74781650003150446, 0.65964532781121243,
+     0.41719470601027359, 0.3015502731644954},
+    {0.72917969370080538, 0.64100852148051335,
+     0.48124030062838069, 0.36737694423220851},
+    {0.83075111482904918, 0.74257994260875715,
+     0.46575598231822235, 0.34090478244633826},
+    {0.81135747521817558, 0.72318630299788356,
+     0.53249744553049594, 0.41000467133203483},
+    {0.79842939220826437, 0.71025821998797234,
+     0.4074396732358479, 0.28644526807971787},
+    {0.99471276670684805, 0.90654159448655602,
+     0.28485038211867852, 0.13313789713829133},
+    {0.98456833779805786, 0.89639716557776583,
+     0.3626172041951593, 0.2130219284722992},
+    {0.96079052290081102, 0.87261935068051899,
+     0.22458365705185424, 0.079669777158093633},
+    {0.95231059998246537, 0.86413942776217334,
+     0.29987635738872487, 0.15654265752328966},
+    {1.0350874261219567, 0.94691625390166456,
+     0.26882595265772774, 0.10788619369714297},
+    {1.0263747153688008, 0.93820354314850873,
+     0.34959035916320758, 0.19075771670338371},
+    {1.0016991104763848, 0.9135279382560928,
+     0.20691880594941064, 0.053703761299826354},
+    {0.99906467976434887, 0.91089350754405685,
+     0.50712124296545713, 0.35447714608455011},
+    {0.98065137828353488, 0.89248020606324285,
+     0.58206167000244424, 0.43326409667731763},
+    {0.97123926527577509, 0.88306809305548306,
+     0.43927989297859088, 0.2923556651185793},
+    {0.95479651769991136, 0.86662534547961934,
+     0.51397468371770427, 0.37018240039051753},
+    {1.0414135486349458, 0.95324237641465381,
+     0.49984181754784385, 0.33732893472775594},
+    {1.0240497914061475, 0.93587861918585569,
+     0.57798080343574831, 0.41969911899679163},
+    {1.0143532616772806, 0.92618208945698877,
+     0.42935008281512915, 0.27331664748827028},
+    {0.88157585682628725, 0.79340468460599523,
+     0.18660599081558948, 0.054875412057791367},
+    {0.87302162727623289, 0.78485045505594087,
+     0.25691108343715174, 0.12641481886845943},
+    {0.84376249322580588, 0.75559132100551385,
+     0.13593098548958316, 0.0094188483367518006},
+    {0.83635338382368118, 0.74818221160338916,
+     0.20354507672668115, 0.077986713248433426},
+    {0.92492342651437509, 0.83675225429408306,
+     0.16872322899617048, 0.030199337687250215},
+    {0.91787237254747722, 0.8297012003271852,
+     0.24121557724749693, 0.10386180882472604},
+    {0.88744486348429263, 0.79927369126400061,
+     0.11710810256621604, -0.01548858028402058},
+    {0.84766823582913597, 0.75949706360884395,
+     1.31190921982164, 1.1848856194131523},
+    {0.85372987771587672, 0.76555870549558469,
+     1.390615846708414, 1.2627863401768367},
+    {0.79692281982338797, 0.70875164760309595,
+     1.280836369278443, 1.1600128877450333},
+    {0.80416031027799217, 0.71598913805770015,
+     1.355522071207681, 1.2338705063424389},
+    {0.89000477495170016, 0.80183360273140813,
+     1.2642735171798967, 1.1312940437668646},
+    {0.89797933246455708, 0.80980816024426505,
+     1.3465621359731128, 1.2123702341061278},
+    {0.83858737724451649, 0.75041620502422446,
+     1.2342344623716148, 1.1083907617504158},
+    {0.90379640187833898, 0.81562522965804696,
+     1.5120859609521775, 1.3769901500377626},
+    {0.90169750313407093, 0.81352633091377891,
+     1.5930936054928142, 1.4583258675312689},
+    {0.85668849153561588, 0.76851731931532385,
+     1.4693955670462806, 1.341167264028845},
+    {0.85657109250279972, 0.7683999202825077,
+     1.5472823659456465, 1.419069956146352},
+    {0.95033221772813448, 0.86216104550784245,
+     1.4728097058726288, 1.3298382485739999},
+    {0.94952461790115306, 0.86135344568086103,
+     1.5591719635204428, 1.4163476919151792},
+    {0.90258790991291027, 0.81441673769261824,
+     1.4295428942671542, 1.2946362467064501},
+    {0.7044493815261007, 0.61627820930580868,
+     1.2950858472072677, 1.1834441422367519},
+    {0.71107264832728734, 0.62290147610699531,
+     1.3634314924065651, 1.2512100392901453},
+    {0.65503866814596134, 0.56686749592566932,
+     1.2689980977685555, 1.1613543497949992},
+    {0.66238725322411507, 0.57421608100382304,
+     1.3342272042156824, 1.2260236705453136},
+    {0.74612535951772707, 0.65795418729743504,
+     1.2528843215615355, 1.1374054642837002},
+    {0.75427407658073009, 0.66610290436043806,
+     1.3238111068599896, 1.2075269636738988},
+    {0.69563691038439857, 0.60746573816410654,
+     1.2276587910268149, 1.1167717414483491},
+    {0.76303835724766755, 0.67486718502737553,
+     1.4671105343340314, 1.3499388941309254},
+    {0.76360895722989575, 0.67543778500960372,
+     1.5380289923470898, 1.4207987884532394},
+    {0.71541477430985123, 0.6272436020895592,
+     1.4320702878702121, 1.3194627891873258},
+    {0.71745458383899663, 0.6292834116187046,
+     1.5003600941270798, 1.3875695878133583},
+    {0.80860106171508683, 0.72042988949479481,
+     1.4306581536249978, 1.3084896698898505},
+    {0.81022023808423571, 0.72204906586394368,
+     1.5054037551271351, 1.3830450972921808},
+    {0.75993308725511388, 0.67176191503482185,
+     1.395462099361684, 1.2786074809153205},
+    {0.91718700235893447, 0.82901583013864244,
+     1.1291608630375094, 0.99191941594803734},
+    {0.93070632438446455, 0.84253515216417252,
+     1.2122727518876295, 1.0727689871090025},
+    {0.86470323114138847, 0.77653205892109645,
+     1.1059238810553493, 0.97659692569172929},
+    {0.8788232075400233, 0.79065203531973127,
+     1.1837489497639815, 1.0524191486639622},
+    {0.95325221310273789, 0.86508104088244586,
+     1.0703164398111511, 0.92680948708446387},
+    {0.96931173088319822, 0.88114055866290619,
+     1.1555980593618069, 1.0090500830084279},
+    {0.9006825406391239, 0.81251136841883187,
+     1.0496631511809575, 0.91505327587934027},
+    {0.99083076363866118, 0.90265959141836916,
+     1.3361875269203669, 1.1852941183632313},
+    {0.99571713832856246, 0.90754596610827043,
+     1.4288265883481612, 1.2769003639402738},
+    {0.940881291367479, 0.85271011914718697,
+     1.2980504083418909, 1.1567768925352917},
+    {0.94746165498396462, 0.85929048276367259,
+     1.3853288712521874, 1.242878783163788},
+    {1.032203982958811, 0.94403281073851886,
+     1.2815205247514954, 1.1212856202241779},
+    {1.039467294106815, 0.95129612188652291,
+     1.3794259615012974, 1.2174010128403265},
+    {0.98195650616521901, 0.89378533394492699,
+     1.2446267499425878, 1.0955645834566177},
+    {0.77462067586317751, 0.68644950364288548,
+     1.1359750449014738, 1.0175954728754144},
+    {0.78700808186631588, 0.69883690964602385,
+     1.207411063125462, 1.0876937593521279},
+    {0.72299919706596449, 0.63482802484567247,
+     1.1158545201035728, 1.0025611523859683},
+    {0.73563002022246338, 0.64745884800217135,
+     1.1833646820387946, 1.0688956162499512},
+    {0.81220712098365133, 0.7240359487633593,
+     1.0853853171458228, 0.96279204712421251},
+    {0.82667523065335802, 0.73850405843306599,
+     1.1584752487031125, 1.0341311131297588},
+    {0.76003339893810717, 0.67186222671781515,
+     1.0671382305814796, 0.95027341557618616},
+    {0.84352762725611785, 0.75535645503582582,
+     -2.8574579429757909, -2.9839395167170322},
+    {0.87373571997088229, 0.78556454775059026,
+     -2.9145237580653047, -3.0451218109074665},
+    {0.86139715083807955, 0.77322597861778752,
+     -2.7937314263844453, -2.9226019108497869},
+    {0.89302467150986042, 0.8048534992895684,
+     -2.847990220663132, -2.9814252465664413},
+    {0.79310693175858205, 0.70493575953829002,
+     -2.866006202762553, -2.986400136206762},
+    {0.82301176247150043, 0.7348405902512084,
+     -2.9210911017932237, -3.0449847317218492},
+    {0.81226592368913708, 0.72409475146884505,
+     -2.8048980402775099, -2.9274982748409455},
+    {0.87858065131723828, 0.79040947909694625,
+     -3.0441524682237437, 3.1077381888134239},
+    {0.90337598689047738, 0.81520481467018535,
+     -3.1120838015481076, 3.0360715841319696},
+    {0.90244894598286229, 0.81427777376257027,
+     -2.9762742837140306, -3.1111592260437475},
+    {0.92921091296242353, 0.8410397407421315,
+     -3.0427718574939573, 3.1011648457659535},
+    {0.82682370103108094, 0.73865252881078891,
+     -3.0452483245521251, 3.1135744849600973},
+    {0.85190528708436231, 0.76373411486407028,
+     -3.1102487090781024, 3.0453512414987438},
+    {0.85164792283664958, 0.76347675061635756,
+     -2.9804579640518121, -3.1080089917167468},
+    {0.92329889673175003, 0.835127724511458,
+     -2.7154264657801126, -2.8536783918882551},
+    {0.95644521430092, 0.86827404208062797,
+     -2.7678540629164803, -2.9119525996517237},
+    {0.93448119194010804, 0.84631001971981601,
+     -2.6505217241776813, -2.7906751698459966},
+    {0.96868287934744945, 0.88051170712715743,
+     -2.6989485140397176, -2.8453742737031322},
+    {0.87666171160708539, 0.78849053938679337,
+     -2.7304195821667485, -2.8614370750572866},
+    {0.90952201934104793, 0.8213508471207559,
+     -2.781432286926762, -2.917434291583616},
+    {0.88941662667048405, 0.80124545445019202,
+     -2.6680111553802055, -2.8009024088448244},
+    {0.97178752952372938, 0.88361635730343735,
+     -2.8989385344304277, -3.0459702356624585},
+    {1.000248600430659, 0.91207742821036697,
+     -2.9660756584424273, -3.1189756822686712},
+    {0.98841837931283283, 0.9002472070925408,
+     -2.8257902784567288, -2.9761802682203604},
+    {1.0187391550792144, 0.93056798285892228,
+     -2.8896851706103259, -3.0467257342821581},
+    {0.92339595553623621, 0.83522478331594419,
+     -2.9071753451708866, -3.0454434798105576},
+    {0.95204658507499229, 0.86387541285470026,
+     -2.9715074179997711, -3.1147926380853916},
+    {0.9413831682029622, 0.85321199598267017,
+     -2.8374820026957162, -2.9788443541290501},
+    {0.7118918779791612, 0.62372070575886918,
+     -2.8243184928132194, -2.9366124165665921},
+    {0.74200351965530253, 0.65383234743501051,
+     -2.8737383904439358, -2.9888170421082463},
+    {0.7311243802799593, 0.64295320805966727,
+     -2.7680329571910494, -2.8820777514803004},
+    {0.76234984333484124, 0.67417867111454921,
+     -2.8150576286537805, -2.9321587316181641},
+    {0.66115019243264195, 0.57297902021234992,
+     -2.8327747853438465, -2.9408832683521373},
+    {0.69047843123068486, 0.60230725901039284,
+     -2.8807436158734592, -2.9911975954693699},
+    {0.68147993060696399, 0.59330875838667196,
+     -2.7785301497640003, -2.8882436679589532},
+    {0.74737048319658728, 0.65919931097629525,
+     -2.9873408939692534, -3.10294158017328},
+    {0.77418815744220149, 0.68601698522190946,
+     -3.0460903446439529, 3.1187612320212761},
+    {0.77145935960410017, 0.68328818738380814,
+     -2.9269682607976946, -3.0450140979458351},
+    {0.79986982060651546, 0.71169864838622343,
+     -2.9841272676757047, -3.105285802624592},
+    {0.69442866562686156, 0.60625749340656954,
+     -2.9901495440601722, -3.1009345889814388},
+    {0.7209497705471074, 0.63277859832681538,
+     -3.0467056537773938, 3.123373082501439},
+    {0.7193387737907202, 0.63116760157042817,
+     -2.9322330183828478, -3.0451935179804983},
+    {0.7960715587514704, 0.70790038653117837,
+     -2.6987255402592543, -2.8194527789212329},
+    {0.82894822048627859, 0.74077704826598656,
+     -2.7440932450478055, -2.86871938956891},
+    {0.80956092667072543, 0.72138975445043341,
+     -2.6418311168794579, -2.7641122277314949},
+    {0.84321864402439928, 0.75504747180410725,
+     -2.6840280616028429, -2.8104694600638145},
+    {0.74818155652079643, 0.6600103843005044,
+     -2.7122372317224821, -2.8279175121608393},
+    {0.7803609387400231, 0.69218976651973108,
+     -2.7565898844295602, -2.8755833488599571},
+    {0.76311308984514314, 0.67494191762485112,
+     -2.6572633612180043, -2.7744426661213915},
+    {0.82923769806420466, 0.74106652584391264,
+     1.8338523633865427, 1.7091901653621158},
+    {0.81721335967116326, 0.72904218745087124,
+     1.896594600080326, 1.7734040172377237},
+    {0.79108926581901162, 0.7029180935987196,
+     1.7855189351982497, 1.665350189421555},
+    {0.78112804300670258, 0.69295687078641055,
+     1.8480901785549662, 1.7290138956839252},
+    {0.87806466265322203, 0.78989349043293,
+     1.8180197729056082, 1.6867998110005071},
+    {0.86558610076621911, 0.77741492854592709,
+     1.8850015789699051, 1.7555519382931266},
+    {0.83952907832462365, 0.75135790610433162,
+     1.7671911052049833, 1.6412265481242536},
+    {0.83608016120095752, 0.74790898898066549,
+     2.0055746159464163, 1.8800510181364167},
+    {0.81978447390226961, 0.73161330168197758,
+     2.0592603798218558, 1.9357595528510776},
+    {0.8038078719869225, 0.71563669976663047,
+     1.9552998556865691, 1.8336890260110754},
+    {0.78935330137559401, 0.70118212915530198,
+     2.0099763764164225, 1.8900003148348532},
+    {0.88366057083212657, 0.79548939861183454,
+     2.0007851061986699, 1.8687487001748226},
+    {0.86633582349882632, 0.77816465127853429,
+     2.0577589549825408, 1.9282048690869744},
+    {0.85146394583475127, 0.76329277361445924,
+     1.9475246996000668, 1.8199981955018649},
+    {0.70449118659709098, 0.61632001437679895,
+     1.7584864123675081, 1.6468410822317199},
+    {0.69688452348148067, 0.60871335126118864,
+     1.8170536139764148, 1.7060608686074648},
+    {0.66451720100055123, 0.5763460287802592,
+     1.7173482798474069, 1.6089803084334888},
+    {0.65868834943823151, 0.57051717721793949,
+     1.775322592158892, 1.6674022804093898},
+    {0.75142985131866458, 0.66325867909837255,
+     1.7399837820104811, 1.6239828640408567},
+    {0.74346081573155265, 0.65528964351126062,
+     1.8020545496359208, 1.6868349443835555},
+    {0.71057126062057963, 0.6224000884002876,
+     1.6971867202090569, 1.5850095375716167},
+    {0.72326002249302068, 0.63508885027272866,
+     1.9165925951547571, 1.8032753758376283},
+    {0.71157233945891896, 0.62340116723862693,
+     1.9688677690424383, 1.8566021323782518},
+    {0.68799518029423878, 0.59982400807394676,
+     1.8726920426711, 1.7624442922521257},
+    {0.67806475361541152, 0.58989358139511949,
+     1.925296688350884, 1.8158592924466699},
+    {0.76970155918998029, 0.68153038696968826,
+     1.9070697204769678, 1.7892081300596736},
+    {0.75711726605619933, 0.66894609383590731,
+     1.9623809448240421, 1.8458113491110431},
+    {0.73397837739581762, 0.64580720517552559,
+     1.860972363722476, 1.7466594596252789},
+    {0.93768754422228229, 0.84951637200199026,
+     1.7238238308759348, 1.583112196537211},
+    {0.92733251765648927, 0.83916134543619725,
+     1.800293339655229, 1.6613634859802573},
+    {0.89649892427238975, 0.80832775205209773,
+     1.6715844079352173, 1.5376198965458627},
+    {0.88850047145431033, 0.8003292992340183,
+     1.7467562804347327, 1.614002122350314},
+    {0.98674209929878787, 0.89857092707849584,
+     1.6979052630461298, 1.54786259485922},
+    {0.9767347219780137, 0.88856354975772167,
+     1.7802952004215775, 1.6322845479506853},
+    {0.9452119626062726, 0.85704079038598058,
+     1.6431886202570547, 1.5011436693091393},
+    {0.94881015335878838, 0.86063898113849635,
+     1.9293566849805253, 1.7866622951666142},
+    {0.93188816791586415, 0.84371699569557213,
+     1.9955364272842506, 1.8558301216010404},
+    {0.91457921612484905, 0.82640804390455702,
+     1.8720827733918997, 1.7352664410635521},
+    {0.89987637350872973, 0.81170520128843771,
+     1.9389301167070494, 1.8044452670703763},
+    {0.99800857015487188, 0.90983739793457985,
+     1.9185989275816295, 1.7661822269215692},
+    {0.98053609955346088, 0.89236492733316886,
+     1.9897363016919554, 1.8409620419152708},
+    {0.96392427520628077, 0.87575310298598874,
+     1.8575742272534777, 1.7120648746109473},
+    {0.80536203352532809, 0.71719086130503606,
+     1.6505341263931703, 1.5287433458554938},
+    {0.79926961356263559, 0.71109844134234357,
+     1.7195543813099583, 1.5984643216476586},
+    {0.76174353862617861, 0.67357236640588658,
+     1.6075327600673308, 1.4904936559295372},
+    {0.75760994946983762, 0.66943877724954559,
+     1.6750171090857855, 1.5583978101320437},
+    {0.8535109046280025, 0.76533973240771047,
+     1.6233723753694163, 1.4955722416092447},
+    {0.84773241426470891, 0.75956124204441688,
+     1.6968827383333689, 1.5698506829131078},
+    {0.80908820596934905, 0.72091703374905702,
+     1.5789425115769955, 1.4567169080927895},
+    {0.80195667728073128, 0.71378550506043925,
+     -1.6396822961861395, -1.7610798572989734},
+    {0.75925319832116167, 0.67108202610086964,
+     -1.6054030594625743, -1.7221886458695934},
+    {0.80093133202313405, 0.71276015980284202,
+     -1.7093318619856499, -1.8306117974889318},
+    {0.75914558566995294, 0.67097441344966091,
+     -1.6726610481421864, -1.7894357205976954},
+    {0.84425873340779478, 0.75608756118750275,
+     -1.6038502386459954, -1.7304270237441166},
+    {0.80056330700479672, 0.71239213478450469,
+     -1.5701956370422172, -1.6914334400712865},
+    {0.84393595890902551, 0.75576478668873348,
+     -1.6767545736333709, -1.8032892980665975},
+    {0.71278521950895135, 0.62461404728865932,
+     -1.5100292655237788, -1.6224024087734001},
+    {0.66768494097843345, 0.57951376875814142,
+     -1.4820871808110063, -1.590701550038381},
+    {0.71535650572626486, 0.62718533350597283,
+     -1.5731113245347648, -1.6857136110800193},
+    {0.67056466529746006, 0.58239349307716803,
+     -1.5426920967766804, -1.6515323850245232},
+    {0.75212634891818142, 0.66395517669788939,
+     -1.4734217812628589, -1.5894918413796857},
+    {0.70843405546588889, 0.62026288324559686,
+     -1.4491383852209461, -1.5611275678812377},
+    {0.75719139434752825, 0.66902022212723622,
+     -1.5397702179950206, -1.6563472874551639},
+    {0.75199416315832623, 0.66382299093803421,
+     -1.8097358825921153, -1.9257928098054768},
+    {0.71080756656104127, 0.62263639434074924,
+     -1.7710493190825185, -1.8832473586991705},
+    {0.74490003242713121, 0.65672886020683918,
+     -1.8782866043362894, -1.9936459945369516},
+    {0.70492735796825701, 0.61675618574796498,
+     -1.8381104227653295, -1.9497936015952291},
+    {0.79743526491960282, 0.70926409269931079,
+     -1.7797452414579289, -1.900626775897313},
+    {0.75674587770531943, 0.6685747054850274,
+     -1.7409790770756723, -1.8575112528109159},
+    {0.79144175372342862, 0.70327058150313659,
+     -1.8502332166339741, -1.9704412068698103},
+    {0.67092460198074289, 0.58275342976045086,
+     -1.6691783551760475, -1.7780470106599975},
+    {0.62639148195779593, 0.5382203097375039,
+     -1.6360210797703032, -1.7415904239497495},
+    {0.66815429958458772, 0.57998312736429569,
+     -1.7341566185228294, -1.8428076842637049},
+    {0.62433674656235627, 0.53616557434206424,
+     -1.6990226417769434, -1.8044495681043444},
+    {0.71596763192155677, 0.62779645970126474,
+     -1.6379783012071654, -1.7506352961812475},
+    {0.67169363841905283, 0.5835224661987608,
+     -1.6051950839854701, -1.7141244454531248},
+    {0.71447980277067002, 0.626308630550378,
+     -1.704141757879011, -1.8166657274500801},
+    {0.93264260671125376, 0.84447143449096174,
+     -1.6006215622773798, -1.7404575715676882},
+    {0.88731249374394017, 0.79914132152364814,
+     -1.563356710502124, -1.6959336832563059},
+    {0.93115836321896606, 0.84298719099867403,
+     -1.682779711325894, -1.8223608527904471},
+    {0.88792402996286635, 0.79975285774257432,
+     -1.6412002873109448, -1.7738683874018903},
+    {0.9777237277276285, 0.88955255550733647,
+     -1.5540513463254875, -1.7022597054222255},
+    {0.93077122671193702, 0.84260005449164499,
+     -1.5174008044495202, -1.656915671704398},
+    {0.97742799500689503, 0.88925682278660301,
+     -1.6425509034217038, -1.7907000737164258},
+    {0.83669861786166, 0.74852744564136797,
+     -1.4562829348911832, -1.5818852679496544},
+    {0.79033903879819101, 0.70216786657789898,
+     -1.4305996616435432, -1.5506850153233256},
+    {0.8418701112578757, 0.75369893903758367,
+     -1.5300947801827598, -1.6563612761544877},
+    {0.7966978556782417, 0.70852668345794967,
+     -1.5002743501892655, -1.6210723740373945},
+    {0.87683383863211484, 0.78866266641182281,
+     -1.4071894859250182, -1.5382317720807137},
+    {0.82876162793394126, 0.74059045571364923,
+     -1.3832144264517605, -1.5078173480537138},
+    {0.8836272126071012, 0.79545604038680917,
+     -1.4850340092086487, -1.6170655058855865},
+    {0.88055917351916979, 0.79238800129887776,
+     -1.7918660860929714, -1.9234482380337592},
+    {0.84105371006658669, 0.75288253784629466,
+     -1.7480681593560574, -1.874229115753921},
+    {0.87309542094623693, 0.78492424872594491,
+     -1.8631893281838032, -1.9936961010230394},
+    {0.83629160987616658, 0.74812043765587455,
+     -1.8204773848524103, -1.9460278855230628},
+    {0.92653699838846315, 0.83836582616817112,
+     -1.7628216112243815, -1.9016170578367868},
+    {0.88559837090021831, 0.79742719867992629,
+     -1.7176440196483098, -1.8499664937386393},
+    {0.91908722001966292, 0.83091604779937089,
+     -1.8398559605452387, -1.9774094346424433},
+    {0.74451617591445618, 0.65634500369416415,
+     -2.1198244888627888, -2.2351465402058341},
+    {0.77615464053372485, 0.68798346831343282,
+     -2.1638240407780311, -2.2823666594919163},
+    {0.75932433774433494, 0.67115316552404292,
+     -2.0554353942514645, -2.1722281973998818},
+    {0.79238662188973596, 0.70421544966944394,
+     -2.0996634456626464, -2.2199768337313501},
+    {0.69562290785645331, 0.60745173563616128,
+     -2.1386217260867508, -2.2495075915148477},
+    {0.72808073573199639, 0.63990956351170436,
+     -2.1814880747812286, -2.2952493442857942},
+    {0.71068283427587087, 0.62251166205557884,
+     -2.0766324524811761, -2.1888194811536907},
+    {0.78643932378979975, 0.69826815156950772,
+     -2.2687129696878499, -2.388367787148054},
+    {0.81228470661130481, 0.72411353439101278,
+     -2.3127524858826911, -2.4353549453353516},
+    {0.80552470778499696, 0.71735353556470494,
+     -2.2084806379417947, -2.3302903017694612},
+    {0.83259627243477818, 0.74442510021448616,
+     -2.2536277930991928, -2.3787105889928672},
+    {0.73933848664460189, 0.65116731442430986,
+     -2.2826998997391637, -2.3975223018201697},
+    {0.76621987621887222, 0.67804870399858019,
+     -2.3253999372317429, -2.4428993508800732},
+    {0.75836879422347581, 0.67019762200318378,
+     -2.2249033756548262, -2.3415993673454074},
+    {0.81901710911145076, 0.73084593689115873,
+     -1.9635122892533099, -2.0869202730579914},
+    {0.8527875575962045, 0.76461638537591248,
+     -2.0084374142432355, -2.1361406585226166},
+    {0.82891492589003635, 0.74074375366974432,
+     -1.8925353501089626, -2.0171573499016722},
+    {0.8642198819204272, 0.77604870970013518,
+     -1.9366087033538566, -2.0658686326595932},
+    {0.77223166018533762, 0.68406048796504559,
+     -1.9886988218210426, -2.1068259067114283},
+    {0.80676502797013838, 0.71859385574984636,
+     -2.0327436954714444, -2.1546976350928611},
+    {0.78299979416603194, 0.69482862194573991,
+     -1.9201031285553891, -2.0393822698541912},
+    {0.86888131325403029, 0.78071014103373826,
+     -2.1243922294225155, -2.2543027390639172},
+    {0.89633578336782993, 0.8081646111475379,
+     -2.1716894783929499, -2.3056289964403387},
+    {0.88419298934610857, 0.79602181712581654,
+     -2.0547703409787821, -2.1868851726569187},
+    {0.9131606926305692, 0.82498952041027718,
+     -2.1023700778948666, -2.2389566593660146},
+    {0.82315517859514964, 0.73498400637485761,
+     -2.1448323765059332, -2.2687435500194191},
+    {0.85157330977595391, 0.76340213755566189,
+     -2.1907833075069743, -2.3183243878239201},
+    {0.83901042108528012, 0.7508392488649881,
+     -2.0780213802983845, -2.2039193311976417},
+    {0.61080736813791192, 0.52263619591761989,
+     -2.1149800303416937, -2.2194896663854422},
+    {0.64595584028457664, 0.55778466806428462,
+     -2.1561625736247563, -2.2631303156752138},
+    {0.6246109682516372, 0.53643979603134517,
+     -2.0550884284483519, -2.1605343136769095},
+    {0.66108703179940553, 0.57291585957911351,
+     -2.0964462355524991, -2.2045498744755707},
+    {0.56013113077839993, 0.47195995855810791,
+     -2.1323295823939397, -2.2337017086800035},
+    {0.59578333725871602, 0.50761216503842399,
+     -2.1725455481760325, -2.2760770833268578},
+    {0.57387046043100332, 0.48569928821071129,
+     -2.0745075885471485, -2.1766857753840165},
+    {0.66157458326014174, 0.57340341103984971,
+     -2.2543520485899822, -2.3624931025735125},
+    {0.69149861653833289, 0.60332744431804086,
+     -2.295684232193731, -2.406223357735731},
+    {0.67916021280676175, 0.59098904058646973,
+     -2.1979340380582983, -2.3074597128668839},
+    {0.71030997332015455, 0.62213880109986253,
+     -2.2401609836126486, -2.3523151206657378},
+    {0.61240574942836534, 0.52423457720807332,
+     -2.2675656423438513, -2.3721818207602201},
+    {0.64314263672246252, 0.5549714645021705,
+     -2.307751819519305, -2.4145136830194338},
+    {0.62964083209751232, 0.54146965987722029,
+     -2.2132614503177162, -2.3190577139552606},
+    {0.68677582386007352, 0.59860465163978149,
+     -1.9703241104828531, -2.0804711257081721},
+    {0.72407077584396018, 0.63589960362366815,
+     -2.0122846788214632, -2.1256761522299703},
+    {0.69688133900782612, 0.60871016678753409,
+     -1.9047268352703057, -2.0157193103792408},
+    {0.73554363191234817, 0.64737245969205615,
+     -1.9459984533821102, -2.0604593329001117},
+    {0.6369580915566988, 0.54878691933640678,
+     -1.9931791618619745, -2.0994941443513757},
+    {0.67477444217112137, 0.58660326995082934,
+     -2.0343799616466023, -2.1435538436297867},
+    {0.64763634246848378, 0.55946517024819176,
+     -1.9296427636971307, -2.0367342740649241},
+    {0.74208778685814325, 0.65391661463785122,
+     -1.16678754495899, -1.2818743311228438},
+    {0.69600807385373609, 0.60783690163344406,
+     -1.1588852302935921, -1.269803685168448},
+    {0.75719947503268947, 0.66902830281239745,
+     -1.229448629795957, -1.3460265140619077},
+    {0.71081099680282467, 0.62263982458253264,
+     -1.2179483274105491, -1.3301466698925419},
+    {0.77261969163888111, 0.68444851941858909,
+     -1.1119231550838009, -1.2300911305901887},
+    {0.72537123257300973, 0.6372000603527177,
+     -1.1069504981386451, -1.2204614352895249},
+    {0.78981604418351103, 0.70164487196321901,
+     -1.1755233938657816, -1.2955507220252633},
+    {0.63619727373939372, 0.54802610151910169,
+     -1.0982048774565569, -1.2044654235497145},
+    {0.59441211221549184, 0.50624093999519981,
+     -1.0943277900126149, -1.1977721245625184},
+    {0.65169127545153371, 0.56352010323124169,
+     -1.151694190545637, -1.259086779369694},
+    {0.60921211875221004, 0.52104094653191801,
+     -1.1451161090234649, -1.2495198932865488},
+    {0.66264777248412288, 0.57447660026383085,
+     -1.0486564167362171, -1.1568800100649754},
+    {0.61982197045732479, 0.53165079823703276,
+     -1.0472123426820272, -1.1523292416263375},
+    {0.67986765502620894, 0.59169648280591691,
+     -1.1023969702969132, -1.2119798008454197},
+    {0.73543664964061295, 0.64726547742032092,
+     -1.3426662427014262, -1.4571169872439047},
+    {0.69066091009478203, 0.60248973787449001,
+     -1.3253722714632252, -1.4358414628979135},
+    {0.74484839691064741, 0.65667722469035539,
+     -1.4075342667504769, -1.5228886318148915},
+    {0.7004737159195884, 0.61230254369929638,
+     -1.3867161448226006, -1.4980150557485825},
+    {0.77043096596379257, 0.68225979374350054,
+     -1.294610528765691, -1.4125484590608244},
+    {0.72402856959085959, 0.63585739737056757,
+     -1.2793256009882441, -1.3927132046318036},
+    {0.78154109222468715, 0.69336992000439512,
+     -1.3618393944504481, -1.4809603479328817},
+    {0.63588540014558315, 0.54771422792529112,
+     -1.2530045964013332, -1.3592428618585461},
+    {0.59436523908555272, 0.50619406686526069,
+     -1.241584817966576, -1.345026177736975},
+    {0.64737740480556472, 0.55920623258527269,
+     -1.3096939362509687, -1.4167663375885289},
+    {0.60570448009920497, 0.51753330787891294,
+     -1.2954143437641725, -1.3995870638462613},
+    {0.66607795854722862, 0.57790678632693659,
+     -1.2075391603766525, -1.3160282570129582},
+    {0.62310174430902976, 0.53493057208873773,
+     -1.1980666590117488, -1.3034083833627539},
+    {0.6791362577548189, 0.59096508553452687,
+     -1.2655273323181004, -1.3750510737507182},
+    {0.85178700123605133, 0.76361582901575931,
+     -1.0549641675687311, -1.1825337430824641},
+    {0.8020357005384845, 0.71386452831819247,
+     -1.0533025722268392, -1.1747092135039576},
+    {0.8717956389590078, 0.78362446673871577,
+     -1.1234371843758972, -1.2537592183530846},
+    {0.82148472569052322, 0.73331355347023119,
+     -1.1173876777105831, -1.2410949758495629},
+    {0.88029466639580356, 0.79212349417551153,
+     -0.98829361590635656, -1.1198372292247081},
+    {0.82995333089548384, 0.74178215867519182,
+     -0.99096658806648619, -1.1157180503476682},
+    {0.90290929081757665, 0.81473811859728462,
+     -1.0566895031850054, -1.191646385035728},
+    {0.73381376339514659, 0.64564259117485456,
+     -0.99499508008477711, -1.1092924604647283},
+    {0.68829645445188015, 0.60012528223158812,
+     -0.99650523179808148, -1.1067779251667154},
+    {0.75383974523950936, 0.66566857301921734,
+     -1.0516995229865398, -1.1679402655667988},
+    {0.70734256008596741, 0.61917138786567538,
+     -1.0501515835893698, -1.1620451923110786},
+    {0.75897575101286907, 0.67080457879257704,
+     -0.93703819441026492, -1.0537956493297935},
+    {0.71287030695579934, 0.62469913473550731,
+     -0.94184523887031468, -1.054225937990964},
+    {0.78107300409104607, 0.69290183187075405,
+     -0.99317159855061621, -1.1122419331141036},
+    {0.85431849243945213, 0.7661473202191601,
+     -1.2565387371745171, -1.3844472971201014},
+    {0.80509893174874658, 0.71692775952845456,
+     -1.2422318191517125, -1.3639920779423336},
+    {0.86700569558600094, 0.77883452336570891,
+     -1.3307480661556634, -1.4603956774974551},
+    {0.81816573072643484, 0.72999455850614281,
+     -1.3116428975082228, -1.4349481214905127},
+    {0.8895427824246156, 0.80137161020432357,
+     -1.1961545079776106, -1.3290646705783091},
+    {0.83903531483792992, 0.7508641426176379,
+     -1.1852467955231478, -1.3111479409056688},
+    {0.90461892645490471, 0.81644775423461269,
+     -1.2726756969151738, -1.4079006730780212},
+    {0.7359715221262294, 0.64780034990593738,
+     0.82892625274729592, 0.71442480595047131},
+    {0.75702051978562068, 0.66884934756532866,
+     0.88715346246937987, 0.77059361848398289},
+    {0.68541532099664071, 0.59724414877634868,
+     0.82498919859667585, 0.71495416917425481},
+    {0.70637089105412121, 0.61819971883382918,
+     0.8802005838454634, 0.76839180765238879},
+    {0.76414463354153705, 0.67597346132124503,
+     0.77511753102578163, 0.65783225977170057},
+    {0.78652617221102883, 0.6983549999907368,
+     0.83336065707724361, 0.71369630478390489},
+    {0.7133717274341852, 0.62520055521389317,
+     0.77272116175041694, 0.66029589868655114},
+    {0.82911368342312364, 0.74094251120283161,
+     0.96113920890004467, 0.83649246033378699},
+    {0.84799778469753373, 0.7598266124772417,
+     1.0315435053392537, 0.90447647191019365},
+    {0.77699711488095735, 0.68882594266066532,
+     0.9493952512363637, 0.83076277496595319},
+    {0.79552220876690638, 0.70735103654661435,
+     1.0155541744680341, 0.89488891710821517},
+    {0.86049014757347808, 0.77231897535318605,
+     0.90400331922555988, 0.7752572565398661},
+    {0.88162649417327899, 0.79345532195298696,
+     0.97446852861786959, 0.84273054493671551},
+    {0.80848099623111358, 0.72030982401082155,
+     0.89503277256011737, 0.77287835436534003},
+    {0.60609864858174445, 0.51792747636145242,
+     0.86922161734905479, 0.76502304651143738},
+    {0.62575486355152266, 0.53758369133123063,
+     0.92147306346793545, 0.81594793335773941},
+    {0.55516107040594054, 0.46698989818564851,
+     0.86480995343257572, 0.76372160905847508},
+    {0.57780870015670238, 0.48963752793641035,
+     0.91405490735297823, 0.81163972229138492},
+    {0.63418730935674428, 0.54601613713645225,
+     0.82143032337361399, 0.71531302693266152},
+    {0.65676876161191722, 0.56859758939162519,
+     0.87403932212260116, 0.76626482784474981},
+    {0.58254727463210298, 0.49437610241181096,
+     0.81821826155637767, 0.71551433687041743},
+    {0.69241654562865962, 0.60424537340836759,
+     0.98872666869457915, 0.87811072089837838},
+    {0.70849595987697467, 0.62032478765668264,
+     1.05084970746314, 0.93885509541272838},
+    {0.64233148547205476, 0.55416031325176274,
+     0.97740611544448419, 0.8707033105851385},
+    {0.65787992153596542, 0.56970874931567339,
+     1.0362451339564869, 0.9283863292566169},
+    {0.72556255090184985, 0.63739137868155782,
+     0.93899499620498017, 0.82546644654357748},
+    {0.74356597123418289, 0.65539479901389086,
+     1.0013701324677529, 0.886140333464428},
+    {0.67507149357816232, 0.58690032135787029,
+     0.92974159510288479, 0.82054402355428657},
+    {0.76582581911240011, 0.67765464689210808,
+     0.658559584383831, 0.5411009321739364},
+    {0.79107338634819735, 0.70290221412790532,
+     0.71785487164664763, 0.59768789286607704},
+    {0.71412920578612082, 0.6259580335658288,
+     0.65996900875793263, 0.54747630377722523},
+    {0.74029322455158753, 0.6521220523312955,
+     0.71722255726969564, 0.6023085798430915},
+    {0.78962182351122423, 0.7014506512909322,
+     0.59689420000451432, 0.47688839772430597},
+    {0.81639212859455357, 0.72822095637426154,
+     0.65720949100986881, 0.53411750281064874},
+    {0.73821928736066011, 0.65004811514036809,
+     0.60033923184073368, 0.48562386102866184},
+    {0.86458452055403556, 0.77641334833374354,
+     0.77992076477454009, 0.65061028025097078},
+    {0.88938106764378722, 0.80120989542349519,
+     0.84434104523553555, 0.71145512026078306},
+    {0.81385836140628731, 0.72568718918599529,
+     0.77783357785525642, 0.65504427338738058},
+    {0.83774938088937867, 0.74957820866908664,
+     0.83845842957478556, 0.71272198758991434},
+    {0.88882677791301756, 0.80065560569272554,
+     0.71974123024183145, 0.58693828820067162},
+    {0.91557375204264568, 0.82740257982235366,
+     0.78243874493220089, 0.64546070675788536},
+    {0.84064870319099261, 0.75247753097070058,
+     0.71868906502261987, 0.5925803689265996},
+    {0.63605365979956641, 0.54788248757927438,
+     0.71650503551729894, 0.61025475182646705},
+    {0.66177436499190856, 0.57360319277161653,
+     0.77061825043707488, 0.66246185014634884},
+    {0.5831290839414971, 0.49495791172120507,
+     0.71639251325920694, 0.61365286522776852},
+    {0.60961234062878955, 0.52144116840849752,
+     0.76878479678919265, 0.66435450117600581},
+    {0.66155065562578186, 0.57337948340548983,
+     0.66143642676553471, 0.55329721021060319},
+    {0.68853466066238034, 0.60036348844208831,
+     0.71677726796827168, 0.60648483806284459},
+    {0.60836616836157664, 0.52019499614128462,
+     0.66295959280033256, 0.55861174642231293},
+    {0.73432233431346028, 0.64615116209316825,
+     2.5640894740046885, 2.4497441098631643},
+    {0.73771783925062462, 0.64954666703033259,
+     2.5037142128150673, 2.3890466852226684},
+    {0.7760996515367955, 0.68792847931650347,
+     2.6038153131604092, 2.4852785518672058},
+    {0.77984940917367318, 0.69167823695338115,
+     2.5401436430578612, 2.4212053017336594},
+    {0.68763908986225086, 0.59946791764195884,
+     2.5867892270749571, 2.4765709304859738},
+    {0.69266503920786227, 0.60449386698757024,
+     2.5277457370109833, 2.4171089581700782},
+    {0.72891389205181134, 0.64074271983151931,
+     2.626158760933929, 2.5123201253880096},
+    {0.69749683972929555, 0.60932566750900352,
+     2.4152965037035719, 2.3042517468590118},
+    {0.69764657499020688, 0.60947540276991485,
+     2.3623757427325986, 2.2513182532928409},
+    {0.73927562636378152, 0.6511044541434895,
+     2.445385123605031, 2.3305687420851138},
+    {0.73919208341106002, 0.65102091119076799,
+     2.3893754081911003, 2.2745670264747662},
+    {0.65465434965160363, 0.5664831774313116,
+     2.440134001461677, 2.3325192103862622},
+    {0.65643261784106277, 0.56826144562077074,
+     2.3878543090653248, 2.2801052678868738},
+    {0.69589606574225926, 0.60772489352196724,
+     2.4704890434611899, 2.3595800694250268},
+    {0.86377079358813191, 0.77559962136783989,
+     2.6241104256259344, 2.4949126821492023},
+    {0.86633469574295829, 0.77816352352266627,
+     2.5550358149688166, 2.4254818863642167},
+    {0.90484177302581692, 0.81667060080552489,
+     2.6724604762396824, 2.5372004470409655},
+    {0.90822779943895493, 0.8200566272186629,
+     2.5994236503124717, 2.4636279335943114},
+    {0.81765675424689965, 0.72948558202660763,
+     2.647266778320958, 2.5240228625392094},
+    {0.82198182002342979, 0.73381064780313776,
+     2.5801438430346484, 2.4563759817827191},
+    {0.85862054687696465, 0.77044937465667263,
+     2.6947986429616893, 2.5663079607074715},
+    {0.82389535938795688, 0.73572418716766486,
+     2.4518794820444598, 2.3278776452228827},
+    {0.82194926966127357, 0.73377809744098155,
+     2.3915460560617636, 2.2677821633088127},
+    {0.86653466473838592, 0.77836349251809389,
+     2.4881533387789343, 2.358571511444099},
+    {0.86462985277593318, 0.77645868055564116,
+     2.4239269062338291, 2.294610132671699},
+    {0.78153115750134405, 0.69335998528105203,
+     2.4784501989649961, 2.3593303205389011},
+    {0.78135565845450627, 0.69318448623421425,
+     2.4190901090718646, 2.2999892166132763},
+    {0.82398792637030449, 0.73581675415001246,
+     2.5148626900648856, 2.390849500777747},
+    {0.63167251773922195, 0.54350134551892992,
+     2.6672569053003676, 2.5613176926317736},
+    {0.64005704603781799, 0.55188587381752596,
+     2.6083269761057362, 2.5017890482757736},
+    {0.67168175180000178, 0.58351057957970975,
+     2.7087994614211981, 2.5998710392615365},
+    {0.68067892026592169, 0.59250774804562967,
+     2.6472749855364515, 2.5376264701108027},
+    {0.58218878755743808, 0.49401761533714605,
+     2.6861896640473004, 2.5835077209558142},
+    {0.59185260167606613, 0.5036814294557741,
+     2.6287814021612084, 2.5254989238684891},
+    {0.62138862028020325, 0.53321744805991123,
+     2.7270251680180975, 2.621801137745301},
+    {0.60611221450043984, 0.51794104228014781,
+     2.5173565102694875, 2.4131570492215042},
+    {0.61087778585200303, 0.522706613631711,
+     2.4639333244243229, 2.3594190047786672},
+    {0.64660822697278197, 0.55843705475248995,
+     2.5506168907558799, 2.4436011705597021},
+    {0.65142990332571504, 0.56325873110542302,
+     2.4944602546315258, 2.3870871769773103},
+    {0.56019489731642469, 0.47202372509613266,
+     2.5392341136579941, 2.4378583197735186},
+    {0.56639863484958253, 0.4782274626292905,
+     2.4867402267657539, 2.3850043626555433},
+    {0.59980383114849467, 0.51163265892820264,
+     2.5723968713118315, 2.4686076833764807},
+    {0.76171764090852001, 0.67354646868822798,
+     2.7352505775289226, 2.6182141191910229},
+    {0.77010112747398518, 0.68192995525369315,
+     2.66902296030965, 2.551119570999933},
+    {0.80139135087952296, 0.71322017865923093,
+     2.7847735337536683, 2.6634408697646004},
+    {0.81083379561893487, 0.72266262339864284,
+     2.7156828655553773, 2.5932519059802046},
+    {0.71153930609076088, 0.62336813387046885,
+     2.7536244993399865, 2.6413617854822506},
+    {0.72135119911930556, 0.63318002689901354,
+     2.6894978828951497, 2.5763548093660558},
+    {0.75087086916660173, 0.6626996969463097,
+     2.8019300495630413, 2.6859845221983498},
+    {0.72650932423292081, 0.63833815201262878,
+     2.1913456073607152, 2.0777297572518676},
+    {0.73114130618350326, 0.64297013396321123,
+     2.2368380646612223, 2.1227916867644328},
+    {0.70153206370317411, 0.61336089148288209,
+     2.1582732155762034, 2.046883428318929},
+    {0.69471217962581533, 0.6065410074055233,
+     2.2096665989897386, 2.098857650107552},
+    {0.76136736585086451, 0.67319619363057248,
+     2.2009107810789561, 2.0839100885919577},
+    {0.73114130618350326, 0.64297013396321123,
+     2.2368380646612223, 2.1227916867644328},
+    {0.74252231689702508, 0.65435114467673305,
+     2.1511870892511848, 2.0360583256998095},
+    {0.776343098092238, 0.68817192587194598,
+     2.3083335488371102, 2.1897708485365017},
+    {0.7795495763375998, 0.69137840411730778,
+     2.3623265758891945, 2.2434205067571513},
+    {0.73492371594850492, 0.64675254372821289,
+     2.2850152950359606, 2.1706131002104057},
+    {0.73767301372123339, 0.64950184150094137,
+     2.335878963122163, 2.2212157089917723},
+    {0.80902693006731097, 0.72085575784701894,
+     2.2717087087595011, 2.1494902946685164},
+    {0.8184044872529338, 0.73023331503264177,
+     2.3341083183680023, 2.210774303196644},
+    {0.77196001270168857, 0.68378884048139654,
+     2.2572039693732289, 2.1391054831826515},
+    {0.63310365807087809, 0.54493248585058607,
+     2.1422489022923346, 2.0362084996925969},
+    {0.62636408800815269, 0.53819291578786066,
+     2.1931530666775845, 2.0875856266914288},
+    {0.60333945234222974, 0.51516828012193772,
+     2.1092427785195236, 2.0052245560878017},
+    {0.59042603528785143, 0.5022548630675594,
+     2.1591521834824334, 2.055959404533521},
+    {0.6747229004560924, 0.58655172823580037,
+     2.1248332553398535, 2.0156634817320733},
+    {0.66098769414689762, 0.57281652192660559,
+     2.1749362706224287, 2.0668402486192545},
+    {0.64602471468726397, 0.55785354246697194,
+     2.0910963707513468, 1.9841235676859097},
+    {0.65971763391051286, 0.57154646169022083,
+     2.2824458113005122, 2.1744469854290323},
+    {0.65692552226490697, 0.56875435004461494,
+     2.3377768065027245, 2.2299904338945846},
+    {0.6254595383758097, 0.53728836615551767,
+     2.2465474739341671, 2.1410428274969613},
+    {0.62317736859126749, 0.53500619637097546,
+     2.3010806456830162, 2.1957337126391163},
+    {0.69432659516652995, 0.60615542294623792,
+     2.2638485841785094, 2.153072140435925},
+    {0.69652941837477855, 0.60835824615448653,
+     2.3118669146055679, 2.2009042912689893},
+    {0.66104306061674223, 0.5728718883964502,
+     2.228069870375081, 2.1199696032973527},
+    {0.82356345037224776, 0.73539227815195574,
+     2.1627164220997681, 2.0387552649704288},
+    {0.79803105243243289, 0.70985988021214086,
+     2.2117083520811249, 2.0907592130751134},
+    {0.80288566825777363, 0.71471449603748161,
+     2.1087771843900942, 1.9872727436613375},
+    {0.78564808004503695, 0.69747690782474492,
+     2.1543741911835359, 2.0348061306032235},
+    {0.86336160405567675, 0.77519043183538472,
+     2.1722774506176523, 2.0431362933922723},
+    {0.8365286649907161, 0.74835749277042407,
+     2.223979636879398, 2.0983989550190918},
+    {0.84826123859771918, 0.76009006637742715,
+     2.1100747509185345, 1.9829729641797902},
+    {0.776343098092238, 0.68817192587194598,
+     2.3083335488371102, 2.1897708485365017},
+    {0.73767301372123339, 0.64950184150094137,
+     2.335878963122163, 2.2212157089917723},
+    {0.77196001270168857, 0.68378884048139654,
+     2.2572039693732289, 2.1391054831826515},
+    {0.73492371594850492, 0.64675254372821289,
+     2.2850152950359606, 2.1706131002104057},
+    {0.8184044872529338, 0.73023331503264177,
+     2.3341083183680023, 2.210774303196644},
+    {0.7795495763375998, 0.69137840411730778,
+     2.3623265758891945, 2.2434205067571513},
+    {0.80902693006731097, 0.72085575784701894,
+     2.2717087087595011, 2.1494902946685164},
+    {0.72959442841920441, 0.64142325619891238,
+     2.0621640517267807, 1.9482620854463399},
+    {0.71514009967732595, 0.62696892745703392,
+     2.1068851328085181, 1.9943021962635088},
+    {0.69916180079794166, 0.61099062857764963,
+     2.0178291766123717, 1.9066425365609709},
+    {0.68751218831593985, 0.59934101609564783,
+     2.0724160396371021, 1.9622082324615573},
+    {0.77415097091842044, 0.68597979869812842,
+     2.0607283193228865, 1.9423985274215958},
+    {0.75846541514324317, 0.67029424292295114,
+     2.1077271452383828, 1.9910213764782565},
+    {0.74366208381756593, 0.65549091159727391,
+     2.0140464021792828, 1.8988072833510055},
+    {0.65001490768149661, 0.56184373546120459,
+     3.007557179675806, 2.9002894799490173},
+    {0.668552789981673, 0.58038161776138097,
+     2.9454863878614499, 2.8368041281270595},
+    {0.68374052069132751, 0.59556934847103549,
+     3.0616074915944962, 2.9517097271373531},
+    {0.7038155955669535, 0.61564442334666147,
+     2.9988239843213238, 2.8872371859779973},
+    {0.59616267202722206, 0.50799149980693004,
+     3.0158099378569081, 2.9122542192261816},
+    {0.61504766701340718, 0.52687649479311516,
+     2.9560362342731032, 2.8512428901942055},
+    {0.62968052716147038, 0.54150935494117836,
+     3.0679333937361597, 2.9621343450373465},
+    {0.64740719425133308, 0.55923602203104106,
+     2.8331425585644796, 2.726067959543907},
+    {0.6605915807592051, 0.57242040853891307,
+     2.7709138443165395, 2.6628481738538019},
+    {0.68508036776469539, 0.59690919554440336,
+     2.8821458200542747, 2.7721382951805884},
+    {0.69944026235753387, 0.61126909013724184,
+     2.8180183328201878, 2.7068078975662617},
+    {0.59509337475482482, 0.5069222025345328,
+     2.8473938240679102, 2.7439062085371591},
+    {0.60918517557121932, 0.52101400335092729,
+     2.7872155524724418, 2.6828135518853085},
+    {0.63218669625560742, 0.54401552403531539,
+     2.8950047253533686, 2.7890292044945211},
+    {0.76956921091845376, 0.68139803869816173,
+     3.1136696652929774, 2.9958219091657177},
+    {0.79095087164459377, 0.70277969942430174,
+     3.0478784278016819, 2.9277250791411245},
+    {0.79939675945581279, 0.71122558723552076,
+     -3.1084058305270124, 3.0536749215139012},
+    {0.82261056198845839, 0.73443938976816636,
+     3.1090948970546739, 2.9852503046537686},
+    {0.71588025454547999, 0.62770908232518796,
+     3.1180395446003009, 3.0053903775425339},
+    {0.73760433938710523, 0.64943316716681321,
+     3.0549373215970492, 2.9402806135005903},
+    {0.74611971367717389, 0.65794854145688186,
+     -3.1065518184702103, 3.0611551828554973},
+    {0.77452358168211, 0.68635240946181797,
+     2.9223491721463164, 2.8039798959010511},
+    {0.78927849884496515, 0.70110732662467312,
+     2.8538818105800101, 2.7339140297349327},
+    {0.80995978518524159, 0.72178861296494956,
+     2.9796747975082036, 2.8573467917630762},
+    {0.82635290685006013, 0.7381817346297681,
+     2.9095943652551135, 2.7852900650348902},
+    {0.72182000469093754, 0.63364883247064552,
+     2.9342830494608929, 2.8210972936584282},
+    {0.73755056657884166, 0.64937939435854963,
+     2.8684692135078955, 2.7538176301335526},
+    {0.75723652887560833, 0.6690653566553163,
+     2.9895526837268478, 2.8729710629395186},
+    {0.52227050000408837, 0.43409932778379634,
+     3.0796934153813567, 2.9803827249030199},
+    {0.54258626933352627, 0.45441509711323436,
+     3.0236308730092127, 2.9232424710155311},
+    {0.55406432311554588, 0.46589315089525385,
+     3.1301521118286977, 3.0291258403323158},
+    {0.57575052431106066, 0.48757935209076864,
+     3.0739518640296808, 2.9716608722363294},
+    {0.46954350339991424, 0.38137233117962233,
+     3.0851833348119659, 2.9883823370525033},
+    {0.48960111342077162, 0.40142994120047959,
+     3.0310610294902833, 2.9333523826521466},
+    {0.50093087281273307, 0.41275970059244105,
+     3.133912484631959, 3.0356659938305102},
+    {0.52644089492900425, 0.43826972270871223,
+     2.9185799476490186, 2.8190532613255068},
+    {0.54282440744460747, 0.45465323522431556,
+     2.8608517594613057, 2.7604503393620012},
+    {0.56163485619924014, 0.47346368397894811,
+     2.9659983286260849, 2.8645395333924397},
+    {0.57919786454445155, 0.49102669232415952,
+     2.9071262935585844, 2.8046268680671789},
+    {0.47423067574272848, 0.38605950352243645,
+     2.9294257376596895, 2.8324176374291681},
+    {0.49091914307166984, 0.40274797085137781,
+     2.8735859897740896, 2.7758157207649017},
+    {0.50863791523778912, 0.4204667430174972,
+     2.9754288412688394, 2.8768058204263749},
+    {0.63845159454607625, 0.55028042232578422,
+     -3.102805739444948, 3.0739573836659853},
+    {0.66185312459781886, 0.57368195237752684,
+     3.1222302356100231, 3.0140677829876017},
+    {0.66740406398720453, 0.57923289176691251,
+     -3.0471184380254468, 3.1274744368295191},
+    {0.69236812365262723, 0.60419695143233521,
+     -3.1046851208980741, 3.0678882959577902},
+    {0.58468500833514581, 0.49651383611485378,
+     -3.1009149932267595, 3.0794348381267915},
+    {0.60780789530079837, 0.51963672308050635,
+     3.1262623131041756, 3.0219513084569392},
+    {0.61385686493729763, 0.5256856927170056,
+     -3.0473505648822639, 3.1311214175046742},
+    {0.64427718164833292, 0.55610600942804089,
+     -0.39718156162533413, -0.50402625731417749},
+    {0.59948411218239583, 0.51131293996210381,
+     -0.36162377934760426, -0.46539236977925746},
+    {0.63820622298848384, 0.55003505076819181,
+     -0.46291641897251845, -0.56932095947376837},
+    {0.59457058828549025, 0.50639941606519823,
+     -0.42555762031804201, -0.52901201542238696},
+    {0.6936286584464636, 0.60545748622617157,
+     -0.36669045280196266, -0.47740815012943794},
+    {0.64833303320710478, 0.56016186098681275,
+     -0.33106229781063418, -0.43820529198373742},
+    {0.68838852073120105, 0.60021734851090902,
+     -0.43488860872127211, -0.54516892864710587},
+    {0.55667452830362618, 0.46850335608333415,
+     -0.26623054525652412, -0.36740487254006771},
+    {0.51102557507404645, 0.42285440285375453,
+     -0.23675869986828868, -0.33550014929625627},
+    {0.55437767392702741, 0.46620650170673539,
+     -0.32811221306734367, -0.42915619917620113},
+    {0.50931363333856883, 0.42114246111827691,
+     -0.29653778267484604, -0.39519423343696652},
+    {0.60379142857150081, 0.51562025635120878,
+     -0.23406845256795061, -0.33811612036978211},
+    {0.55733694161124037, 0.46916576939094834,
+     -0.20500926982818679, -0.30622134930063921},
+    {0.60255943335193995, 0.51438826113164793,
+     -0.29762052749800699, -0.401588022328424},
+    {0.57951927602503917, 0.49134810380474714,
+     -0.55117701968855948, -0.65369598385816241},
+    {0.53775096038483627, 0.44957978816454425,
+     -0.51302651970914848, -0.61315254791608054},
+    {0.56964685655477987, 0.48147568433448784,
+     -0.61193412860404683, -0.71386111289865084},
+    {0.52921652344099313, 0.4410453512207011,
+     -0.57289828841643031, -0.67257021588080079},
+    {0.63021578520665467, 0.54204461298636264,
+     -0.52771258614746319, -0.63354921991409174},
+    {0.58787867033721963, 0.49970749811692761,
+     -0.48890500949323396, -0.59193852348442966},
+    {0.62045574765607325, 0.53228457543578123,
+     -0.59106269185881821, -0.69622287266039851},
+    {0.50151592384682009, 0.41334475162652806,
+     -0.41689071735042643, -0.51516548561545528},
+    {0.45818265211757214, 0.37001147989728012,
+     -0.38358003213620573, -0.47989144483276236},
+    {0.49548922833611986, 0.40731805611582783,
+     -0.47659955071199717, -0.57458540993756502},
+    {0.45306986932814142, 0.36489869710784939,
+     -0.44186764945484502, -0.53796437783794826},
+    {0.55042973434444387, 0.46225856212415184,
+     -0.39018714251263947, -0.49100911563606126},
+    {0.50614070761479069, 0.41796953539449877,
+     -0.35672613980072454, -0.45522620204419595},
+    {0.54486169276330765, 0.45669052054301562,
+     -0.4519795360188088, -0.55249269807102941},
+    {0.78690336752194567, 0.69873219530165365,
+     -0.37196286933977718, -0.4916686609156472},
+    {0.74226922140130969, 0.65409804918101766,
+     -0.33391608808435486, -0.44902039520508336},
+    {0.7812909111128078, 0.69311973889251577,
+     -0.44502349681916753, -0.56411738718741744},
+    {0.73807154176455869, 0.64990036954426667,
+     -0.40463652189274735, -0.51933778913585904},
+    {0.83454474073922014, 0.74637356851892811,
+     -0.33665966140133585, -0.46198841906038601},
+    {0.78985123647947353, 0.7016800642591815,
+     -0.29868515407198842, -0.41871638397751704},
+    {0.83015672101457993, 0.74198554879428791,
+     -0.41266123990686759, -0.5374381069962193},
+    {0.69736783351729881, 0.60919666129700678,
+     -0.23053326555963471, -0.34156705682109034},
+    {0.65032290003297732, 0.5621517278126853,
+     -0.19995814287335448, -0.30724874358585785},
+    {0.69662242238123107, 0.60845125016093904,
+     -0.29836095547680175, -0.40933146500867346},
+    {0.65033903637779056, 0.56216786415749853,
+     -0.26513289410427726, -0.37242469519611637},
+    {0.74330670116801645, 0.65513552894772442,
+     -0.19371109999927544, -0.30891577097981698},
+    {0.69593209931507161, 0.60776092709477958,
+     -0.16381360734377626, -0.27472563108477555},
+    {0.74400149270413818, 0.65583032048384615,
+     -0.2633771147494417, -0.3786491658950385},
+    {0.72252022628925572, 0.63434905406896369,
+     -0.54384690865921881, -0.65709652232302362},
+    {0.68097441493450606, 0.59280324271421403,
+     -0.50232995229013888, -0.6120024302368493},
+    {0.71146997951152291, 0.62329880729123088,
+     -0.61106340963043015, -0.72331999033608763},
+    {0.67152427512187796, 0.58335310290158593,
+     -0.56843021260611237, -0.67734619357733294},
+    {0.7731026035194537, 0.68493143129916167,
+     -0.51710139191398452, -0.63532032092836854},
+    {0.7314492912222138, 0.64327811900192178,
+     -0.47483695218992095, -0.58891215892232829},
+    {0.7625082453641292, 0.67433707314383717,
+     -0.58749216128479809, -0.70460947986489053},
+    {0.63590493544575588, 0.54773376322546385,
+     -2.5226371243700227, -2.6288767848756316},
+    {0.60449213357541942, 0.51632096135512739,
+     -2.4764401276948509, -2.5805335200860759},
+    {0.61866202456453279, 0.53049085234424076,
+     -2.5802006050681632, -2.6852384904955517},
+    {0.58806062396234871, 0.49988945174205668,
+     -2.5333946706734802, -2.6364395221993164},
+    {0.68200324630097275, 0.59383207408068073,
+     -2.5114699938435234, -2.6212260593068524},
+    {0.65134300372828902, 0.56317183150799699,
+     -2.4648948583725527, -2.5722614522528939},
+    {0.66570352670421917, 0.57753235448392715,
+     -2.569895289552973, -2.6783552790001974},
+    {0.58569501480989383, 0.49752384258960181,
+     -2.3757379916216292, -2.4786359018873494},
+    {0.55118778851679784, 0.46301661629650581,
+     -2.3333729739597189, -2.4342373787679037},
+    {0.57167722403544252, 0.48350605181515049,
+     -2.4314575816612081, -2.5335049422890261},
+    {0.53770294196440171, 0.4495317697441098,
+     -2.3878148725746673, -2.4879383138094635},
+    {0.63204453783395398, 0.54387336561366195,
+     -2.3632657861572652, -2.4692312633533429},
+    {0.5980037270825127, 0.50983255486222068,
+     -2.3207547778600728, -2.4244282408006268},
+    {0.61916435687764082, 0.53099318465734879,
+     -2.419609803256908, -2.524681874755569},
+    {0.55027427936657702, 0.462103107146285,
+     -2.6462179360714471, -2.7470312192516637},
+    {0.51972248294986978, 0.43155131072957775,
+     -2.5996217159818564, -2.6988017462068661},
+    {0.52920314455280626, 0.44103197233251434,
+     -2.7013934498060865, -2.8010646743300707},
+    {0.49943414804774311, 0.41126297582745119,
+     -2.6548512339203629, -2.7530256099040233},
+    {0.59971539212860181, 0.51154421990830978,
+     -2.6372102029858091, -2.7409936914658815},
+    {0.5699474382118519, 0.48177626599155987,
+     -2.5901065231576159, -2.6920512839155113},
+    {0.57920975137054265, 0.49103857915025062,
+     -2.6933120400659063, -2.7958121878390405},
+    {0.50592240229936691, 0.41775123007907489,
+     -2.4983167316518271, -2.5968060886327553},
+    {0.47211971880996406, 0.38394854658967215,
+     -2.4539578294631177, -2.5508722840507891},
+    {0.48774511944239185, 0.39957394722209982,
+     -2.5537126437220343, -2.6513349357109974},
+    {0.45456963789715121, 0.36639846567685919,
+     -2.5086626848708864, -2.6048220284030617},
+    {0.55596434122728144, 0.46779316900698942,
+     -2.4875784033086079, -2.5887123362299169},
+    {0.52260164195595915, 0.43443046973566712,
+     -2.4429048502966393, -2.5422325941247155},
+    {0.53861284271942278, 0.45044167049913075,
+     -2.5437504509393571, -2.6439229747292803},
+    {0.75431719661929308, 0.66614602439900106,
+     -2.5480525847813786, -2.6643410397077223},
+    {0.72625297516067122, 0.63808180294037919,
+     -2.4998856783633978, -2.613477867630372},
+    {0.73802513462223629, 0.64985396240194426,
+     -2.607849222745545, -2.7225460612660846},
+    {0.71094977306172158, 0.62277860084142955,
+     -2.559182095864422, -2.6713926937569603},
+    {0.79575746048361251, 0.70758628826332048,
+     -2.536498216844985, -2.6571900046088301},
+    {0.76858874068828087, 0.68041756846798884,
+     -2.4878766569340374, -2.6056220903192293},
+    {0.78044651817744515, 0.69227534595715312,
+     -2.597252882512842, -2.7162555771279036},
+    {0.70884528785365075, 0.62067411563335873,
+     -2.3946904908098983, -2.5067157589484284},
+    {0.67663010791864486, 0.58845893569835284,
+     -2.3503941530333852, -2.4597163494906753},
+    {0.69639472333118035, 0.60822355111088833,
+     -2.4529359409875875, -2.5638871466612354},
+    {0.66492121527037196, 0.57675004305007993,
+     -2.4073558508724049, -2.5157551252181052},
+    {0.75087073516477976, 0.66269956294448773,
+     -2.3816088004043676, -2.4975543145012482},
+    {0.71936777484054848, 0.63119660262025645,
+     -2.337119457885005, -2.4500825811227731},
+    {0.73956367280976365, 0.65139250058947162,
+     -2.4405569809040633, -2.5554009595200706},
+    {0.67464866826339664, 0.58647749604310462,
+     -2.6760506764631029, -2.7852145340968817},
+    {0.64757549653618152, 0.55940432431588949,
+     -2.6278188405125453, -2.7349058593258837},
+    {0.65390786496952324, 0.56573669274923122,
+     -2.7328694658972204, -2.8404281021381435},
+    {0.62774507595218176, 0.53957390373188974,
+     -2.6848675129639674, -2.7905311318831045},
+    {0.71979927636195373, 0.63162810414166171,
+     -2.6668523815938672, -2.7798545671433859},
+    {0.69371287956744943, 0.6055417073471574,
+     -2.6180348403055032, -2.7287596204880744},
+    {0.69977262065704926, 0.61160144843675723,
+     -2.7246803838632627, -2.8359192445544301},
+    {0.63245373108176439, 0.54428255886147237,
+     0.043668115817252058, -0.062326282311851867},
+    {0.62413170235973792, 0.53596053013944589,
+     0.10061604899038892, -0.0047967108016939569},
+    {0.59193482214501392, 0.50376364992472189,
+     0.0064043823590357457, -0.096883276936909277},
+    {0.58465076172626762, 0.49647958950597559,
+     0.061633791606994677, -0.041199570401157244},
+    {0.6800687022302524, 0.59189753000996037,
+     0.024638083837062567, -0.084961010635239337},
+    {0.67234438808429808, 0.58417321586400606,
+     0.083051985312641408, -0.02592884812711645},
+    {0.63924749179022733, 0.5510763195699353,
+     -0.013907964698549484, -0.12038746259802781},
+    {0.65275235553668431, 0.56458118331639229,
+     0.20263417092847968, 0.095162225204641238},
+    {0.63991556056009502, 0.55174438833980299,
+     0.26334308809712614, 0.15681538170221515},
+    {0.61397949448008915, 0.52580832225979712,
+     0.15867348086380939, 0.053951928137109813},
+    {0.60194987212919804, 0.51377869990890601,
+     0.21747184993972077, 0.11354391876940975},
+    {0.70257398494484535, 0.61440281272455333,
+     0.18711755497075661, 0.075638034710799426},
+    {0.69094266629006296, 0.60277149406977093,
+     0.24945698753970119, 0.13896429283113293},
+    {0.66355075860718693, 0.5753795863868949,
+     0.14239548287977444, 0.034102246224570379},
+    {0.50440273155314341, 0.4162315593328515,
+     -0.0094652181720986522, -0.10788024781901714},
+    {0.49751308621407297, 0.40934191399378106,
+     0.042877712121951683, -0.055204580451777674},
+    {0.46274148286070216, 0.37457031064041024,
+     -0.042923336297892543, -0.13942911554220608},
+    {0.45961141369740999, 0.37144024147711807,
+     0.0091853699746587344, -0.087186658493120753},
+    {0.55032242776866414, 0.46215125554837211,
+     -0.029439465630954842, -0.13025543988935454},
+    {0.5454137860402607, 0.45724261381996867,
+     0.025287844700679737, -0.075255713571352495},
+    {0.50788570139237033, 0.4197145291720783,
+     -0.063851348047595707, -0.16243723404767407},
+    {0.525130374949766, 0.43695920272947408,
+     0.13368015842293937, 0.034221635012654128},
+    {0.51262615342456619, 0.42445498120427427,
+     0.18924837274624545, 0.090427059116471753},
+    {0.4869229327093868, 0.39875176048909489,
+     0.095580185380664207, -0.0020040084214969084},
+    {0.47489378434666374, 0.38672261212637182,
+     0.14926020698804845, 0.052222563468898468},
+    {0.5749712553311852, 0.48680008311089318,
+     0.11747823472266058, 0.015234073599750514},
+    {0.5635759376359295, 0.47540476541563748,
+     0.17427655714579407, 0.072705326152921856},
+    {0.53605158876563563, 0.44788041654534361,
+     0.078925976275352278, -0.021108720556491115},
+    {0.7351499855691136, 0.64697881334882157,
+     -0.059483280361040045, -0.17390688305657567},
+    {0.72808806426006589, 0.63991689203977387,
+     0.00406390351981082, -0.1096980457017589},
+    {0.69244452634261655, 0.60427335412232452,
+     -0.098750207747435245, -0.20936850041435123},
+    {0.68708483046589974, 0.59891365824560772,
+     -0.035809525577907557, -0.14598203598074969},
+    {0.78312262928045973, 0.6949514570601677,
+     -0.085137909809400891, -0.20443040264278567},
+    {0.77621734290583733, 0.6880461706855453,
+     -0.018244945046579128, -0.13679424395270978},
+    {0.74029753244430896, 0.65212636022401693,
+     -0.12555996612506354, -0.24047435731916156},
+    {0.75917040173840566, 0.67099922951811364,
+     0.1076193475242494, -0.0091578414474882061},
+    {0.75115889848621653, 0.6629877262659245,
+     0.17086838206623545, 0.054894324461471487},
+    {0.71936655046984732, 0.63119537824955529,
+     0.064741198733260355, -0.048221813734887403},
+    {0.71202599758659713, 0.6238548253663051,
+     0.12539477626154122, 0.013088971929613016},
+    {0.80478257395352126, 0.71661140173322924,
+     0.089012929762591675, -0.032710660593850249},
+    {0.79828401947969529, 0.71011284725940327,
+     0.15382769079781469, 0.032849811517483493},
+    {0.76738882766016003, 0.67921765543986801,
+     0.045684959607515577, -0.071935645033513809},
+    {0.60096865896326401, 0.51279748674297199,
+     -0.11027037645669542, -0.2141347660675319},
+    {0.59714845564703367, 0.50897728342674164,
+     -0.050873112230041678, -0.15449179949031974},
+    {0.55642662391598852, 0.46825545169569649,
+     -0.1448862142028009, -0.24604643159901918},
+    {0.55404449253303778, 0.46587332031274575,
+     -0.086252428369342354, -0.18727757932920408},
+    {0.64837109931457504, 0.56019992709428301,
+     -0.13606506644240254, -0.24321087653615389},
+    {0.64462062237907714, 0.55644945015878511,
+     -0.073919212362557676, -0.18078903485968123},
+    {0.60322875079782146, 0.51505757857752943,
+     -0.17146668298027454, -0.27547769920184911},
+    {0.56795908424212072, 0.47978791202182869,
+     -0.82247569610723359, -0.92430315094946824},
+    {0.53291962177805008, 0.44474844955775805,
+     -0.78174950929521947, -0.88161707134044576},
+    {0.5526541209770176, 0.46448294875672558,
+     -0.87369177378184981, -0.97463852196435841},
+    {0.51902160731273339, 0.43085043509244147,
+     -0.83345940469284174, -0.93260366765528191},
+    {0.61774948994919299, 0.52957831772890096,
+     -0.81050525930464845, -0.91548116708009908},
+    {0.58262964978238074, 0.49445847756208872,
+     -0.76846045392184381, -0.8711694328556443},
+    {0.60160535355722544, 0.51343418133693342,
+     -0.86404944138850848, -0.96795504191853299},
+    {0.50851134891543504, 0.42034017669514312,
+     -0.68765689043792066, -0.78627365716773923},
+    {0.47003456757524764, 0.38186339535495561,
+     -0.64905689793199139, -0.7458794521601978},
+    {0.49670741594946777, 0.40853624372917585,
+     -0.74197338550190473, -0.84001721842486188},
+    {0.45956900594701577, 0.37139783372672386,
+     -0.70323301770165658, -0.79960324307178743},
+    {0.55844890476774522, 0.4702777325474532,
+     -0.6708020860798628, -0.77207770178487889},
+    {0.51941109724723833, 0.4312399250269463,
+     -0.63121469891682036, -0.73037882922924169},
+    {0.54613396861516916, 0.45796279639487714,
+     -0.72748126435078997, -0.82806454696012},
+    {0.48997759320793188, 0.40180642098763997,
+     -0.92894430903564595, -1.0266705322821135},
+    {0.45777308238336112, 0.36960191016306909,
+     -0.89065377018889857, -0.98694785702739862},
+    {0.47518605560791727, 0.38701488338762535,
+     -0.97272486507986522, -1.0697755493438086},
+    {0.4442034200536541, 0.35603224783336218,
+     -0.93524835832147479, -1.030980960461449},
+    {0.53693309699280101, 0.44876192477250898,
+     -0.92207351691736639, -1.0221555328216716},
+    {0.50464497437597355, 0.41647380215568164,
+     -0.88253138853379121, -0.98095824357163874},
+    {0.52099195194704739, 0.43282077972675548,
+     -0.96764230759239345, -1.0668873116154289},
+    {0.43666136133687994, 0.34849018911658802,
+     -0.80526405981780813, -0.90069497549084365},
+    {0.40137811158085879, 0.31320693936056676,
+     -0.76772994692953833, -0.86184473474311141},
+    {0.42454998331693805, 0.33637881109664614,
+     -0.85287281650209301, -0.94783448072199306},
+    {0.39050228657910213, 0.30233111435881022,
+     -0.81569503904686214, -0.90943478477340489},
+    {0.48419287079849438, 0.39602169857820235,
+     -0.79398095675033886, -0.89143933107162154},
+    {0.44838824839593505, 0.36021707617564303,
+     -0.75535246971505876, -0.85125565000351278},
+    {0.47115602079155683, 0.38298484857126491,
+     -0.84356116164671968, -0.94043306846258046},
+    {0.70142133685467256, 0.61325016463438053,
+     -0.84195039980310027, -0.95333066656866483},
+    {0.66814659780821206, 0.57997542558792003,
+     -0.79742814377561866, -0.90607860696456799},
+    {0.68302953902969543, 0.5948583668094034,
+     -0.8973354831554532, -1.0071751728451834},
+    {0.65127614687631574, 0.56310497465602372,
+     -0.85350650743844525, -0.9608681140638452},
+    {0.75177932573584727, 0.66360815351555524,
+     -0.8292510032541206, -0.94528659662986569},
+    {0.71888271593786368, 0.63071154371757165,
+     -0.78310646469565537, -0.896025734581813},
+    {0.73273431635817343, 0.64456314413788141,
+     -0.8874166272600561, -1.0016123927467038},
+    {0.64732976166198664, 0.55915858944169461,
+     -0.69463654607235981, -0.80170543297534103},
+    {0.60911952499216826, 0.52094835277187623,
+     -0.65252756729016059, -0.75692522229036696},
+    {0.63307938104154204, 0.54490820882125002,
+     -0.75398937644152886, -0.86002805909119173},
+    {0.59643082719122431, 0.50825965497093228,
+     -0.71174999411634543, -0.81532282407732248},
+    {0.69853772436719841, 0.61036655214690638,
+     -0.67597833098842053, -0.78711171047605111},
+    {0.66023127777982249, 0.57206010555953046,
+     -0.63267442305545807, -0.74071251540908001},
+    {0.68399878336874853, 0.5958276111484565,
+     -0.73819416954016137, -0.84811305851109353},
+    {0.61558947359804062, 0.52741830137774859,
+     -0.9559675706837224, -1.0607974126992019},
+    {0.58489718689665726, 0.49672601467636524,
+     -0.91456847515009043, -1.0174170519893384},
+    {0.59726563050043313, 0.5090944582801411,
+     -1.002418935132569, -1.1060451189292897},
+    {0.56785241104666795, 0.47968123882637592,
+     -0.96207608349080387, -1.0638972639908668},
+    {0.66400208638605662, 0.5758309141657646,
+     -0.94924967727763132, -1.0575777895766647},
+    {0.63367025322144255, 0.54549908100115052,
+     -0.90635200468311661, -1.0124325823561342},
+    {0.64460444911830228, 0.55643327689801025,
+     -0.99775652574578255, -1.1046251644269065},
+    {0.54164934898142814, 0.45347817676113622,
+     1.5512406308251845, 1.4509033587435556},
+    {0.54162448528296181, 0.45345331306266989,
+     1.6087936175577875, 1.5084577004368396},
+    {0.49883315897939029, 0.41066198675909837,
+     1.5198550683001943, 1.4217095574018559},
+    {0.49915935387765054, 0.41098818165735862,
+     1.576384277104935, 1.4782231057993735},
+    {0.58383714528940522, 0.4956659730691132,
+     1.5249964464644243, 1.4222132426627021},
+    {0.58406248596221977, 0.49589131374192774,
+     1.5841962588098528, 1.4813991748139481},
+    {0.54028580393318659, 0.45211463171289468,
+     1.4936916945413705, 1.3934285841336365},
+    {0.58073627622722823, 0.49256510400693621,
+     1.7010365942599122, 1.5984434847249109},
+    {0.57713747419661265, 0.48896630197632063,
+     1.760056596528015, 1.6576819949834642},
+    {0.54018328587686759, 0.45201211365657568,
+     1.667025201034813, 1.566767654505318},
+    {0.5372952122449911, 0.44912404002469908,
+     1.7255480636550746, 1.6254465740022852},
+    {0.62384644960238533, 0.53567527738209331,
+     1.6785744438611663, 1.5731813785256636},
+    {0.61967242933263944, 0.53150125711234741,
+     1.7357577701463769, 1.6306510723022614},
+    {0.58278676675477736, 0.49461559453448534,
+     1.6420782460528796, 1.539359623665304},
+    {0.41127907959264109, 0.32310790737234918,
+     1.5143272561090972, 1.4198586708876069},
+    {0.41085322444879302, 0.32268205222850099,
+     1.5697952796311989, 1.4753421572708094},
+    {0.36640207070694819, 0.27823089848665616,
+     1.484724431140626, 1.3917663042572406},
+    {0.36602080524912506, 0.27784963302883314,
+     1.5391219807451804, 1.4461756817979508},
+    {0.45509529714659547, 0.36692412492630344,
+     1.4894534074228576, 1.3932720471465914},
+    {0.45562438798288663, 0.36745321576259471,
+     1.5448865254837014, 1.4486829677015258},
+    {0.41069795907841378, 0.32252678685812186,
+     1.4600487443093049, 1.3656012541370277},
+    {0.45318514772970131, 0.36501397550940939,
+     1.6585331278207132, 1.5624315971396292},
+    {0.45014291843908416, 0.36197174621879213,
+     1.7160426448500914, 1.6200672606275099},
+    {0.40936449801037811, 0.32119332579008608,
+     1.6261417053589746, 1.5317424646377813},
+    {0.4067820260797792, 0.31861085385948729,
+     1.6830234205433403, 1.5887170065079321},
+    {0.49819905919116925, 0.41002788697087722,
+     1.6337828096884643, 1.5356676973550147},
+    {0.49590909689541862, 0.4077379246751266,
+     1.6916862825672085, 1.5936804659142996},
+    {0.45500490287503892, 0.36683373065474689,
+     1.6013593262175547, 1.5051817546304136},
+    {0.62460025500284966, 0.53642908278255763,
+     1.4336974877771587, 1.3282523435087357},
+    {0.62703866016963949, 0.53886748794934747,
+     1.4965536255047014, 1.3909392519753205},
+    {0.57858793830854316, 0.49041676608825113,
+     1.4042059369869055, 1.3017435394907535},
+    {0.58202728790490077, 0.49385611568460874,
+     1.4648597680620723, 1.3621877203695227},
+    {0.66772455544380593, 0.57955338322351391,
+     1.3999717353228183, 1.2913542707451569},
+    {0.6709993532842099, 0.58282818106391787,
+     1.4656684024643469, 1.3567938520766314},
+    {0.62031894455120473, 0.53214777233091271,
+     1.3705278387355455, 1.2653770070706249},
+    {0.67146128236974378, 0.58329011014945176,
+     1.5947037487413422, 1.4857927428579334},
+    {0.6688388201672153, 0.58066764794692327,
+     1.6570355081454757, 1.5483308361603851},
+    {0.62766584331150821, 0.53949467109121618,
+     1.5586096262631088, 1.4529515356918685},
+    {0.62656157060354023, 0.5383903983832482,
+     1.6194152365427634, 1.5138340659431966},
+    {0.71724178799119898, 0.62907061577090695,
+     1.5676775242225762, 1.454906159243575},
+    {0.71489107884287373, 0.6267199066225817,
+     1.633450927485796, 1.5208902424507329},
+    {0.67222185828567382, 0.5840506860653818,
+     1.5307560303681809, 1.4217848958411994},
+    {0.49371361874796893, 0.40554244652767701,
+     1.4082001769347514, 1.310298436483442},
+    {0.49729338760630304, 0.40912221538601112,
+     1.4645266045919243, 1.3664548089035837},
+    {0.45091779235022533, 0.36274662012993331,
+     1.3828648625345861, 1.286857463821987},
+    {0.4534943853569291, 0.36532321313663718,
+     1.4353610001969068, 1.3392465785329115},
+    {0.53325934167485867, 0.44508816945456675,
+     1.3769694836487534, 1.2770838670995195},
+    {0.53749475448323181, 0.44932358226293978,
+     1.4354723099636746, 1.3353600805258283},
+    {0.48887244841622346, 0.40070127619593154,
+     1.3517818191546351, 1.2541071336418743},
+    {0.5358010143089198, 0.44762984208862788,
+     0.45199883712454259, 0.35197756869807129},
+    {0.51537822059044058, 0.42720704837014867,
+     0.50849763741543363, 0.40953810776644417},
+    {0.50120672378198872, 0.4130355515616968,
+     0.40375356196966344, 0.30549374459103146},
+    {0.48190724401660523, 0.39373607179631331,
+     0.45982887499314468, 0.36247503097163863},
+    {0.58965775528221975, 0.50148658306192773,
+     0.4438516714677111, 0.34070704883773339},
+    {0.56942678312965278, 0.48125561090936075,
+     0.50207256414131562, 0.40015858526742509},
+    {0.5548411272941508, 0.46666995507385878,
+     0.39427590471677881, 0.29320568868169811},
+    {0.52502055542431814, 0.43684938320402622,
+     0.6134785946921979, 0.51402577123365267},
+    {0.50137267677994657, 0.41320150455965465,
+     0.66615980757409177, 0.56789196753097948},
+    {0.49379943296709494, 0.40562826074680303,
+     0.56346315933186475, 0.46555736388549118},
+    {0.47131283114344069, 0.38314165892314866,
+     0.6166396934809959, 0.51976087207947841},
+    {0.57887623206467909, 0.49070505984438706,
+     0.61027315506593793, 0.50779326363784238},
+    {0.5548714965367757, 0.46670032431648367,
+     0.66453537383724948, 0.5634634377701897},
+    {0.54779593303494645, 0.45962476081465442,
+     0.55870936993691478, 0.45803409617680146},
+    {0.41302718007762107, 0.32485600785732904,
+     0.3676829817960095, 0.27315068999857112},
+    {0.39460140026708834, 0.30643022804679632,
+     0.421603800564608, 0.32772435596554139},
+    {0.3782338447840462, 0.29006267256375418,
+     0.32438979885528274, 0.23105635312837072},
+    {0.36066100195216066, 0.27248982973186875,
+     0.37751861833835326, 0.28473685195442694},
+    {0.46596578237444375, 0.37779461015415172,
+     0.35745185857863271, 0.26080692181148635},
+    {0.44768669099987612, 0.3595155187795841,
+     0.41285372660829367, 0.31697930215125791},
+    {0.43040024815261957, 0.34222907593232754,
+     0.31316674684439305, 0.21798073677040572},
+    {0.40800817713258331, 0.31983700491229128,
+     0.52069647964078203, 0.42634609295931286},
+    {0.38702149364681537, 0.29885032142652335,
+     0.57259011742425359, 0.47896743860530155},
+    {0.3752972256278112, 0.28712605340751929,
+     0.47463220338034312, 0.38139341202185423},
+    {0.355307568224009, 0.26713639600371708,
+     0.52650087337738383, 0.43388021226141604},
+    {0.46146575261305145, 0.37329458039275942,
+     0.51470002704779838, 0.41824891983722595},
+    {0.44010526633143587, 0.35193409411114396,
+     0.56808715294395118, 0.47251938976908886},
+    {0.42830149106187065, 0.34013031884157874,
+     0.46736636036741885, 0.3722613297083639},
+    {0.66115252344153974, 0.57298135122124771,
+     0.37405648576966732, 0.26594782396881222},
+    {0.64315207386318118, 0.55498090164288916,
+     0.43535857858798543, 0.3285960271863605},
+    {0.62506032907196774, 0.53688915685167571,
+     0.32407686334090718, 0.21859987869537603},
+    {0.60826346628605432, 0.5200922940657623,
+     0.38438906581678256, 0.2800480013807336},
+    {0.71320308273580701, 0.62503191051551499,
+     0.36323612370320418, 0.2508258561019942},
+    {0.69596945349209705, 0.60779828127180502,
+     0.42648594372919579, 0.31557075818481028},
+    {0.67711944889155262, 0.5889482766712606,
+     0.31193233056253755, 0.20257089346772275},
+    {0.6554187961419542, 0.56724762392166217,
+     0.54876506475193754, 0.44109264463609216},
+    {0.63256499746721007, 0.54439382524691804,
+     0.6070192067970076, 0.50101693878988918},
+    {0.62328673176512406, 0.53511555954483203,
+     0.49540470384345581, 0.39005023633217117},
+    {0.60177552605573115, 0.51360435383543912,
+     0.55381464417883641, 0.44989801632887511},
+    {0.70841715220181478, 0.62024597998152275,
+     0.54354351983642568, 0.43155581952823269},
+    {0.68577730362546108, 0.59760613140516905,
+     0.60371065850688899, 0.49364587567325668},
+    {0.67663874581672823, 0.5884675735964362,
+     0.48847008095823291, 0.37914719229220278},
+    {0.53562076939601189, 0.44744959717571997,
+     0.28931305302319454, 0.18930143789625969},
+    {0.51916585780292313, 0.43099468558263121,
+     0.34679649092698023, 0.24764487262593465},
+    {0.49855314875239065, 0.41038197653209862,
+     0.24529967611515435, 0.14716759601507473},
+    {0.48296708686777257, 0.39479591464748054,
+     0.30148538549963583, 0.20408316204559546},
+    {0.58804179726107919, 0.49987062504078716,
+     0.27661283396954223, 0.17356915580986532},
+    {0.57230500117114125, 0.48413382895084922,
+     0.33568400328657882, 0.23359928023845594},
+    {0.55044943526463297, 0.46227826304434094,
+     0.23167911411887682, 0.13085603943183305},
+    {0.51195780150161418, 0.42378662928132216,
+     1.9547260265737338, 1.855938108241217},
+    {0.52020300886104354, 0.43203183664075151,
+     1.8989099522118773, 1.7997053565845154},
+    {0.54833508562977074, 0.46016391340947871,
+     1.9888707988422847, 1.8881655865817608},
+    {0.55750007926405365, 0.46932890704376162,
+     1.9334805826138359, 1.832259194476076},
+    {0.46538186347446153, 0.37721069125416951,
+     1.9754753479846938, 1.8788557168257358},
+    {0.47378423216303445, 0.38561305994274253,
+     1.9206834727682229, 1.8236952286647397},
+    {0.50264212589942048, 0.41447095367912856,
+     2.0090269251049122, 1.9106975831006308},
+    {0.48733741395607866, 0.39916624173578663,
+     1.8074661813709094, 1.7098627934533648},
+    {0.49227994770430727, 0.40410877548401525,
+     1.7497104448286211, 1.651876293738445},
+    {0.52724293773046182, 0.43907176551016991,
+     1.8418752827655041, 1.7423067499996694},
+    {0.53296696130189569, 0.44479578908160367,
+     1.7839630435778808, 1.6840929667436235},
+    {0.44046281411705124, 0.35229164189675921,
+     1.8305569015294554, 1.7349748432972938},
+    {0.44588806912224965, 0.35771689690195763,
+     1.7735094851571038, 1.6777084896430805},
+    {0.48114173645093661, 0.39297056423064458,
+     1.8645749977442925, 1.7672559995669246},
+    {0.62642055780489925, 0.53824938558460722,
+     2.0029901215927217, 1.8974187561470244},
+    {0.63622588642942335, 0.54805471420913132,
+     1.9470138339686369, 1.8407512427637527},
+    {0.65794823241780442, 0.5697770601975124,
+     2.0377564860777082, 1.9298924895673932},
+    {0.66868694194872857, 0.58051576972843655,
+     1.9824090761527877, 1.8737163070324581},
+    {0.5828312757299916, 0.49466010350969958,
+     2.0230354097537848, 1.9203140547245467},
+    {0.5929278479437905, 0.50475667572349847,
+     1.9682026490112388, 1.8648523193655775},
+    {0.61539910171124212, 0.5272279294909501,
+     2.0571375865094712, 1.9523205749957266},
+    {0.60928007887605318, 0.52110890665576115,
+     1.8539301793644063, 1.7495218954393994},
+    {0.61526849263016803, 0.527097320409876,
+     1.7951416744224549, 1.6903334615610834},
+    {0.64465226225097749, 0.55648109003068547,
+     1.8894823399418974, 1.7826102013799332},
+    {0.65156073113198976, 0.56338955891169773,
+     1.8307254335490464, 1.7233425915321761},
+    {0.56543691867343615, 0.47726574645314412,
+     1.8766588669731108, 1.7749792456346378},
+    {0.57201609571108414, 0.48384492349079211,
+     1.81872903947748, 1.7166615191533119},
+    {0.60179315992929394, 0.51362198770900191,
+     1.9117339826767161, 1.8078162118311079},
+    {0.4088634137220708, 0.32069224150177877,
+     2.0478406743388864, 1.9534595085539546},
+    {0.41801432746139411, 0.32984315524110208,
+     1.9957344172917837, 1.9010183110323651},
+    {0.44599701911760925, 0.35782584689731722,
+     2.0800791583713911, 1.984273726978202},
+    {0.456070407836076, 0.36789923561578397,
+     2.0286803251316479, 1.9324580261187017},
+    {0.36128028706474158, 0.27310911484444955,
+     2.0665177983925807, 1.9737171874311727},
+    {0.37011775673762515, 0.28194658451733323,
+     2.0155096748380905, 1.9224354099600696},
+    {0.39910348755232494, 0.31093231533203303,
+     2.0981049946410617, 2.0040698135708257},
+    {0.38589376791585905, 0.29772259569556703,
+     1.9086209827080893, 1.8150359261380216},
+    {0.39259107168463003, 0.30441989946433812,
+     1.8532276680794113, 1.7594169849623489},
+    {0.42641720994576582, 0.33824603772547379,
+     1.9419807315127999, 1.846947931197412},
+    {0.43393966155041297, 0.34576848933012105,
+     1.8868243872060819, 1.7915005456192252},
+    {0.33728432809547326, 0.24911315587518121,
+     1.929963393190409, 1.8378617162700484},
+    {0.34399818469399468, 0.25582701247370276,
+     1.8754722826613053, 1.783181461791691},
+    {0.37836388931076015, 0.29019271709046823,
+     1.9628040101735085, 1.8694663497331634},
+    {0.5269395172190231, 0.43876834499873107,
+     2.0943221110880641, 1.9947694209025872},
+    {0.53809326578015404, 0.44992209355986212,
+     2.042556990411168, 1.9424125100805765},
+    {0.5596179447575057, 0.47144677253721368,
+     2.1268732046656655, 2.0255305701456905},
+    {0.57166930293193219, 0.48349813071164016,
+     2.0759876650182671, 1.9739407753866474},
+    {0.48141332644945711, 0.3932421542291652,
+     2.1121562520278196, 2.014824900478474},
+    {0.49240731609459654, 0.40423614387430462,
+     2.0615673546355531, 1.9637272107721269},
+    {0.51504419931602285, 0.42687302709573083,
+     2.1440052962994138, 2.0450626026561944},
+    {0.50282144547794605, 0.41465027325765413,
+     1.147928401084708, 1.0495903524662289},
+    {0.51227472496554838, 0.42410355274525635,
+     1.2037046929220054, 1.1049009473065732},
+    {0.45805249696760031, 0.36988132474730839,
+     1.1321133895846209, 1.0358074852142507},
+    {0.46729214741618097, 0.37912097519588905,
+     1.1854863104703426, 1.0887837204563164},
+    {0.53837915697083782, 0.4502079847505458,
+     1.1083628137738106, 1.0082029081436468},
+    {0.54915042457782182, 0.46097925235752979,
+     1.1651890117527288, 1.0644384351984506},
+    {0.49235773630536805, 0.40418656408507614,
+     1.0936682740570005, 0.99583046323381674},
+    {0.56685750123355771, 0.47868632901326569,
+     1.2831172736104703, 1.1813545191149537},
+    {0.57351714898702544, 0.48534597676673341,
+     1.3434767776191585, 1.2413197216302205},
+    {0.52057456746789255, 0.43240339524760063,
+     1.2607022055250563, 1.1614785910575236},
+    {0.5276000671420793, 0.43942889492178738,
+     1.3185815717658171, 1.2189943738919256},
+    {0.60636066240479558, 0.51818949018450355,
+     1.2452434773449215, 1.141027706791707},
+    {0.61421502504856529, 0.52604385282827326,
+     1.3075458012764334, 1.2028084373792809},
+    {0.55869426738054406, 0.47052309516025204,
+     1.2235562898493286, 1.122266626804685},
+    {0.38217885097929694, 0.29400767875900491,
+     1.1532641071746437, 1.0598019311595566},
+    {0.39010648958449512, 0.30193531736420309,
+     1.2035398815088543, 1.1098135193169412},
+    {0.3422178250124015, 0.25404665279210958,
+     1.1389701481577714, 1.0467299647658157},
+    {0.34983938830325556, 0.26166821608296353,
+     1.1872930170919318, 1.0948336070135527},
+    {0.4149642372963176, 0.32679306507602557,
+     1.1175826382158931, 1.022979315300419},
+    {0.42389224192647657, 0.33572106970618454,
+     1.1687243344863154, 1.0737876242094517},
+    {0.37363751634149434, 0.28546634412120242,
+     1.1041960513075053, 1.011010316361816},
+    {0.4393305097727096, 0.35115933755241768,
+     1.2744274540025009, 1.1788906096777414},
+    {0.44564334943006889, 0.35747217720977698,
+     1.3284545222939124, 1.232663484855069},
+    {0.39732393705041591, 0.30915276483012399,
+     1.2548061510466757, 1.160832817679111},
+    {0.40374554020280728, 0.31557436798251537,
+     1.3068164248666791, 1.2126181210283233},
+    {0.4755817557049079, 0.38741058348461599,
+     1.2400887713481765, 1.1430204126851868},
+    {0.482806300044064, 0.39463512782377208,
+     1.2956288960149485, 1.1982340222503998},
+    {0.43204984725148421, 0.34387867503119229,
+     1.2210897788849775, 1.1258397283646291},
+    {0.56037317179387258, 0.47220199957358056,
+     1.0112119449610999, 0.90982589383978252},
+    {0.57368312878685379, 0.48551195656656176,
+     1.0667553336368423, 0.96458835340635096},
+    {0.51386322519284289, 0.42569205297255086,
+     1.0004312628447083, 0.90154796068783927},
+    {0.52655479150596662, 0.4383836192856746,
+     1.053367643434745, 0.95383502062047432},
+    {0.59353310506443457, 0.50536193284414255,
+     0.9672279356978255, 0.86383932062839897},
+    {0.60843535865586407, 0.52026418643557204,
+     1.0230962412787838, 0.91874382479502004},
+    {0.54620534671421717, 0.45803417449392514,
+     0.9580412308464149, 0.85745400656184312},
+    {0.6347991908694598, 0.54662801864916777,
+     1.1421826134483066, 1.036021794676073},
+    {0.64578882480836763, 0.55761765258807561,
+     1.2048213965503871, 1.0978659230024208},
+    {0.58591998996281758, 0.49774881774252555,
+     1.1244700466460402, 1.0215582047169172},
+    {0.5968757077876492, 0.50870453556735717,
+     1.184081487743798, 1.0804802404601197},
+    {0.67212338254136428, 0.58395221032107225,
+     1.0977863087283903, 0.98882296666565472},
+    {0.6847917033655202, 0.59662053114522817,
+     1.1617259127656461, 1.0517420705259954},
+    {0.62227165199019052, 0.5341004797698985,
+     1.0814966587892652, 0.97621203441971416},
+    {0.43725436990719102, 0.3490831976868991,
+     1.0300154967852175, 0.93456112584036299},
+    {0.44799337978267728, 0.35982220756238537,
+     1.0802211714725034, 0.98433418420989249},
+    {0.39526985790781022, 0.3070986856875183,
+     1.0197886046076008, 0.9258861895713415},
+    {0.40538278031830377, 0.31721160809801174,
+     1.0678792363495218, 0.9736227794520903},
+    {0.46903461031961602, 0.3808634380993241,
+     0.99061778829291558, 0.893839094902109},
+    {0.48104089117007565, 0.39286971894978362,
+     1.0411681249358411, 0.94385371111786831},
+    {0.42597769226320736, 0.33780652004291534,
+     0.98165533509235636, 0.88663931857194045},
+    {0.48860591902677053, 0.40043474680647861,
+     -1.4374806010543031, -1.5351428831185845},
+    {0.53391035743552484, 0.44573918521523281,
+     -1.4615304635059827, -1.5614507289409074},
+    {0.48623646525966024, 0.39806529303936833,
+     -1.3858651237769071, -1.4834175815709776},
+    {0.53118889870204844, 0.44301772648175652,
+     -1.4078146113321581, -1.5075904735185508},
+    {0.44492937623355566, 0.35675820401326364,
+     -1.4663915934263261, -1.5621536226314627},
+    {0.48996625169923336, 0.40179507947894144,
+     -1.4911263858758108, -1.5888520793356631},
+    {0.44388714500958637, 0.35571597278929445,
+     -1.4147654334576165, -1.5104852366290817},
+    {0.58111876524993689, 0.49294759302964486,
+     -1.5449438054907854, -1.6475602716101461},
+    {0.62663689864625871, 0.53846572642596668,
+     -1.5742162813755329, -1.6798026914259441},
+    {0.57953372203069875, 0.49136254981040672,
+     -1.4870124911580631, -1.5895323339273348},
+    {0.62518666563791847, 0.53701549341762644,
+     -1.5140301199850148, -1.6195158552872857},
+    {0.5356987729182221, 0.44752760069793018,
+     -1.5748140423768253, -1.6748298344774277},
+    {0.58120616618816368, 0.49303499396787165,
+     -1.604593504894303, -1.7072153117276179},
+    {0.53545900000024738, 0.44728782777995546,
+     -1.517279346727326, -1.6172823023927674},
+    {0.52282337477922447, 0.43465220255893244,
+     -1.3071526736638233, -1.4064918457877642},
+    {0.56731762521304707, 0.47914645299275505,
+     -1.3261505747454818, -1.4279403291275858},
+    {0.51748047451270607, 0.42930930229241415,
+     -1.2603939714494785, -1.3594598486267369},
+    {0.56131698282294851, 0.47314581060265648,
+     -1.2773720709219309, -1.3788125136847256},
+    {0.48298969141106629, 0.39481851919077426,
+     -1.3364256758978705, -1.4338289329138216},
+    {0.5274425944429999, 0.43927142222270787,
+     -1.3563148255315107, -1.4558937907818315},
+    {0.47899867590538903, 0.390827503685097,
+     -1.2892536625318496, -1.3864755440613326},
+    {0.61781898498075882, 0.5296478127604668,
+     -1.3998539218312624, -1.5048345439320754},
+    {0.66323399167407904, 0.57506281945378701,
+     -1.4237182799176875, -1.5319870654828918},
+    {0.61226079476213746, 0.52408962254184543,
+     -1.3463437124313524, -1.4509502087104502},
+    {0.65741120545751142, 0.56924003323721939,
+     -1.367838690679696, -1.4756618987415568},
+    {0.57659579200717748, 0.48842461978688545,
+     -1.4310967047693588, -1.5334386122961969},
+    {0.62218967420031224, 0.53401850198002021,
+     -1.4558165424614347, -1.5610955350764451},
+    {0.57246709797394169, 0.48429592575364966,
+     -1.3774234294629342, -1.4795178107521292},
+    {0.35664402023605501, 0.26847284801576299,
+     -1.4705020135500335, -1.5631625925342247},
+    {0.40039772894470793, 0.3122265567244159,
+     -1.4945245235659819, -1.5886049239737918},
+    {0.3572382102685705, 0.26906703804827858,
+     -1.4208242271007085, -1.5135026178977151},
+    {0.40061020872699671, 0.31243903650670479,
+     -1.4429857395379526, -1.5370735829707758},
+    {0.31224332930605836, 0.22407215708576642,
+     -1.4972960664758526, -1.5887352145579368},
+    {0.35527061894912393, 0.26709944672883201,
+     -1.5218628358131145, -1.6144823961465111},
+    {0.31395437324439779, 0.22578320102410585,
+     -1.4477181075328129, -1.5392004002228319},
+    {0.44399536853482768, 0.35582419631453577,
+     -1.5749600233598071, -1.6706842046409525},
+    {0.48917857803149944, 0.40100740581120753,
+     -1.6036351470182786, -1.7013240913028866},
+    {0.44499845340305966, 0.35682728118276774,
+     -1.519863200931854, -1.615628033793705},
+    {0.49019343449836938, 0.40202226227807747,
+     -1.5465987015537546, -1.6443350107092236},
+    {0.39714681637170457, 0.30897564415141254,
+     -1.6023600613783251, -1.6963272597040011},
+    {0.44183848311895668, 0.35366731089866477,
+     -1.6314091771034047, -1.7270463896925399},
+    {0.39926788383441614, 0.31109671161412422,
+     -1.5477268337360905, -1.6417677474845302},
+    {0.39863855047833807, 0.31046737825804605,
+     -1.3455826724329998, -1.4396016581747775},
+    {0.44198163334399798, 0.35381046112370595,
+     -1.3651510055761831, -1.4607939715082274},
+    {0.3966465729679044, 0.30847540074761237,
+     -1.2999403424762264, -1.3938902337924493},
+    {0.43932752319011537, 0.35115635096982345,
+     -1.317662543920797, -1.4131992692071906},
+    {0.35712692181855299, 0.26895574959826096,
+     -1.3729805654532072, -1.465655617186395},
+    {0.39999226441758007, 0.31182109219728804,
+     -1.3932937394518483, -1.4873599517577796},
+    {0.35638941691879367, 0.26821824469850164,
+     -1.3270777953939283, -1.4197307543348929},
+    {0.48564686059000162, 0.3974756883697097,
+     -2.9029087837255547, -3.0004340367162055},
+    {0.45967360652005451, 0.3715024342997626,
+     -2.8584974913897301, -2.9548721646146769},
+    {0.46007492768376634, 0.37190375546347432,
+     -2.9514539398270849, -3.0478456917397891},
+    {0.43516647531484676, 0.34699530309455484,
+     -2.9073475715692054, -3.0027195598902856},
+    {0.53612266469040781, 0.4479514924701159,
+     -2.8981254910955312, -2.9981639987203459},
+    {0.51030803056735041, 0.42213685834705839,
+     -2.8531874145603902, -2.9518931845468113},
+    {0.51081905178588261, 0.42264787956559069,
+     -2.9483931629317146, -3.0471243352677257},
+    {0.45539987659049264, 0.36722870437020061,
+     -2.762146679627858, -2.8583408137065196},
+    {0.4256109814124821, 0.33743980919219008,
+     -2.71650483582399, -2.8115068673904497},
+    {0.43208400445620865, 0.34391283223591662,
+     -2.8136835683490866, -2.9089349485647822},
+    {0.40298642961511799, 0.31481525739482596,
+     -2.7686424259753681, -2.8628138769590135},
+    {0.50692973860271573, 0.4187585663824237,
+     -2.7553310118387646, -2.8538698251932662},
+    {0.47792479423344403, 0.38975362201315211,
+     -2.7091211353114453, -2.8062945925582294},
+    {0.48367471305823406, 0.39550354083794204,
+     -2.807770249193827, -2.9052048619184268},
+    {0.38371768719813826, 0.29554651497784634,
+     -3.0006589774492665, -3.0941718587513125},
+    {0.35971233482586495, 0.27154116260557304,
+     -2.9575955847220592, -3.0503485673782644},
+    {0.35625161519497528, 0.26808044297468325,
+     -3.0464490118104703, -3.1390978495000419},
+    {0.33551480041811554, 0.24734362819782363,
+     -3.0016344153184455, -3.0936870600281603},
+    {0.43331602843488937, 0.34514485621459734,
+     -2.9995043790388887, -3.0948038195272489},
+    {0.41038815474187651, 0.32221698252158448,
+     -2.9542027862734237, -3.048639047229015},
+    {0.40555852375694013, 0.3173873515366481,
+     -3.0468495740130863, -3.1411122924222261},
+    {0.35617946679461743, 0.26800829457432551,
+     -2.8683005313743433, -2.9609472121616172},
+    {0.32700209631999699, 0.23883092409970508,
+     -2.8246388460149832, -2.9164603492230623},
+    {0.332445353854256, 0.24427418163396408,
+     -2.915491803144064, -3.0074602020871102},
+    {0.30385754045041691, 0.21568636823012496,
+     -2.8728117967554123, -2.9640439369087206},
+    {0.40821076567240477, 0.32003959345211275,
+     -2.8635322278956585, -2.9578898974824441},
+    {0.37976681138191426, 0.29159563916162223,
+     -2.8193031483595794, -2.9126864018501948},
+    {0.3840127058660745, 0.29584153364578258,
+     -2.9115391377089326, -3.0050617715883385},
+    {0.6145145977998453, 0.52634342557955327,
+     -2.941185742930172, -3.0459432324479159},
+    {0.58726231721081001, 0.49909114499051799,
+     -2.8928733496081076, -2.9958685024853642},
+    {0.58839570323042256, 0.50022453101013054,
+     -2.9947239262134278, -3.097789671995415},
+    {0.56238561322040137, 0.47421444100010934,
+     -2.9449840118928017, -3.0464862193097466},
+    {0.66692807766037221, 0.57875690544008018,
+     -2.9369526199276881, -3.0455079167991941},
+    {0.63880537864418385, 0.55063420642389183,
+     -2.8870993263095293, -2.9935469709917348},
+    {0.64133765153302247, 0.55316647931273044,
+     -2.9925975190078202, -3.099228148977955},
+    {0.5836819587730866, 0.49551078655279457,
+     -2.7950252850238657, -2.8977989350946789},
+    {0.5573279251142309, 0.46915675289393888,
+     -2.7481857507275196, -2.849397315845426},
+    {0.5598791421393674, 0.47170796991907538,
+     -2.8475935153864014, -2.9489511549131344},
+    {0.53428287558615573, 0.44611170336586381,
+     -2.8015538148040013, -2.9014939365728853},
+    {0.63167948374990157, 0.54350831152960954,
+     -2.7881759587634205, -2.8941156629763567},
+    {0.60637983752124724, 0.51820866530095522,
+     -2.7407015921053848, -2.8449186218997742},
+    {0.61039072548734385, 0.52221955326705183,
+     -2.8405089255769171, -2.9449908691959266},
+    {0.50797083302325086, 0.41979966080295883,
+     -3.0473512124901401, 3.1372440101646415},
+    {0.48411759826193901, 0.39594642604164698,
+     -2.9981477032746766, -3.0956026234157226},
+    {0.47882309668999645, 0.39065192446970454,
+     -3.0971098419005623, 3.0888615120674139},
+    {0.45620305273871908, 0.36803188051842706,
+     -3.0471551506620442, 3.1398022788192335},
+    {0.56061397385420009, 0.47244280163390806,
+     -3.0474220215849956, 3.1343633712238161},
+    {0.53589610204256366, 0.44772492982227163,
+     -2.9965635851395813, -3.0965899481994086},
+    {0.53137770113090155, 0.44320652891060963,
+     -3.0990152810428033, 3.0843841832321561},
+    {0.47145610443912567, 0.38328493221883375,
+     -1.8404336293294277, -1.937318771343143},
+    {0.51439298342261142, 0.42622181120231939,
+     -1.876705185734731, -1.9756151036848357},
+    {0.47797561051426285, 0.38980443829397082,
+     -1.7807278177578272, -1.877903562837725},
+    {0.52174327933378617, 0.43357210711349414,
+     -1.8158319420485491, -1.9151155159357729},
+    {0.42097162122123133, 0.33280044900093941,
+     -1.8638146349212812, -1.958641193560233},
+    {0.46360720811670697, 0.37543603589641494,
+     -1.8997769370049571, -1.9963199421679725},
+    {0.42801511784573165, 0.33984394562543974,
+     -1.8054842679598997, -1.9005782922087577},
+    {0.54661811639626812, 0.45844694417597609,
+     -1.9752492318870813, -2.0758592664497453},
+    {0.58637875429372377, 0.49820758207343174,
+     -2.0146584990433798, -2.117598777952562},
+    {0.55649509390392815, 0.46832392168363612,
+     -1.9142796055820694, -2.0154437190458148},
+    {0.59744672857709458, 0.50927555635680255,
+     -1.9531218106983896, -2.0567595856032326},
+    {0.49547102099438001, 0.40729984877408798,
+     -1.9961075872980123, -2.0940925816566436},
+    {0.53534490956747971, 0.44717373734718768,
+     -2.0348525905569237, -2.1348494414749317},
+    {0.50559528357368844, 0.41742411135339641,
+     -1.9369359293358459, -2.0354092581975465},
+    {0.53181930780555309, 0.44364813558526106,
+     -1.6939440499905385, -1.7937532593732595},
+    {0.57645522032271301, 0.48828404810242099,
+     -1.7275386465885296, -1.8298720780253597},
+    {0.53451425509217942, 0.4463430828718874,
+     -1.6338245061915884, -1.7337769721395078},
+    {0.57967852784313179, 0.49150735562283976,
+     -1.6655983274020243, -1.768126979211083},
+    {0.4831081535367252, 0.39493698131643318,
+     -1.7210824832434939, -1.8184911579512042},
+    {0.52756464490608213, 0.43939347268579021,
+     -1.7547605255494856, -1.8543458712259999},
+    {0.48683556682570028, 0.39866439460540837,
+     -1.6619180963670646, -1.7594982474651522},
+    {0.61457658517247082, 0.5264054129521788,
+     -1.8266798942711275, -1.9314415503073203},
+    {0.65647028240445304, 0.56829911018416102,
+     -1.8649423510772067, -1.9726942430454948},
+    {0.62040399589428608, 0.53223282367399405,
+     -1.7627453713262866, -1.867902014980827},
+    {0.66333298773905813, 0.57516181551876611,
+     -1.7995966366187239, -1.9078730612901216},
+    {0.56482566942978052, 0.47665449720948849,
+     -1.8523613033468058, -1.954005258960944},
+    {0.60689320160080285, 0.51872202938051082,
+     -1.8903068452318237, -1.9945576135176293},
+    {0.57149999451709188, 0.48332882229679985,
+     -1.7899537226675128, -1.891990547633265},
+    {0.32830375969318426, 0.24013258747289221,
+     -1.8515543329612909, -1.9434106735751915},
+    {0.37062255661301402, 0.2824513843927221,
+     -1.8860321164024871, -1.9791222809862978},
+    {0.33506391428547544, 0.24689274206518352,
+     -1.7955779060615611, -1.8876181114793948},
+    {0.37801564779886321, 0.28984447557857129,
+     -1.8290767564477024, -1.9224031348606516},
+    {0.27918919633757544, 0.1910180241172835,
+     -1.8729673520297037, -1.9636327090739409},
+    {0.32072990773414012, 0.23255873551384809,
+     -1.9071437174956789, -1.9987998972379608},
+    {0.2861569086887043, 0.19798573646841233,
+     -1.818230901191787, -1.9090500386242428},
+    {0.40360815125008931, 0.31543697902979739,
+     -1.9785941820216781, -2.072787620691237},
+    {0.44433051140836666, 0.35615933918807463,
+     -2.0157763602136476, -2.1115141091281138},
+    {0.41280209348443342, 0.3246309212641415,
+     -1.9216421566248598, -2.016166224497081},
+    {0.45452335694131729, 0.36635218472102538,
+     -1.9583499758274776, -2.0545073826805815},
+    {0.35316675214173299, 0.26499557992144096,
+     -1.9977387969020823, -2.090295930891982},
+    {0.39351541172859017, 0.30534423950829825,
+     -2.0343316845825359, -2.1281739243065005},
+    {0.36230511403341359, 0.27413394181312167,
+     -1.9423659180867805, -2.0351978091401768},
+    {0.38973306167254407, 0.30156188945225204,
+     -1.7147626408448768, -1.8084763928545005},
+    {0.43386070680657984, 0.34568953458628782,
+     -1.7470437276075717, -1.8423644771655407},
+    {0.3939791827947432, 0.30580801057445117,
+     -1.6581451068871473, -1.7520032177912492},
+    {0.43846986320446646, 0.35029869098417454,
+     -1.6888901573217661, -1.7843927457472408},
+    {0.34094673345426574, 0.25277556123397382,
+     -1.7395625854209353, -1.8317668287990798},
+    {0.38440371641122129, 0.29623254419092937,
+     -1.7718626589793318, -1.8653982343688036},
+    {0.34591216563180893, 0.25774099341151702,
+     -1.6838579694956066, -1.7762036170564124},
+    {0.46390347616216954, 0.37573230394187762,
+     2.3210439393746123, 2.2244881715566578},
+    {0.45789430487932925, 0.36972313265903733,
+     2.3758344043622897, 2.2795351918314664},
+    {0.42466174283097124, 0.33649057061067933,
+     2.285605105300665, 2.190639195666964},
+    {0.4189477148409364, 0.33077654262064438,
+     2.3397749869011983, 2.2450241367091319},
+    {0.50711427721854174, 0.41894310499824983,
+     2.3023476464617789, 2.2037997567408829},
+    {0.50198929861102781, 0.4138181263907359,
+     2.3571297255523449, 2.2588320409618516},
+    {0.46870685382259303, 0.38053568160230111,
+     2.2669571548514615, 2.1701928080547179},
+    {0.48786618801754578, 0.39969501579725386,
+     2.4678563382670933, 2.3702284281586539},
+    {0.47892319992500132, 0.3907520277047094,
+     2.5231271217115054, 2.4259086488421504},
+    {0.45067948800072677, 0.36250831578043474,
+     2.431008733778051, 2.3350111891979815},
+    {0.44228915509672118, 0.35411798287642926,
+     2.4862333590962788, 2.3905780246038755},
+    {0.53178743582246346, 0.44361626360217143,
+     2.4494119077170824, 2.3496043857762707},
+    {0.52350759348902165, 0.43533642126872973,
+     2.5049810403175008, 2.405606555594876},
+    {0.49556938392204608, 0.40739821170175405,
+     2.4124105771715927, 2.3144209099076827},
+    {0.3381392971161814, 0.24996812489588949,
+     2.2695326089744579, 2.1774071194243629},
+    {0.33172470787740638, 0.24355353565711432,
+     2.323081507212458, 2.231132739665278},
+    {0.29678804235675416, 0.20861687013646213,
+     2.2354899841641891, 2.1444266670395042},
+    {0.2903933124407353, 0.20222214022044332,
+     2.28826091454826, 2.1973458622482158},
+    {0.38449076348324596, 0.29631959126295404,
+     2.2508856086759481, 2.1573471498036243},
+    {0.37894763059479541, 0.29077645837450339,
+     2.3043160802227218, 2.2109594767181884},
+    {0.34363978853764332, 0.25546861631735129,
+     2.2169479185790539, 2.1246673192969796},
+    {0.36482002775579969, 0.27664885553550778,
+     2.4132280293576334, 2.3203188740533292},
+    {0.35628397948499169, 0.26811280726469966,
+     2.4680795793257766, 2.3754297739048247},
+    {0.3244023951793038, 0.23623122295901178,
+     2.377307427035023, 2.2855549575725775},
+    {0.31620219731815469, 0.22803102509786274,
+     2.4319001255761106, 2.3403606837223845},
+    {0.4121177464818887, 0.32394657426159679,
+     2.3945365893662509, 2.3000374870999916},
+    {0.40419102279600039, 0.31601985057570847,
+     2.449567644459945, 2.3553535496594833},
+    {0.37238699508039308, 0.28421582286010105,
+     2.3585324109864887, 2.2653864425373307},
+    {0.55135036360911993, 0.4631791913888279,
+     2.2298823988122107, 2.1290088817464312},
+    {0.54848013939994, 0.46030896717964798,
+     2.2836942026525451, 2.1829809276907737},
+    {0.51358334011425866, 0.42541216789396663,
+     2.195515632955908, 2.0966463756338283},
+    {0.51096337283203408, 0.42279220061174216,
+     2.2483803340227602, 2.1496419805952285},
+    {0.58982216345024741, 0.50165099122995538,
+     2.2114708598310835, 2.108315940884665},
+    {0.58793835150344054, 0.49976717928314851,
+     2.2650915304583132, 2.1620542983831599},
+    {0.55295801243975207, 0.46478684021946004,
+     2.1772743126311171, 2.0763104551284286},
+    {0.58003448859677864, 0.49186331637648661,
+     2.3751267315463869, 2.2725764098327677},
+    {0.57393351106465951, 0.48576233884436748,
+     2.4309067849795984, 2.3287248249503558},
+    {0.54428296463160175, 0.45611179241130972,
+     2.3384305841981901, 2.237949232189683},
+    {0.5387211110555894, 0.45054993883529748,
+     2.3937807358986483, 2.2936023630895912},
+    {0.61944610781420062, 0.53127493559390859,
+     2.3564561632931569, 2.2513648959675483},
+    {0.61422259078845898, 0.52605141856816695,
+     2.4123478145786525, 2.3076099426178032},
+    {0.58469423728224212, 0.4965230650619501,
+     2.3197449119580731, 2.216908866454347},
+    {0.43280039884527155, 0.34462922662497952,
+     2.1802169468031436, 2.0849376441121916},
+    {0.42926818084996821, 0.34109700862967618,
+     2.2323285425143577, 2.1371862818308802},
+    {0.39260057119687009, 0.30442939897657817,
+     2.1474679910362409, 2.053656984125078},
+    {0.38902993690256904, 0.30085876468227712,
+     2.1985209868596662, 2.1048309338139894},
+    {0.47483229624310341, 0.3866611240228115,
+     2.1620428765155864, 2.0650079750102246},
+    {0.47233233268672814, 0.38416116046643622,
+     2.2138693956452129, 2.1169455368876871},
+    {0.43531294820561506, 0.34714177598532314,
+     2.1295051350417826, 2.0341273854961446},
+    {0.45804147383495575, 0.36987030161466372,
+     -1.1235274106368529, -1.2198328485985541},
+    {0.43254092627153895, 0.34436975405124692,
+     -1.0974130138489409, -1.1926821956943792},
+    {0.4638091178483692, 0.37563794562807717,
+     -1.1615739474361444, -1.2581256491943096},
+    {0.42669967120865349, 0.33852849898836157,
+     -1.1419544507908996, -1.2369980502342359},
+    {0.47341985281569865, 0.38524868059540673,
+     -1.0882787228176241, -1.1852507810477608},
+    {0.43254092627153895, 0.34436975405124692,
+     -1.0974130138489409, -1.1926821956943792},
+    {0.49305049694542791, 0.40487932472513588,
+     -1.1283270315148288, -1.2261974729699918},
+    {0.41823977055573847, 0.33006859833544655,
+     -1.0246481744374882, -1.1193726625821923},
+    {0.38902379963899725, 0.30085262741870522,
+     -0.99583050061339018, -1.0895203470580075},
+    {0.40543092444759099, 0.31725975222729907,
+     -1.0704759032995614, -1.1647340751378832},
+    {0.37666901737103808, 0.28849784515074617,
+     -1.0427165304427348, -1.13599941395586},
+    {0.46041369962554313, 0.3722425274052511,
+     -1.013937066570346, -1.1103432521157948},
+    {0.43058675821261094, 0.34241558599231903,
+     -0.97737518789427769, -1.0725684213249873},
+    {0.44578034882906292, 0.3576091766087709,
+     -1.0526724896725015, -1.1484691008961674},
+    {0.43222626706128142, 0.34405509484098951,
+     -1.2292876498709333, -1.3245445697787179},
+    {0.39421525729744966, 0.30604408507715763,
+     -1.2080917795225332, -1.3019579791887108},
+    {0.43603912037450165, 0.34786794815420963,
+     -1.2723665456532369, -1.3677728982785144},
+    {0.39411262657923574, 0.30594145435894382,
+     -1.2564127764317732, -1.3502754587861387},
+    {0.46929241186907411, 0.3811212396487822,
+     -1.2018428109544486, -1.2986327991594671},
+    {0.42799139930410757, 0.33982022708381565,
+     -1.1884152934711636, -1.2835084065903157},
+    {0.47439251251658443, 0.3862213402962924,
+     -1.2443921055112341, -1.3414074104149198},
+    {0.35805368197428744, 0.26988250975399553,
+     -1.1331670171328903, -1.2258699174673058},
+    {0.32151943804814376, 0.23334826582785173,
+     -1.1055241991398215, -1.1972009583695824},
+    {0.35866527745945254, 0.27049410523916051,
+     -1.1800956742933384, -1.2728170055122778},
+    {0.32200711403552551, 0.23383594181523357,
+     -1.1520268280037365, -1.2437163319201647},
+    {0.39228209197089614, 0.30411091975060411,
+     -1.1147405104839319, -1.2085406677558841},
+    {0.36396449283528221, 0.27579332061499029,
+     -1.0880970982994036, -1.1809798891283858},
+    {0.39358724333127326, 0.30541607111098135,
+     -1.160810811780921, -1.254655508054743},
+    {0.53352363060157471, 0.44535245838128268,
+     -1.0483605388888178, -1.1482602136333271},
+    {0.48910437587857891, 0.40093320365828689,
+     -1.0506356337822533, -1.1483211206884991},
+    {0.55453242748446563, 0.4663612552641736,
+     -1.090727828561171, -1.1917805692811743},
+    {0.51655161435650776, 0.42838044213621584,
+     -1.0873736877324813, -1.1863924941682142},
+    {0.55067102059979245, 0.46249984837950042,
+     -1.0066384779991657, -1.1074739468342583},
+    {0.50500108458877324, 0.41682991236848133,
+     -1.010463658202865, -1.1089079128631643},
+    {0.57889859004192168, 0.49072741782162965,
+     -1.0458180462290814, -1.1482992949654502},
+    {0.41823977055573847, 0.33006859833544655,
+     -1.0246481744374882, -1.1193726625821923},
+    {0.37666901737103808, 0.28849784515074617,
+     -1.0427165304427348, -1.13599941395586},
+    {0.44578034882906292, 0.3576091766087709,
+     -1.0526724896725015, -1.1484691008961674},
+    {0.40543092444759099, 0.31725975222729907,
+     -1.0704759032995614, -1.1647340751378832},
+    {0.43058675821261094, 0.34241558599231903,
+     -0.97737518789427769, -1.0725684213249873},
+    {0.38902379963899725, 0.30085262741870522,
+     -0.99583050061339018, -1.0895203470580075},
+    {0.46041369962554313, 0.3722425274052511,
+     -1.013937066570346, -1.1103432521157948},
+    {0.54263694115090466, 0.45446576893061275,
+     -1.1814506798924114, -1.2818418511622423},
+    {0.50517811469491558, 0.41700694247462367,
+     -1.1741176407588194, -1.2725705520846533},
+    {0.55462787161948901, 0.46645669939919698,
+     -1.2311256360705241, -1.3321837781531596},
+    {0.51155533991466073, 0.42338416769436882,
+     -1.2160563506167859, -1.3148241914607355},
+    {0.56861016925926078, 0.48043899703896875,
+     -1.1390709605419151, -1.2409367530404105},
+    {0.52989483428475914, 0.44172366206446712,
+     -1.1334928688487822, -1.2332004718499037},
+    {0.58194505326602941, 0.49377388104573738,
+     -1.1894050103453286, -1.2920720211226648},
+    {0.39856694975746909, 0.31039577753717718,
+     2.7011461743914302, 2.6071296804431259},
+    {0.4108012797173527, 0.32263010749706078,
+     2.6489175774476612, 2.5544663396894922},
+    {0.43387751157635657, 0.34570633935606465,
+     2.7374347166340036, 2.6421133090335389},
+    {0.44639220780539413, 0.3582210355851021,
+     2.6843483592695443, 2.5885268248466633},
+    {0.35064325910518268, 0.26247208688489065,
+     2.7174629375275337, 2.624980030645037},
+    {0.36285373543094457, 0.27468256321065254,
+     2.6658509928478096, 2.5730023078476019},
+    {0.38544565775076101, 0.29727448553046898,
+     2.7528792850306139, 2.6593091365171122},
+    {0.38526446945143222, 0.29709329723114031,
+     2.5591127550729196, 2.4655486277821499},
+    {0.39521504652729211, 0.3070438743070002,
+     2.5045362503438713, 2.4106357208120452},
+    {0.42225016185201869, 0.33407898963172677,
+     2.5955021863243832, 2.500627538398704},
+    {0.43278339470121707, 0.34461222248092505,
+     2.5411728862939627, 2.445894247119631},
+    {0.33657982862730063, 0.24840865640700857,
+     2.5769410152086167, 2.4848589002139687},
+    {0.34684178469334093, 0.25867061247304901,
+     2.5227581539078101, 2.4303857314163637},
+    {0.37443800775332381, 0.28626683553303189,
+     2.6129814405382579, 2.519770155644574},
+    {0.52016949209961094, 0.43199831987931891,
+     2.7605908343331498, 2.6613879532846294},
+    {0.53252970121317278, 0.44435852899288086,
+     2.7041509200654734, 2.6043040582085264},
+    {0.55763946548618559, 0.46946829326589357,
+     2.802615510493736, 2.7013861654607259},
+    {0.57078048569971029, 0.48260931347941827,
+     2.7442627178334744, 2.6422686098701966},
+    {0.46986144092045912, 0.3816902687001672,
+     2.7760800530464422, 2.6792651023984186},
+    {0.48299590306595741, 0.39482473084566549,
+     2.7212112633002259, 2.6238077222522684},
+    {0.50627235046817498, 0.41810117824788295,
+     2.8171897314779066, 2.7186832103342109},
+    {0.50504350446343238, 0.41687233224314046,
+     2.6129423978069455, 2.5144960692600864},
+    {0.51394016316197078, 0.42576899094167875,
+     2.5601473280334677, 2.461260163017184},
+    {0.54331376066138382, 0.45514258844109179,
+     2.6482256214436442, 2.547797421782958},
+    {0.55252287662015132, 0.46435170439985929,
+     2.5931514004013283, 2.4922120367010066},
+    {0.45764289587686269, 0.36947172365657077,
+     2.6318278387839853, 2.5355392544828308},
+    {0.46881474610255525, 0.38064357388226333,
+     2.5778894032136268, 2.4811203353613314},
+    {0.49473173466657594, 0.40656056244628402,
+     2.6667272074577637, 2.5687772896285592},
+    {0.2896340442466192, 0.20146287202632718,
+     2.783055598770471, 2.6921578716979409},
+    {0.30200097628566092, 0.21382980406536897,
+     2.7336041365680619, 2.6424168340364411},
+    {0.32352889566051279, 0.23535772344022085,
+     2.8181137453958565, 2.72638430888989},
+    {0.33794539397352374, 0.24977422175323169,
+     2.7675975227905343, 2.6754774408221054},
+    {0.24101154094797789, 0.15284036872768592,
+     2.7983261843188254, 2.7084173131985416},
+    {0.25289999868303897, 0.16472882646274697,
+     2.7495677699184595, 2.6594387589676831},
+    {0.27706257370715037, 0.18889140148685835,
+     2.8308168515849634, 2.7401974508284614},
+    {0.27600371148479719, 0.18783253926450522,
+     2.6475215133457919, 2.5569248244800402},
+    {0.28697649113813994, 0.19880531891784797,
+     2.5946516910446435, 2.5038141407000749},
+    {0.31403480576838916, 0.22586363354809713,
+     2.6826250805899914, 2.5911407521698067},
+    {0.32560405364043155, 0.23743288142013963,
+     2.6303227730036558, 2.5385384841118515},
+    {0.22591540330328128, 0.1377442310829893,
+     2.6645726196094621, 2.5749235332988301},
+    {0.23672928378529765, 0.14855811156500567,
+     2.6122384373346308, 2.5224054920100332},
+    {0.2646041959387555, 0.17643302371846353,
+     2.6992365260515925, 2.6088772258552213},
+    {0.40527799740774839, 0.31710682518745648,
+     2.8441223074611672, 2.7498695820624786},
+    {0.42014638202053667, 0.33197520980024464,
+     2.7907935324605666, 2.6959979051094547},
+    {0.43967946612987874, 0.35150829390958671,
+     2.8856574564313071, 2.7901066955920903},
+    {0.45539009365373717, 0.36721892143344514,
+     2.8310054768034929, 2.7348117532043208},
+    {0.3561926477245092, 0.26802147550421718,
+     2.8565930552988705, 2.7639459805064739},
+    {0.37129035887636408, 0.28311918665607216,
+     2.8047878473892411, 2.7116766041934617},
+    {0.38938136944269841, 0.30121019722240649,
+     2.8971196048409928, 2.8034177139788619},
+    {0.39564818294617532, 0.30747701072588329,
+     -2.2282019657459724, -2.3221174048757636},
+    {0.43152944760772682, 0.3433582753874348,
+     -2.2657683187675239, -2.3609981291394524},
+    {0.40866636936107292, 0.32049519714078101,
+     -2.1781281214409751, -2.2725021878973828},
+    {0.44504604154613225, 0.35687486932584023,
+     -2.2156158528158576, -2.3113826175139343},
+    {0.34620793281060391, 0.25803676059031189,
+     -2.2402275243735539, -2.3325816802937429},
+    {0.38183467005192218, 0.29366349783163026,
+     -2.2777907880544976, -2.3712416609649241},
+    {0.35930692875792836, 0.27113575653763644,
+     -2.1915653371113275, -2.2843060501447892},
+    {0.45312135529026976, 0.36495018306997784,
+     -2.3574680141229347, -2.4535668871046683},
+    {0.48822893008744783, 0.40005775786715581,
+     -2.3995011166200384, -2.4971458720124802},
+    {0.46734958506287916, 0.37917841284258724,
+     -2.3049120035641462, -2.4016170956242302},
+    {0.50283439497584537, 0.41466322275555345,
+     -2.3456094625361965, -2.4439481400817602},
+    {0.40226347511031646, 0.31409230289002454,
+     -2.3689532220683036, -2.4630991638387725},
+    {0.43747268665073535, 0.34930151443044344,
+     -2.410802112978474, -2.5062651303665522},
+    {0.4175626276444433, 0.32939145542415127,
+     -2.3168808026723204, -2.4115801338540019},
+    {0.4718768736950496, 0.38370570147475769,
+     -2.1098379698956125, -2.2067416907398929},
+    {0.50935399503857126, 0.42118282281827935,
+     -2.1485836302481709, -2.2472420799749311},
+    {0.48417302860570077, 0.39600185638540886,
+     -2.0538473611940908, -2.1513048248999427},
+    {0.52285653765229623, 0.4346853654320042,
+     -2.0927288923907184, -2.192069774402944},
+    {0.42123332325520968, 0.33306215103491765,
+     -2.1259148858935335, -2.2207512712509248},
+    {0.45877080913347845, 0.37059963691318643,
+     -2.1638244106998479, -2.2601607431386959},
+    {0.4331786929194843, 0.34500752069919227,
+     -2.071724156860971, -2.1670182304345884},
+    {0.52986303623514497, 0.44169186401485294,
+     -2.2409150692802839, -2.3406209982778829},
+    {0.56305701062544999, 0.47488583840515797,
+     -2.2798824912315911, -2.381423601874169},
+    {0.54538574334633072, 0.45721457112603869,
+     -2.1878611014197924, -2.2884031145824961},
+    {0.5797851313267488, 0.49161395910645678,
+     -2.2275609090665727, -2.3300960482769018},
+    {0.48014384575895086, 0.39197267353865894,
+     -2.2533994901883818, -2.3506731874436402},
+    {0.51591194597751511, 0.42774077375722319,
+     -2.2925802149119332, -2.3915666812742304},
+    {0.49504702284271351, 0.4068758506224216,
+     -2.2021923724937964, -2.3001572400155186},
+    {0.26136200230862344, 0.17319083008833147,
+     -2.2158777206587525, -2.3061718712773405},
+    {0.29607649428364613, 0.2079053220633541,
+     -2.251927160815435, -2.3429737722883903},
+    {0.2740604342273395, 0.18588926200704747,
+     -2.1686751088915108, -2.2592304094036639},
+    {0.31093307446967788, 0.22276190224938594,
+     -2.2042013814566275, -2.2956076993319199},
+    {0.21150743945630562, 0.12333626723601365,
+     -2.2272493643091469, -2.3166708575517108},
+    {0.24551390886234437, 0.15734273664205239,
+     -2.2633045825895812, -2.3532952018622368},
+    {0.22736026233841725, 0.13918909011812527,
+     -2.1813214197287416, -2.2709944214989419},
+    {0.31525151498525716, 0.22708034276496522,
+     -2.3397458713057473, -2.4312610776672532},
+    {0.3505090595029503, 0.26233788728265828,
+     -2.3800705958567794, -2.4725495751554045},
+    {0.33129464709276069, 0.24312347487246877,
+     -2.2894701093328718, -2.3814071881655381},
+    {0.36677783754493942, 0.27860666532464751,
+     -2.3284904737867818, -2.4214602741945539},
+    {0.26326286768139329, 0.17509169546110132,
+     -2.3506528913961136, -2.4409851119914201},
+    {0.29813410802405271, 0.20996293580376069,
+     -2.390826630245543, -2.4819216931231893},
+    {0.28016958428566796, 0.19199841206537593,
+     -2.3008105334593796, -2.3914972305398616},
+    {0.33291979682131112, 0.24474862460101907,
+     -2.1044264591358934, -2.1964078132212053},
+    {0.37121245093348809, 0.28304127871319607,
+     -2.1410343944122303, -2.2341431758783887},
+    {0.34332796574177604, 0.25515679352148402,
+     -2.0518461527353526, -2.1441178702016144},
+    {0.38266632874423756, 0.29449515652394564,
+     -2.08855976331468, -2.1820379720184055},
+    {0.28419456528310943, 0.19602339306281746,
+     -2.11939209249095, -2.2101674214995142},
+    {0.32207722083554158, 0.23390604861524963,
+     -2.1552661834666051, -2.2469575216041835},
+    {0.2940448144254989, 0.20587364220520687,
+     -2.0683886852473217, -2.1593878843514602},
+    {0.37733318036138941, 0.28916200814109749,
+     0.80829322481623667, 0.71498891567534484},
+    {0.35397120007737815, 0.26580002785708623,
+     0.85059611077838326, 0.75801516537836733},
+    {0.35018202008709221, 0.26201084786680018,
+     0.76292886563931839, 0.670459449345293},
+    {0.32768117307888822, 0.23951000085859631,
+     0.8064229027467863, 0.71458324760328684},
+    {0.4278946239875242, 0.33972345176723218,
+     0.81038560456781839, 0.71529620826338247},
+    {0.40337706187632905, 0.31520588965603713,
+     0.85369150068899635, 0.75950624013110957},
+    {0.40095492842931035, 0.31278375620901833,
+     0.76372192691652596, 0.66962199663874389},
+    {0.35549899238383509, 0.26732782016354306,
+     0.9332859071475651, 0.84065954073233196},
+    {0.33242691441087757, 0.24425574219058566,
+     0.96971881360452528, 0.87775091767744529},
+    {0.33103335967183944, 0.24286218745154739,
+     0.8906598131878255, 0.79872982618863542},
+    {0.30865376567804659, 0.22048259345775456,
+     0.92853924694919876, 0.83718961059904096},
+    {0.40322392589609291, 0.31505275367580099,
+     0.9383781782840328, 0.84419833356206708},
+    {0.37883400785556332, 0.29066283563527129,
+     0.97549126880545178, 0.88213835558320008},
+    {0.37919180552526977, 0.29102063330497774,
+     0.89463764810133961, 0.80127310912513838},
+    {0.27250320332327738, 0.18433203110298535,
+     0.71837042816154106, 0.62784801999241058},
+    {0.25201801340379665, 0.16384684118350468,
+     0.7617913058700565, 0.67167910144245324},
+    {0.24397564813299552, 0.15580447591270355,
+     0.67482940463468311, 0.58486693693204173},
+    {0.22431204352995979, 0.13614087130966782,
+     0.71903233664872857, 0.62940955544283672},
+    {0.32208920684628539, 0.23391803462599337,
+     0.7177847640490792, 0.62609311226614828},
+    {0.30046828930782399, 0.21229711708753196,
+     0.76229048771881358, 0.67113993105392511},
+    {0.29324489006898524, 0.20507371784869322,
+     0.67304195607109596, 0.58206130787749311},
+    {0.25827824438512137, 0.1701070721648294,
+     0.84517182652909228, 0.75493867521610414},
+    {0.23796064417530824, 0.14978947195501627,
+     0.88356443856237854, 0.79370984272183531},
+    {0.23192721767739244, 0.14375604545710047,
+     0.8032693873062875, 0.71351947595848819},
+    {0.2123445119830405, 0.12417333976274852,
+     0.84279919305894246, 0.75336501636607101},
+    {0.30554104726661879, 0.21736987504632685,
+     0.84776378387873463, 0.75649067534302228},
+    {0.28389930630322169, 0.19572813408292974,
+     0.88697685489396949, 0.79620808350424788},
+    {0.27915167053417023, 0.1909804983138782,
+     0.80475453407371522, 0.714089991920005},
+    {0.50471431775529374, 0.41654314553500171,
+     0.76583886543130741, 0.66740862372173682},
+    {0.47912610092661567, 0.39095492870632365,
+     0.81272158064891076, 0.71549394252773224},
+    {0.47712768878121203, 0.38895651656092001,
+     0.71659529997241189, 0.61945768282182279},
+    {0.45255229245110362, 0.36438112023081171,
+     0.76468612075526532, 0.66861093208008793},
+    {0.55716332934833812, 0.46899215712804609,
+     0.76719858575978384, 0.66599640779746339},
+    {0.53076785948178395, 0.44259668726149204,
+     0.81532422019293826, 0.71557059553284574},
+    {0.53005431144185866, 0.44188313922156663,
+     0.71642679373553353, 0.61671079271460538},
+    {0.47776876881690999, 0.38959759659661808,
+     0.90358502419282338, 0.80641858922773935},
+    {0.45162822643104139, 0.36345705421074948,
+     0.94384534757386773, 0.84780852729150613},
+    {0.45354019656941513, 0.36536902434912311,
+     0.85707439096429683, 0.7609580585229696},
+    {0.42817706740873485, 0.34000589518844282,
+     0.89893661339842112, 0.80383636608400399},
+    {0.52772898423955183, 0.43955781201925992,
+     0.90861344049753401, 0.80901950002591339},
+    {0.5004928198426245, 0.41232164762233248,
+     0.9497190089641997, 0.851493658063596},
+    {0.50422020461228501, 0.41604903239199309,
+     0.86077109043173539, 0.76236496537776399},
+    {0.3955761866613563, 0.30740501444106427,
+     0.66953524011010557, 0.57562228081474487},
+    {0.37287777942881173, 0.28470660720851981,
+     0.71728611595056735, 0.62412456200523148},
+    {0.36556272967983794, 0.27739155745954591,
+     0.62283754632153221, 0.52990543633524523},
+    {0.34384990395398352, 0.2556787317336916,
+     0.67127517635065825, 0.57898858621345417},
+    {0.44817570104582871, 0.3600045288255368,
+     0.66782819748320554, 0.57193373601069675},
+    {0.42464257231427882, 0.33647140009398691,
+     0.7168857404803578, 0.62192055918921019},
+    {0.41806240485042201, 0.32989123263012998,
+     0.61975896553497289, 0.52504107230547992},
+    {0.33560563252503905, 0.247434460304747,
+     -0.18740750736859832, -0.27946266067575143},
+    {0.29501022873065019, 0.20683905651035817,
+     -0.16388957198508391, -0.25491124750755628},
+    {0.333856485222913, 0.24568531300262109,
+     -0.24018840543869591, -0.33219540828293004},
+    {0.2932871774651577, 0.20511600524486573,
+     -0.21491979378167331, -0.30590142100841117},
+    {0.37848819375790854, 0.29031702153761663,
+     -0.15858194238507892, -0.25192363333566747},
+    {0.33657717180873492, 0.248405999588443,
+     -0.13554438035392963, -0.22762642167858382},
+    {0.37753039292134594, 0.28935922070105402,
+     -0.21232997449400517, -0.30564065545359581},
+    {0.25714266957152837, 0.16897149735123637,
+     -0.093372341189566499, -0.18358326667518576},
+    {0.21980459881646014, 0.13163342659616817,
+     -0.074053698157449027, -0.1636038442649376},
+    {0.25587670851257255, 0.16770553629228055,
+     -0.14168261363857917, -0.23186891129788087},
+    {0.21829795470361835, 0.13012678248332638,
+     -0.12069868352986529, -0.21022498252813782},
+    {0.2965635907375459, 0.20839241851725396,
+     -0.064984750564798271, -0.15604279239804472},
+    {0.25791247088948727, 0.1697412986691953,
+     -0.046273223811813188, -0.13649920219235873},
+    {0.29609146130462405, 0.2079202890843321,
+     -0.11383972291636291, -0.20488668524578546},
+    {0.28784924548165708, 0.19967807326136511,
+     -0.31892575314199356, -0.40978298629187737},
+    {0.24888883241828519, 0.16071766019799322,
+     -0.29188582772976024, -0.38193901997962532},
+    {0.28413839860756185, 0.19596722638726982,
+     -0.37135457101751645, -0.4621286518975346},
+    {0.2454782696145292, 0.15730709739423723,
+     -0.3429269641110565, -0.43291692854387787},
+    {0.33130790431118118, 0.24313673209088912,
+     -0.29361132280996716, -0.38554876166503182},
+    {0.29090210551732348, 0.20273093329703151,
+     -0.2666871676250579, -0.35761386276288315},
+    {0.32795664034365579, 0.23978546812336374,
+     -0.34737926616940057, -0.43922629876266334},
+    {0.21401600777885008, 0.1258448355585581,
+     -0.2169667444870842, -0.30642644630650917},
+    {0.17776018331606941, 0.089589011095777438,
+     -0.1940177793009093, -0.28298262046553091},
+    {0.21122474213636785, 0.12305356991607588,
+     -0.26619195867823803, -0.35560918341224262},
+    {0.17496770720215019, 0.086796534981858214,
+     -0.24177653104465893, -0.33070832310401971},
+    {0.25408839409741346, 0.16591722187712149,
+     -0.1910180216368873, -0.28116979870632508},
+    {0.21637247526205161, 0.12820130304175964,
+     -0.16839882313899363, -0.25789495982239607},
+    {0.25176099871966484, 0.16358982649937284,
+     -0.24116477608888415, -0.3312720973831072},
+    {0.46600249783981351, 0.37783132561952149,
+     -0.15231285985037649, -0.24895938931963599},
+    {0.42168055647132197, 0.33350938425102994,
+     -0.12840214208944969, -0.22325534047882892},
+    {0.46593071879285586, 0.37775954657256383,
+     -0.20907508567797981, -0.30571850157168667},
+    {0.42167154020065367, 0.33350036798036176,
+     -0.18305537952669546, -0.27790823871723075},
+    {0.51022813519899879, 0.42205696297870676,
+     -0.12005730766373357, -0.2187591096431411},
+    {0.46490851019748936, 0.37673733797719744,
+     -0.096833847508957599, -0.193432998592028},
+    {0.51130773321018397, 0.42313656098989194,
+     -0.17780461673035466, -0.27656011728909191},
+    {0.37780084601220743, 0.2896296737919154,
+     -0.054682458152189306, -0.14800188460511576},
+    {0.33635365796204508, 0.24818248574175317,
+     -0.035523584257196573, -0.12759943059378864},
+    {0.37855850361635102, 0.29038733139605899,
+     -0.10595051804707492, -0.19929448955284082},
+    {0.33680931486778831, 0.24863814264749626,
+     -0.084845728412124261, -0.17693420964847004},
+    {0.41882011931761853, 0.33064894709732662,
+     -0.02333931312879798, -0.11808540739549728},
+    {0.37628818902203909, 0.28811701680174706,
+     -0.0049835044256986011, -0.098254125565460607},
+    {0.42070218746069388, 0.33253101524040185,
+     -0.075082596261927093, -0.16989904677283774},
+    {0.41845173032587213, 0.3302805581055801,
+     -0.29518063278378831, -0.38991300725406636},
+    {0.37564324453852938, 0.28747207231823746,
+     -0.26691174689148034, -0.36016163951693936},
+    {0.41518243048966175, 0.32701125826936972,
+     -0.3519797086359206, -0.44659106155160772},
+    {0.37280604257851979, 0.28463487035822777,
+     -0.3220159119685686, -0.41517518609104631},
+    {0.4646242706809729, 0.37645309846068098,
+     -0.26678922119382087, -0.36337608895546181},
+    {0.42060948402779108, 0.33243831180749916,
+     -0.23875592431243084, -0.33356889903344744},
+    {0.46204365696524796, 0.37387248474495605,
+     -0.32508774806393015, -0.42156359451407366},
+    {0.30713395319613701, 0.21896278097584507,
+     -0.55977093017112767, -0.65108307457821979},
+    {0.2686919228019391, 0.18052075058164707,
+     -0.52633899408439078, -0.61678192446272639},
+    {0.30024444440615139, 0.21207327218585936,
+     -0.61169440941557307, -0.70283961983719367},
+    {0.26181988542183232, 0.17364871320154035,
+     -0.57797088114310291, -0.66827416934656292},
+    {0.35236745895908594, 0.26419628673879403,
+     -0.54102762510082703, -0.63356117167981529},
+    {0.31334641720655176, 0.22517524498625982,
+     -0.50767038066018533, -0.59913730817910216},
+    {0.34528202214088743, 0.25711084992059541,
+     -0.59383574833945796, -0.68616330066658249},
+    {0.23583384912224384, 0.14766267690195187,
+     -0.44285942500085018, -0.53267671831531105},
+    {0.19640086096018153, 0.10822968873988956,
+     -0.41034195178329697, -0.49954588813011774},
+    {0.2294907168840658, 0.14131954466377383,
+     -0.49299350335435344, -0.58270213369787516},
+    {0.18976985691712936, 0.10159868469683739,
+     -0.45980638021930376, -0.54892156723621799},
+    {0.27979510757134646, 0.19162393535105449,
+     -0.42368645625939194, -0.51436499065801089},
+    {0.24154808282878348, 0.15337691060849151,
+     -0.39402415196021717, -0.48394266147187598},
+    {0.27485980387161074, 0.18668863165131877,
+     -0.47563740678680416, -0.56620968646437675},
+    {0.2460612316317676, 0.15789005941147563,
+     -0.68298165386450715, -0.7729823452681418},
+    {0.2068174908755272, 0.11864631865523523,
+     -0.64894966730630232, -0.73830132161663065},
+    {0.23726678128874226, 0.14909560906845029,
+     -0.73579360567044516, -0.82563598356165147},
+    {0.19816575008338688, 0.10999457786309491,
+     -0.70190496082016807, -0.79113320965091705},
+    {0.2925944524572538, 0.20442328023696185,
+     -0.66411224677043768, -0.75507785924928061},
+    {0.2542637935143689, 0.1660926212940769,
+     -0.63027742796292718, -0.72043257692127349},
+    {0.28422525264531134, 0.19605408042501937,
+     -0.71674096929783371, -0.80751698037243624},
+    {0.17489846467414008, 0.086727292453848109,
+     -0.56223288017255701, -0.65116386186465636},
+    {0.13435263619476193, 0.046181463974469934,
+     -0.5281774164613684, -0.61670902783612203},
+    {0.16671878880493668, 0.078547616584644681,
+     -0.61472001421998301, -0.70355836532059601},
+    {0.12601725835009547, 0.037846086129803481,
+     -0.58037067855993107, -0.66883861845820214},
+    {0.22252400773092165, 0.13435283551062968,
+     -0.54421786557983509, -0.63381160160189975},
+    {0.18259464416594995, 0.094423471945657977,
+     -0.51051074836425714, -0.59953450589644663},
+    {0.21495417297824995, 0.12678300075795798,
+     -0.59629214282671672, -0.68576628714302057},
+    {0.43936900572326965, 0.35119783350297773,
+     -0.55629198408921043, -0.65183036287753793},
+    {0.3989792909107247, 0.31080811869043268,
+     -0.52099540047614967, -0.61502625282211398},
+    {0.43099109602472863, 0.3428199238044366,
+     -0.6117321807614865, -0.70694108894956009},
+    {0.3916731078824931, 0.30350193566220118,
+     -0.57571638356270249, -0.66949582802428653},
+    {0.48814873075028331, 0.39997755852999139,
+     -0.53544006110920295, -0.63308109053880601},
+    {0.44676774301585231, 0.3585965707955604,
+     -0.49956048162954486, -0.59539733713650833},
+    {0.4796152188526821, 0.39144404663239019,
+     -0.59303533856074397, -0.69028509422062967},
+    {0.36431664029392796, 0.27614546807363594,
+     -0.43246501867513221, -0.52535865136286619},
+    {0.3238190965762876, 0.23564792435599557,
+     -0.40118351053837475, -0.4929205901882423},
+    {0.358741622378979, 0.27057045015868708,
+     -0.48714156829667671, -0.57986520317620183},
+    {0.31893111012990072, 0.23075993790960869,
+     -0.45471408788804579, -0.54632362876480944},
+    {0.41081467173825859, 0.32264349951796667,
+     -0.40878918345436777, -0.50324090705568814},
+    {0.36902152545737665, 0.28085035323708463,
+     -0.37731260675645911, -0.47035244390497938},
+    {0.40539057521841559, 0.31721940299812357,
+     -0.46524471189140248, -0.55950144643172961},
+    {0.37482828001278756, 0.28665710779249565,
+     -0.68095837599773779, -0.77418214428136634},
+    {0.33758531639507516, 0.24941414417478325,
+     -0.64531367803599182, -0.73742372901067599},
+    {0.36553888026655068, 0.27736770804625877,
+     -0.73103664037424188, -0.82396801227397232},
+    {0.32974272273758298, 0.24157155051729093,
+     -0.69772235685534822, -0.78961742158288895},
+    {0.42176919877436181, 0.33359802655406978,
+     -0.66559733484962269, -0.76045386856847363},
+    {0.38358214963893245, 0.29541097741864053,
+     -0.62911907223137009, -0.72262747641167613},
+    {0.41184873845938619, 0.32367756623909427,
+     -0.71765578083615722, -0.81214508516810602},
+    {0.29070536500180355, 0.20253419278151161,
+     0.15644279878264553, 0.065520608851311835},
+    {0.27580024298430728, 0.18762907076401533,
+     0.20602224386935949, 0.11542990633101588},
+    {0.25760858662362607, 0.16943741440333407,
+     0.12220140886347373, 0.031981379701850401},
+    {0.24306854627592825, 0.15489737405563628,
+     0.17035608486130252, 0.080410109957277959},
+    {0.33916336327325936, 0.25099219105296744,
+     0.14203362077229326, 0.049879503990289745},
+    {0.32473400708470135, 0.2365628348644094,
+     0.19260653795237917, 0.10084530298196684},
+    {0.30476827685368169, 0.21659710463338974,
+     0.10740238037966238, 0.016148114003744253},
+    {0.29317858345009418, 0.20500741122980223,
+     0.29464003333542588, 0.20366091989539167},
+    {0.27626644647286336, 0.18809527425257141,
+     0.34557318386303254, 0.25497087004373958},
+    {0.26013760842536898, 0.17196643620507698,
+     0.25590311027394608, 0.16563329181647521},
+    {0.24382254738999809, 0.15565137516970612,
+     0.3058389704672857, 0.21587929203771736},
+    {0.34359516135484292, 0.25542398913455089,
+     0.28301324070113121, 0.19073391321405644},
+    {0.32676522191640311, 0.23859404969611106,
+     0.3351834225896978, 0.24336823946184125},
+    {0.30937383635377336, 0.22120266413348133,
+     0.24356262531031936, 0.15219514123117278},
+    {0.1807204930980533, 0.092549320877761326,
+     0.10442723897884534, 0.015426577421072001},
+    {0.16614474432946919, 0.077973572109177214,
+     0.15035477456964025, 0.061522693874956035},
+    {0.15130945095524229, 0.063138278734950315,
+     0.074028968300207082, -0.014651493435671976},
+    {0.13696507714755607, 0.048793904927264077,
+     0.1185873164067347, 0.030034463675303991},
+    {0.22558707542573761, 0.13741590320544564,
+     0.089808233705895441, 0.00016455404309984045},
+    {0.21133535188311214, 0.12316417966282017,
+     0.13651229969692538, 0.047093405741756404},
+    {0.19474734818919071, 0.10657617596889873,
+     0.059181104096104845, -0.030000318043423402},
+    {0.18107944064438009, 0.092908268424088114,
+     0.23145466248434224, 0.14244960259121223},
+    {0.16526145709675621, 0.077090284876464243,
+     0.27927585576588959, 0.19045336450817815},
+    {0.15109927162348818, 0.062928099403196214,
+     0.19678190210570734, 0.10810344458433235},
+    {0.13567615597477167, 0.047504983754479681,
+     0.24351429215339421, 0.15497199623889701},
+    {0.22784574479165592, 0.13967457257136395,
+     0.21896416203714691, 0.12928307961737895},
+    {0.21203465113491071, 0.12386347891461874,
+     0.26780026413986957, 0.17837079022992014},
+    {0.19647081795570881, 0.10829964573541684,
+     0.18379562469728605, 0.09459073018816877},
+    {0.40083192821177793, 0.31266075599148591,
+     0.076253746700768316, -0.017841869203085597},
+    {0.38819798333265687, 0.30002681111236496,
+     0.12710454075893893, 0.033442453609487964},
+    {0.36497271256389552, 0.27680154034360349,
+     0.043019345609981656, -0.049894523611386611},
+    {0.3525912042275825, 0.26442003200729047,
+     0.092094065386763971, -0.0004460768204392479},
+    {0.44922912807331783, 0.36105795585302591,
+     0.059857020229937594, -0.036080711483678279},
+    {0.43754399040458314, 0.34937281818429122,
+     0.11162949239438771, 0.016163649693188425},
+    {0.41228561843704981, 0.32411444621675778,
+     0.026380729191200998, -0.068124491880365873},
+    {0.41029259524923978, 0.32212142302894786,
+     0.217453288167064, 0.12302048850818033},
+    {0.39482004175331353, 0.30664886953302151,
+     0.27093349716765275, 0.17704654517039109},
+    {0.37440732651341291, 0.28623615429312099,
+     0.17869259268857682, 0.085482288432517622},
+    {0.35951243502026697, 0.27134126279997495,
+     0.23075484496024715, 0.13800791458641912},
+    {0.46143019584963973, 0.37325902362934771,
+     0.20362862867144554, 0.1071790421277386},
+    {0.44657289392332666, 0.35840172170303475,
+     0.25837276703287648, 0.16254386327685141},
+    {0.4245550563223377, 0.33638388410204567,
+     0.16425361286053358, 0.069291755966065294},
+    {0.28435550359507678, 0.1961843313747848,
+     0.028085975846277318, -0.062692931288548664},
+    {0.27138971784122212, 0.1832185456209301,
+     0.074713001410225063, -0.015786036523850373},
+    {0.25199118576642249, 0.16382001354613049,
+     -0.0011268325136787397, -0.091238526928392044},
+    {0.23915640406862046, 0.15098523184832849,
+     0.043871999223010889, -0.046003761626187696},
+    {0.3301404458296413, 0.24196927360934925,
+     0.011806573222194312, -0.080099234016553056},
+    {0.31792654932352404, 0.2297553771032321,
+     0.059123200280682707, -0.032460444103025461},
+    {0.29646938562197211, 0.20829821340168017,
+     -0.017506417428590514, -0.10856224670564404},
+    {0.28894496307098305, 0.20077379085069108,
+     3.057495562579867, 2.9666135081265339},
+    {0.3064914783867343, 0.21832030616644235,
+     3.0087015160584651, 2.9174051480787964},
+    {0.31847494038020385, 0.23030376815991183,
+     3.1003364892663519, 3.0087387212253556},
+    {0.3369665549373243, 0.24879538271703239,
+     3.051328977201226, 2.9592361306159085},
+    {0.24262653756024841, 0.15445536533995644,
+     3.0634012756042193, 2.9734633082369397},
+    {0.25953908748554239, 0.17136791526525041,
+     3.0160753141686274, 2.9258173360101876},
+    {0.27116929946835344, 0.18299812724806142,
+     3.1049982176753876, 3.0145037912290937},
+    {0.2925448689229847, 0.20437369670269268,
+     2.9183984779786334, 2.8274340099055069},
+    {0.30835622801446305, 0.22018505579417103,
+     2.8684647072335538, 2.777122429813363},
+    {0.3236512951119721, 0.23548012289168016,
+     2.9588035272868507, 2.8670708681922563},
+    {0.34026797344661985, 0.25209680122632783,
+     2.908019443310125, 2.8158343193629456},
+    {0.24637786430861783, 0.15820669208832586,
+     2.9282935289497645, 2.8382869973581291},
+    {0.26195312580718677, 0.17378195358689477,
+     2.8797791982135608, 2.7894732471408568},
+    {0.27622597409139837, 0.18805480187110643,
+     2.9676755464499154, 2.8770740995661264},
+    {0.39761319280343244, 0.30944202058314041,
+     3.1410828122463124, 3.0470994516803205},
+    {0.41784626199603603, 0.32967508977574411,
+     3.0904426190087197, 2.9957327572603307},
+    {0.42728964835257244, 0.33911847613228052,
+     -3.0952025188260253, 3.092916600370283},
+    {0.44869467241175875, 0.36052350019146673,
+     3.1375534597053418, 3.0416376993072625},
+    {0.34790819085693359, 0.25973701863664156,
+     -3.1386787483915017, 3.0521033041150383},
+    {0.3674218698093209, 0.27925069758902898,
+     3.0954887730888454, 3.0024989278944285},
+    {0.37701374350343475, 0.28884257128314283,
+     -3.0932975336399888, 3.0965937756668032},
+    {0.40508976065302715, 0.31691858843273513,
+     2.992880699306852, 2.898634674000018},
+    {0.42286002793983457, 0.33468885571954254,
+     2.9397157160572349, 2.8448180576091651},
+    {0.4375004548416791, 0.34932928262138707,
+     3.0381351447359859, 2.9426710271491392},
+    {0.45636304449333853, 0.36819187227304651,
+     2.9843758648291918, 2.8881412551972931},
+    {0.35506363316110834, 0.26689246094081631,
+     3.0009789581824839, 2.9083655614906347},
+    {0.37259148040986423, 0.2844203081895722,
+     2.9494951415454542, 2.8563426827588456},
+    {0.38654695069750544, 0.29837577847721353,
+     3.0448827275247994, 2.9512758982067449},
+    {0.18193535651911077, 0.093764184298818803,
+     3.1138050541573379, 3.024789458327819},
+    {0.19811539694792146, 0.10994422472762949,
+     3.0690625732732135, 2.979835022124921},
+    {0.20867575809074571, 0.12050458587045373,
+     -3.1289989838949737, 3.0648072453553556},
+    {0.22562801405760258, 0.13745684183731061,
+     3.1094846397446796, 3.0198402864992984},
+    {0.14014019980275766, 0.051969027582465681,
+     3.1179676856905525, 3.0293881886964984},
+    {0.15547820038468504, 0.067307028164393073,
+     3.0744940208893961, 2.9857729783021481},
+    {0.16590391180114067, 0.077732739580848698,
+     -3.1259593316513761, 3.0683965165172569},
+    {0.1864627867150363, 0.098291614494744328,
+     2.9842295056584378, 2.8951570517335856},
+    {0.2018929569026234, 0.11372178468233143,
+     2.9377374340777576, 2.8484568827741037},
+    {0.21433128550089001, 0.12616011328059804,
+     3.0231240381458, 2.9336594921174801},
+    {0.23046118269089758, 0.1422900104706056,
+     2.9761418067546255, 2.8864168024362411},
+    {0.14429955267727704, 0.056128380456985059,
+     2.9919629783339023, 2.9033472013971315},
+    {0.15917815878425048, 0.071006986563958513,
+     2.9467596485003007, 2.8580012648062381},
+    {0.17095392133776999, 0.082782749117478016,
+     3.0298686818125797, 2.9409831365941099},
+    {0.28099366223180511, 0.19282249001151308,
+     -3.0895121484929189, 3.102968448732391},
+    {0.29976214606792806, 0.21159097384763603,
+     -3.1353559283212662, 3.0566956698546739},
+    {0.30845967959704013, 0.22028850737674818,
+     -3.0459668226608843, -3.1373116576735693},
+    {0.32819494694875095, 0.2400237747284589,
+     -3.0913992809549096, 3.0999326048232381},
+    {0.23553102835278208, 0.14735985613249011,
+     -3.0876403685541121, 3.1057329210276166},
+    {0.25331712332806622, 0.16514595110777425,
+     -3.1321303396045095, 3.0609179815664098},
+    {0.26232181708429725, 0.17415064486400525,
+     -3.0454152201952689, -3.1357285489052882},
+    {0.27504723056552965, 0.18687605834523768,
+     -2.5898089312329935, -2.6803852012818945},
+    {0.24133412516323219, 0.15316295294294022,
+     -2.5462988690286692, -2.6362135316728916},
+    {0.25427350516320429, 0.16610233294291232,
+     -2.6416712077392703, -2.7318265434833449},
+    {0.22104973761739416, 0.13287856539710219,
+     -2.597946951534702, -2.6875169687301819},
+    {0.32903139972576378, 0.24086022750547187,
+     -2.5813276696601957, -2.6732035640287917},
+    {0.29522079345352403, 0.20704962123323201,
+     -2.5374323513254335, -2.6284589418841477},
+    {0.3083252891645224, 0.22015411694423037,
+     -2.6339633404742999, -2.725304853223272},
+    {0.22678962015382056, 0.13861844793352859,
+     -2.4522914107293503, -2.5419549432799378},
+    {0.19271613606585478, 0.1045449638455628,
+     -2.4112857584137291, -2.5004398726850616},
+    {0.20745894697737544, 0.11928777475708346,
+     -2.5035787865915733, -2.5929398704977897},
+    {0.17369091008837287, 0.085519737868080897,
+     -2.4617777831286189, -2.550694703339389},
+    {0.28002792641478408, 0.19185675419449211,
+     -2.4424601648331281, -2.5331437724482386},
+    {0.24543442386247913, 0.15726325164218716,
+     -2.4012288407390336, -2.491217999714606},
+    {0.26104762274050591, 0.17287645052021391,
+     -2.4943770622469619, -2.5846649510891555},
+    {0.17948396108708611, 0.091312788866794142,
+     -2.6993590889517973, -2.7883446898566673},
+    {0.14693666843374037, 0.058765496213448405,
+     -2.656116672593098, -2.744756261755287},
+    {0.15857046845664122, 0.070399296236349246,
+     -2.7486408689220636, -2.8373930340662326},
+    {0.1264957609393631, 0.038324588719071122,
+     -2.7056694011785072, -2.7941408274665913},
+    {0.23308772829958763, 0.14491655607929566,
+     -2.6927530714482439, -2.782522845810758},
+    {0.20037157836028049, 0.11220040613998852,
+     -2.6490513726749088, -2.7383104178712259},
+    {0.21168350848134793, 0.12351233626105595,
+     -2.7428124801654987, -2.8322366357303985},
+    {0.13431747306538971, 0.046146300845097736,
+     -2.5630144443519414, -2.6515457740108981},
+    {0.10149453582141107, 0.01332336360111909,
+     -2.5209740620217427, -2.609290730761725},
+    {0.11429357944981605, 0.026122407229524074,
+     -2.613243188679927, -2.7016321131117986},
+    {0.081805421258559829, -0.0063657509617321556,
+     -2.5708886719017374, -2.6591226056813935},
+    {0.18759394154358483, 0.099422769323292859,
+     -2.55482214802915, -2.6439091041977263},
+    {0.15417215831320752, 0.066000986092915548,
+     -2.5124404455986848, -2.6011486046331447},
+    {0.16736144340136461, 0.079190271181072636,
+     -2.6057540457306501, -2.6945994524675148},
+    {0.41559269605336158, 0.32742152383306955,
+     -2.6175164566883407, -2.7121429241920048},
+    {0.38267970367041115, 0.29450853145011913,
+     -2.5724915968646593, -2.6659702458478716},
+    {0.39447681015211522, 0.3063056379318233,
+     -2.6710331138571806, -2.7649082830034009},
+    {0.36220408511594016, 0.27403291289564824,
+     -2.6259155834443582, -2.7187443855921081},
+    {0.46819041667450234, 0.38001924445421043,
+     -2.6087551964825986, -2.7054969674480365},
+    {0.43568085412241719, 0.34750968190212517,
+     -2.56328992626131, -2.6586821587638556},
+    {0.44741610934910225, 0.35924493712881034,
+     -2.6631196268072848, -2.7589829777239498},
+    {0.36785732755208977, 0.27968615533179775,
+     -2.4749092992639095, -2.56791272435686},
+    {0.33309131135156878, 0.24492013913127686,
+     -2.4322740595437335, -2.5242601030000462},
+    {0.34893103072629861, 0.26075985850600669,
+     -2.528211107472897, -2.6206440528682711},
+    {0.3146198626885891, 0.22644869046829716,
+     -2.4848240259739023, -2.5763231826023518},
+    {0.42045268921298706, 0.33228151699269504,
+     -2.4646234176758792, -2.5594305160215773},
+    {0.38567066793717941, 0.29749949571688739,
+     -2.4217240610797521, -2.515301692454095},
+    {0.40214757023479442, 0.3139763980145025,
+     -2.5186244850636643, -2.6127663430299424},
+    {0.31897486372691153, 0.2308036915066195,
+     -2.730281664217808, -2.8218923354490877},
+    {0.28699991984624229, 0.19882874762595032,
+     -2.6858382967787464, -2.7766763744844973},
+    {0.29663169553403779, 0.20846052331374584,
+     -2.7807152731612215, -2.8717749151136376},
+    {0.26525460302965309, 0.17708343080936115,
+     -2.7366969171472002, -2.8270694125753915},
+    {0.37252996295316509, 0.28435879073287307,
+     -2.7235547581237691, -2.8167052638496415},
+    {0.34090234863506819, 0.25273117641477627,
+     -2.6786022670716805, -2.7708052586699679},
+    {0.34996517665003957, 0.26179400442974754,
+     -2.7748283954657778, -2.8672914775533416},
+    {0.2449690652252452, 0.15679789300495323,
+     -0.92365105887399745, -1.0136316806457932},
+    {0.28034021091352118, 0.19216903869322921,
+     -0.95458721625637766, -1.0452776372876107},
+    {0.25547499034002091, 0.16730381811972894,
+     -0.87301095869145173, -0.96318947439532987},
+    {0.29128767658791099, 0.20311650436761897,
+     -0.90479356779570252, -0.99572910371887946},
+    {0.19773516968518265, 0.10956399746489068,
+     -0.94239415829364692, -1.0316164487485409},
+    {0.23416817826384781, 0.14599700604355584,
+     -0.97316394946774787, -1.0629523331739614},
+    {0.20809056618962093, 0.11991939396932896,
+     -0.89198044856747294, -0.98135085534437305},
+    {0.30235628949848703, 0.21418511727819509,
+     -1.0322901340007768, -1.123485989921472},
+    {0.33399309354597118, 0.24582192132567912,
+     -1.0606129778990709, -1.1526237293459114},
+    {0.3141126622612902, 0.22594149004099817,
+     -0.98475818729007902, -1.0762444868916665},
+    {0.346230429477556, 0.25805925725726397,
+     -1.014140308060322, -1.106495111538826},
+    {0.25757683109314705, 0.16940565887285505,
+     -1.0502664394920445, -1.1404858474936985},
+    {0.29036824219933616, 0.20219706997904419,
+     -1.0783247772135074, -1.1692392565104714},
+    {0.26906718163099674, 0.1808960094107048,
+     -1.003135973507014, -1.0935866647772525},
+    {0.31177631734069378, 0.22360514512040175,
+     -0.80232912029430314, -0.89375654605267851},
+    {0.34686647423797101, 0.25869530201767899,
+     -0.83485063778989566, -0.92722377269072442},
+    {0.3211177042432023, 0.23294653202291035,
+     -0.75015646533751223, -0.84182274488731024},
+    {0.35658289143316146, 0.26841171921286944,
+     -0.78316159852885736, -0.87582034732189751},
+    {0.26558334877831591, 0.17741217655802394,
+     -0.8214721426047128, -0.91185132352573828},
+    {0.30180113032756584, 0.21362995810727381,
+     -0.85396191720598003, -0.94514441464572729},
+    {0.27519633310551428, 0.18702516088522231,
+     -0.76929019311083124, -0.8598696401218956},
+    {0.3695326256457222, 0.28136145342543029,
+     -0.91705595282984942, -1.0101118242688156},
+    {0.40090845184200607, 0.31273727962171416,
+     -0.94757858799287775, -1.0416768878371336},
+    {0.3803643127537305, 0.29219314053343848,
+     -0.86680123260470687, -0.96020397343807817},
+    {0.41220322368592333, 0.3240320514656313,
+     -0.89813385413116376, -0.99263607154481603},
+    {0.32552497794053903, 0.23735380572024709,
+     -0.93587928050047653, -1.0276614707473035},
+    {0.35811613670626863, 0.26994496448597671,
+     -0.96623398938846816, -1.0589387699170894},
+    {0.33647968862257549, 0.24830851640228357,
+     -0.88583793738126126, -0.97791727615964574},
+    {0.1111037432807464, 0.022932571060454411,
+     -0.92961575469600777, -1.0179853056251009},
+    {0.14982364797802286, 0.061652475757730883,
+     -0.96100760714900657, -1.0496739866214035},
+    {0.12075638425949703, 0.032585212039205037,
+     -0.87857805243948517, -0.96700901414168883},
+    {0.1598808090217978, 0.071709636801505827,
+     -0.91085388323602734, -0.99961949916661186},
+    {0.062035280918526801, -0.026135891301765184,
+     -0.94825170539952741, -1.036437083529951},
+    {0.10149251987631028, 0.013321347656018306,
+     -0.97947729502433589, -1.0677939535320766},
+    {0.071238173333717958, -0.016932998886574027,
+     -0.89745069377258468, -0.9856543786516222},
+    {0.17665591516669285, 0.088484742946400879,
+     -1.0393964357654704, -1.1283481220056859},
+    {0.21209045927386769, 0.12391928705357572,
+     -1.0680567550720041, -1.1574870753160595},
+    {0.18722553478169596, 0.099054362561403986,
+     -0.99159465160615512, -1.080676871491965},
+    {0.22317542373386787, 0.1350042515135759,
+     -1.0213531028260998, -1.1109573852187278},
+    {0.12974472763839459, 0.041573555418102599,
+     -1.0572540563382069, -1.145749697964054},
+    {0.1661142935415223, 0.077943121321230296,
+     -1.0856497923246948, -1.1744815412414362},
+    {0.13975090705903254, 0.051579734838740572,
+     -1.0098656269629938, -1.0984418082832657},
+    {0.17959231463562805, 0.091421142415336082,
+     -0.80752746817177801, -0.89651438315348952},
+    {0.21819444741426539, 0.13002327519397341,
+     -0.84057273210853656, -0.93009740072282021},
+    {0.18906484075825405, 0.10089366853796208,
+     -0.7548626977461067, -0.84396868955137372},
+    {0.22795035426460827, 0.1397791820443163,
+     -0.78841976255791757, -0.87810258911686179},
+    {0.1303682291713695, 0.042197056951077526,
+     -0.82659618484347575, -0.91509658194900068},
+    {0.16983411735347151, 0.081662945133179538,
+     -0.85961354818728408, -0.94848645498370765},
+    {0.13985366578467762, 0.051682493564385618,
+     -0.77393102309169548, -0.86250807829771559},
+    {0.23206108164631592, 0.14388990942602395,
+     1.3523932751831085, 1.2626410792680152},
+    {0.23221079575834716, 0.14403962353805519,
+     1.3048216258977849, 1.2150668728684184},
+    {0.27632725385218548, 0.18815608163189351,
+     1.3778300093647564, 1.2872263927155303},
+    {0.27589579609009918, 0.18772462386980723,
+     1.32894275826299, 1.2383483777685254},
+    {0.18731754679041482, 0.099146374570122847,
+     1.3759621333820862, 1.286878731758486},
+    {0.18848143054458588, 0.10031025832429391,
+     1.3279132703510044, 1.2388148527867515},
+    {0.23146715678466803, 0.14329598456437606,
+     1.4017141610548212, 1.3119720881137376},
+    {0.18977980339281184, 0.10160863117251986,
+     1.2372523414454066, 1.1481370243705895},
+    {0.18998230769674626, 0.10181113547645429,
+     1.194782533621773, 1.1056645666461145},
+    {0.23196303408647501, 0.14379186186618304,
+     1.2591112097849624, 1.1693606873513234},
+    {0.23136640781160345, 0.14319523559131148,
+     1.2153344750372344, 1.1255941159150478},
+    {0.1473356204434435, 0.05916444822315154,
+     1.2593894372991821, 1.170746190935869},
+    {0.14860477074736375, 0.060433598527071773,
+     1.2162841759635219, 1.1276291994124219},
+    {0.18929112866091402, 0.10111995644062205,
+     1.2816468847773905, 1.1925379466331687},
+    {0.36463827758085132, 0.2764671053605593,
+     1.3801262064974731, 1.2872226590134703},
+    {0.36264848841736441, 0.27447731619707239,
+     1.3303578879366291, 1.2375154897721201},
+    {0.40918619643732257, 0.32101502421703054,
+     1.4072299000568358, 1.3128370944770045},
+    {0.40683514405987842, 0.3186639718395865,
+     1.3560942637376421, 1.26178594855425},
+    {0.32103443079655414, 0.23286325857626211,
+     1.4042427361198366, 1.3125786267011748},
+    {0.32012067567098568, 0.23194950345069373,
+     1.3540366620203808, 1.262396316851462},
+    {0.36591722143106586, 0.27774604921077395,
+     1.4316460011873884, 1.3387029128503503},
+    {0.31659031659340864, 0.22841914437311661,
+     1.2591514925620857, 1.1676021290073899},
+    {0.31412762442906561, 0.22595645220877358,
+     1.214667574421026, 1.1231808959319574},
+    {0.36003745596211034, 0.27186628374181832,
+     1.2824865434225885, 1.1897237076053335},
+    {0.35689670862065059, 0.26872553640035857,
+     1.2366122185114681, 1.1439440696169414},
+    {0.27497601828864782, 0.18680484606835585,
+     1.281894267614035, 1.1913195141123836},
+    {0.27363068577898997, 0.18545951355869802,
+     1.2367789126505087, 1.1462327137517412},
+    {0.31861374515411767, 0.23044257293382572,
+     1.3056333379674196, 1.2140319899885901},
+    {0.13948968417453955, 0.051318511954247553,
+     1.4496548826090441, 1.3610809185047545},
+    {0.14189944809482397, 0.053728275874531987,
+     1.3996253845835172, 1.311030733213953},
+    {0.18381390245643636, 0.095642730236144391,
+     1.4768493151051207, 1.3878103577426524},
+    {0.1857697887897734, 0.097598616569481433,
+     1.4256643521447276, 1.3366007243476126},
+    {0.09289934609564221, 0.004728173875350232,
+     1.4736592118203586, 1.3853828888137314},
+    {0.096061396305567065, 0.0078902240852750868,
+     1.4233579526264049, 1.3350675496586011},
+    {0.1367656726970701, 0.048594500476778123,
+     1.5010501527129649, 1.4124989429734003},
+    {0.101728709086671, 0.013557536866379012,
+     1.3272506309045748, 1.2389327711233358},
+    {0.10422960435798184, 0.016058432137689871,
+     1.2817279176684515, 1.1933970338181226},
+    {0.14400140081046336, 0.055830228590171387,
+     1.3511475280508558, 1.262534403744435},
+    {0.14580784414926912, 0.057636671928977118,
+     1.304366874001506, 1.2157375547419285},
+    {0.057286671694234584, -0.030884500526057401,
+     1.3502761577351734, 1.2620973022209401},
+    {0.06067604245342683, -0.027495129766865151,
+     1.3042483862625187, 1.2160650783908253},
+    {0.099006072792286237, 0.010834900571994259,
+     1.3745013824196501, 1.2861970692925762},
+    {0.27549057966532819, 0.18731940744503625,
+     1.4805290949725745, 1.3899433718193852},
+    {0.27621027017112365, 0.18803909795083162,
+     1.4284191697462212, 1.3378180592026061},
+    {0.32080030348284272, 0.23262913126255069,
+     1.5093618800291695, 1.4177038680829142},
+    {0.32128244407425199, 0.23311127185395997,
+     1.4560877062398148, 1.364417131344807},
+    {0.22878401847584881, 0.14061284625555684,
+     1.5049438358633822, 1.4152470722276653},
+    {0.23038660680513684, 0.14221543458484487,
+     1.4526300728710335, 1.3629063300276536},
+    {0.27412323001050576, 0.18595205779021373,
+     1.5339348253878653, 1.443378193374331},
+    {0.2264261577245979, 0.13825498550430593,
+     1.0598722110703194, 0.97021469354343015},
+    {0.22795741026501715, 0.13978623804472518,
+     1.0958269370738913, 1.0061439928334612},
+    {0.20425674773480013, 0.11608557551450815,
+     1.0317253017135508, 0.94241090519564619},
+    {0.19331514883416129, 0.10514397661386932,
+     1.0722480747920395, 0.98308594730225618},
+    {0.26053284861835457, 0.1723616763980626,
+     1.0697571457905219, 0.97947948902091864},
+    {0.22795741026501715, 0.13978623804472518,
+     1.0958269370738913, 1.0061439928334612},
+    {0.24578017958822396, 0.15760900736793199,
+     1.0298761274029749, 0.93988061172080184},
+    {0.26991169351144245, 0.18174052129115048,
+     1.1525350969011141, 1.0620668884354614},
+    {0.27192245513287994, 0.18375128291258797,
+     1.1936521339388548, 1.1031419302292984},
+    {0.22931845509708401, 0.14114728287679204,
+     1.1336989691116455, 1.0439932357649329},
+    {0.23046934080935161, 0.14229816858905964,
+     1.1735283345278742, 1.0838031921798696},
+    {0.30404172451787126, 0.21587055229757932,
+     1.1257235811319415, 1.0344869732205582},
+    {0.31130057743921813, 0.2231294052189261,
+     1.1722200946468708, 1.0808045867020277},
+    {0.26765489445926005, 0.17948372223896808,
+     1.1134199124555511, 1.02299835618718},
+    {0.13755768421812273, 0.04938651199783075,
+     1.0124548475781259, 0.92389709092090633},
+    {0.12629595403833307, 0.038124781818041083,
+     1.0542230319061272, 0.96575306391611215},
+    {0.11143657741811647, 0.023265405197824489,
+     0.98184536544735102, 0.89347383545775327},
+    {0.093389933952076232, 0.0052187617317842466,
+     1.0227967928155957, 0.93451834346239671},
+    {0.18078463479822948, 0.092613462577937511,
+     1.0023318219080584, 0.9133303752684071},
+    {0.16234886634249446, 0.074177694122202459,
+     1.0417666990566643, 0.95297532307555621},
+    {0.15598640796615995, 0.06781523574586798,
+     0.97166162263515454, 0.88293552487658922},
+    {0.15419104946473938, 0.066019877244447411,
+     1.1296856054182387, 1.0409772611356825},
+    {0.14963728516413105, 0.061466112943839087,
+     1.1750866986587343, 1.0864220713808606},
+    {0.12173714655242832, 0.033565974332136324,
+     1.0987585140883906, 1.0103208466483138},
+    {0.11690844981457535, 0.028737277594283371,
+     1.1443450499091985, 1.0559395666353399},
+    {0.18966794958426395, 0.10149677736397197,
+     1.1156726348989936, 1.0265587798699392},
+    {0.1899336783598562, 0.10176250613956422,
+     1.1542581799435636, 1.0651408496622881},
+    {0.15843045500710803, 0.070259282786816063,
+     1.0851979549331059, 0.99644721779023993},
+    {0.32562829173863972, 0.23745711951834766,
+     1.0460356658743908, 0.9542507335767072},
+    {0.2964196862259646, 0.20824851400567265,
+     1.080383077074957, 0.98932841469792443},
+    {0.31007380405080998, 0.22190263183051795,
+     1.004033207646005, 0.91264832199972212},
+    {0.28851066160696892, 0.20033948938667689,
+     1.0363349261716801, 0.94546272462869907},
+    {0.3645854427148485, 0.27641427049455658,
+     1.0565195709289419, 0.9636176529383782},
+    {0.33411771641600563, 0.24594654419571357,
+     1.0918316741496508, 0.9998175012229189},
+    {0.355127760223376, 0.26695658800308408,
+     1.0103831379850989, 0.91776783222371561},
+    {0.26991169351144245, 0.18174052129115048,
+     1.1525350969011141, 1.0620668884354614},
+    {0.23046934080935161, 0.14229816858905964,
+     1.1735283345278742, 1.0838031921798696},
+    {0.26765489445926005, 0.17948372223896808,
+     1.1134199124555511, 1.02299835618718},
+    {0.22931845509708401, 0.14114728287679204,
+     1.1336989691116455, 1.0439932357649329},
+    {0.31130057743921813, 0.2231294052189261,
+     1.1722200946468708, 1.0808045867020277},
+    {0.27192245513287994, 0.18375128291258797,
+     1.1936521339388548, 1.1031419302292984},
+    {0.30404172451787126, 0.21587055229757932,
+     1.1257235811319415, 1.0344869732205582},
+    {0.24252318573706824, 0.15435201351677627,
+     0.95923310923556093, 0.86929701147476546},
+    {0.22293123414307944, 0.13476006192278747,
+     0.99242263127419483, 0.9028223070365029},
+    {0.21828609441021921, 0.13011492218992723,
+     0.91997611260096457, 0.83045000047050233},
+    {0.19946618947118952, 0.11129501725089755,
+     0.96170660189847046, 0.87246025227582769},
+    {0.28693723257160519, 0.19876606035131322,
+     0.9643085363489956, 0.87347186955735845},
+    {0.26596149404170022, 0.17779032182140828,
+     0.99805534893357439, 0.90766846460835815},
+    {0.26286561663591024, 0.17469444441561821,
+     0.92411103951052631, 0.83378680457446275},
+    {0.21683091352576464, 0.12865974130547267,
+     1.7228985283319584, 1.6333952422289091},
+    {0.22064928086239421, 0.13247810864210224,
+     1.6677097622461765, 1.5781461520238345},
+    {0.26177855443134329, 0.17360738221105132,
+     1.7547418675552287, 1.6644394050125877},
+    {0.26589310753412654, 0.17772193531383451,
+     1.699107405041977, 1.6087219149103644},
+    {0.16767098392429822, 0.079499811704006246,
+     1.7463914617877367, 1.6575426431441078},
+    {0.17171847787158537, 0.083547305651293396,
+     1.6916407620808251, 1.6027465217554524},
+    {0.21249708062938949, 0.12432590840909752,
+     1.7780056112490874, 1.6885691156728362},
+    {0.1786196251338322, 0.090448452913540228,
+     1.582782032107672, 1.4938068748017179},
+    {0.18143305215015756, 0.093261879929865593,
+     1.5293052535992278, 1.4402958491160356},
+    {0.22392197305235062, 0.13575080083205865,
+     1.6127740340218231, 1.5231576152343957},
+    {0.22663367370197479, 0.13846250148168282,
+     1.5584169659207594, 1.4687560157136585},
+    {0.13038518876937891, 0.042214016549086929,
+     1.6070038806737246, 1.5185033537286412},
+    {0.13372801124936615, 0.045556839029074168,
+     1.5535864235576331, 1.4650597999153101},
+    {0.17537663027269471, 0.087205458052402735,
+     1.6369965689860202, 1.5480599821737766},
+    {0.35504400951849691, 0.26687283729820499,
+     1.7637737568114094, 1.6711609442256783},
+    {0.35922765418755864, 0.27105648196726662,
+     1.7072338543857755, 1.6144955384378119},
+    {0.39835439420729812, 0.3101832219870061,
+     1.7969326053565613, 1.7029235049869551},
+    {0.40310309780183484, 0.31493192558154293,
+     1.7400770564337324, 1.6459014829426801},
+    {0.30624995097154639, 0.21807877875125437,
+     1.7871183161335904, 1.6958278678773606},
+    {0.31079377853334123, 0.22262260631304928,
+     1.7311458234784687, 1.6397429852383931},
+    {0.34994617754373358, 0.26177500532344167,
+     1.819968702740596, 1.7275061753868026},
+    {0.31745381046772037, 0.22928263824742834,
+     1.6191446447077766, 1.5275731499860512},
+    {0.31953597774054676, 0.23136480552025473,
+     1.5638116880660884, 1.4721865026828365},
+    {0.36245695788263399, 0.27428578566234196,
+     1.6507083783950631, 1.5578718426273013},
+    {0.36471754290758196, 0.27654637068728993,
+     1.5945561557720707, 1.501650163052489},
+    {0.26933220955298065, 0.18116103733268862,
+     1.6435369028309232, 1.5530807219243405},
+    {0.27207597266177952, 0.18390480044148758,
+     1.5883707889033265, 1.4978573623014912},
+    {0.3145378094409047, 0.22636663722061276,
+     1.6750373056160752, 1.5835402307969133},
+    {0.1144148265563257, 0.026243654336033713,
+     1.8234759740460886, 1.7350862953072503},
+    {0.11873348636827361, 0.030562314147981627,
+     1.7695679586216848, 1.6811505562283455},
+    {0.15856247854457362, 0.070391306324281644,
+     1.8549124536816077, 1.7661603700748343},
+    {0.16327053661204055, 0.07509936439174858,
+     1.8009217339094052, 1.7121205955311749},
+    {0.066229711463245966, -0.021941460757046026,
+     1.8456551668747652, 1.7574623723278149},
+    {0.070327712072172116, -0.017843460148119872,
+     1.7924108032991422, 1.7042092628626362},
+    {0.10994599847280478, 0.021774826252512793,
+     1.8767271461483626, 1.7883644023397394},
+    {0.078368458078489217, -0.009802714141802768,
+     1.6848025900655923, 1.5965795779945378},
+    {0.082240213091820252, -0.0059309591284717189,
+     1.6310566216900872, 1.542821231798835},
+    {0.12285932289761781, 0.034688150677325828,
+     1.7153082085521811, 1.626862762871907},
+    {0.12675398730685727, 0.038582815086565296,
+     1.6610140164203886, 1.5725407001541278},
+    {0.030523802402338474, -0.057647369817953507,
+     1.7083392400286339, 1.6201599588787525},
+    {0.034489455135013836, -0.053681717085278149,
+     1.6549147795412715, 1.5667395475118424},
+    {0.074386068371268821, -0.013785103849023164,
+     1.7386912665916054, 1.6504796030573523},
+    {0.25169252430020839, 0.16352135207991642,
+     1.8648417425815338, 1.7747357211691046},
+    {0.25702676449010364, 0.16885559226981167,
+     1.8100975128321937, 1.7198888487196198},
+    {0.2949803128060221, 0.20680914058573008,
+     1.8972856784658116, 1.8062647008752846},
+    {0.30095597227430437, 0.21278480005401243,
+     1.8426079699444549, 1.7514457476182612},
+    {0.20247035294339555, 0.11429918072310358,
+     1.8866623851653699, 1.7973736150071795},
+    {0.20769172372915487, 0.1195205515088629,
+     1.8326992408751341, 1.7433347254956544},
+    {0.24584426380705249, 0.15767309158676052,
+     1.9186637537393558, 1.828667058590582},
+    {0.20086819266609124, 0.11269702044579927,
+     -1.261449647810468, -1.3507156892612577},
+    {0.15990179673145177, 0.071730624511159774,
+     -1.2317639443514463, -1.3205297769964863},
+    {0.19828208863782601, 0.11011091641753404,
+     -1.3125924193265743, -1.4018222810268095},
+    {0.15714440697048448, 0.068973234750192486,
+     -1.2828098705650948, -1.3715475747785308},
+    {0.24296646168565963, 0.15479528946536766,
+     -1.240490078417495, -1.3304342022451761},
+    {0.20301528366385121, 0.11484411144355924,
+     -1.2111921597783633, -1.3004887153654752},
+    {0.24096138273927747, 0.1527902105189855,
+     -1.2909044490309103, -1.3808124205419763},
+    {0.12108367271623832, 0.032912500495946344,
+     -1.152225108291324, -1.2406582981837198},
+    {0.079573231850289694, -0.008597940370002298,
+     -1.1226558830739199, -1.2108826046395829},
+    {0.11828834146311612, 0.030117169242824142,
+     -1.2018964756841248, -1.2903109434321192},
+    {0.076274089692078301, -0.011897082528213691,
+     -1.1718986299865504, -1.2601154989996333},
+    {0.16437909050707072, 0.076207918286778753,
+     -1.132990537533203, -1.2218035205916384},
+    {0.12361913207103237, 0.035447959850740375,
+     -1.1039317412606475, -1.1923825174948017},
+    {0.16231195645949911, 0.074140784239207141,
+     -1.1817540663808834, -1.270545053025282},
+    {0.15061110086811591, 0.062439928647823932,
+     -1.387023362508726, -1.4756971804269032},
+    {0.10840697434890145, 0.020235802128609474,
+     -1.3570667377124384, -1.4454206175740407},
+    {0.14686796977537511, 0.058696797555083134,
+     -1.439643970551338, -1.5282829314058197},
+    {0.10466813594354543, 0.016496963723253447,
+     -1.4099908300757078, -1.4983240550262744},
+    {0.1952575512121921, 0.10708637899190013,
+     -1.3643707777337455, -1.4535591195663922},
+    {0.15404346334223901, 0.065872291121947035,
+     -1.3346513410644854, -1.4233582389690886},
+    {0.19180561599207996, 0.10363444377178799,
+     -1.4165152880821659, -1.5056572859968831},
+    {0.069181838845588622, -0.018989333374703366,
+     -1.2741453452654548, -1.3623442908418122},
+    {0.026042717354648619, -0.062128454865643369,
+     -1.2434582828559206, -1.3316438088703177},
+    {0.065429418359972569, -0.022741753860319413,
+     -1.3266887502387912, -1.4148800098652254},
+    {0.021941460757046026, -0.066229711463245966,
+     -1.2959374867150282, -1.3841302812619785},
+    {0.11523635021229175, 0.027065177991999763,
+     -1.2527510184164516, -1.3411458426203697},
+    {0.072804336495218627, -0.015366835725073358,
+     -1.2224663745109225, -1.3106739195507404},
+    {0.11193720502751223, 0.023766032807220248,
+     -1.3045602539887735, -1.3929347793581481},
+    {0.32119549540407022, 0.23302432318377828,
+     -1.2486908411512516, -1.3403591486292847},
+    {0.28333682255319292, 0.1951656503329009,
+     -1.2199400316311133, -1.3106963349273066},
+    {0.31981752672737351, 0.23164635450708149,
+     -1.2984771568817519, -1.3901096376042215},
+    {0.28196013910860218, 0.19378896688831024,
+     -1.2696002367603216, -1.3603261598137246},
+    {0.35861958211487033, 0.2704484098945783,
+     -1.2281855309511662, -1.3209054836547185},
+    {0.32191386846327308, 0.23374269624298114,
+     -1.1998067158917063, -1.2914937810136722},
+    {0.35787198106816431, 0.2697008088478724,
+     -1.27725038494682, -1.3699478176812276},
+    {0.24544646235413228, 0.15727529013384031,
+     -1.1427672894477812, -1.2327566695547405},
+    {0.2060374663793966, 0.11786629415910463,
+     -1.1141956805263473, -1.2035359204488794},
+    {0.24445424849016176, 0.15628307626986979,
+     -1.1910422411130477, -1.2810134429359796},
+    {0.20473250399521803, 0.11656133177492606,
+     -1.1620433637346352, -1.2513646356692083},
+    {0.28438684868357422, 0.19621567646328225,
+     -1.1239274596174689, -1.2147070639510777},
+    {0.24597327578255165, 0.15780210356225968,
+     -1.0958402149561597, -1.1858392857782143},
+    {0.28413454879895084, 0.19596337657865887,
+     -1.1713192701808386, -1.2620932655226551},
+    {0.27738888587870331, 0.18921771365841134,
+     -1.3711430145514549, -1.4617694372669641},
+    {0.23842757004500117, 0.1502563978247092,
+     -1.3420513810922594, -1.4319142250667622},
+    {0.27418550618553095, 0.18601433396523898,
+     -1.4225242648711445, -1.5130822177598124},
+    {0.23536522545931779, 0.14719405323902582,
+     -1.3936748732467732, -1.4834840059927858},
+    {0.31775757507985181, 0.22958640285955986,
+     -1.3489383633606735, -1.4405176622880389},
+    {0.27998120733058185, 0.19181003511028988,
+     -1.3200818596365931, -1.4107644487842705},
+    {0.31500718182984988, 0.22683600960955785,
+     -1.3998273448850522, -1.4913363379567901},
+    {0.17876697548802767, 0.090595803267735697,
+     2.0899106893502051, 2.0009337565126488},
+    {0.17224650371625175, 0.084075331495959776,
+     2.1383128518025458, 2.0494125750400691},
+    {0.13774093911196286, 0.049569766891670884,
+     2.0599324914820158, 1.9713732119530807},
+    {0.13146720042412774, 0.043296028203835761,
+     2.1076905088370737, 2.0191816447962267},
+    {0.22602301707585135, 0.13785184485555937,
+     2.0720013477533565, 1.982350487098016},
+    {0.21967378420645833, 0.13150261198616636,
+     2.1202981103328646, 2.0307500433169405},
+    {0.18497474360169908, 0.096803571381407105,
+     2.0414249251821417, 1.9523713683759274},
+    {0.20684668048184726, 0.11867550826155529,
+     2.2207730880997758, 2.1314210055351701},
+    {0.19952530485858663, 0.11135413263829466,
+     2.2728843321650172, 2.1836371559551879},
+    {0.1652010729552903, 0.077029900734998324,
+     2.1882130978087289, 2.0993912595072817},
+    {0.1576469693644269, 0.069475797144134932,
+     2.239422932103702, 2.1506801528033419},
+    {0.2551707053424121, 0.1669995331221201,
+     2.2022437314462531, 2.1120710996747789},
+    {0.24867189384691607, 0.1605007216266241,
+     2.2541386193894022, 2.1640894827713462},
+    {0.21356627714113391, 0.12539510492084194,
+     2.1698394182254708, 2.0803866101750348},
+    {0.050139506064411435, -0.03803166615588055,
+     2.0484948635234224, 1.9603220755440702},
+    {0.043940321570897445, -0.04423085064939454,
+     2.0957126862513058, 2.0075415131007293},
+    {0.0085979403700022147, -0.079573231850289777,
+     2.0189367705158734, 1.9307100489502105},
+    {0.0054821579942324616, -0.08268901422605951,
+     2.0666772955972204, 1.9784403851312153},
+    {0.096087454351854951, 0.0079162821315629794,
+     2.0298669225821087, 1.9415763998969022},
+    {0.091460919987053302, 0.0032897477667613167,
+     2.0779901487665855, 1.9897199372584045},
+    {0.05405310634533974, -0.034118065874952253,
+     1.9997690768075811, 1.9115935244386375},
+    {0.075210513740968044, -0.012960658479323945,
+     2.1748440104284295, 2.0866301125603006},
+    {0.066600239379303205, -0.021570932840988783,
+     2.2253755959030515, 2.1371820715543959},
+    {0.035158476066562638, -0.053012696153729347,
+     2.143802273382565, 2.0556275877200441},
+    {0.026135891301765083, -0.062035280918526899,
+     2.1933409481902655, 2.1051555700598423},
+    {0.12400604076119137, 0.03583486854089938,
+     2.1564978437109654, 2.0680443331915295},
+    {0.11612008187676007, 0.027948909656468089,
+     2.2067286827520118, 2.1183282561722447},
+    {0.083511650746015464, -0.0046595214742765137,
+     2.1256572854176379, 2.0374175415085278},
+    {0.28132801122076301, 0.19315683900047104,
+     2.003041229948415, 1.9123291921116021},
+    {0.27384422137545394, 0.18567304915516192,
+     2.0536361170474873, 1.963085398011758},
+    {0.23956029634690543, 0.15138912412661346,
+     1.9712842655924074, 1.8814013245373191},
+    {0.23292466212624413, 0.14475348990595216,
+     2.0224626775965047, 1.9326957020660975},
+    {0.32990431242588258, 0.24173314020559053,
+     1.9831563246763149, 1.8912568974632085},
+    {0.32196770475389558, 0.23379653253360355,
+     2.0348079137968651, 1.9431194407249162},
+    {0.28840641125589428, 0.20023523903560234,
+     1.9508510942810373, 1.8599812549761729},
+    {0.30716267766256788, 0.21899150544227594,
+     2.1335538722367922, 2.0422410214722868},
+    {0.30237313714874481, 0.21420196492845286,
+     2.183844324079411, 2.0926480622625974},
+    {0.26605480066228537, 0.1778836284419934,
+     2.1024614335479797, 2.0120726462323502},
+    {0.26096165347442146, 0.17279048125412949,
+     2.1516169627805675, 2.0613307845595306},
+    {0.35197886313158255, 0.26380769091129053,
+     2.1156572177342654, 2.0231351130553556},
+    {0.34824156640555459, 0.26007039418526257,
+     2.1655832619179365, 2.0731703428242736},
+    {0.31358831475420845, 0.22541714253391643,
+     2.0847214989787526, 1.9932484625326492},
+    {0.14843587853380602, 0.060264706313514056,
+     1.960101681926907, 1.8714482747872407},
+    {0.1431310814553981, 0.054959909235106123,
+     2.0107906305058059, 1.9221852033938764},
+    {0.1053719590202272, 0.017200786799935204,
+     1.9290384929036899, 1.8407014748217312},
+    {0.10073791961703882, 0.012566747396746826,
+     1.9801572954172872, 1.8918444416235265},
+    {0.19689712214290145, 0.10872594992260948,
+     1.9396032509037544, 1.8503925076598329},
+    {0.19104147752485018, 0.10287030530455821,
+     1.9912636783335738, 1.9021317893006007},
+    {0.15359886977682963, 0.065427697556537628,
+     1.908063219344883, 1.8193606665981359},
+    {0.17463822432308201, 0.086467052102790043,
+     0.50129763317416731, 0.41236969321290862},
+    {0.15673979973286833, 0.068568627512576336,
+     0.54885393143619321, 0.46012029641153263},
+    {0.14472276700171713, 0.05655159478142515,
+     0.46009056325096559, 0.37147100721372289},
+    {0.12661897912403081, 0.038447806903738814,
+     0.50765294993275445, 0.41918062254748423},
+    {0.22265180474985841, 0.13448063252956644,
+     0.49496484341286023, 0.4053690415611752},
+    {0.20433446631546831, 0.11616329409517634,
+     0.54286688709719755, 0.453551368878921},
+    {0.19224222161872004, 0.10407104939842807,
+     0.45353151995489527, 0.36438372173139377},
+    {0.16779237871174835, 0.079621206491456376,
+     0.63715212815218214, 0.5483019690403248},
+    {0.14916093060088842, 0.060989758380596441,
+     0.68484157041140714, 0.59618140753949056},
+    {0.13834655495402315, 0.050175382733731184,
+     0.59685708720690733, 0.508292753403084},
+    {0.11958740099544843, 0.03141622877515645,
+     0.64509016214944648, 0.55666708067987591},
+    {0.21508813485865211, 0.12691696263836014,
+     0.63182551197342629, 0.5423492985870163},
+    {0.19621965348075449, 0.10804848126046251,
+     0.67663138065454687, 0.58742992408083217},
+    {0.18604883765293029, 0.097877665432638317,
+     0.5895050325019453, 0.50043785605026025},
+    {0.064690553749899918, -0.023480618470392067,
+     0.42413548834559739, 0.33594559563036369},
+    {0.045526729203220158, -0.04264444301707182,
+     0.47223602607049242, 0.38406476228905773},
+    {0.033305267854055798, -0.054865904366236187,
+     0.38210428286887965, 0.2939279869825574},
+    {0.013762033554191717, -0.074409138666100272,
+     0.4298951549733474, 0.34168342973312305},
+    {0.11424001904158965, 0.026068846821297668,
+     0.41863033734489352, 0.33024174570712772},
+    {0.095868086105132588, 0.0076969138848406032,
+     0.46603353306000544, 0.37774401632712123},
+    {0.083392472102917059, -0.0047787001173749191,
+     0.37705835171122759, 0.28881902200452159},
+    {0.057838663510093861, -0.030332508710198127,
+     0.56313439746841887, 0.47495488592845697},
+    {0.038458945524193461, -0.049712226696098517,
+     0.61240035044991104, 0.52422778250192137},
+    {0.026035389464357465, -0.062135782755934517,
+     0.52116476492851238, 0.43297922725092841},
+    {0.0063657509617321556, -0.081805421258559829,
+     0.57070398168805547, 0.48247004790839976},
+    {0.10803105968330998, 0.019859887463017999,
+     0.55585568979887301, 0.46750394293373188},
+    {0.089089281072917748, 0.00091810885262576941,
+     0.60448433409827895, 0.5162237984937873},
+    {0.077023594643532117, -0.011147577576759868,
+     0.51427062270205404, 0.42605159985196789},
+    {0.29092280814950811, 0.20275163592921608,
+     0.43814516315368046, 0.34721799371087303},
+    {0.27222933089871038, 0.18405815867841843,
+     0.48841741047694526, 0.39790076196775753},
+    {0.25877392342625161, 0.17060275120595964,
+     0.39610098183016007, 0.3058580890073076},
+    {0.24085037387933667, 0.15267920165904469,
+     0.44597468350959957, 0.35606870212231334},
+    {0.34225436060750569, 0.25408318838721367,
+     0.43002745596011488, 0.33778623690912507},
+    {0.32318607390947474, 0.23501490168918279,
+     0.4816441769613295, 0.38992375790425177},
+    {0.3091567022642927, 0.22098553004400068,
+     0.38698393026234551, 0.29562183380909496},
+    {0.28380279015092663, 0.19563161793063466,
+     0.58125846217501864, 0.4904918324604125},
+    {0.26385756272445826, 0.17568639050416629,
+     0.62887192148306081, 0.53852771686032563},
+    {0.25324746194262521, 0.16507628972233321,
+     0.53757738373088138, 0.44744173077593846},
+    {0.23414664959846668, 0.14597547737817471,
+     0.58543288978090469, 0.49564487797677809},
+    {0.33483492676936366, 0.24666375454907175,
+     0.57697883314596454, 0.48494493670973704},
+    {0.31408230225448897, 0.22591113003419702,
+     0.62587546725175591, 0.53438993638506371},
+    {0.30363985195817289, 0.21546867973788095,
+     0.53212467828431342, 0.440897814052505},
+    {0.17910022814248028, 0.090929055922188307,
+     0.36522946307073434, 0.27624850724219818},
+    {0.16222863412035635, 0.074057461900064375,
+     0.41336582216175838, 0.3245757139695204},
+    {0.14912828448604559, 0.060957112265753594,
+     0.32704125215581176, 0.23838139449096379},
+    {0.13202485725480387, 0.043853685034511876,
+     0.37224626509645675, 0.28373306312571067},
+    {0.22697723653747715, 0.13880606431718517,
+     0.35558178080061276, 0.26591513839172232},
+    {0.20973644614933951, 0.12156527392904753,
+     0.40488920467673106, 0.31549432754023443},
+    {0.19574543091732199, 0.10757425869703002,
+     0.31663259337840943, 0.22743761189289871},
+    {0.17429639164916225, 0.086125219428870275,
+     -1.6231452895364342, -1.7120692435691394},
+    {0.13409347278078249, 0.045922300560490507,
+     -1.5961125821331716, -1.6846421197849071},
+    {0.16911156405448752, 0.080940391834195546,
+     -1.6738949171809177, -1.7627597300876214},
+    {0.1294548841600057, 0.041283711939713717,
+     -1.6468863091740904, -1.7353797520350651},
+    {0.2190658057362378, 0.13089463351594582,
+     -1.5990344314874274, -1.6885728570203205},
+    {0.17914965075199374, 0.090978478531701767,
+     -1.572329745295773, -1.6613112986212895},
+    {0.21440284670641133, 0.12623167448611936,
+     -1.6503923595070673, -1.7398580063771614},
+    {0.096682523481869009, 0.0085113512615770381,
+     -1.5159142495281768, -1.6042075225207597},
+    {0.053681717085278149, -0.034489455135013836,
+     -1.4866778740485218, -1.5748531060779509},
+    {0.092505231594974702, 0.0043340593746827097,
+     -1.5683243354970386, -1.6565989657633238},
+    {0.049711527652932741, -0.038459644567359244,
+     -1.5397927735994255, -1.6279653412006267},
+    {0.14284271592567344, 0.054671543705381458,
+     -1.4922230709219466, -1.5808259627956929},
+    {0.10074896994709523, 0.012577797726803258,
+     -1.4630391695869076, -1.5513520787315469},
+    {0.13857090357038848, 0.050399731350096517,
+     -1.5444719345797169, -1.6330381491171773},
+    {0.1188782725832436, 0.030707100362951621,
+     -1.7471309532280994, -1.8355493139516592},
+    {0.079689827314109257, -0.0084813449061827278,
+     -1.7201231075837891, -1.8083501949595662},
+    {0.11283346205434355, 0.024662289834051561,
+     -1.7979181263751707, -1.8862980701082217},
+    {0.075445516281188951, -0.012725655939103027,
+     -1.7681725781631981, -1.8563871239153831},
+    {0.16353388555261128, 0.075362713332319281,
+     -1.7252486607897017, -1.8140526028304733},
+    {0.12470113725192103, 0.036529965031629051,
+     -1.6965607294156946, -1.7850191858758222},
+    {0.15759659508972723, 0.06942542286943526,
+     -1.776943070550538, -1.8656853401133286},
+    {0.041890465099435455, -0.04628070712085653,
+     -1.6439425614021999, -1.7321139460517947},
+    {-0.001358961259735475, -0.089530133480027446,
+     -1.6163873083908737, -1.7046496048782322},
+    {0.03810026292599232, -0.050070909294299665,
+     -1.6944589167815003, -1.7826316683515306},
+    {-0.0047281738753503014, -0.092899346095642293,
+     -1.6679334417694349, -1.7562097647760622},
+    {0.088255326710925397, 8.4154490633418788e-05,
+     -1.6199929093299659, -1.7082501610020118},
+    {0.045770494299733698, -0.042400677920558294,
+     -1.5923053432416248, -1.6804766406173235},
+    {0.083971193903824431, -0.0041999783164675605,
+     -1.6706668960952382, -1.7589082489054935},
+    {0.30664672617061783, 0.21847555395032589,
+     -1.6008114393997281, -1.6921116156470861},
+    {0.26432819216487041, 0.17615701994457844,
+     -1.5741198116259409, -1.664473525068985},
+    {0.30269252693140225, 0.21452135471111022,
+     -1.6542956155724242, -1.7454995777568942},
+    {0.26033585656709829, 0.17216468434680632,
+     -1.6260357659898037, -1.716309514125699},
+    {0.35305411923505703, 0.264882947014765,
+     -1.5747099543566594, -1.667263760204416},
+    {0.30982131899423104, 0.2216501467739391,
+     -1.5483961458422963, -1.6397747486501437},
+    {0.34994496716573087, 0.26177379494543895,
+     -1.6288021763498415, -1.7212646683645103},
+    {0.22771753943545833, 0.13954636721516636,
+     -1.4972616054045009, -1.5869405517050768},
+    {0.18794786453176002, 0.099776692311468046,
+     -1.468744811067344, -1.5578363291765256},
+    {0.22319346481144012, 0.13502229259114815,
+     -1.5486723613253293, -1.6382769363779601},
+    {0.18371581564846073, 0.095544643428168763,
+     -1.520775454619588, -1.6098131840990957},
+    {0.27038742849624331, 0.18221625627595134,
+     -1.4739562223908544, -1.5644343301433952},
+    {0.23178691761032744, 0.14361574539003547,
+     -1.4455040764576137, -1.5352515952483707},
+    {0.2676717236031444, 0.17950055138285242,
+     -1.523355298834004, -1.6137772011097271},
+    {0.25039224259387394, 0.16222107037358197,
+     -1.7322997046609503, -1.82238112948319},
+    {0.20921433649126633, 0.12104316427097436,
+     -1.7024983261960303, -1.7918854131162087},
+    {0.24447483798427094, 0.15630366576397897,
+     -1.7860727902420326, -1.8760443683092003},
+    {0.20352318935448063, 0.11535201713418866,
+     -1.7550811573729241, -1.8443849945138751},
+    {0.297949268519481, 0.20977809629918906,
+     -1.7085679865604289, -1.7996586790762881},
+    {0.25568765802305132, 0.16751648580275935,
+     -1.678854754455821, -1.7690373879095593},
+    {0.29242715543962788, 0.20425598321933591,
+     -1.7633211659102439, -1.8542829181250056},
+    {0.13120911486610254, 0.04303794264581056,
+     -1.9816643967066785, -2.0701712625985551},
+    {0.16916569417378957, 0.0809945219534976,
+     -2.0150980801888658, -2.1039634977910535},
+    {0.138090458691384, 0.049919286471092027,
+     -1.931326832829382, -2.0198890253021879},
+    {0.1766208087063571, 0.088449636486065131,
+     -1.9644128059885659, -2.0533640758552911},
+    {0.087393710456435458, -0.00077746176385651289,
+     -1.9980843736044562, -2.0863382971381439},
+    {0.12423828278506399, 0.036067110564772013,
+     -2.0310350727111017, -2.1194902309268069},
+    {0.093840643730488782, 0.0056694715101967968,
+     -1.948986615935504, -2.03726703760969},
+    {0.19912993914782179, 0.11095876692752982,
+     -2.0988148414538004, -2.1880564956435342},
+    {0.23671196430751576, 0.14854079208722379,
+     -2.1335201774340256, -2.2233528192828977},
+    {0.20748146725944652, 0.11931029503915455,
+     -2.04923758196469, -2.1385989976300634},
+    {0.2459099382506558, 0.15773876603036383,
+     -2.0840244523868643, -2.1740223566857964},
+    {0.15387174008005641, 0.065700567859764442,
+     -2.112817466718004, -2.2015226841864348},
+    {0.1906557440205171, 0.10248457180022513,
+     -2.1468700089249935, -2.2359968156770882},
+    {0.16155902577028575, 0.073387853549993748,
+     -2.0646313128640137, -2.1534143845087068},
+    {0.1907889360346737, 0.10261776381438173,
+     -1.8605247553204867, -1.9496533153964244},
+    {0.23095539679464477, 0.1427842245743528,
+     -1.8933667086530612, -1.9831000862709456},
+    {0.19736537871427048, 0.10919420649397851,
+     -1.8078542564504489, -1.8970714435713394},
+    {0.23797703217326693, 0.14980585995297496,
+     -1.839865011278037, -1.9297198962513031},
+    {0.14482146650982211, 0.056650294289530133,
+     -1.8802551141438881, -1.9688755538492271},
+    {0.18385210433433768, 0.095680932114045714,
+     -1.9128031742577081, -2.0018426100848203},
+    {0.15134229439356936, 0.063171122173277389,
+     -1.8287039820637729, -1.9173847573480911},
+    {0.26345042948519581, 0.17527925726490379,
+     -1.9806431698208906, -2.0709791662850869},
+    {0.30349443645330698, 0.21532326423301495,
+     -2.0158515125443879, -2.1070748552186931},
+    {0.27159261847012084, 0.18342144624982881,
+     -1.9272068589629638, -2.0177101461893541},
+    {0.31242662640334606, 0.22425545418305404,
+     -1.9620121580567382, -2.0534559132948105},
+    {0.21562641448192404, 0.12745524226163207,
+     -1.9983191912030231, -2.0878037355903438},
+    {0.25485635164935438, 0.16668517942906239,
+     -2.0329971773019304, -2.1231637400166399},
+    {0.223479052172357, 0.13530787995206503,
+     -1.9462781343763917, -2.0358873463297908},
+    {0.010354386754499283, -0.077816785465792709,
+     -1.981902393007434, -2.0701237493257558},
+    {0.045283909912667092, -0.042887262307624893,
+     -2.0137219169598666, -2.1018931524862143},
+    {0.015935053747700205, -0.072236118472591787,
+     -1.9343148121928313, -2.0225209316839252},
+    {0.051231884039358903, -0.036939288180933075,
+     -1.9658299332806728, -2.0540033569809806},
+    {-0.028737277594283427, -0.1169084498145754,
+     -1.9972476036805948, -2.0856530869544527},
+    {0.0049513685535247029, -0.083219803666767289,
+     -2.0286237670624221, -2.1168624988944638},
+    {-0.023655150184943304, -0.1118263224052353,
+     -1.9507678949921952, -2.0391417549961028},
+    {0.074625216822967466, -0.013545955397324512,
+     -2.0930966241716735, -2.1813089296381483},
+    {0.11026251894704697, 0.022091346726754994,
+     -2.1260862192113708, -2.2144508121776143},
+    {0.080973120350490896, -0.0071980518698010962,
+     -2.0461826168285757, -2.1344138099016847},
+    {0.11723742358174941, 0.029066251361457414,
+     -2.0792336670189902, -2.1676412767931148},
+    {0.033793798796896993, -0.054377373423394992,
+     -2.1062688696254708, -2.1944447116362027},
+    {0.068391505537071545, -0.019779666683220429,
+     -2.1386713530269024, -2.2268685764418619},
+    {0.03946003830649384, -0.048711133913798145,
+     -2.0605902764869097, -2.1487623919572534},
+    {0.063342449506879867, -0.024828722713412112,
+     -1.8677659370056623, -1.9559534598685908},
+    {0.1002640497455265, 0.012092877525234504,
+     -1.8991009361164197, -1.9874114265171037},
+    {0.069417757249121387, -0.018753414971170588,
+     -1.8180402985807269, -1.90623976892099},
+    {0.10661220532343763, 0.018441033103145633,
+     -1.8486613156288529, -1.9370051251050973},
+    {0.021660942397079448, -0.06651022982321253,
+     -1.8860573493161448, -1.9742506952650445},
+    {0.057265515516720954, -0.030905656703571031,
+     -1.9171064399113229, -2.0052852708168771},
+    {0.02749512976686562, -0.060676042453426365,
+     -1.8373442673272746, -1.925527575198968},
+    {0.12750683446605479, 0.039335662245762813,
+     -2.9290968249535783, -3.0175756855016309},
+    {0.097350999473083732, 0.0091798272527917613,
+     -2.8884916343940161, -2.9767880344632665},
+    {0.10758223025322713, 0.019411058032935156,
+     -2.9715508914796449, -3.0599001081054911},
+    {0.077920067190926423, -0.010251105029365555,
+     -2.9319962836324098, -3.0202179478859712},
+    {0.17800160581940433, 0.089830433599112358,
+     -2.9260069344015283, -3.0149746665551631},
+    {0.14800998635696433, 0.059838814136672351,
+     -2.8849048370654158, -2.9735542981254888},
+    {0.15698582225560997, 0.068814650035317976,
+     -2.9691316281963238, -3.0578677357266852},
+    {0.086232143067371231, -0.0019390291529207404,
+     -2.8015045956991775, -2.8897541365710468},
+    {0.054865904366236132, -0.033305267854055853,
+     -2.7594883707209132, -2.8476646666072356},
+    {0.066705942149261538, -0.021465230071030447,
+     -2.8474399397978161, -2.9356336745634906},
+    {0.035776612648559844, -0.052394559571732141,
+     -2.8060744515530547, -2.8942486674874455},
+    {0.13780648384916505, 0.049635311628873087,
+     -2.796696509368386, -2.8852563343173281},
+    {0.10620854587047757, 0.018037373650185574,
+     -2.7541950609324606, -2.8425366450017671},
+    {0.1173528352743857, 0.029181663054093719,
+     -2.8433581414573563, -2.9317664995488997},
+    {0.041129016539973182, -0.047042155680318803,
+     -3.0138720232032812, -3.10204358079047},
+    {0.011896956104186077, -0.076274216116105908,
+     -2.975897995668991, -3.0641148650411885},
+    {0.023890623232503898, -0.064280548987788094,
+     -3.0521885731583507, -3.1403777281467451},
+    {-0.004873607975862726, -0.093044780196154697,
+     -3.0153843501563076, -3.1036613012891738},
+    {0.088330852646140184, 0.00015968042584819236,
+     -3.0122235905634889, -3.1004811371026029},
+    {0.059155436165544285, -0.0290157360547477,
+     -2.9738030933764104, -3.0619842783975524},
+    {0.069823498198979705, -0.018347674021312287,
+     -3.0510985827667603, -3.1392989671109288},
+    {-0.00059397953808494608, -0.088765151758376931,
+     -2.8950668871808052, -2.9833261391125099},
+    {-0.030797749191363293, -0.11896892141165527,
+     -2.8549709153348024, -2.9433898770109588},
+    {-0.017707579180815308, -0.10587875140110728,
+     -2.9372664416390779, -3.0256062182922192},
+    {-0.047504983754479639, -0.13567615597477162,
+     -2.8980783614363985, -2.9866206573508962},
+    {0.04774821395212149, -0.040422958268170495,
+     -2.8918751429476681, -2.9800469065724688},
+    {0.017258289457507202, -0.07091288276278479,
+     -2.8513067616144947, -2.9395096719180906},
+    {0.029454403651392395, -0.05871676856889959,
+     -2.9347159311893476, -3.0228965417190556},
+    {0.25782827467332631, 0.16965710245303434,
+     -2.9637536398720439, -3.0539779690090088},
+    {0.22916494811468804, 0.14099377589439607,
+     -2.9227161691084897, -3.0124193232661161},
+    {0.23529587558494031, 0.14712470336464833,
+     -3.006373406975464, -3.0961813338704687},
+    {0.2071479170596992, 0.11897674483940723,
+     -2.9665356731571824, -3.055892179990662},
+    {0.30877106046776659, 0.22059988824747465,
+     -2.9607764847715705, -3.0521290246950086},
+    {0.28073708119942853, 0.19256590897913659,
+     -2.9192143790682055, -3.0099134732482842},
+    {0.28534268923417194, 0.19717151701387992,
+     -3.0040931900884886, -3.0948941028678871},
+    {0.22130899462723927, 0.1331378224069473,
+     -2.8345006568030979, -2.9240748300433324},
+    {0.19025163618676258, 0.10208046396647061,
+     -2.7916372969115164, -2.8807587941331425},
+    {0.19949033340924105, 0.11131916118894908,
+     -2.8811033309386569, -2.9703500181169509},
+    {0.1689725191792483, 0.080801346958956327,
+     -2.8390490848292926, -2.9279123456764862},
+    {0.27408334054709971, 0.18591216832680774,
+     -2.8297010445932989, -2.9202568307577055},
+    {0.24329188634975427, 0.15512071412946229,
+     -2.7863143090608764, -2.8762643372735974},
+    {0.25153212057752317, 0.16336094835723119,
+     -2.8770759300191036, -2.9671789082137114},
+    {0.16470598574103018, 0.07653481352073821,
+     -3.0485372092884693, -3.1373537066011061},
+    {0.13656121834121879, 0.048390046120926809,
+     -3.0104301694658879, -3.0989796983239506},
+    {0.14448773744083204, 0.056316565220540044,
+     -3.0867036654573972, 3.1078641863854659},
+    {0.11682088562253559, 0.0286497134022436,
+     -3.0498841120129296, -3.1382890308976186},
+    {0.21327908875752191, 0.12510791653722994,
+     -3.0470500875192403, -3.1364985033764512},
+    {0.18562288818547035, 0.097451715965178376,
+     -3.0084829708687453, -3.0975447334359778},
+    {0.19189068109594085, 0.10371950887564887,
+     -3.0857879027365365, 3.1082542778298827},
+    {0.12315170465935882, 0.03498053243906684,
+     2.4523868856128761, 2.3639393948049747},
+    {0.11377177398602767, 0.025600601765735691,
+     2.506204543620044, 2.417818850488191},
+    {0.081225595392580119, -0.0069455768277118732,
+     2.417377816246876, 2.3291457982679344},
+    {0.07198403771721254, -0.016187134503079448,
+     2.4710960479116744, 2.3828905517079684},
+    {0.1742912268303389, 0.086120054610046931,
+     2.4336415452547508, 2.3447176513638222},
+    {0.16498127480176433, 0.076810102581472361,
+     2.4877066728086992, 2.3988872084508146},
+    {0.13230304215627323, 0.044131869935981234,
+     2.3984931860370544, 2.30997780965712},
+    {0.14548983135402671, 0.057318659133734712,
+     2.594687052273712, 2.5060606054374146},
+    {0.1354926600592026, 0.047321487838910624,
+     2.6470125108064453, 2.5584717056370039},
+    {0.10424788591378614, 0.01607671369349415,
+     2.559637024937286, 2.4713060438326893},
+    {0.094666817250980806, 0.0064956450306888208,
+     2.6123883016459208, 2.5241042178118169},
+    {0.19642834834782383, 0.10825717612753186,
+     2.576864639545116, 2.4876603267732644},
+    {0.18613294815632561, 0.09796177593603364,
+     2.6296944654397678, 2.5406262179419596},
+    {0.15535064672497062, 0.067179474504678621,
+     2.5414900976542358, 2.4527703201632627},
+    {-0.011028977579625697, -0.099200149799917675,
+     2.401746328848434, 2.313441071882445},
+    {-0.020200809688713996, -0.10837198190900599,
+     2.4550945557342523, 2.3667408749563945},
+    {-0.051682493564385652, -0.13985366578467762,
+     2.3676616304980977, 2.2790845752920776},
+    {-0.060956000547408039, -0.14912717276770002,
+     2.4207273088855978, 2.3320674616124548},
+    {0.039502437498507237, -0.048668734721784741,
+     2.3827606775451446, 2.2945885792879368},
+    {0.030285918077892143, -0.057885254142399846,
+     2.4362496844599808, 2.3480701163184077},
+    {-0.0017282587193228408, -0.089899430939614833,
+     2.3486107261651377, 2.260346941346608},
+    {0.012050690250213686, -0.076120481970078285,
+     2.5429747683666815, 2.4547583346411264},
+    {0.0031863742966503281, -0.084984797923641664,
+     2.5956110173314375, 2.5073660497113179},
+    {-0.029164337755519056, -0.11733550997581105,
+     2.5083529214658524, 2.419944675785672},
+    {-0.037846086129803565, -0.12601725835009556,
+     2.5612219750298624, 2.4727540351315906},
+    {0.062689708650590203, -0.025481463569701778,
+     2.5246313475403679, 2.4364449145082427},
+    {0.053424473120519629, -0.034746699099772349,
+     2.577681076316872, 2.4895060590408109},
+    {0.021108870615270579, -0.067062301605021413,
+     2.489755970469925, 2.401561519049475},
+    {0.23359388110469723, 0.14542270888440526,
+     2.3607383490726774, 2.2709598708961294},
+    {0.22508204416095973, 0.13691087194066776,
+     2.4148723251373871, 2.3252369418023049},
+    {0.1916281557052634, 0.10345698348497143,
+     2.3259229736974119, 2.2367833282714189},
+    {0.18319748370389574, 0.09502631148360377,
+     2.3796091969098008, 2.2905779412955489},
+    {0.28319377045102806, 0.19502259823073609,
+     2.3418922221497565, 2.2511390846407004},
+    {0.27521495073205771, 0.18704377851176573,
+     2.3960907191043574, 2.3055108752461626},
+    {0.24147150503619194, 0.15330033281589997,
+     2.3070611287151994, 2.217143996550341},
+    {0.25712672994064639, 0.16895555772035442,
+     2.504929982613874, 2.4147193681979755},
+    {0.24716905384690674, 0.15899788162661477,
+     2.5589300993084323, 2.4689089317094433},
+    {0.2159970270660449, 0.12782585484575293,
+     2.4691494260551266, 2.3796591296891365},
+    {0.20641586011976015, 0.11824468789946818,
+     2.5232510303866049, 2.4339052604414788},
+    {0.30717758746429802, 0.21900641524400608,
+     2.4865365088536828, 2.3952232914113152},
+    {0.29740415807972975, 0.20923298585943773,
+     2.5408919415850799, 2.4498141171495971},
+    {0.26650360775320076, 0.17833243553290878,
+     2.4505438077042943, 2.3601458548412486},
+    {0.099229580612930579, 0.011058408392638587,
+     2.3106237872898596, 2.2223183869031917},
+    {0.090333138855917594, 0.0021619666356256229,
+     2.3637855373025065, 2.2755199891332891},
+    {0.057734729482019444, -0.030436442738272541,
+     2.2770403807613668, 2.1888609947978201},
+    {0.048678025299285756, -0.039493146921006229,
+     2.3295931282466578, 2.2414210262312428},
+    {0.14961424317539596, 0.061443070955103991,
+     2.2917165983542613, 2.2030521874998525},
+    {0.14114705189598789, 0.052975879675695912,
+     2.3448352009269113, 2.256247064978214},
+    {0.1078451783188896, 0.019674006098597603,
+     2.2581826424486828, 2.1698319456513189},
+    {0.08424355465827249, -0.0039276175620195017,
+     -0.047428173634779962, -0.13567048882707361},
+    {0.069015275062506445, -0.01915589715778554,
+     -0.015504185804287376, -0.10370276384545482},
+    {0.077753836752277733, -0.010417335468014252,
+     -0.082236376852266063, -0.17045754595115073},
+    {0.049168943728089338, -0.03900222849220264,
+     -0.052059103773782173, -0.14023141520101542},
+    {0.10990288123611147, 0.02173170901581948,
+     -0.022982889382728508, -0.11134538198540712},
+    {0.069015275062506445, -0.01915589715778554,
+     -0.015504185804287376, -0.10370276384545482},
+    {0.11531397948788236, 0.027142807267590364,
+     -0.064289170131183584, -0.15268448366812548},
+    {0.080700981841136721, -0.0074701903791552574,
+     0.052832608454887908, -0.035397701781822666},
+    {0.064280548987787928, -0.023890623232504068,
+     0.089404080431442226, 0.001214925443047514},
+    {0.052955568551625795, -0.03521560366866619,
+     0.018090943529082873, -0.070083697308434625},
+    {0.036062383594220274, -0.052108788626071711,
+     0.053409993049383681, -0.034764017114615409},
+    {0.1231568747631151, 0.03498570254282312,
+     0.045240234375901515, -0.043207292664295155},
+    {0.10899788119768244, 0.020826708977390453,
+     0.088430555064290872, 7.329685983118589e-05},
+    {0.096290712344835994, 0.0081195401245440155,
+     0.017980896043796379, -0.070310562529998497},
+    {0.027981471816221321, -0.060189700404070665,
+     -0.13045526292853757, -0.21863786965042339},
+    {-0.0016892610787983611, -0.089860433299090353,
+     -0.099073714806722682, -0.18733734188733947},
+    {0.019568483407208785, -0.068602688813083207,
+     -0.16965695153925192, -0.25785462972912526},
+    {-0.015835830002261048, -0.10400700222255302,
+     -0.14222850249727043, -0.23055820453351744},
+    {0.07087752438883313, -0.017293647831458859,
+     -0.1188645481727405, -0.20706737484487536},
+    {0.036015222258806552, -0.052155949961485433,
+     -0.093135821598900853, -0.18130986522540452},
+    {0.063610292085571479, -0.024560880134720499,
+     -0.1573530744273817, -0.24554105536649382},
+    {-0.012089151114903461, -0.10026032333519544,
+     -0.019612726085811626, -0.10792319798036713},
+    {-0.036863315393123423, -0.1250344876134154,
+     0.0185835062525532, -0.069877337513699983},
+    {-0.026576929588988461, -0.11474810180928044,
+     -0.061884004015809624, -0.15027576290022332},
+    {-0.051969027582465736, -0.14014019980275771,
+     -0.023624967899240658, -0.11220446489329497},
+    {0.025884014207633404, -0.062287158012658585,
+     -0.015744126187180255, -0.10392990585599329},
+    {0.0085244132557870805, -0.079646758964504905,
+     0.018289687079618994, -0.06993726503217601},
+    {0.012241804016851113, -0.075929368203440872,
+     -0.056874412827877502, -0.14509030789460586},
+    {0.17846277189470267, 0.090291599674410694,
+     -0.012656743594629913, -0.10163001306231938},
+    {0.1368747710850996, 0.048703598864807622,
+     0.0028748359301017587, -0.085677272281255115},
+    {0.18411773767823761, 0.095946565457945637,
+     -0.055801997531264573, -0.14484476405507424},
+    {0.15009419046634698, 0.061923018246055013,
+     -0.038541778003988586, -0.12721070673700421},
+    {0.20816077719590761, 0.11998960497561564,
+     0.014781753144304462, -0.074589692288244205},
+    {0.16516220818489774, 0.07699103596460577,
+     0.030233038014297959, -0.058588380204261221},
+    {0.22091169993808676, 0.13274052771779479,
+     -0.028624817191757794, -0.11819262417404679},
+    {0.080700981841136721, -0.0074701903791552574,
+     0.052832608454887908, -0.035397701781822666},
+    {0.036062383594220274, -0.052108788626071711,
+     0.053409993049383681, -0.034764017114615409},
+    {0.096290712344835994, 0.0081195401245440155,
+     0.017980896043796379, -0.070310562529998497},
+    {0.052955568551625795, -0.03521560366866619,
+     0.018090943529082873, -0.070083697308434625},
+    {0.10899788119768244, 0.020826708977390453,
+     0.088430555064290872, 7.329685983118589e-05},
+    {0.064280548987787928, -0.023890623232504068,
+     0.089404080431442226, 0.001214925443047514},
+    {0.1231568747631151, 0.03498570254282312,
+     0.045240234375901515, -0.043207292664295155},
+    {0.14565631518903202, 0.057485142968740043,
+     -0.12669158858796262, -0.21531953803407464},
+    {0.1127120114002485, 0.02454083917995651,
+     -0.10745606839170685, -0.19583527369190817},
+    {0.14305197703133449, 0.054880804811042488,
+     -0.1722452865604629, -0.26085001745812286},
+    {0.10660288443014396, 0.018431712209851965,
+     -0.14523882298156487, -0.23358258090735357},
+    {0.18233126229363789, 0.094160090073345915,
+     -0.10085545657824094, -0.18987594873324362},
+    {0.14800307787689931, 0.05983190565660735,
+     -0.082076118881565935, -0.17072551606693659},
+    {0.18021443457448852, 0.092043262354196548,
+     -0.14698198745640326, -0.23597646828165766},
+    {0.057380284705695443, -0.030790887514596545,
+     2.8115919588310843, 2.7234129939531662},
+    {0.048650352143285246, -0.039520820077006739,
+     2.8575022171229225, 2.7693301262793764},
+    {0.018128209549724134, -0.070042962670567852,
+     2.7797098547019563, 2.6915089699159194},
+    {0.010038201208510546, -0.078132971011781432,
+     2.8266233138846513, 2.7384010118805113},
+    {0.10558675336040749, 0.017415581140115495,
+     2.7963669657642067, 2.7080287813054604},
+    {0.095913079811916102, 0.0077419075916241309,
+     2.8429983279514937, 2.7547086052401384},
+    {0.066403340360759872, -0.021767831859532107,
+     2.7639754589958163, 2.6757823239737895},
+    {0.07737942799939454, -0.010791744220897431,
+     2.9308354236539058, 2.8426153608665192},
+    {0.06860268881308304, -0.019568483407208945,
+     2.971935702050541, 2.8837380238606678},
+    {0.040253136523914754, -0.047918035696377224,
+     2.9016135175408757, 2.8134416978020886},
+    {0.032217185268847919, -0.055953986951444067,
+     2.9438681462749501, 2.8556907638413098},
+    {0.12338891100191826, 0.035217738781626283,
+     2.9176084853582185, 2.8291593297339541},
+    {0.11353539586977518, 0.025364223649483202,
+     2.9594424011040901, 2.8710581637550479},
+    {0.086494837602353075, -0.0016763346179389169,
+     2.8878442108690092, 2.7995936892925175},
+    {-0.068637079913534571, -0.15680825213382654,
+     2.7634441300999089, 2.6747098076874853},
+    {-0.0751776984644906, -0.1633488706847826,
+     2.8106011312833767, 2.7217991596078162},
+    {-0.10822968873988975, -0.19640086096018172,
+     2.7312507018064958, 2.6420467654596758},
+    {-0.11430686189688929, -0.20247803411718127,
+     2.7792878124260421, 2.689998932720532},
+    {-0.02161728929215765, -0.10978846151244964,
+     2.747407466859864, 2.6590456400762661},
+    {-0.029133694669885836, -0.11730486689017783,
+     2.7952535845720705, 2.7068455376470899},
+    {-0.061611587685958175, -0.14978275990625017,
+     2.714744888748835, 2.6260788939782103},
+    {-0.042881673805063601, -0.13105284602535558,
+     2.8859140070541036, 2.7974083481170142},
+    {-0.04909817949545129, -0.13726935171574328,
+     2.9285563540615316, 2.8400009873579579},
+    {-0.081229042575551552, -0.16940021479584352,
+     2.8560887386541634, 2.7672206980847154},
+    {-0.086796534981857687, -0.17496770720214966,
+     2.899816122545134, 2.810884330485774},
+    {0.0023213814150065751, -0.085849790805285403,
+     2.8718084004525832, 2.7835602760763254},
+    {-0.0050016851916332497, -0.093172857411925242,
+     2.9151848461307837, 2.8269073402820104},
+    {-0.036225935120068477, -0.12439710734036047,
+     2.8414569510011969, 2.7530006631844746},
+    {0.16502801021482574, 0.076856837994533772,
+     2.7319562509157693, 2.6431362821589781},
+    {0.15441775907123217, 0.066246586850940203,
+     2.7809522434119125, 2.6922416734672638},
+    {0.12545213742146388, 0.037280965201171905,
+     2.6982096003182243, 2.6097457514750633},
+    {0.11545663326458425, 0.027285461044292268,
+     2.7480558422017292, 2.6596596280494027},
+    {0.21483957669626208, 0.12666840447597011,
+     2.7156816264377586, 2.626209250735549},
+    {0.20361315934415511, 0.11544198712386314,
+     2.7653514222926661, 2.6760462927775523},
+    {0.17563217414174331, 0.087461001921451342,
+     2.6814706205741636, 2.5925310296150839},
+    {0.18112423376752249, 0.092953061547230514,
+     2.859718193946108, 2.7707125843486367},
+    {0.17004509581321356, 0.081873923592921588,
+     2.9041879508410484, 2.8153126716776451},
+    {0.14389065742496632, 0.055719485204674318,
+     2.8282994479862023, 2.7396873069070251},
+    {0.13352544241085484, 0.045354270190562866,
+     2.8738786209453613, 2.78535360731113},
+    {0.22905301342516787, 0.1408818412048759,
+     2.8453640377787304, 2.75566276289599},
+    {0.21712878597546334, 0.12895761375517137,
+     2.8905741117076333, 2.8010661695398227},
+    {0.19234226825811784, 0.10417109603782587,
+     2.8134080316401149, 2.7242589017967167},
+    {0.035291063266422673, -0.052880108953869305,
+     2.6812033404100379, 2.5930287583405072},
+    {0.026560059120083541, -0.061611113100208441,
+     2.731184822127076, 2.6430001075461775},
+    {-0.0054164651350863888, -0.093587637355378367,
+     2.6473888527095921, 2.5591095404184463},
+    {-0.01369992159248596, -0.10187109381277795,
+     2.6980595577061264, 2.6097409713508855},
+    {0.085113689991811708, -0.0030574822284802766,
+     2.6641848461894124, 2.5759394123835024},
+    {0.075668510394123922, -0.012502661826168063,
+     2.7147832268440468, 2.6265680618005596},
+    {0.044267294302795197, -0.043903877917496788,
+     2.6299588708663522, 2.5417876971904483},
+    {0.044423849948355569, -0.043747322271936409,
+     -2.305702895836323, -2.3938740731009953},
+    {0.014489752290477581, -0.073681419929814404,
+     -2.2697890241325727, -2.3579988256057405},
+    {0.025632635003520341, -0.062538537216771634,
+     -2.3526513025851772, -2.4408374885804589},
+    {-0.0042421495051595745, -0.092413321725451553,
+     -2.3155606360185801, -2.4038348735085875},
+    {0.093981579525800385, 0.005810407305508393,
+     -2.2955564772850594, -2.3838375193977224},
+    {0.062876432521369457, -0.025294739698922538,
+     -2.2595837889750294, -2.3477705299259313},
+    {0.075464387491547241, -0.012706784728744737,
+     -2.3429052590104065, -2.4311198570008039},
+    {0.0041778216962018097, -0.083993350524090182,
+     -2.1916810245639158, -2.2799224554188329},
+    {-0.023265405197824419, -0.11143657741811641,
+     -2.1597472881424422, -2.2481188181320397},
+    {-0.014236157765818519, -0.10240732998611049,
+     -2.2351857534369, -2.3235070923256655},
+    {-0.041684532346223248, -0.12985570456651524,
+     -2.201901146631922, -2.2903976321306327},
+    {0.050910882749844316, -0.037260289470447669,
+     -2.1812106586749929, -2.2693838846478158},
+    {0.022196878573341267, -0.065974293646950719,
+     -2.1493291222506308, -2.2375214207767877},
+    {0.032911576737392402, -0.055259595482899583,
+     -2.2249572151580352, -2.3131338921242204},
+    {-0.042121130065077943, -0.13029230228536992,
+     -2.4092353765577919, -2.4977351926978066},
+    {-0.070702581046412055, -0.15887375326670403,
+     -2.3712761164296468, -2.4600313809086756},
+    {-0.060989758380596441, -0.14916093060088842,
+     -2.4567510831783861, -2.545411246050302},
+    {-0.089497544321248179, -0.17766871654154015,
+     -2.4179491336898438, -2.5069128809605128},
+    {0.0066339016520603408, -0.081537270568231651,
+     -2.4002398663795828, -2.488472910466013},
+    {-0.023157909191453031, -0.11132908141174502,
+     -2.3621048177318467, -2.4504757074609178},
+    {-0.012431156643020871, -0.10060232886331286,
+     -2.448262768449716, -2.5365749439557517},
+    {-0.079211951942585707, -0.16738312416287771,
+     -2.2893853430700304, -2.3782309884970587},
+    {-0.10532611988017168, -0.19349729210046365,
+     -2.2548730248146001, -2.3440375955323463},
+    {-0.098076003117633592, -0.18624717533792556,
+     -2.3344468126900666, -2.4235165157839034},
+    {-0.12417333976274847, -0.21234451198304044,
+     -2.2987934605308502, -2.3882276372237219},
+    {-0.03293696582465875, -0.12110813804495074,
+     -2.2797201058777703, -2.3681534627159331},
+    {-0.060372360099305994, -0.14854353231959799,
+     -2.2451551728627388, -2.3338095800641554},
+    {-0.051803049879298894, -0.13997422209959087,
+     -2.3251387654027242, -2.4137168470639629},
+    {0.17728598600787665, 0.089114813787584679,
+     -2.3224970305124191, -2.4114562088936071},
+    {0.14419133934291584, 0.056020167122623858,
+     -2.2851129300134625, -2.3737277432568762},
+    {0.15907849946514641, 0.070907327244854435,
+     -2.3714506313301431, -2.4602079928947456},
+    {0.12610223470543902, 0.037931062485147028,
+     -2.3328568812014776, -2.4213254387417509},
+    {0.22873756605464907, 0.1405663938343571,
+     -2.3118173800908206, -2.4015133653876992},
+    {0.19479308588410144, 0.10662191366380946,
+     -2.2743645657433835, -2.3635466072151252},
+    {0.21110562743972397, 0.122934455219432,
+     -2.3612184851904172, -2.4506339136473589},
+    {0.12942908861709224, 0.041257916396800244,
+     -2.2036952593885504, -2.2921885069289969},
+    {0.098314756484495225, 0.01014358426420324,
+     -2.170484274449958, -2.2587852527417756},
+    {0.11200452943540498, 0.023833357215112989,
+     -2.2490966554782523, -2.3374715853714529},
+    {0.080873394004508575, -0.0072977782157834167,
+     -2.214462516378803, -2.3026933851720823},
+    {0.17834095635910552, 0.090169784138813547,
+     -2.1926498135249779, -2.2816216184229972},
+    {0.14617088750373056, 0.057999715283438578,
+     -2.1594967969326184, -2.2481294065354769},
+    {0.16163355695689072, 0.073462384736598746,
+     -2.2383205837102831, -2.3271044365384284},
+    {0.088437877498662304, 0.00026670527837031194,
+     -2.4304025801534443, -2.5186605454027076},
+    {0.056574916050057211, -0.031596256170234774,
+     -2.3909511789995372, -2.4791292282847417},
+    {0.069132772260156974, -0.019038399960135011,
+     -2.4797601435635941, -2.567958980616377},
+    {0.037449626532321284, -0.050721545687970708,
+     -2.4394839740692111, -2.527657087676209},
+    {0.14028536327243957, 0.052114191052147603,
+     -2.4210068808265932, -2.5095876177029011},
+    {0.10747520205819283, 0.019304029837900853,
+     -2.3813582667787649, -2.4697068826912929},
+    {0.12104087585170903, 0.032869703631417051,
+     -2.4709301490582001, -2.5593630470434499},
+    {0.043747322271936465, -0.044423849948355514,
+     0.83588975775346974, 0.74771858048879791},
+    {0.062538537216771634, -0.025632635003520341,
+     0.78894135100461615, 0.70075516500933421},
+    {0.073681419929814432, -0.014489752290477553,
+     0.87180362945722056, 0.78359382798405275},
+    {0.092413321725451608, 0.00424214950515963,
+     0.82603201757121336, 0.73775778008120529},
+    {-0.0058104073055082819, -0.093981579525800274,
+     0.84603617630473382, 0.75775513419207041},
+    {0.012706784728744765, -0.075464387491547213,
+     0.79868739457938676, 0.7104727965889891},
+    {0.025294739698922594, -0.062876432521369402,
+     0.88200886461476347, 0.79382212366386184},
+    {0.050721545687970729, -0.037449626532321256,
+     0.7021086795205822, 0.61393556591358367},
+    {0.069936217350272542, -0.018234954870019443,
+     0.65331263120062799, 0.56511199035583737},
+    {0.081537270568231651, -0.0066339016520603408,
+     0.74135278721021036, 0.65311974312377985},
+    {0.10060232886331286, 0.012431156643020871,
+     0.69332988514007654, 0.60501770963404178},
+    {-0.000266705278370305, -0.088437877498662276,
+     0.71119007343634888, 0.62293210818708522},
+    {0.019038399960135011, -0.069132772260156974,
+     0.66183251002619869, 0.57363367297341628},
+    {0.031596256170234802, -0.056574916050057183,
+     0.75064147459025632, 0.66246342530505098},
+    {0.14854353231959794, 0.060372360099305973,
+     0.89643748072705398, 0.80778307352563827},
+    {0.16738312416287771, 0.079211951942585707,
+     0.85220731051976251, 0.76336166509273418},
+    {0.17467036127232263, 0.086499189052030662,
+     0.92971527242653196, 0.8407869571806762},
+    {0.19349729210046371, 0.10532611988017174,
+     0.88671962877519306, 0.79755505805744686},
+    {0.10240732998611055, 0.014236157765818575,
+     0.90640690015289294, 0.81808556126412713},
+    {0.1211081380449508, 0.032936965824658805,
+     0.8618725477120226, 0.77343919087386004},
+    {0.12985570456651527, 0.041684532346223289,
+     0.93969150695787096, 0.85119502145916071},
+    {0.158873753266704, 0.070702581046412027,
+     0.77031653716014659, 0.68156127268111732},
+    {0.17766871654154021, 0.089497544321248235,
+     0.72364351989994902, 0.63467977262928021},
+    {0.18624717533792556, 0.098076003117633592,
+     0.80714584089972674, 0.71807613780588975},
+    {0.20500168185732628, 0.11683050963703431,
+     0.76141680374866993, 0.67209163235091252},
+    {0.11132908141174502, 0.023157909191453031,
+     0.77948783585794612, 0.6911169461288752},
+    {0.13029230228536998, 0.042121130065077998,
+     0.7323572770320016, 0.64385746089198637},
+    {0.1399742220995909, 0.051803049879298922,
+     0.81645388818706854, 0.72787580652583028},
+    {-0.073462384736598718, -0.16163355695689069,
+     0.90327206987950992, 0.81448821705136465},
+    {-0.056020167122623782, -0.14419133934291578,
+     0.85647972357633095, 0.76786491033291659},
+    {-0.041257916396800202, -0.12942908861709218,
+     0.93789739420124285, 0.84940414666079567},
+    {-0.023833357215112948, -0.11200452943540493,
+     0.89249599811154046, 0.80412106821833984},
+    {-0.12333626723601362, -0.2115074394563056,
+     0.91434328928064634, 0.82492179603808247},
+    {-0.10662191366380944, -0.19479308588410141,
+     0.8672280878464097, 0.77804604637466757},
+    {-0.090169784138813491, -0.17834095635910546,
+     0.94894284006481511, 0.85997103516679563},
+    {-0.070907327244854323, -0.15907849946514629,
+     0.77014202225965012, 0.68138466069504766},
+    {-0.052114191052147547, -0.14028536327243951,
+     0.72058577276319991, 0.63200503588689227},
+    {-0.037931062485146931, -0.12610223470543891,
+     0.80873577238831507, 0.72026721484804268},
+    {-0.019304029837900825, -0.1074752020581928,
+     0.76023438681102851, 0.67188577089849988},
+    {-0.12293445521943197, -0.21110562743972394,
+     0.7803741683993759, 0.6909587399424344},
+    {-0.10454496384556275, -0.19271613606585472,
+     0.73030689517606406, 0.64115278090473193},
+    {-0.089114813787584651, -0.17728598600787662,
+     0.81909562307737449, 0.73013644469618555},
+    {0.037260289470447808, -0.050910882749844177,
+     0.96038199491479992, 0.87220876894197719},
+    {0.055259595482899611, -0.032911576737392374,
+     0.91663543843175788, 0.82845876146557296},
+    {0.065974293646950843, -0.022196878573341131,
+     0.9922635313391619, 0.90407123281300539},
+    {0.08399335052409021, -0.0041778216962017611,
+     0.94991162902587734, 0.86167019817096047},
+    {-0.010143584264203184, -0.098314756484495169,
+     0.97110837913983572, 0.88280740084801723},
+    {0.0072977782157835347, -0.080873394004508437,
+     0.92713013721098947, 0.83889926841771079},
+    {0.01977966668322061, -0.068391505537071379,
+     1.0029213005628903, 0.91472407714793114},
+    {0.03079088751459674, -0.057380284705695249,
+     -0.33000069475870919, -0.41817965963662684},
+    {0.070042962670567616, -0.018128209549724376,
+     -0.36188279888783703, -0.45008368367387375},
+    {0.039520820077006961, -0.048650352143285024,
+     -0.28409043646687077, -0.37226252731041692},
+    {0.07813297101178146, -0.010038201208510511,
+     -0.31496933970514152, -0.4031916417092819},
+    {-0.017415581140115675, -0.10558675336040765,
+     -0.3452256878255861, -0.43356387228433285},
+    {0.021767831859532145, -0.066403340360759844,
+     -0.37761719459397641, -0.46581032961600372},
+    {-0.0077419075916242419, -0.095913079811916213,
+     -0.29859432563830002, -0.38688404834965462},
+    {0.10187109381277809, 0.013699921592486099,
+     -0.44353309588366674, -0.53185168223890777},
+    {0.14228815457187532, 0.054116982351583347,
+     -0.47692457526460613, -0.56552261268712456},
+    {0.10978846151244967, 0.021617289292157678,
+     -0.39418518672992892, -0.48254701351352719},
+    {0.14978275990624995, 0.061611587685957987,
+     -0.42684776484095821, -0.51551375961158263},
+    {0.052880108953869125, -0.035291063266422854,
+     -0.46038931317975562, -0.54856389524928573},
+    {0.093587637355378228, 0.0054164651350862361,
+     -0.49420380088020044, -0.58248311317134693},
+    {0.061611113100208219, -0.026560059120083763,
+     -0.41040783146271714, -0.4985925460436153},
+    {0.093172857411925075, 0.0050016851916330832,
+     -0.22640780745900921, -0.31468531330778293},
+    {0.13105284602535525, 0.042881673805063254,
+     -0.25567864653568934, -0.34418430547277873},
+    {0.10009135434302399, 0.01192018212273202,
+     -0.18488685889792111, -0.27319649295392745},
+    {0.13726935171574356, 0.049098179495451567,
+     -0.21303629952826159, -0.30159166623183492},
+    {0.047918035696377474, -0.040253136523914504,
+     -0.23997913604891702, -0.32815095578770487},
+    {0.085849790805285459, -0.0023213814150065265,
+     -0.26978425313721011, -0.35803237751346773},
+    {0.05595398695144433, -0.032217185268847655,
+     -0.19772450731484287, -0.2859018897484833},
+    {0.16334887068478277, 0.075177698464490794,
+     -0.33099152230641626, -0.41979349398197718},
+    {0.20247803411718088, 0.11430686189688891,
+     -0.36230484116375083, -0.45159372086926108},
+    {0.16940021479584302, 0.081229042575551053,
+     -0.28550391493562993, -0.37437195550507757},
+    {0.20800403907151283, 0.11983286685122085,
+     -0.31584561536357264, -0.40521474275416786},
+    {0.11730486689017755, 0.029133694669885558,
+     -0.34633906901772221, -0.43474711594270327},
+    {0.15680825213382649, 0.068637079913534488,
+     -0.37814852348988426, -0.46688284590230777},
+    {0.12439710734036002, 0.036225935120068033,
+     -0.30013570258859612, -0.38859199040531822},
+    {-0.10417109603782615, -0.19234226825811812,
+     -0.32818462194967823, -0.41733375179307719},
+    {-0.066246586850940342, -0.15441775907123231,
+     -0.36064041017788129, -0.44935098012252916},
+    {-0.092953061547230709, -0.18112423376752268,
+     -0.28187445964368524, -0.3708800692411563},
+    {-0.05571948520467445, -0.14389065742496643,
+     -0.31329320560359081, -0.40190534668276839},
+    {-0.152840368727686, -0.24101154094797797,
+     -0.34326646927096804, -0.43317534039125161},
+    {-0.11544198712386325, -0.20361315934415522,
+     -0.37624123129712678, -0.46554636081224127},
+    {-0.14088184120487582, -0.22905301342516779,
+     -0.29622861581106275, -0.38592989069380335},
+    {-0.037280965201171933, -0.12545213742146391,
+     -0.44338305327156857, -0.53184690211472985},
+    {0.0030574822284803946, -0.085113689991811597,
+     -0.47740780740038075, -0.56565324120629079},
+    {-0.027285461044292282, -0.11545663326458427,
+     -0.3935368113880639, -0.48193302554039058},
+    {0.012502661826168208, -0.075668510394123784,
+     -0.42680942674574684, -0.51502459178923354},
+    {-0.087461001921451426, -0.1756321741417434,
+     -0.46012203301562998, -0.54906162397470903},
+    {-0.047321487838910666, -0.13549266005920266,
+     -0.49458014278334822, -0.58312094795278946},
+    {-0.076856837994533911, -0.16502801021482588,
+     -0.40963640267402407, -0.49845637143081484},
+    {-0.035217738781626325, -0.12338891100191832,
+     -0.22398416823157466, -0.31243332385583888},
+    {0.0016763346179387781, -0.086494837602353214,
+     -0.25374844272078362, -0.34199896429727578},
+    {-0.025364223649483465, -0.11353539586977546,
+     -0.18215025248570321, -0.27053448983474498},
+    {0.010791744220897084, -0.077379427999394901,
+     -0.21075722993588702, -0.29897729272327439},
+    {-0.08187392359292181, -0.17004509581321378,
+     -0.23740470274874437, -0.32627998191214869},
+    {-0.045354270190563074, -0.13352544241085507,
+     -0.26771403264443211, -0.35623904627866282},
+    {-0.071006986563958263, -0.15917815878425023,
+     -0.19483300508949278, -0.28359138878355483},
+    {0.0039276175620194947, -0.08424355465827249,
+     3.0941644799550132, 3.0059221647627195},
+    {0.010417335468014564, -0.077753836752277428,
+     3.0593562767375269, 2.9711351076386427},
+    {0.019155897157785401, -0.069015275062506584,
+     3.1260884677855061, 3.0378898897443389},
+    {0.03900222849220264, -0.049168943728089338,
+     3.0895335498160112, 3.0013612383887778},
+    {-0.027142807267590309, -0.1153139794878823,
+     3.0773034834586097, 2.9889081699216682},
+    {0.010417335468014564, -0.077753836752277428,
+     3.0593562767375269, 2.9711351076386427},
+    {-0.02173170901581966, -0.10990288123611164,
+     3.1186097642070645, 3.0302472716043858},
+    {-0.018431712209852354, -0.10660288443014435,
+     2.996353830608228, 2.9080100726824401},
+    {-0.011920182122731743, -0.10009135434302371,
+     2.9567057946918718, 2.8683961606358661},
+    {0.017293647831458914, -0.070877524388833074,
+     3.0227281054170527, 2.9345252787449176},
+    {0.024560880134720787, -0.063610292085571202,
+     2.9842395791624114, 2.8960515982232997},
+    {-0.057485142968740043, -0.14565631518903202,
+     3.0149010650018306, 2.9262731155557189},
+    {-0.054880804811042877, -0.14305197703133488,
+     2.96934736702933, 2.8807426361316701},
+    {-0.024540839179956468, -0.11271201140024845,
+     3.0341365851980857, 2.9457573798978851},
+    {0.07964675896450471, -0.0085244132557872748,
+     -3.1233029665101735, 3.0716553885576174},
+    {0.10026032333519544, 0.012089151114903461,
+     3.1219799275039817, 3.0336694556094264},
+    {0.097833785290918879, 0.0096626130706268867,
+     -3.0874995815569521, 3.1073870424431034},
+    {0.12503448761341535, 0.036863315393123368,
+     -3.1230091473372394, 3.071715316076093},
+    {0.035215603668666023, -0.052955568551625962,
+     -3.1235017100607099, 3.0715089562813587},
+    {0.062287158012658585, -0.025884014207633404,
+     3.1258485274026127, 3.0376627477338003},
+    {0.052108788626071573, -0.036062383594220412,
+     -3.0881826605404097, 3.1068286364751776},
+    {0.089860433299090353, 0.0016892610787983611,
+     3.0425189387830707, 2.9542553117024535},
+    {0.10400700222255305, 0.015835830002261062,
+     2.9993641510925229, 2.9110344490562761},
+    {0.11474810180928044, 0.026576929588988461,
+     3.079708649573984, 2.9913168906895695},
+    {0.12945728513936869, 0.041286112919076697,
+     3.0363280106834956, 2.9478345496395746},
+    {0.052155949961485433, -0.036015222258806552,
+     3.048456831990892, 2.9602827883643892},
+    {0.060189700404070498, -0.027981471816221487,
+     3.0111373906612555, 2.9229547839393697},
+    {0.075929368203440872, -0.012241804016851106,
+     3.0847182407619158, 2.9965023456951876},
+    {-0.095946565457945582, -0.18411773767823755,
+     3.0857906560585282, 2.9967478895347193},
+    {-0.059831905656607239, -0.1480030778768992,
+     3.0595165347082274, 2.9708671375228564},
+    {-0.090291599674410861, -0.17846277189470283,
+     3.1289359099951635, 3.0399626405274733},
+    {-0.061923018246055013, -0.15009419046634698,
+     3.1030508755858044, 3.0143819468527893},
+    {-0.13163342659616811, -0.21980459881646008,
+     3.0675389554323442, 2.9779888093248554},
+    {-0.094160090073345859, -0.18233126229363783,
+     3.0407371970115529, 2.9517167048565494},
+    {-0.13274052771779485, -0.22091169993808682,
+     3.1129678363980355, 3.0234000294157459},
+    {-0.018431712209852354, -0.10660288443014435,
+     2.996353830608228, 2.9080100726824401},
+    {0.024560880134720787, -0.063610292085571202,
+     2.9842395791624114, 2.8960515982232997},
+    {-0.024540839179956468, -0.11271201140024845,
+     3.0341365851980857, 2.9457573798978851},
+    {0.017293647831458914, -0.070877524388833074,
+     3.0227281054170527, 2.9345252787449176},
+    {-0.054880804811042877, -0.14305197703133488,
+     2.96934736702933, 2.8807426361316701},
+    {-0.011920182122731743, -0.10009135434302371,
+     2.9567057946918718, 2.8683961606358661},
+    {-0.057485142968740043, -0.14565631518903202,
+     3.0149010650018306, 2.9262731155557189},
+    {-0.034985702542823065, -0.12315687476311504,
+     -3.096352419213892, 3.0983853609254983},
+    {-0.0081195401245442098, -0.096290712344836188,
+     -3.123611757545997, 3.0712820910597953},
+    {-0.020826708977390619, -0.10899788119768261,
+     -3.0531620985255024, -3.1415193567299613},
+    {0.0074701903791551186, -0.08070098184113686,
+     -3.0887600451349053, 3.1061949518079706},
+    {-0.076991035964605881, -0.16516220818489785,
+     -3.1113596155754952, 3.0830042733855314},
+    {-0.048703598864807844, -0.13687477108509982,
+     -3.1387178176596917, 3.0559153813085382},
+    {-0.063138278734950426, -0.1513094509552424,
+     -3.0675636852895867, 3.1269411601541206},
+    {-0.03498053243906684, -0.12315170465935882,
+     -0.68920576797691735, -0.77765325878481806},
+    {0.006945576827711894, -0.081225595392580091,
+     -0.72421483734291758, -0.81244685532185845},
+    {-0.025600601765735649, -0.11377177398602764,
+     -0.6353881099697497, -0.723773803101602},
+    {0.016187134503079442, -0.07198403771721254,
+     -0.67049660567811886, -0.75870210188182441},
+    {-0.086120054610046903, -0.17429122683033887,
+     -0.70795110833504227, -0.79687500222597119},
+    {-0.044131869935981206, -0.1323030421562732,
+     -0.74309946755273859, -0.83161484393267371},
+    {-0.076810102581472361, -0.16498127480176433,
+     -0.65388598078109406, -0.7427054451389784},
+    {0.039493146921006174, -0.048678025299285811,
+     -0.81199952534313524, -0.90017162735855083},
+    {0.080551782144918704, -0.0076193900753732668,
+     -0.8456095761021194, -0.93383940510525654},
+    {0.048668734721784783, -0.039502437498507195,
+     -0.75883197604464847, -0.84700407430185587},
+    {0.089899430939614861, 0.0017282587193228685,
+     -0.79298192742465567, -0.88124571224318493},
+    {-0.011058408392638636, -0.099229580612930607,
+     -0.83096886629993361, -0.91927426668660084},
+    {0.030436442738272458, -0.057734729482019527,
+     -0.86455227282842662, -0.9527316587919733},
+    {-0.0021619666356256645, -0.09033313885591765,
+     -0.77780711628728649, -0.86607266445650388},
+    {0.034746699099772418, -0.05342447312051956,
+     -0.56391157727292074, -0.65208659454898255},
+    {0.076120481970078258, -0.012050690250213721,
+     -0.59861788522311188, -0.68683431894866698},
+    {0.043903877917496649, -0.044267294302795336,
+     -0.51163378272344096, -0.59980495639934484},
+    {0.084984797923641525, -0.003186374296650446,
+     -0.54598163625835527, -0.63422660387847507},
+    {-0.016076713693494081, -0.10424788591378606,
+     -0.58195562865250727, -0.67028660975710375},
+    {0.025481463569701716, -0.062689708650590259,
+     -0.61696130604942512, -0.70514773908155026},
+    {-0.0064956450306888, -0.094666817250980778,
+     -0.52920435194387239, -0.61748843577797585},
+    {0.10837198190900599, 0.020200809688713996,
+     -0.68649809785554061, -0.77485177863339882},
+    {0.14912717276770002, 0.060956000547408039,
+     -0.72086534470419517, -0.80952519197733885},
+    {0.11733550997581105, 0.029164337755519056,
+     -0.63323973212394036, -0.72164797780412104},
+    {0.15810701505451835, 0.06993584283422638,
+     -0.66769516800596285, -0.75644261320227879},
+    {0.057885254142399853, -0.030285918077892132,
+     -0.70534296912981265, -0.79352253727138533},
+    {0.099200149799917703, 0.011028977579625725,
+     -0.73984632474135892, -0.82815158170734837},
+    {0.067062301605021385, -0.021108870615270593,
+     -0.65183668311986809, -0.74003113454031832},
+    {-0.17833243553290873, -0.2665036077532007,
+     -0.69104884588549875, -0.78144679874854439},
+    {-0.13691087194066776, -0.22508204416095973,
+     -0.72672032845240631, -0.81635571178748834},
+    {-0.16895555772035442, -0.25712672994064639,
+     -0.636662670975919, -0.72687328539181795},
+    {-0.1278258548457529, -0.21599702706604487,
+     -0.67244322753466668, -0.76193352390065716},
+    {-0.22803102509786266, -0.31620219731815469,
+     -0.70969252801368254, -0.80123196986740863},
+    {-0.18704377851176568, -0.27521495073205765,
+     -0.74550193448543556, -0.83608177834363062},
+    {-0.21900641524400599, -0.30717758746429802,
+     -0.65505614473611029, -0.74636936217847838},
+    {-0.10345698348497134, -0.19162815570526331,
+     -0.81566967989238137, -0.90480932531837455},
+    {-0.061443070955104012, -0.14961424317539601,
+     -0.84987605523553167, -0.93854046608994046},
+    {-0.095026311483603743, -0.18319748370389571,
+     -0.76198345667999279, -0.85101471229424375},
+    {-0.052975879675695829, -0.14114705189598781,
+     -0.79675745266288189, -0.88534558861157941},
+    {-0.15330033281590003, -0.241471505036192,
+     -0.83453152487459403, -0.924448657039452},
+    {-0.11135413263829455, -0.19952530485858652,
+     -0.86870832142477639, -0.95795549763460497},
+    {-0.14542270888440526, -0.23359388110469723,
+     -0.78085430451711557, -0.87063278269366384},
+    {-0.10825717612753197, -0.19642834834782394,
+     -0.56472801404467687, -0.65393232681652913},
+    {-0.067179474504678649, -0.15535064672497062,
+     -0.6001025559355575, -0.68882233342653088},
+    {-0.097961775936033696, -0.18613294815632567,
+     -0.5118981881500253, -0.60096643564783347},
+    {-0.057318659133734802, -0.14548983135402677,
+     -0.54690560131608112, -0.63553204815237874},
+    {-0.15899788162661485, -0.24716905384690682,
+     -0.58266255428136116, -0.67268372188034997},
+    {-0.11824468789946815, -0.20641586011976013,
+     -0.61834162320318853, -0.70768739314831441},
+    {-0.14855811156500556, -0.23672928378529753,
+     -0.52935421625516255, -0.61918716157975973},
+    {-0.039335662245762897, -0.12750683446605487,
+     0.21249582863621497, 0.12401696808816211},
+    {-0.019411058032935254, -0.10758223025322725,
+     0.17004176211014838, 0.081692545484301951},
+    {-0.0091798272527918723, -0.097350999473083843,
+     0.25310101919577715, 0.1648046191265265},
+    {0.010251105029365444, -0.077920067190926534,
+     0.20959636995738343, 0.12137470570382194},
+    {-0.089830433599112469, -0.17800160581940444,
+     0.21558571918826458, 0.12661798703462973},
+    {-0.068814650035318087, -0.15698582225561006,
+     0.17246102539346894, 0.083724917863107901},
+    {-0.059838814136672434, -0.14800998635696441,
+     0.25668781652437761, 0.16803835546430426},
+    {-0.028649713402243766, -0.11682088562253576,
+     0.091708541576863423, 0.003303622692174539},
+    {-0.009662613070627081, -0.097833785290919073,
+     0.054093072032841173, -0.034205611146689956},
+    {-0.00015968042584830339, -0.088330852646140295,
+     0.12936906302630383, 0.041111516487190219},
+    {0.018347674021312155, -0.06982349819897983,
+     0.090494070823032763, 0.0022936864788642569},
+    {-0.076534813520738348, -0.16470598574103035,
+     0.093055444301323731, 0.0042389469886869174},
+    {-0.056316565220540231, -0.14448773744083221,
+     0.054888988132396135, -0.033728467204327359},
+    {-0.048390046120926906, -0.1365612183412189,
+     0.13116248412390502, 0.042612955265842592},
+    {0.070912882762784596, -0.017258289457507396,
+     0.29028589197529769, 0.20208298167170274},
+    {0.088765151758376931, 0.00059397953808493914,
+     0.2465257664089878, 0.15826651447728304},
+    {0.10151679963431301, 0.013345627414021038,
+     0.33117358133443708, 0.24285679956699302},
+    {0.11896892141165527, 0.030797749191363293,
+     0.2866217382549906, 0.19820277657883437},
+    {0.02146523007103034, -0.066705942149261649,
+     0.29415271379197655, 0.2059589790263027},
+    {0.040422958268170384, -0.047748213952121601,
+     0.24971751064212491, 0.16154574701732391},
+    {0.05239455957173203, -0.035776612648559955,
+     0.33551820203673799, 0.24734398610234754},
+    {0.076274216116105825, -0.01189695610418616,
+     0.16569465792080207, 0.077477788548604709},
+    {0.093044780196154642, 0.0048736079758626705,
+     0.12620830343348582, 0.037931352300619017},
+    {0.10587875140110717, 0.017707579180815197,
+     0.20432621195071504, 0.11598643529757413},
+    {0.12220277234268467, 0.034031600122392681,
+     0.16374727948477891, 0.075306398295955868},
+    {0.029015736054747561, -0.059155436165544424,
+     0.16778956021338226, 0.079608375192240899},
+    {0.047042155680318658, -0.04112901653997332,
+     0.12772063038651196, 0.039549072799322751},
+    {0.058716768568899451, -0.029454403651392534,
+     0.20687672240044494, 0.11869611187073772},
+    {-0.16336094835723122, -0.25153212057752322,
+     0.26451672357068928, 0.17441374537608154},
+    {-0.14099377589439621, -0.22916494811468818,
+     0.21887648448130342, 0.12917333032367723},
+    {-0.13313782240694733, -0.2213089946272393,
+     0.30709199678669485, 0.21751782354646099},
+    {-0.11131916118894919, -0.19949033340924116,
+     0.26048932265113633, 0.1712426354728416},
+    {-0.21568636823012499, -0.30385754045041702,
+     0.26878085683438069, 0.17754871668107264},
+    {-0.19256590897913667, -0.28073708119942864,
+     0.2223782745215877, 0.13167918034150922},
+    {-0.18591216832680779, -0.27408334054709982,
+     0.31189160899649421, 0.22133582283208789},
+    {-0.14712470336464847, -0.23529587558494044,
+     0.13521924661432883, 0.045411319719324952},
+    {-0.12510791653723011, -0.21327908875752208,
+     0.094542566070552975, 0.0050941502133418567},
+    {-0.11897674483940737, -0.20714791705969934,
+     0.17505698043261081, 0.08570047359913098},
+    {-0.097451715965178515, -0.18562288818547049,
+     0.13310968272104787, 0.044047920153814805},
+    {-0.19717151701388011, -0.28534268923417205,
+     0.13749946350130415, 0.046698550721906172},
+    {-0.17415064486400547, -0.26232181708429747,
+     0.096177433394524448, 0.005864104684505031},
+    {-0.16965710245303442, -0.25782827467332642,
+     0.17783901371774938, 0.087614684580784391},
+    {-0.049635311628873142, -0.13780648384916511,
+     0.34489614422140724, 0.25633631927246481},
+    {-0.029181663054093844, -0.11735283527438584,
+     0.2982345121324369, 0.20982615404089361},
+    {-0.01803737365018563, -0.10620854587047762,
+     0.38739759265733248, 0.29905600858802633},
+    {0.0019390291529207473, -0.086232143067371231,
+     0.34008805789061569, 0.25183851701874616},
+    {-0.10208046396647064, -0.19025163618676261,
+     0.34995535667827671, 0.26083385945665061},
+    {-0.080801346958956383, -0.16897251917924838,
+     0.30254356876049993, 0.21368030791330725},
+    {-0.070399296236349274, -0.15857046845664124,
+     0.39295178466772984, 0.30419961952356023},
+    {-0.043037942645810574, -0.13120911486610257,
+     1.1599282568831144, 1.0714213909912382},
+    {-0.04991928647109211, -0.13809045869138409,
+     1.2102658207604111, 1.1217036282876049},
+    {-0.080994521953497656, -0.16916569417378963,
+     1.1264945734009273, 1.0376291557987396},
+    {-0.088449636486065131, -0.1766208087063571,
+     1.177179847601227, 1.0882285777345018},
+    {0.00077746176385650595, -0.087393710456435486,
+     1.1435082799853369, 1.0552543564516492},
+    {-0.0056694715101967968, -0.093840643730488782,
+     1.1926060376542891, 1.1043256159801031},
+    {-0.036067110564772124, -0.1242382827850641,
+     1.1105575808786909, 1.0221024226629862},
+    {-0.018441033103145647, -0.10661220532343763,
+     1.29293133796094, 1.2045875284846956},
+    {-0.024662289834051616, -0.11283346205434361,
+     1.3436745272146227, 1.2552945834815716},
+    {-0.056650294289530133, -0.14482146650982211,
+     1.2613375394459048, 1.1727170997405658},
+    {-0.063171122173277416, -0.15134229439356939,
+     1.3128886715260202, 1.224207896241702},
+    {0.024828722713412108, -0.063342449506879867,
+     1.2738267165841306, 1.1856391937212021},
+    {0.018753414971170588, -0.069417757249121387,
+     1.3235523550090662, 1.2353528846688031},
+    {-0.012092877525234517, -0.1002640497455265,
+     1.2424917174733734, 1.1541812270726894},
+    {-0.16668517942906244, -0.25485635164935444,
+     1.1085954762878623, 1.0184289135731532},
+    {-0.17527925726490398, -0.26345042948519592,
+     1.1609494837689025, 1.070613487304706},
+    {-0.20587364220520693, -0.2940448144254989,
+     1.0732039683424712, 0.98220476923833244},
+    {-0.21532326423301507, -0.30349443645330709,
+     1.1257411410454052, 1.0345177983710996},
+    {-0.11931029503915466, -0.20748146725944663,
+     1.0923550716251029, 1.0029936559597299},
+    {-0.12745524226163218, -0.21562641448192416,
+     1.1432734623867695, 1.0537889179994488},
+    {-0.15773876603036399, -0.24590993825065596,
+     1.0575682012029282, 0.96757029690399687},
+    {-0.14278422457435283, -0.2309553967946448,
+     1.2482259449367319, 1.1584925673188475},
+    {-0.14980585995297496, -0.23797703217326693,
+     1.3017276423117561, 1.21187275733849},
+    {-0.1834214462498289, -0.27159261847012084,
+     1.2143857946268291, 1.1238825074004388},
+    {-0.1910180241172835, -0.27918919633757544,
+     1.2686253015600892, 1.177959944515852},
+    {-0.095680932114045714, -0.18385210433433768,
+     1.228789479332085, 1.1397500435049728},
+    {-0.10261776381438173, -0.1907889360346737,
+     1.2810678982693064, 1.1919393381933687},
+    {-0.13530787995206503, -0.223479052172357,
+     1.1953145192134011, 1.105705307260002},
+    {0.048711133913798034, -0.039460038306493951,
+     1.0810023771028836, 0.99283026163253907},
+    {0.042887262307624893, -0.045283909912667092,
+     1.1278707366299261, 1.0396995011035792},
+    {0.01354595539732429, -0.074625216822967688,
+     1.0484960294181196, 0.96028372395164474},
+    {0.0071980518698010407, -0.080973120350490951,
+     1.095410036761217, 1.0071788436881084},
+    {0.088418011696079574, 0.00024683947578759552,
+     1.0672879568023979, 0.97903006935023229},
+    {0.083219803666767289, -0.0049513685535247029,
+     1.1129688865273708, 1.0247301546953291},
+    {0.054377373423394881, -0.033793798796897104,
+     1.0353237839643223, 0.94714794195359042},
+    {0.072236118472591787, -0.015935053747700205,
+     1.207277841396962, 1.1190717219058681},
+    {0.066510229823212474, -0.021660942397079504,
+     1.2555353042736481, 1.1673419583247484},
+    {0.036939288180933082, -0.051231884039358903,
+     1.1757627203091201, 1.0875892966088125},
+    {0.030905656703571031, -0.057265515516720954,
+     1.22448621367847, 1.1363073827729158},
+    {0.11182632240523524, 0.023655150184943262,
+     1.1908247585975973, 1.1024508985936903},
+    {0.10651326228085639, 0.018342090060564399,
+     1.2380181920252054, 1.1496749293720243},
+    {0.077816785465792654, -0.010354386754499331,
+     1.1596902605823589, 1.0714689042640375},
+    {-0.065700567859764497, -0.15387174008005647,
+     1.0287751868717894, 0.9400699694033583},
+    {-0.073387853549993803, -0.1615590257702858,
+     1.076961340725779, 0.9881782690810863},
+    {-0.10248457180022516, -0.19065574402051713,
+     0.99472264466480009, 0.9055958379127047},
+    {-0.11095876692752993, -0.1991299391478219,
+     1.0427778121359923, 0.95353615794625868},
+    {-0.02209134672675505, -0.11026251894704703,
+     1.0155064343784219, 0.92714184141217915},
+    {-0.029066251361457525, -0.11723742358174952,
+     1.0623589865708027, 0.97395137679667787},
+    {-0.057999715283438696, -0.1461708875037307,
+     0.98209585665717458, 0.89346324705431635},
+    {-0.086125219428870331, -0.1742963916491623,
+     1.5184473640533593, 1.4295234100206542},
+    {-0.080940391834195435, -0.16911156405448741,
+     1.4676977364088752, 1.3788329235021715},
+    {-0.045922300560490507, -0.13409347278078249,
+     1.5454800714566217, 1.4569505338048863},
+    {-0.041283711939713801, -0.12945488416000578,
+     1.4947063444157032, 1.4062129015547284},
+    {-0.13089463351594585, -0.21906580573623782,
+     1.5425582221023657, 1.4530197965694727},
+    {-0.12623167448611941, -0.21440284670641138,
+     1.4912002940827258, 1.4017346472126317},
+    {-0.090978478531701767, -0.17914965075199374,
+     1.5692629082940206, 1.4802813549685041},
+    {-0.11535201713418866, -0.20352318935448063,
+     1.386511496216869, 1.2972076590759181},
+    {-0.10919420649397851, -0.19736537871427048,
+     1.3337383971393439, 1.2445212100184535},
+    {-0.075362713332319281, -0.16353388555261128,
+     1.4163439928000916, 1.32754005075932},
+    {-0.069425422869435344, -0.15759659508972731,
+     1.3646495830392553, 1.2759073134764647},
+    {-0.16222107037358194, -0.25039224259387394,
+     1.4092929489288428, 1.3192115241066031},
+    {-0.156303665763979, -0.24447483798427097,
+     1.3555198633477603, 1.2655482852805926},
+    {-0.12104316427097436, -0.20921433649126633,
+     1.4390943273937629, 1.3497072404735844},
+    {0.042400677920558266, -0.045770494299733726,
+     1.5492873103481688, 1.4611160129724701},
+    {0.046280707120856641, -0.041890465099435344,
+     1.4976500921875935, 1.4094787075379986},
+    {0.085969812594709122, -0.0022013596255828632,
+     1.5777602998706526, 1.4895117322453457},
+    {0.089530133480027391, 0.0013589612597354125,
+     1.5252053451989196, 1.4369430487115611},
+    {-0.0043340593746827652, -0.092505231594974757,
+     1.5732683180927549, 1.4849936878264698},
+    {-8.4154490633474299e-05, -0.088255326710925452,
+     1.5215997442598277, 1.4333424925877818},
+    {0.038459644567359216, -0.049711527652932769,
+     1.6017998799903681, 1.5136273123891668},
+    {0.0084813449061826168, -0.079689827314109368,
+     1.4214695460060045, 1.3332424586302274},
+    {0.012725655939103221, -0.075445516281188757,
+     1.3734200754265953, 1.2852055296744103},
+    {0.050070909294299561, -0.038100262925992431,
+     1.447133736808293, 1.3589609852382627},
+    {0.053746376915085291, -0.034424795305206694,
+     1.3979505412796593, 1.3097752543528538},
+    {-0.036529965031629121, -0.12470113725192111,
+     1.4450319241740988, 1.3565734677139711},
+    {-0.030707100362951635, -0.11887827258324363,
+     1.3944617003616935, 1.3060433396381337},
+    {0.0041999783164674495, -0.083971193903824543,
+     1.4709257574945551, 1.3826844046842999},
+    {-0.17950055138285223, -0.26767172360314417,
+     1.6182373547557889, 1.5278154524800658},
+    {-0.17615701994457841, -0.26432819216487036,
+     1.5674728419638522, 1.4771191285208081},
+    {-0.13954636721516633, -0.2277175394354583,
+     1.6443310481852926, 1.5546521018847168},
+    {-0.13502229259114815, -0.22319346481144012,
+     1.5929202922644641, 1.5033157172118332},
+    {-0.22407215708576642, -0.31224332930605836,
+     1.6442965871139406, 1.5528574390318564},
+    {-0.22165014677393902, -0.30982131899423104,
+     1.5931965077474968, 1.5018179049396494},
+    {-0.18221625627595134, -0.27038742849624331,
+     1.6676364311989391, 1.5771583234463984},
+    {-0.21452135471111022, -0.30269252693140225,
+     1.4872970380173689, 1.3960930758328989},
+    {-0.20977809629918898, -0.297949268519481,
+     1.4330246670293643, 1.341933974513505},
+    {-0.17216468434680635, -0.26033585656709834,
+     1.5155568875999894, 1.4252831394640941},
+    {-0.16751648580275932, -0.25568765802305132,
+     1.4627378991339721, 1.3725552656802338},
+    {-0.26177379494543895, -0.34994496716573098,
+     1.5127904772399516, 1.4203279852252828},
+    {-0.25774099341151702, -0.34591216563180904,
+     1.4577346840941865, 1.3653890365333807},
+    {-0.218475553950326, -0.30664672617061794,
+     1.540781214190065, 1.449481037942707},
+    {-0.054671543705381513, -0.14284271592567349,
+     1.6493695826678469, 1.5607666907941007},
+    {-0.050399731350096462, -0.13857090357038843,
+     1.5971207190100765, 1.5085545044726161},
+    {-0.012577797726803244, -0.10074896994709523,
+     1.6785534840028857, 1.5902405748582464},
+    {-0.0085113512615770104, -0.096682523481868982,
+     1.6256784040616166, 1.5373851310690336},
+    {-0.099776692311468046, -0.18794786453176002,
+     1.6728478425224496, 1.583756324413268},
+    {-0.095544643428168763, -0.18371581564846073,
+     1.6208171989702054, 1.5317794694906977},
+    {-0.058696797555083079, -0.14686796977537506,
+     1.7019486830384554, 1.6133097221839736},
+    {-0.086467052102789987, -0.17463822432308196,
+     -2.6402950204156261, -2.7292229603768852},
+    {-0.05655159478142515, -0.14472276700171713,
+     -2.6815020903388276, -2.7701216463760701},
+    {-0.068568627512576336, -0.15673979973286833,
+     -2.5927387221536002, -2.6814723571782602},
+    {-0.038447806903738883, -0.12661897912403086,
+     -2.6339397036570382, -2.7224120310423086},
+    {-0.13448063252956638, -0.22265180474985835,
+     -2.6466278101769332, -2.7362236120286187},
+    {-0.10407104939842807, -0.19224222161872004,
+     -2.6880611336348985, -2.7772089318583997},
+    {-0.11616329409517637, -0.20433446631546834,
+     -2.5987257664925956, -2.6880412847108719},
+    {-0.04385368503451182, -0.13202485725480381,
+     -2.7693463884933363, -2.857859590464082},
+    {-0.013345627414021149, -0.10151679963431312,
+     -2.8104190722553555, -2.8987358540227999},
+    {-0.026068846821297724, -0.1142400190415897,
+     -2.722962316244899, -2.8113509078826655},
+    {0.0047787001173748636, -0.083392472102917115,
+     -2.7645343018785655, -2.8527736315852716},
+    {-0.090929055922188307, -0.17910022814248028,
+     -2.7763631905190596, -2.8653441463475953},
+    {-0.060957112265753649, -0.14912828448604565,
+     -2.8145514014339814, -2.9032112590988297},
+    {-0.074057461900064375, -0.16222863412035635,
+     -2.7282268314280347, -2.8170169396202733},
+    {-0.00091810885262577635, -0.089089281072917748,
+     -2.5371083194915136, -2.6253688550960059},
+    {0.030332508710198127, -0.057838663510093861,
+     -2.5784582561213738, -2.6666377676613364},
+    {0.018234954870019443, -0.069936217350272542,
+     -2.4882800223891652, -2.5764806632339554},
+    {0.049712226696098517, -0.038458945524193461,
+     -2.5291923031398817, -2.6173648710878719},
+    {-0.050175382733731205, -0.1383465549540232,
+     -2.5447355663828857, -2.6332999001867092},
+    {-0.019859887463017999, -0.10803105968330998,
+     -2.5857369637909198, -2.6740887106560614},
+    {-0.03141622877515645, -0.11958740099544843,
+     -2.4965024914403466, -2.584925572909917},
+    {0.042644443017071793, -0.045526729203220186,
+     -2.6693566275193006, -2.7575278913007355},
+    {0.0744091386661003, -0.013762033554191689,
+     -2.7116974986164455, -2.7999092238566701},
+    {0.062135782755934489, -0.026035389464357492,
+     -2.6204278886612808, -2.7086134263388644},
+    {0.094269406034434122, 0.0060982338141421372,
+     -2.6628804925604475, -2.7511628072398469},
+    {-0.0076969138848406032, -0.095868086105132588,
+     -2.6755591205297873, -2.7638486372626718},
+    {0.023480618470391925, -0.06469055374990007,
+     -2.7174571652441952, -2.8056470579594293},
+    {0.011147577576759812, -0.077023594643532173,
+     -2.6273220308877385, -2.7155410537378253},
+    {-0.21546867973788095, -0.30363985195817289,
+     -2.6094679753054799, -2.7006948395372885},
+    {-0.1840581586784184, -0.27222933089871038,
+     -2.6531752431128481, -2.7436918916220359},
+    {-0.1956316179306346, -0.28380279015092658,
+     -2.5603341914147748, -2.6511008211293809},
+    {-0.16507628972233315, -0.25324746194262515,
+     -2.6040152698589121, -2.6941509228138547},
+    {-0.26713639600371708, -0.355307568224009,
+     -2.6150917802124098, -2.7077124413283773},
+    {-0.23501490168918268, -0.32318607390947462,
+     -2.6599484766284642, -2.7516688956855417},
+    {-0.24666375454907172, -0.33483492676936377,
+     -2.5646138204438289, -2.6566477168800562},
+    {-0.17060275120595958, -0.25877392342625155,
+     -2.7454916717596336, -2.8357345645824856},
+    {-0.13880606431718515, -0.22697723653747712,
+     -2.7860108727891806, -2.8756775151980714},
+    {-0.15267920165904469, -0.24085037387933667,
+     -2.6956179700801939, -2.7855239514674799},
+    {-0.12156527392904753, -0.20973644614933951,
+     -2.7367034489130631, -2.8260983260495594},
+    {-0.22098553004400076, -0.3091567022642927,
+     -2.7546087233274479, -2.8459708197806988},
+    {-0.18809527425257141, -0.27626644647286336,
+     -2.7960194697267609, -2.8866217835460537},
+    {-0.20275163592921608, -0.29092280814950811,
+     -2.7034474904361132, -2.7943746598789203},
+    {-0.1269169626383603, -0.21508813485865227,
+     -2.5097671416163667, -2.5992433550027769},
+    {-0.097877665432638372, -0.18604883765293034,
+     -2.552087621087848, -2.6411547975395333},
+    {-0.10804848126046251, -0.19621965348075449,
+     -2.464961272935247, -2.5541627295089611},
+    {-0.079621206491456403, -0.16779237871174837,
+     -2.504440525437611, -2.5932906845494679},
+    {-0.17568639050416623, -0.26385756272445821,
+     -2.5127207321067329, -2.6030649367294676},
+    {-0.14597547737817451, -0.23414664959846648,
+     -2.5561597638088887, -2.6459477756130156},
+    {-0.15580447591270363, -0.2439756481329956,
+     -2.4667632489551106, -2.5567257166577515},
+    {-0.090595803267735503, -0.17876697548802747,
+     -1.0516819642395876, -1.1406588970771447},
+    {-0.049569766891671002, -0.137740939111963,
+     -1.0816601621077773, -1.1702194416367124},
+    {-0.08407533149595986, -0.17224650371625183,
+     -1.0032798017872471, -1.0921800785497242},
+    {-0.043296028203835567, -0.13146720042412754,
+     -1.0339021447527197, -1.1224110087935661},
+    {-0.1378518448555594, -0.22602301707585137,
+     -1.0695913058364366, -1.1592421664917776},
+    {-0.096803571381407216, -0.18497474360169919,
+     -1.1001677284076519, -1.1892212852138662},
+    {-0.1315026119861662, -0.21967378420645817,
+     -1.0212945432569289, -1.1108426102728526},
+    {-0.01256674739674684, -0.10073791961703882,
+     -1.1614353581725061, -1.2497482119662668},
+    {0.030112301185306993, -0.058058871034984992,
+     -1.1920092705860215, -1.2801890513360099},
+    {-0.0079162821315630488, -0.096087454351855034,
+     -1.1117257310076845, -1.2000162536928913},
+    {0.034118065874952169, -0.054053106345339823,
+     -1.1418235767822122, -1.2299991291511558},
+    {-0.06026470631351407, -0.14843587853380605,
+     -1.1814909716628863, -1.2701443788025526},
+    {-0.017200786799935232, -0.10537195902022722,
+     -1.2125541606861034, -1.3008911787680622},
+    {-0.054959909235106151, -0.14313108145539813,
+     -1.1308020230839875, -1.2194074501959171},
+    {-0.027948909656468172, -0.11612008187676015,
+     -0.93486397083778117, -1.0232643974175482},
+    {0.012960658479323848, -0.075210513740968127,
+     -0.96674864316136355, -1.0549625410294932},
+    {-0.019674006098597478, -0.10784517831888946,
+     -0.88341001114111006, -0.97176070793847424},
+    {0.021570932840988891, -0.066600239379303094,
+     -0.91621705768674178, -1.0044105820353975},
+    {-0.077029900734998186, -0.16520107295529016,
+     -0.95337955578106393, -1.0422013940825119},
+    {-0.035834868540899491, -0.12400604076119148,
+     -0.98509480987882769, -1.0735483203982641},
+    {-0.069475797144134793, -0.15764696936442679,
+     -0.90216972148609098, -0.99091250078645154},
+    {0.044230850649394721, -0.043940321570897264,
+     -1.0458799673384873, -1.1340511404890639},
+    {0.082689014226059371, -0.0054821579942326004,
+     -1.074915357992573, -1.163152268458578},
+    {0.053012696153729229, -0.035158476066562749,
+     -0.99779038020722821, -1.0859650658697488},
+    {0.091998547834546279, 0.0038273756142542942,
+     -1.0279644335776141, -1.1162369078528571},
+    {-0.0032897477667611225, -0.091460919987053108,
+     -1.0636025048232081, -1.1518727163313889},
+    {0.038031666155880467, -0.050139506064411518,
+     -1.093097790066371, -1.1812705780457231},
+    {0.0046595214742766941, -0.083511650746015298,
+     -1.0159353681721559, -1.1041751120812651},
+    {-0.22541714253391643, -0.31358831475420845,
+     -1.0568711546110405, -1.1483441910571446},
+    {-0.18567304915516192, -0.27384422137545394,
+     -1.0879565365423056, -1.1785072555780352},
+    {-0.21899150544227572, -0.30716267766256766,
+     -1.0080387813530014, -1.0993516321175067},
+    {-0.17788362844199324, -0.26605480066228521,
+     -1.0391312200418139, -1.129520007357443},
+    {-0.27310911484444966, -0.36128028706474158,
+     -1.0750748551972134, -1.167875466158621},
+    {-0.23379653253360375, -0.32196770475389569,
+     -1.1067847397929282, -1.1984732128648774},
+    {-0.26380769091129042, -0.35197886313158233,
+     -1.0259354358555284, -1.1184575405344377},
+    {-0.15138912412661354, -0.23956029634690551,
+     -1.1703083879973859, -1.2601913290524742},
+    {-0.1087259499226095, -0.19689712214290148,
+     -1.2019894026860389, -1.2912001459299605},
+    {-0.14475348990595224, -0.23292466212624421,
+     -1.1191299759932889, -1.208896951523696},
+    {-0.10287030530455823, -0.19104147752485021,
+     -1.1503289752562196, -1.2394608642891927},
+    {-0.20023523903560242, -0.28840641125589439,
+     -1.1907415593087562, -1.2816113986136206},
+    {-0.15767309158676054, -0.24584426380705252,
+     -1.2229288998504375, -1.3129255949992114},
+    {-0.19315683900047115, -0.28132801122076312,
+     -1.1385514236413787, -1.2292634614781914},
+    {-0.16699953312211993, -0.25517070534241193,
+     -0.93934892214354038, -1.0295215539150142},
+    {-0.12539510492084205, -0.21356627714113402,
+     -0.97175323536432212, -1.0612060434147585},
+    {-0.16050072162662402, -0.24867189384691599,
+     -0.88745403420039093, -0.97750317081844762},
+    {-0.11867550826155537, -0.20684668048184734,
+     -0.9208195654900172, -1.010171648054623},
+    {-0.21420196492845298, -0.30237313714874492,
+     -0.9577483295103818, -1.0489445913271955},
+    {-0.1727904812541296, -0.26096165347442157,
+     -0.98997569080922576, -1.0802618690302628},
+    {-0.20861687013646221, -0.29678804235675416,
+     -0.90610266942560413, -0.99716598655028854},
+    {-0.11269702044579927, -0.20086819266609124,
+     1.8801430057793254, 1.7908769643285356},
+    {-0.11011091641753401, -0.19828208863782598,
+     1.829000234263219, 1.7397703725629838},
+    {-0.071730624511159774, -0.15990179673145177,
+     1.909828709238347, 1.821062876593307},
+    {-0.068973234750192486, -0.15714440697048448,
+     1.8587827830246986, 1.7700450788112625},
+    {-0.15479528946536777, -0.24296646168565975,
+     1.9011025751722983, 1.8111584513446173},
+    {-0.15279021051898545, -0.24096138273927742,
+     1.8506882045588833, 1.7607802330478173},
+    {-0.11484411144355927, -0.20301528366385124,
+     1.9304004938114301, 1.8411039382243182},
+    {-0.14719405323902582, -0.23536522545931779,
+     1.7479177803430204, 1.6581086475970077},
+    {-0.14361574539003547, -0.23178691761032744,
+     1.6960885771321796, 1.6063410583414226},
+    {-0.10708637899190018, -0.19525755121219215,
+     1.7772218758560479, 1.6880335340234012},
+    {-0.10363444377178799, -0.19180561599207996,
+     1.7250773655076275, 1.6359353675929103},
+    {-0.18921771365841134, -0.27738888587870331,
+     1.7704496390383384, 1.6798232163228293},
+    {-0.18601433396523898, -0.27418550618553095,
+     1.7190683887186491, 1.6285104358299811},
+    {-0.1502563978247092, -0.23842757004500117,
+     1.7995412724975339, 1.7096784285230311},
+    {0.015366835725073275, -0.072804336495218711,
+     1.9191262790788708, 1.8309187340390529},
+    {0.018989333374703338, -0.06918183884558865,
+     1.8674473083243386, 1.7792483627479811},
+    {0.058058871034984992, -0.030112301185306993,
+     1.9495833830037719, 1.8614036022537834},
+    {0.062128454865643307, -0.026042717354648678,
+     1.8981343707338727, 1.8099488447194756},
+    {-0.03011716924282417, -0.11828834146311615,
+     1.9396961779056687, 1.8512817101576744},
+    {-0.027065177991999791, -0.11523635021229178,
+     1.8888416351733419, 1.8004468109694238},
+    {0.011897082528213691, -0.076274089692078301,
+     1.9696940236032432, 1.8814771545901603},
+    {-0.020235802128609474, -0.10840697434890145,
+     1.784525915877355, 1.6961720360157526},
+    {-0.016496963723253447, -0.10466813594354543,
+     1.7316018235140855, 1.6432685985635189},
+    {0.022741753860319385, -0.065429418359972596,
+     1.8149039033510024, 1.7267126437245681},
+    {0.026596844612946272, -0.061574327607345714,
+     1.7617700804627139, 1.6735854226793114},
+    {-0.065872291121947063, -0.15404346334223903,
+     1.806941312525308, 1.7182344146207047},
+    {-0.062439928647823932, -0.15061110086811591,
+     1.7545692910810673, 1.6658954731628901},
+    {-0.023766032807220276, -0.11193720502751225,
+     1.83703239960102, 1.7486578742316454},
+    {-0.19596337657865898, -0.28413454879895095,
+     1.9702733834089545, 1.879499388067138},
+    {-0.19516565033290101, -0.28333682255319304,
+     1.92165262195868, 1.8308963186624867},
+    {-0.15727529013384037, -0.24544646235413234,
+     1.9988253641420124, 1.9088359840350531},
+    {-0.15628307626986979, -0.24445424849016176,
+     1.9505504124767457, 1.8605792106538137},
+    {-0.23383594181523359, -0.32200711403552562,
+     1.9895658255860569, 1.8978763216696286},
+    {-0.23374269624298114, -0.32191386846327308,
+     1.9417859376980866, 1.8500988725761216},
+    {-0.19621567646328231, -0.28438684868357428,
+     2.0176651939723245, 1.9268855896387156},
+    {-0.23164635450708149, -0.31981752672737351,
+     1.8431154967080414, 1.7514830159855719},
+    {-0.22958640285955986, -0.31775757507985181,
+     1.7926542902291198, 1.7010749913017544},
+    {-0.19378896688831024, -0.28196013910860218,
+     1.8719924168294717, 1.7812664937760687},
+    {-0.19181003511028988, -0.27998120733058185,
+     1.8215107939532003, 1.7308282048055228},
+    {-0.2697008088478724, -0.35787198106816431,
+     1.8643422686429736, 1.7716448359085659},
+    {-0.26821824469850142, -0.35638941691879333,
+     1.814514858195865, 1.7218618992549004},
+    {-0.23302432318377828, -0.32119549540407022,
+     1.8929018124385419, 1.8012335049605088},
+    {-0.076207918286778809, -0.16437909050707078,
+     2.0086021160565903, 1.9197891329981549},
+    {-0.074140784239207169, -0.16231195645949914,
+     1.9598385872089099, 1.8710476005645114},
+    {-0.035447959850740458, -0.12361913207103245,
+     2.0376609123291458, 1.9492101360949916},
+    {-0.032912500495946455, -0.12108367271623843,
+     1.9893675452984696, 1.9009343554060734},
+    {-0.11786629415910466, -0.20603746637939663,
+     2.0273969730634462, 1.938056733140914},
+    {-0.11656133177492611, -0.20473250399521808,
+     1.9795492898551581, 1.890228017920585},
+    {-0.077943121321230741, -0.16611429354152271,
+     2.0559428612650983, 1.9671111123483571},
+    {-0.12865974130547267, -0.21683091352576464,
+     -1.4186941252578349, -1.5081974113608843},
+    {-0.17360738221105132, -0.26177855443134329,
+     -1.3868507860345647, -1.4771532485772056},
+    {-0.13247810864210222, -0.22064928086239419,
+     -1.4738828913436168, -1.5634465015659589},
+    {-0.17772193531383451, -0.26589310753412654,
+     -1.4424852485478163, -1.5328707386794289},
+    {-0.079499811704006274, -0.16767098392429824,
+     -1.3952011918020566, -1.4840500104456855},
+    {-0.12432590840909752, -0.21249708062938949,
+     -1.3635870423407062, -1.4530235379169574},
+    {-0.083547305651293452, -0.17171847787158542,
+     -1.4499518915089682, -1.5388461318343409},
+    {-0.21278480005401243, -0.30095597227430437,
+     -1.2989846836453385, -1.3901469059715321},
+    {-0.25582701247370276, -0.34399818469399468,
+     -1.2661203709284881, -1.3584111917981023},
+    {-0.21807877875125437, -0.30624995097154639,
+     -1.3544743374562032, -1.4457647857124329},
+    {-0.26177500532344178, -0.34994617754373369,
+     -1.3216239508491974, -1.4140864782029907},
+    {-0.16352135207991644, -0.25169252430020844,
+     -1.2767509110082595, -1.3668569324206887},
+    {-0.20680914058573016, -0.2949803128060221,
+     -1.2443069751239819, -1.335327952714509},
+    {-0.1688555922698117, -0.2570267644901037,
+     -1.3314951407575999, -1.4217038048701738},
+    {-0.18390480044148746, -0.27207597266177941,
+     -1.5532218646864668, -1.6437352912883021},
+    {-0.22928263824742834, -0.31745381046772037,
+     -1.5224480088820167, -1.6140195036037421},
+    {-0.18595205779021368, -0.27412323001050565,
+     -1.6076578282019283, -1.6982144602154625},
+    {-0.23136480552025462, -0.31953597774054665,
+     -1.5777809655237049, -1.6694061509069569},
+    {-0.13575080083205859, -0.22392197305235056,
+     -1.5288186195679703, -1.6184350383553976},
+    {-0.1811610373326886, -0.26933220955298054,
+     -1.4980557507588703, -1.588511931665453},
+    {-0.1384625014816829, -0.22663367370197487,
+     -1.5831756876690342, -1.672836637876135},
+    {-0.27105648196726662, -0.35922765418755864,
+     -1.4343587992040181, -1.5270971151519817},
+    {-0.31493192558154293, -0.40310309780183484,
+     -1.4015155971560609, -1.4956911706471132},
+    {-0.27428578566234196, -0.36245695788263399,
+     -1.4908842751947304, -1.5837208109624923},
+    {-0.31861085385948729, -0.4067820260797792,
+     -1.458569233046453, -1.5528756470818612},
+    {-0.22262260631304931, -0.31079377853334134,
+     -1.4104468301113249, -1.5018496683514004},
+    {-0.26687283729820499, -0.35504400951849702,
+     -1.3778188967783842, -1.4704317093641153},
+    {-0.22636663722061268, -0.3145378094409047,
+     -1.4665553479737181, -1.55805242279288},
+    {0.013785103849023164, -0.074386068371268821,
+     -1.4029013869981879, -1.491113050532441},
+    {-0.030562314147981641, -0.11873348636827363,
+     -1.3720246949681087, -1.460442097361448},
+    {0.009802714141802768, -0.078368458078489217,
+     -1.456790063524201, -1.5450130755952556},
+    {-0.034688150677325828, -0.12285932289761781,
+     -1.4262844450376124, -1.5147298907178866},
+    {0.061574327607345686, -0.026596844612946299,
+     -1.3798225731270795, -1.4680072309104819},
+    {0.017843460148119866, -0.070327712072172116,
+     -1.3491818502906512, -1.4373833907271572},
+    {0.057647369817953507, -0.030523802402338474,
+     -1.4332534135611597, -1.521432694711041},
+    {-0.070391306324281672, -0.15856247854457364,
+     -1.2866801999081856, -1.3754322835149591},
+    {-0.11429918072310366, -0.20247035294339563,
+     -1.2549302684244237, -1.344219038582614},
+    {-0.075099364391748608, -0.16327053661204061,
+     -1.3406709196803883, -1.4294720580586182},
+    {-0.11952055150886287, -0.20769172372915484,
+     -1.3088934127146592, -1.398257928094139},
+    {-0.021774826252512834, -0.10994599847280481,
+     -1.2648655074414308, -1.353228251250054},
+    {-0.065427697556537684, -0.15359886977682968,
+     -1.2335294342449106, -1.3222319869916577},
+    {-0.026243654336033741, -0.11441482655632573,
+     -1.3181166795437047, -1.406506358282543},
+    {-0.042214016549086873, -0.13038518876937885,
+     -1.534588772916069, -1.6230892998611524},
+    {-0.087205458052402762, -0.17537663027269473,
+     -1.5045960846037731, -1.5935326714160167},
+    {-0.045556839029074238, -0.13372801124936623,
+     -1.5880062300321605, -1.6765328536744835},
+    {-0.090448452913540173, -0.17861962513383214,
+     -1.5588106214821214, -1.6477857787880754},
+    {0.005930959128471712, -0.08224021309182028,
+     -1.5105360318997063, -1.5987714217909585},
+    {-0.038582815086565324, -0.1267539873068573,
+     -1.480578637169405, -1.5690519534356657},
+    {0.0022013596255828355, -0.08596981259470915,
+     -1.5638323537191412, -1.6520809213444472},
+    {-0.13825498550430593, -0.2264261577245979,
+     -2.0817204425194733, -2.171377960046363},
+    {-0.11608557551450807, -0.20425674773480004,
+     -2.1098673518762427, -2.1991817483941465},
+    {-0.13978623804472487, -0.22795741026501684,
+     -2.0457657165159024, -2.1354486607563321},
+    {-0.10514397661386932, -0.19331514883416129,
+     -2.0693445787977529, -2.1585067062875369},
+    {-0.15760900736793237, -0.24578017958822435,
+     -2.1117165261868185, -2.2017120418689911},
+    {-0.11608557551450807, -0.20425674773480004,
+     -2.1098673518762427, -2.1991817483941465},
+    {-0.17236167639806274, -0.26053284861835474,
+     -2.0718355077992716, -2.1621131645688751},
+    {-0.11129501725089752, -0.19946618947118949,
+     -2.179886051691323, -2.2691324013139651},
+    {-0.086499189052030634, -0.17467036127232261,
+     -2.2118773811632613, -2.3008056964091166},
+    {-0.092613462577937455, -0.18078463479822943,
+     -2.1392608316817352, -2.2282622783213855},
+    {-0.067815235745867952, -0.15598640796615992,
+     -2.169931030954638, -2.258657128713204},
+    {-0.15435201351677635, -0.24252318573706833,
+     -2.1823595443542323, -2.272295642115028},
+    {-0.13011492218992718, -0.21828609441021915,
+     -2.2216165409888289, -2.3111426531192905},
+    {-0.1347600619227875, -0.22293123414307947,
+     -2.1491700223155985, -2.2387703465532902},
+    {-0.10176250613956445, -0.18993367835985642,
+     -1.9873344736462293, -2.0764518039275055},
+    {-0.066019877244447439, -0.15419104946473941,
+     -2.0119070481715542, -2.1006153924541109},
+    {-0.10181113547645404, -0.18998230769674601,
+     -1.9468101199680203, -2.0359280869436791},
+    {-0.061466112943839087, -0.14963728516413105,
+     -1.9665059549310588, -2.0551705822089326},
+    {-0.14114728287679223, -0.22931845509708421,
+     -2.0078936844781481, -2.0975994178248607},
+    {-0.10149677736397203, -0.189667949584264,
+     -2.0259200186907989, -2.1150338737198537},
+    {-0.14229816858905942, -0.23046934080935139,
+     -1.9680643190619194, -2.0577894614099241},
+    {-0.03812478181804111, -0.1262959540383331,
+     -2.0873696216836657, -2.1758395896736809},
+    {-0.0052187617317844132, -0.093389933952076398,
+     -2.1187958607741972, -2.2070743101273962},
+    {-0.03356597433213631, -0.12173714655242829,
+     -2.042834139501402, -2.1312718069414793},
+    {-0.0002468394757876996, -0.088418011696079685,
+     -2.0743046967873946, -2.162562584239561},
+    {-0.074177694122202598, -0.16234886634249457,
+     -2.0998259545331286, -2.1886173305142367},
+    {-0.04938651199783068, -0.13755768421812267,
+     -2.1291378060116672, -2.2176955626688866},
+    {-0.070259282786816035, -0.15843045500710801,
+     -2.0563946986566872, -2.1451454357995532},
+    {-0.22190263183051792, -0.31007380405080986,
+     -2.1375594459437885, -2.2289443315900717},
+    {-0.17779032182140794, -0.26596149404169989,
+     -2.1435373046562201, -2.2339241889814354},
+    {-0.23745711951834766, -0.32562829173863972,
+     -2.095556987715403, -2.1873419200130861},
+    {-0.20033948938667667, -0.2885106616069687,
+     -2.1052577274181128, -2.1961299289610943},
+    {-0.24425574219058599, -0.33242691441087791,
+     -2.1718738399852682, -2.2638417359123477},
+    {-0.19876606035131356, -0.28693723257160553,
+     -2.1772841172407977, -2.2681207840324351},
+    {-0.26695658800308419, -0.35512776022337622,
+     -2.1312095156046942, -2.2238248213660778},
+    {-0.11129501725089752, -0.19946618947118949,
+     -2.179886051691323, -2.2691324013139651},
+    {-0.067815235745867952, -0.15598640796615992,
+     -2.169931030954638, -2.258657128713204},
+    {-0.1347600619227875, -0.22293123414307947,
+     -2.1491700223155985, -2.2387703465532902},
+    {-0.092613462577937455, -0.18078463479822943,
+     -2.1392608316817352, -2.2282622783213855},
+    {-0.13011492218992718, -0.21828609441021915,
+     -2.2216165409888289, -2.3111426531192905},
+    {-0.086499189052030634, -0.17467036127232261,
+     -2.2118773811632613, -2.3008056964091166},
+    {-0.15435201351677635, -0.24252318573706833,
+     -2.1823595443542323, -2.272295642115028},
+    {-0.21587055229757923, -0.30404172451787126,
+     -2.0158690724578516, -2.1071056803692354},
+    {-0.1794837222389683, -0.26765489445926027,
+     -2.0281727411342425, -2.1185942974026135},
+    {-0.22312940521892577, -0.3113005774392178,
+     -1.9693725589429225, -2.0607880668877656},
+    {-0.1817405212911502, -0.26991169351144217,
+     -1.989057556688679, -2.0795257651543322},
+    {-0.24594654419571371, -0.33411771641600563,
+     -2.0497609794401423, -2.1417751523668747},
+    {-0.20824851400567276, -0.29641968622596471,
+     -2.0612095765148366, -2.1522642388918696},
+    {-0.25404665279210958, -0.34221782501240161,
+     -2.0026225054320221, -2.0948626888239783},
+    {-0.14388990942602375, -0.23206108164631573,
+     -1.7891993784066849, -1.8789515743217782},
+    {-0.1881560816318934, -0.27632725385218537,
+     -1.7637626442250371, -1.8543662608742633},
+    {-0.14403962353805494, -0.23221079575834691,
+     -1.8367710276920086, -1.9265257807213751},
+    {-0.18772462386980737, -0.27589579609009934,
+     -1.8126498953268033, -1.903244275821268},
+    {-0.099146374570122986, -0.18731754679041496,
+     -1.7656305202077074, -1.8547139218313076},
+    {-0.14329598456437617, -0.23146715678466814,
+     -1.7398784925349722, -1.8296205654760558},
+    {-0.10031025832429372, -0.18848143054458569,
+     -1.8136793832387892, -1.902777800803042},
+    {-0.23311127185395986, -0.32128244407425188,
+     -1.6855049473499788, -1.7771755222449865},
+    {-0.27823089848665605, -0.36640207070694808,
+     -1.6568682224491675, -1.749826349332553},
+    {-0.23286325857626222, -0.32103443079655425,
+     -1.7373499174699569, -1.8290140268886188},
+    {-0.27774604921077373, -0.36591722143106575,
+     -1.709946652402405, -1.8028897407394431},
+    {-0.18731940744503614, -0.27549057966532808,
+     -1.6610635586172189, -1.7516492817704081},
+    {-0.23262913126255066, -0.32080030348284261,
+     -1.6322307735606238, -1.7238887855068792},
+    {-0.18803909795083151, -0.27621027017112354,
+     -1.7131734838435722, -1.8037745943871872},
+    {-0.18545951355869816, -0.27363068577899019,
+     -1.9048137409392847, -1.9953599398380522},
+    {-0.22841914437311639, -0.31659031659340842,
+     -1.8824411610277079, -1.9739905245824036},
+    {-0.18375128291258769, -0.27192245513287971,
+     -1.9479405196509387, -2.0384507233604952},
+    {-0.22595645220877333, -0.31412762442906528,
+     -1.9269250791687673, -2.0184117576578364},
+    {-0.14379186186618279, -0.23196303408647476,
+     -1.882481443804831, -1.97223196623847},
+    {-0.1868048460683559, -0.27497601828864793,
+     -1.8596983859757585, -1.95027313947741},
+    {-0.14319523559131123, -0.2313664078116032,
+     -1.926258178552559, -2.0159985376747454},
+    {-0.27447731619707216, -0.36264848841736408,
+     -1.8112347656531642, -1.9040771638176732},
+    {-0.31866397183958628, -0.40683514405987831,
+     -1.7854983898521513, -1.8798067050355434},
+    {-0.27186628374181809, -0.36003745596211012,
+     -1.8591061101672051, -1.95186894598446},
+    {-0.31557436798251515, -0.40374554020280717,
+     -1.8347762287231144, -1.9289745325614702},
+    {-0.23194950345069354, -0.32012067567098557,
+     -1.7875559915694126, -1.8791963367383313},
+    {-0.27646710536055941, -0.36463827758085143,
+     -1.7614664470923203, -1.854369994576323},
+    {-0.2304425729338255, -0.31861374515411744,
+     -1.8359593156223739, -1.9275606636012035},
+    {-0.010834900571994092, -0.099006072792286071,
+     -1.7670912711701432, -1.8553955842972172},
+    {-0.053728275874531821, -0.1418994480948238,
+     -1.7419672690062762, -1.8305619203758403},
+    {-0.013557536866378825, -0.10172870908667081,
+     -1.8143420226852185, -1.9026598824664576},
+    {-0.055830228590171532, -0.14400140081046353,
+     -1.7904451255389378, -1.8790582498453585},
+    {0.034424795305206611, -0.053746376915085374,
+     -1.7436421123101342, -1.8318173992369398},
+    {-0.007890224085275184, -0.096061396305567176,
+     -1.7182347009633887, -1.8065251039311925},
+    {0.030884500526057256, -0.05728667169423473,
+     -1.7913164958546202, -1.8794953513688535},
+    {-0.095642730236144474, -0.18381390245643645,
+     -1.6647433384846728, -1.7537822958471412},
+    {-0.14061284625555673, -0.2287840184758487,
+     -1.6366488177264111, -1.726345581362128},
+    {-0.097598616569481544, -0.18576978878977352,
+     -1.7159283014450657, -1.8049919292421808},
+    {-0.14221543458484473, -0.2303866068051367,
+     -1.68896258071876, -1.77868632356214},
+    {-0.048594500476778192, -0.13676567269707018,
+     -1.6405425008768286, -1.7290937106163933},
+    {-0.093261879929865676, -0.18143305215015765,
+     -1.6122873999905656, -1.7012968044737578},
+    {-0.051318511954247421, -0.13948968417453939,
+     -1.6919377709807493, -1.7805117350850388},
+    {-0.059164448223151693, -0.14733562044344367,
+     -1.8822032162906113, -1.9708464626539244},
+    {-0.10111995644062186, -0.18929112866091383,
+     -1.8599457688124028, -1.9490547069566246},
+    {-0.060433598527071537, -0.1486047707473635,
+     -1.9253084776262712, -2.0139634541773717},
+    {-0.10160863117251961, -0.18977980339281159,
+     -1.9043403121443867, -1.9934556292192038},
+    {-0.016058432137689635, -0.10422960435798162,
+     -1.8598647359213418, -1.9481956197716708},
+    {-0.057636671928976931, -0.14580784414926889,
+     -1.8372257795882874, -1.9258550988478649},
+    {-0.018342090060564899, -0.10651326228085689,
+     -1.9035744615645875, -1.9919177242177686},
+    {-0.15679789300495311, -0.24496906522524509,
+     2.2179415947157954, 2.1279609729439999},
+    {-0.167303818119729, -0.25547499034002097,
+     2.2685816948983417, 2.1784031791944631},
+    {-0.19216903869322899, -0.28034021091352102,
+     2.1870054373334149, 2.0963150163021824},
+    {-0.20311650436761894, -0.29128767658791088,
+     2.23679908579409, 2.145863549870914},
+    {-0.10956399746489079, -0.19773516968518276,
+     2.1991984952961459, 2.1099762048412525},
+    {-0.11991939396932894, -0.20809056618962091,
+     2.24961220502232, 2.1602417982454201},
+    {-0.14599700604355573, -0.2341681782638477,
+     2.1684287041220447, 2.0786403204158317},
+    {-0.13977918204431625, -0.22795035426460822,
+     2.3531728910318752, 2.2634900644729314},
+    {-0.14909560906845029, -0.23726678128874226,
+     2.4057990479193481, 2.3159566700281418},
+    {-0.17741217655802399, -0.26558334877831596,
+     2.3201205109850802, 2.2297413300640549},
+    {-0.18702516088522236, -0.27519633310551433,
+     2.372302460478962, 2.2817230134678974},
+    {-0.091421142415336082, -0.17959231463562805,
+     2.334065185418015, 2.2450782704363039},
+    {-0.10089366853796208, -0.18906484075825405,
+     2.3867299558436867, 2.2976239640384195},
+    {-0.13002327519397341, -0.21819444741426539,
+     2.3010199214812568, 2.2114952528669729},
+    {-0.26994496448597682, -0.35811613670626874,
+     2.1753586642013252, 2.0826538836727044},
+    {-0.28136145342543029, -0.36953262564572231,
+     2.2245367007599439, 2.131480829320977},
+    {-0.30085262741870511, -0.38902379963899714,
+     2.1457621529764026, 2.0520723065317856},
+    {-0.31273727962171394, -0.40090845184200585,
+     2.1940140655969147, 2.0999157657526597},
+    {-0.22594149004099814, -0.31411266226129009,
+     2.1568344662997139, 2.0653481666981262},
+    {-0.237353805720247, -0.32552497794053903,
+     2.2057133730893166, 2.1139311828424892},
+    {-0.25805925725726375, -0.34623042947755578,
+     2.1274523455294712, 2.0350975420509667},
+    {-0.25869530201767899, -0.3468664742379709,
+     2.3067420157998972, 2.2143688808990687},
+    {-0.26841171921286944, -0.35658289143316146,
+     2.3584310550609358, 2.2657723062678956},
+    {-0.29219314053343837, -0.38036431275373039,
+     2.2747914209850859, 2.1813886801517151},
+    {-0.30233111435880999, -0.39050228657910202,
+     2.3258976145429311, 2.2321578688163881},
+    {-0.21362995810727389, -0.30180113032756584,
+     2.2876307363838131, 2.196448238944066},
+    {-0.22360514512040183, -0.31177631734069378,
+     2.3392635332954903, 2.2478361075371147},
+    {-0.24830851640228344, -0.33647968862257549,
+     2.2557547162085316, 2.1636753774301476},
+    {-0.051579734838740704, -0.1397509070590327,
+     2.1317270266267991, 2.0431508453065277},
+    {-0.061652475757730724, -0.14982364797802272,
+     2.1805850464407861, 2.0919186669683896},
+    {-0.08848474294640099, -0.17665591516669296,
+     2.1021962178243223, 2.0132445315841077},
+    {-0.099054362561404069, -0.18722553478169604,
+     2.1499980019836378, 2.0609157820978283},
+    {-0.003827375614254433, -0.091998547834546418,
+     2.113628220012179, 2.025355745736936},
+    {-0.013321347656018417, -0.10149251987631039,
+     2.1621153585654573, 2.0737987000577167},
+    {-0.041573555418102433, -0.12974472763839442,
+     2.0843385972515862, 1.9958429556257393},
+    {-0.032585212039204926, -0.12075638425949692,
+     2.2630146011503083, 2.1745836394481044},
+    {-0.042197056951077443, -0.13036822917136942,
+     2.3149964687463176, 2.2264960716407924},
+    {-0.071709636801505744, -0.15988080902179774,
+     2.2307387703537658, 2.1419731544231815},
+    {-0.081662945133179482, -0.16983411735347145,
+     2.2819791054025091, 2.1931061986060851},
+    {0.016932998886573951, -0.071238173333718041,
+     2.2441419598172083, 2.1559382749381713},
+    {0.0076193900753732252, -0.08055178214491876,
+     2.2959830774876737, 2.2077532484845364},
+    {-0.022932571060454494, -0.11110374328074649,
+     2.2119768988937851, 2.1236073479646924},
+    {-0.1694056588728548, -0.25757683109314677,
+     2.0913262140977484, 2.0011068060960944},
+    {-0.18089600941070461, -0.26906718163099663,
+     2.1384566800827787, 2.0480059888125406},
+    {-0.2021970699790443, -0.29036824219933627,
+     2.0632678763762859, 1.9723533970793214},
+    {-0.214185117278195, -0.30235628949848703,
+     2.1093025195890163, 2.0181066636683211},
+    {-0.12391928705357591, -0.21209045927386788,
+     2.0735358985177887, 1.9841055782737338},
+    {-0.13500425151357601, -0.22317542373386798,
+     2.1202395507636931, 2.030635268371066},
+    {-0.15780210356225935, -0.24597327578255132,
+     2.0457524386336341, 1.955753367811579},
+    {-0.18687605834523768, -0.27504723056552965,
+     0.55178372235679929, 0.46120745230789872},
+    {-0.16610233294291235, -0.25427350516320435,
+     0.49992144585052239, 0.40976611010644831},
+    {-0.15316295294294016, -0.24133412516323213,
+     0.59529378456112381, 0.50537912191690182},
+    {-0.13287856539710219, -0.22104973761739416,
+     0.543645702055091, 0.45407568485961142},
+    {-0.24086022750547173, -0.32903139972576378,
+     0.56026498392959745, 0.46838908956100128},
+    {-0.22015411694423026, -0.30832528916452229,
+     0.50762931311549331, 0.41628780036652091},
+    {-0.20704962123323198, -0.29522079345352392,
+     0.60416030226435924, 0.51313371170564548},
+    {-0.17708343080936115, -0.26525460302965309,
+     0.40489573644259291, 0.31452324101440121},
+    {-0.15512071412946229, -0.24329188634975427,
+     0.35527834452891682, 0.26532831631619525},
+    {-0.14491655607929568, -0.23308772829958765,
+     0.44883958214154912, 0.35906980777903469},
+    {-0.12351233626105601, -0.21168350848134798,
+     0.39878017342429445, 0.30935601785939476},
+    {-0.23080369150661958, -0.31897486372691153,
+     0.41131098937198568, 0.31970031814070504},
+    {-0.20846052331374587, -0.2966316955340379,
+     0.36087738042857181, 0.26981773847615492},
+    {-0.19882874762595035, -0.28699991984624229,
+     0.45575435681104642, 0.36491627910529584},
+    {-0.066000986092915548, -0.15417215831320752,
+     0.62915220799110805, 0.54044404895664866},
+    {-0.046146300845097736, -0.13431747306538971,
+     0.57857820923785164, 0.49004687957889476},
+    {-0.032869703631417051, -0.12104087585170903,
+     0.67066250453159282, 0.58222960654634304},
+    {-0.01332336360111909, -0.10149453582141107,
+     0.62061859156805044, 0.53230192282806765},
+    {-0.11928777475708341, -0.20745894697737538,
+     0.63801386699822005, 0.54865278309200316},
+    {-0.099422769323292859, -0.18759394154358483,
+     0.58677050556064303, 0.49768354939206649},
+    {-0.08551973786808087, -0.17369091008837284,
+     0.67981487046117428, 0.59089795025040404},
+    {-0.058765496213448461, -0.14693666843374042,
+     0.48547598099669476, 0.39683639183450603},
+    {-0.03832458871907115, -0.12649576093936313,
+     0.43592325241128604, 0.34745182612320158},
+    {-0.026122407229524088, -0.11429357944981608,
+     0.52834946490986623, 0.43996054047799382},
+    {-0.006098233814142151, -0.094269406034434122,
+     0.47871216102934544, 0.39042984634994593},
+    {-0.1122004061399885, -0.20037157836028047,
+     0.49254128091488458, 0.40328223571856703},
+    {-0.091312788866794142, -0.17948396108708611,
+     0.4422335646379959, 0.3532479637331255},
+    {-0.079190271181072636, -0.16736144340136461,
+     0.53583860785914328, 0.44699320112227814},
+    {-0.3139763980145025, -0.40214757023479442,
+     0.6229681685261288, 0.52882631055985119},
+    {-0.29450853145011913, -0.38267970367041115,
+     0.56910105672513378, 0.47562240774192155},
+    {-0.27968615533179775, -0.36785732755208977,
+     0.66668335432588377, 0.57367992923293254},
+    {-0.26075985850600669, -0.34893103072629861,
+     0.61338154611689588, 0.52094860072152249},
+    {-0.36639846567685919, -0.45456963789715121,
+     0.63292996871890661, 0.53677062518673135},
+    {-0.34750968190212517, -0.43568085412241719,
+     0.5783027273284832, 0.48291049482593718},
+    {-0.33228151699269504, -0.42045268921298706,
+     0.67696923591391389, 0.582162137568216},
+    {-0.3063056379318233, -0.39447681015211533,
+     0.47055953973261244, 0.37668437058639237},
+    {-0.28435879073287307, -0.37252996295316509,
+     0.41803789546602466, 0.3248873897401513},
+    {-0.27403291289564824, -0.36220408511594016,
+     0.51567707014543529, 0.4228482679976846},
+    {-0.25273117641477627, -0.34090234863506819,
+     0.46299038651811242, 0.3707873949198256},
+    {-0.35924493712881034, -0.44741610934910225,
+     0.47847302678250803, 0.38260967586584338},
+    {-0.33743980919219008, -0.42561098141248199,
+     0.42508781776580284, 0.33008578619934315},
+    {-0.32742152383306955, -0.41559269605336158,
+     0.52407619690145268, 0.42944972939778869},
+    {-0.19185675419449208, -0.28002792641478402,
+     0.69913248875666467, 0.6084488811415546},
+    {-0.17287645052021391, -0.26104762274050591,
+     0.64721559134283169, 0.55692770250063739},
+    {-0.15726325164218713, -0.2454344238624791,
+     0.74036381285075914, 0.65037465387518767},
+    {-0.13861844793352857, -0.22678962015382054,
+     0.68930124286044281, 0.59963771030985558},
+    {-0.24492013913127672, -0.33309131135156878,
+     0.70931859404605968, 0.61733255058974723},
+    {-0.22644869046829708, -0.3146198626885891,
+     0.65676862761589072, 0.56526947098744207},
+    {-0.20996293580376066, -0.2981341080240526,
+     0.75076602334424991, 0.65967096046660401},
+    {-0.20077379085069108, -0.28894496307098305,
+     -0.084097091009925767, -0.17497914546325949},
+    {-0.2303037681599118, -0.31847494038020374,
+     -0.041256164323441397, -0.13285393236443746},
+    {-0.21832030616644235, -0.3064914783867343,
+     -0.13289113753132836, -0.2241875055109967},
+    {-0.24879538271703239, -0.3369665549373243,
+     -0.090263676388566971, -0.1823565229738851},
+    {-0.15445536533995644, -0.24262653756024841,
+     -0.078191377985573379, -0.16812934535285384},
+    {-0.18299812724806153, -0.27116929946835355,
+     -0.03659443591440549, -0.12708886236069916},
+    {-0.17136791526525041, -0.25953908748554239,
+     -0.12551733942116602, -0.21577531757960591},
+    {-0.24002377472845904, -0.32819494694875095,
+     0.050193372634883632, -0.041660048766554617},
+    {-0.26808044297468336, -0.35625161519497539,
+     0.095143641779323398, 0.0024948040897511126},
+    {-0.25973701863664156, -0.34790819085693359,
+     0.002913905198291343, -0.089489349474755175},
+    {-0.28884257128314283, -0.37701374350343475,
+     0.048295119949804725, -0.044998877922989906},
+    {-0.19282249001151316, -0.28099366223180511,
+     0.052080505096874181, -0.038624204857402027},
+    {-0.22028850737674821, -0.30845967959704024,
+     0.095625830928909097, 0.0042809959162234262},
+    {-0.21159097384763603, -0.29976214606792806,
+     0.0062367252685267549, -0.08489698373511903},
+    {-0.2844203081895722, -0.37259148040986412,
+     -0.19209751204433906, -0.28524997083094794},
+    {-0.31691858843273513, -0.40508976065302715,
+     -0.1487119542829414, -0.24295797958977558},
+    {-0.30121019722240638, -0.3893813694426983,
+     -0.24447304874880033, -0.3381749396109312},
+    {-0.33468885571954266, -0.42286002793983468,
+     -0.20187693753255861, -0.29677459598062822},
+    {-0.23548012289168016, -0.3236512951119721,
+     -0.18278912630294242, -0.27452178539753713},
+    {-0.26689246094081631, -0.35506363316110834,
+     -0.14061369540730922, -0.23322709209915876},
+    {-0.25209680122632783, -0.34026797344661974,
+     -0.23357321027966821, -0.32575833422684775},
+    {-0.32967508977574411, -0.41784626199603614,
+     -0.05115003458107386, -0.14585989632946222},
+    {-0.36052350019146673, -0.44869467241175875,
+     -0.0040391938844515848, -0.099954954282530983},
+    {-0.34932928262138696, -0.43750045484167899,
+     -0.10345750885380794, -0.19892162644065381},
+    {-0.38137233117962233, -0.46954350339991424,
+     -0.056409318777827733, -0.15321031653728989},
+    {-0.27925069758902898, -0.3674218698093209,
+     -0.046103880500948234, -0.13909372569536424},
+    {-0.30944202058314041, -0.39761319280343244,
+     -0.00050984134348095594, -0.094493201909472468},
+    {-0.29837577847721342, -0.38654695069750544,
+     -0.096709926064994234, -0.19031675538304837},
+    {-0.082782749117478016, -0.17095392133776999,
+     -0.11172397177721377, -0.20060951699568305},
+    {-0.10994422472762949, -0.19811539694792146,
+     -0.072530080316579731, -0.1617576314648726},
+    {-0.098291614494744328, -0.1864627867150363,
+     -0.1573631479313555, -0.24643560185620769},
+    {-0.12616011328059804, -0.21433128550089001,
+     -0.1184686154439933, -0.20793316147231322},
+    {-0.041286112919076697, -0.12945728513936869,
+     -0.10526464290629797, -0.19375810395021839},
+    {-0.067307028164393073, -0.15547820038468504,
+     -0.06709863270039737, -0.15581967528764501},
+    {-0.056128380456985059, -0.14429955267727704,
+     -0.14962967525589069, -0.23824545219266233},
+    {-0.12050458587045379, -0.20867575809074576,
+     0.012593669694819273, -0.076785408234437635},
+    {-0.14735985613249017, -0.23553102835278214,
+     0.053952285035681412, -0.035859732562176817},
+    {-0.13745684183731072, -0.22562801405760269,
+     -0.032108013845113519, -0.12175236709049475},
+    {-0.1651459511077743, -0.25331712332806627,
+     0.0094623139852838753, -0.080674672023383562},
+    {-0.077732739580848725, -0.16590391180114072,
+     0.015633321938416971, -0.07319613707253636},
+    {-0.10371950887564907, -0.19189068109594104,
+     0.055804750853256493, -0.033338375759910763},
+    {-0.093764184298818859, -0.18193535651911083,
+     -0.027787599432455082, -0.11680319526197404},
+    {-0.15820669208832591, -0.24637786430861788,
+     -0.21329912464002929, -0.30330565623166406},
+    {-0.18805480187110643, -0.27622597409139837,
+     -0.17391710713987779, -0.26451855402366664},
+    {-0.17378195358689477, -0.26195312580718677,
+     -0.26181345537623291, -0.35211940644893647},
+    {-0.20437369670269268, -0.2925448689229847,
+     -0.2231941756111602, -0.3141586436842867},
+    {-0.11372178468233143, -0.2018929569026234,
+     -0.20385521951203561, -0.29313577081568976},
+    {-0.1422900104706056, -0.23046118269089758,
+     -0.16545084683516814, -0.2551758511535524},
+    {-0.12895761375517181, -0.21712878597546378,
+     -0.25101854188216005, -0.34052648404997082},
+    {-0.20253419278151175, -0.29070536500180377,
+     -2.985149854807148, -3.0760720447384817},
+    {-0.16943741440333418, -0.25760858662362618,
+     -3.0193912447263198, -3.1096112738879436},
+    {-0.18762907076401533, -0.27580024298430728,
+     -2.9355704097204343, -3.0261627472587773},
+    {-0.15489737405563644, -0.24306854627592842,
+     -2.9712365687284907, -3.061182543632516},
+    {-0.25099219105296744, -0.33916336327325936,
+     -2.9995590328175004, -3.0917131495995038},
+    {-0.21659710463338985, -0.3047682768536818,
+     -3.0341902732101307, -3.1254445395860495},
+    {-0.23656283486440952, -0.32473400708470146,
+     -2.9489861156374144, -3.0407473506078264},
+    {-0.15098523184832863, -0.2391564040686206,
+     -3.0977206543667823, 3.095588891963605},
+    {-0.11998960497561581, -0.20816077719590778,
+     -3.1268109004454883, 3.0670029613015486},
+    {-0.13741590320544575, -0.22558707542573772,
+     -3.0517844198838979, -3.1414280995466939},
+    {-0.10657617596889885, -0.19474734818919082,
+     -3.0824115494936888, 3.1115923355463697},
+    {-0.19618433137478486, -0.28435550359507683,
+     -3.1135066777435161, 3.078899722301244},
+    {-0.16382001354613063, -0.2519911857664226,
+     3.1404658210761145, 3.0503541266614009},
+    {-0.18321854562093018, -0.27138971784122212,
+     -3.0668796521795683, 3.1258066170659422},
+    {-0.1238634789146188, -0.21203465113491077,
+     -2.8737923894499238, -2.9632218633598733},
+    {-0.09290826842408817, -0.18107944064438014,
+     -2.9101379911054508, -2.9991430509985815},
+    {-0.10757425869703002, -0.19574543091732199,
+     -2.8249600602113838, -2.9141550416968944},
+    {-0.077090284876464299, -0.16526145709675627,
+     -2.8623167978239041, -2.9511392890816155},
+    {-0.17196643620507709, -0.26013760842536909,
+     -2.8856895433158476, -2.9759593617733184},
+    {-0.13967457257136395, -0.22784574479165592,
+     -2.9226284915526466, -3.0123095739724142},
+    {-0.15565137516970612, -0.24382254738999809,
+     -2.8357536831225074, -2.9257133615520763},
+    {-0.077973572109177158, -0.16614474432946913,
+     -2.9912378790201535, -3.0800699597148373},
+    {-0.048793904927264174, -0.13696507714755615,
+     -3.0230053371830592, -3.1115581899144895},
+    {-0.062928099403196325, -0.1510992716234883,
+     -2.944810751484086, -3.0334892090054613},
+    {-0.034031600122392973, -0.12220277234268495,
+     -2.9778453741050148, -3.0662862552938375},
+    {-0.12316417966282037, -0.21133535188311234,
+     -3.0050803538928679, -3.0944992478480375},
+    {-0.092549320877761437, -0.18072049309805341,
+     -3.0371654146109481, -3.1261660761687216},
+    {-0.10829964573541692, -0.19647081795570889,
+     -2.9577970288925073, -3.0470019234016252},
+    {-0.33638388410204578, -0.4245550563223377,
+     -2.9773390407292597, -3.0723008976237285},
+    {-0.30002681111236507, -0.38819798333265698,
+     -3.0144881128308545, -3.1081501999803058},
+    {-0.32212142302894786, -0.41029259524923978,
+     -2.9241393654227297, -3.0185721650816131},
+    {-0.2862361542931211, -0.37440732651341313,
+     -2.9629000609012164, -3.0561103651572759},
+    {-0.38672261212637193, -0.47489378434666396,
+     -2.9923324466017451, -3.0893700901208954},
+    {-0.34937281818429133, -0.43754399040458325,
+     -3.0299631611954063, -3.1254290038966048},
+    {-0.37325902362934782, -0.46143019584963973,
+     -2.9379640249183478, -3.0344136114620546},
+    {-0.2768015403436036, -0.36497271256389552,
+     -3.0985733079798119, 3.0916981299784063},
+    {-0.24196927360934936, -0.33014044582964142,
+     -3.1297860803675994, 3.0614934195732402},
+    {-0.26442003200729058, -0.35259120422758261,
+     -3.0494985882030297, 3.1411465767693536},
+    {-0.22975537710323221, -0.31792654932352415,
+     -3.0824694533091108, 3.1091322094867673},
+    {-0.324114446216758, -0.41228561843704992,
+     -3.1152119243985918, 3.0734681617094273},
+    {-0.28811701680174695, -0.37628818902203898,
+     3.1366091491640948, 3.0433385280243326},
+    {-0.31266075599148602, -0.40083192821177793,
+     -3.0653389068890249, 3.1237507843867069},
+    {-0.25542398913455089, -0.3435951613548428,
+     -2.8585794128886626, -2.9508587403757369},
+    {-0.22120266413348141, -0.30937383635377336,
+     -2.8980300282794742, -2.9893975123586207},
+    {-0.23859404969611106, -0.32676522191640311,
+     -2.8064092310000954, -2.8982244141279518},
+    {-0.20500741122980223, -0.29317858345009418,
+     -2.8469526202543682, -2.9379317336944015},
+    {-0.30664886953302151, -0.39482004175331353,
+     -2.8706591564221409, -2.9645461084194027},
+    {-0.27134126279997495, -0.35951243502026697,
+     -2.9108378086295459, -3.0035847390033745},
+    {-0.29006267256375418, -0.3782338447840462,
+     -2.8172028547345107, -2.9105363004614224},
+    {-0.21896278097584509, -0.30713395319613712,
+     2.5818217234186651, 2.4905095790115732},
+    {-0.21207327218585947, -0.3002444444061515,
+     2.5298982441742197, 2.4387530337525991},
+    {-0.18052075058164707, -0.2686919228019391,
+     2.6152536595054019, 2.5248107291270672},
+    {-0.17364871320154035, -0.26181988542183232,
+     2.5636217724466901, 2.4733184842432303},
+    {-0.26419628673879403, -0.35236745895908606,
+     2.6005650284889663, 2.5080314819099776},
+    {-0.25711084992059541, -0.34528202214088743,
+     2.5477569052503353, 2.4554293529232107},
+    {-0.22517524498625982, -0.31334641720655176,
+     2.6339222729296083, 2.5424553454106911},
+    {-0.24157155051729107, -0.32974272273758298,
+     2.4438702967344446, 2.3519752320069038},
+    {-0.23294653202291027, -0.3211177042432023,
+     2.391436188252281, 2.2997699087024834},
+    {-0.20442328023696188, -0.29259445245725391,
+     2.4774804068193554, 2.3865147943405121},
+    {-0.19605408042501943, -0.2842252526453114,
+     2.424851684291959, 2.3340756732173573},
+    {-0.28665710779249565, -0.37482828001278767,
+     2.4606342775920553, 2.3674105093084274},
+    {-0.27736770804625888, -0.36553888026655079,
+     2.4105560132155515, 2.3176246413158208},
+    {-0.24941414417478336, -0.33758531639507527,
+     2.496278975553802, 2.4041689245791171},
+    {-0.094423471945658088, -0.18259464416595006,
+     2.6310819052255359, 2.5420581476933468},
+    {-0.086727292453848248, -0.17489846467414022,
+     2.5793597734172362, 2.4904287917251366},
+    {-0.054116982351583541, -0.14228815457187552,
+     2.664668078325187, 2.5760700409026684},
+    {-0.046181463974469865, -0.13435263619476184,
+     2.6134152371284252, 2.5248836257536711},
+    {-0.14131954466377386, -0.22949071688406583,
+     2.64859915023544, 2.5588905198919178},
+    {-0.13435283551062979, -0.22252400773092176,
+     2.597374788009958, 2.5077810519878927},
+    {-0.10159868469683758, -0.18976985691712955,
+     2.6817862733704891, 2.5926710863535756},
+    {-0.11864631865523526, -0.20681749087552723,
+     2.4926429862834905, 2.403291331973163},
+    {-0.10999457786309491, -0.19816575008338688,
+     2.4396876927696249, 2.3504594439388757},
+    {-0.078547616584644708, -0.16671878880493668,
+     2.52687263936981, 2.4380342882691974},
+    {-0.069935842834226408, -0.15810701505451838,
+     2.4738974855838305, 2.3851500403875145},
+    {-0.1660926212940769, -0.2542637935143689,
+     2.5113152256268658, 2.4211600766685195},
+    {-0.15789005941147563, -0.2460612316317676,
+     2.4586109997252863, 2.3686103083216508},
+    {-0.12678300075795804, -0.21495417297825001,
+     2.5453005107630764, 2.4558263664467725},
+    {-0.31721940299812357, -0.40539057521841559,
+     2.6763479416983911, 2.5820912071580633},
+    {-0.31080811869043279, -0.39897929091072482,
+     2.6205972531136434, 2.5265664007676789},
+    {-0.27614546807363594, -0.36431664029392796,
+     2.7091276349146609, 2.6162340022269266},
+    {-0.27057045015868708, -0.35874162237897911,
+     2.6544510852931165, 2.5617274504135912},
+    {-0.3648986971078495, -0.45306986932814153,
+     2.6997250041349479, 2.6036282757518454},
+    {-0.3585965707955604, -0.44676774301585231,
+     2.6420321719602482, 2.5461953164532849},
+    {-0.32264349951796667, -0.41081467173825859,
+     2.7328034701354253, 2.6383517465341058},
+    {-0.34281992380443671, -0.43099109602472874,
+     2.5298604728283065, 2.4346515646402329},
+    {-0.33359802655406989, -0.42176919877436192,
+     2.4759953187401709, 2.3811387850213195},
+    {-0.30350193566220129, -0.39167310788249321,
+     2.5658762700270912, 2.4720968255655067},
+    {-0.29541097741864053, -0.38358214963893256,
+     2.5124735813584236, 2.4189651771781167},
+    {-0.39144404663239019, -0.4796152188526821,
+     2.5485573150290493, 2.4513075593691638},
+    {-0.38186339535495573, -0.47003456757524775,
+     2.4925357556578023, 2.3957132014295954},
+    {-0.35119783350297773, -0.43936900572326976,
+     2.5853006695005827, 2.4897622907122554},
+    {-0.19162393535105449, -0.27979510757134646,
+     2.7179061973304015, 2.6272276629317823},
+    {-0.18668863165131883, -0.2748598038716108,
+     2.665955246802989, 2.5753829671254165},
+    {-0.15337691060849157, -0.24154808282878354,
+     2.7475685016295759, 2.6576499921179173},
+    {-0.14766267690195176, -0.23583384912224373,
+     2.6987332285889436, 2.608915935274482},
+    {-0.23564792435599557, -0.3238190965762876,
+     2.7404091430514184, 2.648672063401551},
+    {-0.23075993790960878, -0.31893111012990072,
+     2.6868785657017469, 2.5952690248249839},
+    {-0.19596722638726982, -0.28413839860756185,
+     2.7702380825722766, 2.6794640016922586},
+    {-0.247434460304747, -0.33560563252503905,
+     2.954185146221195, 2.862129992914042},
+    {-0.24568531300262109, -0.333856485222913,
+     2.9014042481510978, 2.809397245306863},
+    {-0.20683905651035814, -0.29501022873065008,
+     2.9777030816047092, 2.886681406082237},
+    {-0.20511600524486573, -0.2932871774651577,
+     2.9266728598081202, 2.8356912325813819},
+    {-0.29031702153761652, -0.37848819375790854,
+     2.9830107112047139, 2.889669020254126},
+    {-0.28935922070105402, -0.37753039292134594,
+     2.9292626790957876, 2.8359519981361978},
+    {-0.24840599958844289, -0.33657717180873481,
+     3.0060482732358635, 2.9139662319112092},
+    {-0.28463487035822788, -0.37280604257851979,
+     2.8195767416212245, 2.7264174674987469},
+    {-0.28085035323708474, -0.36902152545737665,
+     2.7642800468333348, 2.6712402096848136},
+    {-0.24313673209088912, -0.33130790431118118,
+     2.8479813307798265, 2.7560438919247616},
+    {-0.23978546812336374, -0.32795664034365579,
+     2.7942133874203927, 2.7023663548271299},
+    {-0.3302805581055801, -0.41845173032587202,
+     2.8464120208060053, 2.7516796463357269},
+    {-0.32701125826936972, -0.41518243048966175,
+     2.7896129449538729, 2.6950015920381856},
+    {-0.28747207231823735, -0.37564324453852938,
+     2.874680906698313, 2.781431014072854},
+    {-0.12820130304175967, -0.21637247526205164,
+     2.9731938304507999, 2.883697693767397},
+    {-0.12584483555855808, -0.21401600777885005,
+     2.9246259091027089, 2.8351662072832844},
+    {-0.092043262354196548, -0.18021443457448852,
+     2.99461066613339, 2.9056161853081361},
+    {-0.089589011095777438, -0.17776018331606941,
+     2.9475748742888839, 2.8586100331242625},
+    {-0.16770553629228049, -0.25587670851257249,
+     2.9999100399512137, 2.9097237422919129},
+    {-0.16591722187712149, -0.25408839409741346,
+     2.9505746319529065, 2.8604228548834678},
+    {-0.13012678248332632, -0.21829795470361829,
+     3.0208939700599275, 2.9313676710616559},
+    {-0.16071766019799322, -0.24888883241828519,
+     2.8497068258600335, 2.7596536336101676},
+    {-0.15730709739423723, -0.2454782696145292,
+     2.798665689478737, 2.7086757250459153},
+    {-0.12305356991607588, -0.21122474213636785,
+     2.8754006949115549, 2.785983470177551},
+    {-0.11983286685122096, -0.20800403907151294,
+     2.8257470382262206, 2.7363779108356252},
+    {-0.20273093329703151, -0.29090210551732348,
+     2.8749054859647356, 2.7839787908269105},
+    {-0.19967807326136511, -0.28784924548165708,
+     2.8226669004477998, 2.7318096672979157},
+    {-0.1635898264993729, -0.2517609987196649,
+     2.9004278775009085, 2.8103205562066864},
+    {-0.33253101524040196, -0.42070218746069399,
+     3.0665100573278661, 2.9716936068169559},
+    {-0.33350938425102994, -0.42168055647132197,
+     3.0131905115003437, 2.9183373131109644},
+    {-0.28962967379191529, -0.3778008460122072,
+     3.0869101954376039, 2.9935907689846775},
+    {-0.2903873313960591, -0.37855850361635102,
+     3.0356421355427186, 2.9422981640369521},
+    {-0.37457031064041024, -0.46274148286070227,
+     3.0986693172919009, 3.0021635380475868},
+    {-0.37673733797719733, -0.46490851019748936,
+     3.0447588060808357, 2.9481596549977658},
+    {-0.33064894709732651, -0.41882011931761853,
+     3.1182533404609956, 3.0235072461942956},
+    {-0.37775954657256383, -0.46593071879285586,
+     2.9325175679118134, 2.835874152018107},
+    {-0.37645309846068098, -0.4646242706809729,
+     2.8748034323959724, 2.7782165646343318},
+    {-0.33350036798036176, -0.42167154020065378,
+     2.9585372740630982, 2.8636844148725622},
+    {-0.33243831180749905, -0.42060948402779108,
+     2.9028367292773622, 2.8080237545563462},
+    {-0.42313656098989194, -0.51130773321018397,
+     2.9637880368594391, 2.865032536300701},
+    {-0.42285440285375453, -0.51102557507404645,
+     2.9048339537215044, 2.8060925042935372},
+    {-0.37783132561952149, -0.46600249783981351,
+     2.9892797937394167, 2.8926332642701573},
+    {-0.20839241851725399, -0.29656359073754601,
+     3.0766079030249949, 2.9855498611917484},
+    {-0.2079202890843321, -0.29609146130462405,
+     3.0277529306734303, 2.9367059683440075},
+    {-0.16974129866919518, -0.25791247088948716,
+     3.0953194297779802, 3.0050934513974346},
+    {-0.16897149735123637, -0.25714266957152837,
+     3.0482203124002263, 2.9580093869146076},
+    {-0.24818248574175306, -0.33635365796204497,
+     3.1060690693325963, 3.0139932229960049},
+    {-0.24863814264749626, -0.33680931486778831,
+     3.0567469251776687, 2.9646584439413233},
+    {-0.20829821340168017, -0.29646938562197211,
+     3.1240862361612023, 3.0330304068841492},
+    {-0.28916200814109771, -0.37733318036138974,
+     -2.3332994287735564, -2.4266037379144487},
+    {-0.26201084786680029, -0.35018202008709221,
+     -2.3786637879504751, -2.4711332042445004},
+    {-0.26580002785708656, -0.35397120007737859,
+     -2.2909965428114103, -2.3835774882114262},
+    {-0.23951000085859608, -0.327681173078888,
+     -2.3351697508430069, -2.4270094059865066},
+    {-0.33972345176723229, -0.4278946239875242,
+     -2.331207049021975, -2.4262964453264111},
+    {-0.3127837562090181, -0.40095492842931013,
+     -2.3778707266732675, -2.4719706569510502},
+    {-0.31520588965603735, -0.40337706187632927,
+     -2.2879011529007971, -2.3820864134586839},
+    {-0.2556787317336916, -0.34384990395398363,
+     -2.4703174772391354, -2.5626040673763391},
+    {-0.22591113003419705, -0.31408230225448908,
+     -2.5157171863380374, -2.6072027172047298},
+    {-0.23391803462599334, -0.32208920684628528,
+     -2.4238078895407145, -2.5154995413236452},
+    {-0.20507371784869327, -0.29324489006898524,
+     -2.4685506975186975, -2.5595313457123003},
+    {-0.30740501444106438, -0.3955761866613563,
+     -2.4720574134796878, -2.5659703727750487},
+    {-0.27739155745954602, -0.36556272967983794,
+     -2.518755107268261, -2.611687217254548},
+    {-0.28470660720851981, -0.37287777942881184,
+     -2.4243065376392261, -2.5174680915845622},
+    {-0.19572813408292966, -0.28389930630322163,
+     -2.254615798695824, -2.3453845700855456},
+    {-0.17010707216482956, -0.25827824438512154,
+     -2.2964208270607012, -2.3866539783736886},
+    {-0.17469444441561852, -0.26286561663591046,
+     -2.2174816140792672, -2.3078058490153306},
+    {-0.14978947195501652, -0.23796064417530849,
+     -2.2580282150274149, -2.3478828108679579},
+    {-0.24286218745154786, -0.33103335967183978,
+     -2.2509328404019677, -2.342862827401158},
+    {-0.21736987504632674, -0.30554104726661868,
+     -2.2938288697110591, -2.3851019782467713},
+    {-0.22048259345775487, -0.30865376567804681,
+     -2.2130534066405945, -2.304403042990752},
+    {-0.16384684118350484, -0.25201801340379681,
+     -2.3798013477197366, -2.4699135521473399},
+    {-0.13614087130966759, -0.22431204352995956,
+     -2.4225603169410652, -2.5121830981469566},
+    {-0.14375604545710013, -0.23192721767739211,
+     -2.3383232662835067, -2.4280731776313051},
+    {-0.11683050963703448, -0.20500168185732645,
+     -2.3801758498411232, -2.469501021238881},
+    {-0.21229711708753207, -0.3004682893078241,
+     -2.3793021658709801, -2.4704527225358683},
+    {-0.18433203110298532, -0.27250320332327727,
+     -2.4232222254282525, -2.513744633597383},
+    {-0.19098049831387784, -0.27915167053416978,
+     -2.3368381195160786, -2.4275026616697883},
+    {-0.41604903239199309, -0.50422020461228512,
+     -2.280821563158058, -2.3792276882120293},
+    {-0.39095492870632353, -0.47912610092661545,
+     -2.328871072940883, -2.4260987110620613},
+    {-0.38959759659661808, -0.47776876881690999,
+     -2.2380076293969697, -2.3351740643620547},
+    {-0.36536902434912311, -0.45354019656941502,
+     -2.2845182626254972, -2.3806345950668235},
+    {-0.46698989818564851, -0.55516107040594054,
+     -2.2767827001572178, -2.3778710445313185},
+    {-0.44259668726149193, -0.53076785948178395,
+     -2.3262684333968555, -2.4260220580569478},
+    {-0.43955781201925959, -0.52772898423955161,
+     -2.2329792130922592, -2.3325731535638803},
+    {-0.38895651656092001, -0.47712768878121192,
+     -2.4249973536173819, -2.5221349707679703},
+    {-0.3600045288255368, -0.44817570104582882,
+     -2.4737644561065881, -2.5696589175790967},
+    {-0.36438112023081137, -0.4525522924511034,
+     -2.376906532834528, -2.4729817215097056},
+    {-0.33647140009398702, -0.42464257231427904,
+     -2.4247069131094361, -2.5196720944005828},
+    {-0.44188313922156686, -0.53005431144185877,
+     -2.4251658598542596, -2.5248818608751877},
+    {-0.41320150455965454, -0.50137267677994657,
+     -2.475432846015702, -2.5737006860588134},
+    {-0.4165431455350016, -0.50471431775529363,
+     -2.3757537881584856, -2.4741840298680566},
+    {-0.31505275367580077, -0.40322392589609279,
+     -2.2032144753057601, -2.2973943200277267},
+    {-0.29102063330497729, -0.37919180552526932,
+     -2.2469550054884544, -2.3403195444646552},
+    {-0.29066283563527084, -0.37883400785556287,
+     -2.166101384784342, -2.259454298006593},
+    {-0.26732782016354317, -0.3554989923838352,
+     -2.2083067464422279, -2.3009331128574613},
+    {-0.36345705421074948, -0.45162822643104139,
+     -2.197747306015926, -2.293784126298287},
+    {-0.34000589518844249, -0.4281770674087344,
+     -2.2426560401913722, -2.3377562875057896},
+    {-0.33780652004291523, -0.42597769226320714,
+     -2.1599373184974375, -2.2549533350178539},
+    {-0.3074770107258834, -0.39564818294617543,
+     0.91339068784382049, 0.81947524871402955},
+    {-0.32049519714078112, -0.40866636936107303,
+     0.96346453214881778, 0.869090465692411},
+    {-0.3433582753874348, -0.43152944760772671,
+     0.87582433482226874, 0.78059452445034072},
+    {-0.35687486932584034, -0.44504604154613236,
+     0.92597680077393529, 0.83021003607585908},
+    {-0.25803676059031189, -0.3462079328106038,
+     0.90136512921623901, 0.80901097329604998},
+    {-0.27113575653763655, -0.35930692875792847,
+     0.95002731647846617, 0.85728660344500363},
+    {-0.29366349783163026, -0.38183467005192218,
+     0.86380186553529492, 0.77035099262486939},
+    {-0.29449515652394576, -0.38266632874423767,
+     1.0530328902751132, 0.95955468157138712},
+    {-0.30534423950829837, -0.39351541172859028,
+     1.1072609690072572, 1.0134187292832921},
+    {-0.33306215103491787, -0.42123332325520979,
+     1.0156777676962601, 0.92084138233886814},
+    {-0.34500752069919238, -0.43317869291948441,
+     1.0698684967288221, 0.97457442315520526},
+    {-0.2447486246010192, -0.33291979682131112,
+     1.0371661944538997, 0.94518484036858796},
+    {-0.25515679352148424, -0.34332796574177615,
+     1.0897465008544405, 0.99747478338817919},
+    {-0.28304127871319629, -0.3712124509334882,
+     1.0005582591775624, 0.90744947771140438},
+    {-0.42774077375722319, -0.51591194597751511,
+     0.84901243867785969, 0.75002597231556312},
+    {-0.44169186401485316, -0.52986303623514508,
+     0.90067758430950884, 0.80097165531191006},
+    {-0.4630166162965057, -0.55118778851679773,
+     0.80821967963007402, 0.70735527482188898},
+    {-0.47488583840515808, -0.56305701062545011,
+     0.86171016235820241, 0.76016905171562366},
+    {-0.37917841284258713, -0.46734958506287916,
+     0.83668065002564729, 0.7399755579655628},
+    {-0.39197267353865917, -0.48014384575895108,
+     0.88819316340141119, 0.79091946614615305},
+    {-0.41466322275555345, -0.50283439497584537,
+     0.79598319105359672, 0.69764451350803303},
+    {-0.42118282281827946, -0.50935399503857137,
+     0.99300902334162189, 0.89435057361486192},
+    {-0.43468536543200431, -0.52285653765229623,
+     1.048863761199075, 0.94952287918684897},
+    {-0.45721457112603869, -0.54538574334633072,
+     0.95373155217000094, 0.85318953900729677},
+    {-0.47195995855810779, -0.56013113077839982,
+     1.0092630711958537, 0.90789094490978961},
+    {-0.37059963691318665, -0.45877080913347867,
+     0.97776824288994535, 0.88143191045109692},
+    {-0.38370570147475791, -0.47187687369504983,
+     1.0317546836941811, 0.93485096284989999},
+    {-0.40687585062242171, -0.49504702284271362,
+     0.93940028109599694, 0.84143541357427432},
+    {-0.19199841206537588, -0.28016958428566785,
+     0.84078212013041376, 0.75009542304993082},
+    {-0.20790532206335419, -0.29607649428364613,
+     0.88966549277435825, 0.79861888130140268},
+    {-0.22708034276496514, -0.31525151498525716,
+     0.80184678228404616, 0.71033157592254004},
+    {-0.24312347487246877, -0.33129464709276069,
+     0.85212254425692102, 0.76018546542425558},
+    {-0.14056639383435707, -0.22873756605464904,
+     0.82977527349897251, 0.74007928820209368},
+    {-0.15734273664205237, -0.24551390886234434,
+     0.87828807100021178, 0.78829745172755572},
+    {-0.17509169546110123, -0.26326286768139318,
+     0.79093976219367923, 0.70060754159837291},
+    {-0.18588926200704764, -0.27406043422733961,
+     0.97291754469828251, 0.88236224418612919},
+    {-0.19602339306281757, -0.28419456528310955,
+     1.0222005610988425, 0.93142523209027883},
+    {-0.22276190224938605, -0.31093307446967799,
+     0.9373912721331652, 0.84598495425787346},
+    {-0.23390604861524975, -0.32207722083554169,
+     0.98632647012318819, 0.89463513198560962},
+    {-0.13918909011812541, -0.22736026233841738,
+     0.96027123386105173, 0.87059823209085119},
+    {-0.14854079208722387, -0.23671196430751584,
+     1.0080724761557678, 0.91823983430689471},
+    {-0.17319083008833139, -0.26136200230862339,
+     0.92571493293104068, 0.83542078231245276},
+    {-0.31409230289002443, -0.40226347511031646,
+     0.77263943152148895, 0.67849348975102053},
+    {-0.32939145542415138, -0.41756262764444341,
+     0.82471185091747301, 0.73001251973579084},
+    {-0.34930151443044344, -0.43747268665073535,
+     0.73079054061131932, 0.63532752322324071},
+    {-0.36495018306997773, -0.45312135529026965,
+     0.78412463946685806, 0.68802576648512492},
+    {-0.26233788728265828, -0.3505090595029503,
+     0.76152205773301385, 0.66904307843438848},
+    {-0.2786066653246474, -0.36677783754493942,
+     0.81310217980301125, 0.72013237939523911},
+    {-0.29749949571688739, -0.3856706679371793,
+     0.71986859251004054, 0.62629096113569838},
+    {-0.31039577753717718, -0.3985669497574692,
+     -0.44044647919836311, -0.53446297314666735},
+    {-0.34570633935606476, -0.43387751157635668,
+     -0.40415793695578983, -0.49947934455625487},
+    {-0.32263010749706056, -0.41080127971735259,
+     -0.49267507614213213, -0.58712631390030068},
+    {-0.35822103558510221, -0.44639220780539413,
+     -0.45724429432024916, -0.55306582874313015},
+    {-0.26247208688489065, -0.35064325910518257,
+     -0.42412971606225969, -0.51661262294475563},
+    {-0.29727448553046898, -0.38544565775076101,
+     -0.38871336855917926, -0.48228351707268147},
+    {-0.27468256321065276, -0.36285373543094468,
+     -0.47574166074198382, -0.56859034574219181},
+    {-0.36721892143344514, -0.45539009365373706,
+     -0.31058717678629993, -0.40678090038547271},
+    {-0.40274797085137781, -0.49091914307166984,
+     -0.26800666381570354, -0.36577693282489182},
+    {-0.3816902687001672, -0.46986144092045912,
+     -0.36551260054335144, -0.46232755119137503},
+    {-0.41810117824788307, -0.50627235046817498,
+     -0.32440292211188693, -0.42290944325558255},
+    {-0.31710682518745648, -0.4052779974077485,
+     -0.297470346128626, -0.39172307152731467},
+    {-0.35150829390958671, -0.43967946612987874,
+     -0.25593519715848617, -0.35148595799770327},
+    {-0.33197520980024453, -0.42014638202053656,
+     -0.35079912112922668, -0.44559474848033825},
+    {-0.38064357388226344, -0.46881474610255536,
+     -0.56370325037616609, -0.66047231822846175},
+    {-0.41687233224314013, -0.50504350446343216,
+     -0.52865025578284774, -0.62709658432970727},
+    {-0.3907520277047094, -0.47892319992500143,
+     -0.61846553187828823, -0.7156840047476426},
+    {-0.42576899094167886, -0.51394016316197078,
+     -0.58144532555632544, -0.68033249057260958},
+    {-0.33407898963172677, -0.4222501618520188,
+     -0.54609046726541044, -0.64096511519108879},
+    {-0.36947172365657088, -0.4576428958768628,
+     -0.50976481480580793, -0.60605339910696288},
+    {-0.34461222248092527, -0.43278339470121718,
+     -0.6004197672958308, -0.69569840647016223},
+    {-0.44435852899288086, -0.53252970121317289,
+     -0.43744173352432059, -0.53728859538126672},
+    {-0.48260931347941827, -0.57078048569971029,
+     -0.39732993575631881, -0.49932404371959715},
+    {-0.45514258844109168, -0.5433137606613837,
+     -0.49336703214614941, -0.59379523180683491},
+    {-0.49401761533714572, -0.58218878755743775,
+     -0.45540298954249303, -0.55808493263397907},
+    {-0.39482473084566538, -0.4829959030659573,
+     -0.42038139028956728, -0.51778493133752501},
+    {-0.4319983198793188, -0.52016949209961083,
+     -0.38100181925664328, -0.48020470030516399},
+    {-0.40656056244628391, -0.49473173466657583,
+     -0.47486544613202958, -0.57281536396123389},
+    {-0.1764330237184637, -0.26460419593875573,
+     -0.44235612753820097, -0.53271542773457192},
+    {-0.21382980406536886, -0.3020009762856608,
+     -0.40798851702173122, -0.49917581955335166},
+    {-0.18783253926450527, -0.27600371148479724,
+     -0.49407114024400117, -0.58466782910975301},
+    {-0.22586363354809724, -0.31403480576838927,
+     -0.45896757299980179, -0.55045190141998612},
+    {-0.12666840447597016, -0.21483957669626214,
+     -0.4259110271520346, -0.51538340285424422},
+    {-0.16472882646274703, -0.25289999868303903,
+     -0.39202488367133342, -0.48215389462211017},
+    {-0.13774423108298928, -0.22591540330328125,
+     -0.47702003398033077, -0.5666691202909635},
+    {-0.23535772344022085, -0.32352889566051279,
+     -0.32347890819393682, -0.4152083446999037},
+    {-0.26802147550421718, -0.3561926477245092,
+     -0.28499959829092264, -0.37764667308331995},
+    {-0.24977422175323158, -0.33794539397352363,
+     -0.37399513079925928, -0.46611521276768808},
+    {-0.28311918665607216, -0.37129035887636408,
+     -0.33680480620055231, -0.42991604939633155},
+    {-0.18889140148685843, -0.27706257370715037,
+     -0.3107758020048299, -0.40139520276133234},
+    {-0.22018505579417103, -0.30835622801446305,
+     -0.27312794635623922, -0.36447022377643051},
+    {-0.20146287202632718, -0.2896340442466192,
+     -0.35853705481932185, -0.44943478189185271},
+    {-0.24840865640700871, -0.33657982862730063,
+     -0.5646516383811766, -0.6567337533758244},
+    {-0.28626683553303189, -0.37443800775332392,
+     -0.52861121305153569, -0.62182249794521893},
+    {-0.2586706124730489, -0.34684178469334093,
+     -0.61883449968198323, -0.7112069221734294},
+    {-0.29709329723114031, -0.38526446945143222,
+     -0.58247989851687343, -0.67604402580764333},
+    {-0.19880531891784797, -0.28697649113813994,
+     -0.54694096254514957, -0.63777851288971843},
+    {-0.23743288142013949, -0.32560405364043155,
+     -0.51126988058613732, -0.60305416947794122},
+    {-0.2092329858594377, -0.29740415807972964,
+     -0.60070071200471342, -0.69177853644019605},
+    {-0.36987030161466394, -0.45804147383495597,
+     2.0180652429529404, 1.9217598049912392},
+    {-0.37563794562807729, -0.4638091178483692,
+     1.9800187061536487, 1.8834670043954835},
+    {-0.34436975405124681, -0.43254092627153873,
+     2.0441796397408516, 1.9489104578954142},
+    {-0.33852849898836168, -0.4266996712086536,
+     1.9996382027988935, 1.9045946033555572},
+    {-0.40487932472513588, -0.49305049694542791,
+     2.0132656220749641, 1.9153951806198011},
+    {-0.37563794562807729, -0.4638091178483692,
+     1.9800187061536487, 1.8834670043954835},
+    {-0.38524868059540684, -0.47341985281569876,
+     2.0533139307721697, 1.9563418725420327},
+    {-0.42338416769436893, -0.51155533991466096,
+     1.925536302973007, 1.8267684621290574},
+    {-0.42930930229241449, -0.51748047451270651,
+     1.8811986821403148, 1.7821328049630565},
+    {-0.38112123964878186, -0.46929241186907378,
+     1.9397498426353443, 1.8429598544303258},
+    {-0.3862213402962924, -0.47439251251658443,
+     1.897200548078559, 1.8001852431748733},
+    {-0.45446576893061275, -0.54263694115090466,
+     1.9601419736973815, 1.8597508024275506},
+    {-0.46645669939919721, -0.55462787161948923,
+     1.9104670175192691, 1.8094088754366335},
+    {-0.41700694247462333, -0.50517811469491536,
+     1.9674750128309737, 1.8690221015051398},
+    {-0.27579332061499051, -0.36396449283528243,
+     2.05349555529039, 1.9606127644614078},
+    {-0.26988250975399564, -0.35805368197428755,
+     2.0084256364569031, 1.9157227361224876},
+    {-0.24582192132567893, -0.33399309354597084,
+     2.0809796756907217, 1.9889689242438819},
+    {-0.23334826582785184, -0.32151943804814387,
+     2.0360684544499716, 1.9443916952202112},
+    {-0.31725975222729896, -0.40543092444759099,
+     2.0711167502902321, 1.9768585784519102},
+    {-0.30411091975060411, -0.39228209197089603,
+     2.0268521431058613, 1.9330519858339092},
+    {-0.28849784515074606, -0.37666901737103797,
+     2.0988761231470581, 2.0055932396339329},
+    {-0.30604408507715763, -0.39421525729744966,
+     1.9335008740672601, 1.8396346744010825},
+    {-0.30594145435894371, -0.39411262657923574,
+     1.8851798771580199, 1.7913171948036544},
+    {-0.27049410523916062, -0.35866527745945254,
+     1.9614969792964549, 1.8687756480775155},
+    {-0.2704484098945783, -0.35861958211487033,
+     1.9134071226386271, 1.8206871699350748},
+    {-0.33982022708381576, -0.42799139930410779,
+     1.9531773601186297, 1.8580842469994776},
+    {-0.34405509484098939, -0.43222626706128131,
+     1.9123050037188598, 1.8170480838110752},
+    {-0.30541607111098146, -0.39358724333127337,
+     1.9807818418088723, 1.8869371455350503},
+    {-0.4663612552641736, -0.55453242748446563,
+     2.0508648250286221, 1.9498120843086186},
+    {-0.44172366206446712, -0.52989483428475914,
+     2.0080997847410105, 1.9083921817398892},
+    {-0.44535245838128301, -0.53352363060157504,
+     2.0932321147009754, 1.9933324399564665},
+    {-0.42838044213621551, -0.51655161435650754,
+     2.054218965857312, 1.9552001594215793},
+    {-0.50624093999519981, -0.59441211221549184,
+     2.047264863577178, 1.9438205290272745},
+    {-0.48043899703896875, -0.56861016925926078,
+     2.0025216930478775, 1.9006559005493824},
+    {-0.49072741782162965, -0.57889859004192168,
+     2.0957746073607124, 1.9932933586243433},
+    {-0.42338416769436893, -0.51155533991466096,
+     1.925536302973007, 1.8267684621290574},
+    {-0.3862213402962924, -0.47439251251658443,
+     1.897200548078559, 1.8001852431748733},
+    {-0.41700694247462333, -0.50517811469491536,
+     1.9674750128309737, 1.8690221015051398},
+    {-0.38112123964878186, -0.46929241186907378,
+     1.9397498426353443, 1.8429598544303258},
+    {-0.46645669939919721, -0.55462787161948923,
+     1.9104670175192691, 1.8094088754366335},
+    {-0.42930930229241449, -0.51748047451270651,
+     1.8811986821403148, 1.7821328049630565},
+    {-0.45446576893061275, -0.54263694115090466,
+     1.9601419736973815, 1.8597508024275506},
+    {-0.37224252740525143, -0.46041369962554335,
+     2.1276555870194471, 2.0312494014739988},
+    {-0.3576091766087709, -0.44578034882906292,
+     2.0889201639172916, 1.9931235526936255},
+    {-0.34241558599231903, -0.43058675821261094,
+     2.1642174656955153, 2.0690242322648058},
+    {-0.33006859833544655, -0.41823977055573847,
+     2.1169444791523051, 2.0222199910076006},
+    {-0.41682991236848144, -0.50500108458877346,
+     2.1311289953869283, 2.0326847407266286},
+    {-0.40093320365828733, -0.48910437587857925,
+     2.09095701980754, 1.9932715329012936},
+    {-0.38701488338762546, -0.47518605560791749,
+     2.1688677885099281, 2.0718171042459845},
+    {-0.37573230394187751, -0.46390347616216943,
+     -0.82054871421518083, -0.91710448203313533},
+    {-0.33649057061067933, -0.42466174283097124,
+     -0.85598754828912871, -0.95095345792282904},
+    {-0.36972313265903711, -0.45789430487932914,
+     -0.76575824922750357, -0.86205746175832665},
+    {-0.33077654262064438, -0.4189477148409364,
+     -0.80181766668859511, -0.89656851688066108},
+    {-0.4189431049982496, -0.50711427721854152,
+     -0.83924500712801475, -0.93779289684890987},
+    {-0.38053568160230111, -0.46870685382259303,
+     -0.8746354987383318, -0.97139984553507497},
+    {-0.41381812639073579, -0.5019892986110277,
+     -0.78446292803744844, -0.88276061262794148},
+    {-0.3008587646822769, -0.38902993690256893,
+     -0.94307166673012766, -1.0367617197758037},
+    {-0.26007039418526257, -0.34824156640555459,
+     -0.97600939167185663, -1.06842231076552},
+    {-0.29631959126295404, -0.38449076348324596,
+     -0.89070704491384467, -0.98424550378616915},
+    {-0.2554686163173514, -0.34363978853764343,
+     -0.92464473501073907, -1.0169253342928131},
+    {-0.34462922662497941, -0.43280039884527144,
+     -0.96137570678664974, -1.0566550094776019},
+    {-0.30442939897657817, -0.39260057119687009,
+     -0.99412466255355236, -1.0879356694647151},
+    {-0.34109700862967618, -0.42926818084996821,
+     -0.90926411107543559, -1.0044063717589131},
+    {-0.31601985057570847, -0.40419102279600039,
+     -0.69202500912984799, -0.78623910393030993},
+    {-0.27664885553550778, -0.36482002775579969,
+     -0.72836462423215975, -0.82127377953646441},
+    {-0.3070438743070002, -0.39521504652729211,
+     -0.6370564032459225, -0.73095693277774765},
+    {-0.26811280726469966, -0.35628397948499158,
+     -0.67351307426401641, -0.76616287968496855},
+    {-0.36250831578043474, -0.45067948800072677,
+     -0.71058391981174196, -0.80658146439181222},
+    {-0.32394657426159668, -0.4121177464818887,
+     -0.74705606422354243, -0.84155516648980222},
+    {-0.35411798287642926, -0.44228915509672118,
+     -0.65535929449351493, -0.75101462898591764},
+    {-0.24355353565711432, -0.33172470787740638,
+     -0.81851114637733502, -0.91045991392451453},
+    {-0.20222214022044327, -0.2903933124407353,
+     -0.85333173904153281, -0.94424679134157763},
+    {-0.23623122295901175, -0.32440239517930369,
+     -0.76428522655477027, -0.85603769601721591},
+    {-0.19502259823073603, -0.283193770451028,
+     -0.79970043144003633, -0.89045356894909278},
+    {-0.2907764583745035, -0.37894763059479541,
+     -0.83727657336707151, -0.93063317687160474},
+    {-0.24996812489588949, -0.3381392971161814,
+     -0.87206004461533493, -0.96418553416543074},
+    {-0.28421582286010105, -0.37238699508039297,
+     -0.78306024260330476, -0.87620621105246277},
+    {-0.49652306506194999, -0.58469423728224201,
+     -0.82184774163172025, -0.92468378713544563},
+    {-0.46030896717964798, -0.54848013939994,
+     -0.85789845093724837, -0.95861172589901955},
+    {-0.4918633163764865, -0.58003448859677853,
+     -0.76646592204340658, -0.86901624375702535},
+    {-0.45611179241130961, -0.54428296463160164,
+     -0.80316206939160317, -0.90364342140011045},
+    {-0.53500619637097535, -0.62317736859126738,
+     -0.84051200790677727, -0.94585894095067624},
+    {-0.4997671792831484, -0.58793835150344043,
+     -0.8765011231314801, -0.97953835520663324},
+    {-0.53127493559390859, -0.61944610781420062,
+     -0.78513649029663646, -0.8902277576222446},
+    {-0.42541216789396685, -0.51358334011425877,
+     -0.94607702063388477, -1.0449462779559646},
+    {-0.3866611240228115, -0.47483229624310341,
+     -0.97954977707420698, -1.0765846785795683},
+    {-0.42279220061174205, -0.51096337283203397,
+     -0.89321231956703329, -0.99195067299456474},
+    {-0.38416116046643611, -0.47233233268672803,
+     -0.92772325794458044, -1.0246471167021054},
+    {-0.46478684021945982, -0.55295801243975184,
+     -0.96431834095867619, -1.0652821984613643},
+    {-0.42687302709573105, -0.51504419931602308,
+     -0.99758735729037951, -1.0965300509335989},
+    {-0.4631791913888279, -0.55135036360911993,
+     -0.9117102547775825, -1.0125837718433621},
+    {-0.44361626360217132, -0.53178743582246335,
+     -0.69218074587271072, -0.79198826781352216},
+    {-0.40739821170175405, -0.49556938392204608,
+     -0.72918207641820043, -0.82717174368211022},
+    {-0.43533642126872973, -0.52350759348902165,
+     -0.63661161327229254, -0.73598609799491732},
+    {-0.39969501579725386, -0.48786618801754578,
+     -0.67373631532270017, -0.77136422543113936},
+    {-0.48576233884436737, -0.5739335110646594,
+     -0.710685868610195, -0.81286782863943741},
+    {-0.45054993883529737, -0.5387211110555894,
+     -0.7478119176911443, -0.84799029050020225},
+    {-0.47822746262929028, -0.56639863484958231,
+     -0.65485242682403955, -0.75658829093424973},
+    {-0.38328493221883375, -0.47145610443912567,
+     1.3011590242603654, 1.2042738822466501},
+    {-0.38980443829397082, -0.47797561051426285,
+     1.3608648358319659, 1.2636890907520681},
+    {-0.42622181120231939, -0.51439298342261142,
+     1.2648874678550621, 1.1659775499049574},
+    {-0.43357210711349414, -0.52174327933378617,
+     1.325760711541244, 1.2264771376540202},
+    {-0.33280044900093941, -0.42097162122123144,
+     1.2777780186685119, 1.1829514600295601},
+    {-0.33984394562543974, -0.42801511784573176,
+     1.3361083856298934, 1.2410143613810354},
+    {-0.37543603589641494, -0.46360720811670697,
+     1.241815716584836, 1.1452727114218206},
+    {-0.35029869098417432, -0.43846986320446635,
+     1.4527024962680271, 1.3571999078425523},
+    {-0.35366731089866488, -0.44183848311895679,
+     1.5101834764863884, 1.4145462638972532},
+    {-0.39493698131643318, -0.4831081535367252,
+     1.4205101703462992, 1.3231014956385889},
+    {-0.39866439460540826, -0.48683556682570017,
+     1.4796745572227286, 1.382094406124641},
+    {-0.30156188945225215, -0.38973306167254418,
+     1.4268300127449163, 1.3331162607352927},
+    {-0.30580801057445128, -0.3939791827947432,
+     1.4834475467026458, 1.3895894357985439},
+    {-0.34568953458628782, -0.43386070680657984,
+     1.3945489259822215, 1.2992281764242524},
+    {-0.51872202938051093, -0.60689320160080296,
+     1.2512858083579694, 1.1470350400721638},
+    {-0.52640541295217891, -0.61457658517247093,
+     1.3149127593186656, 1.2101511032824728},
+    {-0.55946517024819176, -0.64763634246848378,
+     1.2119498898926624, 1.104858379524869},
+    {-0.56829911018416113, -0.65647028240445315,
+     1.2766503025125864, 1.1688984105442983},
+    {-0.46832392168363612, -0.55649509390392815,
+     1.2273130480077237, 1.1261489345439784},
+    {-0.47665449720948849, -0.56482566942978052,
+     1.2892313502429871, 1.1875873946288489},
+    {-0.50927555635680266, -0.59744672857709469,
+     1.1884708428914037, 1.0848330679865612},
+    {-0.4882840481024211, -0.57645522032271312,
+     1.4140540070012635, 1.3117205755644334},
+    {-0.49150735562283976, -0.57967852784313179,
+     1.4759943261877688, 1.3734656743787101},
+    {-0.53223282367399405, -0.62040399589428608,
+     1.3788472822635065, 1.2736906386089661},
+    {-0.53616557434206447, -0.62433674656235649,
+     1.4425700118128497, 1.3371430854854487},
+    {-0.43939347268579021, -0.52756464490608213,
+     1.3868321280403075, 1.2872467823637932},
+    {-0.44364813558526117, -0.5318193078055532,
+     1.4476486035992546, 1.3478393942165336},
+    {-0.48332882229680008, -0.5714999945170921,
+     1.3516389309222803, 1.2496021059565281},
+    {-0.27413394181312178, -0.36230511403341381,
+     1.1992267355030126, 1.1063948444496159},
+    {-0.2824513843927221, -0.37062255661301413,
+     1.2555605371873058, 1.1624703726034951},
+    {-0.3154369790297975, -0.40360815125008942,
+     1.1629984715681148, 1.0688050328985561},
+    {-0.3246309212641415, -0.41280209348443353,
+     1.2199504969649331, 1.1254264290927116},
+    {-0.22425545418305412, -0.31242662640334606,
+     1.1795804955330549, 1.0881367402949824},
+    {-0.23255873551384809, -0.32072990773414012,
+     1.2344489360941142, 1.1427927563518323},
+    {-0.26499557992144107, -0.35316675214173299,
+     1.1438538566877101, 1.0512967226978112},
+    {-0.24689274206518352, -0.33506391428547544,
+     1.346014747528232, 1.2539745421103983},
+    {-0.25277556123397393, -0.34094673345426596,
+     1.4020300681688578, 1.3098258247907133},
+    {-0.28984447557857129, -0.37801564779886321,
+     1.3125158971420907, 1.2191895187291415},
+    {-0.29623254419092937, -0.3844037164112214,
+     1.3697299946104611, 1.2761944192209893},
+    {-0.19798573646841233, -0.28615690868870436,
+     1.3233617523980064, 1.2325426149655505},
+    {-0.20425598321933588, -0.29242715543962783,
+     1.378271487679549, 1.2873097354647873},
+    {-0.24013258747289234, -0.32830375969318426,
+     1.2900383206285022, 1.1981819800146016},
+    {-0.40729984877408809, -0.49547102099438001,
+     1.1454850662917802, 1.0475000719331498},
+    {-0.41742411135339652, -0.50559528357368844,
+     1.2046567242539472, 1.1061833953922464},
+    {-0.44717373734718791, -0.53534490956747982,
+     1.1067400630328696, 1.0067432121148612},
+    {-0.4584469441759762, -0.54661811639626823,
+     1.166343421702712, 1.0657333871400485},
+    {-0.35615933918807474, -0.44433051140836666,
+     1.1258162933761451, 1.0300785444616798},
+    {-0.3663521847210256, -0.45452335694131751,
+     1.1832426777623153, 1.0870852709092114},
+    {-0.39600185638540886, -0.48417302860570088,
+     1.0877452923957023, 0.99028782868985055},
+    {-0.39747568836970981, -0.48564686059000173,
+     0.23868386986423823, 0.14115861687358744},
+    {-0.37190375546347443, -0.46007492768376645,
+     0.19013871376270841, 0.093746961850004418},
+    {-0.37150243429976271, -0.45967360652005462,
+     0.28309516220006337, 0.18672048897511614},
+    {-0.34699530309455484, -0.43516647531484676,
+     0.23424508202058775, 0.13887309369950718},
+    {-0.44795149247011579, -0.53612266469040781,
+     0.24346716249426179, 0.14342865486944753},
+    {-0.42264787956559058, -0.51081905178588261,
+     0.19319949065807868, 0.094468318322067091},
+    {-0.4221368583470585, -0.51030803056735052,
+     0.28840523902940324, 0.18969946904298196},
+    {-0.36803188051842717, -0.45620305273871919,
+     0.094437502927748801, -0.0017903747705590931},
+    {-0.33911847613228041, -0.42728964835257244,
+     0.046390134763767341, -0.048676053219509741},
+    {-0.34514485621459745, -0.43331602843488937,
+     0.14208827455090445, 0.046788834062544069},
+    {-0.31738735153664821, -0.40555852375694013,
+     0.09474307957670712, 0.00048036116756727809},
+    {-0.41979966080295883, -0.50797083302325075,
+     0.09424144109965335, -0.0043486434251519407},
+    {-0.39065192446970443, -0.47882309668999634,
+     0.04448281168923085, -0.052731141522379434},
+    {-0.39594642604164698, -0.48411759826193901,
+     0.1434449503151165, 0.045990030174070884},
+    {-0.29159563916162234, -0.37976681138191426,
+     0.32228950523021377, 0.22890625173959842},
+    {-0.26800829457432562, -0.35617946679461754,
+     0.27329212221545007, 0.18064544142817568},
+    {-0.26179400442974754, -0.34996517665003957,
+     0.36676425812401542, 0.2743011760364516},
+    {-0.23883092409970519, -0.3270020963199971,
+     0.31695380757481006, 0.22513230436673085},
+    {-0.34391283223591673, -0.43208400445620865,
+     0.32790908524070672, 0.23265770502501057},
+    {-0.32003959345211286, -0.40821076567240477,
+     0.27806042569413431, 0.18370275610734899},
+    {-0.31481525739482608, -0.40298642961511799,
+     0.37295022761442514, 0.27877877663077971},
+    {-0.27154116260557304, -0.35971233482586507,
+     0.18399706886773409, 0.091244086211528852},
+    {-0.24734362819782374, -0.33551480041811566,
+     0.13995823827134796, 0.047905593561632667},
+    {-0.24427418163396419, -0.33244535385425611,
+     0.2261008504457292, 0.13413245150268238},
+    {-0.22059988824747476, -0.3087710604677667,
+     0.18081616881822268, 0.089463628894784292},
+    {-0.32221698252158459, -0.41038815474187662,
+     0.18738986731636928, 0.092953606360778041},
+    {-0.29554651497784634, -0.38371768719813837,
+     0.14093367614052729, 0.047420794838480329},
+    {-0.29584153364578258, -0.38401270586607461,
+     0.23005351588086045, 0.13653088200145444},
+    {-0.52221955326705194, -0.61039072548734397,
+     0.3010837280128762, 0.19660178439386691},
+    {-0.4990911449905181, -0.58726231721081013,
+     0.24871930398168574, 0.14572415110442916},
+    {-0.49551078655279468, -0.58368195877308671,
+     0.34656736856592729, 0.24379371849511497},
+    {-0.47170796991907549, -0.55987914213936751,
+     0.29399913820339185, 0.19264149867665867},
+    {-0.57297902021234992, -0.66115019243264195,
+     0.30881786824594643, 0.20070938523765608},
+    {-0.55063420642389194, -0.63880537864418396,
+     0.25449332728026353, 0.14804568259805828},
+    {-0.54350831152960966, -0.63167948374990168,
+     0.35341669482637245, 0.24747699061343692},
+    {-0.50022453101013065, -0.58839570323042267,
+     0.14686872737636553, 0.043802981594378232},
+    {-0.47244280163390806, -0.56061397385420009,
+     0.094170632004797056, -0.0072292823659766831},
+    {-0.47421444100010934, -0.56238561322040137,
+     0.19660864169699099, 0.095106434280046614},
+    {-0.44772492982227163, -0.53589610204256355,
+     0.14502906845021146, 0.045002705390384964},
+    {-0.55316647931273033, -0.64133765153302236,
+     0.14899513458197233, 0.042364504611838348},
+    {-0.5256856927170056, -0.61385686493729763,
+     0.094242088707529259, -0.010471236085119094},
+    {-0.52634342557955327, -0.6145145977998453,
+     0.20040691065962152, 0.0956494211418773},
+    {-0.41875856638242381, -0.50692973860271573,
+     0.38626164175102878, 0.28772282839652713},
+    {-0.39550354083794215, -0.48367471305823406,
+     0.33382240439596594, 0.23638779167136653},
+    {-0.38975362201315211, -0.47792479423344414,
+     0.43247151827834768, 0.33529806103156362},
+    {-0.36722870437020061, -0.45539987659049264,
+     0.37944597396193508, 0.28325183988327357},
+    {-0.46915675289393888, -0.5573279251142309,
+     0.39340690286227337, 0.2921953377443674},
+    {-0.44611170336586392, -0.53428287558615584,
+     0.34003883878579177, 0.24009871701690763},
+    {-0.44103197233251445, -0.52920314455280637,
+     0.44019920378370636, 0.34052797925972234},
+    {-0.40043474680647861, -0.48860591902677064,
+     1.70411205253549, 1.6064497704712086},
+    {-0.39806529303936822, -0.48623646525966024,
+     1.755727529812886, 1.6581750720188155},
+    {-0.44573918521523304, -0.53391035743552495,
+     1.6800621900838104, 1.5801419246488857},
+    {-0.44301772648175641, -0.53118889870204833,
+     1.733778042257635, 1.6340021800712423},
+    {-0.35675820401326364, -0.44492937623355566,
+     1.675201060163467, 1.5794390309583304},
+    {-0.35571597278929445, -0.44388714500958637,
+     1.7268272201321766, 1.6311074169607114},
+    {-0.40179507947894133, -0.48996625169923336,
+     1.6504662677139821, 1.5527405742541298},
+    {-0.35115635096982356, -0.43932752319011559,
+     1.8239301096689959, 1.7283933843826023},
+    {-0.34786794815420974, -0.43603912037450165,
+     1.8692261079365562, 1.7738197553112787},
+    {-0.39481851919077426, -0.48298969141106618,
+     1.8051669776919224, 1.7077637206759713},
+    {-0.390827503685097, -0.47899867590538892,
+     1.8523389910579435, 1.7551171095284606},
+    {-0.31046737825804593, -0.39863855047833796,
+     1.7960099811567931, 1.7019909954150154},
+    {-0.30847540074761248, -0.3966465729679044,
+     1.8416523111135668, 1.7477024197973439},
+    {-0.35381046112370607, -0.44198163334399809,
+     1.77644164801361, 1.6807986820815657},
+    {-0.53401850198002021, -0.62218967420031224,
+     1.6857761111283585, 1.5804971185133481},
+    {-0.52964781276046724, -0.61781898498075927,
+     1.7417387317585304, 1.6367581096577175},
+    {-0.57951376875814142, -0.66768494097843345,
+     1.6595054727787866, 1.5508911035514119},
+    {-0.57506281945378657, -0.66323399167407859,
+     1.7178743736721058, 1.6096055881069016},
+    {-0.4913625498104065, -0.57953372203069853,
+     1.65458016243173, 1.5520603196624583},
+    {-0.48842461978688556, -0.57659579200717759,
+     1.7104959488204343, 1.6081540412935962},
+    {-0.53701549341762678, -0.6251866656379188,
+     1.6275625336047781, 1.5220767983025072},
+    {-0.47914645299275516, -0.56731762521304718,
+     1.8154420788443113, 1.7136523244622073},
+    {-0.47314581060265692, -0.56131698282294895,
+     1.8642205826678622, 1.7627801399050675},
+    {-0.52408962254184521, -0.61226079476213724,
+     1.7952489411584407, 1.6906424448793429},
+    {-0.51753330787891316, -0.60570448009920519,
+     1.8461783098256201, 1.7420055897435314},
+    {-0.43927142222270765, -0.52744259444299968,
+     1.7852778280582824, 1.6856988628079617},
+    {-0.43465220255893255, -0.52282337477922458,
+     1.8344399799259699, 1.7351008078020289},
+    {-0.48429592575364933, -0.57246709797394135,
+     1.7641692241268589, 1.6620748428376639},
+    {-0.31109671161412422, -0.39926788383441625,
+     1.5938658198537026, 1.4998249061052629},
+    {-0.3122265567244159, -0.40039772894470782,
+     1.6470681300238112, 1.5529877296160013},
+    {-0.35582419631453566, -0.44399536853482768,
+     1.566632630229986, 1.4709084489488407},
+    {-0.35682728118276763, -0.44499845340305966,
+     1.6217294526579391, 1.5259646197960881},
+    {-0.264882947014765, -0.35305411923505703,
+     1.5668826992331337, 1.4743288933853771},
+    {-0.26709944672883201, -0.35527061894912393,
+     1.6197298177766786, 1.527110257443282},
+    {-0.30897564415141265, -0.39714681637170468,
+     1.539232592211468, 1.445265393885792},
+    {-0.26906703804827869, -0.35723821026857061,
+     1.7207684264890846, 1.628090035692078},
+    {-0.26895574959826107, -0.3571269218185531,
+     1.7686120881365859, 1.6759370364033981},
+    {-0.31243903650670479, -0.40061020872699671,
+     1.6986069140518405, 1.6045190706190173},
+    {-0.31182109219728815, -0.39999226441758007,
+     1.7482989141379446, 1.6542327018320133},
+    {-0.22578320102410565, -0.31395437324439768,
+     1.6938745460569802, 1.6023922533669612},
+    {-0.22683600960955819, -0.31500718182985021,
+     1.7417653087047411, 1.6502563156330032},
+    {-0.26847284801576321, -0.35664402023605513,
+     1.6710906400397598, 1.5784300610555686},
+    {-0.44752760069793029, -0.53569877291822221,
+     1.5667786112129676, 1.4667628191123652},
+    {-0.44728782777995557, -0.5354590000002476,
+     1.6243133068624669, 1.5243103511970255},
+    {-0.49303499396787165, -0.58120616618816368,
+     1.5369991486954899, 1.434377341862175},
+    {-0.49294759302964519, -0.58111876524993722,
+     1.5966488480990075, 1.4940323819796468},
+    {-0.40100740581120764, -0.48917857803149956,
+     1.5379575065715145, 1.4402685622869065},
+    {-0.40202226227807736, -0.49019343449836938,
+     1.5949939520360386, 1.4972576428805695},
+    {-0.44634308287188762, -0.53451425509217954,
+     1.5077681473982047, 1.4078156814502853},
+    {-0.41465027325765413, -0.50282144547794605,
+     -1.9936642525050852, -2.0920023011235651},
+    {-0.36988132474730828, -0.45805249696760031,
+     -2.0094792640051731, -2.1057851683755429},
+    {-0.42410355274525635, -0.51227472496554838,
+     -1.9378879606677879, -2.0366917062832202},
+    {-0.37912097519588905, -0.46729214741618108,
+     -1.956106343119451, -2.0528089331334769},
+    {-0.4502079847505458, -0.53837915697083782,
+     -2.0332298398159825, -2.1333897454461468},
+    {-0.40418656408507625, -0.49235773630536828,
+     -2.0479243795327928, -2.1457621903559767},
+    {-0.46097925235752979, -0.54915042457782182,
+     -1.976403641837065, -2.0771542183913434},
+    {-0.31721160809801174, -0.40538278031830377,
+     -2.0737134172402714, -2.1679698741377029},
+    {-0.27641427049455658, -0.36458544271484861,
+     -2.0850730826608519, -2.1779750006514149},
+    {-0.32679306507602568, -0.4149642372963176,
+     -2.0240100153739005, -2.1186133382893746},
+    {-0.28546634412120242, -0.37363751634149445,
+     -2.0373966022822882, -2.1305823372279775},
+    {-0.34908319768689922, -0.43725436990719124,
+     -2.111577156804576, -2.2070315277494306},
+    {-0.3070986856875183, -0.39526985790781033,
+     -2.1218040489821925, -2.2157064640184521},
+    {-0.35982220756238537, -0.44799337978267728,
+     -2.0613714821172904, -2.1572584693799008},
+    {-0.39463512782377219, -0.48280630004406411,
+     -1.8459637575748451, -1.9433586313393938},
+    {-0.35115933755241768, -0.4393305097727096,
+     -1.8671651995872924, -1.9627020439120519},
+    {-0.40070127619593154, -0.48887244841622346,
+     -1.789810834435158, -1.8874855199479188},
+    {-0.35747217720977698, -0.44564334943006889,
+     -1.813138131295881, -1.9089291687347243},
+    {-0.43240339524760063, -0.52057456746789255,
+     -1.8808904480647373, -1.98011406253227},
+    {-0.38741058348461599, -0.4755817557049079,
+     -1.9015038822416168, -1.9985722409046065},
+    {-0.43942889492178738, -0.5276000671420793,
+     -1.823011081823976, -1.9225982796978676},
+    {-0.30193531736420309, -0.39010648958449512,
+     -1.9380527720809391, -2.0317791342728526},
+    {-0.26166821608296353, -0.34983938830325556,
+     -1.9542996364978618, -2.0467590465762409},
+    {-0.30915276483012399, -0.39732393705041591,
+     -1.8867865025431174, -1.9807598359106826},
+    {-0.26872553640035879, -0.3568967086206507,
+     -1.9049804350783257, -1.9976485839728524},
+    {-0.33572106970618454, -0.42389224192647657,
+     -1.9728683191034784, -2.0678050293803421},
+    {-0.29400767875900502, -0.38217885097929694,
+     -1.9883285464151499, -2.0817907224302368},
+    {-0.34387867503119229, -0.43204984725148421,
+     -1.9205028747048161, -2.0157529252251645},
+    {-0.53410047976989861, -0.62227165199019063,
+     -2.0600959948005282, -2.1653806191700791},
+    {-0.48551195656656176, -0.57368312878685379,
+     -2.0748373199529513, -2.1770043001834432},
+    {-0.54662801864916777, -0.6347991908694598,
+     -1.9994100401414865, -2.1055708589137208},
+    {-0.49774881774252555, -0.58591998996281758,
+     -2.0171226069437536, -2.1200344488728762},
+    {-0.56970874931567339, -0.65787992153596542,
+     -2.1053475196333062, -2.2132063243331768},
+    {-0.52026418643557204, -0.60843535865586407,
+     -2.1184964123110097, -2.2228488287947732},
+    {-0.58395221032107225, -0.67212338254136428,
+     -2.0438063448614026, -2.1527696869241391},
+    {-0.42569205297255097, -0.513863225192843,
+     -2.141161390745085, -2.2400446929019542},
+    {-0.38086343809932399, -0.46903461031961602,
+     -2.1509748652968779, -2.2477535586876844},
+    {-0.43838361928567471, -0.52655479150596662,
+     -2.0882250101550488, -2.1877576329693191},
+    {-0.39286971894978362, -0.48104089117007565,
+     -2.100424528653952, -2.1977389424719256},
+    {-0.45803417449392525, -0.54620534671421728,
+     -2.1835514227433785, -2.2841386470279508},
+    {-0.41232164762233259, -0.5004928198426245,
+     -2.1918736446255931, -2.290098995526197},
+    {-0.47220199957358056, -0.56037317179387258,
+     -2.1303807086286932, -2.2317667597500108},
+    {-0.51818949018450355, -0.60636066240479558,
+     -1.8963491762448719, -2.0005649467980864},
+    {-0.47052309516025204, -0.55869426738054406,
+     -1.9180363637404647, -2.0193260267851083},
+    {-0.52604385282827326, -0.61421502504856529,
+     -1.83404685231336, -1.9387842162105124},
+    {-0.47868632901326569, -0.56685750123355771,
+     -1.8584753799793232, -1.9602381344748399},
+    {-0.55761765258807561, -0.64578882480836763,
+     -1.9367712570394062, -2.0437267305873723},
+    {-0.50870453556735729, -0.59687570778764931,
+     -1.9575111658459958, -2.0611124131296741},
+    {-0.56686749592566932, -0.65503866814596134,
+     -1.8725945558212378, -1.9802383037947942},
+    {-0.42378662928132249, -0.51195780150161441,
+     -1.1868666270160597, -1.2856545453485766},
+    {-0.46016391340947882, -0.54833508562977085,
+     -1.1527218547475089, -1.2534270670080327},
+    {-0.43203183664075162, -0.52020300886104354,
+     -1.2426827013779163, -1.3418872970052782},
+    {-0.46932890704376162, -0.55750007926405365,
+     -1.2081120709759576, -1.3093334591137176},
+    {-0.37721069125416951, -0.46538186347446153,
+     -1.1661173056050995, -1.2627369367640575},
+    {-0.41447095367912856, -0.50264212589942059,
+     -1.1325657284848814, -1.2308950704891628},
+    {-0.38561305994274264, -0.47378423216303467,
+     -1.2209091808215704, -1.3178974249250537},
+    {-0.48349813071164027, -0.5716693029319323,
+     -1.0656049885715262, -1.1676518782031462},
+    {-0.51516828012193772, -0.60333945234222974,
+     -1.03234987507027, -1.1363680975019919},
+    {-0.49466010350969969, -0.58283127572999172,
+     -1.118557243836009, -1.2212785988652468},
+    {-0.52722792949095021, -0.61539910171124224,
+     -1.0844550670803221, -1.1892720785940669},
+    {-0.43876834499873119, -0.5269395172190231,
+     -1.0472705425017295, -1.1468232326872063},
+    {-0.47144677253721368, -0.5596179447575057,
+     -1.0147194489241282, -1.1160620834441024},
+    {-0.44992209355986212, -0.53809326578015404,
+     -1.0990356631786256, -1.1991801435092171},
+    {-0.48384492349079211, -0.57201609571108414,
+     -1.3228636141123136, -1.4249311344364817},
+    {-0.52110890665576115, -0.60928007887605318,
+     -1.287662474225387, -1.3920707581503939},
+    {-0.48896630197632074, -0.57713747419661277,
+     -1.3815360570617785, -1.4839106586063293},
+    {-0.527097320409876, -0.61526849263016803,
+     -1.3464509791673387, -1.4512591920287101},
+    {-0.43907176551016991, -0.52724293773046182,
+     -1.2997173708242895, -1.3992859035901242},
+    {-0.47726574645314424, -0.56543691867343626,
+     -1.2649337866166828, -1.3666134079551557},
+    {-0.44479578908160367, -0.53296696130189569,
+     -1.3576296100119127, -1.45749968684617},
+    {-0.54805471420913132, -0.63622588642942335,
+     -1.1945788196211566, -1.3008414108260409},
+    {-0.58051576972843655, -0.66868694194872857,
+     -1.1591835774370061, -1.2678763465573357},
+    {-0.55648109003068558, -0.6446522622509776,
+     -1.2521103136478962, -1.3589824522098604},
+    {-0.58989358139511916, -0.67806475361541119,
+     -1.2162959652389094, -1.3257333611431235},
+    {-0.50475667572349858, -0.59292784794379061,
+     -1.1733900045785548, -1.2767403342242161},
+    {-0.53824938558460733, -0.62642055780489936,
+     -1.1386025319970716, -1.2441738974427692},
+    {-0.51362198770900203, -0.60179315992929405,
+     -1.2298586709130774, -1.3337764417586857},
+    {-0.29019271709046823, -0.37836388931076026,
+     -1.1787886434162849, -1.2721263038566299},
+    {-0.32984315524110219, -0.41801432746139411,
+     -1.1458582362980099, -1.2405743425574285},
+    {-0.29772259569556714, -0.38589376791585905,
+     -1.232971670881704, -1.3265567274517718},
+    {-0.33824603772547379, -0.42641720994576582,
+     -1.1996119220769934, -1.2946447223923814},
+    {-0.24173314020559064, -0.3299043124258827,
+     -1.1584363289134785, -1.2503357561265849},
+    {-0.28194658451733323, -0.37011775673762526,
+     -1.1260829787517028, -1.2191572436297242},
+    {-0.2491131558751811, -0.33728432809547315,
+     -1.2116292603993846, -1.3037309373197452},
+    {-0.35782584689731722, -0.44599701911760914,
+     -1.0615134952184027, -1.1573189266115917},
+    {-0.3932421542291652, -0.48141332644945722,
+     -1.0294364015619741, -1.1267677531113194},
+    {-0.36789923561578408, -0.456070407836076,
+     -1.1129123284581459, -1.2091346274710919},
+    {-0.40423614387430462, -0.49240731609459654,
+     -1.0800252989542409, -1.1778654428176667},
+    {-0.31093231533203314, -0.39910348755232505,
+     -1.0434876589487314, -1.1375228400189679},
+    {-0.34714177598532281, -0.43531294820561472,
+     -1.0120875185480105, -1.1074652680936485},
+    {-0.320692241501779, -0.40886341372207102,
+     -1.0937519792509069, -1.1881331450358388},
+    {-0.35229164189675932, -0.44046281411705124,
+     -1.311035752060338, -1.4066178102924995},
+    {-0.39297056423064469, -0.48114173645093661,
+     -1.2770176558455011, -1.374336654022869},
+    {-0.35771689690195752, -0.44588806912224954,
+     -1.3680831684326895, -1.4638841639467128},
+    {-0.39916624173578674, -0.48733741395607866,
+     -1.3341264722188841, -1.4317298601364288},
+    {-0.30441989946433812, -0.39259107168463014,
+     -1.288364985510382, -1.3821756686274445},
+    {-0.34576848933012105, -0.43393966155041308,
+     -1.2547682663837116, -1.3500921079705683},
+    {-0.3101832219870061, -0.39835439420729812,
+     -1.3446600482332323, -1.4386691486028385},
+    {-0.44762984208862788, -0.5358010143089198,
+     -2.6895938164652509, -2.7896150848917221},
+    {-0.4130355515616968, -0.50120672378198872,
+     -2.7378390916201303, -2.8360989089987623},
+    {-0.42720704837014867, -0.51537822059044058,
+     -2.63309501617436, -2.7320545458233494},
+    {-0.39373607179631331, -0.48190724401660523,
+     -2.6817637785966486, -2.7791176226181546},
+    {-0.50148658306192773, -0.58965775528221975,
+     -2.6977409821220824, -2.8008856047520605},
+    {-0.46666995507385889, -0.55484112729415092,
+     -2.7473167488730148, -2.8483869649080953},
+    {-0.48125561090936064, -0.56942678312965267,
+     -2.639520089448478, -2.7414340683223681},
+    {-0.39479591464748065, -0.48296708686777268,
+     -2.8401072680901573, -2.9375094915441982},
+    {-0.35840172170303475, -0.44657289392332677,
+     -2.8832198865569172, -2.9790487903129419},
+    {-0.37779461015415172, -0.46596578237444375,
+     -2.7841407950111607, -2.8807857317783077},
+    {-0.34222907593232765, -0.43040024815261957,
+     -2.8284259067454003, -2.9236119168193881},
+    {-0.44744959717571997, -0.53562076939601189,
+     -2.8522796005665985, -2.9522912156935339},
+    {-0.41038197653209874, -0.49855314875239076,
+     -2.8962929774746389, -2.9944250575747189},
+    {-0.4309946855826311, -0.51916585780292301,
+     -2.7947961626628133, -2.8939477809638592},
+    {-0.35193409411114407, -0.44010526633143598,
+     -2.5735055006458425, -2.6690732638207044},
+    {-0.31983700491229128, -0.40800817713258331,
+     -2.6208961739490113, -2.7152465606304808},
+    {-0.32989123263013009, -0.41806240485042201,
+     -2.5218336880548207, -2.6165515812843139},
+    {-0.29885032142652346, -0.38702149364681537,
+     -2.5690025361655402, -2.6626252149844913},
+    {-0.40562826074680303, -0.49379943296709505,
+     -2.5781294942579289, -2.6760352897043016},
+    {-0.37329458039275942, -0.46146575261305145,
+     -2.6268926265419954, -2.7233437337525674},
+    {-0.38314165892314855, -0.47131283114344058,
+     -2.5249529601087981, -2.6218317815103149},
+    {-0.30643022804679632, -0.39460140026708834,
+     -2.7199888530251854, -2.8138682976242526},
+    {-0.27248982973186875, -0.36066100195216066,
+     -2.7640740352514399, -2.8568558016353665},
+    {-0.28712605340751918, -0.3752972256278112,
+     -2.6669604502094502, -2.7601992415679395},
+    {-0.25408318838721367, -0.34225436060750569,
+     -2.7115651976296786, -2.803806416680668},
+    {-0.3595155187795841, -0.44768669099987612,
+     -2.7287389269814999, -2.8246133514385359},
+    {-0.32485600785732904, -0.41302718007762096,
+     -2.7739096717937839, -2.8684419635912226},
+    {-0.34013031884157863, -0.42830149106187065,
+     -2.6742262932223748, -2.7693313238814299},
+    {-0.5884675735964362, -0.67663874581672823,
+     -2.653122572631561, -2.7624454612975904},
+    {-0.55498090164288916, -0.64315207386318118,
+     -2.7062340750018081, -2.8129966264034327},
+    {-0.56724762392166217, -0.6554187961419542,
+     -2.592827588837856, -2.7005000089537012},
+    {-0.53511555954483192, -0.62328673176512395,
+     -2.6461879497463374, -2.7515424172576224},
+    {-0.64100852148051335, -0.72917969370080538,
+     -2.6603523529614126, -2.774215709357585},
+    {-0.60779828127180502, -0.69596945349209705,
+     -2.7151067098605979, -2.8260218954049834},
+    {-0.62024597998152275, -0.70841715220181478,
+     -2.598049133753368, -2.7100368340615608},
+    {-0.53688915685167571, -0.62506032907196774,
+     -2.8175157902488865, -2.9229927748944173},
+    {-0.49987062504078716, -0.58804179726107919,
+     -2.8649798196202512, -2.9680234977799285},
+    {-0.52009229406576252, -0.60826346628605454,
+     -2.7572035877730112, -2.8615446522090595},
+    {-0.48413382895084922, -0.57230500117114125,
+     -2.8059086503032145, -2.9079933733513377},
+    {-0.58894827667126071, -0.67711944889155273,
+     -2.8296603230272557, -2.9390217601220709},
+    {-0.55174438833980322, -0.63991556056009524,
+     -2.8782495654926676, -2.984777271887578},
+    {-0.57298135122124783, -0.66115252344153985,
+     -2.7675361678201265, -2.8756448296209811},
+    {-0.49070505984438706, -0.57887623206467909,
+     -2.5313194985238554, -2.633799389951951},
+    {-0.45962476081465442, -0.54779593303494645,
+     -2.5828832836528788, -2.6835585574129919},
+    {-0.46670032431648367, -0.5548714965367757,
+     -2.4770572797525436, -2.5781292158196041},
+    {-0.43684938320402622, -0.52502055542431814,
+     -2.5281140588975957, -2.6275668823561409},
+    {-0.54439382524691815, -0.63256499746721018,
+     -2.5345734467927858, -2.6405757147999047},
+    {-0.51360435383543912, -0.60177552605573115,
+     -2.587778009410957, -2.6916946372609183},
+    {-0.5201949961412845, -0.60836616836157653,
+     -2.4786330607894609, -2.5829809071674807},
+    {-0.45347817676113611, -0.54164934898142802,
+     -1.5903520227646089, -1.6906892948462378},
+    {-0.41066198675909837, -0.49883315897939029,
+     -1.621737585289599, -1.7198830961879374},
+    {-0.45345331306266989, -0.54162448528296181,
+     -1.5327990360320058, -1.6331349531529538},
+    {-0.41098818165735862, -0.49915935387765054,
+     -1.5652083764848586, -1.66336954779042},
+    {-0.49566597306911309, -0.58383714528940511,
+     -1.616596207125369, -1.7193794109270912},
+    {-0.45211463171289457, -0.54028580393318659,
+     -1.6479009590484228, -1.7481640694561569},
+    {-0.49589131374192763, -0.58406248596221966,
+     -1.557396394779941, -1.6601934787758457},
+    {-0.36532321313663718, -0.4534943853569291,
+     -1.7062316533928865, -1.8023460750568818},
+    {-0.32101502421703043, -0.40918619643732235,
+     -1.7343627535329578, -1.8287555591127891},
+    {-0.36692412492630355, -0.45509529714659558,
+     -1.6521392461669357, -1.748320606443202},
+    {-0.32252678685812175, -0.41069795907841367,
+     -1.6815439092804887, -1.7759913994527659},
+    {-0.40554244652767679, -0.49371361874796882,
+     -1.7333924766550419, -1.8312942171063513},
+    {-0.36274662012993342, -0.45091779235022544,
+     -1.7587277910552075, -1.8547351897678062},
+    {-0.40912221538601112, -0.49729338760630304,
+     -1.6770660489978688, -1.7751378446862094},
+    {-0.4077379246751266, -0.49590909689541862,
+     -1.4499063710225848, -1.5479121876754938},
+    {-0.36501397550940939, -0.45318514772970142,
+     -1.4830595257690802, -1.5791610564501641},
+    {-0.40410877548401536, -0.49227994770430727,
+     -1.3918822087611722, -1.4897163598513483},
+    {-0.36197174621879213, -0.45014291843908416,
+     -1.4255500087397019, -1.5215253929622834},
+    {-0.45201211365657568, -0.54018328587686759,
+     -1.4745674525549806, -1.5748249990844756},
+    {-0.41002788697087733, -0.49819905919116925,
+     -1.507809843901329, -1.6059249562347786},
+    {-0.44912404002469908, -0.5372952122449911,
+     -1.4160445899347187, -1.5161460795875081},
+    {-0.32268205222850088, -0.41085322444879291,
+     -1.5717973739585946, -1.6662504963189841},
+    {-0.27784963302883303, -0.36602080524912506,
+     -1.602470672844613, -1.6954169717918426},
+    {-0.32119332579008608, -0.409364498010378,
+     -1.5154509482308189, -1.6098501889520123},
+    {-0.27654637068728993, -0.36471754290758196,
+     -1.5470364978177229, -1.6399424905373046},
+    {-0.36745321576259449, -0.45562438798288651,
+     -1.5967061281060919, -1.6929096858882675},
+    {-0.32310790737234918, -0.41127907959264109,
+     -1.6272653974806961, -1.7217339827021865},
+    {-0.36683373065474678, -0.45500490287503881,
+     -1.5402333273722388, -1.63641089895938},
+    {-0.5840506860653818, -0.67222185828567382,
+     -1.6108366232216125, -1.719807757748594},
+    {-0.53886748794934725, -0.62703866016963927,
+     -1.6450390280850919, -1.7506534016144728},
+    {-0.58329011014945142, -0.67146128236974345,
+     -1.5468889048484513, -1.6557999107318602},
+    {-0.53949467109121618, -0.62766584331150821,
+     -1.5829830273266845, -1.6886411178979248},
+    {-0.62928341161870471, -0.71745458383899674,
+     -1.6412325594627135, -1.7540230657764351},
+    {-0.58282818106391787, -0.6709993532842099,
+     -1.6759242511254466, -1.7847988015131622},
+    {-0.62907061577090662, -0.71724178799119864,
+     -1.5739151293672173, -1.6866864943462185},
+    {-0.49041676608825113, -0.57858793830854316,
+     -1.737386716602888, -1.8398491140990396},
+    {-0.44508816945456675, -0.53325934167485867,
+     -1.7646231699410397, -1.8645087864902736},
+    {-0.49385611568460874, -0.58202728790490077,
+     -1.6767328855277208, -1.7794049332202704},
+    {-0.44932358226293967, -0.5374947544832317,
+     -1.706120343626119, -1.8062325730639652},
+    {-0.53214777233091259, -0.62031894455120462,
+     -1.7710648148542478, -1.8762156465191684},
+    {-0.48534597676673341, -0.57351714898702544,
+     -1.7981158759706348, -1.9002729319595728},
+    {-0.53642908278255763, -0.62460025500284966,
+     -1.7078951658126347, -1.8133403100810577},
+    {-0.53567527738209308, -0.62384644960238511,
+     -1.4630182097286273, -1.5684112750641299},
+    {-0.49461559453448534, -0.58278676675477736,
+     -1.4995144075369136, -1.6022330299244891},
+    {-0.5315012571123473, -0.61967242933263933,
+     -1.4058348834434164, -1.510941581287532},
+    {-0.49256510400693632, -0.58073627622722834,
+     -1.4405560593298814, -1.5431491688648826},
+    {-0.58066764794692349, -0.66883882016721552,
+     -1.4845571454443176, -1.5932618174294082},
+    {-0.53839039838324809, -0.62656157060354012,
+     -1.5221774170470301, -1.627758587646597},
+    {-0.5763460287802592, -0.66451720100055123,
+     -1.4242443737423864, -1.5326123451563045},
+    {-0.47978791202182891, -0.56795908424212094,
+     2.3191169574825601, 2.217289502640325},
+    {-0.4644829487567258, -0.55265412097701783,
+     2.2679008798079434, 2.166954131625435},
+    {-0.44474844955775816, -0.53291962177805019,
+     2.3598431442945738, 2.2599755822493477},
+    {-0.43085043509244159, -0.5190216073127335,
+     2.3081332488969517, 2.2089889859345107},
+    {-0.52957831772890118, -0.61774948994919321,
+     2.3310873942851451, 2.2261114865096943},
+    {-0.51343418133693342, -0.60160535355722544,
+     2.2775432122012851, 2.1736376116712601},
+    {-0.49445847756208894, -0.58262964978238097,
+     2.3731321996679493, 2.2704232207341497},
+    {-0.47968123882637625, -0.56785241104666828,
+     2.1795165700989898, 2.0776953895989267},
+    {-0.46249984837950064, -0.55067102059979267,
+     2.1349541755906274, 2.0341187067555349},
+    {-0.44876192477250909, -0.53693309699280112,
+     2.2195191366724267, 2.1194371207681217},
+    {-0.43282077972675581, -0.52099195194704773,
+     2.1739503459974001, 2.0747053419743642},
+    {-0.52741830137774881, -0.61558947359804084,
+     2.1856250829060708, 2.0807952408905916},
+    {-0.50909445828014122, -0.59726563050043324,
+     2.1391737184572244, 2.0355475346605032},
+    {-0.49672601467636546, -0.58489718689665748,
+     2.2270241784397027, 2.1241756016004554},
+    {-0.36021707617564314, -0.44838824839593516,
+     2.386240183874734, 2.2903370035862807},
+    {-0.34849018911658824, -0.43666136133688016,
+     2.3363285937719858, 2.2408976780989494},
+    {-0.32367756623909438, -0.4118487384593863,
+     2.4239368727536363, 2.3294475684216871},
+    {-0.31320693936056698, -0.4013781115808589,
+     2.3738627066602556, 2.2797479188466818},
+    {-0.40853624372917596, -0.49670741594946799,
+     2.3996192680878887, 2.3015754351649309},
+    {-0.39602169857820246, -0.48419287079849449,
+     2.3476116968394543, 2.2501533225181714},
+    {-0.37139783372672397, -0.45956900594701589,
+     2.4383596358881365, 2.3419894105180057},
+    {-0.36960191016306931, -0.45777308238336123,
+     2.2509388834008948, 2.1546447965623945},
+    {-0.3560322478333624, -0.44420342005365443,
+     2.2063442952683183, 2.1106116931283441},
+    {-0.33637881109664625, -0.42454998331693827,
+     2.2887198370877004, 2.1937581728678004},
+    {-0.32403205146563152, -0.41220322368592355,
+     2.2434587994586295, 2.1489565820449776},
+    {-0.41647380215568186, -0.50464497437597378,
+     2.2590612650560025, 2.160634410018154},
+    {-0.40180642098764008, -0.48997759320793211,
+     2.2126483445541476, 2.1149221213076794},
+    {-0.38298484857126491, -0.47115602079155694,
+     2.2980314919430729, 2.201159585127213},
+    {-0.59582761114845662, -0.68399878336874864,
+     2.4033984840496321, 2.2934795950787001},
+    {-0.57997542558792037, -0.66814659780821239,
+     2.344164509814175, 2.2355140466252248},
+    {-0.55915858944169472, -0.64732976166198675,
+     2.4469561075174338, 2.3398872206144525},
+    {-0.54490820882125013, -0.63307938104154216,
+     2.3876032771482647, 2.2815645944986018},
+    {-0.6469271145623755, -0.73509828678266753,
+     2.4206807023984416, 2.3062619922620833},
+    {-0.63071154371757177, -0.71888271593786379,
+     2.3584861888941382, 2.2455669190079806},
+    {-0.6103665521469066, -0.69853772436719863,
+     2.4656143226013727, 2.3544809431137423},
+    {-0.59485836680940363, -0.68302953902969565,
+     2.2442571704343401, 2.1344174807446099},
+    {-0.57583091416576482, -0.66400208638605684,
+     2.1923429763121622, 2.0840148640131289},
+    {-0.56310497465602383, -0.65127614687631585,
+     2.2880861461513482, 2.1807245395259485},
+    {-0.54549908100115063, -0.63367025322144266,
+     2.235240648906677, 2.1291600712336587},
+    {-0.64456314413788152, -0.73273431635817354,
+     2.2541760263297372, 2.1399802608430893},
+    {-0.62469913473550731, -0.71287030695579934,
+     2.1997474147194787, 2.0873667155988294},
+    {-0.61325016463438076, -0.70142133685467278,
+     2.2996422537866934, 2.1882619870211286},
+    {-0.47027773254745342, -0.55844890476774545,
+     2.4707905675099302, 2.3695149518049141},
+    {-0.45796279639487725, -0.54613396861516927,
+     2.4141113892390034, 2.3135281066296733},
+    {-0.43123992502694641, -0.51941109724723833,
+     2.5103779546729732, 2.411213824360551},
+    {-0.42034017669514334, -0.50851134891543537,
+     2.4539357631518728, 2.3553189964220538},
+    {-0.52094835277187623, -0.60911952499216826,
+     2.4890650862996329, 2.3846674312994263},
+    {-0.50825965497093251, -0.59643082719122453,
+     2.4298426594734472, 2.3262698295124711},
+    {-0.48147568433448784, -0.56964685655477987,
+     2.5296585249857468, 2.4277315406911422},
+    {-0.54428255886147259, -0.63245373108176461,
+     -3.0979245377725406, 3.0792663712779409},
+    {-0.50376364992472178, -0.59193482214501381,
+     -3.1351882712307568, 3.0447093766528837},
+    {-0.53596053013944589, -0.62413170235973792,
+     -3.0409766045994044, 3.1367959427880989},
+    {-0.49647958950597559, -0.58465076172626762,
+     -3.0799588619827993, 3.1003930831886359},
+    {-0.59189753000996037, -0.6800687022302524,
+     -3.1169545697527306, 3.0566316429545544},
+    {-0.5510763195699353, -0.63924749179022733,
+     3.127684688891244, 3.0212051909917657},
+    {-0.58417321586400606, -0.67234438808429808,
+     -3.0585406682771521, 3.1156638054626762},
+    {-0.46587332031274586, -0.55404449253303789,
+     3.0553402252204509, 2.9543150742605895},
+    {-0.42205696297870687, -0.51022813519899879,
+     3.0215353459260599, 2.9228335439466524},
+    {-0.462151255548372, -0.55032242776866402,
+     3.1121531879588384, 3.0113372137004384},
+    {-0.41971452917207841, -0.50788570139237044,
+     3.0777413055421974, 2.9791554195421197},
+    {-0.5127974867429721, -0.60096865896326412,
+     3.0313222771330981, 2.9274578875222614},
+    {-0.46825545169569638, -0.55642662391598841,
+     2.9967064393869922, 2.8955462219907746},
+    {-0.50897728342674164, -0.59714845564703367,
+     3.0907195413597517, 2.9871008540994737},
+    {-0.47540476541563759, -0.56357593763592961,
+     -2.9673160964439993, -3.068887327436872},
+    {-0.43695920272947408, -0.52513037494976611,
+     -3.0079124951668539, -3.107371018577139},
+    {-0.46227826304434094, -0.55044943526463297,
+     -2.9099135394709168, -3.0107366141579601},
+    {-0.42445498120427438, -0.5126261534245663,
+     -2.9523442808435476, -3.0511655944733223},
+    {-0.52580832225979723, -0.61397949448008926,
+     -2.9829191727259836, -3.0876407254526841},
+    {-0.48680008311089329, -0.57497125533118532,
+     -3.0241144188671325, -3.1263585799900429},
+    {-0.51377869990890612, -0.60194987212919815,
+     -2.924120803650073, -3.0280487348203833},
+    {-0.40934191399378117, -0.49751308621407309,
+     -3.0987149414678417, 3.0863880731380151},
+    {-0.37144024147711807, -0.4596114136974101,
+     -3.1324072836151342, 3.0544059950966722},
+    {-0.398751760489095, -0.48692293270938691,
+     -3.0460124682091294, 3.1395886451682964},
+    {-0.36105795585302591, -0.44922912807331783,
+     -3.0817356333598562, 3.1055119421061148},
+    {-0.45724261381996889, -0.54541378604026092,
+     -3.1163048088891134, 3.0663369400184406},
+    {-0.41623155933285139, -0.50440273155314341,
+     3.1321274354176949, 3.0337124057707761},
+    {-0.44788041654534361, -0.53605158876563563,
+     -3.0626666773144411, 3.1204839330333014},
+    {-0.67921765543986801, -0.76738882766016003,
+     -3.0959076939822774, 3.0696570085562795},
+    {-0.63991689203977387, -0.72808806426006589,
+     -3.1375287500699818, 3.0318946078880344},
+    {-0.67099922951811375, -0.75917040173840578,
+     -3.0339733060655441, 3.1324348121423045},
+    {-0.63119537824955541, -0.71936655046984743,
+     -3.0768514548565329, 3.0933708398549054},
+    {-0.72724073148935875, -0.81541190370965078,
+     -3.1166323562636613, 3.0435783308105284},
+    {-0.68804617068554519, -0.77621734290583722,
+     3.1233477085432138, 3.0047984096370839},
+    {-0.71661140173322924, -0.80478257395352126,
+     -3.0525797238272014, 3.1088819929959426},
+    {-0.60427335412232452, -0.69244452634261655,
+     3.0428424458423584, 2.9322241531754423},
+    {-0.56019992709428301, -0.64837109931457504,
+     3.005527587147391, 2.8983817770536398},
+    {-0.59891365824560761, -0.68708483046589963,
+     3.1057831280118857, 2.9956106176090436},
+    {-0.55644945015878511, -0.64462062237907714,
+     3.0676734412272362, 2.9608036187301119},
+    {-0.65212636022401693, -0.74029753244430896,
+     3.0160326874647301, 2.9011182962706319},
+    {-0.60776092709477958, -0.69593209931507161,
+     2.9777790462460176, 2.8668670225050175},
+    {-0.64697881334882157, -0.7351499855691136,
+     3.0821093732287528, 2.967685770533218},
+    {-0.61440281272455355, -0.70257398494484558,
+     -2.9544750986190369, -3.0659546188789939},
+    {-0.57537958638689501, -0.66355075860718704,
+     -2.9991971707100187, -3.1074904073652232},
+    {-0.60277149406977104, -0.69094266629006307,
+     -2.8921356660500925, -3.0026283607586604},
+    {-0.56458118331639229, -0.65275235553668431,
+     -2.938958482661314, -3.0464304283851522},
+    {-0.66298772626592462, -0.75115889848621664,
+     -2.9707242715235576, -3.0866983291283216},
+    {-0.6238548253663051, -0.71202599758659713,
+     -3.0161978773282527, -3.1285036816601801},
+    {-0.65267677581238126, -0.74084794803267329,
+     -2.9066905878964686, -3.0216578878720535},
+    {-0.54773376322546385, -0.63590493544575588,
+     0.61895552921977026, 0.51271586871416142},
+    {-0.53049085234424076, -0.61866202456453279,
+     0.56139204852162994, 0.45635416309424159},
+    {-0.51632096135512728, -0.60449213357541931,
+     0.66515252589494167, 0.5610591335037175},
+    {-0.49988945174205668, -0.58806062396234871,
+     0.60819798291631222, 0.50515313139047691},
+    {-0.59383207408068073, -0.68200324630097275,
+     0.63012265974626991, 0.52036659428294096},
+    {-0.57753235448392715, -0.66570352670421917,
+     0.57169736403681981, 0.4632373745895958},
+    {-0.56317183150799699, -0.65134300372828902,
+     0.67669779521724049, 0.5693312013368993},
+    {-0.53957390373188985, -0.62774507595218187,
+     0.45672514062582559, 0.35106152170668925},
+    {-0.51820866530095522, -0.60637983752124724,
+     0.40089106148440884, 0.29667403169001866},
+    {-0.51154421990830978, -0.59971539212860181,
+     0.50438245060398401, 0.40059896212391144},
+    {-0.49103857915025062, -0.57920975137054265,
+     0.44828061352388693, 0.34578046575075305},
+    {-0.58647749604310462, -0.67464866826339664,
+     0.46554197712669082, 0.35637811949291204},
+    {-0.56573669274923122, -0.65390786496952324,
+     0.40872318769257276, 0.30116455145165},
+    {-0.55940432431588949, -0.64757549653618152,
+     0.51377381307724745, 0.40668679426390919},
+    {-0.43443046973566701, -0.52260164195595904,
+     0.6986878032931535, 0.5993600594650782},
+    {-0.41775123007907478, -0.5059224022993668,
+     0.64327592193796623, 0.54478656495703759},
+    {-0.40005775786715592, -0.48822893008744794,
+     0.74209153696975483, 0.64444678157731261},
+    {-0.38394854658967215, -0.47211971880996406,
+     0.68763482412667576, 0.59072036953900386},
+    {-0.48350605181515049, -0.57167722403544252,
+     0.71013507192858538, 0.60808771130076711},
+    {-0.46779316900698931, -0.55596434122728133,
+     0.65401425028118498, 0.55288031735987597},
+    {-0.4495317697441098, -0.53770294196440171,
+     0.75377778101512549, 0.65365433978032927},
+    {-0.43155131072957764, -0.51972248294986956,
+     0.54197093760793691, 0.4427909073829267},
+    {-0.41126297582745119, -0.49943414804774322,
+     0.48674141966943058, 0.38856704368576983},
+    {-0.39957394722209982, -0.48774511944239185,
+     0.58788000986775846, 0.4902577178787958},
+    {-0.38001924445421043, -0.46819041667450234,
+     0.53283745710719432, 0.43609568614175687},
+    {-0.48177626599155987, -0.5699474382118519,
+     0.55148613043217742, 0.44954136967428204},
+    {-0.46210310714628489, -0.55027427936657691,
+     0.49537471751834622, 0.39456143433812946},
+    {-0.45044167049913064, -0.53861284271942267,
+     0.59784220265043564, 0.49766967886051294},
+    {-0.6513925005894714, -0.73956367280976343,
+     0.70103567268572953, 0.58619169406972238},
+    {-0.63808180294037919, -0.72625297516067122,
+     0.64170697522639564, 0.52811478595942096},
+    {-0.62067411563335861, -0.70884528785365064,
+     0.74690216277989518, 0.63487689464136465},
+    {-0.60822355111088811, -0.69639472333118013,
+     0.68865671260220607, 0.57770550692855793},
+    {-0.69263029550633881, -0.78080146772663084,
+     0.71384093281287664, 0.59479993045395807},
+    {-0.68041756846798884, -0.76858874068828087,
+     0.65371599665575586, 0.53597056327056369},
+    {-0.66269956294448751, -0.75087073516477953,
+     0.7599838531854255, 0.64403833908854513},
+    {-0.64985396240194426, -0.73802513462223629,
+     0.53374343084424825, 0.41904659232370844},
+    {-0.63162810414166182, -0.71979927636195384,
+     0.474740271995926, 0.36173808644640765},
+    {-0.62277860084142955, -0.71094977306172158,
+     0.58241055772537076, 0.4701999598328333},
+    {-0.6055417073471574, -0.69371287956744943,
+     0.5235578132842903, 0.41283303310171926},
+    {-0.69227534595715312, -0.78044651817744515,
+     0.54433977107695186, 0.42533707646188962},
+    {-0.67494191762485123, -0.76311308984514326,
+     0.48432929237178907, 0.36714998746840205},
+    {-0.66614602439900106, -0.75431719661929308,
+     0.59354006880841481, 0.47725161388207116},
+    {-0.54387336561366195, -0.63204453783395398,
+     0.77832686743252821, 0.67236139023644992},
+    {-0.53099318465734879, -0.61916435687764082,
+     0.7219828503328849, 0.61691077883422407},
+    {-0.50983255486222068, -0.5980037270825127,
+     0.82083787572972022, 0.71716441278916598},
+    {-0.49752384258960169, -0.58569501480989372,
+     0.76585466196816454, 0.6629567517024435},
+    {-0.58845893569835284, -0.67663010791864486,
+     0.79119850055640772, 0.68187630409911781},
+    {-0.57675004305007993, -0.66492121527037196,
+     0.73423680271738789, 0.62583752837168782},
+    {-0.5549714645021705, -0.64314263672246252,
+     0.83384083407048792, 0.72707897057035953},
+    {-0.55610600942804089, -0.64427718164833292,
+     2.7444110919644591, 2.637566396275616},
+    {-0.55003505076819204, -0.63820622298848406,
+     2.6786762346172752, 2.5722716941160249},
+    {-0.51131293996210381, -0.59948411218239583,
+     2.7799688742421886, 2.6762002838105361},
+    {-0.50639941606519834, -0.59457058828549036,
+     2.7160350332717513, 2.6125806381674064},
+    {-0.60545748622617157, -0.6936286584464636,
+     2.7749022007878312, 2.6641845034603553},
+    {-0.60021734851090902, -0.68838852073120105,
+     2.7067040448685207, 2.5964237249426878},
+    {-0.56016186098681275, -0.64833303320710478,
+     2.8105303557791594, 2.703387361606056},
+    {-0.58335310290158604, -0.67152427512187807,
+     2.5731624409836811, 2.4642464600124607},
+    {-0.57206010555953068, -0.66023127777982271,
+     2.5089182305343352, 2.4008801381807139},
+    {-0.54204461298636275, -0.63021578520665478,
+     2.6138800674423304, 2.5080434336757018},
+    {-0.53228457543578123, -0.62045574765607325,
+     2.5505299617309749, 2.4453697809293953},
+    {-0.63434905406896369, -0.72252022628925572,
+     2.5977457449305748, 2.4844961312667699},
+    {-0.62329880729123111, -0.71146997951152313,
+     2.530529243959363, 2.4182726632537057},
+    {-0.59280324271421414, -0.68097441493450617,
+     2.6392627012996543, 2.5295902233529439},
+    {-0.41796953539449877, -0.50614070761479069,
+     2.7848665137890687, 2.6863664515455974},
+    {-0.41334475162652806, -0.50151592384682009,
+     2.7247019362393665, 2.6264271679743381},
+    {-0.37387248474495605, -0.46204365696524796,
+     2.8165049055258633, 2.7200290590757197},
+    {-0.37001147989728012, -0.45818265211757214,
+     2.7580126214535876, 2.6617012087570306},
+    {-0.46620650170673539, -0.55437767392702741,
+     2.8134804405224498, 2.7124364544135924},
+    {-0.46225856212415184, -0.55042973434444387,
+     2.7514055110771536, 2.6505835379537319},
+    {-0.42114246111827691, -0.50931363333856883,
+     2.845054870914947, 2.7463984201528269},
+    {-0.44957978816454436, -0.53775096038483627,
+     2.628566133880645, 2.5284401056737127},
+    {-0.44104535122070121, -0.52921652344099313,
+     2.5686943651733634, 2.4690224377089924},
+    {-0.40731805611582794, -0.49548922833611986,
+     2.664993102877796, 2.5670072436522284},
+    {-0.39997755852999162, -0.48814873075028353,
+     2.6061525924805906, 2.5085115630509875},
+    {-0.49970749811692761, -0.58787867033721963,
+     2.6526876440965594, 2.5496541301053641},
+    {-0.49134810380474714, -0.57951927602503917,
+     2.5904156339012339, 2.4878966697316311},
+    {-0.45669052054301562, -0.54486169276330765,
+     2.6896131175709841, 2.5890999555187642},
+    {-0.65583032048384615, -0.74400149270413818,
+     2.8782155388403514, 2.7629434876947552},
+    {-0.65409804918101777, -0.7422692214013098,
+     2.8076765655054383, 2.6925722583847098},
+    {-0.60919666129700678, -0.69736783351729881,
+     2.9110593880301585, 2.8000255967687031},
+    {-0.60845125016093904, -0.69662242238123107,
+     2.8432316981129917, 2.7322611885811199},
+    {-0.70196251311814606, -0.79013368533843809,
+     2.915621961413128, 2.7955594020164711},
+    {-0.7016800642591815, -0.78985123647947353,
+     2.8429074995178047, 2.7228762696122764},
+    {-0.65513552894772442, -0.74330670116801645,
+     2.9478815535905176, 2.8326768826099769},
+    {-0.69311973889251577, -0.7812909111128078,
+     2.696569156770626, 2.5774752664023763},
+    {-0.68493143129916179, -0.77310260351945381,
+     2.6244912616758089, 2.5062723326614247},
+    {-0.64990036954426678, -0.7380715417645588,
+     2.7369561316970459, 2.6222548644539345},
+    {-0.64327811900192178, -0.7314492912222138,
+     2.6667557013998722, 2.5526804946674653},
+    {-0.74198554879428791, -0.83015672101457993,
+     2.7289314136829259, 2.6041545465935738},
+    {-0.73476078009653645, -0.82293195231682847,
+     2.6536339497174404, 2.5297500794267544},
+    {-0.69873219530165365, -0.78690336752194567,
+     2.7696297842500162, 2.6499239926741467},
+    {-0.51562025635120867, -0.6037914285715007,
+     2.9075242010218427, 2.8034765332200116},
+    {-0.51438826113164793, -0.60255943335193995,
+     2.8439721260917863, 2.7400046312613697},
+    {-0.46916576939094823, -0.55733694161124026,
+     2.9365833837616067, 2.8353713042891537},
+    {-0.46850335608333415, -0.55667452830362618,
+     2.8753621083332694, 2.7741877810497257},
+    {-0.5621517278126853, -0.65032290003297732,
+     2.9416345107164386, 2.8343439100039358},
+    {-0.56216786415749853, -0.65033903637779056,
+     2.8764597594855159, 2.7691679583936768},
+    {-0.51505757857752943, -0.60322875079782146,
+     2.9701259706095184, 2.8661149543879443},
+    {-0.56184373546120459, -0.65001490768149661,
+     -0.1340354739139871, -0.24130317364077611},
+    {-0.59556934847103549, -0.68374052069132751,
+     -0.079985161995296955, -0.18988292645244012},
+    {-0.58038161776138086, -0.66855278998167289,
+     -0.1961062657283433, -0.30478852546273383},
+    {-0.61564442334666147, -0.7038155955669535,
+     -0.14276866926846959, -0.254355467611796},
+    {-0.50799149980693004, -0.59616267202722206,
+     -0.12578271573288499, -0.2293384343636117},
+    {-0.54150935494117836, -0.62968052716147038,
+     -0.073659259853633696, -0.17945830855244682},
+    {-0.52687649479311505, -0.61504766701340707,
+     -0.18555641931669026, -0.29034976339558766},
+    {-0.60419695143233521, -0.69236812365262723,
+     0.036907532691718772, -0.073704357632003129},
+    {-0.63277859832681538, -0.7209497705471074,
+     0.094886999812398939, -0.018219571088354092},
+    {-0.62770908232518796, -0.71588025454547999,
+     -0.023553108989492533, -0.13620227604725949},
+    {-0.65794854145688186, -0.74611971367717389,
+     0.035040835119582947, -0.080437470734296163},
+    {-0.55028042232578445, -0.63845159454607647,
+     0.038786914144844982, -0.067635269923808194},
+    {-0.57923289176691273, -0.66740406398720475,
+     0.09447421556434632, -0.014118216760273923},
+    {-0.57368195237752684, -0.66185312459781886,
+     -0.019362417979769994, -0.12752487060219198},
+    {-0.64937939435854974, -0.73755056657884177,
+     -0.27312344008189804, -0.38777502345624071},
+    {-0.68635240946181797, -0.77452358168211,
+     -0.21924348144347724, -0.33761275768874233},
+    {-0.66269969694630981, -0.75087086916660184,
+     -0.33966260402675214, -0.45560813139144324},
+    {-0.70110732662467312, -0.78927849884496515,
+     -0.28771084300978322, -0.40767862385486064},
+    {-0.59690919554440347, -0.6850803677646955,
+     -0.25944683353551917, -0.36945435840920443},
+    {-0.63364883247064552, -0.72182000469093754,
+     -0.20730960412890057, -0.32049535993136524},
+    {-0.61126909013724173, -0.69944026235753376,
+     -0.32357432076960624, -0.43478475602353139},
+    {-0.70277969942430163, -0.79095087164459366,
+     -0.093714225788111283, -0.21386757444866894},
+    {-0.73443938976816636, -0.82261056198845839,
+     -0.032497756535119535, -0.15634234893602511},
+    {-0.72178861296494956, -0.80995978518524159,
+     -0.16191785608159004, -0.28424586182671713},
+    {-0.75530360305171329, -0.84347477527200532,
+     -0.10121547275564076, -0.22769017179685536},
+    {-0.64943316716681321, -0.73760433938710523,
+     -0.086655331992744361, -0.20131204008920292},
+    {-0.68139803869816173, -0.76956921091845376,
+     -0.027922988296815943, -0.14577074442407564},
+    {-0.6690653566553163, -0.75723652887560833,
+     -0.15203996986294546, -0.26862159065027436},
+    {-0.4204667430174972, -0.50863791523778912,
+     -0.16616381232095373, -0.26478683316341861},
+    {-0.45441509711323436, -0.54258626933352627,
+     -0.11796178058058038, -0.21835018257426209},
+    {-0.43826972270871223, -0.52644089492900425,
+     -0.22301270594077471, -0.32253939226428663},
+    {-0.47346368397894811, -0.56163485619924014,
+     -0.17559432496370814, -0.27705312019735362},
+    {-0.36819187227304651, -0.45636304449333853,
+     -0.1572167887606018, -0.25345139839250008},
+    {-0.40142994120047959, -0.48960111342077162,
+     -0.11053162409951015, -0.20824027093764694},
+    {-0.38605950352243634, -0.47423067574272837,
+     -0.21216691593010439, -0.30917501616062487},
+    {-0.46589315089525385, -0.55406432311554588,
+     -0.011440541761095539, -0.11246681325747759},
+    {-0.49651383611485378, -0.58468500833514581,
+     0.04067766036303351, -0.062157815463001864},
+    {-0.48757935209076864, -0.57575052431106066,
+     -0.067640789560112574, -0.16993178135346373},
+    {-0.51963672308050635, -0.60780789530079837,
+     -0.015330340485617572, -0.11964134513285418},
+    {-0.41275970059244105, -0.50093087281273296,
+     -0.0076801689578341881, -0.10592665975928307},
+    {-0.44320652891060963, -0.53137770113090155,
+     0.04257737254698956, -0.057208470357637035},
+    {-0.43409932778379645, -0.52227050000408837,
+     -0.061899238208436756, -0.16120992868677284},
+    {-0.5069222025345328, -0.59509337475482482,
+     -0.29419882952188303, -0.39768644505263451},
+    {-0.54401552403531539, -0.63218669625560742,
+     -0.24658792823642472, -0.35256344909527237},
+    {-0.52101400335092707, -0.6091851755712191,
+     -0.35437710111735149, -0.45877910170448449},
+    {-0.55923602203104117, -0.6474071942513332,
+     -0.3084500950253139, -0.4155246940458866},
+    {-0.45465323522431556, -0.54282440744460758,
+     -0.28074089412848774, -0.38114231422779249},
+    {-0.49102669232415952, -0.57919786454445155,
+     -0.23446636003120902, -0.33696578552261447},
+    {-0.46946829326589368, -0.5576394654861857,
+     -0.33897714309605714, -0.44020648812906743},
+    {-0.63833815201262867, -0.72650932423292069,
+     -0.95024704622907796, -1.0638628963379257},
+    {-0.61336089148288242, -0.70153206370317445,
+     -0.98331943801359056, -1.0947092252708646},
+    {-0.64297013396321157, -0.73114130618350359,
+     -0.90475458892857108, -1.0188009668253613},
+    {-0.6065410074055233, -0.69471217962581533,
+     -0.93192605460005451, -1.0427350034822411},
+    {-0.65435114467673283, -0.74252231689702486,
+     -0.99040556433860849, -1.1055343278899843},
+    {-0.61336089148288242, -0.70153206370317445,
+     -0.98331943801359056, -1.0947092252708646},
+    {-0.67319619363057237, -0.7613673658508644,
+     -0.94068187251083712, -1.0576825649978359},
+    {-0.59934101609564783, -0.68751218831593985,
+     -1.0691766139526917, -1.1793844211282363},
+    {-0.56977706019751251, -0.65794823241780453,
+     -1.1038361675120858, -1.2117001640224005},
+    {-0.5865517282358006, -0.67472290045609262,
+     -1.0167593982499401, -1.1259291718577202},
+    {-0.55785354246697194, -0.64602471468726397,
+     -1.0504962828384468, -1.1574690859038839},
+    {-0.64142325619891261, -0.72959442841920463,
+     -1.0794286018630126, -1.1933305681434534},
+    {-0.61099062857764974, -0.69916180079794177,
+     -1.1237634769774218, -1.2349501170288226},
+    {-0.62696892745703414, -0.71514009967732617,
+     -1.0347075207812757, -1.147290457326285},
+    {-0.60835824615448619, -0.69652941837477822,
+     -0.82972573898422586, -0.94068836232080399},
+    {-0.57154646169022083, -0.65971763391051286,
+     -0.85914684228928095, -0.96714566816076131},
+    {-0.60947540276991508, -0.6976465749902071,
+     -0.77921691085719524, -0.89027440029695215},
+    {-0.56875435004461494, -0.65692552226490697,
+     -0.80381584708706932, -0.91160221969520872},
+    {-0.64675254372821267, -0.7349237159485047,
+     -0.85657735855383266, -0.97097955337938757},
+    {-0.60615542294623792, -0.69432659516652995,
+     -0.87774406941128347, -0.98852051315386813},
+    {-0.64950184150094159, -0.73767301372123362,
+     -0.80571369046763064, -0.92037694459802044},
+    {-0.53819291578786055, -0.62636408800815258,
+     -0.94843958691220809, -1.0540070268983646},
+    {-0.5022548630675594, -0.59042603528785143,
+     -0.9824404701073598, -1.0856332490562723},
+    {-0.53728836615551756, -0.62545953837580959,
+     -0.89504517965562613, -1.0005498260928321},
+    {-0.50165099122995538, -0.58982216345024741,
+     -0.93012179375871029, -1.0332767127051279},
+    {-0.57281652192660559, -0.66098769414689762,
+     -0.96665638296736445, -1.074752404970539},
+    {-0.54493248585058607, -0.63310365807087809,
+     -0.99934375129745856, -1.1053841538971967},
+    {-0.57287188839645009, -0.66104306061674212,
+     -0.91352278321471236, -1.0216230502924404},
+    {-0.71471449603748161, -0.80288566825777363,
+     -1.0328154691996989, -1.1543199099284558},
+    {-0.67029424292295103, -0.75846541514324306,
+     -1.033865508351411, -1.1505712771115373},
+    {-0.73539227815195574, -0.82356345037224776,
+     -0.97887623149002545, -1.1028373886193656},
+    {-0.69747690782474481, -0.78564808004503683,
+     -0.98721846240625766, -1.1067865229865692},
+    {-0.73161330168197736, -0.81978447390226938,
+     -1.0823322737679375, -1.2058331007387155},
+    {-0.68597979869812842, -0.77415097091842044,
+     -1.0808643342669069, -1.1991941261681978},
+    {-0.76009006637742704, -0.84826123859771907,
+     -1.0315179026712584, -1.1586196894100034},
+    {-0.59934101609564783, -0.68751218831593985,
+     -1.0691766139526917, -1.1793844211282363},
+    {-0.55785354246697194, -0.64602471468726397,
+     -1.0504962828384468, -1.1574690859038839},
+    {-0.62696892745703414, -0.71514009967732617,
+     -1.0347075207812757, -1.147290457326285},
+    {-0.5865517282358006, -0.67472290045609262,
+     -1.0167593982499401, -1.1259291718577202},
+    {-0.61099062857764974, -0.69916180079794177,
+     -1.1237634769774218, -1.2349501170288226},
+    {-0.56977706019751251, -0.65794823241780453,
+     -1.1038361675120858, -1.2117001640224005},
+    {-0.64142325619891261, -0.72959442841920463,
+     -1.0794286018630126, -1.1933305681434534},
+    {-0.72085575784701894, -0.80902693006731097,
+     -0.86988394483029219, -0.99210235892127763},
+    {-0.68378884048139643, -0.77196001270168846,
+     -0.88438868421656502, -1.0024871704071414},
+    {-0.73023331503264188, -0.81840448725293391,
+     -0.80748433522179064, -0.93081835039314931},
+    {-0.68817192587194631, -0.77634309809223834,
+     -0.83325910475268283, -0.9518218050532915},
+    {-0.74835749277042407, -0.8365286649907161,
+     -0.91761301671039552, -1.0431936985707018},
+    {-0.70985988021214086, -0.79803105243243289,
+     -0.92988430150866885, -1.05083344051468},
+    {-0.7596951346610068, -0.84786630688129883,
+     -0.85340795834268013, -0.98045765838709009},
+    {-0.64615116209316836, -0.73432233431346039,
+     -0.57750317958510478, -0.69184854372662918},
+    {-0.68792847931650369, -0.77609965153679572,
+     -0.53777734042938419, -0.65631410172258753},
+    {-0.64954666703033259, -0.73771783925062462,
+     -0.63787844077472633, -0.75254596836712462},
+    {-0.69167823695338082, -0.77984940917367285,
+     -0.60144901053193178, -0.72038735185613423},
+    {-0.59946791764195873, -0.68763908986225075,
+     -0.55480342651483594, -0.66502172310381968},
+    {-0.6407427198315192, -0.72891389205181123,
+     -0.51543389265586392, -0.62927252820178392},
+    {-0.60449386698757046, -0.69266503920786249,
+     -0.61384691657881019, -0.72448369541971502},
+    {-0.72266262339864284, -0.81083379561893487,
+     -0.42590978803441537, -0.54834074760958884},
+    {-0.76254572036406243, -0.85071689258435446,
+     -0.37516288807846815, -0.50258995338476908},
+    {-0.72948558202660752, -0.81765675424689954,
+     -0.49432587526883548, -0.61756979105058374},
+    {-0.77044937465667274, -0.85862054687696476,
+     -0.44679401062810387, -0.57528469288232165},
+    {-0.67354646868822798, -0.76171764090852001,
+     -0.40634207606087069, -0.52337853439877058},
+    {-0.71322017865923104, -0.80139135087952307,
+     -0.35681911983612469, -0.47815178382519308},
+    {-0.68192995525369315, -0.77010112747398518,
+     -0.47256969328014298, -0.59047308258986053},
+    {-0.69318448623421414, -0.78135565845450616,
+     -0.72250254451792839, -0.84160343697651696},
+    {-0.73572418716766486, -0.82389535938795688,
+     -0.68971317154533318, -0.81371500836691102},
+    {-0.69137840411730789, -0.77954957633759991,
+     -0.77926607770059875, -0.89817214683264213},
+    {-0.73377809744098188, -0.82194926966127391,
+     -0.75004659752802938, -0.87381049028098079},
+    {-0.65110445414348961, -0.73927562636378163,
+     -0.69620752998476276, -0.81102391150467934},
+    {-0.6933599852810518, -0.78153115750134383,
+     -0.66314245462479737, -0.78226233305089232},
+    {-0.65102091119076821, -0.73919208341106024,
+     -0.75221724539869284, -0.8670256271150274},
+    {-0.77816352352266627, -0.86633469574295829,
+     -0.58655683862097652, -0.71611076722557665},
+    {-0.8200566272186629, -0.90822779943895493,
+     -0.54216900327732187, -0.67796471999548125},
+    {-0.778363492518094, -0.86653466473838603,
+     -0.65343931481085926, -0.78302114214569407},
+    {-0.82079334962640205, -0.90896452184669407,
+     -0.61321721540126528, -0.74913025486880691},
+    {-0.73381064780313776, -0.82198182002342979,
+     -0.56144881055514495, -0.68521667180707446},
+    {-0.77559962136783989, -0.86377079358813191,
+     -0.51748222796385879, -0.64667997144059186},
+    {-0.73581675415001246, -0.82398792637030449,
+     -0.62672996352490784, -0.75074315281204618},
+    {-0.51163265892820275, -0.59980383114849478,
+     -0.5691957822779623, -0.67298497021331238},
+    {-0.55188587381752596, -0.64005704603781799,
+     -0.53326567748405729, -0.63980360531401981},
+    {-0.51794104228014792, -0.60611221450043995,
+     -0.62423614332030575, -0.72843560436828925},
+    {-0.55843705475248961, -0.64660822697278164,
+     -0.59097576283391351, -0.69799148303009162},
+    {-0.46435170439985907, -0.55252287662015109,
+     -0.54844125318846515, -0.64938061688878645},
+    {-0.50368142945577377, -0.59185260167606579,
+     -0.51281125142858486, -0.61609372972130394},
+    {-0.47202372509613244, -0.56019489731642447,
+     -0.60235853993179977, -0.70373433381627437},
+    {-0.58351057957970986, -0.67168175180000189,
+     -0.43279319216859563, -0.54172161432825661},
+    {-0.62336813387046885, -0.71153930609076088,
+     -0.38796815424980702, -0.50023086810754247},
+    {-0.59250774804562978, -0.68067892026592181,
+     -0.49431766805334199, -0.60396618347899078},
+    {-0.63318002689901354, -0.72135119911930556,
+     -0.45209477069464338, -0.56523784422373757},
+    {-0.533217448059911, -0.62138862028020303,
+     -0.41456748557169559, -0.51979151584449235},
+    {-0.57242040853891307, -0.6605915807592051,
+     -0.37067880927325364, -0.47874447973599171},
+    {-0.54350134551892981, -0.63167251773922184,
+     -0.47433574828942532, -0.58027496095801967},
+    {-0.5664831774313116, -0.65465434965160363,
+     -0.70145865212811642, -0.80907344320353081},
+    {-0.60772489352196735, -0.69589606574225937,
+     -0.67110361012860364, -0.78201258416476671},
+    {-0.56826144562077086, -0.65643261784106288,
+     -0.75373834452446875, -0.86148738570291972},
+    {-0.60932566750900352, -0.69749683972929555,
+     -0.72629614988622193, -0.8373409067307811},
+    {-0.52270661363171111, -0.61087778585200314,
+     -0.67765932916547067, -0.78217364881112617},
+    {-0.56325873110542313, -0.65142990332571515,
+     -0.64713239895826802, -0.75450547661248279},
+    {-0.52605141856816706, -0.61422259078845909,
+     -0.72924483901114057, -0.8339827109719895},
+    {-0.64780034990593749, -0.73597152212622952,
+     -2.3126664008424975, -2.4271678476393226},
+    {-0.59724414877634868, -0.68541532099664071,
+     -2.3166034549931172, -2.4266384844155389},
+    {-0.66884934756532877, -0.75702051978562079,
+     -2.2544391911204138, -2.3709990351058106},
+    {-0.61819971883382929, -0.70637089105412132,
+     -2.2613920697443302, -2.3732008459374043},
+    {-0.6759734613212447, -0.76414463354153672,
+     -2.3664751225640117, -2.483760393818093},
+    {-0.62520055521389339, -0.71337172743418542,
+     -2.3688714918393767, -2.4812967549032425},
+    {-0.69835499999073691, -0.78652617221102894,
+     -2.3082319965125491, -2.4278963488058887},
+    {-0.52144116840849752, -0.60961234062878955,
+     -2.372807856800601, -2.4772381524137872},
+    {-0.46899215712804609, -0.55716332934833812,
+     -2.3743940678300097, -2.47559624579233},
+    {-0.54601613713645214, -0.63418730935674417,
+     -2.32016233021618, -2.426279626657132},
+    {-0.49437610241181085, -0.58254727463210287,
+     -2.3233743920334162, -2.426078316719376},
+    {-0.54788248757927427, -0.6360536597995663,
+     -2.4250876180724945, -2.5313379017633264},
+    {-0.49495791172120518, -0.58312908394149721,
+     -2.4252001403305865, -2.5279397883620245},
+    {-0.57360319277161631, -0.66177436499190834,
+     -2.3709744031527182, -2.4791308034434452},
+    {-0.65539479901389108, -0.74356597123418311,
+     -2.1402225211220407, -2.2554523201253658},
+    {-0.60424537340836759, -0.69241654562865962,
+     -2.1528659848952145, -2.2634819326914144},
+    {-0.67186222671781515, -0.76003339893810717,
+     -2.074454423008314, -2.1913192380136071},
+    {-0.62032478765668286, -0.70849595987697489,
+     -2.0907429461266531, -2.2027375581770654},
+    {-0.68882594266066532, -0.77699711488095735,
+     -2.1921974023534294, -2.3108298786238408},
+    {-0.63739137868155804, -0.72556255090185007,
+     -2.2025976573848136, -2.3161262070462159},
+    {-0.70735103654661446, -0.79552220876690649,
+     -2.1260384791217595, -2.2467037364815781},
+    {-0.53758369133123074, -0.62575486355152277,
+     -2.2201195901218584, -2.325644720232054},
+    {-0.48963752793641035, -0.57780870015670238,
+     -2.2275377462368158, -2.3299529312984082},
+    {-0.55416031325176296, -0.64233148547205499,
+     -2.1641865381453091, -2.2708893430046548},
+    {-0.50536193284414255, -0.59353310506443457,
+     -2.1743647178919678, -2.2777533329613942},
+    {-0.56859758939162519, -0.65676876161191722,
+     -2.2675533314671918, -2.3753278257450434},
+    {-0.51792747636145231, -0.60609864858174434,
+     -2.272371036240739, -2.3765696070783555},
+    {-0.5869003213578704, -0.67507149357816243,
+     -2.2118510584869084, -2.3210486300355071},
+    {-0.75247753097070058, -0.84064870319099261,
+     -2.4229035885671735, -2.5490122846631937},
+    {-0.70290221412790521, -0.79107338634819724,
+     -2.4237377819431467, -2.5439047607237164},
+    {-0.77641334833374376, -0.86458452055403578,
+     -2.3616718888152528, -2.4909823733388228},
+    {-0.72568718918599551, -0.81385836140628753,
+     -2.3637590757345368, -2.4865483802024126},
+    {-0.77744201933061685, -0.86561319155090888,
+     -2.485673483127337, -2.6151268936703533},
+    {-0.72822095637426154, -0.81639212859455357,
+     -2.4843831625799249, -2.6074751507791447},
+    {-0.80065560569272565, -0.88882677791301767,
+     -2.4218514233479618, -2.5546543653891223},
+    {-0.6259580335658288, -0.71412920578612082,
+     -2.4816236448318612, -2.5941163498125683},
+    {-0.57337948340548983, -0.66155065562578186,
+     -2.4801562268242585, -2.5882954433791903},
+    {-0.65212205233129517, -0.74029322455158719,
+     -2.4243700963200978, -2.539284073746702},
+    {-0.60036348844208831, -0.68853466066238034,
+     -2.424815385621522, -2.5351078155269491},
+    {-0.65004811514036809, -0.73821928736066011,
+     -2.5412534217490599, -2.6559687925611311},
+    {-0.59760613140516894, -0.68577730362546097,
+     -2.5378819950829041, -2.6479467779165371},
+    {-0.67765464689210797, -0.7658258191124,
+     -2.4830330692059621, -2.6004917214158572},
+    {-0.77231897535318605, -0.86049014757347808,
+     -2.2375893343642335, -2.366335397049927},
+    {-0.72030982401082178, -0.8084809962311138,
+     -2.2465598810296759, -2.3687142992244534},
+    {-0.79345532195298696, -0.88162649417327899,
+     -2.1671241249719233, -2.2988621086530778},
+    {-0.74094251120283161, -0.82911368342312364,
+     -2.1804534446897486, -2.3051001932560067},
+    {-0.80120989542349541, -0.88938106764378744,
+     -2.2972516083542578, -2.4301375333290105},
+    {-0.74957820866908664, -0.83774938088937867,
+     -2.3031342240150083, -2.4288706659998791},
+    {-0.82459616138532887, -0.9127673336056209,
+     -2.2273237422912904, -2.3638467986507936},
+    {-0.65391661463785122, -0.74208778685814325,
+     1.9748051086308029, 1.8597183224669491},
+    {-0.66902830281239756, -0.75719947503268958,
+     1.9121440237938361, 1.7955661395278855},
+    {-0.60783690163344406, -0.69600807385373609,
+     1.9827074232962008, 1.8717889684213449},
+    {-0.62263982458253275, -0.71081099680282478,
+     1.9236443261792437, 1.811445983697251},
+    {-0.68444851941858909, -0.77261969163888111,
+     2.0296694985059922, 1.9115015229996044},
+    {-0.70164487196321901, -0.78981604418351103,
+     1.9660692597240113, 1.8460419315645296},
+    {-0.6372000603527177, -0.72537123257300973,
+     2.0346421554511478, 1.921131218300268},
+    {-0.72999455850614281, -0.81816573072643484,
+     1.8299497560815701, 1.7066445320992802},
+    {-0.74059045571364934, -0.82876162793394137,
+     1.7583782271380322, 1.6337753055360789},
+    {-0.68225979374350054, -0.77043096596379257,
+     1.8469821248241021, 1.7290441945289687},
+    {-0.69336992000439523, -0.78154109222468726,
+     1.7797532591393446, 1.660632305656911},
+    {-0.7661473202191601, -0.85431849243945213,
+     1.8850539164152758, 1.7571453564696915},
+    {-0.77883452336570891, -0.86700569558600094,
+     1.8108445874341292, 1.6811969760923375},
+    {-0.71692775952845444, -0.80509893174874647,
+     1.8993608344380803, 1.7776005756474593},
+    {-0.53493057208873773, -0.62310174430902976,
+     1.9435259945780441, 1.838184270227039},
+    {-0.54771422792529112, -0.63588540014558315,
+     1.8885880571884597, 1.7823497917312467},
+    {-0.49377388104573738, -0.58194505326602941,
+     1.9521876432444643, 1.8495206324671281},
+    {-0.50619406686526069, -0.59436523908555272,
+     1.9000078356232168, 1.7965664758528179},
+    {-0.5635201032312418, -0.65169127545153382,
+     1.9898984630441561, 1.8825058742200991},
+    {-0.57790678632693671, -0.66607795854722873,
+     1.9340534932131406, 1.8255643965768349},
+    {-0.52104094653191801, -0.60921211875221004,
+     1.9964765445663279, 1.8920727603032441},
+    {-0.60248973787449001, -0.69066091009478203,
+     1.8162203821265677, 1.7057511906918794},
+    {-0.61230254369929638, -0.7004737159195884,
+     1.7548765087671923, 1.6435775978412104},
+    {-0.55920623258527269, -0.64737740480556472,
+     1.8318987173388241, 1.724826316001264},
+    {-0.5692400332372195, -0.65741120545751153,
+     1.7737539629100969, 1.6659307548482361},
+    {-0.63585739737056757, -0.72402856959085959,
+     1.862267052601549, 1.7488794489579891},
+    {-0.64726547742032092, -0.73543664964061295,
+     1.7989264108883667, 1.6844756663458882},
+    {-0.59096508553452687, -0.6791362577548189,
+     1.8760653212716927, 1.7665415798390749},
+    {-0.69290183187075416, -0.78107300409104619,
+     2.1484210550391771, 2.0293507204756893},
+    {-0.71386452831819247, -0.8020357005384845,
+     2.0882900813629535, 1.9668834400858353},
+    {-0.64564259117485456, -0.73381376339514659,
+     2.1465975735050153, 2.032300193125065},
+    {-0.66566857301921734, -0.75383974523950936,
+     2.0898931306032531, 1.9736523880229941},
+    {-0.71855935833988782, -0.80673053056017985,
+     2.2100941563585037, 2.0881442366823944},
+    {-0.74178215867519159, -0.82995333089548362,
+     2.1506260655233072, 2.0258746032421242},
+    {-0.67080457879257704, -0.75897575101286907,
+     2.2045544591795281, 2.0877970042599996},
+    {-0.78362446673871577, -0.8717956389590078,
+     2.0181554692138959, 1.8878334352367085},
+    {-0.80137161020432379, -0.88954278242461582,
+     1.9454381456121823, 1.8125279830114838},
+    {-0.73331355347023119, -0.82148472569052322,
+     2.0242049758792096, 1.9004976777402303},
+    {-0.7508641426176379, -0.83903531483792992,
+     1.9563458580666451, 1.8304447126841241},
+    {-0.81473811859728484, -0.90290929081757687,
+     2.0849031504047875, 1.9499462685540652},
+    {-0.83516751872001505, -0.92333869094030707,
+     2.0113997969926172, 1.8731412259872375},
+    {-0.76361582901575931, -0.85178700123605133,
+     2.0866284860210622, 1.9590589105073288},
+    {-0.57447660026383085, -0.66264777248412288,
+     2.0929362368535767, 1.9847126435248175},
+    {-0.5916964828059168, -0.67986765502620883,
+     2.0391956832928795, 1.9296128527443734},
+    {-0.53165079823703276, -0.61982197045732479,
+     2.0943803109077659, 1.9892634119634551},
+    {-0.54802610151910169, -0.63619727373939372,
+     2.043387776133236, 1.9371272300400784},
+    {-0.60012528223158812, -0.68829645445188015,
+     2.1450874217917115, 2.0348147284230778},
+    {-0.61917138786567538, -0.70734256008596741,
+     2.0914410700004233, 1.9795474612787145},
+    {-0.55643327689801048, -0.6446044491183025,
+     2.1438361278440103, 2.0369674891628859},
+    {-0.65634500369416426, -0.74451617591445629,
+     1.0217681647270045, 0.90644611338395897},
+    {-0.67115316552404292, -0.75932433774433494,
+     1.0861572593383289, 0.96936445618991096},
+    {-0.68798346831343293, -0.77615464053372496,
+     0.97776861281176186, 0.85922599409787692},
+    {-0.70421544966944427, -0.7923866218897363,
+     1.0419292079271474, 0.92161581985844376},
+    {-0.60745173563616139, -0.69562290785645342,
+     1.0029709275030423, 0.8920850620749452},
+    {-0.62251166205557917, -0.7106828342758712,
+     1.0649602011086168, 0.95277317243610271},
+    {-0.63990956351170436, -0.72808073573199639,
+     0.96010457880856503, 0.84634330930399904},
+    {-0.64737245969205637, -0.73554363191234839,
+     1.1955942002076831, 1.0811333206896818},
+    {-0.65672886020683918, -0.74490003242713121,
+     1.2633060492535038, 1.1479466590528415},
+    {-0.6840604879650457, -0.77223166018533773,
+     1.1528938317687509, 1.0347667468783648},
+    {-0.69482862194573991, -0.78299979416603194,
+     1.2214895250344038, 1.1022103837356021},
+    {-0.5986046516397816, -0.68677582386007363,
+     1.1712685431069398, 1.0611215278816211},
+    {-0.60871016678753409, -0.69688133900782612,
+     1.2368658183194874, 1.1258733432105521},
+    {-0.63589960362366815, -0.72407077584396018,
+     1.1293079747683297, 1.0159165013598226},
+    {-0.76340213755566189, -0.85157330977595391,
+     0.95080934608281864, 0.82326826576587364},
+    {-0.78071014103373815, -0.86888131325403017,
+     1.0172004241672776, 0.88728991452587558},
+    {-0.78945551739712516, -0.87762668961741719,
+     0.9042552738911368, 0.77309861360389143},
+    {-0.80816461114753835, -0.89633578336783037,
+     0.96990317519684299, 0.83596365714945486},
+    {-0.71735353556470516, -0.80552470778499718,
+     0.93311201564799795, 0.81130235182033239},
+    {-0.73498400637485783, -0.82315517859514986,
+     0.99676027708386072, 0.87284910357037393},
+    {-0.74442510021448627, -0.8325962724347783,
+     0.88796486049060031, 0.76288206459692609},
+    {-0.76461638537591248, -0.8527875575962045,
+     1.1331552393465574, 1.0054519950671768},
+    {-0.77604870970013518, -0.8642198819204272,
+     1.2049839502359367, 1.0757240209301997},
+    {-0.79602181712581677, -0.88419298934610879,
+     1.086822312611011, 0.9547074809328745},
+    {-0.80903577836031371, -0.89720695058060573,
+     1.1592050187469101, 1.0251318875065405},
+    {-0.71859385574984636, -0.80676502797013838,
+     1.1088489581183483, 0.98689501849693195},
+    {-0.73084593689115873, -0.81901710911145076,
+     1.1780803643364832, 1.0546723805318017},
+    {-0.75083924886498821, -0.83901042108528023,
+     1.0635712732914091, 0.9376733223921514},
+    {-0.54146965987722051, -0.62964083209751254,
+     0.92833120327207741, 0.82253493963453206},
+    {-0.55778466806428473, -0.64595584028457675,
+     0.98543007996503706, 0.87846233791457928},
+    {-0.57340341103984982, -0.66157458326014185,
+     0.88724060499981083, 0.7790995510162807},
+    {-0.59098904058646984, -0.67916021280676186,
+     0.94365861553149488, 0.83413294072290933},
+    {-0.491613959106457, -0.57978513132674903,
+     0.91403174452322045, 0.81149660531289092},
+    {-0.5076121650384241, -0.59578333725871613,
+     0.96904710541376038, 0.86551557026293557},
+    {-0.52423457720807354, -0.61240574942836556,
+     0.8740270112459424, 0.7694108328295729},
+    {-0.53643979603134528, -0.62461096825163731,
+     1.0865042251414412, 0.98105833991288371},
+    {-0.548786919336407, -0.63695809155669902,
+     1.1484134917278186, 1.0420985092384174},
+    {-0.57291585957911362, -0.66108703179940564,
+     1.045146418037294, 0.93704277911422262},
+    {-0.58660326995082945, -0.67477444217112148,
+     1.1072126919431913, 0.99803880996000627},
+    {-0.4856992882107114, -0.57387046043100343,
+     1.0670850650426447, 0.96490687820577614},
+    {-0.49820758207343196, -0.58637875429372399,
+     1.1269341545464133, 1.0239938756372311},
+    {-0.52263619591761989, -0.61080736813791192,
+     1.026612623248099, 0.92210298720435069},
+    {-0.65116731442430986, -0.73933848664460189,
+     0.85889275385062935, 0.74407035176962422},
+    {-0.670197622003184, -0.75836879422347603,
+     0.91668927793496713, 0.7999932862443857},
+    {-0.67804870399858053, -0.76621987621887255,
+     0.81619271635804991, 0.69869330270972008},
+    {-0.69826815156950772, -0.78643932378979975,
+     0.87287968390194304, 0.75322486644173869},
+    {-0.60332744431804108, -0.69149861653833311,
+     0.84590842139606215, 0.73536929585406252},
+    {-0.62213880109986264, -0.71030997332015466,
+     0.9014316699771443, 0.78927753292405511},
+    {-0.63119660262025645, -0.71936777484054848,
+     0.80447319570478804, 0.69151007246702056},
+    {-0.71378550506043958, -0.80195667728073161,
+     1.5019103574036534, 1.3805127962908195},
+    {-0.71276015980284202, -0.80093133202313405,
+     1.4322607916041432, 1.3109808561008613},
+    {-0.67108202610086976, -0.75925319832116178,
+     1.5361895941272186, 1.4194040077201995},
+    {-0.6709744134496608, -0.75914558566995283,
+     1.4689316054476067, 1.3521569329920977},
+    {-0.75608756118750275, -0.84425873340779478,
+     1.5377424149437975, 1.4111656298456763},
+    {-0.7557647866887337, -0.84393595890902573,
+     1.464838079956422, 1.3383033555231953},
+    {-0.7123921347845048, -0.80056330700479683,
+     1.5713970165475757, 1.4501592135185064},
+    {-0.74812043765587455, -0.83629160987616658,
+     1.3211152687373828, 1.1955647680667303},
+    {-0.74074375366974432, -0.82891492589003635,
+     1.2490573034808305, 1.1244353036881207},
+    {-0.70926409269931079, -0.79743526491960282,
+     1.3618474121318644, 1.2409658776924803},
+    {-0.70327058150313659, -0.79144175372342862,
+     1.291359436955819, 1.1711514467199828},
+    {-0.79238800129887776, -0.88055917351916979,
+     1.3497265674968215, 1.2181444155560337},
+    {-0.78492424872594513, -0.87309542094623716,
+     1.2784033254059897, 1.1478965525667535},
+    {-0.75288253784629477, -0.8410537100665868,
+     1.3935244942337355, 1.2673635378358719},
+    {-0.5835224661987608, -0.67169363841905283,
+     1.5363975696043231, 1.4274682081366683},
+    {-0.58275342976045097, -0.670924601980743,
+     1.4724142984137454, 1.3635456429297954},
+    {-0.5384657264259668, -0.62663689864625882,
+     1.56737637221426, 1.4617899621638488},
+    {-0.53822030973750401, -0.62639148195779604,
+     1.5055715738194897, 1.4000022296400434},
+    {-0.62718533350597283, -0.71535650572626486,
+     1.5684813290550284, 1.4558790425097738},
+    {-0.62779645970126507, -0.7159676319215571,
+     1.5036143523826275, 1.3909573574085454},
+    {-0.58239349307716837, -0.67056466529746039,
+     1.5989005568131125, 1.4900602685652697},
+    {-0.62263639434074924, -0.71080756656104127,
+     1.3705433345072746, 1.2583452948906222},
+    {-0.61675618574796509, -0.70492735796825712,
+     1.3034822308244638, 1.1917990519945643},
+    {-0.57998312736429569, -0.66815429958458772,
+     1.4074360350669637, 1.2987849693260882},
+    {-0.57516181551876622, -0.66333298773905824,
+     1.3419960169710692, 1.2337195922996715},
+    {-0.6685747054850274, -0.75674587770531943,
+     1.4006135765141208, 1.2840814007788772},
+    {-0.66382299093803421, -0.75199416315832623,
+     1.3318567709976779, 1.2157998437843163},
+    {-0.626308630550378, -0.71447980277067002,
+     1.4374508957107821, 1.324926926139713},
+    {-0.79545604038680917, -0.8836272126071012,
+     1.656558644381144, 1.5245271477042062},
+    {-0.79914132152364814, -0.88731249374394017,
+     1.5782359430876689, 1.445658970333487},
+    {-0.74852744564136797, -0.83669861786166,
+     1.6853097186986097, 1.5597073856401384},
+    {-0.75369893903758378, -0.84187011125787581,
+     1.6114978734070329, 1.485231377435305},
+    {-0.83726887646858472, -0.92544004868887675,
+     1.7073332593648474, 1.5687225783587995},
+    {-0.84260005449164499, -0.93077122671193702,
+     1.6241918491402727, 1.4846769818853949},
+    {-0.78866266641182281, -0.87683383863211484,
+     1.7344031676647746, 1.6033608815090792},
+    {-0.84298719099867403, -0.93115836321896606,
+     1.4588129422638989, 1.3192318007993458},
+    {-0.83836582616817112, -0.92653699838846315,
+     1.3787710423654116, 1.2399755957530063},
+    {-0.79975285774257432, -0.88792402996286635,
+     1.5003923662788481, 1.3677242661879025},
+    {-0.79742719867992629, -0.88559837090021831,
+     1.4239486339414833, 1.2916261598511538},
+    {-0.88925682278660301, -0.97742799500689503,
+     1.499041750168089, 1.3508925798733671},
+    {-0.88534625644214593, -0.97351742866243796,
+     1.412401809350357, 1.2650296810371819},
+    {-0.84447143449096196, -0.93264260671125399,
+     1.5409710913124131, 1.4011350820221047},
+    {-0.66395517669788939, -0.75212634891818142,
+     1.668170872326934, 1.5521008122101072},
+    {-0.66902022212723644, -0.75719139434752847,
+     1.6018224355947721, 1.4852453661346288},
+    {-0.62026288324559686, -0.70843405546588889,
+     1.6924542683688468, 1.5804650857085552},
+    {-0.62461404728865955, -0.71278521950895157,
+     1.6315633880660141, 1.5191902448163928},
+    {-0.70216786657789898, -0.79033903879819101,
+     1.7109929919462494, 1.5909076382664671},
+    {-0.70852668345794967, -0.7966978556782417,
+     1.6413183034005276, 1.5205202795523987},
+    {-0.65667722469035561, -0.74484839691064764,
+     1.7340583868393158, 1.6187040217749011},
+    {-0.74106652584391253, -0.82923769806420455,
+     -1.3077402902032509, -1.4324024882276778},
+    {-0.7029180935987196, -0.79108926581901162,
+     -1.3560737183915439, -1.4762424641682386},
+    {-0.72904218745087146, -0.81721335967116349,
+     -1.2449980535094674, -1.3681886363520697},
+    {-0.69295687078641033, -0.78112804300670236,
+     -1.2935024750348274, -1.4125787579058684},
+    {-0.78989349043293, -0.87806466265322203,
+     -1.3235728806841851, -1.4547928425892862},
+    {-0.75135790610433151, -0.83952907832462353,
+     -1.37440154838481, -1.5003661054655397},
+    {-0.77741492854592709, -0.86558610076621911,
+     -1.2565910746198883, -1.3860407152966667},
+    {-0.66943877724954537, -0.7576099494698374,
+     -1.4665755445040078, -1.5831948434577496},
+    {-0.62671990662258181, -0.71489107884287384,
+     -1.5081417261039973, -1.6207024111390604},
+    {-0.66325867909837255, -0.75142985131866458,
+     -1.4016088715793122, -1.5176097895489367},
+    {-0.62240008840028771, -0.71057126062057974,
+     -1.4444059333807364, -1.5565831160181767},
+    {-0.71719086130503606, -0.80536203352532809,
+     -1.491058527196623, -1.6128493077342996},
+    {-0.67357236640588669, -0.76174353862617872,
+     -1.5340598935224625, -1.6510989976602561},
+    {-0.71109844134234357, -0.79926961356263559,
+     -1.422038272279835, -1.5431283319421347},
+    {-0.66894609383590731, -0.75711726605619933,
+     -1.1792117087657512, -1.2957813044787503},
+    {-0.63508885027272866, -0.72326002249302068,
+     -1.225000058435036, -1.3383172777521648},
+    {-0.65549091159727391, -0.74366208381756593,
+     -1.1275462514105108, -1.2427853702387881},
+    {-0.62340116723862682, -0.71157233945891885,
+     -1.172724884547355, -1.2849905212115416},
+    {-0.71563669976663025, -0.80380787198692227,
+     -1.1862927979032243, -1.3079036275787179},
+    {-0.68153038696968804, -0.76970155918998007,
+     -1.2345229331128256, -1.3523845235301197},
+    {-0.70118212915530187, -0.7893533013755939,
+     -1.1316162771733707, -1.2515923387549401},
+    {-0.6087133512611882, -0.69688452348148022,
+     -1.3245390396133787, -1.4355317849823288},
+    {-0.57051717721793971, -0.65868834943823174,
+     -1.3662700614309011, -1.4741903731804034},
+    {-0.59982400807394687, -0.68799518029423889,
+     -1.2689006109186931, -1.3791483613376674},
+    {-0.56338955891169784, -0.65156073113198987,
+     -1.3108672200407472, -1.4182500620576175},
+    {-0.65528964351126073, -0.74346081573155276,
+     -1.3395381039538725, -1.4547577092062378},
+    {-0.61632001437679895, -0.70449118659709098,
+     -1.3831062412222852, -1.4947515713580735},
+    {-0.6458072051755257, -0.73397837739581773,
+     -1.2806202898673174, -1.3949331939645144},
+    {-0.87575310298598885, -0.96392427520628088,
+     -1.2840184263363157, -1.4295277789788461},
+    {-0.83916134543619736, -0.92733251765648939,
+     -1.3412993139345644, -1.480229167609536},
+    {-0.86063898113849613, -0.94881015335878816,
+     -1.2122359686092681, -1.3549303584231791},
+    {-0.82640804390455702, -0.91457921612484905,
+     -1.2695098801978939, -1.4063262125262415},
+    {-0.92515811513960777, -1.0133292873598996,
+     -1.3004561203889367, -1.4562567089316505},
+    {-0.88856354975772167, -0.9767347219780137,
+     -1.3612974531682158, -1.509308105639108},
+    {-0.9098373979345793, -0.99800857015487132,
+     -1.2229937260081638, -1.3754104266682241},
+    {-0.80832775205209773, -0.89649892427238975,
+     -1.470008245654576, -1.6039727570439306},
+    {-0.76533973240771036, -0.85351090462800239,
+     -1.5182202782203773, -1.6460204119805488},
+    {-0.80032929923401808, -0.8885004714543101,
+     -1.3948363731550606, -1.5275905312394793},
+    {-0.75956124204441666, -0.84773241426470869,
+     -1.4447099152564244, -1.5717419706766855},
+    {-0.85704079038598058, -0.9452119626062726,
+     -1.4984040333327386, -1.640448984280654},
+    {-0.81352633091377857, -0.9016975031340706,
+     -1.5484990480969791, -1.6832667860585244},
+    {-0.84951637200199026, -0.93768754422228229,
+     -1.4177688227138585, -1.5584804570525823},
+    {-0.79548939861183432, -0.88366057083212635,
+     -1.1408075473911234, -1.2728439534149707},
+    {-0.76329277361445902, -0.85146394583475105,
+     -1.1940679539897265, -1.3215944580879284},
+    {-0.77816465127853429, -0.86633582349882632,
+     -1.0838336986072525, -1.2133877845028189},
+    {-0.7479089889806656, -0.83608016120095763,
+     -1.1360180376433771, -1.2615416354533766},
+    {-0.84371699569557213, -0.93188816791586415,
+     -1.1460562263055427, -1.2857625319887529},
+    {-0.81170520128843771, -0.89987637350872973,
+     -1.2026625368827442, -1.3371473865194172},
+    {-0.82545179717783868, -0.9136229693981307,
+     -1.0853710354892878, -1.2220323745160622},
+    {-0.75535645503582605, -0.84352762725611807,
+     0.28413471061400219, 0.15765313687276056},
+    {-0.77322597861778775, -0.86139715083807977,
+     0.34786122720534779, 0.21899074274000579},
+    {-0.78556454775059037, -0.8737357199708824,
+     0.2270688955244885, 0.096470842682326197},
+    {-0.80485349928956862, -0.89302467150986065,
+     0.29360243292666094, 0.16016740702335164},
+    {-0.70493575953829002, -0.79310693175858205,
+     0.27558645082723993, 0.15519251738303108},
+    {-0.72409475146884517, -0.81226592368913719,
+     0.33669461331228334, 0.2140943787488474},
+    {-0.73484059025120851, -0.82301176247150054,
+     0.22050155179656925, 0.096607921867943786},
+    {-0.75504747180410725, -0.84321864402439928,
+     0.45756459198695065, 0.3311231935259783},
+    {-0.76701523290714357, -0.8551864051274356,
+     0.51648514684566194, 0.38845976307558688},
+    {-0.78849053938679348, -0.8766617116070855,
+     0.41117307142304466, 0.28015557853250667},
+    {-0.80124545445019213, -0.88941662667048416,
+     0.47358149820958761, 0.34069024474496812},
+    {-0.70790038653117837, -0.7960715587514704,
+     0.44286711333053835, 0.32213987466856048},
+    {-0.72138975445043363, -0.80956092667072566,
+     0.49976153671033485, 0.37748042585829811},
+    {-0.74077704826598678, -0.82894822048627881,
+     0.3974994085419874, 0.27287326402088352},
+    {-0.86387541285470049, -0.95204658507499251,
+     0.1700852355900222, 0.026800015504401316},
+    {-0.88361635730343713, -0.97178752952372915,
+     0.24265411915936527, 0.095622417927334474},
+    {-0.89032866522682652, -0.97849983744711855,
+     0.10052202497833132, -0.047841953882991575},
+    {-0.91207742821036697, -1.000248600430659,
+     0.1755169951473658, 0.022616971321122073},
+    {-0.81427777376257027, -0.90244894598286229,
+     0.16531836987576221, 0.030433427546045694},
+    {-0.83522478331594419, -0.92339595553623621,
+     0.23441730841890634, 0.096149173779234945},
+    {-0.8410397407421315, -0.92921091296242353,
+     0.098820796095835495, -0.040427807823839063},
+    {-0.86827404208062797, -0.95644521430092,
+     0.37373859067331272, 0.22964005393806908},
+    {-0.88051170712715743, -0.96868287934744945,
+     0.44264413955007537, 0.29621837988666072},
+    {-0.90024720709254069, -0.98841837931283272,
+     0.31580237513306414, 0.16541238536943281},
+    {-0.913829430792513, -1.002000603012805,
+     0.38876842001275891, 0.23548769387449642},
+    {-0.82135084712075612, -0.90952201934104815,
+     0.36016036666303136, 0.22415836200617639},
+    {-0.835127724511458, -0.92329889673175003,
+     0.42616618780968046, 0.28791426170153794},
+    {-0.85321199598267017, -0.9413831682029622,
+     0.30411065089407724, 0.16274829946074287},
+    {-0.63116760157042817, -0.7193387737907202,
+     0.20935963520694531, 0.096399135609294889},
+    {-0.65383234743501062, -0.74200351965530265,
+     0.26785426314585742, 0.15277561148154647},
+    {-0.65919931097629525, -0.74737048319658728,
+     0.15425175962053916, 0.038651073416513353},
+    {-0.68328818738380814, -0.77145935960410017,
+     0.21462439279209877, 0.096578555643957897},
+    {-0.57875690544008029, -0.66692807766037232,
+     0.20464003366210481, 0.096084736790599146},
+    {-0.60230725901039317, -0.6904784312306852,
+     0.26084903771633411, 0.1503950581204232},
+    {-0.60625749340656965, -0.69442866562686167,
+     0.15144310952962101, 0.040658064608354152},
+    {-0.64295320805966716, -0.73112438027995919,
+     0.37355969639874365, 0.25951490210949257},
+    {-0.6600103843005044, -0.74818155652079643,
+     0.42935542186731135, 0.31367514142895403},
+    {-0.67417867111454932, -0.76234984333484135,
+     0.32653502493601227, 0.20943392197162938},
+    {-0.69218976651973108, -0.7803609387400231,
+     0.38500276916023274, 0.26600930472983592},
+    {-0.59330875838667207, -0.6814799306069641,
+     0.36306250382579308, 0.2533489856308403},
+    {-0.61160144843675734, -0.69977262065704937,
+     0.41691226972653056, 0.30567340903536283},
+    {-0.62372070575886929, -0.71189187797916131,
+     0.31727416077657411, 0.20498023702320081},
+    {-0.73865252881078913, -0.82682370103108116,
+     0.096344329037667903, -0.02801816862969627},
+    {-0.76347675061635756, -0.85164792283664958,
+     0.1611346895379808, 0.033583661873046289},
+    {-0.76373411486407028, -0.85190528708436231,
+     0.031343944511690668, -0.096241412091049874},
+    {-0.79040947909694625, -0.87858065131723828,
+     0.097440185366049023, -0.033854464776368949},
+    {-0.68601698522190946, -0.77418815744220149,
+     0.095502308945839998, -0.022831421568517175},
+    {-0.71169864838622365, -0.79986982060651568,
+     0.15746538591408848, 0.036306850965200692},
+    {-0.71122558723552076, -0.79939675945581279,
+     0.033186823062780445, -0.087917732075891875},
+    {-0.75949706360884395, -0.84766823582913597,
+     -1.8296834337681533, -1.956707034176641},
+    {-0.70875164760309595, -0.79692281982338797,
+     -1.8607562843113503, -1.98157976584476},
+    {-0.76555870549558469, -0.85372987771587672,
+     -1.7509768068813794, -1.8788063134129567},
+    {-0.71598913805770015, -0.80416031027799217,
+     -1.7860705823821121, -1.9077221472473547},
+    {-0.80183360273140813, -0.89000477495170016,
+     -1.8773191364098967, -2.0102986098229287},
+    {-0.75041620502422446, -0.83858737724451649,
+     -1.9073581912181785, -2.0332018918393775},
+    {-0.80980816024426505, -0.89797933246455708,
+     -1.7950305176166803, -1.9292224194836654},
+    {-0.64745884800217135, -0.73563002022246338,
+     -1.9582279715509987, -2.0726970373398421},
+    {-0.59662053114522806, -0.68479170336552009,
+     -1.9798667408241475, -2.0898505830637979},
+    {-0.65795418729743504, -0.74612535951772707,
+     -1.8887083320282581, -2.0041871893060934},
+    {-0.60746573816410654, -0.69563691038439857,
+     -1.9139338625629787, -2.0248209121414447},
+    {-0.68644950364288548, -0.77462067586317751,
+     -2.0056176086883193, -2.1239971807143787},
+    {-0.63482802484567247, -0.72299919706596449,
+     -2.0257381334862208, -2.1390315012038252},
+    {-0.69883690964602385, -0.78700808186631588,
+     -1.9341815904643316, -2.0538988942376659},
+    {-0.72204906586394357, -0.8102202380842356,
+     -1.6361888984626582, -1.7585475562976125},
+    {-0.67486718502737553, -0.76303835724766755,
+     -1.6744821192557624, -1.7916537594588675},
+    {-0.72091703374905702, -0.80908820596934905,
+     -1.5626501420127978, -1.6848757454970038},
+    {-0.67543778500960372, -0.76360895722989575,
+     -1.6035636612427038, -1.7207938651365542},
+    {-0.76851731931532385, -0.85668849153561588,
+     -1.6721970865435127, -1.8004253895609483},
+    {-0.72042988949479481, -0.80860106171508683,
+     -1.7109344999647955, -1.8331029836999428},
+    {-0.76839992028250748, -0.8565710925027995,
+     -1.5943102876441468, -1.7225226974434413},
+    {-0.62290147610699531, -0.71107264832728734,
+     -1.7781611611832282, -1.890382614299648},
+    {-0.57421608100382304, -0.66238725322411507,
+     -1.8073654493741109, -1.9155689830444798},
+    {-0.6272436020895592, -0.71541477430985123,
+     -1.7095223657195813, -1.8221298644024675},
+    {-0.57955338322351369, -0.66772455544380571,
+     -1.7416209182669751, -1.8502383828446365},
+    {-0.66610290436043795, -0.75427407658072998,
+     -1.8177815467298037, -1.9340656899158946},
+    {-0.61627820930580868, -0.7044493815261007,
+     -1.8465068063825258, -1.9581485113530417},
+    {-0.67176191503482185, -0.75993308725511388,
+     -1.7461305542281094, -1.8629851726744728},
+    {-0.89378533394492699, -0.98195650616521901,
+     -1.8969659036472053, -2.0460280701331759},
+    {-0.84253515216417274, -0.93070632438446477,
+     -1.9293199017021638, -2.0688236664807911},
+    {-0.90265959141836871, -0.99083076363866074,
+     -1.8054051266694264, -1.9562985352265621},
+    {-0.85271011914718697, -0.940881291367479,
+     -1.8435422452479022, -1.9848157610545014},
+    {-0.93255631062131816, -1.0207274828416102,
+     -1.9557328092328714, -2.1132352484345396},
+    {-0.88114055866290619, -0.96931173088319822,
+     -1.9859945942279866, -2.1325425705813652},
+    {-0.94403281073851886, -1.032203982958811,
+     -1.860072128838298, -2.0203070333656155},
+    {-0.77653205892109645, -0.86470323114138847,
+     -2.0356687725344442, -2.1649957278980643},
+    {-0.72403594876335942, -0.81220712098365144,
+     -2.056207336443971, -2.1788006064655807},
+    {-0.79065203531973127, -0.8788232075400233,
+     -1.9578437038258119, -2.0891735049258311},
+    {-0.73850405843306599, -0.82667523065335802,
+     -1.9831174048866809, -2.1074615404600348},
+    {-0.81251136841883198, -0.90068254063912401,
+     -2.0919295024088358, -2.226539377710453},
+    {-0.7598266124772417, -0.84799778469753373,
+     -2.1100491482505399, -2.2371161816795997},
+    {-0.82901583013864244, -0.91718700235893447,
+     -2.0124317905522839, -2.1496732376417564},
+    {-0.86216104550784245, -0.95033221772813448,
+     -1.6687829477171645, -1.8117544050157934},
+    {-0.81441673769261824, -0.90258790991291027,
+     -1.7120497593226391, -1.8469564068833433},
+    {-0.86135344568086103, -0.94952461790115306,
+     -1.5824206900693505, -1.7252449616746142},
+    {-0.81562522965804674, -0.90379640187833876,
+     -1.6295066926376158, -1.7646025035520307},
+    {-0.90754596610827043, -0.99571713832856246,
+     -1.7127660652416323, -1.8646922896495197},
+    {-0.85929048276367259, -0.94746165498396462,
+     -1.7562637823376057, -1.8987138704260051},
+    {-0.90839078372252302, -0.99656195594281505,
+     -1.6206147887935589, -1.7727213839396472},
+    {-0.80690815440526964, -0.89507932662556167,
+     -2.7552705348211255, -2.8890179937062452},
+    {-0.77352239181848581, -0.86169356403877784,
+     -2.8142608518877159, -2.9431720731712163},
+    {-0.79115883602588244, -0.87933000824617447,
+     -2.684175763468291, -2.8155790952651474},
+    {-0.7594088119155038, -0.84757998413579583,
+     -2.7444238936803096, -2.8714358703037739},
+    {-0.85260750834351073, -0.94077868056380276,
+     -2.7667615239051755, -2.908016895024248},
+    {-0.81976871926955752, -0.90793989148984955,
+     -2.8275861209980233, -2.9633360635292618},
+    {-0.83803058192259272, -0.92620175414288475,
+     -2.6929807499887155, -2.8317196595046101},
+    {-0.74818221160338916, -0.83635338382368118,
+     -2.938047576863112, -3.0636059403413602},
+    {-0.71011284725940349, -0.79828401947969552,
+     -2.987764962791978, -3.10874284207231},
+    {-0.73817955027676685, -0.82635072249705888,
+     -2.8698357661694662, -2.9941397965610013},
+    {-0.70121633124739857, -0.7893875034676906,
+     -2.9219728751693141, -3.041952723571046},
+    {-0.79340468460599523, -0.88157585682628725,
+     -2.9549866627742039, -3.0867172415320021},
+    {-0.75559132100551396, -0.84376249322580599,
+     -3.0056616681002102, -3.1321738052530415},
+    {-0.78485045505594087, -0.87302162727623289,
+     -2.8846815701526412, -3.0151778347213343},
+    {-0.72318630299788345, -0.81135747521817547,
+     -2.6090952080592973, -2.7315879822577585},
+    {-0.69246086035027432, -0.78063203257056635,
+     -2.6679106957575192, -2.7869334069694318},
+    {-0.7014506512909322, -0.78962182351122423,
+     -2.5446984535852795, -2.664704255865487},
+    {-0.67231171118537714, -0.76048288340566916,
+     -2.603463389381099, -2.7203739302381282},
+    {-0.77264647521563379, -0.86081764743592581,
+     -2.6149740798684609, -2.7437650287067865},
+    {-0.74257994260875715, -0.83075111482904918,
+     -2.6758366712715711, -2.8006878711434551},
+    {-0.75157643578087541, -0.83974760800116743,
+     -2.5482305364618085, -2.6742231884750005},
+    {-0.67596413745777228, -0.76413530967806431,
+     -2.7897128418975163, -2.9069971539310617},
+    {-0.64001930834532461, -0.72819048056561664,
+     -2.8423907610247312, -2.9561622107925061},
+    {-0.65964532781121243, -0.74781650003150446,
+     -2.7243979475795195, -2.8400423804252979},
+    {-0.62503191051551488, -0.7132030827358069,
+     -2.7783565298865893, -2.8907667974877995},
+    {-0.72553086494364816, -0.81370203716394018,
+     -2.8016600925691484, -2.9244307970858183},
+    {-0.68983916440730342, -0.77801033662759544,
+     -2.8557619685244187, -2.9745028064463379},
+    {-0.71025821998797234, -0.79842939220826437,
+     -2.7341529803539459, -2.8551473855100755},
+    {-0.92618208945698854, -1.0143532616772806,
+     -2.7122425707746638, -2.8682760061015227},
+    {-0.89639716557776594, -0.98456833779805797,
+     -2.7789754493946339, -2.9285707251174942},
+    {-0.9108935075440564, -0.99906467976434843,
+     -2.6344714106243368, -2.7871155075052441},
+    {-0.88306809305548306, -0.97123926527577509,
+     -2.7023127606112021, -2.8492369884712141},
+    {-0.96731757218278613, -1.0554887444030783,
+     -2.722852197685262, -2.889002247098658},
+    {-0.93820354314850851, -1.0263747153688003,
+     -2.7920022944265854, -2.9508349368864097},
+    {-0.95324237641465381, -1.0414135486349458,
+     -2.641750836041949, -2.8042637188620376},
+    {-0.87261935068051921, -0.96079052290081124,
+     -2.9170089965379384, -3.0619228764316997},
+    {-0.83675225429408329, -0.92492342651437531,
+     -2.9728694245936227, -3.1113933159025429},
+    {-0.86413942776217334, -0.95231059998246537,
+     -2.841716296201068, -2.985049996066504},
+    {-0.8297012003271852, -0.91787237254747722,
+     -2.9003770763422962, -3.0377308447650671},
+    {-0.91352793825609302, -1.001699110476385,
+     -2.9346738476403829, -3.0878888922899668},
+    {-0.87812980979158028, -0.96630098201187231,
+     -2.9917828518896972, -3.1377480567596585},
+    {-0.90654159448655602, -0.99471276670684805,
+     -2.8567422714711141, -3.0084547564515023},
+    {-0.84723362870979302, -0.93540480093008505,
+     -2.5556250725695606, -2.6959387053734596},
+    {-0.82050771136882761, -0.90867888358911963,
+     -2.6211347510111116, -2.757002269891867},
+    {-0.82513979851514685, -0.91331097073543888,
+     -2.4869044457224336, -2.6235153173930983},
+    {-0.80022472173692583, -0.88839589395721785,
+     -2.5518661330787338, -2.6846046670346806},
+    {-0.89248020606324263, -0.98065137828353466,
+     -2.559530983587349, -2.708328556912476},
+    {-0.86662534547961934, -0.95479651769991136,
+     -2.6276179698720887, -2.7714102531992757},
+    {-0.87117438011617754, -0.95934555233646956,
+     -2.4880772669517852, -2.6327186907474256},
+    {-0.83038024554506851, -0.91855141776536053,
+     0.70615324623196374, 0.56868794784362753},
+    {-0.82599808488315429, -0.91416925710344632,
+     0.65120799541590224, 0.5144581696630679},
+    {-0.81210244916841101, -0.90027362138870304,
+     0.75140952517939197, 0.61686310771256814},
+    {-0.79575860842394086, -0.88392978064423289,
+     0.69236780653828078, 0.56029176202330522},
+    {-0.86258814126917394, -0.95075931348946596,
+     0.68568169397080703, 0.54263223769117697},
+    {-0.82599808488315429, -0.91416925710344632,
+     0.65120799541590224, 0.5144581696630679},
+    {-0.85358252375824262, -0.94175369597853464,
+     0.75036061294312684, 0.60893258097013359},
+    {-0.85506697751977656, -0.94323814974006859,
+     0.55437897902192845, 0.41268700105272199},
+    {-0.84631001971981612, -0.93448119194010815,
+     0.4910709294121115, 0.35091748374379683},
+    {-0.81981630861776844, -0.90798748083806047,
+     0.59395432049271135, 0.45819681468545592},
+    {-0.81163000611652192, -0.89980117833681394,
+     0.53463857759428657, 0.40016537342096081},
+    {-0.89453600267438882, -0.98270717489468085,
+     0.58688110186305309, 0.43766620768002551},
+    {-0.89008137490580508, -0.97825254712609711,
+     0.51020915577193271, 0.3618948068939008},
+    {-0.8615987812932171, -0.94976995351350912,
+     0.6156677308708165, 0.47279878857020891},
+    {-0.74776136252809156, -0.83593253474838358,
+     0.78474119277057297, 0.65923636748615033},
+    {-0.73191949884141894, -0.82009067106171096,
+     0.72707871923325995, 0.60354078626967733},
+    {-0.72411353439101278, -0.81228470661130481,
+     0.828840167707102, 0.7062377082544411},
+    {-0.70279341309882004, -0.79096458531911207,
+     0.77348659161108912, 0.65333171750735142},
+    {-0.79174258669476549, -0.87991375891505752,
+     0.79692401403135182, 0.66543584303641734},
+    {-0.76926889142406707, -0.8574400636443591,
+     0.74075531314464849, 0.61242512861873988},
+    {-0.76920715941030304, -0.85737833163059507,
+     0.84250629954451417, 0.71418449211367696},
+    {-0.74708199707435297, -0.83525316929464499,
+     0.61708242856896889, 0.49166388544675366},
+    {-0.73277297170335676, -0.82094414392364878,
+     0.55535620947243147, 0.4317146708054927},
+    {-0.72080726471301093, -0.80897843693330296,
+     0.66615729025607284, 0.54394456485399445},
+    {-0.70758628826332048, -0.79575746048361251,
+     0.60509443674480834, 0.48440264898096252},
+    {-0.78464196647051376, -0.87281313869080579,
+     0.62951314783033752, 0.49904655920211688},
+    {-0.77682405772719687, -0.8649952299474889,
+     0.57390212875778923, 0.44453463356565193},
+    {-0.75924746783694752, -0.84741864005723955,
+     0.6790385745344949, 0.55204784076643909},
+    {-0.93063337166000526, -1.0188045438802971,
+     0.71482056424726204, 0.55776486413189796},
+    {-0.89618806750326718, -0.98435923972355921,
+     0.6622871841361877, 0.51273476607032431},
+    {-0.92039166983104259, -1.0085628420513346,
+     0.78777033570604127, 0.63304240603514406},
+    {-0.89519691303837701, -0.98336808525866903,
+     0.73563141900997175, 0.5862817299276919},
+    {-0.96751125635968294, -1.0556824285799751,
+     0.69056746292238069, 0.52436599630008918},
+    {-0.93110912590062922, -1.019280298120921,
+     0.63531770269993637, 0.4781517650692923},
+    {-0.96455641486032062, -1.0527275870806128,
+     0.7741281259629571, 0.60870696200866381},
+    {-0.85506697751977656, -0.94323814974006859,
+     0.55437897902192845, 0.41268700105272199},
+    {-0.81163000611652192, -0.89980117833681394,
+     0.53463857759428657, 0.40016537342096081},
+    {-0.8615987812932171, -0.94976995351350912,
+     0.6156677308708165, 0.47279878857020891},
+    {-0.81981630861776844, -0.90798748083806047,
+     0.59395432049271135, 0.45819681468545592},
+    {-0.89008137490580508, -0.97825254712609711,
+     0.51020915577193271, 0.3618948068939008},
+    {-0.84631001971981612, -0.93448119194010815,
+     0.4910709294121115, 0.35091748374379683},
+    {-0.89453600267438882, -0.98270717489468085,
+     0.58688110186305309, 0.43766620768002551},
+    {-0.85630938753378605, -0.94448055975407808,
+     0.86187069082587753, 0.71995680457143396},
+    {-0.83459434663292331, -0.92276551885321534,
+     0.81013013549425616, 0.67196719090758605},
+    {-0.83320171621979167, -0.92137288844008369,
+     0.92187106898398741, 0.7839397281649424},
+    {-0.81316760998486093, -0.90133878220515296,
+     0.85729325721337413, 0.72258137122344179},
+    {-0.90041682925427813, -0.98858800147457015,
+     0.85470692666087589, 0.70428167837412736},
+    {-0.87701358227353565, -0.96518475449382768,
+     0.79965990162780931, 0.6539092468579436},
+    {-0.87773783397495997, -0.965909006195252,
+     0.91916150372949035, 0.77327173316831399},
+    {-0.83136732245370726, -0.91953849467399928,
+     2.4318198423359698, 2.2941919845610581},
+    {-0.81289810166505982, -0.90106927388535185,
+     2.3576383340941991, 2.2229683680478258},
+    {-0.79829426911421919, -0.88646544133451122,
+     2.4834743229140845, 2.351023284314945},
+    {-0.7821130225335603, -0.87028419475385232,
+     2.4106441026747971, 2.2805359586434495},
+    {-0.88045370508450305, -0.96862487730479507,
+     2.4558120298212183, 2.3093975296159961},
+    {-0.86287545734175497, -0.951046629562047,
+     2.3759473022167219, 2.2328453118297524},
+    {-0.84712450343296675, -0.93529567565325877,
+     2.5088980630281017, 2.3686033817957663},
+    {-0.81841792086357146, -0.90658909308386348,
+     2.2240240242511109, 2.0884882825375457},
+    {-0.79212349417551153, -0.88029466639580356,
+     2.1532990376834364, 2.021755424365085},
+    {-0.79163293348771424, -0.87980410570800627,
+     2.2856722814132349, 2.1542000586018233},
+    {-0.76782336001040608, -0.8559945322306981,
+     2.2165190404100126, 2.0883846012755005},
+    {-0.87012694932954893, -0.95829812154984095,
+     2.2328622108945089, 2.0884174573056669},
+    {-0.84372663581559137, -0.9318978080358834,
+     2.1565511303976028, 2.0168431693977236},
+    {-0.84211234807927571, -0.93028352029956773,
+     2.2984301922461969, 2.1589986965862349},
+    {-0.71246252488488748, -0.80063369710517951,
+     2.508332550238356, 2.3870866922992389},
+    {-0.69790584593052729, -0.78607701815081932,
+     2.4396373338706585, 2.3200222667668635},
+    {-0.67433707314383717, -0.7625082453641292,
+     2.5541004923049955, 2.436983173724903},
+    {-0.66157370295362283, -0.74974487517391486,
+     2.4860025835938062, 2.3701683628740335},
+    {-0.76271725507734334, -0.85088842729763536,
+     2.5328465844009198, 2.4053967064539439},
+    {-0.74846052659288742, -0.83663169881317945,
+     2.4604848520560312, 2.3348910454942819},
+    {-0.72484414629285787, -0.8130153185131499,
+     2.5798605774052268, 2.4571714786381005},
+    {-0.71390821725855791, -0.80207938947884994,
+     2.3263355799819432, 2.2049239177202993},
+    {-0.69436108045811595, -0.78253225267840798,
+     2.2651159616978211, 2.1458875959384778},
+    {-0.68150475891016227, -0.76967593113045429,
+     2.3742116625324066, 2.256352751416447},
+    {-0.66360815351555535, -0.75177932573584738,
+     2.3123416503356728, 2.1963060569599278},
+    {-0.76387837637369538, -0.8520495485939874,
+     2.3418009463277687, 2.2141963353946266},
+    {-0.74231602263539409, -0.83048719485568612,
+     2.2746729989101753, 2.1498548203063792},
+    {-0.7320671085359598, -0.82023828075625183,
+     2.3915257438785713, 2.2679699109744589},
+    {-0.94265939730521409, -1.0308305695255062,
+     2.5713532636405096, 2.4114514561852269},
+    {-0.92997628968292512, -1.0181474619032169,
+     2.483697065938395, 2.3267933065936623},
+    {-0.90672283926679387, -0.99489401148708589,
+     2.6224865469585414, 2.4707355472372829},
+    {-0.89468936354547801, -0.98286053576577004,
+     2.5370975955666455, 2.3878514504080699},
+    {-0.99043021287549549, -1.0786013850957876,
+     2.6113085562768492, 2.4387427182284491},
+    {-0.97961687783901319, -1.0677880500593053,
+     2.5164111848213491, 2.3469188630788116},
+    {-0.95159885120933818, -1.0397700234296303,
+     2.6589619555382877, 2.496861344183809},
+    {-0.9455828976283599, -1.033754069848652,
+     2.3310045887286326, 2.1703917024033212},
+    {-0.92270024812335427, -1.0108714203436464,
+     2.2433684807488601, 2.0881233109306296},
+    {-0.91355197390512721, -1.0017231461254192,
+     2.3973009747176102, 2.2440806963708857},
+    {-0.89351849598047883, -0.98168966820077086,
+     2.3133587561267861, 2.1643507837881826},
+    {-0.99800955899202404, -1.0861807312123162,
+     2.3521084968466539, 2.1773086857504769},
+    {-0.97585905133523443, -1.0640302235555266,
+     2.2559957172454546, 2.0875414543430928},
+    {-0.9646361988843587, -1.0528073711046508,
+     2.4224564977235024, 2.2570143799303692},
+    {-0.82298227975473814, -0.91115345197503017,
+     2.6390133038856001, 2.5027500419143958},
+    {-0.81203279077788459, -0.90020396299817662,
+     2.5598227424630156, 2.4252871266769342},
+    {-0.78350898809568204, -0.87168016031597406,
+     2.6854340737984095, 2.5551284169394584},
+    {-0.77449563410864408, -0.86266680632893611,
+     2.6080677235905072, 2.4790224860628673},
+    {-0.87001702967079675, -0.95818820189108878,
+     2.6730252449247138, 2.5286010901489138},
+    {-0.86012228817498459, -0.94829346039527662,
+     2.5895804230565806, 2.4469797699210956},
+    {-0.83086770713173053, -0.91903887935202255,
+     2.7201783963114146, 2.5826328837865313},
+    {-0.87527970697440083, -0.96345087919469286,
+     3.0118155846338146, 2.8663965915291518},
+    {-0.879131594140108, -0.96730276636040002,
+     2.9287905966334362, 2.7826321449737845},
+    {-0.82991502284783225, -0.91808619506812428,
+     3.0436335213154169, 2.9062446599137917},
+    {-0.83492414512439872, -0.92309531734469075,
+     2.9650702130798252, 2.8268522675531966},
+    {-0.91325348396461337, -1.0014246561849054,
+     3.0617890706615185, 2.9086337560742574},
+    {-0.91915061605631343, -1.0073217882766055,
+     2.9767711271467023, 2.8223194959491025},
+    {-0.86827488037763012, -0.95644605259792215,
+     3.0918907091888097, 2.9477920163043003},
+    {-0.92031817037487085, -1.0084893425951629,
+     2.7997783579896409, 2.6450668258384762},
+    {-0.91533989234739321, -1.0035110645676852,
+     2.7104708493810099, 2.5568600023274142},
+    {-0.87959631195122057, -0.96776748417151259,
+     2.843850064170335, 2.6976017435203752},
+    {-0.87655475796129356, -0.96472593018158559,
+     2.7581803346682201, 2.6125176351345449},
+    {-0.96193783325970561, -1.0501090054799977,
+     2.8453315890694264, 2.6805946344040863},
+    {-0.95872037290117029, -1.0468915451214624,
+     2.7517582728306236, 2.5878527664238575},
+    {-0.92156972758724864, -1.0097408998075408,
+     2.8890109743443553, 2.7340196338037233},
+    {-0.74249547293595219, -0.83066664515624422,
+     3.0285817645382211, 2.9037411362312682},
+    {-0.74653516992038338, -0.83470634214067541,
+     2.9555839112992017, 2.8302346893117591},
+    {-0.69495145706016781, -0.78312262928045984,
+     3.0564547437803924, 2.9371622509470079},
+    {-0.69966527679197388, -0.7878364490122659,
+     2.9870270574769147, 2.867218559362319},
+    {-0.78337118011370976, -0.87154235233400179,
+     3.0726104114381272, 2.9423242907724916},
+    {-0.78926728964913095, -0.87743846186942298,
+     2.9982212820813392, 2.8670918004553383},
+    {-0.73597232604783647, -0.82414349826812849,
+     3.0990838782754992, 2.9750516024879095},
+    {-0.79250710874140706, -0.88067828096169909,
+     2.8430817057980233, 2.7114821895506767},
+    {-0.78954956648588104, -0.87772073870617306,
+     2.7640886398908107, 2.632918393664589},
+    {-0.74787431667824678, -0.8360454888985388,
+     2.8807701378048467, 2.7552509497564284},
+    {-0.74637356851892811, -0.83454474073922014,
+     2.8049329921884576, 2.6796042345294078},
+    {-0.83684453913188817, -0.92501571135218019,
+     2.8842954291357059, 2.7457560451656051},
+    {-0.83551027788430043, -0.92368145010459246,
+     2.8023031754848442, 2.6639873345078651},
+    {-0.79237860072458011, -0.88054977294487213,
+     2.9214367368886598, 2.7898559551540187},
+    {-0.93752423040293131, -1.0256954026232235,
+     -3.0861747721698332, 3.0383393603237425},
+    {-0.94869324128956467, -1.0368644135098568,
+     3.1150647995352974, 2.9536868908230693},
+    {-0.89233267237801739, -0.98050384459830942,
+     -3.0634692610682785, 3.0709483077968063},
+    {-0.90418490395036422, -0.99235607617065624,
+     -3.140162063686609, 2.9918093330340341},
+    {-0.96821155702724748, -1.0563827292475396,
+     -3.0294158333940224, 3.0873817808395936},
+    {-0.98148519342360563, -1.0696563656438978,
+     -3.1115258764670624, 3.0016453336299649},
+    {-0.92366258533095313, -1.0118337575512453,
+     -3.009581838072878, 3.1181414184806191},
+    {-0.99839865064096067, -1.0865698228612528,
+     2.991272020218843, 2.8163556920269892},
+    {-1.0012250274086651, -1.0893961996289574,
+     2.8952112086307955, 2.7194430092072248},
+    {-0.95672114780799322, -1.0448923200282854,
+     3.0284155728189086, 2.8650216379116893},
+    {-0.96122707299333376, -1.0493982452136259,
+     2.9380645388399542, 2.7735121289221065},
+    {-1.0329466100855422, -1.1211177823058345,
+     3.0488572431242726, 2.862820039513216},
+    {-1.0380203541156265, -1.1261915263359188,
+     2.949785873580884, 2.7619758370233929},
+    {-0.99169904553768673, -1.0798702177579789,
+     3.0838604501067803, 2.9109253085376126},
+    {-0.81174038176229046, -0.89991155398258249,
+     -3.0922044190825142, 3.056490589112717},
+    {-0.82207740172387689, -0.91024857394416891,
+     3.1191494795095589, 2.983031293114085},
+    {-0.76436756992831634, -0.85253874214860836,
+     -3.0714929526286476, 3.0840223887352587},
+    {-0.77496332626257491, -0.86313449848286694,
+     -3.1392528003905236, 3.0148227249673063},
+    {-0.84616221060049635, -0.93433338282078837,
+     -3.043014054986426, 3.100043396927266},
+    {-0.85844132539226548, -0.9466124976125575,
+     -3.1149859705115834, 3.0259025254417025},
+    {-0.79927369126400083, -0.88744486348429286,
+     -3.0244845510235776, 3.1261040733057723},
+    {-0.92021659738889794, -1.0083877696091901,
+     -0.2093752389362904, -0.36406411753764967},
+    {-0.88572221230020642, -0.97389338452049845,
+     -0.27634631786599884, -0.4237926976456825},
+    {-0.90530242888554491, -0.99347360110583693,
+     -0.12709037199810108, -0.27854018872490355},
+    {-0.87294612687624373, -0.96111729909653576,
+     -0.19608560538718295, -0.34106128486917514},
+    {-0.96731031044080995, -1.0554814826611021,
+     -0.22444230817011646, -0.39059043055367804},
+    {-0.93169960462346857, -1.0198707768437607,
+     -0.29522336837526642, -0.45252639142435824},
+    {-0.952638716688611, -1.0408098889089028,
+     -0.13577124544331431, -0.2981324083193917},
+    {-0.85662535367615478, -0.9447965258964468,
+     -0.41597420034912691, -0.55794466756754379},
+    {-0.816670600805525, -0.90484177302581703,
+     -0.46913217735011092, -0.60439220654882808},
+    {-0.848985714789535, -0.93715688700982702,
+     -0.33810496654996619, -0.47872381288373572},
+    {-0.81042115141328219, -0.89859232363357422,
+     -0.3948297006122054, -0.52911607023465324},
+    {-0.9004032468505706, -0.98857441907086263,
+     -0.44281756643674947, -0.59323999064783761},
+    {-0.8611244892008737, -0.94929566142116573,
+     -0.49307754599411308, -0.63586016215757846},
+    {-0.89505001515607019, -0.98322118737636222,
+     -0.35759962878820045, -0.5069193308681752},
+    {-0.83745302307160074, -0.92562419529189277,
+     -0.042396971268809092, -0.1810386231414112},
+    {-0.80672459385572104, -0.89489576607601307,
+     -0.10922376928301906, -0.24294323327825901},
+    {-0.81520481467018535, -0.90337598689047738,
+     0.029508852041685109, -0.10552106945782343},
+    {-0.78654434929494654, -0.87471552151523857,
+     -0.037309297174084162, -0.1680473802738458},
+    {-0.88694035416146777, -0.9751115263817598,
+     -0.04780924795758773, -0.19549686973160685},
+    {-0.8567946073842474, -0.94496577960453942,
+     -0.11781723129476709, -0.25981803165412276},
+    {-0.86540009646608129, -0.95357126868637332,
+     0.027676138900307796, -0.11588964264804416},
+    {-0.78885049173614974, -0.87702166395644177,
+     -0.24568016789324049, -0.37674952364526842},
+    {-0.75179354462410264, -0.83996471684439467,
+     -0.30331691740241828, -0.42933750005500448},
+    {-0.7735166576374245, -0.86168782985771653,
+     -0.1724837286168826, -0.30139416148559617},
+    {-0.7381817346297681, -0.82635290685006013,
+     -0.23199828833467928, -0.35630258855490338},
+    {-0.83810370160576686, -0.92627487382605889,
+     -0.26041389103646273, -0.39916512652701752},
+    {-0.8011659912270489, -0.88933716344734093,
+     -0.3200666728490732, -0.45294601963863224},
+    {-0.82398061270891398, -0.91215178492920601,
+     -0.1838344705783605, -0.32025828036703302},
+    {-1.0511696559734178, -1.1393408281937101,
+     -0.15442837001579146, -0.34701772041666745},
+    {-1.0157080698414687, -1.1038792420617609,
+     -0.24240382966468091, -0.42269377505204775},
+    {-1.0327065819735564, -1.1208777541938486,
+     -0.053874919457027881, -0.23982920103051186},
+    {-1.001228073662388, -1.0893992458826802,
+     -0.14426433384995185, -0.32003345665083643},
+    {-1.1022069229713529, -1.1903780951916452,
+     -0.16688428318191967, -0.38096021179724399},
+    {-1.0651313125050808, -1.153302484725373,
+     -0.26422613489223584, -0.46220219303029403},
+    {-1.0837721462510228, -1.1719433184713151,
+     -0.053674728597723556, -0.25939551533421945},
+    {-0.98506445552453348, -1.0732356277448256,
+     -0.41767111025802078, -0.5886955100355491},
+    {-0.94368247510051162, -1.0318536473208038,
+     -0.47795208558093749, -0.63810186192235541},
+    {-0.97827311931875693, -1.0664442915390491,
+     -0.3188372414522192, -0.48795662376895038},
+    {-0.93962612796583167, -1.0277973001861238,
+     -0.38516837711342788, -0.54434046315212281},
+    {-1.0309744570480999, -1.1191456292683921,
+     -0.45650389764166077, -0.64186228575425031},
+    {-0.98737750745133324, -1.0755486796716254,
+     -0.51920492526086548, -0.69088980711453107},
+    {-1.0257882944948009, -1.1139594667150932,
+     -0.34710284501842703, -0.53070295420903668},
+    {-0.96171185477915533, -1.0498830269994475,
+     0.028435435547325034, -0.13624279123990662},
+    {-0.93481952721563977, -1.0229906994359319,
+     -0.053605811818666929, -0.21163806153354281},
+    {-0.93809853150586919, -1.026269703726161,
+     0.10258622375378063, -0.056221431930398885},
+    {-0.91411878710208527, -1.0022899593223773,
+     0.025838024851575582, -0.12750580493909108},
+    {-1.0105898416418808, -1.0987610138621731,
+     0.03671751057295225, -0.14194384044588135},
+    {-0.98299200836393685, -1.071163180584229,
+     -0.05382787914377251, -0.22426557384583956},
+    {-0.98567842107303127, -1.0738495932933234,
+     0.11743243834897918, -0.053766691488302064},
+    {-0.92033910797715945, -1.0085102801974515,
+     -0.84613496038349567, -1.0008511632150559},
+    {-0.87476411771683804, -0.96293528993713007,
+     -0.86842252453295876, -1.0137432690706722},
+    {-0.93178929091821594, -1.0199604631385077,
+     -0.75764890874904334, -0.91497277907262686},
+    {-0.88645844700299081, -0.97462961922328284,
+     -0.78746217525480844, -0.93505423916905117},
+    {-0.95278683614558835, -1.0409580083658805,
+     -0.9120373878725464, -1.0744357464268668},
+    {-0.90575245132168136, -0.99392362354197339,
+     -0.93017939448171316, -1.0817244711580214},
+    {-0.96742505350977204, -1.0555962257300642,
+     -0.81954528117423986, -0.98572385888440373},
+    {-0.81687331230899696, -0.90504448452928898,
+     -0.95826604690536843, -1.093557983584535},
+    {-0.77519043183538472, -0.86336160405567675,
+     -0.96931520297214102, -1.0984563601975208},
+    {-0.8308495515574349, -0.91902072377772692,
+     -0.88733657675394784, -1.0248790994277779},
+    {-0.78869488033299473, -0.87686605255328676,
+     -0.9035617814443766, -1.0346087091836373},
+    {-0.84383190085759863, -0.93200307307789065,
+     -1.0177890602461621, -1.1575150998318897},
+    {-0.80101139705267077, -0.8891825692729628,
+     -1.0251918685616164, -1.158048059658936},
+    {-0.86041428785321195, -0.94858546007350397,
+     -0.94537685880634192, -1.0880304657110342},
+    {-0.90043728225674513, -0.98860845447703716,
+     -0.61696616507807134, -0.76739566623907818},
+    {-0.85796506048648291, -0.94613623270677494,
+     -0.65545900028278836, -0.79767003262207592},
+    {-0.90222186476329769, -0.99039303698358971,
+     -0.52970191963427948, -0.68050366759476522},
+    {-0.86114039628023775, -0.94931156850052978,
+     -0.57438891732029651, -0.71717442652786767},
+    {-0.93968086750593405, -1.0278520397262261,
+     -0.66581913541574778, -0.82500431831147225},
+    {-0.89511732662663812, -0.98328849884693015,
+     -0.70329545041374686, -0.85262889122733976},
+    {-0.94370088236250715, -1.0318720545827993,
+     -0.57205174195942088, -0.73220598834756268},
+    {-0.8096652597494739, -0.89783643196976592,
+     -0.76273800760645072, -0.896907913495816},
+    {-0.76914152581362938, -0.85731269803392141,
+     -0.78660441972946016, -0.91491732235231837},
+    {-0.81656933395935871, -0.90474050617965074,
+     -0.68871498022233912, -0.82395907739272078},
+    {-0.77645868055564138, -0.86462985277593341,
+     -0.71766574735596456, -0.84698252091809401},
+    {-0.84257371114138857, -0.9307448833616806,
+     -0.81279794393625338, -0.95230830449839421},
+    {-0.8002863396111074, -0.88845751183139943,
+     -0.83455341370927516, -0.96730115290236096},
+    {-0.85170723347579058, -0.93987840569608261,
+     -0.73524354148858961, -0.87633998009396707},
+    {-1.0328796945597873, -1.1210508667800796,
+     -0.97023762954217418, -1.1562517074675072},
+    {-0.98316786811571111, -1.0713390403360032,
+     -0.98587974748609741, -1.1563670429354029},
+    {-1.0513054315861656, -1.1394766038064579,
+     -0.86299258615625818, -1.0556327306501549},
+    {-1.0013706585915474, -1.0895418308118396,
+     -0.89006490249951808, -1.0658772581812659},
+    {-1.0611340083918952, -1.1493051806121874,
+     -1.0608579193844121, -1.2572572629499987},
+    {-1.0107952253633599, -1.0989663975836521,
+     -1.0681851721499562, -1.2469112184581199},
+    {-1.0839418358946891, -1.1721130081149813,
+     -0.95057270121978754, -1.1563671059909948},
+    {-0.91465905150648175, -1.0028302237267739,
+     -1.0785674379164656, -1.2320292637090142},
+    {-0.86914289250008403, -0.95731406472037606,
+     -1.0823072412428814, -1.2265678546519254},
+    {-0.9349976400655482, -1.02316881228584,
+     -0.99857116432165993, -1.1566452953335138},
+    {-0.88851681960984064, -0.97668799183013266,
+     -1.0090379270216212, -1.1570392545584716},
+    {-0.93832856990666091, -1.0264997421269531,
+     -1.1540253872381183, -1.3128877914688477},
+    {-0.89236492733316897, -0.98053609955346099,
+     -1.1518563518978382, -1.3006306116745228},
+    {-0.96191681860864853, -1.0500879908289407,
+     -1.073953150641539, -1.2386846418431794},
+    {-1.0258530088832294, -1.1140241811035216,
+     -0.67932977529108918, -0.86295158889379242},
+    {-0.97835150934989124, -1.0665226815701834,
+     -0.7221534910521743, -0.89129457584466087},
+    {-1.0309962955302143, -1.1191674677505066,
+     -0.56815999074341683, -0.7535258645985482},
+    {-0.98510425387761902, -1.0732754260979112,
+     -0.62140032744897855, -0.79243604077892371},
+    {-1.0652250166131418, -1.1533961888334341,
+     -0.74776377330413279, -0.94577713431145505},
+    {-1.0158133975905876, -1.1039845698108799,
+     -0.78736555079853898, -0.96768937255718235},
+    {-1.0739051819608114, -1.1620763541811037,
+     -0.6268876682592015, -0.82842634769656898},
+    {-0.98574252344761371, -1.0739136956679058,
+     1.1451861578328419, 0.97396876062418358},
+    {-0.96668468600378399, -1.0548558582240761,
+     1.0609676534192729, 0.89498535090019748},
+    {-0.95231077062643488, -1.0404819428467267,
+     1.2124619874365592, 1.0501831049426131},
+    {-0.93635473188570661, -1.0245259041059986,
+     1.1290099141404906, 0.9706157821343967},
+    {-1.0359842344695231, -1.1241554066898154,
+     1.1648695893875671, 0.97777562229142445},
+    {-1.0161101312178997, -1.104281303438192,
+     1.0714432177346001, 0.89102387882548395},
+    {-1.0022043018038178, -1.0903754740241101,
+     1.2373891412973896, 1.061323520386833},
+    {-0.97020717714041449, -1.0583783493607066,
+     0.9128731716546401, 0.74595205008217436},
+    {-0.9455250630750055, -1.0336962352952976,
+     0.84655630942791749, 0.68595756475969438},
+    {-0.9457203638436269, -1.0338915360639187,
+     0.98474951713103942, 0.82410300552668292},
+    {-0.92345926618960705, -1.0116304384098991,
+     0.91618327863841498, 0.76076711227859617},
+    {-1.0177940572602011, -1.1059652294804934,
+     0.90914286890047091, 0.72817925744537393},
+    {-0.99145448271661729, -1.0796256549369094,
+     0.83716789063340147, 0.66430407553968052},
+    {-0.99394056388799201, -1.0821117361082842,
+     0.98758910090819352, 0.81399698557722389},
+    {-0.86804349257669, -0.95621466479698203,
+     1.2491751442494918, 1.1051195352004626},
+    {-0.85551195871919639, -0.94368313093948841,
+     1.1741640052698707, 1.032392653657112},
+    {-0.83091604779937112, -0.91908722001966314,
+     1.3017366930445542, 1.1641832189473496},
+    {-0.82100666253395038, -0.90917783475424241,
+     1.2283937362719111, 1.0924466751714279},
+    {-0.91628202345443877, -1.0044531956747309,
+     1.2735299129858939, 1.1197122581886241},
+    {-0.90333473547119159, -0.99150590769148361,
+     1.191692778050079, 1.0406577178856089},
+    {-0.87813970772787042, -0.96631087994816245,
+     1.328802779093933, 1.182835668102264},
+    {-0.87094699248558138, -0.95911816470587341,
+     1.0452257072704658, 0.90062703775921027},
+    {-0.85252196181716067, -0.94069313403745269,
+     0.98075295799488449, 0.83951270938512523},
+    {-0.84101109440416966, -0.92918226662446168,
+     1.104137123715504, 0.96489339554875575},
+    {-0.82498952041027751, -0.91316069263056954,
+     1.0392225756949272, 0.90263599422377871},
+    {-0.91823281262790679, -1.0064039848481989,
+     1.0523709901982898, 0.89812290508403658},
+    {-0.89852352381727985, -0.98669469603757187,
+     0.98251590764046404, 0.83248303185857109},
+    {-0.88804697937025734, -0.97621815159054937,
+     1.1155220712382765, 0.96761441645258905},
+    {-1.1035810843397489, -1.1917522565600411,
+     1.3054362043267178, 1.0907072374787361},
+    {-1.0868215328341095, -1.1749927050544018,
+     1.1892407151210935, 0.98218798854388401},
+    {-1.065494948287212, -1.1536661205075043,
+     1.3792132656113898, 1.1810923585816857},
+    {-1.0527360394487735, -1.1409072116690657,
+     1.2677612201289956, 1.0745840308032975},
+    {-1.1543630425429137, -1.2425342147632059,
+     1.353186911089771, 1.1108274197259578},
+    {-1.1379661640882972, -1.2261373363085895,
+     1.2200647579380997, 0.98743969231586604},
+    {-1.1155323401948045, -1.2037035124150968,
+     1.4314586057591394, 1.2108595932848845},
+    {-1.0926316323425378, -1.18080280456283,
+     0.99592072263601827, 0.78627642003134235},
+    {-1.0660051022897541, -1.1541762745100463,
+     0.90486550283358091, 0.70654098168555135},
+    {-1.0662894566916776, -1.1544606289119699,
+     1.0844063637409815, 0.88596814606564422},
+    {-1.042985157841718, -1.1311563300620102,
+     0.99122282412112372, 0.80164023497296977},
+    {-1.1426386905091765, -1.2308098627294688,
+     1.0020853912350025, 0.76677335852918893},
+    {-1.114599973519167, -1.2027711457394592,
+     0.89985267086387322, 0.67972426193855018},
+    {-1.1169803354435481, -1.2051515076638404,
+     1.1007548602950399, 0.87942060055333193},
+    {-0.97523111245349192, -1.0634022846737841,
+     1.3979970972755329, 1.2297148259665984},
+    {-0.96547838303298283, -1.053649555253275,
+     1.3023911001216106, 1.1367274092373698},
+    {-0.93301778550286263, -1.0211889577231548,
+     1.4516771681476293, 1.2940670534106271},
+    {-0.92634769223679503, -1.0145188644570871,
+     1.3604955662862199, 1.2044243929118856},
+    {-1.0244122331580254, -1.1125834053783177,
+     1.4428928080800951, 1.2597528202734976},
+    {-1.0153349677697527, -1.103506139990045,
+     1.3370295406742521, 1.1568594770192442},
+    {-0.98099462866381726, -1.0691658008841094,
+     1.4979679711389118, 1.3280912451260629},
+    {-1.0063446661939277, -1.09451583841422,
+     -2.2621764702169291, -2.4395126809061334},
+    {-0.9558114499331285, -1.0439826221534205,
+     -2.2731763335920387, -2.4363387616337562},
+    {-1.0306074240073189, -1.1187785962276111,
+     -2.166995251472704, -2.3522279325014006},
+    {-0.98013227732592767, -1.0683034495462198,
+     -2.1858301523030272, -2.3554660333786979},
+    {-1.0287567693417023, -1.1169279415619946,
+     -2.3427134587322955, -2.5273152655991149},
+    {-0.97931622452458555, -1.0674873967448777,
+     -2.3480571133625179, -2.5174658240807752},
+    {-1.0559608780483623, -1.1441320502686545,
+     -2.2490661256925248, -2.4434664261167676},
+    {-0.87839084827303082, -0.96656202049332285,
+     -2.3561209578462767, -2.5021364543533426},
+    {-0.82740257982235388, -0.91557375204264591,
+     -2.3591539086575928, -2.4961319468319081},
+    {-0.90460198551894866, -0.99277315773924069,
+     -2.282489376744135, -2.4337912238041581},
+    {-0.8529770148230198, -0.94114818704331182,
+     -2.2904333309227112, -2.4317540707499199},
+    {-0.90070383516255792, -0.98887500738284995,
+     -2.4239352468225137, -2.5744202011455277},
+    {-0.85074989525604094, -0.93892106747633297,
+     -2.4229172217549881, -2.5638451710705357},
+    {-0.9291140751394521, -1.0172852473597442,
+     -2.3524672050651838, -2.5091721376108924},
+    {-1.0188314354647297, -1.1070026076850219,
+     -1.9883174614710928, -2.1696182647464077},
+    {-0.96856156139062122, -1.0567327336109134,
+     -2.0202063191930364, -2.1866872736054868},
+    {-1.0318873036609708, -1.1200584758812631,
+     -1.8803910232538086, -2.0660629067585998},
+    {-0.98291738905294246, -1.0710885612732346,
+     -1.9208625076523154, -2.091279166500458},
+    {-1.0513191014759971, -1.1394902736962893,
+     -2.0628371579496014, -2.2554824180746107},
+    {-1.0013716335912461, -1.0895428058115384,
+     -2.0906191182131897, -2.2664317696080918},
+    {-1.0677153696022912, -1.1558865418225834,
+     -1.9508342598548118, -2.1498448305829858},
+    {-0.89845408649871084, -0.98662525871900286,
+     -2.1344317077822899, -2.2844502423540325},
+    {-0.84606231346498562, -0.93423348568527764,
+     -2.1519093579815949, -2.292019924939614},
+    {-0.91720634845763249, -1.0053775206779245,
+     -2.0475829855646333, -2.2016042143969146},
+    {-0.86508104088244608, -0.95325221310273811,
+     -2.0712762137786425, -2.2147831665053297},
+    {-0.92879066259584819, -1.01696183481614,
+     -2.2018165232628357, -2.3584470367291237},
+    {-0.87685065130245465, -0.96502182352274668,
+     -2.215507729030286, -2.3612271347519997},
+    {-0.95032302592598306, -1.0384941981462752,
+     -2.1142096491399416, -2.2759919649547884},
+    {-1.0942743364407321, -1.1824455086610244,
+     -2.4273644746799907, -2.6377546023188736},
+    {-1.0472657759750785, -1.1354369481953708,
+     -2.4266216216584766, -2.6177633884496831},
+    {-1.1245048304486238, -1.2126760026689161,
+     -2.3281878940519731, -2.553430859769628},
+    {-1.0772170056853594, -1.1653881779056516,
+     -2.336199039608823, -2.5391201476200753},
+    {-1.1071592048476135, -1.1953303770679058,
+     -2.5211677421352992, -2.7376179008032961},
+    {-1.0618787581725533, -1.1500499303928455,
+     -2.5128201888364026, -2.7095111505090563},
+    {-1.1400404738187011, -1.2282116460389934,
+     -2.4280140795944578, -2.6618237482924996},
+    {-0.96802279243164702, -1.0561939646519392,
+     -2.4990934004531016, -2.6654308473749802},
+    {-0.91985954138914205, -1.0080307136094342,
+     -2.4933150111075171, -2.64792432174603},
+    {-0.99919495897106836, -1.0873661311913605,
+     -2.4257960963256684, -2.600951454103507},
+    {-0.95026596116175621, -1.0384371333820483,
+     -2.4248976495937549, -2.5866657641229076},
+    {-0.98243540929590856, -1.0706065815162007,
+     -2.5742553795101366, -2.7445363117542363},
+    {-0.93587861918585591, -1.0240497914061479,
+     -2.5636118501540444, -2.7218935345930011},
+    {-1.0154341857160825, -1.1036053579363747,
+     -2.5055388012198385, -2.6857407266625977},
+    {-1.1280006986652604, -1.2161718708855527,
+     -2.1175190790270175, -2.3446298059308779},
+    {-1.0799701733517115, -1.1681413455720038,
+     -2.1445671011820266, -2.3486536757758767},
+    {-1.1468903711702974, -1.2350615433905896,
+     -1.9898621424958447, -2.2276782043082632},
+    {-1.0999051797303074, -1.1880763519505997,
+     -2.0297576015137322, -2.242749431004456},
+    {-1.1516122205848638, -1.239783392805156,
+     -2.2139645521090978, -2.4546299118158901},
+    {-1.1044451361299796, -1.1926163083502719,
+     -2.2332665242820169, -2.4484083642942056},
+    {-1.174506313151723, -1.2626774853720153,
+     -2.0843964450020787, -2.3399889512209437},
+    {-1.0106656674138059, -1.0988368396340982,
+     1.8834179094841454, 1.7047326798946476},
+    {-1.0219894314047129, -1.1101606036250051,
+     1.7760411022542448, 1.5937048241009295},
+    {-0.9579191965340258, -1.0460903687543179,
+     1.9026165128299248, 1.7389164780915811},
+    {-0.97071675088353648, -1.0588879231038286,
+     1.8049224614211339, 1.6378644755138609},
+    {-1.0480113723774858, -1.136182544597778,
+     1.9730858639460933, 1.7816695338848654},
+    {-1.0630437866405287, -1.1512149588608209,
+     1.8605030746954536, 1.6633539676342204},
+    {-0.99444952971079281, -1.0826207019310849,
+     1.9849824598243151, 1.811240352255612},
+    {-1.0758795985179066, -1.1640507707381988,
+     1.6192826926228923, 1.4169223919146388},
+    {-1.0734331863199906, -1.1616043585402829,
+     1.4973381899867129, 1.2959948206715259},
+    {-1.0280648159446653, -1.1162359881649575,
+     1.665035126802642, 1.4806679373929479},
+    {-1.0288058718049435, -1.1169770440252358,
+     1.5530602430029314, 1.368441761136892},
+    {-1.1215183952783552, -1.2096895674986474,
+     1.699643997859116, 1.4759703037788447},
+    {-1.1217367812041343, -1.2099079534244266,
+     1.5642954004066956, 1.3405077607545925},
+    {-1.0724340601423357, -1.1606052323626279,
+     1.7415386331176546, 1.5406073050341038},
+    {-0.86754106739426817, -0.9557122396145602,
+     1.8505551198914982, 1.7065929459960991},
+    {-0.87866478057066544, -0.96683595279095746,
+     1.764662801493275, 1.6185944812426996},
+    {-0.81644775423461269, -0.90461892645490471,
+     1.8689169566746193, 1.7336919805117719},
+    {-0.82850129538344408, -0.91667246760373611,
+     1.7892564606426966, 1.6520991746996894},
+    {-0.90521273697601357, -0.99338390919630559,
+     1.9189676964811406, 1.7675368476030782},
+    {-0.91909143272371618, -1.0072626049440083,
+     1.829452121238172, 1.6750136355663849},
+    {-0.8529187578187466, -0.94108993003903862,
+     1.9330909288690932, 1.7917805004792204},
+    {-0.93454488869964669, -1.0227160609199388,
+     1.6412733079178223, 1.4833055831672617},
+    {-0.93585427380967234, -1.0240254460299645,
+     1.5457941455794442, 1.387518205739618},
+    {-0.88603782012374754, -0.97420899234403957,
+     1.6765494753165011, 1.5290406889374},
+    {-0.88955255550733647, -0.9777237277276285,
+     1.5875413072643054, 1.4393329481675674},
+    {-0.97890521649116613, -1.0670763887114583,
+     1.7035646324056302, 1.53427006399636},
+    {-0.98231200925677975, -1.0704831814770719,
+     1.6005227460928946, 1.4302765224712941},
+    {-0.92894356922097332, -1.0171147414412651,
+     1.7363906861560918, 1.5797249988526605},
+    {-1.0576016894190197, -1.1457728616393119,
+     2.1791474813754945, 1.9841181107427515},
+    {-1.0819026411300843, -1.1700738133503765,
+     2.0748336403583929, 1.8699200559002076},
+    {-1.003594005838182, -1.0917651780584743,
+     2.1715048184350816, 1.9950150988622239},
+    {-1.0279329834918947, -1.1161041557121869,
+     2.0771265409862627, 1.8928039737791895},
+    {-1.0827213665890991, -1.1708925388093914,
+     2.290397098424013, 2.0851308794672501},
+    {-1.1114510652201115, -1.1996222374404037,
+     2.188901237877876, 1.9703460791870837},
+    {-1.0293034899135103, -1.1174746621338025,
+     2.2713723197980018, 2.0865846535518573},
+    {-1.153616946658768, -1.2417881188790603,
+     1.9410724649824784, 1.6991750009191713},
+    {-1.1648622073183657, -1.2530333795386579,
+     1.7979210639282919, 1.5488525359470009},
+    {-1.1011995968235737, -1.189370769043866,
+     1.9587619248425614, 1.7451619315263451},
+    {-1.1146074640315404, -1.2027786362518327,
+     1.8326215913000987, 1.6124894103700167},
+    {-1.1883258175179343, -1.2764969897382266,
+     2.0693656206067952, 1.8037610294785291},
+    {-1.2048373466020321, -1.2930085188223244,
+     1.9185339667103938, 1.6398149496938312},
+    {-1.1354797003936938, -1.2236508726139861,
+     2.072288624686506, 1.8410665100004269},
+    {-0.92016138328569586, -1.0083325555059879,
+     2.081225262370844, 1.926548694569906},
+    {-0.94089020992916017, -1.0290613821494523,
+     1.995071499197848, 1.8355962989741765},
+    {-0.86700702428562459, -0.95517819650591662,
+     2.0831061360641563, 1.9392431046709335},
+    {-0.88768730614490343, -0.97585847836519546,
+     2.003777429929571, 1.8559413816000969},
+    {-0.94974236812924351, -1.0379135403495356,
+     2.1654235909232993, 2.0037856382683517},
+    {-0.97390877315470659, -1.0620799453749987,
+     2.0792417709156026, 1.9113203243186569},
+    {-0.89635559752989558, -0.9845267697501876,
+     2.1605278328980515, 2.010941079621293},
+    {-1.0802216673442888, -1.1683928395645811,
+     0.47005619144331451, 0.26586240982108295},
+    {-1.0700242970218099, -1.1581954692421021,
+     0.3543656805465949, 0.15442041981476159},
+    {-1.0421485303588793, -1.1303197025791716,
+     0.52303019934439055, 0.33374897390214409},
+    {-1.0346714318655579, -1.1228426040858501,
+     0.41746374664184338, 0.23082817316632653},
+    {-1.1256758172480381, -1.2138469894683304,
+     0.53489405663876588, 0.30902919824099517},
+    {-1.1179394540815086, -1.2061106263018009,
+     0.40541207697600024, 0.18358784536654038},
+    {-1.0851694537062242, -1.1733406259265164,
+     0.58621522901322753, 0.37988648463208097},
+    {-1.0850477318943963, -1.1732189041146885,
+     0.15844176033232094, -0.047833864964655831},
+    {-1.0609281095741609, -1.1490992817944532,
+     0.047130701879971461, -0.14918819058727567},
+    {-1.0547281391457988, -1.142899311366091,
+     0.24208839692865863, 0.048157710065307571},
+    {-1.0347262606549654, -1.1228974328752577,
+     0.1356497392656022, -0.051004927492187269},
+    {-1.1364023616861765, -1.2245735339064687,
+     0.18764906830719666, -0.044091498410038371},
+    {-1.1125271267617378, -1.2006982989820301,
+     0.060507877956924902, -0.15858212042709996},
+    {-1.1042676226350094, -1.1924387948553017,
+     0.27871843105482719, 0.063661555637946385},
+    {-0.96345656861453277, -1.0516277408348249,
+     0.51538350477696593, 0.35025054869260525},
+    {-0.95607213245486233, -1.0442433046751545,
+     0.42628881026698373, 0.26306012263811906},
+    {-0.92855296407516752, -1.0167241362954593,
+     0.55377505573089181, 0.39719918256850106},
+    {-0.92281163147590006, -1.0109828036961921,
+     0.47122356880295546, 0.31595333497630085},
+    {-1.0043385010902, -1.0925096733104922,
+     0.56699053880328498, 0.39027263801482104},
+    {-0.998963385414121, -1.0871345576344131,
+     0.47047183095597195, 0.29538606390189132},
+    {-0.96722571752289033, -1.0553968897431825,
+     0.6039245749501273, 0.43779889683392736},
+    {-0.97602436925411828, -1.0641955414744104,
+     0.27979203271875652, 0.11129241993432705},
+    {-0.95877121942527455, -1.0469423916455667,
+     0.18887185840951351, 0.024953290817454225},
+    {-0.94506786769759887, -1.033239039917891,
+     0.33802833073850841, 0.17754127262510883},
+    {-0.93056798285892228, -1.0187391550792144,
+     0.25190748297946691, 0.094866919307634801},
+    {-1.0226008308366701, -1.1107720030569623,
+     0.31334935020525329, 0.13081102132674},
+    {-1.0061431208399383, -1.0943142930602305,
+     0.21278205560800939, 0.035508189887370034},
+    {-0.98949916178567621, -1.0776703340059683,
+     0.37416390825985069, 0.20186788189385113},
+    {-1.1681712841808705, -1.2563424564011627,
+     0.75707884027861383, 0.50581230158297863},
+    {-1.1704072762813265, -1.2585784485016187,
+     0.61610461217887169, 0.3633291718394982},
+    {-1.1235342026335198, -1.211705374853812,
+     0.7856581240403574, 0.56092782059448021},
+    {-1.1274339804347104, -1.2156051526550027,
+     0.66297283869206747, 0.43616718568198326},
+    {-1.2063698405418353, -1.2945410127621275,
+     0.87311614764020784, 0.59311000610024411},
+    {-1.2135677076986022, -1.3017388799188945,
+     0.71942024594267773, 0.43319698755829883},
+    {-1.1598087238200268, -1.247979896040319,
+     0.88823012263116097, 0.64243994340746291},
+    {-1.2048018840816586, -1.2929730563019508,
+     0.38738722264515629, 0.10869784240101499},
+    {-1.1884999752382803, -1.2766711474585726,
+     0.22623025517946968, -0.03950584684342949},
+    {-1.1658811824483277, -1.25405235466862,
+     0.4702869391081278, 0.22054597005344745},
+    {-1.1544328199365177, -1.2426039921568099,
+     0.32560202763284696, 0.08319922875140591},
+    {-1.2548103614622379, -1.3429815336825301,
+     0.4718186228738025, 0.14351077114370611},
+    {-1.2409918356942893, -1.3291630079145815,
+     0.27924900893916643, -0.033584135760600195},
+    {-1.2132238363422829, -1.3013950085625752,
+     0.5547425300343185, 0.26882290087556127},
+    {-1.0435184670680651, -1.1316896392883573,
+     0.72942784640287128, 0.53965258183993481},
+    {-1.0450297705682485, -1.1332009427885408,
+     0.62775408154782297, 0.43743038081535568},
+    {-1.0033125556003826, -1.0914837278206748,
+     0.75377413535883153, 0.57737049893187253},
+    {-1.0057092618640147, -1.0938804340843069,
+     0.66196054781645797, 0.48482071668593962},
+    {-1.0800568602482123, -1.1682280324685046,
+     0.80809467336181129, 0.60397115999361084},
+    {-1.08498912716542, -1.1731602993857122,
+     0.69979324820560995, 0.49354318701818234},
+    {-1.0379946915531875, -1.1261658637734797,
+     0.82619508850796497, 0.63839411600311147},
+    {-1.080545183122164, -1.1687163553424562,
+     -1.4760817489768194, -1.6804136238850766},
+    {-1.034143261770812, -1.1223144339911042,
+     -1.4404992648923129, -1.626951139802471},
+    {-1.1182459211912084, -1.2064170934115006,
+     -1.3936957895529127, -1.6156770825873503},
+    {-1.0703207636082088, -1.1584919358285011,
+     -1.3645884842199743, -1.5646544731194263},
+    {-1.0855589958561525, -1.1737301680764447,
+     -1.5922945602265988, -1.7987935043954275},
+    {-1.0410498079250989, -1.1292209801453912,
+     -1.546382868909068, -1.7352699735152586},
+    {-1.1260107470702543, -1.2141819192905465,
+     -1.5192108357750798, -1.7452542593061475},
+    {-0.94711648185086572, -1.0352876540711575,
+     -1.4732073447616885, -1.6341963293290114},
+    {-0.89857092707849584, -0.98674209929878787,
+     -1.4436873905436638, -1.5937300587305736},
+    {-0.98641900534061755, -1.0745901775609097,
+     -1.4101794004881885, -1.5815898568705993},
+    {-0.93776762689652726, -1.0259387991168194,
+     -1.3840498288873038, -1.5427788110021896},
+    {-0.952713674896424, -1.040884847116716,
+     -1.5669360874942986, -1.7293160712601368},
+    {-0.90530953436185835, -0.99348070658215037,
+     -1.5304758649631842, -1.6819271845957844},
+    {-0.99475139561915216, -1.0829225678394443,
+     -1.5071084029009962, -1.6809396141631527},
+    {-1.1366474682603656, -1.2248186404806578,
+     -1.1658461853119531, -1.3977249040214508},
+    {-1.0852877924729094, -1.1734589646932017,
+     -1.1622084259496739, -1.3685888422295647},
+    {-1.1653577479103199, -1.2535289201306121,
+     -1.0387149999684373, -1.2881100593701234},
+    {-1.1127336723929497, -1.200904844613242,
+     -1.0513586189643425, -1.2705516063052729},
+    {-1.1547161258929242, -1.2428872981132164,
+     -1.2931680883529688, -1.5357468930448805},
+    {-1.1045418167308683, -1.1927129889511605,
+     -1.2737230582372154, -1.4889112042981654},
+    {-1.1887515928180037, -1.2769227650382959,
+     -1.1702950524225399, -1.4362214016532513},
+    {-1.0064038952650483, -1.0945750674853405,
+     -1.2457072978080379, -1.4230618398111183},
+    {-0.95902693309055531, -1.0471981053108474,
+     -1.235204585775008, -1.399188877737167},
+    {-1.0349622997740089, -1.1231334719943011,
+     -1.1591199222639152, -1.3458568370548043},
+    {-0.98591118198361161, -1.0740823542039037,
+     -1.1564249635046768, -1.327690445635429},
+    {-1.0228888938585268, -1.111060066078819,
+     -1.3410315433202658, -1.5236652480682435},
+    {-0.97431209298293708, -1.0624832652032292,
+     -1.3192653870678936, -1.4872966916932235},
+    {-1.0549949702328498, -1.1431661424531421,
+     -1.2582945623110204, -1.4523266813420952},
+    {-1.1243565168771525, -1.2125276890974448,
+     -1.7772238834635308, -2.0023883484381151},
+    {-1.085142629033899, -1.1733138012541913,
+     -1.7124037461823656, -1.9187207817331473},
+    {-1.1685410020611169, -1.2567121742814091,
+     -1.7160941252056712, -1.9676088275393058},
+    {-1.1277919599568114, -1.2159631321771036,
+     -1.6464444578795177, -1.8734427133400517},
+    {-1.1149276221450424, -1.2030987943653346,
+     -1.9063238054915028, -2.1266173412516163},
+    {-1.0791400480051132, -1.1673112202254055,
+     -1.8330522560694387, -2.0367858532692851},
+    {-1.1601922721183375, -1.2483634443386298,
+     -1.852863149714377, -2.0988988993593769},
+    {-0.99823922799993203, -1.0864104002202242,
+     -1.7129485154822954, -1.8878170811083832},
+    {-0.95418003841425747, -1.0423512106345496,
+     -1.6638305112195231, -1.8265797408230973},
+    {-1.0431158753439909, -1.1312870475642831,
+     -1.6567199064269873, -1.8463496803583446},
+    {-0.99880649449347902, -1.0869776667137712,
+     -1.6086606192795785, -1.7836992754147405},
+    {-0.99291227402100268, -1.0810834462412948,
+     -1.8177675262756814, -1.9910575301160185},
+    {-0.95129612188652246, -1.0394672941068146,
+     -1.762166692088496, -1.9241916407494668},
+    {-1.0400659504667629, -1.1282371226870551,
+     -1.7689817365662928, -1.9575175064053172},
+    {-1.2135566718492976, -1.3017278440695899,
+     -1.478789132997901, -1.7650026364807188},
+    {-1.1661996354724491, -1.2543708076927413,
+     -1.430585945615475, -1.6805378665088502},
+    {-1.2551199706964657, -1.343291142916758,
+     -1.3532177388544087, -1.6818905929513459},
+    {-1.2050966898107143, -1.2932678620310065,
+     -1.3185509921329577, -1.5974869501369744},
+    {-1.213929781663416, -1.3021009538837083,
+     -1.6433263120442807, -1.929870006491702},
+    {-1.1707551440979389, -1.2589263163182312,
+     -1.573477497450104, -1.8264894319843898},
+    {-1.2594326249272423, -1.3476037971475345,
+     -1.5441109011890226, -1.8779570788536761},
+    {-1.0851424421630702, -1.1733136143833625,
+     -2.8545428120833933, -3.0608597660712085},
+    {-1.118712153839899, -1.2068833260601912,
+     -2.8195055473451474, -3.0417262471779658},
+    {-1.0633746332579079, -1.1515458054782002,
+     -2.9228694094231487, -3.1201490595759833},
+    {-1.1048634537391111, -1.1930346259594033,
+     -2.9202442254736778, -3.1355865805524616},
+    {-1.0840131183555528, -1.1721842905758451,
+     -2.7721359043735765, -2.9779612517630918},
+    {-1.118712153839899, -1.2068833260601912,
+     -2.8195055473451474, -3.0417262471779658},
+    {-1.0514382372056268, -1.139609409425919,
+     -2.8370693644700102, -3.0297592213374758},
+    {-1.1549954964242057, -1.243166668644498,
+     -2.6536524591781587, -2.8964050943334376},
+    {-1.1895817765327901, -1.2777529487530823,
+     -2.5832402380119475, -2.8497963429353246},
+    {-1.1537160029373459, -1.2418871751576381,
+     -2.7761930979100615, -3.0181517943693281},
+    {-1.1900218131355254, -1.2781929853558176,
+     -2.7214985837472896, -2.9883897746696539},
+    {-1.1160288242268159, -1.2041999964471082,
+     -2.615956149415573, -2.8368066580679514},
+    {-1.1510963078237655, -1.2392674800440577,
+     -2.530902109709356, -2.7712525734024971},
+    {-1.1211599479193883, -1.2093311201396806,
+     -2.7099868045934921, -2.9334737487129745},
+    {-1.0534713258676844, -1.1416424980879767,
+     -3.0768240394287782, 3.0129067336500417},
+    {-1.0956755469196096, -1.1838467191399018,
+     -3.0885813790520964, 2.9835729609944903},
+    {-1.0239747458457233, -1.1121459180660156,
+     -3.1400055660350197, 2.9601854831655774},
+    {-1.0647625859648986, -1.1529337581851908,
+     3.1109800786013024, 2.9131506543808263},
+    {-1.0388518667565536, -1.1270230389768459,
+     -2.988700185278411, 3.1063808526151258},
+    {-1.0801428971309128, -1.1683140693512051,
+     -3.0099036033301489, 3.0691215139478105},
+    {-1.0115522127823309, -1.0997233850026231,
+     -3.0516697887770108, 3.0525505528222143},
+    {-1.1678542807313848, -1.256025452951677,
+     -2.9784430244510989, 3.0536881075329609},
+    {-1.2132020611164296, -1.3013732333367218,
+     -2.9552110823702602, 3.0420737997695486},
+    {-1.1402475703501658, -1.228418742570458,
+     -3.0834593350511796, 2.9657973160092346},
+    {-1.1858862620510651, -1.2740574342713573,
+     -3.0766357531759225, 2.9427727078728823},
+    {-1.1476578621263773, -1.2358290343466696,
+     -2.8949457043873355, -3.1332199307091924},
+    {-1.1847293587639922, -1.2729005309842845,
+     -2.8567487204012738, -3.1196681094640097},
+    {-1.1234537854357436, -1.2116249576560358,
+     -2.9960951063875338, 3.0624022576258509},
+    {-1.0374155755089756, -1.1255867477292678,
+     -2.6669624920970882, -2.8545591852282763},
+    {-1.0799907010018288, -1.1681618732221211,
+     -2.6869136370761484, -2.8910089575073008},
+    {-1.0064493496240781, -1.0946205218443703,
+     -2.7342368799077206, -2.9116054929632038},
+    {-1.0435770805773796, -1.1317482527976719,
+     -2.7465075381882209, -2.9363040059833208},
+    {-1.0281169735698623, -1.1162881457901546,
+     -2.586285439984275, -2.770670290380651},
+    {-1.0727137290732423, -1.1608849012935345,
+     -2.6000364537373155, -2.8010829274548161},
+    {-0.99363424525162103, -1.0818054174719132,
+     -2.649521576365089, -2.8230235660098275},
+    {-1.1549954964242057, -1.243166668644498,
+     -2.6536524591781587, -2.8964050943334376},
+    {-1.1900218131355254, -1.2781929853558176,
+     -2.7214985837472896, -2.9883897746696539},
+    {-1.1211599479193883, -1.2093311201396806,
+     -2.7099868045934921, -2.9334737487129745},
+    {-1.1537160029373459, -1.2418871751576381,
+     -2.7761930979100615, -3.0181517943693281},
+    {-1.1510963078237655, -1.2392674800440577,
+     -2.530902109709356, -2.7712525734024971},
+    {-1.1895817765327901, -1.2777529487530823,
+     -2.5832402380119475, -2.8497963429353246},
+    {-1.1160288242268159, -1.2041999964471082,
+     -2.615956149415573, -2.8368066580679514},
+    {-0.98523392000764132, -1.0734050922279335,
+     -2.8899054364603636, -3.0609780224890129},
+    {-1.0214896404408638, -1.109660812661156,
+     -2.9082891448274251, -3.0904606382978419},
+    {-0.95238151186334519, -1.0405526840836372,
+     -2.953478784187372, -3.1157754068490218},
+    {-0.99620298861885848, -1.0843741608391506,
+     -2.9700414734416452, 3.1388826447051628},
+    {-0.97798507310709526, -1.0661562453273874,
+     -2.8059451446187906, -2.9749848373492269},
+    {-1.0157273890194163, -1.1038985612397085,
+     -2.820922231148038, -3.0012183890242472},
+    {-0.94691625390166467, -1.0350874261219567,
+     -2.8727667009320657, -3.0337064598926498},
+    {-1.1717710361723888, -1.259942208392681,
+     2.7279509593325417, 2.4742456652695393},
+    {-1.2139825683779035, -1.3021537405981958,
+     2.6591960214492327, 2.3726055475967773},
+    {-1.1255543021924141, -1.2137254744127064,
+     2.6582552509640873, 2.4324551013540976},
+    {-1.1662359245675875, -1.2544070967878798,
+     2.5884768426842757, 2.3385008586885232},
+    {-1.171148402949296, -1.2593195751695883,
+     2.8621767006615118, 2.6088968429103208},
+    {-1.2158959110961818, -1.304067083316474,
+     2.8151595708929511, 2.5268625831046929},
+    {-1.1284897452303841, -1.2166609174506764,
+     2.7811325958140185, 2.5537578877455549},
+    {-1.3012781871979133, -1.3894493594182056,
+     2.6620607252885096, 2.2676082386186733},
+    {-1.338596752197897, -1.4267679244181892,
+     2.5304058834492604, 2.0589186492750047},
+    {-1.2539454497436255, -1.3421166219639178,
+     2.5680856320147716, 2.2407929877623718},
+    {-1.2899165947638758, -1.378087766984168,
+     2.4447868036390266, 2.0689304862840943},
+    {-1.3026340962711729, -1.3908052684914651,
+     2.8755864285689303, 2.4787875186040869},
+    {-1.3461338185893876, -1.4343049908096799,
+     2.7984100402749772, 2.3074714324500687},
+    {-1.259689958719562, -1.3478611309398543,
+     2.751605637648622, 2.4174454193191637},
+    {-1.0667183980224493, -1.1548895702427415,
+     2.4886335853109505, 2.2900235820752628},
+    {-1.1026643926581037, -1.1908355648783959,
+     2.409248523660942, 2.1949556796395511},
+    {-1.0158073624047561, -1.1039785346250484,
+     2.4524333379127796, 2.2721114576377737},
+    {-1.0504810722822728, -1.1386522445025651,
+     2.3776995150083469, 2.1853672996041533},
+    {-1.077811681662586, -1.1659828538828783,
+     2.6017173912826896, 2.3985458046933363},
+    {-1.1169962367617032, -1.2051674089819955,
+     2.5330312422185082, 2.3116888784919341},
+    {-1.0290239318656269, -1.1171951040859192,
+     2.5551950216732369, 2.3705024456957764},
+    {-1.1882207071306892, -1.2763918793509814,
+     2.3454566199601827, 2.0799313334764897},
+    {-1.2174539485118687, -1.305625120732161,
+     2.2186077938242215, 1.9289053163933771},
+    {-1.1357972751525165, -1.2239684473728087,
+     2.3144031327631893, 2.0830028540867476},
+    {-1.1648330237217626, -1.2530041959420548,
+     2.2016048440861762, 1.9525555177735776},
+    {-1.2047709458726412, -1.2929421180929335,
+     2.5000829681873955, 2.2214194382201833},
+    {-1.2396911509862947, -1.3278623232065869,
+     2.3869397099709802, 2.0754853486682241},
+    {-1.1542142754984015, -1.2423854477186937,
+     2.4489293442561841, 2.206662129955113},
+    {-1.1195063839277417, -1.207677556148034,
+     3.0069849275913518, 2.7843550939269002},
+    {-1.1650609229481503, -1.2532320951684426,
+     2.9869754843088283, 2.7377761247839953},
+    {-1.08174619922681, -1.1699173714471023,
+     2.9267135688894985, 2.7218672123200101},
+    {-1.126250335804212, -1.2144215080245042,
+     2.8982289117379478, 2.6720575645080045},
+    {-1.1090462614710732, -1.1972174336913655,
+     3.1059316672845547, 2.8885614856343667},
+    {-1.1544297751386468, -1.242600947358939,
+     3.0997959102546759, 2.8573950014823875},
+    {-1.0747947924273709, -1.1629659646476631,
+     3.0229131538670506, 2.8210052022931196},
+    {-1.2476247426915719, -1.3357959149118641,
+     3.0819376067218767, 2.7618704806725467},
+    {-1.2948141135759843, -1.3829852857962766,
+     3.067751803681575, 2.6841049649181805},
+    {-1.2111243390734527, -1.299295511293745,
+     2.9610011588002174, 2.6769207211689818},
+    {-1.2572226993171567, -1.3453938715374489,
+     2.9258424977429542, 2.5946682280079307},
+    {-1.2324244868865573, -1.3205956591068495,
+     -3.0672747311218864, 2.9119316543307092},
+    {-1.279665053843821, -1.3678362260641133,
+     -3.0539012482049972, 2.8687253638862535},
+    {-1.200710537521861, -1.2888817097421532,
+     3.0920816198565575, 2.8167673617830253},
+    {-1.0417422240828416, -1.1299133963031338,
+     2.759691196107068, 2.5705559341995587},
+    {-1.083797007695624, -1.1719681799159163,
+     2.714167130259292, 2.5084355613149096},
+    {-0.99713955939517895, -1.0853107316154711,
+     2.7054836229209953, 2.5309436850190399},
+    {-1.0376179998122848, -1.125789172032577,
+     2.6583242738303725, 2.4706562345523211},
+    {-1.0417233987377206, -1.1298945709580128,
+     2.857358928701657, 2.6682304234937066},
+    {-1.084949924677425, -1.1731210968977173,
+     2.8232611449736447, 2.6170281804656121},
+    {-0.99995755964024713, -1.0881287318605393,
+     2.7973354525140408, 2.6219504656688137},
+    {-1.2636622973454918, -1.3518334695657841,
+     -0.4351042197256878, -0.77419106769805679},
+    {-1.2153032862218058, -1.3034744584420981,
+     -0.54991124604938668, -0.83767738939382874},
+    {-1.258161288627538, -1.3463324608478302,
+     -0.23167706417980538, -0.56398069330812595},
+    {-1.2152684908280278, -1.30343966304832,
+     -0.37187579530266779, -0.65961083452300451},
+    {-1.3092214913221203, -1.3973926635424125,
+     -0.52676353330362069, -0.93538204444688322},
+    {-1.2582416660435087, -1.346412838263801,
+     -0.64532735232596217, -0.9777280675252189},
+    {-1.3091720858533034, -1.3973432580735956,
+     -0.27365560934767724, -0.68218278667322529},
+    {-1.1541310240253302, -1.2423021962456224,
+     -0.78500266824318399, -1.0272182764059958},
+    {-1.1023341277498249, -1.1905052999701171,
+     -0.82893926663878603, -1.0430754625240022},
+    {-1.1655367530687148, -1.2537079252890071,
+     -0.63420787789200239, -0.8837211165914951},
+    {-1.1152934881839081, -1.2034646604042003,
+     -0.69805943513859747, -0.91853767937321262},
+    {-1.1891289209181768, -1.277300093138469,
+     -0.89153805082520388, -1.1577502392816761},
+    {-1.1361185294592653, -1.2242897016795575,
+     -0.92523342009323339, -1.1568142303910429},
+    {-1.2062822258019541, -1.2944533980222463,
+     -0.72648428209183169, -1.0064164989382316},
+    {-1.1889694171221612, -1.2771405893424534,
+     -0.052040950916719328, -0.31813223010753905},
+    {-1.1540149140977294, -1.2421860863180216,
+     -0.18261019719969271, -0.42475387034568446},
+    {-1.1651503658322162, -1.2533215380525085,
+     0.078170953563226495, -0.17108734196368314},
+    {-1.1359532212296666, -1.2241243934499588,
+     -0.053119510948190007, -0.28460738671317137},
+    {-1.2424928093516314, -1.3306639815719237,
+     -0.050161846570814073, -0.3646020040839017},
+    {-1.2061809914351291, -1.2943521636554214,
+     -0.20323584046162246, -0.48308269235862766},
+    {-1.218528869819713, -1.3067000420400052,
+     0.10235298131141643, -0.18832760033110504},
+    {-1.1219668566405019, -1.2101380288607941,
+     -0.42433460123475619, -0.64824242281269351},
+    {-1.0768423961654818, -1.1650135683857741,
+     -0.50358724084035555, -0.70635091625294566},
+    {-1.1152144464663105, -1.2033856186866028,
+     -0.2913525092555046, -0.51179082033737822},
+    {-1.073857289021058, -1.1620284612413503,
+     -0.38153386501754838, -0.58305270720746349},
+    {-1.1694301523313748, -1.2576013245516671,
+     -0.47879327665067795, -0.73090695147034057},
+    {-1.1219936949162914, -1.2101648671365837,
+     -0.56158773851732202, -0.78550958848417385},
+    {-1.1654766814637885, -1.2536478536840807,
+     -0.32602364791862537, -0.57549721393793896},
+    {-1.401600464463302, -1.4897716366835942,
+     -0.4686120570921688, -1.175201582484392},
+    {-1.3495246044541065, -1.4376957766743987,
+     -0.66693925050764413, -1.1671715154262046},
+    {-1.4015158016325113, -1.4896869738528036,
+     -0.032747605852832484, -0.73886179801693208},
+    {-1.3578944209347894, -1.4460655931550817,
+     -0.34183638060631721, -0.86661601467393146},
+    {-1.4336862011110996, -1.5218573733313918,
+     -0.74250429021736242, -1.6916997063345547},
+    {-1.3803826090869118, -1.468553781307204,
+     -0.88856781456409317, -1.4932814224725011},
+    {-1.4504820503969724, -1.5386532226172647,
+     -0.023918512378344248, -1.1817059654640352},
+    {-1.272578002299215, -1.3607491745195073,
+     -0.99605677848615815, -1.3467689266673208},
+    {-1.2187373756672395, -1.3069085478875317,
+     -1.0212849350862787, -1.3121560469533891},
+    {-1.2962752968861007, -1.3844464691063929,
+     -0.77627140430686548, -1.1623073119734939},
+    {-1.2426442668477351, -1.3308154390680274,
+     -0.84482938818871345, -1.1594326601794682},
+    {-1.2937171670134882, -1.3818883392337804,
+     -1.1840118860042628, -1.565885067127907},
+    {-1.2412521558200778, -1.32942332804037,
+     -1.1760304493966145, -1.489141076115585},
+    {-1.3265673860021727, -1.414738558222465,
+     -0.95684070971741042, -1.4003357524155879},
+    {-1.3263548692933205, -1.4145260415136127,
+     0.19097422538572031, -0.25205670523089196},
+    {-1.2961357115341841, -1.3843068837544763,
+     -0.046998077657403076, -0.43280443967496091},
+    {-1.2934446780187931, -1.3816158502390854,
+     0.35610054482182851, -0.025334658644728503},
+    {-1.2723679066990981, -1.3605390789193903,
+     0.13714923819394664, -0.21327947643453199},
+    {-1.3801659581265966, -1.4683371303468888,
+     0.28429879307509487, -0.3195272044212788},
+    {-1.3494042018476833, -1.4375753740679755,
+     -0.041666274647458312, -0.54156241304663533},
+    {-1.3452605456791054, -1.4334317178993976,
+     0.47617063207063692, -0.012431015914022236},
+    {-1.3385814624843764, -1.4267526347046686,
+     1.5023240458429645, 1.0308746774728592},
+    {-1.3191173628914152, -1.4072885351117075,
+     1.2422107121501693, 0.81441450150936412},
+    {-1.3012785220949721, -1.3894496943152643,
+     1.6152629619047878, 1.2208098992055878},
+    {-1.289875174815696, -1.3780463470359883,
+     1.3894929228743167, 1.0137011053625775},
+    {-1.3859836670175241, -1.4741548392378163,
+     1.6897782033224691, 1.0611651796547235},
+    {-1.3697520840365287, -1.457923256256821,
+     1.3311949785607471, 0.76713404368161986},
+    {-1.3457420936091122, -1.4339132658294045,
+     1.7852448687701428, 1.2953573586883176},
+    {-1.3021199891400959, -1.3902911613603881,
+     0.82246342770942305, 0.42655755268041806},
+    {-1.2590827829806754, -1.3472539552009677,
+     0.66763570951808959, 0.33421548519948052},
+    {-1.2899410735995858, -1.378112245819878,
+     1.0243939005005862, 0.64849945357554106},
+    {-1.2539738488777321, -1.3421450210980244,
+     0.85249877277091934, 0.52517289805211143},
+    {-1.3499073000500081, -1.4380784722703004,
+     0.77436174909130429, 0.27305806102638475},
+    {-1.3036355229870289, -1.3918066952073211,
+     0.5924984741973045, 0.19394810428371587},
+    {-1.3401783762382109, -1.4283495484585031,
+     1.0379480836651429, 0.56251013445470011},
+    {-1.2130492897599117, -1.3012204619802039,
+     1.582579591543134, 1.2968138230886033},
+    {-1.2046384180535146, -1.2928095902738068,
+     1.4153114426615485, 1.1367585884343014},
+    {-1.1686325333730707, -1.256803705593363,
+     1.6478503020146458, 1.3962740806035741},
+    {-1.1649320600402409, -1.2531032322605331,
+     1.497430747911481, 1.2483162466735209},
+    {-1.2590278756595104, -1.3471990478798026,
+     1.6950970216596963, 1.3617435478982554},
+    {-1.2538584362872078, -1.3420296085075001,
+     1.4987594753919742, 1.1715686039081346},
+    {-1.2132374850416974, -1.3014086572619896,
+     1.7535695445367647, 1.4676378768624301},
+    {-1.218850239879866, -1.3070214121001582,
+     1.15000260780203, 0.85902825241777492},
+    {-1.1927518040868756, -1.2809229763071679,
+     1.0103457978235144, 0.7413555853623981},
+    {-1.1891005709696252, -1.2772717431899174,
+     1.2601003298494995, 0.99390964013534711},
+    {-1.1679236845167575, -1.2560948567370498,
+     1.1218712752869091, 0.87077063871818949},
+    {-1.2694867209184177, -1.35765789313871,
+     1.1890622481536344, 0.84247320831924022},
+    {-1.2407039182554429, -1.3288750904757352,
+     1.0159511330659987, 0.70342429021352426},
+    {-1.239872707676257, -1.3280438798965493,
+     1.3138985462074073, 1.0022524886882906},
+    {-1.4158355961078619, -1.5040067683281542,
+     2.4538940081843457, 1.6570329587589097},
+    {-1.4306850368249462, -1.5188562090452384,
+     2.0517232401767549, 1.1321067412909422},
+    {-1.3682137012339908, -1.456384873454283,
+     2.3317771761155686, 1.7731457976996787},
+    {-1.3851608521041838, -1.4733320243244761,
+     2.0431499928972259, 1.4181668069512066},
+    {-1.4283184418543204, -1.5164896140746127,
+     2.9830190524353961, 2.0854528917107755},
+    {-1.4645608623922421, -1.5527320346125344,
+     2.8125135648450321, 1.3929136878441666},
+    {-1.3853630409766968, -1.4735342131969891,
+     2.6686381797274947, 2.0427669696911375},
+    {-1.4412119991927601, -1.5293831714130524,
+     1.1111688018136929, 0.078654348924818762},
+    {-1.3954007080202484, -1.4835718802405407,
+     0.68546367985723, 0.01205693108793196},
+    {-1.4210744977358567, -1.5092456699561489,
+     1.5087053822765879, 0.672483197430229},
+    {-1.3909548329605272, -1.4791260051808195,
+     1.0619639537591457, 0.41048156378408174},
+    {-1.485755263611692, -1.5707963267948966,
+     3.1415926535897931, -3.1415926535897931},
+    {-1.4334608986121595, -1.5216320708324518,
+     0.48323365577103827, -0.46367502060169064},
+    {-1.4724289941264719, -1.5606001663467641,
+     2.0240844450469577, 0.39896196440470511},
+    {-1.2904639250747834, -1.3786350972950756,
+     2.0612586055303801, 1.6845478312800608},
+    {-1.3016413927979358, -1.389812565018228,
+     1.8470757854262956, 1.4519975620302581},
+    {-1.2401033017054577, -1.3282744739257499,
+     2.0658379924972392, 1.7539481075185672},
+    {-1.2543796236758127, -1.3425507958961049,
+     1.8886715504250919, 1.560870102488028},
+    {-1.319366068172475, -1.4075372403927673,
+     2.2768497717917353, 1.8485478170870997},
+    {-1.3390083399672057, -1.4271795121874979,
+     2.0546194363511412, 1.5821105505000117},
+    {-1.2690445027999973, -1.3572156750202895,
+     2.2422326475489176, 1.8962252502939356},
+    {-1.338955175062597, -1.4271263472828892,
+     -2.241770675788334, -2.7141473411613357},
+    {-1.319507951911443, -1.4076791241317352,
+     -2.0248827104202896, -2.4534737347073978},
+    {-1.3863425013638981, -1.4745136735841904,
+     -2.2722197746278479, -2.9024291625157552},
+    {-1.3701420733347127, -1.458313245555005,
+     -1.9773932970326311, -2.5428476816555361},
+    {-1.3030344101284204, -1.3912055823487126,
+     -2.4262493575041297, -2.8237465043353067},
+    {-1.2911388824134999, -1.3793100546337922,
+     -2.2247791555331506, -2.6025491505191765},
+    {-1.3460636055870612, -1.4342347778073534,
+     -2.5017745881985314, -2.9925244594941662},
+    {-1.2410930938833711, -1.3292642661036633,
+     -1.9138251684349585, -2.2267661858964969},
+    {-1.2067506794089697, -1.294921851629262,
+     -1.8034258052274215, -2.083753757764518},
+    {-1.2903291819203244, -1.3785003541406167,
+     -1.858736311277287, -2.2352363624286307},
+    {-1.2543503181286344, -1.3425214903489266,
+     -1.7353183062572537, -2.0630853596186216},
+    {-1.2214829177263808, -1.3096540899466731,
+     -2.0714912145438262, -2.3648958688405459},
+    {-1.1931415975769144, -1.2813127697972067,
+     -1.9518518969765639, -2.2211446728112967},
+    {-1.2698775884619786, -1.3580487606822709,
+     -2.0530389160488789, -2.400143744948243},
+    {-1.4728084821085157, -1.5609796543288079,
+     -1.6057626416056237, 3.0408700380212363},
+    {-1.4415766887703696, -1.5297478609906618,
+     -1.2855363498793757, -2.3224630355200797},
+    {-1.5134728376466227, -1.5707963267948966,
+     3.1415926535897931, -3.1415926535897931},
+    {-1.4860097638514325, -1.5707963267948966,
+     3.1415926535897931, -3.1415926535897931},
+    {-1.4310018022941371, -1.5191729745144293,
+     -2.3437283281110028, 3.0168061938511403},
+    {-1.4214627886425562, -1.5096339608628484,
+     -1.8821575212553088, -2.7214533149411784},
+    {-1.464724240259121, -1.5528954124794132,
+     -2.6075162281538278, 2.2523323739284784},
+    {-1.3502610230230234, -1.4384321952433157,
+     -1.4823711689523911, -1.9846693215069833},
+    {-1.3039644485832536, -1.3921356208035458,
+     -1.4034717872799305, -1.8026009021867588},
+    {-1.3957197938174546, -1.4838909660377468,
+     -1.2202721575337816, -1.8953098559829593},
+    {-1.3455510639088597, -1.433722236129152,
+     -1.1964996586563104, -1.6858762455819016},
+    {-1.3405644016360867, -1.4287355738563789,
+     -1.7724297807567597, -2.2488422309983558},
+    {-1.3024887928797202, -1.3906599651000124,
+     -1.6364123181226018, -2.0329584085874606},
+    {-1.3913359334016593, -1.4795071056219515,
+     -1.619666013386476, -2.2729711595686255},
+    {-1.2634432837495138, -1.351614455969806,
+     -2.7396609859598779, -3.0784722851188819},
+    {-1.2653253451743913, -1.3534965173946836,
+     -2.5562567635553322, -2.8974512014474767},
+    {-1.2962053844963259, -1.3843765567166182,
+     -2.8595083958156366, 3.0377560084623103},
+    {-1.3045726598693157, -1.3927438320896079,
+     -2.6444859435545376, -3.0446897606526515},
+    {-1.2233809425166271, -1.3115521147369193,
+     -2.8069504336436855, -3.1021338231111053},
+    {-1.2273774439546559, -1.3155486161749481,
+     -2.6506763574875478, -2.9496800569679031},
+    {-1.2538249172303326, -1.3419960894506249,
+     -2.9156476684322135, 3.0403859543117449},
+    {-1.2143139246539769, -1.3024850968742692,
+     -2.3433117823132412, -2.6301962704540549},
+    {-1.197401111271118, -1.2855722834914103,
+     -2.2058435907765253, -2.478490296560933},
+    {-1.2587252002335942, -1.3468963724538865,
+     -2.3773728990915282, -2.7103589090656883},
+    {-1.2437972304940796, -1.3319684027143719,
+     -2.2137365392039743, -2.5295873208046067},
+    {-1.1830460142728321, -1.2712171864931243,
+     -2.4471970907208078, -2.7088793754706817},
+    {-1.1704577762893018, -1.2586289485095941,
+     -2.3182183317848, -2.5710280746781327},
+    {-1.2244282930814974, -1.3125994653017896,
+     -2.4935873838893743, -2.7897620222768973},
+    {-1.3688211668441237, -1.4569923390644159,
+     -2.9699703345837238, 2.7524523042069249},
+    {-1.3854428528477818, -1.473614025068074,
+     -2.6302020251508145, 3.0267608319628732},
+    {-1.3854327842185037, -1.4736039564387959,
+     3.0271161818576737, 2.4009380642618585},
+    {-1.4160160402676465, -1.5041872124879387,
+     -2.8702566722401968, 2.6147739399483405},
+    {-1.3233370531655329, -1.4115082253858251,
+     -3.0220793778392916, 2.824560155172724},
+    {-1.3401931897756569, -1.4283643619959492,
+     -2.7741399979805896, 3.0335700388543927},
+    {-1.3417402156697513, -1.4299113878900436,
+     3.0460704665713649, 2.5666645221850697},
+};
+
+#endif
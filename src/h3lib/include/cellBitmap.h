@@ -0,0 +1,76 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file cellBitmap.h
+ * @brief   Dense sets of the descendants of a cell, one bit per cell
+ */
+
+#ifndef CELLBITMAP_H
+#define CELLBITMAP_H
+
+#include <stdint.h>
+
+#include "h3api.h"
+
+/**
+ * A set of the descendants of `parent` at resolution `res`, with bit
+ * (i % 64) of `words[i / 64]` set if the child at position i (see
+ * cellToChildPos) is in the set. Initialize with initCellBitmap and free
+ * with destroyCellBitmap.
+ */
+typedef struct {
+    H3Index parent;    ///< Cell whose descendants are in the set
+    int res;           ///< Resolution of the cells in the set
+    int64_t numBits;   ///< Number of descendants of parent at res
+    uint64_t *words;   ///< ceil(numBits / 64) words of bits
+} CellBitmap;
+
+/** @brief create an empty set of the descendants of a cell */
+DECLSPEC H3Error H3_EXPORT(initCellBitmap)(H3Index parent, int res,
+                                           CellBitmap *out);
+
+/** @brief add cells, possibly compacted, to a set */
+DECLSPEC H3Error H3_EXPORT(cellBitmapAddCells)(CellBitmap *bitmap,
+                                               const H3Index *cells,
+                                               int64_t numCells);
+
+/** @brief whether a set contains a cell and all of its descendants */
+DECLSPEC int H3_EXPORT(cellBitmapContains)(const CellBitmap *bitmap,
+                                           H3Index cell);
+
+/** @brief add the cells of another set to a set */
+DECLSPEC H3Error H3_EXPORT(cellBitmapUnion)(CellBitmap *bitmap,
+                                            const CellBitmap *other);
+
+/** @brief remove the cells not in another set from a set */
+DECLSPEC H3Error H3_EXPORT(cellBitmapIntersect)(CellBitmap *bitmap,
+                                                const CellBitmap *other);
+
+/** @brief number of cells in a set */
+DECLSPEC int64_t H3_EXPORT(cellBitmapCount)(const CellBitmap *bitmap);
+
+/** @brief cells of a set, in child position order */
+DECLSPEC H3Error H3_EXPORT(cellBitmapToCells)(const CellBitmap *bitmap,
+                                              H3Index *out);
+
+/** @brief cells of a set, compacted as by compactCells */
+DECLSPEC H3Error H3_EXPORT(cellBitmapToCompactCells)(const CellBitmap *bitmap,
+                                                     H3Index *out,
+                                                     int64_t *numOut);
+
+/** @brief Free the memory held by a CellBitmap */
+DECLSPEC void H3_EXPORT(destroyCellBitmap)(CellBitmap *bitmap);
+
+#endif
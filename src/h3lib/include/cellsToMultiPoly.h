@@ -28,6 +28,7 @@
 #include <stdint.h>
 
 #include "alloc.h"
+#include "arena.h"
 #include "h3api.h"
 #include "mathExtensions.h"
 
@@ -84,7 +85,11 @@ typedef struct {
  * 2. buckets array: numBuckets * sizeof(Arc *)
  *                   where numBuckets = numArcs * HASH_TABLE_MULTIPLIER
  *
+ * When edges are paired by sorting, `hashMultiplier` is 0; the two sort
+ * buffers (2 * sizeof(EdgeKey) per arc) are smaller than the arcs array.
+ *
  * @param numCells Number of cells to convert
+ * @param hashMultiplier Number of hash buckets per arc, or 0
  * @return E_SUCCESS if allocations are safe, E_MEMORY_BOUNDS if overflow would
  * occur
  */
@@ -229,6 +234,38 @@ DECLSPEC H3Error H3_EXPORT(cellsToMultiPolygon)(const H3Index *cells,
                                                 const int64_t numCells,
                                                 GeoMultiPolygon *out);
 
+/** @brief Create a GeoMultiPolygon from a set of cells, pairing edges by
+ * sorting instead of hashing */
+DECLSPEC H3Error H3_EXPORT(cellsToMultiPolygonSorted)(const H3Index *cells,
+                                                      const int64_t numCells,
+                                                      GeoMultiPolygon *out);
+
+/** @brief Create a GeoMultiPolygon from a set of cells, simplifying loops to
+ * within `tolerance` radians */
+DECLSPEC H3Error H3_EXPORT(cellsToMultiPolygonSimplified)(
+    const H3Index *cells, const int64_t numCells, double tolerance,
+    GeoMultiPolygon *out);
+
+/** @brief Create a GeoMultiPolygon from a set of cells, allocating the output
+ * from an arena */
+DECLSPEC H3Error H3_EXPORT(cellsToMultiPolygonArena)(const H3Index *cells,
+                                                     const int64_t numCells,
+                                                     Arena *arena,
+                                                     GeoMultiPolygon *out);
+
+/** @brief Create a GeoMultiPolygon from a set of cells, using up to
+ * `numThreads` threads */
+DECLSPEC H3Error H3_EXPORT(cellsToMultiPolygonParallel)(const H3Index *cells,
+                                                        const int64_t numCells,
+                                                        int numThreads,
+                                                        GeoMultiPolygon *out);
+
+/** @brief Create a GeoMultiPolygon from a compacted set of cells of mixed
+ * resolutions */
+DECLSPEC H3Error H3_EXPORT(compactCellsToMultiPolygon)(const H3Index *cells,
+                                                       const int64_t numCells,
+                                                       GeoMultiPolygon *out);
+
 /** @brief Free all memory created for a GeoMultiPolygon */
 DECLSPEC void H3_EXPORT(destroyGeoMultiPolygon)(GeoMultiPolygon *mpoly);
 
@@ -23,6 +23,20 @@
 #include "algos.h"
 #include "h3Index.h"
 
-// nothing non-public in this file
+/** @brief whether each of an array of pairs of cells are neighbors */
+DECLSPEC H3Error H3_EXPORT(areNeighborCellPairs)(const H3Index *origins,
+                                                 const H3Index *destinations,
+                                                 int64_t numPairs,
+                                                 uint64_t *neighborBitmap,
+                                                 uint64_t *errorBitmap);
+
+/** @brief all directed edges of a cell with their boundaries */
+DECLSPEC H3Error H3_EXPORT(originToDirectedEdgesWithBoundaries)(
+    H3Index origin, H3Index *edges, CellBoundary *boundaries);
+
+/** @brief all directed edges with their boundaries of an array of cells */
+DECLSPEC H3Error H3_EXPORT(originsToDirectedEdgesWithBoundaries)(
+    const H3Index *origins, int64_t numOrigins, H3Index *edges,
+    CellBoundary *boundaries, uint64_t *errorBitmap);
 
 #endif
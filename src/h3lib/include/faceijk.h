@@ -74,9 +74,10 @@ typedef enum {
 void _vec3ToFaceIjk(Vec3d p, int res, FaceIJK *h);
 void _faceIjkToVec3(const FaceIJK *h, int res, Vec3d *g);
 void _faceIjkToCellBoundary(const FaceIJK *h, int res, int start, int length,
-                            CellBoundary *g);
+                            CellBoundary *g, int *vertIndexes);
 void _faceIjkPentToCellBoundary(const FaceIJK *h, int res, int start,
-                                int length, CellBoundary *g);
+                                int length, CellBoundary *g,
+                                int *vertIndexes);
 void _faceIjkToVerts(FaceIJK *fijk, int *res, FaceIJK *fijkVerts);
 void _faceIjkPentToVerts(FaceIJK *fijk, int *res, FaceIJK *fijkVerts);
 Overage _adjustOverageClassII(FaceIJK *fijk, int res, int pentLeading4,
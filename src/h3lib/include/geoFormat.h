@@ -0,0 +1,72 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file geoFormat.h
+ * @brief   WKB and GeoJSON serialization of GeoMultiPolygons
+ */
+
+#ifndef GEO_FORMAT_H
+#define GEO_FORMAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "h3api.h"
+
+/** Largest number of significant digits accepted by geoMultiPolygonToGeoJson;
+ * enough to round trip any double */
+#define GEOJSON_MAX_DIGITS 17
+
+/**
+ * A growable byte buffer. Serializers append to `data`, growing it with
+ * H3_MEMORY(realloc) as needed, so a buffer can be reused across calls by
+ * resetting `size` to 0. Zero-initialize a buffer before first use, and free
+ * it with destroyByteBuffer.
+ */
+typedef struct {
+    uint8_t *data;    ///< Buffer contents, or NULL
+    size_t size;      ///< Number of bytes written
+    size_t capacity;  ///< Number of bytes allocated
+} ByteBuffer;
+
+/** @brief Append a GeoMultiPolygon as little-endian WKB MultiPolygon */
+DECLSPEC H3Error H3_EXPORT(geoMultiPolygonToWkb)(const GeoMultiPolygon *mpoly,
+                                                 ByteBuffer *out);
+
+/** @brief Append a GeoMultiPolygon as a GeoJSON MultiPolygon geometry */
+DECLSPEC H3Error H3_EXPORT(geoMultiPolygonToGeoJson)(
+    const GeoMultiPolygon *mpoly, int digits, ByteBuffer *out);
+
+/** @brief Parse a WKB Polygon or MultiPolygon into a GeoMultiPolygon */
+DECLSPEC H3Error H3_EXPORT(wkbToGeoMultiPolygon)(const uint8_t *wkb,
+                                                 size_t wkbSize,
+                                                 GeoMultiPolygon *out);
+
+/** @brief maximum number of cells that could be in a WKB (multi)polygon */
+DECLSPEC H3Error H3_EXPORT(maxPolygonToCellsSizeWkb)(const uint8_t *wkb,
+                                                     size_t wkbSize, int res,
+                                                     uint32_t flags,
+                                                     int64_t *out);
+
+/** @brief cells within a WKB (multi)polygon */
+DECLSPEC H3Error H3_EXPORT(polygonToCellsWkb)(const uint8_t *wkb,
+                                              size_t wkbSize, int res,
+                                              uint32_t flags, int64_t size,
+                                              H3Index *out);
+
+/** @brief Free the memory held by a ByteBuffer */
+DECLSPEC void H3_EXPORT(destroyByteBuffer)(ByteBuffer *buffer);
+
+#endif
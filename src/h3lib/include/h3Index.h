@@ -182,4 +182,80 @@ DECLSPEC H3Index _zeroIndexDigits(H3Index h, int start, int end);
 H3Error vec3ToCell(const Vec3d *v, int res, H3Index *out);
 H3Error cellToVec3(H3Index h3, Vec3d *v);
 
+/*
+ * Functions over arrays of n items may report a flag per item in a bitmap of
+ * ceil(n / 64) words, with bit (i % 64) of word (i / 64) for item i. An
+ * error bitmap flags the items that failed, and may be NULL.
+ */
+
+/** @brief parse hex strings separated by a delimiter */
+DECLSPEC H3Error H3_EXPORT(stringsToH3)(const char *buf, size_t size,
+                                        char delimiter, H3Index *out,
+                                        int64_t maxOut, int64_t *numOut,
+                                        uint64_t *errorBitmap);
+
+/** @brief parse packed fixed width hex strings */
+DECLSPEC H3Error H3_EXPORT(stringsToH3Fixed)(const char *buf,
+                                             int64_t numStrings, int width,
+                                             H3Index *out,
+                                             uint64_t *errorBitmap);
+
+/** @brief format indexes as hex strings separated by a delimiter */
+DECLSPEC H3Error H3_EXPORT(h3sToStrings)(const H3Index *h3s, int64_t numH3s,
+                                         char delimiter, char *buf,
+                                         size_t size, size_t *written);
+
+/** @brief format indexes as packed fixed width hex strings */
+DECLSPEC H3Error H3_EXPORT(h3sToStringsFixed)(const H3Index *h3s,
+                                              int64_t numH3s, int width,
+                                              char *buf);
+
+/** @brief validate an array of indexes as cells into a bitmap */
+DECLSPEC H3Error H3_EXPORT(areValidCells)(const H3Index *cells,
+                                          int64_t numCells,
+                                          uint64_t *validBitmap,
+                                          int *allValid);
+
+/** @brief resolutions of an array of indexes */
+DECLSPEC H3Error H3_EXPORT(getResolutions)(const H3Index *h3s,
+                                           int64_t numH3s, int *out);
+
+/** @brief index digits at one resolution of an array of indexes */
+DECLSPEC H3Error H3_EXPORT(getIndexDigits)(const H3Index *h3s,
+                                           int64_t numH3s, int res,
+                                           int *out);
+
+/** @brief parents at one resolution of an array of cells */
+DECLSPEC H3Error H3_EXPORT(cellsToParent)(const H3Index *cells,
+                                          int64_t numCells, int parentRes,
+                                          H3Index *out,
+                                          uint64_t *errorBitmap);
+
+/** @brief center children at one resolution of an array of cells */
+DECLSPEC H3Error H3_EXPORT(cellsToCenterChild)(const H3Index *cells,
+                                               int64_t numCells, int childRes,
+                                               H3Index *out,
+                                               uint64_t *errorBitmap);
+
+/** @brief smallest and largest children of a cell at a resolution */
+DECLSPEC H3Error H3_EXPORT(cellToChildrenRange)(H3Index h, int childRes,
+                                                H3Index *min, H3Index *max);
+
+/** @brief merged children ranges of a set of cells at a resolution */
+DECLSPEC H3Error H3_EXPORT(compactCellsToChildrenRanges)(
+    const H3Index *compactedSet, const int64_t numCompacted, const int res,
+    H3Index *ranges, int64_t *numRanges);
+
+/** @brief child positions of an array of cells */
+DECLSPEC H3Error H3_EXPORT(cellsToChildPos)(const H3Index *cells,
+                                            int64_t numCells, int parentRes,
+                                            int64_t *out,
+                                            uint64_t *errorBitmap);
+
+/** @brief children of a cell at an array of child positions */
+DECLSPEC H3Error H3_EXPORT(childPosToCells)(const int64_t *childPos,
+                                            int64_t numPos, H3Index parent,
+                                            int childRes, H3Index *out,
+                                            uint64_t *errorBitmap);
+
 #endif
@@ -41,6 +41,9 @@
  * `iterInitBaseCellNum` sets up an iterator for children cells, given
  * a base cell number (0--121).
  *
+ * `iterResumeChild` sets up an iterator positioned at a given child, to
+ * resume iteration from a saved parent and child.
+ *
  * Iteration:
  *
  * Step iterator with `iterStepChild`.
@@ -59,6 +62,7 @@ DECLSPEC IterCellsChildren iterInitParent(H3Index h, int childRes);
 void _iterInitParent(H3Index h, int childRes, IterCellsChildren *iter);
 DECLSPEC IterCellsChildren iterInitBaseCellNum(int baseCellNum, int childRes);
 DECLSPEC void iterStepChild(IterCellsChildren *iter);
+DECLSPEC IterCellsChildren iterResumeChild(H3Index h, H3Index child);
 
 /**
  * IterCellsResolution: struct for iterating through all cells at a given
@@ -66,7 +70,8 @@ DECLSPEC void iterStepChild(IterCellsChildren *iter);
  *
  * Constructor:
  *
- * Initialize with `IterCellsResolution`.
+ * Initialize with `iterInitRes`, or with `iterResumeRes` to resume
+ * iteration from a saved cell.
  *
  * Iteration:
  *
@@ -84,8 +89,89 @@ typedef struct {
 } IterCellsResolution;
 
 DECLSPEC IterCellsResolution iterInitRes(int res);
+DECLSPEC IterCellsResolution iterResumeRes(H3Index h);
 DECLSPEC void iterStepRes(IterCellsResolution *iter);
 
+/**
+ * IterCellsShard: struct for iterating through one of several disjoint
+ * shards of all cells at a given resolution, e.g. to split generating a
+ * global table across workers.
+ *
+ * Constructors:
+ *
+ * Initialize with `iterInitShard`, or with `iterResumeShard` to continue
+ * from a saved cell. Shards are contiguous ranges in the iteration order of
+ * `IterCellsResolution` with sizes differing by at most one.
+ *
+ * Iteration:
+ *
+ * Step iterator with `iterStepShard`.
+ * The current iterate is accessed via the `IterCellsShard.h` member, which
+ * is also the cursor to save for resuming.
+ * When the shard is finished or if there was an error in initialization,
+ * `IterCellsShard.h` will be `H3_NULL` even after calling `iterStepShard`.
+ */
+typedef struct {
+    H3Index h;
+    int64_t _remaining;  // cells left in the shard, including h
+    IterCellsResolution _itR;
+} IterCellsShard;
+
+DECLSPEC IterCellsShard iterInitShard(int res, int64_t shard,
+                                      int64_t numShards);
+DECLSPEC IterCellsShard iterResumeShard(int64_t shard, int64_t numShards,
+                                        H3Index h);
+DECLSPEC void iterStepShard(IterCellsShard *iter);
+
+/**
+ * IterCellsUncompact: struct for iterating through the uncompacted cells of
+ * a compacted set at a given resolution, in the order of uncompactCells,
+ * without materializing them.
+ *
+ * Constructors:
+ *
+ * Initialize with `iterInitUncompact`, or with `iterResumeUncompact` to
+ * continue from a cursor returned by `iterUncompactCursor`. The compacted
+ * set is not copied and must outlive the iterator.
+ *
+ * Iteration:
+ *
+ * Step iterator with `iterStepUncompact`.
+ * The current iterate is accessed via the `IterCellsUncompact.h` member.
+ * When the iterator is exhausted or on error, `IterCellsUncompact.h` will be
+ * `H3_NULL` even after calling `iterStepUncompact`. `IterCellsUncompact.error`
+ * is E_SUCCESS if the iterator was exhausted normally, E_RES_MISMATCH if a
+ * cell of the set is finer than the resolution, or E_DOMAIN for an invalid
+ * cursor.
+ */
+typedef struct {
+    H3Index h;
+    H3Error error;
+    const H3Index *_compactedSet;
+    int64_t _numCompacted;
+    int64_t _index;  // position in the compacted set of the current parent
+    int _res;
+    IterCellsChildren _itC;
+} IterCellsUncompact;
+
+/**
+ * Position of an IterCellsUncompact, from which iteration can be resumed with
+ * `iterResumeUncompact`. Only meaningful for the same compacted set and
+ * resolution.
+ */
+typedef struct {
+    int64_t index;  ///< Position in the compacted set
+    H3Index h;      ///< Next cell to produce, or H3_NULL when exhausted
+} UncompactCursor;
+
+DECLSPEC IterCellsUncompact iterInitUncompact(const H3Index *compactedSet,
+                                              int64_t numCompacted, int res);
+DECLSPEC IterCellsUncompact iterResumeUncompact(const H3Index *compactedSet,
+                                                int64_t numCompacted, int res,
+                                                UncompactCursor cursor);
+DECLSPEC void iterStepUncompact(IterCellsUncompact *iter);
+DECLSPEC UncompactCursor iterUncompactCursor(const IterCellsUncompact *iter);
+
 /**
  * IterEdgesGosper: iterator for the directed edges on the boundary of a cell's
  * child set (the Gosper island outline) at a given resolution.
@@ -0,0 +1,31 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file parallel.h
+ * @brief   Minimal fork-join helper for parallel algorithms
+ */
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <stdint.h>
+
+/** Task function run by parallelFor, once for each task index */
+typedef void (*ParallelTask)(void *context, int64_t task);
+
+void parallelFor(int numThreads, int64_t numTasks, ParallelTask run,
+                 void *context);
+
+#endif
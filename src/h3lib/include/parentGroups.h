@@ -0,0 +1,48 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file parentGroups.h
+ * @brief   Run-length grouping of cells by their ancestors
+ */
+
+#ifndef PARENTGROUPS_H
+#define PARENTGROUPS_H
+
+#include <stdint.h>
+
+#include "h3api.h"
+
+/**
+ * Runs of consecutive cells sharing a parent at one resolution. The caller
+ * sets `res` and provides `parents` and `counts` with room for one group per
+ * input cell.
+ */
+typedef struct {
+    int res;             ///< Resolution of the parents
+    int64_t numGroups;   ///< Output: number of groups
+    H3Index *parents;    ///< Output: parent of each group
+    int64_t *counts;     ///< Output: number of cells in each group
+} ParentGroups;
+
+/** @brief sort cells so that descendants of each parent are contiguous */
+DECLSPEC void H3_EXPORT(sortCells)(H3Index *cells, int64_t numCells);
+
+/** @brief group runs of cells by parent at several resolutions at once */
+DECLSPEC H3Error H3_EXPORT(cellsToParentGroups)(const H3Index *cells,
+                                                int64_t numCells,
+                                                ParentGroups *groups,
+                                                int numResolutions);
+
+#endif
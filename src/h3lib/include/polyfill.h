@@ -78,7 +78,62 @@ DECLSPEC IterCellsPolygon iterInitPolygon(const GeoPolygon *polygon, int res,
 DECLSPEC void iterStepPolygon(IterCellsPolygon *iter);
 DECLSPEC void iterDestroyPolygon(IterCellsPolygon *iter);
 
+/**
+ * IterCellsMultiPolygonCompact: struct for iterating through all the cells
+ * within any part of a given multipolygon, outputting a compact set. The grid
+ * traversal is shared by all parts, and each cell is output at most once,
+ * tagged with the index of the (lowest-indexed) part containing it.
+ *
+ * Initialize with `iterInitMultiPolygonCompact`, step with
+ * `iterStepMultiPolygonCompact`, and destroy with
+ * `iterDestroyMultiPolygonCompact` if not exhausted. As with
+ * `IterCellsPolygonCompact`, the caller must check `error` when `H3_NULL` is
+ * received.
+ */
+typedef struct {
+    H3Index cell;  // current value
+    int part;      // index of the part containing the current value
+    H3Error error;  // error, if any
+    int _res;       // target resolution
+    uint32_t _flags;  // Mode flags for the polygonToCells operation
+    const GeoMultiPolygon *_multiPolygon;  // the polygons we're filling
+    BBox *_bboxes;  // Bounding boxes for all parts and their holes
+    int64_t *_bboxOffsets;  // Offset of each part's boxes in _bboxes
+    BBox _parentBBox;  // Bounding box of the children of the last cell
+                       // descended into, filtering cells at the target res
+    bool _started;     // Whether iteration has started
+} IterCellsMultiPolygonCompact;
+
+DECLSPEC IterCellsMultiPolygonCompact iterInitMultiPolygonCompact(
+    const GeoMultiPolygon *multiPolygon, int res, uint32_t flags);
+DECLSPEC void iterStepMultiPolygonCompact(IterCellsMultiPolygonCompact *iter);
+DECLSPEC void iterDestroyMultiPolygonCompact(
+    IterCellsMultiPolygonCompact *iter);
+
+typedef struct {
+    H3Index cell;   // current value
+    int part;       // index of the part containing the current value
+    H3Error error;  // error, if any
+    IterCellsMultiPolygonCompact _cellIter;  // sub-iterator for compact cells
+    IterCellsChildren _childIter;            // sub-iterator for cell children
+} IterCellsMultiPolygon;
+
+DECLSPEC IterCellsMultiPolygon iterInitMultiPolygon(
+    const GeoMultiPolygon *multiPolygon, int res, uint32_t flags);
+DECLSPEC void iterStepMultiPolygon(IterCellsMultiPolygon *iter);
+DECLSPEC void iterDestroyMultiPolygon(IterCellsMultiPolygon *iter);
+
+/** @brief maximum number of cells that could be in the multipolygon */
+DECLSPEC H3Error H3_EXPORT(maxMultiPolygonToCellsSizeExperimental)(
+    const GeoMultiPolygon *multiPolygon, int res, uint32_t flags, int64_t *out);
+
+/** @brief cells within the given multipolygon, filled in a single pass */
+DECLSPEC H3Error H3_EXPORT(multiPolygonToCellsExperimental)(
+    const GeoMultiPolygon *multiPolygon, int res, uint32_t flags, int64_t size,
+    H3Index *out, int *partIds);
+
 H3Error cellToBBox(H3Index cell, BBox *out, bool coverChildren);
+H3Error _cellToBBoxComputed(H3Index cell, BBox *out, bool coverChildren);
 H3Index baseCellNumToCell(int baseCellNum);
 
 #endif
@@ -39,6 +39,14 @@ typedef struct {
 #define MAX_BASE_CELL_FACES 5
 
 int vertexNumForDirection(const H3Index origin, const Direction direction);
+H3Error vertexNumsForDirections(const H3Index origin, const FaceIJK *fijk,
+                                int *vertexNums);
 Direction directionForVertexNum(const H3Index origin, const int vertexNum);
 
+/** @brief all vertexes of each of an array of cells */
+DECLSPEC H3Error H3_EXPORT(cellsToVertexes)(const H3Index *cells,
+                                            int64_t numCells,
+                                            H3Index *vertexes,
+                                            uint64_t *errorBitmap);
+
 #endif
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file workspace.h
+ * @brief   Variants of allocating functions using caller-owned scratch memory
+ *
+ * Each function here has a matching *WorkspaceSize function giving the number
+ * of bytes of scratch memory it needs. Workspaces must be aligned as if
+ * returned by malloc, and can be reused across calls, so a loop making many
+ * calls with one large enough workspace makes no allocations.
+ */
+
+#ifndef WORKSPACE_H
+#define WORKSPACE_H
+
+#include <stdint.h>
+
+#include "h3api.h"
+
+/** @brief size in bytes of the workspace for compactCellsWithWorkspace */
+DECLSPEC H3Error H3_EXPORT(compactCellsWorkspaceSize)(const int64_t numHexes,
+                                                      int64_t *out);
+
+/** @brief compactCells using a caller-owned workspace */
+DECLSPEC H3Error H3_EXPORT(compactCellsWithWorkspace)(
+    const H3Index *h3Set, H3Index *compactedSet, const int64_t numHexes,
+    void *workspace, int64_t workspaceSize);
+
+/** @brief size in bytes of the workspace for polygonToCellsWithWorkspace */
+DECLSPEC H3Error H3_EXPORT(polygonToCellsWorkspaceSize)(
+    const GeoPolygon *geoPolygon, int res, uint32_t flags, int64_t *out);
+
+/** @brief polygonToCells using a caller-owned workspace */
+DECLSPEC H3Error H3_EXPORT(polygonToCellsWithWorkspace)(
+    const GeoPolygon *geoPolygon, int res, uint32_t flags, H3Index *out,
+    void *workspace, int64_t workspaceSize);
+
+/** @brief size in bytes of the workspace for gridDiskDistancesWithWorkspace */
+DECLSPEC H3Error H3_EXPORT(gridDiskDistancesWorkspaceSize)(int k,
+                                                           int64_t *out);
+
+/** @brief gridDiskDistances using a caller-owned workspace when distances
+ * are not needed */
+DECLSPEC H3Error H3_EXPORT(gridDiskDistancesWithWorkspace)(
+    H3Index origin, int k, H3Index *out, int *distances, void *workspace,
+    int64_t workspaceSize);
+
+#endif
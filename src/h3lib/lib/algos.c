@@ -37,6 +37,7 @@
 #include "latLng.h"
 #include "linkedGeo.h"
 #include "polygon.h"
+#include "workspace.h"
 
 /*
  * Return codes from gridDiskUnsafe and related functions.
@@ -252,6 +253,62 @@ H3Error H3_EXPORT(gridDiskDistances)(H3Index origin, int k, H3Index *out,
     }
 }
 
+/**
+ * gridDiskDistancesWorkspaceSize returns the size in bytes of the workspace
+ * needed by gridDiskDistancesWithWorkspace.
+ *
+ * @param  k    k >= 0
+ * @param  out  Size of the workspace in bytes
+ */
+H3Error H3_EXPORT(gridDiskDistancesWorkspaceSize)(int k, int64_t *out) {
+    int64_t maxIdx;
+    H3Error err = H3_EXPORT(maxGridDiskSize)(k, &maxIdx);
+    if (err) {
+        return err;
+    }
+    *out = maxIdx * (int64_t)sizeof(int);
+    return E_SUCCESS;
+}
+
+/**
+ * gridDiskDistancesWithWorkspace is gridDiskDistances using caller-owned
+ * scratch memory for the distances when `distances` is NULL, so the fallback
+ * around pentagons makes no allocations.
+ *
+ * @param  origin         origin cell
+ * @param  k              k >= 0
+ * @param  out            zero-filled array which must be of size
+ *                        maxGridDiskSize(k)
+ * @param  distances      NULL or a zero-filled array which must be of size
+ *                        maxGridDiskSize(k)
+ * @param  workspace      Scratch memory, aligned as if returned by malloc.
+ *                        Unused if `distances` is not NULL.
+ * @param  workspaceSize  Size of `workspace` in bytes, at least
+ *                        gridDiskDistancesWorkspaceSize(k)
+ * @return E_SUCCESS on success, or E_MEMORY_BOUNDS if the workspace is too
+ * small
+ */
+H3Error H3_EXPORT(gridDiskDistancesWithWorkspace)(H3Index origin, int k,
+                                                  H3Index *out, int *distances,
+                                                  void *workspace,
+                                                  int64_t workspaceSize) {
+    if (distances == NULL) {
+        int64_t neededSize;
+        H3Error err =
+            H3_EXPORT(gridDiskDistancesWorkspaceSize)(k, &neededSize);
+        if (err) {
+            return err;
+        }
+        if (workspaceSize < neededSize) {
+            return E_MEMORY_BOUNDS;
+        }
+        // No zeroing needed: the fast algorithm writes every distance it
+        // reports, and gridDiskDistances zeroes them before falling back
+        distances = workspace;
+    }
+    return H3_EXPORT(gridDiskDistances)(origin, k, out, distances);
+}
+
 /**
  * Internal algorithm for the safe but slow version of gridDiskDistances
  *
@@ -974,70 +1031,15 @@ H3Error _getEdgeHexagons(const GeoLoop *geoloop, int64_t numHexagons, int res,
 }
 
 /**
- * polygonToCells takes a given GeoJSON-like data structure and preallocated,
- * zeroed memory, and fills it with the hexagons that are contained by
- * the GeoJSON-like data structure.
- *
- * This implementation traces the GeoJSON geoloop(s) in cartesian space with
- * hexagons, tests them and their neighbors to be contained by the geoloop(s),
- * and then any newly found hexagons are used to test again until no new
- * hexagons are found.
- *
- * @param geoPolygon The geoloop and holes defining the relevant area
- * @param res The Hexagon resolution (0-15)
- * @param out The slab of zeroed memory to write to. Assumed to be big enough.
+ * Shared implementation of polygonToCells and polygonToCellsWithWorkspace.
+ * `bboxes` holds the bounding boxes of the polygon and its holes, and
+ * `search` and `found` are zeroed arrays of size numHexagons, the result of
+ * maxPolygonToCellsSize.
  */
-H3Error H3_EXPORT(polygonToCells)(const GeoPolygon *geoPolygon, int res,
-                                  uint32_t flags, H3Index *out) {
-    H3Error flagErr = validatePolygonFlags(flags);
-    if (flagErr) {
-        return flagErr;
-    }
-    // One of the goals of the polygonToCells algorithm is that two adjacent
-    // polygons with zero overlap have zero overlapping hexagons. That the
-    // hexagons are uniquely assigned. There are a few approaches to take here,
-    // such as deciding based on which polygon has the greatest overlapping area
-    // of the hexagon, or the most number of contained points on the hexagon
-    // (using the center point as a tiebreaker).
-    //
-    // But if the polygons are convex, both of these more complex algorithms can
-    // be reduced down to checking whether or not the center of the hexagon is
-    // contained in the polygon, and so this is the approach that this
-    // polygonToCells algorithm will follow, as it's simpler, faster, and the
-    // error for concave polygons is still minimal (only affecting concave
-    // shapes on the order of magnitude of the hexagon size or smaller, not
-    // impacting larger concave shapes)
-    //
-    // This first part is identical to the maxPolygonToCellsSize above.
-
-    // Get the bounding boxes for the polygon and any holes
-    BBox *bboxes = H3_MEMORY(malloc)((geoPolygon->numHoles + 1) * sizeof(BBox));
-    if (!bboxes) {
-        return E_MEMORY_ALLOC;
-    }
-    bboxesFromGeoPolygon(geoPolygon, bboxes);
-
-    // Get the estimated number of hexagons and allocate some temporary memory
-    // for the hexagons
-    int64_t numHexagons;
-    H3Error numHexagonsError =
-        H3_EXPORT(maxPolygonToCellsSize)(geoPolygon, res, flags, &numHexagons);
-    if (numHexagonsError) {
-        H3_MEMORY(free)(bboxes);
-        return numHexagonsError;
-    }
-    H3Index *search = H3_MEMORY(calloc)(numHexagons, sizeof(H3Index));
-    if (!search) {
-        H3_MEMORY(free)(bboxes);
-        return E_MEMORY_ALLOC;
-    }
-    H3Index *found = H3_MEMORY(calloc)(numHexagons, sizeof(H3Index));
-    if (!found) {
-        H3_MEMORY(free)(bboxes);
-        H3_MEMORY(free)(search);
-        return E_MEMORY_ALLOC;
-    }
-
+static H3Error _polygonToCellsInternal(const GeoPolygon *geoPolygon, int res,
+                                       H3Index *out, int64_t numHexagons,
+                                       const BBox *bboxes, H3Index *search,
+                                       H3Index *found) {
     // Some metadata for tracking the state of the search and found memory
     // blocks
     int64_t numSearchHexes = 0;
@@ -1053,9 +1055,6 @@ H3Error H3_EXPORT(polygonToCells)(const GeoPolygon *geoPolygon, int res,
     // If this branch is reached, we have exceeded the maximum number of
     // hexagons possible and need to clean up the allocated memory.
     if (edgeHexError) {
-        H3_MEMORY(free)(search);
-        H3_MEMORY(free)(found);
-        H3_MEMORY(free)(bboxes);
         return edgeHexError;
     }
 
@@ -1071,9 +1070,6 @@ H3Error H3_EXPORT(polygonToCells)(const GeoPolygon *geoPolygon, int res,
         // If this branch is reached, we have exceeded the maximum number of
         // hexagons possible and need to clean up the allocated memory.
         if (edgeHexError) {
-            H3_MEMORY(free)(search);
-            H3_MEMORY(free)(found);
-            H3_MEMORY(free)(bboxes);
             return edgeHexError;
         }
     }
@@ -1111,9 +1107,6 @@ H3Error H3_EXPORT(polygonToCells)(const GeoPolygon *geoPolygon, int res,
                     // allocated memory.
                     // TODO: Reachable via fuzzer
                     if (loopCount > numHexagons) {
-                        H3_MEMORY(free)(search);
-                        H3_MEMORY(free)(found);
-                        H3_MEMORY(free)(bboxes);
                         return E_FAILED;
                     }
                     if (out[loc] == hex) break;  // Skip duplicates found
@@ -1155,12 +1148,165 @@ H3Error H3_EXPORT(polygonToCells)(const GeoPolygon *geoPolygon, int res,
         // Repeat until no new hexagons are found
     }
     // The out memory structure should be complete, end it here
+    return E_SUCCESS;
+}
+
+/**
+ * polygonToCells takes a given GeoJSON-like data structure and preallocated,
+ * zeroed memory, and fills it with the hexagons that are contained by
+ * the GeoJSON-like data structure.
+ *
+ * This implementation traces the GeoJSON geoloop(s) in cartesian space with
+ * hexagons, tests them and their neighbors to be contained by the geoloop(s),
+ * and then any newly found hexagons are used to test again until no new
+ * hexagons are found.
+ *
+ * @param geoPolygon The geoloop and holes defining the relevant area
+ * @param res The Hexagon resolution (0-15)
+ * @param out The slab of zeroed memory to write to. Assumed to be big enough.
+ */
+H3Error H3_EXPORT(polygonToCells)(const GeoPolygon *geoPolygon, int res,
+                                  uint32_t flags, H3Index *out) {
+    H3Error flagErr = validatePolygonFlags(flags);
+    if (flagErr) {
+        return flagErr;
+    }
+    // One of the goals of the polygonToCells algorithm is that two adjacent
+    // polygons with zero overlap have zero overlapping hexagons. That the
+    // hexagons are uniquely assigned. There are a few approaches to take here,
+    // such as deciding based on which polygon has the greatest overlapping area
+    // of the hexagon, or the most number of contained points on the hexagon
+    // (using the center point as a tiebreaker).
+    //
+    // But if the polygons are convex, both of these more complex algorithms can
+    // be reduced down to checking whether or not the center of the hexagon is
+    // contained in the polygon, and so this is the approach that this
+    // polygonToCells algorithm will follow, as it's simpler, faster, and the
+    // error for concave polygons is still minimal (only affecting concave
+    // shapes on the order of magnitude of the hexagon size or smaller, not
+    // impacting larger concave shapes)
+    //
+    // This first part is identical to the maxPolygonToCellsSize above.
+
+    // Get the bounding boxes for the polygon and any holes
+    BBox *bboxes = H3_MEMORY(malloc)((geoPolygon->numHoles + 1) * sizeof(BBox));
+    if (!bboxes) {
+        return E_MEMORY_ALLOC;
+    }
+    bboxesFromGeoPolygon(geoPolygon, bboxes);
+
+    // Get the estimated number of hexagons and allocate some temporary memory
+    // for the hexagons
+    int64_t numHexagons;
+    H3Error numHexagonsError =
+        H3_EXPORT(maxPolygonToCellsSize)(geoPolygon, res, flags, &numHexagons);
+    if (numHexagonsError) {
+        H3_MEMORY(free)(bboxes);
+        return numHexagonsError;
+    }
+    H3Index *search = H3_MEMORY(calloc)(numHexagons, sizeof(H3Index));
+    if (!search) {
+        H3_MEMORY(free)(bboxes);
+        return E_MEMORY_ALLOC;
+    }
+    H3Index *found = H3_MEMORY(calloc)(numHexagons, sizeof(H3Index));
+    if (!found) {
+        H3_MEMORY(free)(bboxes);
+        H3_MEMORY(free)(search);
+        return E_MEMORY_ALLOC;
+    }
+
+    H3Error err = _polygonToCellsInternal(geoPolygon, res, out, numHexagons,
+                                          bboxes, search, found);
     H3_MEMORY(free)(bboxes);
     H3_MEMORY(free)(search);
     H3_MEMORY(free)(found);
+    return err;
+}
+
+/**
+ * Finds both the number of hexagons from maxPolygonToCellsSize and the size
+ * in bytes of the workspace for polygonToCellsWithWorkspace, with one sizing
+ * pass over the polygon.
+ */
+static H3Error _polygonToCellsWorkspaceSize(const GeoPolygon *geoPolygon,
+                                            int res, uint32_t flags,
+                                            int64_t *numHexagons,
+                                            int64_t *size) {
+    H3Error flagErr = validatePolygonFlags(flags);
+    if (flagErr) {
+        return flagErr;
+    }
+    H3Error err =
+        H3_EXPORT(maxPolygonToCellsSize)(geoPolygon, res, flags, numHexagons);
+    if (err) {
+        return err;
+    }
+    // Bounding boxes, followed by the search and found arrays
+    int64_t bboxesSize = (geoPolygon->numHoles + 1) * (int64_t)sizeof(BBox);
+    if (*numHexagons >
+        (INT64_MAX - bboxesSize) / (2 * (int64_t)sizeof(H3Index))) {
+        return E_MEMORY_BOUNDS;
+    }
+    *size = bboxesSize + 2 * *numHexagons * (int64_t)sizeof(H3Index);
     return E_SUCCESS;
 }
 
+/**
+ * polygonToCellsWorkspaceSize returns the size in bytes of the workspace
+ * needed by polygonToCellsWithWorkspace.
+ *
+ * @param geoPolygon The geoloop and holes defining the relevant area
+ * @param res The Hexagon resolution (0-15)
+ * @param flags Algorithm flags such as containment mode
+ * @param out Size of the workspace in bytes
+ */
+H3Error H3_EXPORT(polygonToCellsWorkspaceSize)(const GeoPolygon *geoPolygon,
+                                               int res, uint32_t flags,
+                                               int64_t *out) {
+    int64_t numHexagons;
+    return _polygonToCellsWorkspaceSize(geoPolygon, res, flags, &numHexagons,
+                                        out);
+}
+
+/**
+ * polygonToCellsWithWorkspace is polygonToCells using caller-owned scratch
+ * memory, so it makes no allocations. A workspace can be reused across calls.
+ *
+ * @param geoPolygon The geoloop and holes defining the relevant area
+ * @param res The Hexagon resolution (0-15)
+ * @param flags Algorithm flags such as containment mode
+ * @param out The slab of zeroed memory to write to. Assumed to be big enough.
+ * @param workspace Scratch memory, aligned as if returned by malloc
+ * @param workspaceSize Size of `workspace` in bytes, at least
+ * polygonToCellsWorkspaceSize for the same arguments
+ * @return E_SUCCESS on success, or E_MEMORY_BOUNDS if the workspace is too
+ * small
+ */
+H3Error H3_EXPORT(polygonToCellsWithWorkspace)(const GeoPolygon *geoPolygon,
+                                               int res, uint32_t flags,
+                                               H3Index *out, void *workspace,
+                                               int64_t workspaceSize) {
+    int64_t numHexagons;
+    int64_t neededSize;
+    H3Error err = _polygonToCellsWorkspaceSize(geoPolygon, res, flags,
+                                               &numHexagons, &neededSize);
+    if (err) {
+        return err;
+    }
+    if (workspaceSize < neededSize) {
+        return E_MEMORY_BOUNDS;
+    }
+
+    BBox *bboxes = workspace;
+    H3Index *search = (H3Index *)(bboxes + geoPolygon->numHoles + 1);
+    H3Index *found = search + numHexagons;
+    bboxesFromGeoPolygon(geoPolygon, bboxes);
+    memset(search, 0, 2 * numHexagons * sizeof(H3Index));
+    return _polygonToCellsInternal(geoPolygon, res, out, numHexagons, bboxes,
+                                   search, found);
+}
+
 /**
  * Create a LinkedGeoPolygon describing the outline(s) of a set of  hexagons.
  * Polygon outlines will follow GeoJSON MultiPolygon order: Each polygon will
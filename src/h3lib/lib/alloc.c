@@ -0,0 +1,94 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file alloc.c
+ * @brief   Dispatch of allocations to the calling thread's allocator
+ */
+
+#include "alloc.h"
+
+#include <stdlib.h>
+
+#ifdef H3_THREAD_ALLOCATOR
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define THREAD_LOCAL _Thread_local
+#elif defined(__GNUC__)
+#define THREAD_LOCAL __thread
+#elif defined(_MSC_VER)
+#define THREAD_LOCAL __declspec(thread)
+#else
+#error "ENABLE_THREAD_ALLOCATOR requires thread local storage"
+#endif
+
+/** Allocator set by setThreadAllocator, or NULL for the default */
+static THREAD_LOCAL const H3Allocator *threadAllocator = NULL;
+
+/**
+ * Set the allocator used by H3 functions called from this thread, such as
+ * compactCells, polygonToCells and cellsToMultiPolygon. Memory returned to the
+ * caller (e.g. by cellsToMultiPolygon) must be freed while the same allocator
+ * is set. Parallel algorithms use the calling thread's allocator on their
+ * worker threads, so it must be thread safe if they use more than one
+ * thread.
+ *
+ * @param allocator Allocator to use, or NULL for the default functions.
+ *                  Must remain valid while it is set.
+ * @return The previously set allocator, or NULL, so it can be restored
+ */
+const H3Allocator *H3_EXPORT(setThreadAllocator)(const H3Allocator *allocator) {
+    const H3Allocator *previous = threadAllocator;
+    threadAllocator = allocator;
+    return previous;
+}
+
+const H3Allocator *H3_EXPORT(getThreadAllocator)(void) {
+    return threadAllocator;
+}
+
+void *H3_MEMORY(malloc)(size_t size) {
+    const H3Allocator *allocator = threadAllocator;
+    if (allocator) {
+        return allocator->mallocFn(allocator->context, size);
+    }
+    return H3_BASE_MEMORY(malloc)(size);
+}
+
+void *H3_MEMORY(calloc)(size_t num, size_t size) {
+    const H3Allocator *allocator = threadAllocator;
+    if (allocator) {
+        return allocator->callocFn(allocator->context, num, size);
+    }
+    return H3_BASE_MEMORY(calloc)(num, size);
+}
+
+void *H3_MEMORY(realloc)(void *ptr, size_t size) {
+    const H3Allocator *allocator = threadAllocator;
+    if (allocator) {
+        return allocator->reallocFn(allocator->context, ptr, size);
+    }
+    return H3_BASE_MEMORY(realloc)(ptr, size);
+}
+
+void H3_MEMORY(free)(void *ptr) {
+    const H3Allocator *allocator = threadAllocator;
+    if (allocator) {
+        allocator->freeFn(allocator->context, ptr);
+        return;
+    }
+    H3_BASE_MEMORY(free)(ptr);
+}
+
+#endif
@@ -0,0 +1,161 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file arena.c
+ * @brief   Bump allocator for output that is freed all at once
+ */
+
+#include "arena.h"
+
+#include "alloc.h"
+
+static inline uint8_t *blockData(ArenaBlock *block) {
+    return (uint8_t *)(block + 1);
+}
+
+/**
+ * Initialize an arena. Allocations are made from `buffer` first, if given,
+ * and then from blocks allocated as needed. The caller keeps ownership of
+ * `buffer`, which must outlive the arena's allocations.
+ *
+ * @param arena Arena to initialize
+ * @param buffer Optional caller-provided memory, or NULL
+ * @param size Size of `buffer` in bytes
+ */
+void H3_EXPORT(initArena)(Arena *arena, void *buffer, size_t size) {
+    *arena = (Arena){.base = buffer,
+                     .capacity = buffer ? size : 0,
+                     .buffer = buffer,
+                     .bufferSize = buffer ? size : 0};
+}
+
+/**
+ * Allocate `size` bytes, aligned to ARENA_ALIGNMENT. Grows the arena with a
+ * new block, at least twice the size of the current region, when the current
+ * region is full.
+ *
+ * @return Pointer to the allocation, or NULL if a block could not be
+ * allocated
+ */
+void *arenaAlloc(Arena *arena, size_t size) {
+    if (arena->base) {
+        uintptr_t next = (uintptr_t)(arena->base + arena->used);
+        size_t pad = (ARENA_ALIGNMENT - next % ARENA_ALIGNMENT) %
+                     ARENA_ALIGNMENT;
+        size_t available = arena->capacity - arena->used;
+        if (pad <= available && size <= available - pad) {
+            void *ptr = arena->base + arena->used + pad;
+            arena->used += pad + size;
+            return ptr;
+        }
+    }
+
+    size_t capacity = ARENA_MIN_BLOCK_SIZE;
+    if (arena->capacity > capacity && arena->capacity <= SIZE_MAX / 2) {
+        capacity = arena->capacity * 2;
+    }
+    if (size > capacity) {
+        capacity = size;
+    }
+    // Leave room to align the first allocation
+    if (capacity > SIZE_MAX - sizeof(ArenaBlock) - ARENA_ALIGNMENT) {
+        return NULL;
+    }
+    capacity += ARENA_ALIGNMENT;
+
+    ArenaBlock *block = H3_MEMORY(malloc)(sizeof(ArenaBlock) + capacity);
+    if (!block) {
+        return NULL;
+    }
+    block->next = arena->blocks;
+    block->capacity = capacity;
+    arena->blocks = block;
+    arena->base = blockData(block);
+    arena->used = 0;
+    arena->capacity = capacity;
+
+    return arenaAlloc(arena, size);
+}
+
+/**
+ * Shrink an allocation from `oldSize` to `newSize` bytes, returning the
+ * space to the arena if it was the most recent allocation. Otherwise the
+ * allocation keeps its original size.
+ */
+void arenaShrinkLast(Arena *arena, void *ptr, size_t oldSize, size_t newSize) {
+    if ((uint8_t *)ptr + oldSize == arena->base + arena->used &&
+        newSize <= oldSize) {
+        arena->used -= oldSize - newSize;
+    }
+}
+
+/** Record the current position of an arena */
+ArenaMark arenaMark(const Arena *arena) {
+    return (ArenaMark){.base = arena->base,
+                       .used = arena->used,
+                       .capacity = arena->capacity,
+                       .blocks = arena->blocks};
+}
+
+/**
+ * Undo all allocations made since `mark` was taken, freeing blocks allocated
+ * since then.
+ */
+void rewindArena(Arena *arena, ArenaMark mark) {
+    while (arena->blocks != mark.blocks) {
+        ArenaBlock *next = arena->blocks->next;
+        H3_MEMORY(free)(arena->blocks);
+        arena->blocks = next;
+    }
+    arena->base = mark.base;
+    arena->used = mark.used;
+    arena->capacity = mark.capacity;
+}
+
+/**
+ * Free all allocations in an arena. The newest block is kept for later
+ * allocations, so an arena reused for similar work stops allocating once it
+ * has grown large enough.
+ */
+void H3_EXPORT(resetArena)(Arena *arena) {
+    ArenaBlock *keep = arena->blocks;
+    if (!keep) {
+        arena->base = arena->buffer;
+        arena->used = 0;
+        arena->capacity = arena->bufferSize;
+        return;
+    }
+    ArenaBlock *block = keep->next;
+    while (block) {
+        ArenaBlock *next = block->next;
+        H3_MEMORY(free)(block);
+        block = next;
+    }
+    keep->next = NULL;
+    arena->base = blockData(keep);
+    arena->used = 0;
+    arena->capacity = keep->capacity;
+}
+
+/**
+ * Free all memory allocated by an arena. The arena can be used again,
+ * starting from its caller-provided buffer.
+ */
+void H3_EXPORT(destroyArena)(Arena *arena) {
+    rewindArena(arena, (ArenaMark){.base = arena->buffer,
+                                   .used = 0,
+                                   .capacity = arena->bufferSize,
+                                   .blocks = NULL});
+}
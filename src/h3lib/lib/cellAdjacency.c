@@ -0,0 +1,239 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file cellAdjacency.c
+ * @brief   Adjacency graphs of cell sets in compressed sparse row form
+ */
+
+#include "cellAdjacency.h"
+
+#include "alloc.h"
+#include "h3Index.h"
+
+/** A cell and its index in the input, sorted by cell for lookups */
+typedef struct {
+    H3Index cell;
+    int64_t index;
+} IndexedCell;
+
+/**
+ * Sorts cells by index with a least significant digit radix sort, one byte
+ * at a time, skipping the bytes that all cells share (such as the mode and
+ * resolution). Cells of a set are mostly alike in their high bytes, so this
+ * is a few linear passes instead of a comparison sort.
+ *
+ * @param cells Cells to sort
+ * @param scratch Room for numCells cells
+ * @return cells or scratch, whichever holds the sorted cells
+ */
+static IndexedCell *_radixSort(IndexedCell *cells, IndexedCell *scratch,
+                               int64_t numCells) {
+    int64_t counts[8][256] = {{0}};
+    for (int64_t i = 0; i < numCells; i++) {
+        for (int b = 0; b < 8; b++) {
+            counts[b][(cells[i].cell >> (8 * b)) & 0xff]++;
+        }
+    }
+    IndexedCell *from = cells;
+    IndexedCell *to = scratch;
+    for (int b = 0; b < 8; b++) {
+        int64_t *count = counts[b];
+        if (numCells == 0 ||
+            count[(from[0].cell >> (8 * b)) & 0xff] == numCells) {
+            continue;
+        }
+        int64_t offset = 0;
+        for (int v = 0; v < 256; v++) {
+            int64_t c = count[v];
+            count[v] = offset;
+            offset += c;
+        }
+        for (int64_t i = 0; i < numCells; i++) {
+            to[count[(from[i].cell >> (8 * b)) & 0xff]++] = from[i];
+        }
+        IndexedCell *swap = from;
+        from = to;
+        to = swap;
+    }
+    return from;
+}
+
+/**
+ * Position of the first of the sorted cells not less than a cell. The search
+ * gallops out from a hint position, since neighbors are usually close to
+ * each other in index order: siblings are within 6 positions.
+ */
+static int64_t _searchCells(const H3Index *sorted, int64_t numCells,
+                            int64_t hint, H3Index cell) {
+    int64_t lo, hi;
+    if (hint < numCells && sorted[hint] < cell) {
+        // Find hi past the cell, then search (lo, hi]
+        lo = hint;
+        int64_t step = 1;
+        while (lo + step < numCells && sorted[lo + step] < cell) {
+            lo += step;
+            step *= 2;
+        }
+        hi = lo + step < numCells ? lo + step : numCells;
+        lo++;
+    } else {
+        hi = hint;
+        int64_t step = 1;
+        while (hi - step >= 0 && sorted[hi - step] >= cell) {
+            hi -= step;
+            step *= 2;
+        }
+        lo = hi - step >= 0 ? hi - step + 1 : 0;
+    }
+    while (lo < hi) {
+        int64_t mid = lo + (hi - lo) / 2;
+        if (sorted[mid] < cell) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * Builds the adjacency graph of a set of cells: for each cell, the indexes
+ * of its neighbors that are also in the set, in the order of the directed
+ * edges from originToDirectedEdges. Neighbors are looked up in one sorted
+ * copy of the cells, instead of a hash table of the set.
+ *
+ * Each neighboring pair gives an edge in both directions, so the graph is
+ * symmetric. Cells of different resolutions are never neighbors.
+ *
+ * @param cells Cells of the graph, without duplicates
+ * @param numCells Number of cells
+ * @param withEdgeLengths Whether to compute edgeLengths with edgeLengthRads
+ * @param out The graph, to free with destroyCellAdjacency
+ * @return E_SUCCESS, E_CELL_INVALID for an invalid cell, E_DUPLICATE_INPUT
+ * for a repeated cell, E_DOMAIN for a negative count, or E_MEMORY_ALLOC
+ */
+H3Error H3_EXPORT(cellsToAdjacency)(const H3Index *cells, int64_t numCells,
+                                    bool withEdgeLengths,
+                                    CellAdjacency *out) {
+    if (numCells < 0) {
+        return E_DOMAIN;
+    }
+    for (int64_t i = 0; i < numCells; i++) {
+        if (!H3_EXPORT(isValidCell)(cells[i])) {
+            return E_CELL_INVALID;
+        }
+    }
+
+    size_t capacity = (numCells ? numCells : 1) * 6;
+    IndexedCell *buffers =
+        H3_MEMORY(malloc)((numCells ? numCells : 1) * 2 * sizeof(IndexedCell));
+    CellAdjacency adj = {
+        .numCells = numCells,
+        .numEdges = 0,
+        .offsets = H3_MEMORY(malloc)((numCells + 1) * sizeof(int64_t)),
+        .neighbors = H3_MEMORY(malloc)(capacity * sizeof(int64_t)),
+        .edgeLengths = withEdgeLengths
+                           ? H3_MEMORY(malloc)(capacity * sizeof(double))
+                           : NULL};
+    if (!buffers || !adj.offsets || !adj.neighbors ||
+        (withEdgeLengths && !adj.edgeLengths)) {
+        H3_MEMORY(free)(buffers);
+        H3_EXPORT(destroyCellAdjacency)(&adj);
+        return E_MEMORY_ALLOC;
+    }
+
+    for (int64_t i = 0; i < numCells; i++) {
+        buffers[i] = (IndexedCell){.cell = cells[i], .index = i};
+    }
+    IndexedCell *sorted = _radixSort(buffers, buffers + numCells, numCells);
+    H3Error err = E_SUCCESS;
+    for (int64_t i = 1; i < numCells && !err; i++) {
+        if (sorted[i].cell == sorted[i - 1].cell) {
+            err = E_DUPLICATE_INPUT;
+        }
+    }
+
+    // Split the sorted cells into the keys to search and their indexes in
+    // the input, reusing the sort's scratch space. Also find the position of
+    // each cell in the sorted cells, where the searches for its neighbors
+    // start.
+    IndexedCell *scratch = sorted == buffers ? buffers + numCells : buffers;
+    H3Index *keys = (H3Index *)scratch;
+    int64_t *indexes = (int64_t *)(keys + numCells);
+    for (int64_t s = 0; s < numCells; s++) {
+        keys[s] = sorted[s].cell;
+        indexes[s] = sorted[s].index;
+    }
+    int64_t *positions = (int64_t *)sorted;
+    for (int64_t s = 0; s < numCells; s++) {
+        positions[indexes[s]] = s;
+    }
+
+    for (int64_t i = 0; i < numCells && !err; i++) {
+        adj.offsets[i] = adj.numEdges;
+        H3Index edges[6] = {H3_NULL};
+        err = H3_EXPORT(originToDirectedEdges)(cells[i], edges);
+        for (int e = 0; !err && e < 6; e++) {
+            H3Index destination;
+            if (edges[e] == H3_NULL ||
+                H3_EXPORT(getDirectedEdgeDestination)(edges[e],
+                                                      &destination)) {
+                continue;
+            }
+            int64_t found =
+                _searchCells(keys, numCells, positions[i], destination);
+            if (found == numCells || keys[found] != destination) {
+                continue;
+            }
+            if (withEdgeLengths) {
+                err = H3_EXPORT(edgeLengthRads)(
+                    edges[e], &adj.edgeLengths[adj.numEdges]);
+            }
+            adj.neighbors[adj.numEdges++] = indexes[found];
+        }
+    }
+    adj.offsets[numCells] = adj.numEdges;
+    H3_MEMORY(free)(buffers);
+    if (err) {
+        H3_EXPORT(destroyCellAdjacency)(&adj);
+        return err;
+    }
+
+    // Give back the room for the neighbors outside the set
+    if (adj.numEdges > 0) {
+        int64_t *neighbors = H3_MEMORY(realloc)(
+            adj.neighbors, adj.numEdges * sizeof(int64_t));
+        if (neighbors) adj.neighbors = neighbors;
+        if (withEdgeLengths) {
+            double *edgeLengths = H3_MEMORY(realloc)(
+                adj.edgeLengths, adj.numEdges * sizeof(double));
+            if (edgeLengths) adj.edgeLengths = edgeLengths;
+        }
+    }
+    *out = adj;
+    return E_SUCCESS;
+}
+
+/**
+ * Frees the memory held by a CellAdjacency.
+ */
+void H3_EXPORT(destroyCellAdjacency)(CellAdjacency *adjacency) {
+    H3_MEMORY(free)(adjacency->edgeLengths);
+    H3_MEMORY(free)(adjacency->neighbors);
+    H3_MEMORY(free)(adjacency->offsets);
+    adjacency->edgeLengths = NULL;
+    adjacency->neighbors = NULL;
+    adjacency->offsets = NULL;
+}
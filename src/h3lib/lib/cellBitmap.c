@@ -0,0 +1,368 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file cellBitmap.c
+ * @brief   Dense sets of the descendants of a cell, one bit per cell
+ *
+ * Cells are stored by their position among the descendants of the parent
+ * (see cellToChildPos). Positions follow the children order, so the
+ * descendants of any cell in between are a contiguous range of bits, which
+ * makes adding compacted cells and compacting the set range operations.
+ */
+
+#include "cellBitmap.h"
+
+#include <stdbool.h>
+
+#include "alloc.h"
+#include "h3Assert.h"
+#include "h3Index.h"
+
+/** Range of bits of the descendants of a cell: [start, start + size) */
+typedef struct {
+    int64_t start;
+    int64_t size;
+} BitRange;
+
+/** Whether a range of bits is fully set, fully clear, or neither */
+typedef enum { RANGE_CLEAR, RANGE_SET, RANGE_MIXED } RangeState;
+
+/**
+ * Finds the range of bits of a cell, which must be a descendant of the
+ * parent no finer than the set's resolution.
+ */
+static H3Error _cellRange(const CellBitmap *bitmap, H3Index cell,
+                          BitRange *range) {
+    int parentRes = H3_GET_RESOLUTION(bitmap->parent);
+    int cellRes = H3_GET_RESOLUTION(cell);
+    if (cellRes < parentRes || cellRes > bitmap->res) {
+        return E_RES_MISMATCH;
+    }
+    H3Index parent;
+    H3Error err = H3_EXPORT(cellToParent)(cell, parentRes, &parent);
+    if (NEVER(err)) {
+        return err;
+    }
+    if (parent != bitmap->parent) {
+        return E_DOMAIN;
+    }
+    H3Index first;
+    err = H3_EXPORT(cellToCenterChild)(cell, bitmap->res, &first);
+    if (NEVER(err)) {
+        return err;
+    }
+    err = H3_EXPORT(cellToChildPos)(first, parentRes, &range->start);
+    if (err) {
+        return err;
+    }
+    return H3_EXPORT(cellToChildrenSize)(cell, bitmap->res, &range->size);
+}
+
+/** Mask of the bits from `from` to `to` (exclusive) within a word */
+static inline uint64_t _wordMask(int64_t from, int64_t to) {
+    uint64_t high = to == 64 ? UINT64_MAX : ((uint64_t)1 << to) - 1;
+    return high & ~(((uint64_t)1 << from) - 1);
+}
+
+static void _setRange(uint64_t *words, BitRange range) {
+    int64_t end = range.start + range.size;
+    for (int64_t bit = range.start; bit < end;) {
+        int64_t wordEnd = (bit / 64 + 1) * 64;
+        int64_t to = end < wordEnd ? end : wordEnd;
+        words[bit / 64] |= _wordMask(bit % 64, to - (wordEnd - 64));
+        bit = to;
+    }
+}
+
+static RangeState _rangeState(const uint64_t *words, BitRange range) {
+    int64_t end = range.start + range.size;
+    bool anySet = false;
+    bool anyClear = false;
+    for (int64_t bit = range.start; bit < end;) {
+        int64_t wordEnd = (bit / 64 + 1) * 64;
+        int64_t to = end < wordEnd ? end : wordEnd;
+        uint64_t mask = _wordMask(bit % 64, to - (wordEnd - 64));
+        uint64_t word = words[bit / 64] & mask;
+        anySet |= word != 0;
+        anyClear |= word != mask;
+        if (anySet && anyClear) {
+            return RANGE_MIXED;
+        }
+        bit = to;
+    }
+    return anySet ? RANGE_SET : RANGE_CLEAR;
+}
+
+/** Number of set bits in a word */
+static inline int _popcount(uint64_t x) {
+    x = x - ((x >> 1) & 0x5555555555555555);
+    x = (x & 0x3333333333333333) + ((x >> 2) & 0x3333333333333333);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0F;
+    return (int)((x * 0x0101010101010101) >> 56);
+}
+
+/**
+ * Creates an empty set of the descendants of a cell at a resolution.
+ *
+ * @param parent Cell whose descendants can be in the set
+ * @param res Resolution of the cells in the set
+ * @param out The set, to free with destroyCellBitmap
+ * @return E_SUCCESS, E_CELL_INVALID for an invalid parent, E_RES_DOMAIN if
+ * res is not a child resolution of parent, or E_MEMORY_ALLOC
+ */
+H3Error H3_EXPORT(initCellBitmap)(H3Index parent, int res, CellBitmap *out) {
+    if (!H3_EXPORT(isValidCell)(parent)) {
+        return E_CELL_INVALID;
+    }
+    int64_t numBits;
+    H3Error err = H3_EXPORT(cellToChildrenSize)(parent, res, &numBits);
+    if (err) {
+        return err;
+    }
+    uint64_t *words = H3_MEMORY(calloc)((numBits + 63) / 64, sizeof(uint64_t));
+    if (!words) {
+        return E_MEMORY_ALLOC;
+    }
+    *out = (CellBitmap){
+        .parent = parent, .res = res, .numBits = numBits, .words = words};
+    return E_SUCCESS;
+}
+
+/**
+ * Adds cells to a set. Cells coarser than the set's resolution, as produced
+ * by compactCells, add all of their descendants. H3_NULL entries are skipped.
+ *
+ * Cells before a failing cell are added.
+ *
+ * @param bitmap The set
+ * @param cells Descendants of the set's parent, at its resolution or coarser
+ * @param numCells Number of cells
+ * @return E_SUCCESS, E_RES_MISMATCH for a cell finer than the set or coarser
+ * than its parent, E_DOMAIN for a cell that is not a descendant of the parent
+ * or a negative count, or E_CELL_INVALID for an invalid cell
+ */
+H3Error H3_EXPORT(cellBitmapAddCells)(CellBitmap *bitmap,
+                                      const H3Index *cells, int64_t numCells) {
+    if (numCells < 0) {
+        return E_DOMAIN;
+    }
+    for (int64_t i = 0; i < numCells; i++) {
+        if (cells[i] == H3_NULL) {
+            continue;
+        }
+        BitRange range;
+        H3Error err = _cellRange(bitmap, cells[i], &range);
+        if (err) {
+            return err;
+        }
+        if (range.size == 1) {
+            bitmap->words[range.start / 64] |= (uint64_t)1
+                                               << (range.start % 64);
+        } else {
+            _setRange(bitmap->words, range);
+        }
+    }
+    return E_SUCCESS;
+}
+
+/**
+ * Returns whether a set contains a cell. For a cell coarser than the set's
+ * resolution, this is whether it contains all of its descendants.
+ *
+ * @param bitmap The set
+ * @param cell The cell
+ * @return 1 if the cell is in the set, 0 if not or if it cannot be
+ */
+int H3_EXPORT(cellBitmapContains)(const CellBitmap *bitmap, H3Index cell) {
+    BitRange range;
+    if (_cellRange(bitmap, cell, &range)) {
+        return false;
+    }
+    if (range.size == 1) {
+        return (bitmap->words[range.start / 64] >> (range.start % 64)) & 1;
+    }
+    return _rangeState(bitmap->words, range) == RANGE_SET;
+}
+
+/**
+ * Checks that two sets are of the same cells.
+ */
+static H3Error _checkSameSpace(const CellBitmap *bitmap,
+                               const CellBitmap *other) {
+    if (bitmap->res != other->res) {
+        return E_RES_MISMATCH;
+    }
+    if (bitmap->parent != other->parent) {
+        return E_DOMAIN;
+    }
+    return E_SUCCESS;
+}
+
+/**
+ * Adds the cells of another set to a set.
+ *
+ * @param bitmap The set to add to
+ * @param other The set to add, with the same parent and resolution
+ * @return E_SUCCESS, E_RES_MISMATCH for a different resolution, or E_DOMAIN
+ * for a different parent
+ */
+H3Error H3_EXPORT(cellBitmapUnion)(CellBitmap *bitmap,
+                                   const CellBitmap *other) {
+    H3Error err = _checkSameSpace(bitmap, other);
+    if (err) {
+        return err;
+    }
+    int64_t numWords = (bitmap->numBits + 63) / 64;
+    for (int64_t i = 0; i < numWords; i++) {
+        bitmap->words[i] |= other->words[i];
+    }
+    return E_SUCCESS;
+}
+
+/**
+ * Removes the cells that are not in another set from a set.
+ *
+ * @param bitmap The set to remove from
+ * @param other The set to intersect with, with the same parent and
+ * resolution
+ * @return E_SUCCESS, E_RES_MISMATCH for a different resolution, or E_DOMAIN
+ * for a different parent
+ */
+H3Error H3_EXPORT(cellBitmapIntersect)(CellBitmap *bitmap,
+                                       const CellBitmap *other) {
+    H3Error err = _checkSameSpace(bitmap, other);
+    if (err) {
+        return err;
+    }
+    int64_t numWords = (bitmap->numBits + 63) / 64;
+    for (int64_t i = 0; i < numWords; i++) {
+        bitmap->words[i] &= other->words[i];
+    }
+    return E_SUCCESS;
+}
+
+/**
+ * Returns the number of cells in a set.
+ */
+int64_t H3_EXPORT(cellBitmapCount)(const CellBitmap *bitmap) {
+    int64_t numWords = (bitmap->numBits + 63) / 64;
+    int64_t count = 0;
+    for (int64_t i = 0; i < numWords; i++) {
+        count += _popcount(bitmap->words[i]);
+    }
+    return count;
+}
+
+/**
+ * Writes the cells of a set in child position order, converting the
+ * positions of each word with childPosToCells.
+ *
+ * @param bitmap The set
+ * @param out Output, with room for cellBitmapCount cells
+ * @return E_SUCCESS
+ */
+H3Error H3_EXPORT(cellBitmapToCells)(const CellBitmap *bitmap, H3Index *out) {
+    int64_t numWords = (bitmap->numBits + 63) / 64;
+    int64_t positions[64];
+    int64_t numOut = 0;
+    for (int64_t i = 0; i < numWords; i++) {
+        uint64_t word = bitmap->words[i];
+        int numPositions = 0;
+        for (int bit = 0; word; bit++, word >>= 1) {
+            if (word & 1) {
+                positions[numPositions++] = i * 64 + bit;
+            }
+        }
+        H3Error err = H3_EXPORT(childPosToCells)(positions, numPositions,
+                                                 bitmap->parent, bitmap->res,
+                                                 out + numOut, NULL);
+        if (NEVER(err)) {
+            return err;
+        }
+        numOut += numPositions;
+    }
+    return E_SUCCESS;
+}
+
+/**
+ * Writes the compacted cells of the subtree of a cell, whose descendants
+ * start at bit `start`, recursing only into partially set cells.
+ */
+static H3Error _compactSubtree(const CellBitmap *bitmap, H3Index cell,
+                               int64_t start, H3Index *out, int64_t *numOut) {
+    BitRange range = {.start = start};
+    H3Error err =
+        H3_EXPORT(cellToChildrenSize)(cell, bitmap->res, &range.size);
+    if (NEVER(err)) {
+        return err;
+    }
+    RangeState state = _rangeState(bitmap->words, range);
+    if (state == RANGE_SET) {
+        out[(*numOut)++] = cell;
+        return E_SUCCESS;
+    }
+    if (state == RANGE_CLEAR) {
+        return E_SUCCESS;
+    }
+
+    // Mixed ranges are finer than the set's resolution, so have children.
+    // Each child's descendants follow the previous child's.
+    int childRes = H3_GET_RESOLUTION(cell) + 1;
+    bool cellIsPentagon = H3_EXPORT(isPentagon)(cell);
+    for (int digit = CENTER_DIGIT; digit < NUM_DIGITS; digit++) {
+        if (cellIsPentagon && digit == K_AXES_DIGIT) {
+            continue;
+        }
+        H3Index child = cell;
+        H3_SET_RESOLUTION(child, childRes);
+        H3_SET_INDEX_DIGIT(child, childRes, digit);
+        err = _compactSubtree(bitmap, child, start, out, numOut);
+        if (err) {
+            return err;
+        }
+        int64_t childSize;
+        err = H3_EXPORT(cellToChildrenSize)(child, bitmap->res, &childSize);
+        if (NEVER(err)) {
+            return err;
+        }
+        start += childSize;
+    }
+    return E_SUCCESS;
+}
+
+/**
+ * Writes the cells of a set compacted as by compactCells: any cell all of
+ * whose descendants are in the set is written instead of them. Cells are
+ * written in child position order of their first descendants.
+ *
+ * @param bitmap The set
+ * @param out Output, with room for cellBitmapCount cells
+ * @param numOut Output: number of cells written
+ * @return E_SUCCESS
+ */
+H3Error H3_EXPORT(cellBitmapToCompactCells)(const CellBitmap *bitmap,
+                                            H3Index *out, int64_t *numOut) {
+    *numOut = 0;
+    return _compactSubtree(bitmap, bitmap->parent, 0, out, numOut);
+}
+
+/**
+ * Frees the memory held by a CellBitmap, leaving it empty.
+ */
+void H3_EXPORT(destroyCellBitmap)(CellBitmap *bitmap) {
+    H3_MEMORY(free)(bitmap->words);
+    bitmap->words = NULL;
+    bitmap->numBits = 0;
+}
@@ -1,5 +1,6 @@
 #include "cellsToMultiPoly.h"
 
+#include <math.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -8,8 +9,14 @@
 #include "algos.h"
 #include "alloc.h"
 #include "area.h"
+#include "arena.h"
+#include "constants.h"
 #include "h3Assert.h"
+#include "h3Index.h"
 #include "h3api.h"
+#include "iterators.h"
+#include "parallel.h"
+#include "vec3d.h"
 
 static inline H3Error validateCellSet(const H3Index *cells,
                                       const int64_t numCells) {
@@ -149,24 +156,24 @@ static inline H3Error cellToEdgeArcs(H3Index h, Arc *arcs,
     return E_SUCCESS;
 }
 
+/*
+Create the ArcSet for a set of cells. If `hashMultiplier` is nonzero, also
+build the hash buckets used by `findArc`; otherwise `buckets` is left NULL and
+pairs must be found with `cancelSortedArcPairs`.
+*/
 static H3Error createArcSet(const H3Index *cells, const int64_t numCells,
-                            ArcSet *arcset) {
+                            int64_t hashMultiplier, ArcSet *arcset) {
     int64_t numArcs = getNumEdges(cells, numCells);
-    int64_t numBuckets = numArcs * HASH_TABLE_MULTIPLIER;
+    int64_t numBuckets = numArcs * hashMultiplier;
 
     arcset->numArcs = numArcs;
     arcset->numBuckets = numBuckets;
+    arcset->buckets = NULL;
     arcset->arcs = H3_MEMORY(malloc)(numArcs * sizeof(Arc));
     if (!arcset->arcs) {
         return E_MEMORY_ALLOC;
     }
 
-    arcset->buckets = H3_MEMORY(calloc)(numBuckets, sizeof(Arc *));
-    if (!arcset->buckets) {
-        destroyArcSet(arcset);
-        return E_MEMORY_ALLOC;
-    }
-
     int64_t j = 0;
     for (int64_t i = 0; i < numCells; i++) {
         int64_t numEdges;
@@ -178,6 +185,17 @@ static H3Error createArcSet(const H3Index *cells, const int64_t numCells,
         j += numEdges;
     }
 
+    if (numBuckets == 0) {
+        // No hash table requested; pairs are found by sorting instead
+        return E_SUCCESS;
+    }
+
+    arcset->buckets = H3_MEMORY(calloc)(numBuckets, sizeof(Arc *));
+    if (!arcset->buckets) {
+        destroyArcSet(arcset);
+        return E_MEMORY_ALLOC;
+    }
+
     for (int64_t i = 0; i < arcset->numArcs; i++) {
         // hash edge to initial bucket
         int64_t j = hashEdge(arcset->arcs[i].id, arcset->numBuckets);
@@ -238,6 +256,27 @@ static void unionArcs(Arc *a, Arc *b) {
     }
 }
 
+/*
+Remove a pair of opposite arcs `a` and `b`, where the two loops containing
+them overlap. Merge the loops to maintain valid doubly-linked loops, and merge
+their connected components. Note that the two loops might be the *same* loop,
+and the logic is the same either way.
+*/
+static inline void cancelArcPair(Arc *a, Arc *b) {
+    // mark both as removed
+    a->isRemoved = true;
+    b->isRemoved = true;
+
+    // stitch together loops at removal site
+    a->next->prev = b->prev;
+    a->prev->next = b->next;
+    b->next->prev = a->prev;
+    b->prev->next = a->next;
+
+    // update parent to merge into a single connected component
+    unionArcs(a, b);
+}
+
 /*
 Cancel out pairs of edges in the ArcSet, marking them as isRemoved.
 Update the doubly-linked loop list to maintain valid loops.
@@ -265,25 +304,114 @@ static H3Error cancelArcPairs(ArcSet arcset) {
             continue;
         }
 
-        // If we're at this point, then the two loops overlap at edges
-        // `a` and `b`, which are opposites of each other.
-        // Remove the two edges, and merge the loops to maintain
-        // valid doubly-linked loops. Note that the two loops might be the
-        // *same* loop, and the logic is the same either way.
+        cancelArcPair(a, b);
+    }
+
+    return E_SUCCESS;
+}
+
+/*
+An undirected edge key, and the index of one of its arcs in the ArcSet.
+Both arcs of an interior edge share the same key.
+*/
+typedef struct {
+    H3Index key;
+    int64_t arc;
+} EdgeKey;
+
+/*
+Sort edge keys with an LSD radix sort, one byte at a time. Bytes that are the
+same for every key (e.g. mode and resolution bits) are skipped. `scratch` must
+be the same size as `keys`.
+*/
+static void radixSortEdgeKeys(EdgeKey *keys, EdgeKey *scratch, int64_t n) {
+    EdgeKey *src = keys;
+    EdgeKey *dst = scratch;
+    for (int shift = 0; shift < 64; shift += 8) {
+        int64_t offsets[256] = {0};
+        for (int64_t i = 0; i < n; i++) {
+            offsets[(src[i].key >> shift) & 0xff]++;
+        }
+        if (offsets[(src[0].key >> shift) & 0xff] == n) {
+            // All keys share this byte
+            continue;
+        }
+        int64_t total = 0;
+        for (int b = 0; b < 256; b++) {
+            int64_t count = offsets[b];
+            offsets[b] = total;
+            total += count;
+        }
+        for (int64_t i = 0; i < n; i++) {
+            dst[offsets[(src[i].key >> shift) & 0xff]++] = src[i];
+        }
+        EdgeKey *tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+    if (src != keys) {
+        memcpy(keys, src, n * sizeof(EdgeKey));
+    }
+}
+
+/*
+Cancel out pairs of edges in an ArcSet built without hash buckets.
+
+Each arc is keyed by the smaller of its directed edge and the reversed edge,
+so both arcs of an interior edge get the same key. Sorting the keys puts the
+pairs next to each other, where they are found in a single linear pass.
+Pairs are then cancelled in arc order, the same order used by cancelArcPairs,
+so both produce identical loops.
+*/
+static H3Error cancelSortedArcPairs(ArcSet arcset) {
+    int64_t numArcs = arcset.numArcs;
+    EdgeKey *keys = H3_MEMORY(malloc)(numArcs * sizeof(EdgeKey));
+    if (!keys) {
+        return E_MEMORY_ALLOC;
+    }
+    EdgeKey *scratch = H3_MEMORY(malloc)(numArcs * sizeof(EdgeKey));
+    if (!scratch) {
+        H3_MEMORY(free)(keys);
+        return E_MEMORY_ALLOC;
+    }
 
-        // mark both as removed
-        a->isRemoved = true;
-        b->isRemoved = true;
+    for (int64_t i = 0; i < numArcs; i++) {
+        H3Index edge = arcset.arcs[i].id;
+        H3Index reversedEdge;
+        H3Error err = H3_EXPORT(reverseDirectedEdge)(edge, &reversedEdge);
+        if (NEVER(err)) {
+            H3_MEMORY(free)(keys);
+            H3_MEMORY(free)(scratch);
+            return err;
+        }
+        keys[i].key = edge < reversedEdge ? edge : reversedEdge;
+        keys[i].arc = i;
+    }
 
-        // stitch together loops at removal site
-        a->next->prev = b->prev;
-        a->prev->next = b->next;
-        b->next->prev = a->prev;
-        b->prev->next = a->next;
+    radixSortEdgeKeys(keys, scratch, numArcs);
 
-        // update parent to merge into a single connected component
-        unionArcs(a, b);
+    // Reuse the scratch space to record the partner of each arc, or -1
+    int64_t *partners = (int64_t *)scratch;
+    for (int64_t i = 0; i < numArcs; i++) {
+        partners[i] = -1;
     }
+    for (int64_t i = 0; i + 1 < numArcs; i++) {
+        if (keys[i].key == keys[i + 1].key) {
+            partners[keys[i].arc] = keys[i + 1].arc;
+            partners[keys[i + 1].arc] = keys[i].arc;
+            i++;
+        }
+    }
+    H3_MEMORY(free)(keys);
+
+    for (int64_t i = 0; i < numArcs; i++) {
+        Arc *a = &arcset.arcs[i];
+        if (a->isRemoved || partners[i] < 0) {
+            continue;
+        }
+        cancelArcPair(a, &arcset.arcs[partners[i]]);
+    }
+    H3_MEMORY(free)(scratch);
 
     return E_SUCCESS;
 }
@@ -316,12 +444,150 @@ static int64_t countLoops(ArcSet arcset) {
     return numLoops;
 }
 
-// Starting from a given Arc, create a SortableLoop that contains that Arc
-// SortableLoops are sorted by the root (i.e., connected component) and then
-// by the area contained by the loop. We use this to merge all loops in a
-// connected component into a single polygon. We use the area values to
-// determine which loop will be the "outer" loop of the polygon.
-static H3Error createSortableLoop(Arc *arc, SortableLoop *sloop) {
+/*
+Angular distance, in radians, from point `p` to the great circle arc from `a`
+to `b`, all unit vectors.
+*/
+static double pointToArcDistance(Vec3d p, Vec3d a, Vec3d b) {
+    Vec3d n = vec3Cross(a, b);
+    double nNorm = vec3Norm(n);
+    if (nNorm > EPSILON &&
+        vec3Dot(vec3Cross(a, p), n) >= 0 && vec3Dot(vec3Cross(p, b), n) >= 0) {
+        // `p` projects onto the arc, so the distance is to the great circle
+        double s = fabs(vec3Dot(p, n)) / nNorm;
+        return asin(s < 1.0 ? s : 1.0);
+    }
+    // Otherwise the closest point is an endpoint
+    double da = atan2(vec3Norm(vec3Cross(p, a)), vec3Dot(p, a));
+    double db = atan2(vec3Norm(vec3Cross(p, b)), vec3Dot(p, b));
+    return da < db ? da : db;
+}
+
+/*
+Simplify a loop in place with the Douglas-Peucker algorithm on the unit
+sphere: every removed vertex is within `tolerance` radians of the simplified
+loop. The loop is split at its first vertex and the vertex farthest from it,
+and each half is simplified with an explicit stack. At least 3 vertexes are
+kept.
+*/
+static H3Error simplifyGeoLoop(GeoLoop *loop, double tolerance) {
+    int64_t numVerts = loop->numVerts;
+    if (numVerts <= 3) {
+        return E_SUCCESS;
+    }
+
+    Vec3d *points = H3_MEMORY(malloc)(numVerts * sizeof(Vec3d));
+    bool *keep = H3_MEMORY(calloc)(numVerts + 1, sizeof(bool));
+    // Each stack entry is a pair of indexes into `points`; index `numVerts`
+    // refers back to the first vertex
+    int64_t *stack = H3_MEMORY(malloc)(2 * numVerts * sizeof(int64_t));
+    if (!points || !keep || !stack) {
+        H3_MEMORY(free)(points);
+        H3_MEMORY(free)(keep);
+        H3_MEMORY(free)(stack);
+        return E_MEMORY_ALLOC;
+    }
+
+    for (int64_t i = 0; i < numVerts; i++) {
+        points[i] = latLngToVec3(loop->verts[i]);
+    }
+
+    int64_t far = 1;
+    double farDist = -1;
+    for (int64_t i = 1; i < numVerts; i++) {
+        double d = vec3DistSq(points[0], points[i]);
+        if (d > farDist) {
+            far = i;
+            farDist = d;
+        }
+    }
+    keep[0] = true;
+    keep[far] = true;
+
+    int64_t top = 0;
+    stack[top++] = 0;
+    stack[top++] = far;
+    stack[top++] = far;
+    stack[top++] = numVerts;
+    while (top > 0) {
+        int64_t last = stack[--top];
+        int64_t first = stack[--top];
+        Vec3d a = points[first];
+        Vec3d b = points[last % numVerts];
+
+        int64_t split = -1;
+        double splitDist = tolerance;
+        for (int64_t i = first + 1; i < last; i++) {
+            double d = pointToArcDistance(points[i], a, b);
+            if (d > splitDist) {
+                split = i;
+                splitDist = d;
+            }
+        }
+        if (split >= 0) {
+            keep[split] = true;
+            stack[top++] = first;
+            stack[top++] = split;
+            stack[top++] = split;
+            stack[top++] = last;
+        }
+    }
+
+    int64_t numKept = 0;
+    for (int64_t i = 0; i < numVerts; i++) {
+        numKept += keep[i];
+    }
+    if (numKept < 3) {
+        // Everything is within tolerance of the segment from the first to the
+        // farthest vertex; keep the vertex farthest from it as well
+        int64_t split = 1;
+        double splitDist = -1;
+        for (int64_t i = 1; i < numVerts; i++) {
+            double d = pointToArcDistance(points[i], points[0], points[far]);
+            if (i != far && d > splitDist) {
+                split = i;
+                splitDist = d;
+            }
+        }
+        keep[split] = true;
+    }
+
+    int64_t j = 0;
+    for (int64_t i = 0; i < numVerts; i++) {
+        if (keep[i]) {
+            loop->verts[j++] = loop->verts[i];
+        }
+    }
+    loop->numVerts = j;
+
+    H3_MEMORY(free)(points);
+    H3_MEMORY(free)(keep);
+    H3_MEMORY(free)(stack);
+    return E_SUCCESS;
+}
+
+// Allocate memory that ends up in the output GeoMultiPolygon: from `arena` if
+// given, otherwise from the heap, to be freed by destroyGeoMultiPolygon.
+static inline void *allocOutput(Arena *arena, size_t size) {
+    return arena ? arenaAlloc(arena, size) : H3_MEMORY(malloc)(size);
+}
+
+// Free output memory after an error. Arena memory is instead released by the
+// caller rewinding the arena.
+static inline void freeOutput(Arena *arena, void *ptr) {
+    if (!arena) {
+        H3_MEMORY(free)(ptr);
+    }
+}
+
+// Starting from a given Arc, fill in the vertexes and area of a SortableLoop
+// that contains that Arc. Only touches the arcs of this loop, so loops can be
+// built concurrently; the root is set separately. A positive `tolerance`
+// simplifies the vertexes; the area is always that of the unsimplified loop,
+// so loops are grouped and ordered the same either way. Vertexes are
+// allocated from `arena` if it is not NULL.
+static H3Error createSortableLoopGeometry(Arc *arc, double tolerance,
+                                          Arena *arena, SortableLoop *sloop) {
     CellBoundary gb;
     H3Index start = arc->id;
 
@@ -339,17 +605,18 @@ static H3Error createSortableLoop(Arc *arc, SortableLoop *sloop) {
         arc = arc->next;
     } while (arc->id != start);
 
-    verts = H3_MEMORY(malloc)(sizeof(LatLng) * numVerts);
+    verts = allocOutput(arena, sizeof(LatLng) * numVerts);
     if (!verts) {
         return E_MEMORY_ALLOC;
     }
+    int64_t allocVerts = numVerts;
 
     numVerts = 0;
     int64_t j = 0;
     do {
         H3Error err = H3_EXPORT(directedEdgeToBoundary)(arc->id, &gb);
         if (NEVER(err)) {
-            free(verts);
+            freeOutput(arena, verts);
             return err;
         }
 
@@ -362,25 +629,65 @@ static H3Error createSortableLoop(Arc *arc, SortableLoop *sloop) {
         arc = arc->next;
     } while (arc->id != start);
 
+    GeoLoop loop = {.numVerts = numVerts, .verts = verts};
+    double area;
+    geoLoopAreaRads2(loop, &area);
+
+    if (tolerance > 0) {
+        H3Error err = simplifyGeoLoop(&loop, tolerance);
+        if (err) {
+            freeOutput(arena, verts);
+            return err;
+        }
+    }
+
+    if (arena) {
+        // The vertexes are the last arena allocation, since simplifying
+        // only uses the heap, so the unused space can be returned
+        arenaShrinkLast(arena, verts, sizeof(LatLng) * allocVerts,
+                        sizeof(LatLng) * loop.numVerts);
+        sloop->loop.numVerts = loop.numVerts;
+        sloop->loop.verts = verts;
+        sloop->area = area;
+        return E_SUCCESS;
+    }
+
     // This memory ends up in GeoMultiPolygon, to be freed by caller of
     // cellsToMultiPolygon()
-    LatLng *reallocVerts = H3_MEMORY(realloc)(verts, sizeof(LatLng) * numVerts);
+    LatLng *reallocVerts =
+        H3_MEMORY(realloc)(verts, sizeof(LatLng) * loop.numVerts);
     if (!reallocVerts) {
         H3_MEMORY(free)(verts);
         return E_MEMORY_ALLOC;
     }
-    verts = reallocVerts;
 
-    sloop->root = getRoot(arc)->id;
-    sloop->loop.numVerts = numVerts;
-    sloop->loop.verts = verts;
-    geoLoopAreaRads2(sloop->loop, &sloop->area);
+    sloop->loop.numVerts = loop.numVerts;
+    sloop->loop.verts = reallocVerts;
+    sloop->area = area;
+
+    return E_SUCCESS;
+}
 
+// Starting from a given Arc, create a SortableLoop that contains that Arc
+// SortableLoops are sorted by the root (i.e., connected component) and then
+// by the area contained by the loop. We use this to merge all loops in a
+// connected component into a single polygon. We use the area values to
+// determine which loop will be the "outer" loop of the polygon.
+static H3Error createSortableLoop(Arc *arc, double tolerance, Arena *arena,
+                                  SortableLoop *sloop) {
+    H3Error err = createSortableLoopGeometry(arc, tolerance, arena, sloop);
+    if (err) {
+        return err;
+    }
+    sloop->root = getRoot(arc)->id;
     return E_SUCCESS;
 }
 
-// Create set of all SortableLoops and sort them
-static H3Error createSortableLoopSet(ArcSet arcset, SortableLoopSet *loopset) {
+// Create set of all SortableLoops and sort them, simplifying each loop if
+// `tolerance` is positive. Vertexes are allocated from `arena` if it is not
+// NULL.
+static H3Error createSortableLoopSet(ArcSet arcset, double tolerance,
+                                     Arena *arena, SortableLoopSet *loopset) {
     int64_t numLoops = countLoops(arcset);
     resetVisited(arcset);
     Arc *arcs = arcset.arcs;
@@ -393,12 +700,17 @@ static H3Error createSortableLoopSet(ArcSet arcset, SortableLoopSet *loopset) {
     int64_t j = 0;
     for (int64_t i = 0; i < arcset.numArcs; i++) {
         if (!arcs[i].isVisited && !arcs[i].isRemoved) {
-            H3Error err = createSortableLoop(&arcs[i], &sloops[j]);
+            H3Error err =
+                createSortableLoop(&arcs[i], tolerance, arena, &sloops[j]);
             if (err) {
                 // Free any verts already allocated in previous loops
                 SortableLoopSet partialLoopSet = {.numLoops = j,
                                                   .sloops = sloops};
-                destroySortableLoopSet(&partialLoopSet);
+                if (arena) {
+                    destroySortableLoopSetShallow(&partialLoopSet);
+                } else {
+                    destroySortableLoopSet(&partialLoopSet);
+                }
                 return err;
             }
             j++;
@@ -433,10 +745,10 @@ static int64_t countPolys(SortableLoopSet loopset) {
 // The "outer ring" SortableLoop is first in memory, followed by its holes
 // Later, we sort the Polygons by the size of their outer loops.
 static H3Error createSortablePoly(SortableLoop *sloop, int64_t numHoles,
-                                  SortablePoly *spoly) {
+                                  Arena *arena, SortablePoly *spoly) {
     GeoLoop *holes = NULL;
     if (numHoles > 0) {
-        holes = H3_MEMORY(malloc)(sizeof(GeoLoop) * numHoles);
+        holes = allocOutput(arena, sizeof(GeoLoop) * numHoles);
         if (!holes) {
             return E_MEMORY_ALLOC;
         }
@@ -457,12 +769,14 @@ static H3Error createSortablePoly(SortableLoop *sloop, int64_t numHoles,
  * Allocate a GeoMultiPolygon representing the entire globe.
  * The globe is represented using 8 triangular polygons, with
  * all edge arcs of exactly 90 degrees (i.e., pi/2 radians).
- * Memory should be freed with `destroyGeoMultiPolygon`.
+ * Memory should be freed with `destroyGeoMultiPolygon`, unless it was
+ * allocated from `arena`.
  *
+ * @param arena Arena to allocate the output from, or NULL for the heap
  * @param mpoly Output parameter for the resulting GeoMultiPolygon
  * @return E_SUCCESS on success, E_MEMORY_ALLOC on allocation failure
  */
-static H3Error createGlobeMultiPolygon(GeoMultiPolygon *mpoly) {
+static H3Error createGlobeMultiPolygon(Arena *arena, GeoMultiPolygon *mpoly) {
     const int numPolygons = 8;
     const int numVerts = 3;
     const LatLng verts[8][3] = {
@@ -487,10 +801,10 @@ static H3Error createGlobeMultiPolygon(GeoMultiPolygon *mpoly) {
         poly->numHoles = 0;
         poly->holes = NULL;
         poly->geoloop.numVerts = numVerts;
-        poly->geoloop.verts = H3_MEMORY(malloc)(sizeof(LatLng) * numVerts);
+        poly->geoloop.verts = allocOutput(arena, sizeof(LatLng) * numVerts);
         if (!poly->geoloop.verts) {
             // Free any verts already allocated in previous iterations
-            destroySortablePolyVerts(spolys, i);
+            destroySortablePolyVerts(spolys, arena ? 0 : i);
             return E_MEMORY_ALLOC;
         }
 
@@ -504,9 +818,9 @@ static H3Error createGlobeMultiPolygon(GeoMultiPolygon *mpoly) {
 
     qsort(spolys, numPolygons, sizeof(SortablePoly), cmp_SortablePoly);
 
-    mpoly->polygons = H3_MEMORY(malloc)(sizeof(GeoPolygon) * numPolygons);
+    mpoly->polygons = allocOutput(arena, sizeof(GeoPolygon) * numPolygons);
     if (!mpoly->polygons) {
-        destroySortablePolyVerts(spolys, numPolygons);
+        destroySortablePolyVerts(spolys, arena ? 0 : numPolygons);
         return E_MEMORY_ALLOC;
     }
 
@@ -520,10 +834,12 @@ static H3Error createGlobeMultiPolygon(GeoMultiPolygon *mpoly) {
     return E_SUCCESS;
 }
 
-static H3Error createMultiPolygon(SortableLoopSet loopset,
+// Group the sorted loops into polygons. Holes and the polygon array are
+// allocated from `arena` if it is not NULL.
+static H3Error createMultiPolygon(SortableLoopSet loopset, Arena *arena,
                                   GeoMultiPolygon *mpoly) {
     if (loopset.numLoops == 0) {
-        return createGlobeMultiPolygon(mpoly);
+        return createGlobeMultiPolygon(arena, mpoly);
     }
 
     int64_t numPolys = countPolys(loopset);
@@ -541,9 +857,9 @@ static H3Error createMultiPolygon(SortableLoopSet loopset,
             // We've reached the end of the loops in the polygon, so
             // now construct a polygon from the start of those loops.
             H3Error err =
-                createSortablePoly(&sloop[i], (j - i) - 1, &spolys[p]);
+                createSortablePoly(&sloop[i], (j - i) - 1, arena, &spolys[p]);
             if (err) {
-                destroySortablePolys(spolys, p);
+                destroySortablePolys(spolys, arena ? 0 : p);
                 return err;
             }
             p++;
@@ -556,9 +872,9 @@ static H3Error createMultiPolygon(SortableLoopSet loopset,
     // Hawaiian islands
     qsort(spolys, numPolys, sizeof(SortablePoly), cmp_SortablePoly);
 
-    mpoly->polygons = H3_MEMORY(malloc)(sizeof(GeoPolygon) * numPolys);
+    mpoly->polygons = allocOutput(arena, sizeof(GeoPolygon) * numPolys);
     if (!mpoly->polygons) {
-        destroySortablePolys(spolys, numPolys);
+        destroySortablePolys(spolys, arena ? 0 : numPolys);
         return E_MEMORY_ALLOC;
     }
 
@@ -572,6 +888,473 @@ static H3Error createMultiPolygon(SortableLoopSet loopset,
     return E_SUCCESS;
 }
 
+/*
+State shared by the tasks of cellsToMultiPolygonParallel. Cells are split into
+contiguous chunks for building arcs, and edge keys are sharded by a hash of
+the key for pairing, so that shards have about the same number of keys
+wherever the cells are. Each task writes only to its own chunk, shard or
+loop, and its own entry in `errors`.
+*/
+typedef struct {
+    const H3Index *cells;
+    int64_t numCells;
+    int64_t numChunks;
+    int64_t chunkSize;
+    // Number of shards, which is also numChunks
+    int64_t numShards;
+    int res;
+
+    Arc *arcs;
+    // Start of each chunk's arcs in `arcs`, size numChunks + 1
+    int64_t *chunkArcs;
+    // Edge keys in arc order, later reused as radix sort scratch space
+    EdgeKey *keys;
+    // Edge keys grouped by shard
+    EdgeKey *shardKeys;
+    // Per chunk, per shard count of keys, then write position in shardKeys
+    int64_t *chunkShardPos;
+    // Start of each shard in shardKeys, size numShards + 1
+    int64_t *shardStarts;
+    int64_t *partners;
+
+    Arc **loopStarts;
+    SortableLoop *sloops;
+
+    H3Error *errors;
+} ParallelArcs;
+
+#define PARALLEL_CHUNKS_PER_THREAD 4
+
+// Shard of an edge key, from the high bits of a multiplicative hash. The low
+// bits of keys are the same for all edges at a resolution.
+static inline int64_t keyShard(const ParallelArcs *p, H3Index key) {
+    uint64_t hash = (key * UINT64_C(0x9E3779B97F4A7C15)) >> 32;
+    return (int64_t)((hash * (uint64_t)p->numShards) >> 32);
+}
+
+// Validate a chunk of cells and count its arcs
+static void validateChunkTask(void *context, int64_t chunk) {
+    ParallelArcs *p = (ParallelArcs *)context;
+    int64_t start = chunk * p->chunkSize;
+    int64_t end = MIN(start + p->chunkSize, p->numCells);
+    int64_t numArcs = 0;
+    p->errors[chunk] = E_SUCCESS;
+    for (int64_t i = start; i < end; i++) {
+        if (!H3_EXPORT(isValidCell)(p->cells[i])) {
+            p->errors[chunk] = E_CELL_INVALID;
+            return;
+        }
+        if (H3_EXPORT(getResolution)(p->cells[i]) != p->res) {
+            p->errors[chunk] = E_RES_MISMATCH;
+            return;
+        }
+        numArcs += H3_EXPORT(isPentagon)(p->cells[i]) ? 5 : 6;
+    }
+    p->chunkArcs[chunk + 1] = numArcs;
+}
+
+// Create the arcs and edge keys for a chunk of cells, counting keys per shard
+static void createChunkArcsTask(void *context, int64_t chunk) {
+    ParallelArcs *p = (ParallelArcs *)context;
+    int64_t start = chunk * p->chunkSize;
+    int64_t end = MIN(start + p->chunkSize, p->numCells);
+    int64_t *shardCounts = &p->chunkShardPos[chunk * p->numShards];
+    p->errors[chunk] = E_SUCCESS;
+
+    int64_t j = p->chunkArcs[chunk];
+    for (int64_t i = start; i < end; i++) {
+        int64_t numEdges;
+        H3Error err = cellToEdgeArcs(p->cells[i], &p->arcs[j], &numEdges);
+        if (NEVER(err)) {
+            p->errors[chunk] = err;
+            return;
+        }
+        j += numEdges;
+    }
+
+    for (j = p->chunkArcs[chunk]; j < p->chunkArcs[chunk + 1]; j++) {
+        H3Index edge = p->arcs[j].id;
+        H3Index reversedEdge;
+        H3Error err = H3_EXPORT(reverseDirectedEdge)(edge, &reversedEdge);
+        if (NEVER(err)) {
+            p->errors[chunk] = err;
+            return;
+        }
+        H3Index key = edge < reversedEdge ? edge : reversedEdge;
+        p->keys[j].key = key;
+        p->keys[j].arc = j;
+        p->partners[j] = -1;
+        shardCounts[keyShard(p, key)]++;
+    }
+}
+
+// Move a chunk's keys to their shards, keeping arc order within each shard
+static void scatterChunkKeysTask(void *context, int64_t chunk) {
+    ParallelArcs *p = (ParallelArcs *)context;
+    int64_t *shardPos = &p->chunkShardPos[chunk * p->numShards];
+    for (int64_t j = p->chunkArcs[chunk]; j < p->chunkArcs[chunk + 1]; j++) {
+        EdgeKey key = p->keys[j];
+        p->shardKeys[shardPos[keyShard(p, key.key)]++] = key;
+    }
+}
+
+// Sort the keys of a shard and record the partner of each paired arc. Both
+// arcs of an interior edge have the same key, so always land in one shard.
+static void pairShardTask(void *context, int64_t shard) {
+    ParallelArcs *p = (ParallelArcs *)context;
+    int64_t start = p->shardStarts[shard];
+    int64_t n = p->shardStarts[shard + 1] - start;
+    EdgeKey *keys = &p->shardKeys[start];
+    p->errors[shard] = E_SUCCESS;
+    if (n == 0) {
+        return;
+    }
+
+    radixSortEdgeKeys(keys, &p->keys[start], n);
+
+    for (int64_t i = 0; i < n; i++) {
+        int64_t runEnd = i + 1;
+        while (runEnd < n && keys[runEnd].key == keys[i].key) {
+            runEnd++;
+        }
+        if (runEnd - i == 2) {
+            int64_t a = keys[i].arc;
+            int64_t b = keys[i + 1].arc;
+            if (p->arcs[a].id == p->arcs[b].id) {
+                // The same directed edge twice means a duplicate cell
+                p->errors[shard] = E_DUPLICATE_INPUT;
+                return;
+            }
+            p->partners[a] = b;
+            p->partners[b] = a;
+        } else if (runEnd - i > 2) {
+            p->errors[shard] = E_DUPLICATE_INPUT;
+            return;
+        }
+        i = runEnd - 1;
+    }
+}
+
+static void createLoopTask(void *context, int64_t loop) {
+    ParallelArcs *p = (ParallelArcs *)context;
+    p->errors[loop] =
+        createSortableLoopGeometry(p->loopStarts[loop], 0, NULL,
+                                   &p->sloops[loop]);
+}
+
+// Run tasks and return the error of the first failed task, if any
+static H3Error runParallelTasks(ParallelArcs *p, int numThreads,
+                                int64_t numTasks, ParallelTask task) {
+    parallelFor(numThreads, numTasks, task, p);
+    for (int64_t i = 0; i < numTasks; i++) {
+        if (p->errors[i]) {
+            return p->errors[i];
+        }
+    }
+    return E_SUCCESS;
+}
+
+static void destroyParallelArcs(ParallelArcs *p) {
+    H3_MEMORY(free)(p->arcs);
+    H3_MEMORY(free)(p->chunkArcs);
+    H3_MEMORY(free)(p->keys);
+    H3_MEMORY(free)(p->shardKeys);
+    H3_MEMORY(free)(p->chunkShardPos);
+    H3_MEMORY(free)(p->shardStarts);
+    H3_MEMORY(free)(p->partners);
+    H3_MEMORY(free)(p->loopStarts);
+    H3_MEMORY(free)(p->errors);
+}
+
+/*
+Build the arc set and cancel interior edge pairs using parallel tasks, leaving
+the arcs in exactly the state cancelArcPairs would.
+*/
+static H3Error createParallelArcSet(ParallelArcs *p, int numThreads) {
+    int64_t numChunks = p->numChunks;
+    int64_t numShards = p->numShards;
+    p->errors = H3_MEMORY(malloc)(numChunks * sizeof(H3Error));
+    p->chunkArcs = H3_MEMORY(calloc)(numChunks + 1, sizeof(int64_t));
+    p->chunkShardPos =
+        H3_MEMORY(calloc)(numChunks * numShards, sizeof(int64_t));
+    p->shardStarts = H3_MEMORY(calloc)(numShards + 1, sizeof(int64_t));
+    if (!p->errors || !p->chunkArcs || !p->chunkShardPos || !p->shardStarts) {
+        return E_MEMORY_ALLOC;
+    }
+
+    H3Error err = runParallelTasks(p, numThreads, numChunks, validateChunkTask);
+    if (err) {
+        return err;
+    }
+    for (int64_t c = 0; c < numChunks; c++) {
+        p->chunkArcs[c + 1] += p->chunkArcs[c];
+    }
+    int64_t numArcs = p->chunkArcs[numChunks];
+
+    p->arcs = H3_MEMORY(malloc)(numArcs * sizeof(Arc));
+    p->keys = H3_MEMORY(malloc)(numArcs * sizeof(EdgeKey));
+    p->shardKeys = H3_MEMORY(malloc)(numArcs * sizeof(EdgeKey));
+    p->partners = H3_MEMORY(malloc)(numArcs * sizeof(int64_t));
+    if (!p->arcs || !p->keys || !p->shardKeys || !p->partners) {
+        return E_MEMORY_ALLOC;
+    }
+
+    err = runParallelTasks(p, numThreads, numChunks, createChunkArcsTask);
+    if (NEVER(err)) {
+        return err;
+    }
+
+    // Convert per chunk counts into write positions, ordering keys by shard,
+    // then by chunk
+    int64_t pos = 0;
+    for (int64_t s = 0; s < numShards; s++) {
+        p->shardStarts[s] = pos;
+        for (int64_t c = 0; c < numChunks; c++) {
+            int64_t count = p->chunkShardPos[c * numShards + s];
+            p->chunkShardPos[c * numShards + s] = pos;
+            pos += count;
+        }
+    }
+    p->shardStarts[numShards] = pos;
+
+    parallelFor(numThreads, numChunks, scatterChunkKeysTask, p);
+
+    err = runParallelTasks(p, numThreads, numShards, pairShardTask);
+    if (err) {
+        return err;
+    }
+
+    // Cancel pairs in arc order, as cancelArcPairs does. This only relinks
+    // pointers, and keeping it sequential makes the loops and union-find
+    // roots identical to the sequential pipeline.
+    for (int64_t i = 0; i < numArcs; i++) {
+        Arc *a = &p->arcs[i];
+        if (a->isRemoved || p->partners[i] < 0) {
+            continue;
+        }
+        cancelArcPair(a, &p->arcs[p->partners[i]]);
+    }
+
+    return E_SUCCESS;
+}
+
+/*
+Find the first arc and the root of every loop, in the order used by
+createSortableLoopSet, then build the loop geometry in parallel.
+*/
+static H3Error createParallelLoopSet(ParallelArcs *p, int numThreads,
+                                     SortableLoopSet *loopset) {
+    ArcSet arcset = {.numArcs = p->chunkArcs[p->numChunks], .arcs = p->arcs};
+    int64_t numLoops = countLoops(arcset);
+    resetVisited(arcset);
+    if (numLoops == 0) {
+        // No boundary, so createMultiPolygon outputs the whole globe
+        loopset->numLoops = 0;
+        loopset->sloops = NULL;
+        return E_SUCCESS;
+    }
+
+    p->loopStarts = H3_MEMORY(malloc)(numLoops * sizeof(Arc *));
+    SortableLoop *sloops = H3_MEMORY(calloc)(numLoops, sizeof(SortableLoop));
+    if (!p->loopStarts || !sloops) {
+        H3_MEMORY(free)(sloops);
+        return E_MEMORY_ALLOC;
+    }
+    if (numLoops > p->numChunks) {
+        H3Error *errors =
+            H3_MEMORY(realloc)(p->errors, numLoops * sizeof(H3Error));
+        if (!errors) {
+            H3_MEMORY(free)(sloops);
+            return E_MEMORY_ALLOC;
+        }
+        p->errors = errors;
+    }
+
+    int64_t j = 0;
+    for (int64_t i = 0; i < arcset.numArcs; i++) {
+        Arc *arc = &p->arcs[i];
+        if (arc->isVisited || arc->isRemoved) {
+            continue;
+        }
+        p->loopStarts[j] = arc;
+        sloops[j].root = getRoot(arc)->id;
+        j++;
+        do {
+            arc->isVisited = true;
+            arc = arc->next;
+        } while (arc != p->loopStarts[j - 1]);
+    }
+
+    p->sloops = sloops;
+    loopset->numLoops = numLoops;
+    loopset->sloops = sloops;
+    H3Error err = runParallelTasks(p, numThreads, numLoops, createLoopTask);
+    if (err) {
+        destroySortableLoopSet(loopset);
+        return err;
+    }
+
+    qsort(sloops, numLoops, sizeof(SortableLoop), cmp_SortableLoop);
+    return E_SUCCESS;
+}
+
+/**
+ * Create a GeoMultiPolygon from a set of H3 cells, using up to `numThreads`
+ * threads.
+ *
+ * Produces exactly the same output as cellsToMultiPolygon, for any number of
+ * threads. Building the arcs, pairing interior edges (sharded by a hash of
+ * the edge, so the work is split evenly even when most cells are in one base
+ * cell) and building the output loops run in parallel; cancelling edge pairs
+ * and assembling polygons are sequential.
+ *
+ * Threads are only used if the library was built with ENABLE_THREADS;
+ * otherwise the same algorithm runs on the calling thread. The allocation
+ * functions must be thread safe.
+ *
+ * @param cells Array of H3 cell indexes. Must be valid cells at the same
+ *              resolution with no duplicates.
+ * @param numCells Number of cells in the array.
+ * @param numThreads Maximum number of threads to use. Must be at least 1.
+ * @param out Output parameter for the resulting GeoMultiPolygon. The caller
+ *            is responsible for freeing this with destroyGeoMultiPolygon.
+ * @return E_SUCCESS on success
+ */
+H3Error H3_EXPORT(cellsToMultiPolygonParallel)(const H3Index *cells,
+                                               const int64_t numCells,
+                                               int numThreads,
+                                               GeoMultiPolygon *out) {
+    if (numThreads < 1) {
+        return E_DOMAIN;
+    }
+    H3Error err = checkCellsToMultiPolyOverflow(numCells, 0);
+    if (err) return err;
+    if (numCells < 0) {
+        return E_DOMAIN;
+    }
+
+    if (numCells == 0) {
+        out->numPolygons = 0;
+        out->polygons = NULL;
+        return E_SUCCESS;
+    }
+
+    int64_t numChunks =
+        MIN(numCells, (int64_t)numThreads * PARALLEL_CHUNKS_PER_THREAD);
+    ParallelArcs p = {.cells = cells,
+                      .numCells = numCells,
+                      .numChunks = numChunks,
+                      .numShards = numChunks,
+                      .chunkSize = (numCells + numChunks - 1) / numChunks,
+                      .res = H3_GET_RESOLUTION(cells[0])};
+
+    err = createParallelArcSet(&p, numThreads);
+    if (err) {
+        destroyParallelArcs(&p);
+        return err;
+    }
+
+    // Free pairing state before building the output
+    H3_MEMORY(free)(p.keys);
+    H3_MEMORY(free)(p.shardKeys);
+    H3_MEMORY(free)(p.partners);
+    p.keys = NULL;
+    p.shardKeys = NULL;
+    p.partners = NULL;
+
+    SortableLoopSet loopset;
+    err = createParallelLoopSet(&p, numThreads, &loopset);
+    if (err) {
+        destroyParallelArcs(&p);
+        return err;
+    }
+
+    err = createMultiPolygon(loopset, NULL, out);
+    if (err) {
+        destroySortableLoopSet(&loopset);
+        destroyParallelArcs(&p);
+        return err;
+    }
+
+    destroySortableLoopSetShallow(&loopset);
+    destroyParallelArcs(&p);
+    return E_SUCCESS;
+}
+
+/*
+Shared implementation of cellsToMultiPolygon and its sorted and simplified
+variants. A nonzero `hashMultiplier` pairs edges with a hash table of that
+many buckets per arc; zero pairs them by sorting. A positive `tolerance`
+simplifies each loop as it is built. If `arena` is not NULL the output is
+allocated from it, and the caller rewinds it on error.
+*/
+static H3Error cellsToMultiPolygonWithPairing(const H3Index *cells,
+                                              const int64_t numCells,
+                                              int64_t hashMultiplier,
+                                              double tolerance, Arena *arena,
+                                              GeoMultiPolygon *out) {
+    H3Error err = checkCellsToMultiPolyOverflow(numCells, hashMultiplier);
+    if (err) return err;
+
+    err = validateCellSet(cells, numCells);
+    if (err) return err;
+
+    if (numCells == 0) {
+        out->numPolygons = 0;
+        out->polygons = NULL;
+        return E_SUCCESS;
+    }
+
+    // arcset initializes with separate doubly-linked loops for each cell,
+    // each in their own connected component
+    ArcSet arcset;
+    err = createArcSet(cells, numCells, hashMultiplier, &arcset);
+    if (err) return err;
+
+    // Cancel out pairs of edges, updating the doubly-linked loops and merging
+    // them into a single connected component
+    err = hashMultiplier ? cancelArcPairs(arcset)
+                         : cancelSortedArcPairs(arcset);
+    if (err) {
+        destroyArcSet(&arcset);
+        return err;
+    }
+
+    /*
+    Extract all loops and sort them by:
+      1) their connected component, and then by
+      2) the loop area.
+    This makes loops for each polygon contiguous in memory.
+    Within each polygon, the sorting makes the loop with the smallest enclosed
+    area come first (accounting for loop winding direction),
+    which is what we take to be the outer loop for that polygon.
+    */
+    SortableLoopSet loopset;
+    err = createSortableLoopSet(arcset, tolerance, arena, &loopset);
+    if (err) {
+        destroyArcSet(&arcset);
+        return err;
+    }
+
+    // Extract polygons, since loops are contiguous in SortableLoopSet memory.
+    // Polygons sorted by outer loop area, decreasing.
+    err = createMultiPolygon(loopset, arena, out);
+    if (err) {
+        if (arena) {
+            destroySortableLoopSetShallow(&loopset);
+        } else {
+            destroySortableLoopSet(&loopset);
+        }
+        destroyArcSet(&arcset);
+        return err;
+    }
+
+    destroyArcSet(&arcset);
+    destroySortableLoopSetShallow(&loopset);
+
+    return E_SUCCESS;
+}
+
 /**
  * Create a GeoMultiPolygon from a set of H3 cells.
  *
@@ -606,11 +1389,250 @@ static H3Error createMultiPolygon(SortableLoopSet loopset,
 H3Error H3_EXPORT(cellsToMultiPolygon)(const H3Index *cells,
                                        const int64_t numCells,
                                        GeoMultiPolygon *out) {
-    H3Error err =
-        checkCellsToMultiPolyOverflow(numCells, HASH_TABLE_MULTIPLIER);
-    if (err) return err;
+    return cellsToMultiPolygonWithPairing(cells, numCells,
+                                          HASH_TABLE_MULTIPLIER, 0, NULL, out);
+}
 
-    err = validateCellSet(cells, numCells);
+/**
+ * Create a GeoMultiPolygon from a set of H3 cells, pairing interior edges by
+ * sorting rather than hashing.
+ *
+ * Produces the same output as cellsToMultiPolygon, but replaces the edge hash
+ * table with a sort of undirected edge keys followed by a linear pass. This
+ * uses roughly a third of the working memory and has better cache behavior
+ * for very large cell sets.
+ *
+ * @param cells Array of H3 cell indexes. Must be valid cells at the same
+ *              resolution with no duplicates.
+ * @param numCells Number of cells in the array.
+ * @param out Output parameter for the resulting GeoMultiPolygon. The caller
+ *            is responsible for freeing this with destroyGeoMultiPolygon.
+ * @return E_SUCCESS on success
+ */
+H3Error H3_EXPORT(cellsToMultiPolygonSorted)(const H3Index *cells,
+                                             const int64_t numCells,
+                                             GeoMultiPolygon *out) {
+    return cellsToMultiPolygonWithPairing(cells, numCells, 0, 0, NULL, out);
+}
+
+/**
+ * Create a GeoMultiPolygon from a set of H3 cells, simplifying the loops.
+ *
+ * Each loop is simplified with the Douglas-Peucker algorithm as it is built,
+ * removing vertexes that are within `tolerance` radians (great circle
+ * distance) of the simplified loop. This removes the nearly collinear vertexes
+ * along the cell edges, so outlines of large coverages have far fewer
+ * vertexes.
+ *
+ * Polygons and holes are grouped and ordered as for cellsToMultiPolygon.
+ * Each loop keeps at least 3 vertexes. Loops are simplified independently, so
+ * with large tolerances neighboring loops may touch or cross.
+ *
+ * @param cells Array of H3 cell indexes. Must be valid cells at the same
+ *              resolution with no duplicates.
+ * @param numCells Number of cells in the array.
+ * @param tolerance Maximum distance in radians from a removed vertex to the
+ *                  simplified loop. Zero gives the same output as
+ *                  cellsToMultiPolygon.
+ * @param out Output parameter for the resulting GeoMultiPolygon. The caller
+ *            is responsible for freeing this with destroyGeoMultiPolygon.
+ * @return E_SUCCESS on success, or E_DOMAIN if tolerance is negative or not
+ * finite
+ */
+H3Error H3_EXPORT(cellsToMultiPolygonSimplified)(const H3Index *cells,
+                                                 const int64_t numCells,
+                                                 double tolerance,
+                                                 GeoMultiPolygon *out) {
+    if (!isfinite(tolerance) || tolerance < 0) {
+        return E_DOMAIN;
+    }
+    return cellsToMultiPolygonWithPairing(cells, numCells,
+                                          HASH_TABLE_MULTIPLIER, tolerance,
+                                          NULL, out);
+}
+
+/**
+ * Create a GeoMultiPolygon from a set of H3 cells, allocating the output from
+ * an arena.
+ *
+ * Produces the same output as cellsToMultiPolygon, but every vertex array,
+ * hole array and the polygon array are allocated from `arena` instead of
+ * individually, so the output is freed all at once by resetArena or
+ * destroyArena. Do not call destroyGeoMultiPolygon on the output. Working
+ * memory is still allocated from the heap and freed before returning.
+ *
+ * An arena must not be used by more than one thread at a time; give each
+ * worker its own arena, and reset it between calls to reuse its memory.
+ *
+ * @param cells Array of H3 cell indexes. Must be valid cells at the same
+ *              resolution with no duplicates.
+ * @param numCells Number of cells in the array.
+ * @param arena Arena to allocate the output from, initialized with initArena.
+ *              On error, the arena is left as it was before the call.
+ * @param out Output parameter for the resulting GeoMultiPolygon, valid until
+ *            the arena is reset or destroyed.
+ * @return E_SUCCESS on success
+ */
+H3Error H3_EXPORT(cellsToMultiPolygonArena)(const H3Index *cells,
+                                            const int64_t numCells,
+                                            Arena *arena,
+                                            GeoMultiPolygon *out) {
+    ArenaMark mark = arenaMark(arena);
+    H3Error err = cellsToMultiPolygonWithPairing(
+        cells, numCells, HASH_TABLE_MULTIPLIER, 0, arena, out);
+    if (err) {
+        rewindArena(arena, mark);
+    }
+    return err;
+}
+
+/*
+Validate a compacted (mixed resolution) cell set: every cell must be valid, and
+no cell may be repeated or contained in another cell of the set. On success,
+`maxRes` is set to the finest resolution present.
+*/
+static H3Error validateCompactCellSet(const H3Index *cells,
+                                      const int64_t numCells, int *maxRes) {
+    if (numCells < 0) {
+        return E_DOMAIN;
+    }
+
+    // Record which resolutions are present, so only those ancestors are
+    // looked up below
+    int resMask = 0;
+    *maxRes = 0;
+    for (int64_t i = 0; i < numCells; i++) {
+        if (!H3_EXPORT(isValidCell)(cells[i])) {
+            return E_CELL_INVALID;
+        }
+        int res = H3_GET_RESOLUTION(cells[i]);
+        resMask |= 1 << res;
+        if (res > *maxRes) {
+            *maxRes = res;
+        }
+    }
+
+    if (numCells < 2) {
+        return E_SUCCESS;
+    }
+
+    H3Index *cellsCopy = H3_MEMORY(malloc)(numCells * sizeof(H3Index));
+    if (!cellsCopy) {
+        return E_MEMORY_ALLOC;
+    }
+    memcpy(cellsCopy, cells, numCells * sizeof(H3Index));
+    qsort(cellsCopy, numCells, sizeof(H3Index), cmp_uint64);
+
+    H3Error err = E_SUCCESS;
+    for (int64_t i = 0; i < numCells && !err; i++) {
+        if (i > 0 && cellsCopy[i] == cellsCopy[i - 1]) {
+            err = E_DUPLICATE_INPUT;
+            break;
+        }
+        int res = H3_GET_RESOLUTION(cellsCopy[i]);
+        for (int r = 0; r < res; r++) {
+            if (!(resMask & (1 << r))) {
+                continue;
+            }
+            H3Index parent = cellsCopy[i];
+            H3_SET_RESOLUTION(parent, r);
+            for (int d = r + 1; d <= res; d++) {
+                H3_SET_INDEX_DIGIT(parent, d, INVALID_DIGIT);
+            }
+            if (bsearch(&parent, cellsCopy, numCells, sizeof(H3Index),
+                        cmp_uint64)) {
+                err = E_DUPLICATE_INPUT;
+                break;
+            }
+        }
+    }
+
+    H3_MEMORY(free)(cellsCopy);
+    return err;
+}
+
+/*
+Create the ArcSet for a compacted cell set. Each cell contributes the outline
+of its children at `res`, so arcs are only created along cell boundaries:
+5 or 6 * 3^(res - cellRes) per cell, rather than one loop per child. The
+outline is already a counter-clockwise loop, so each cell's arcs are linked in
+iteration order and form one connected component. No hash buckets are built;
+pairs are found with `cancelSortedArcPairs`.
+*/
+static H3Error createCompactArcSet(const H3Index *cells,
+                                   const int64_t numCells, int res,
+                                   ArcSet *arcset) {
+    // Also covers the sort buffers in cancelSortedArcPairs, which are
+    // smaller than sizeof(Arc) per arc
+    int64_t maxArcs = (int64_t)MIN(SIZE_MAX / sizeof(Arc), INT64_MAX);
+    int64_t numArcs = 0;
+    for (int64_t i = 0; i < numCells; i++) {
+        int64_t numEdges =
+            (H3_EXPORT(isPentagon)(cells[i]) ? 5 : 6) *
+            _ipow(3, res - H3_GET_RESOLUTION(cells[i]));
+        if (numArcs > maxArcs - numEdges) {
+            return E_MEMORY_BOUNDS;
+        }
+        numArcs += numEdges;
+    }
+
+    arcset->numArcs = numArcs;
+    arcset->numBuckets = 0;
+    arcset->buckets = NULL;
+    arcset->arcs = H3_MEMORY(malloc)(numArcs * sizeof(Arc));
+    if (!arcset->arcs) {
+        return E_MEMORY_ALLOC;
+    }
+
+    int64_t j = 0;
+    for (int64_t i = 0; i < numCells; i++) {
+        Arc *first = &arcset->arcs[j];
+        for (IterEdgesGosper iter = iterInitGosper(cells[i], res); iter.e;
+             iterStepGosper(&iter)) {
+            Arc *arc = &arcset->arcs[j++];
+            arc->id = iter.e;
+            arc->isRemoved = false;
+            arc->isVisited = false;
+            arc->parent = first;
+            arc->rank = 1;
+            // The first arc is linked to the last one once the ring is done
+            if (arc != first) {
+                arc->prev = arc - 1;
+            }
+            arc->next = arc + 1;
+        }
+        Arc *last = &arcset->arcs[j - 1];
+        first->prev = last;
+        last->next = first;
+    }
+
+    return E_SUCCESS;
+}
+
+/**
+ * Create a GeoMultiPolygon from a compacted set of H3 cells.
+ *
+ * Gives the same polygons as uncompacting the set to its finest resolution
+ * and calling cellsToMultiPolygon, without materializing the children. Each
+ * coarse cell only contributes the edges on its outline at the finest
+ * resolution present, so the work is proportional to the length of the
+ * boundaries rather than the number of covered cells.
+ *
+ * Loops may begin at a different vertex than those from cellsToMultiPolygon.
+ *
+ * @param cells Array of H3 cell indexes, as returned by compactCells. Cells
+ *              may have different resolutions, but must be valid and may not
+ *              repeat or contain one another.
+ * @param numCells Number of cells in the array.
+ * @param out Output parameter for the resulting GeoMultiPolygon. The caller
+ *            is responsible for freeing this with destroyGeoMultiPolygon.
+ * @return E_SUCCESS on success
+ */
+H3Error H3_EXPORT(compactCellsToMultiPolygon)(const H3Index *cells,
+                                              const int64_t numCells,
+                                              GeoMultiPolygon *out) {
+    int res;
+    H3Error err = validateCompactCellSet(cells, numCells, &res);
     if (err) return err;
 
     if (numCells == 0) {
@@ -619,39 +1641,24 @@ H3Error H3_EXPORT(cellsToMultiPolygon)(const H3Index *cells,
         return E_SUCCESS;
     }
 
-    // arcset initializes with separate doubly-linked loops for each cell,
-    // each in their own connected component
     ArcSet arcset;
-    err = createArcSet(cells, numCells, &arcset);
+    err = createCompactArcSet(cells, numCells, res, &arcset);
     if (err) return err;
 
-    // Cancel out pairs of edges, updating the doubly-linked loops and merging
-    // them into a single connected component
-    err = cancelArcPairs(arcset);
-    if (NEVER(err)) {
+    err = cancelSortedArcPairs(arcset);
+    if (err) {
         destroyArcSet(&arcset);
         return err;
     }
 
-    /*
-    Extract all loops and sort them by:
-      1) their connected component, and then by
-      2) the loop area.
-    This makes loops for each polygon contiguous in memory.
-    Within each polygon, the sorting makes the loop with the smallest enclosed
-    area come first (accounting for loop winding direction),
-    which is what we take to be the outer loop for that polygon.
-    */
     SortableLoopSet loopset;
-    err = createSortableLoopSet(arcset, &loopset);
+    err = createSortableLoopSet(arcset, 0, NULL, &loopset);
     if (err) {
         destroyArcSet(&arcset);
         return err;
     }
 
-    // Extract polygons, since loops are contiguous in SortableLoopSet memory.
-    // Polygons sorted by outer loop area, decreasing.
-    err = createMultiPolygon(loopset, out);
+    err = createMultiPolygon(loopset, NULL, out);
     if (err) {
         destroySortableLoopSet(&loopset);
         destroyArcSet(&arcset);
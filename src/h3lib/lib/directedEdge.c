@@ -21,22 +21,24 @@
 #include <stdbool.h>
 
 #include "algos.h"
+#include "baseCells.h"
 #include "constants.h"
 #include "coordijk.h"
+#include "directedEdge.h"
 #include "h3Assert.h"
 #include "h3Index.h"
 #include "latLng.h"
 #include "vertex.h"
 
 /**
- * Returns whether or not the provided H3Indexes are neighbors.
- * @param origin The origin H3 index.
- * @param destination The destination H3 index.
- * @param out Set to 1 if the indexes are neighbors, 0 otherwise
- * @return Error code if the origin or destination are invalid or incomparable.
+ * Decides the cases of areNeighborCells that don't need to find the
+ * neighbors of the origin: errors, siblings, and cells whose base cells are
+ * not neighbors.
+ *
+ * @param out Output: whether the cells are neighbors, or -1 if undecided
  */
-H3Error H3_EXPORT(areNeighborCells)(H3Index origin, H3Index destination,
-                                    int *out) {
+static H3Error _areNeighborCellsPrecheck(H3Index origin, H3Index destination,
+                                         int *out) {
     // Make sure they're hexagon indexes
     if (H3_GET_MODE(origin) != H3_CELL_MODE ||
         H3_GET_MODE(destination) != H3_CELL_MODE) {
@@ -50,7 +52,8 @@ H3Error H3_EXPORT(areNeighborCells)(H3Index origin, H3Index destination,
     }
 
     // Only hexagons in the same resolution can be neighbors
-    if (H3_GET_RESOLUTION(origin) != H3_GET_RESOLUTION(destination)) {
+    int res = H3_GET_RESOLUTION(origin);
+    if (res != H3_GET_RESOLUTION(destination)) {
         return E_RES_MISMATCH;
     }
 
@@ -58,70 +61,176 @@ H3Error H3_EXPORT(areNeighborCells)(H3Index origin, H3Index destination,
     // Child 0 is neighbor with all of its parent's 'offspring', the other
     // children are neighbors with 3 of the 7 children. So a simple comparison
     // of origin and destination parents and then a lookup table of the children
-    // is a super-cheap way to possibly determine they are neighbors.
-    int parentRes = H3_GET_RESOLUTION(origin) - 1;
-    if (parentRes > 0) {
-        // TODO: Return error codes here
-        H3Index originParent;
-        H3_EXPORT(cellToParent)(origin, parentRes, &originParent);
-        H3Index destinationParent;
-        H3_EXPORT(cellToParent)(destination, parentRes, &destinationParent);
-        if (originParent == destinationParent) {
-            Direction originResDigit =
-                H3_GET_INDEX_DIGIT(origin, parentRes + 1);
-            Direction destinationResDigit =
-                H3_GET_INDEX_DIGIT(destination, parentRes + 1);
-            if (originResDigit == CENTER_DIGIT ||
-                destinationResDigit == CENTER_DIGIT) {
-                *out = 1;
-                return E_SUCCESS;
-            }
-            if (originResDigit >= INVALID_DIGIT) {
-                // Prevent indexing off the end of the array below
-                return E_CELL_INVALID;
+    // is a super-cheap way to possibly determine they are neighbors. The
+    // parents are the same if the cells only differ in their last digit.
+    int parentRes = res - 1;
+    uint64_t lastDigitMask = (uint64_t)H3_DIGIT_MASK
+                             << ((MAX_H3_RES - res) * H3_PER_DIGIT_OFFSET);
+    if (parentRes > 0 && ((origin ^ destination) & ~lastDigitMask) == 0) {
+        Direction originResDigit = H3_GET_INDEX_DIGIT(origin, res);
+        Direction destinationResDigit = H3_GET_INDEX_DIGIT(destination, res);
+        if (originResDigit == CENTER_DIGIT ||
+            destinationResDigit == CENTER_DIGIT) {
+            *out = 1;
+            return E_SUCCESS;
+        }
+        if (originResDigit >= INVALID_DIGIT) {
+            // Prevent indexing off the end of the array below
+            return E_CELL_INVALID;
+        }
+        if (originResDigit == K_AXES_DIGIT ||
+            destinationResDigit == K_AXES_DIGIT) {
+            H3Index originParent;
+            H3Error parentError =
+                H3_EXPORT(cellToParent)(origin, parentRes, &originParent);
+            if (NEVER(parentError)) {
+                return parentError;
             }
-            if ((originResDigit == K_AXES_DIGIT ||
-                 destinationResDigit == K_AXES_DIGIT) &&
-                H3_EXPORT(isPentagon)(originParent)) {
+            if (H3_EXPORT(isPentagon)(originParent)) {
                 // If these are invalid cells, fail rather than incorrectly
                 // reporting neighbors. For pentagon cells that are actually
-                // neighbors across the deleted subsequence, they will fail the
-                // optimized check below, but they will be accepted by the
-                // gridDisk check below that.
+                // neighbors across the deleted subsequence, they will fail
+                // the optimized check below, but they will be accepted by
+                // the full check after that.
                 return E_CELL_INVALID;
             }
-            // These sets are the relevant neighbors in the clockwise
-            // and counter-clockwise
-            const Direction neighborSetClockwise[] = {
-                CENTER_DIGIT,  JK_AXES_DIGIT, IJ_AXES_DIGIT, J_AXES_DIGIT,
-                IK_AXES_DIGIT, K_AXES_DIGIT,  I_AXES_DIGIT};
-            const Direction neighborSetCounterclockwise[] = {
-                CENTER_DIGIT,  IK_AXES_DIGIT, JK_AXES_DIGIT, K_AXES_DIGIT,
-                IJ_AXES_DIGIT, I_AXES_DIGIT,  J_AXES_DIGIT};
-            if (neighborSetClockwise[originResDigit] == destinationResDigit ||
-                neighborSetCounterclockwise[originResDigit] ==
-                    destinationResDigit) {
-                *out = 1;
-                return E_SUCCESS;
-            }
         }
-    }
-
-    // Otherwise, we have to determine the neighbor relationship the "hard" way.
-    H3Index neighborRing[7] = {0};
-    H3_EXPORT(gridDisk)(origin, 1, neighborRing);
-    for (int i = 0; i < 7; i++) {
-        if (neighborRing[i] == destination) {
+        // These sets are the relevant neighbors in the clockwise
+        // and counter-clockwise
+        static const Direction neighborSetClockwise[] = {
+            CENTER_DIGIT,  JK_AXES_DIGIT, IJ_AXES_DIGIT, J_AXES_DIGIT,
+            IK_AXES_DIGIT, K_AXES_DIGIT,  I_AXES_DIGIT};
+        static const Direction neighborSetCounterclockwise[] = {
+            CENTER_DIGIT,  IK_AXES_DIGIT, JK_AXES_DIGIT, K_AXES_DIGIT,
+            IJ_AXES_DIGIT, I_AXES_DIGIT,  J_AXES_DIGIT};
+        if (neighborSetClockwise[originResDigit] == destinationResDigit ||
+            neighborSetCounterclockwise[originResDigit] ==
+                destinationResDigit) {
             *out = 1;
             return E_SUCCESS;
         }
     }
 
-    // Made it here, they definitely aren't neighbors
-    *out = 0;
+    // Cells can only be neighbors if their base cells are the same or
+    // neighbors
+    int originBaseCell = H3_GET_BASE_CELL(origin);
+    int destinationBaseCell = H3_GET_BASE_CELL(destination);
+    if (originBaseCell != destinationBaseCell &&
+        (originBaseCell >= NUM_BASE_CELLS ||
+         destinationBaseCell >= NUM_BASE_CELLS ||
+         _getBaseCellDirection(originBaseCell, destinationBaseCell) ==
+             INVALID_DIGIT)) {
+        *out = 0;
+        return E_SUCCESS;
+    }
+
+    *out = -1;
+    return E_SUCCESS;
+}
+
+/**
+ * Finds the neighbors of a cell in each direction, as directionForNeighbor
+ * does, leaving H3_NULL for the deleted direction of pentagons and for
+ * directions that fail.
+ */
+static void _neighborsByDirection(H3Index origin, H3Index neighbors[6]) {
+    bool isPent = H3_EXPORT(isPentagon)(origin);
+    for (Direction direction = K_AXES_DIGIT; direction < NUM_DIGITS;
+         direction++) {
+        H3Index neighbor = H3_NULL;
+        int rotations = 0;
+        if ((isPent && direction == K_AXES_DIGIT) ||
+            h3NeighborRotations(origin, direction, &rotations, &neighbor)) {
+            neighbor = H3_NULL;
+        }
+        neighbors[direction - K_AXES_DIGIT] = neighbor;
+    }
+}
+
+/**
+ * Returns whether or not the provided H3Indexes are neighbors.
+ * @param origin The origin H3 index.
+ * @param destination The destination H3 index.
+ * @param out Set to 1 if the indexes are neighbors, 0 otherwise
+ * @return Error code if the origin or destination are invalid or incomparable.
+ */
+H3Error H3_EXPORT(areNeighborCells)(H3Index origin, H3Index destination,
+                                    int *out) {
+    H3Error err = _areNeighborCellsPrecheck(origin, destination, out);
+    if (err || *out != -1) {
+        return err;
+    }
+
+    // Otherwise, look for the destination among the origin's neighbors,
+    // stopping at the first match.
+    *out = directionForNeighbor(origin, destination) != INVALID_DIGIT;
     return E_SUCCESS;
 }
 
+/**
+ * Determines whether each of an array of pairs of cells are neighbors, as
+ * areNeighborCells. Pairs that need the neighbors of their origin reuse
+ * them while the origin is the same as the previous pair's, so listing the
+ * pairs origin by origin (as when building a graph) avoids recomputing them.
+ *
+ * Errors are reported per pair: a failing pair is not marked as neighbors,
+ * and has its bit set in errorBitmap.
+ *
+ * @param origins Origin of each pair
+ * @param destinations Destination of each pair
+ * @param numPairs Number of pairs
+ * @param neighborBitmap Output, bitmap of the pairs that are neighbors (see
+ *                       h3Index.h)
+ * @param errorBitmap Output, error bitmap of the pairs (see h3Index.h)
+ * @return E_SUCCESS, the error of the first pair that failed, or E_DOMAIN if
+ * numPairs is negative
+ */
+H3Error H3_EXPORT(areNeighborCellPairs)(const H3Index *origins,
+                                        const H3Index *destinations,
+                                        int64_t numPairs,
+                                        uint64_t *neighborBitmap,
+                                        uint64_t *errorBitmap) {
+    if (numPairs < 0) {
+        return E_DOMAIN;
+    }
+    H3Error firstError = E_SUCCESS;
+    H3Index neighborsOrigin = H3_NULL;
+    H3Index neighbors[6];
+    for (int64_t start = 0; start < numPairs; start += 64) {
+        int64_t blockSize = numPairs - start < 64 ? numPairs - start : 64;
+        uint64_t neighborWord = 0;
+        uint64_t errorWord = 0;
+        for (int64_t i = 0; i < blockSize; i++) {
+            H3Index origin = origins[start + i];
+            H3Index destination = destinations[start + i];
+            int isNeighbor;
+            H3Error err =
+                _areNeighborCellsPrecheck(origin, destination, &isNeighbor);
+            if (err) {
+                errorWord |= (uint64_t)1 << i;
+                if (!firstError) firstError = err;
+                continue;
+            }
+            if (isNeighbor == -1) {
+                if (origin != neighborsOrigin) {
+                    _neighborsByDirection(origin, neighbors);
+                    neighborsOrigin = origin;
+                }
+                isNeighbor = 0;
+                for (int d = 0; d < 6; d++) {
+                    isNeighbor |= neighbors[d] == destination;
+                }
+            }
+            neighborWord |= (uint64_t)isNeighbor << i;
+        }
+        neighborBitmap[start / 64] = neighborWord;
+        if (errorBitmap) {
+            errorBitmap[start / 64] = errorWord;
+        }
+    }
+    return firstError;
+}
+
 /**
  * Returns a directed edge H3 index based on the provided origin and
  * destination
@@ -286,13 +395,119 @@ H3Error H3_EXPORT(directedEdgeToBoundary)(H3Index edge, CellBoundary *cb) {
     int isPent = H3_EXPORT(isPentagon)(origin);
 
     if (isPent) {
-        _faceIjkPentToCellBoundary(&fijk, res, startVertex, 2, cb);
+        _faceIjkPentToCellBoundary(&fijk, res, startVertex, 2, cb, NULL);
+    } else {
+        _faceIjkToCellBoundary(&fijk, res, startVertex, 2, cb, NULL);
+    }
+    return E_SUCCESS;
+}
+
+/**
+ * Provides all of the directed edges from a cell, as originToDirectedEdges,
+ * with the boundary of each edge, as directedEdgeToBoundary. The boundaries
+ * are cut from the cell's boundary, which is computed once, rather than
+ * finding the origin's FaceIJK address and vertexes for every edge.
+ *
+ * @param origin The origin cell to find edges for.
+ * @param edges Output: 6 directed edges, with H3_NULL for the deleted
+ * direction of a pentagon
+ * @param boundaries Output: 6 edge boundaries, empty for H3_NULL edges
+ */
+H3Error H3_EXPORT(originToDirectedEdgesWithBoundaries)(
+    H3Index origin, H3Index *edges, CellBoundary *boundaries) {
+    if (!H3_EXPORT(isValidCell)(origin)) {
+        return E_CELL_INVALID;
+    }
+    FaceIJK fijk;
+    H3Error err = _h3ToFaceIjk(origin, &fijk);
+    if (NEVER(err)) {
+        return err;
+    }
+    int vertexNums[NUM_DIGITS];
+    err = vertexNumsForDirections(origin, &fijk, vertexNums);
+    if (NEVER(err)) {
+        return err;
+    }
+
+    // The cell boundary, with the position of each topological vertex in
+    // it. An edge's boundary runs from its start vertex to the next one,
+    // including the distortion vertex between them, if any.
+    int res = H3_GET_RESOLUTION(origin);
+    int isPent = H3_EXPORT(isPentagon)(origin);
+    int numTopoVerts = isPent ? NUM_PENT_VERTS : NUM_HEX_VERTS;
+    CellBoundary cellBoundary;
+    int vertIndexes[NUM_HEX_VERTS];
+    if (isPent) {
+        _faceIjkPentToCellBoundary(&fijk, res, 0, NUM_PENT_VERTS,
+                                   &cellBoundary, vertIndexes);
     } else {
-        _faceIjkToCellBoundary(&fijk, res, startVertex, 2, cb);
+        _faceIjkToCellBoundary(&fijk, res, 0, NUM_HEX_VERTS, &cellBoundary,
+                               vertIndexes);
+    }
+
+    H3_EXPORT(originToDirectedEdges)(origin, edges);
+    for (int i = 0; i < 6; i++) {
+        CellBoundary *cb = &boundaries[i];
+        cb->numVerts = 0;
+        if (edges[i] == H3_NULL) {
+            continue;
+        }
+        int startVertex = vertexNums[i + 1];
+        int nextVertex = (startVertex + 1) % numTopoVerts;
+        // The distortion vertex of the last edge is at the end of the loop
+        int end = nextVertex ? vertIndexes[nextVertex] : cellBoundary.numVerts;
+        for (int v = vertIndexes[startVertex]; v < end; v++) {
+            cb->verts[cb->numVerts++] = cellBoundary.verts[v];
+        }
+        cb->verts[cb->numVerts++] = cellBoundary.verts[vertIndexes[nextVertex]];
     }
     return E_SUCCESS;
 }
 
+/**
+ * Provides the directed edges and their boundaries for each of an array of
+ * cells, as originToDirectedEdgesWithBoundaries.
+ *
+ * Errors are reported per cell: a failing cell has H3_NULL edges with empty
+ * boundaries, and has its bit set in errorBitmap.
+ *
+ * @param origins The origin cells to find edges for
+ * @param numOrigins Number of origin cells
+ * @param edges Output: 6 * numOrigins directed edges, 6 per origin
+ * @param boundaries Output: 6 * numOrigins edge boundaries, 6 per origin
+ * @param errorBitmap Output, error bitmap of the origins (see h3Index.h)
+ * @return E_SUCCESS, the error of the first origin that failed, or E_DOMAIN
+ * if numOrigins is negative
+ */
+H3Error H3_EXPORT(originsToDirectedEdgesWithBoundaries)(
+    const H3Index *origins, int64_t numOrigins, H3Index *edges,
+    CellBoundary *boundaries, uint64_t *errorBitmap) {
+    if (numOrigins < 0) {
+        return E_DOMAIN;
+    }
+    H3Error firstError = E_SUCCESS;
+    for (int64_t start = 0; start < numOrigins; start += 64) {
+        int64_t blockSize = numOrigins - start < 64 ? numOrigins - start : 64;
+        uint64_t errorWord = 0;
+        for (int64_t i = start; i < start + blockSize; i++) {
+            H3Error err = H3_EXPORT(originToDirectedEdgesWithBoundaries)(
+                origins[i], &edges[6 * i], &boundaries[6 * i]);
+            if (err) {
+                for (int e = 0; e < 6; e++) {
+                    edges[6 * i + e] = H3_NULL;
+                    boundaries[6 * i + e].numVerts = 0;
+                }
+                errorWord |= (uint64_t)1 << (i - start);
+                if (!firstError) firstError = err;
+            }
+        }
+        if (errorBitmap) {
+            errorBitmap[start / 64] = errorWord;
+        }
+    }
+    return firstError;
+}
+
 /**
  * Returns the directed edge with origin and destination cells reversed.
  * @param edge The H3 directed edge index
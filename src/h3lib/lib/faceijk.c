@@ -527,9 +527,12 @@ void _faceIjkToVec3(const FaceIJK *h, int res, Vec3d *g) {
  * @param start The first topological vertex to return.
  * @param length The number of topological vertexes to return.
  * @param g Output: The spherical coordinates of the cell boundary.
+ * @param vertIndexes Output: optional, the index in g of each topological
+ *                    vertex returned, by vertex number. May be NULL.
  */
 void _faceIjkPentToCellBoundary(const FaceIJK *h, int res, int start,
-                                int length, CellBoundary *g) {
+                                int length, CellBoundary *g,
+                                int *vertIndexes) {
     int adjRes = res;
     FaceIJK centerIJK = *h;
     FaceIJK fijkVerts[NUM_PENT_VERTS];
@@ -620,6 +623,7 @@ void _faceIjkPentToCellBoundary(const FaceIJK *h, int res, int start,
         // vert == start + NUM_PENT_VERTS is only used to test for possible
         // intersection on last edge
         if (vert < start + NUM_PENT_VERTS) {
+            if (vertIndexes) vertIndexes[v] = g->numVerts;
             Vec2d vec;
             _ijkToHex2d(&fijk.coord, &vec);
             Vec3d v3;
@@ -702,9 +706,11 @@ void _faceIjkPentToVerts(FaceIJK *fijk, int *res, FaceIJK *fijkVerts) {
  * @param start The first topological vertex to return.
  * @param length The number of topological vertexes to return.
  * @param g Output: The spherical coordinates of the cell boundary.
+ * @param vertIndexes Output: optional, the index in g of each topological
+ *                    vertex returned, by vertex number. May be NULL.
  */
 void _faceIjkToCellBoundary(const FaceIJK *h, int res, int start, int length,
-                            CellBoundary *g) {
+                            CellBoundary *g, int *vertIndexes) {
     int adjRes = res;
     FaceIJK centerIJK = *h;
     FaceIJK fijkVerts[NUM_HEX_VERTS];
@@ -796,6 +802,7 @@ void _faceIjkToCellBoundary(const FaceIJK *h, int res, int start, int length,
         // vert == start + NUM_HEX_VERTS is only used to test for possible
         // intersection on last edge
         if (vert < start + NUM_HEX_VERTS) {
+            if (vertIndexes) vertIndexes[v] = g->numVerts;
             Vec2d vec;
             _ijkToHex2d(&fijk.coord, &vec);
             Vec3d v3;
@@ -0,0 +1,564 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file geoFormat.c
+ * @brief   WKB and GeoJSON serialization of GeoMultiPolygons
+ *
+ * Coordinates are written as (longitude, latitude) in degrees, and rings are
+ * closed by repeating the first vertex, as both formats require. Loop
+ * orientation is kept as is; GeoMultiPolygons from cellsToMultiPolygon
+ * already follow the right hand rule expected by GeoJSON.
+ */
+
+#include "geoFormat.h"
+
+#include <limits.h>
+#include <locale.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "alloc.h"
+#include "cellsToMultiPoly.h"
+#include "h3api.h"
+#include "polyfill.h"
+
+/** WKB byte order markers */
+#define WKB_BIG_ENDIAN 0
+#define WKB_LITTLE_ENDIAN 1
+
+/** WKB geometry types */
+#define WKB_POLYGON 3
+#define WKB_MULTIPOLYGON 6
+
+/** EWKB flag for an embedded SRID, which is skipped when reading */
+#define EWKB_SRID_FLAG 0x20000000u
+/** EWKB flags for Z and M coordinates, which are not supported */
+#define EWKB_ZM_FLAGS 0xC0000000u
+
+/** Size of a WKB geometry header: byte order, type and element count */
+#define WKB_HEADER_SIZE 9
+/** Size of a WKB point */
+#define WKB_POINT_SIZE 16
+
+/**
+ * Make room for `extra` more bytes in a buffer, at least doubling its
+ * capacity when it grows.
+ */
+static H3Error reserveBytes(ByteBuffer *buffer, size_t extra) {
+    if (extra <= buffer->capacity - buffer->size) {
+        return E_SUCCESS;
+    }
+    if (extra > SIZE_MAX - buffer->size) {
+        return E_MEMORY_BOUNDS;
+    }
+    size_t needed = buffer->size + extra;
+    size_t capacity = buffer->capacity < 64 ? 64 : buffer->capacity;
+    while (capacity < needed) {
+        capacity = capacity > SIZE_MAX / 2 ? needed : capacity * 2;
+    }
+    uint8_t *data = H3_MEMORY(realloc)(buffer->data, capacity);
+    if (!data) {
+        return E_MEMORY_ALLOC;
+    }
+    buffer->data = data;
+    buffer->capacity = capacity;
+    return E_SUCCESS;
+}
+
+// Writers below assume the space was already reserved
+
+static inline void writeUint32(ByteBuffer *buffer, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        buffer->data[buffer->size++] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+static inline void writeDouble(ByteBuffer *buffer, double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    for (int i = 0; i < 8; i++) {
+        buffer->data[buffer->size++] = (uint8_t)(bits >> (8 * i));
+    }
+}
+
+static inline void writeHeader(ByteBuffer *buffer, uint32_t type,
+                               uint32_t count) {
+    buffer->data[buffer->size++] = WKB_LITTLE_ENDIAN;
+    writeUint32(buffer, type);
+    writeUint32(buffer, count);
+}
+
+static void writeWkbRing(ByteBuffer *buffer, const GeoLoop *loop) {
+    writeUint32(buffer, loop->numVerts > 0 ? loop->numVerts + 1 : 0);
+    for (int i = 0; i <= loop->numVerts && loop->numVerts > 0; i++) {
+        const LatLng *vert = &loop->verts[i % loop->numVerts];
+        writeDouble(buffer, H3_EXPORT(radsToDegs)(vert->lng));
+        writeDouble(buffer, H3_EXPORT(radsToDegs)(vert->lat));
+    }
+}
+
+/**
+ * Number of bytes used by a loop in WKB, or 0 if it would overflow.
+ */
+static size_t wkbRingSize(const GeoLoop *loop) {
+    size_t numPoints = loop->numVerts > 0 ? (size_t)loop->numVerts + 1 : 0;
+    if (numPoints > (SIZE_MAX - 4) / WKB_POINT_SIZE) {
+        return 0;
+    }
+    return 4 + numPoints * WKB_POINT_SIZE;
+}
+
+/**
+ * Append a GeoMultiPolygon to a buffer as a little-endian WKB MultiPolygon.
+ *
+ * The exact size is computed first, so the buffer grows at most once.
+ *
+ * @param mpoly The multipolygon to write
+ * @param out Buffer to append to. On error, its size is unchanged.
+ * @return E_SUCCESS, E_DOMAIN for negative element counts, or an allocation
+ * error
+ */
+H3Error H3_EXPORT(geoMultiPolygonToWkb)(const GeoMultiPolygon *mpoly,
+                                        ByteBuffer *out) {
+    if (mpoly->numPolygons < 0) {
+        return E_DOMAIN;
+    }
+
+    size_t total = WKB_HEADER_SIZE;
+    for (int i = 0; i < mpoly->numPolygons; i++) {
+        const GeoPolygon *poly = &mpoly->polygons[i];
+        if (poly->numHoles < 0) {
+            return E_DOMAIN;
+        }
+        size_t polySize = WKB_HEADER_SIZE;
+        for (int j = -1; j < poly->numHoles; j++) {
+            const GeoLoop *loop = j < 0 ? &poly->geoloop : &poly->holes[j];
+            if (loop->numVerts < 0) {
+                return E_DOMAIN;
+            }
+            size_t ringSize = wkbRingSize(loop);
+            if (ringSize == 0 || ringSize > SIZE_MAX - polySize) {
+                return E_MEMORY_BOUNDS;
+            }
+            polySize += ringSize;
+        }
+        if (polySize > SIZE_MAX - total) {
+            return E_MEMORY_BOUNDS;
+        }
+        total += polySize;
+    }
+
+    H3Error err = reserveBytes(out, total);
+    if (err) {
+        return err;
+    }
+
+    writeHeader(out, WKB_MULTIPOLYGON, mpoly->numPolygons);
+    for (int i = 0; i < mpoly->numPolygons; i++) {
+        const GeoPolygon *poly = &mpoly->polygons[i];
+        writeHeader(out, WKB_POLYGON, poly->numHoles + 1);
+        writeWkbRing(out, &poly->geoloop);
+        for (int j = 0; j < poly->numHoles; j++) {
+            writeWkbRing(out, &poly->holes[j]);
+        }
+    }
+
+    return E_SUCCESS;
+}
+
+static H3Error appendString(ByteBuffer *buffer, const char *str) {
+    size_t len = strlen(str);
+    H3Error err = reserveBytes(buffer, len);
+    if (err) {
+        return err;
+    }
+    memcpy(buffer->data + buffer->size, str, len);
+    buffer->size += len;
+    return E_SUCCESS;
+}
+
+// Longest number written: sign, GEOJSON_MAX_DIGITS digits, decimal point
+// and a 5 character exponent
+#define GEOJSON_MAX_NUMBER_SIZE 24
+
+// Longest coordinate pair written: brackets, and two numbers separated by a
+// comma
+#define GEOJSON_MAX_POINT_SIZE (2 * GEOJSON_MAX_NUMBER_SIZE + 4)
+
+/**
+ * Write a finite number as "%.*g" does in the "C" locale. printf uses the
+ * decimal separator of the current locale (e.g. "," for de_DE), which is not
+ * valid JSON, so it is replaced with ".".
+ *
+ * @return Number of characters written, without a terminating null
+ */
+static size_t writeJsonNumber(char *out, double value, int digits) {
+    // Room for a decimal separator of several bytes
+    char formatted[GEOJSON_MAX_NUMBER_SIZE + MB_LEN_MAX];
+    snprintf(formatted, sizeof(formatted), "%.*g", digits, value);
+    const char *point = localeconv()->decimal_point;
+    size_t pointLen = point ? strlen(point) : 0;
+
+    size_t len = 0;
+    for (const char *c = formatted; *c;) {
+        if (pointLen > 0 && strncmp(c, point, pointLen) == 0) {
+            out[len++] = '.';
+            c += pointLen;
+        } else {
+            out[len++] = *c++;
+        }
+    }
+    return len;
+}
+
+static H3Error appendGeoJsonRing(ByteBuffer *buffer, const GeoLoop *loop,
+                                 int digits) {
+    H3Error err = appendString(buffer, "[");
+    for (int i = 0; !err && loop->numVerts > 0 && i <= loop->numVerts; i++) {
+        const LatLng *vert = &loop->verts[i % loop->numVerts];
+        if (!isfinite(vert->lat) || !isfinite(vert->lng)) {
+            return E_LATLNG_DOMAIN;
+        }
+        err = reserveBytes(buffer, GEOJSON_MAX_POINT_SIZE);
+        if (!err) {
+            char *out = (char *)buffer->data + buffer->size;
+            size_t len = 0;
+            if (i > 0) {
+                out[len++] = ',';
+            }
+            out[len++] = '[';
+            len += writeJsonNumber(out + len, H3_EXPORT(radsToDegs)(vert->lng),
+                                   digits);
+            out[len++] = ',';
+            len += writeJsonNumber(out + len, H3_EXPORT(radsToDegs)(vert->lat),
+                                   digits);
+            out[len++] = ']';
+            buffer->size += len;
+        }
+    }
+    return err ? err : appendString(buffer, "]");
+}
+
+/**
+ * Append a GeoMultiPolygon to a buffer as a GeoJSON MultiPolygon geometry
+ * object. The text is not null terminated. Numbers are written with a "."
+ * decimal point, whatever the current locale.
+ *
+ * @param mpoly The multipolygon to write
+ * @param digits Number of significant digits for each coordinate, from 1 to
+ *               GEOJSON_MAX_DIGITS (which round trips exactly)
+ * @param out Buffer to append to. On error, its size is unchanged.
+ * @return E_SUCCESS, E_DOMAIN for invalid `digits` or element counts,
+ * E_LATLNG_DOMAIN for non-finite coordinates, or an allocation error
+ */
+H3Error H3_EXPORT(geoMultiPolygonToGeoJson)(const GeoMultiPolygon *mpoly,
+                                            int digits, ByteBuffer *out) {
+    if (digits < 1 || digits > GEOJSON_MAX_DIGITS || mpoly->numPolygons < 0) {
+        return E_DOMAIN;
+    }
+
+    size_t start = out->size;
+    H3Error err =
+        appendString(out, "{\"type\":\"MultiPolygon\",\"coordinates\":[");
+    for (int i = 0; !err && i < mpoly->numPolygons; i++) {
+        const GeoPolygon *poly = &mpoly->polygons[i];
+        if (poly->numHoles < 0) {
+            err = E_DOMAIN;
+            break;
+        }
+        err = appendString(out, i > 0 ? ",[" : "[");
+        for (int j = -1; !err && j < poly->numHoles; j++) {
+            if (j >= 0) {
+                err = appendString(out, ",");
+            }
+            if (!err) {
+                err = appendGeoJsonRing(
+                    out, j < 0 ? &poly->geoloop : &poly->holes[j], digits);
+            }
+        }
+        if (!err) {
+            err = appendString(out, "]");
+        }
+    }
+    if (!err) {
+        err = appendString(out, "]}");
+    }
+
+    if (err) {
+        out->size = start;
+    }
+    return err;
+}
+
+/** Cursor over a WKB byte array */
+typedef struct {
+    const uint8_t *data;
+    size_t size;
+    size_t pos;
+    bool littleEndian;  ///< Byte order of the current geometry
+} WkbReader;
+
+static inline size_t wkbRemaining(const WkbReader *reader) {
+    return reader->size - reader->pos;
+}
+
+static bool readUint32(WkbReader *reader, uint32_t *value) {
+    if (wkbRemaining(reader) < 4) {
+        return false;
+    }
+    const uint8_t *p = reader->data + reader->pos;
+    *value = 0;
+    for (int i = 0; i < 4; i++) {
+        int shift = reader->littleEndian ? 8 * i : 8 * (3 - i);
+        *value |= (uint32_t)p[i] << shift;
+    }
+    reader->pos += 4;
+    return true;
+}
+
+static bool readDouble(WkbReader *reader, double *value) {
+    if (wkbRemaining(reader) < 8) {
+        return false;
+    }
+    const uint8_t *p = reader->data + reader->pos;
+    uint64_t bits = 0;
+    for (int i = 0; i < 8; i++) {
+        int shift = reader->littleEndian ? 8 * i : 8 * (7 - i);
+        bits |= (uint64_t)p[i] << shift;
+    }
+    memcpy(value, &bits, sizeof(bits));
+    reader->pos += 8;
+    return true;
+}
+
+/**
+ * Read a geometry header (byte order and type), returning the 2D geometry
+ * type. Skips an EWKB SRID. Returns 0 if the header is truncated, invalid, or
+ * has Z or M coordinates.
+ */
+static uint32_t readGeometryType(WkbReader *reader) {
+    if (wkbRemaining(reader) < 1) {
+        return 0;
+    }
+    uint8_t order = reader->data[reader->pos++];
+    if (order != WKB_BIG_ENDIAN && order != WKB_LITTLE_ENDIAN) {
+        return 0;
+    }
+    reader->littleEndian = order == WKB_LITTLE_ENDIAN;
+
+    uint32_t type;
+    if (!readUint32(reader, &type) || (type & EWKB_ZM_FLAGS)) {
+        return 0;
+    }
+    if (type & EWKB_SRID_FLAG) {
+        uint32_t srid;
+        if (!readUint32(reader, &srid)) {
+            return 0;
+        }
+        type &= ~EWKB_SRID_FLAG;
+    }
+    // ISO WKB uses types of 1000 and up for Z and M coordinates
+    return type < 1000 ? type : 0;
+}
+
+/**
+ * Read an element count that cannot exceed the remaining input, given the
+ * minimum size of each element. This bounds allocations by the input size.
+ */
+static bool readCount(WkbReader *reader, size_t minElementSize, int *count) {
+    uint32_t value;
+    if (!readUint32(reader, &value) || value > INT_MAX ||
+        value > wkbRemaining(reader) / minElementSize) {
+        return false;
+    }
+    *count = (int)value;
+    return true;
+}
+
+static H3Error readWkbRing(WkbReader *reader, GeoLoop *loop) {
+    int numPoints;
+    if (!readCount(reader, WKB_POINT_SIZE, &numPoints)) {
+        return E_DOMAIN;
+    }
+    if (numPoints == 0) {
+        return E_SUCCESS;
+    }
+
+    loop->verts = H3_MEMORY(malloc)(numPoints * sizeof(LatLng));
+    if (!loop->verts) {
+        return E_MEMORY_ALLOC;
+    }
+    for (int i = 0; i < numPoints; i++) {
+        double x, y;
+        if (!readDouble(reader, &x) || !readDouble(reader, &y)) {
+            return E_DOMAIN;
+        }
+        if (!isfinite(x) || !isfinite(y)) {
+            return E_LATLNG_DOMAIN;
+        }
+        loop->verts[i].lat = H3_EXPORT(degsToRads)(y);
+        loop->verts[i].lng = H3_EXPORT(degsToRads)(x);
+        loop->numVerts++;
+    }
+
+    // Drop the closing vertex, since GeoLoops are implicitly closed
+    if (numPoints > 1 && loop->verts[0].lat == loop->verts[numPoints - 1].lat &&
+        loop->verts[0].lng == loop->verts[numPoints - 1].lng) {
+        loop->numVerts--;
+    }
+    return E_SUCCESS;
+}
+
+static H3Error readWkbPolygon(WkbReader *reader, GeoPolygon *poly) {
+    int numRings;
+    if (!readCount(reader, 4, &numRings) || numRings == 0) {
+        return E_DOMAIN;
+    }
+    if (numRings > 1) {
+        poly->holes = H3_MEMORY(calloc)(numRings - 1, sizeof(GeoLoop));
+        if (!poly->holes) {
+            return E_MEMORY_ALLOC;
+        }
+        poly->numHoles = numRings - 1;
+    }
+
+    H3Error err = readWkbRing(reader, &poly->geoloop);
+    for (int i = 0; !err && i < poly->numHoles; i++) {
+        err = readWkbRing(reader, &poly->holes[i]);
+    }
+    return err;
+}
+
+/**
+ * Parse a WKB or EWKB Polygon or MultiPolygon into a GeoMultiPolygon.
+ *
+ * Either byte order is accepted, and an EWKB SRID is ignored. Geometries with
+ * Z or M coordinates are not supported. Coordinates are read as (longitude,
+ * latitude) in degrees, and a repeated closing vertex is dropped from each
+ * ring.
+ *
+ * @param wkb The WKB bytes
+ * @param wkbSize Number of bytes, all of which must be part of the geometry
+ * @param out Output multipolygon, to be freed with destroyGeoMultiPolygon.
+ *            Not set on error.
+ * @return E_SUCCESS, E_DOMAIN for malformed or unsupported input,
+ * E_LATLNG_DOMAIN for non-finite coordinates, or E_MEMORY_ALLOC
+ */
+H3Error H3_EXPORT(wkbToGeoMultiPolygon)(const uint8_t *wkb, size_t wkbSize,
+                                        GeoMultiPolygon *out) {
+    WkbReader reader = {.data = wkb, .size = wkbSize};
+    GeoMultiPolygon mpoly = {0};
+
+    uint32_t type = readGeometryType(&reader);
+    int numPolygons;
+    if (type == WKB_POLYGON) {
+        numPolygons = 1;
+    } else if (type == WKB_MULTIPOLYGON) {
+        if (!readCount(&reader, WKB_HEADER_SIZE, &numPolygons)) {
+            return E_DOMAIN;
+        }
+    } else {
+        return E_DOMAIN;
+    }
+
+    H3Error err = E_SUCCESS;
+    if (numPolygons > 0) {
+        mpoly.polygons = H3_MEMORY(calloc)(numPolygons, sizeof(GeoPolygon));
+        if (!mpoly.polygons) {
+            return E_MEMORY_ALLOC;
+        }
+        mpoly.numPolygons = numPolygons;
+    }
+    for (int i = 0; !err && i < numPolygons; i++) {
+        if (type == WKB_MULTIPOLYGON &&
+            readGeometryType(&reader) != WKB_POLYGON) {
+            err = E_DOMAIN;
+            break;
+        }
+        err = readWkbPolygon(&reader, &mpoly.polygons[i]);
+    }
+    if (!err && wkbRemaining(&reader) > 0) {
+        // Trailing bytes
+        err = E_DOMAIN;
+    }
+
+    if (err) {
+        H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+        return err;
+    }
+    *out = mpoly;
+    return E_SUCCESS;
+}
+
+/**
+ * maxPolygonToCellsSizeWkb returns the number of cells to allocate space for
+ * when calling polygonToCellsWkb on the given WKB Polygon or MultiPolygon.
+ *
+ * @param wkb The WKB bytes, as accepted by wkbToGeoMultiPolygon
+ * @param wkbSize Number of bytes
+ * @param res Resolution of the cells
+ * @param flags Containment mode, as for polygonToCellsExperimental
+ * @param out The number of cells to allocate
+ * @return E_SUCCESS (0) on success, or another value otherwise.
+ */
+H3Error H3_EXPORT(maxPolygonToCellsSizeWkb)(const uint8_t *wkb,
+                                            size_t wkbSize, int res,
+                                            uint32_t flags, int64_t *out) {
+    GeoMultiPolygon mpoly;
+    H3Error err = H3_EXPORT(wkbToGeoMultiPolygon)(wkb, wkbSize, &mpoly);
+    if (err) {
+        return err;
+    }
+    err = H3_EXPORT(maxMultiPolygonToCellsSizeExperimental)(&mpoly, res,
+                                                            flags, out);
+    H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+    return err;
+}
+
+/**
+ * polygonToCellsWkb fills the cells within a WKB Polygon or MultiPolygon,
+ * as multiPolygonToCellsExperimental does for a GeoMultiPolygon.
+ *
+ * @param wkb The WKB bytes, as accepted by wkbToGeoMultiPolygon
+ * @param wkbSize Number of bytes
+ * @param res Resolution of the cells
+ * @param flags Containment mode, as for polygonToCellsExperimental
+ * @param size Size of the output array, from maxPolygonToCellsSizeWkb
+ * @param out Output array, zero-filled
+ * @return E_SUCCESS (0) on success, or another value otherwise.
+ */
+H3Error H3_EXPORT(polygonToCellsWkb)(const uint8_t *wkb, size_t wkbSize,
+                                     int res, uint32_t flags, int64_t size,
+                                     H3Index *out) {
+    GeoMultiPolygon mpoly;
+    H3Error err = H3_EXPORT(wkbToGeoMultiPolygon)(wkb, wkbSize, &mpoly);
+    if (err) {
+        return err;
+    }
+    err = H3_EXPORT(multiPolygonToCellsExperimental)(&mpoly, res, flags, size,
+                                                     out, NULL);
+    H3_EXPORT(destroyGeoMultiPolygon)(&mpoly);
+    return err;
+}
+
+/**
+ * Free the memory held by a ByteBuffer and reset it to empty.
+ */
+void H3_EXPORT(destroyByteBuffer)(ByteBuffer *buffer) {
+    H3_MEMORY(free)(buffer->data);
+    *buffer = (ByteBuffer){0};
+}
@@ -32,6 +32,7 @@
 #include "iterators.h"
 #include "mathExtensions.h"
 #include "vertex.h"
+#include "workspace.h"
 
 // TODO: https://github.com/uber/h3/issues/984
 static const bool isBaseCellPentagonArr[128] = {
@@ -121,6 +122,52 @@ H3Error H3_EXPORT(getIndexDigit)(H3Index h, int res, int *out) {
     return E_SUCCESS;
 }
 
+/**
+ * Returns the resolution of each of an array of H3 indexes, as
+ * getResolution.
+ *
+ * @param h3s The H3 indexes
+ * @param numH3s Number of indexes
+ * @param out Output, the resolution of each index
+ * @return E_SUCCESS, or E_DOMAIN if numH3s is negative
+ */
+H3Error H3_EXPORT(getResolutions)(const H3Index *h3s, int64_t numH3s,
+                                  int *out) {
+    if (numH3s < 0) {
+        return E_DOMAIN;
+    }
+    for (int64_t i = 0; i < numH3s; i++) {
+        out[i] = H3_GET_RESOLUTION(h3s[i]);
+    }
+    return E_SUCCESS;
+}
+
+/**
+ * Returns the index digit at `res` of each of an array of H3 indexes, as
+ * getIndexDigit.
+ *
+ * @param h3s The H3 indexes
+ * @param numH3s Number of indexes
+ * @param res Which indexing digit to retrieve, starting with 1.
+ * @param out Output, the indexing digit of each index
+ * @return E_SUCCESS, E_RES_DOMAIN for an invalid res, or E_DOMAIN if numH3s
+ * is negative
+ */
+H3Error H3_EXPORT(getIndexDigits)(const H3Index *h3s, int64_t numH3s, int res,
+                                  int *out) {
+    if (res < 1 || res > MAX_H3_RES) {
+        return E_RES_DOMAIN;
+    }
+    if (numH3s < 0) {
+        return E_DOMAIN;
+    }
+    const int shift = (MAX_H3_RES - res) * H3_PER_DIGIT_OFFSET;
+    for (int64_t i = 0; i < numH3s; i++) {
+        out[i] = (int)((h3s[i] >> shift) & H3_DIGIT_MASK);
+    }
+    return E_SUCCESS;
+}
+
 /**
  * Create a cell from its components (resolution, base cell, children digits).
  * Only allows for constructing valid H3 cells.
@@ -204,6 +251,236 @@ H3Error H3_EXPORT(h3ToString)(H3Index h, char *str, size_t sz) {
     return E_SUCCESS;
 }
 
+/*
+Value plus one of each hex digit character, so that zero (the default) marks
+an invalid character. Decoding accumulates an invalid flag instead of
+branching on each character.
+*/
+static const uint8_t hexValues[256] = {
+    ['0'] = 0x0 + 1, ['1'] = 0x1 + 1, ['2'] = 0x2 + 1, ['3'] = 0x3 + 1,
+    ['4'] = 0x4 + 1, ['5'] = 0x5 + 1, ['6'] = 0x6 + 1, ['7'] = 0x7 + 1,
+    ['8'] = 0x8 + 1, ['9'] = 0x9 + 1, ['a'] = 0xa + 1, ['b'] = 0xb + 1,
+    ['c'] = 0xc + 1, ['d'] = 0xd + 1, ['e'] = 0xe + 1, ['f'] = 0xf + 1,
+    ['A'] = 0xa + 1, ['B'] = 0xb + 1, ['C'] = 0xc + 1, ['D'] = 0xd + 1,
+    ['E'] = 0xe + 1, ['F'] = 0xf + 1};
+
+static const char hexDigits[16] = {'0', '1', '2', '3', '4', '5', '6', '7',
+                                   '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+
+/**
+ * Decode `len` hex digits.
+ * @return E_SUCCESS, or E_FAILED if the string is empty, longer than 16
+ * digits or contains a non hex digit
+ */
+static inline H3Error _decodeHex(const char *str, size_t len, H3Index *out) {
+    if (len == 0 || len > 16) {
+        return E_FAILED;
+    }
+    H3Index h = 0;
+    int invalid = 0;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t v = hexValues[(unsigned char)str[i]];
+        invalid |= v == 0;
+        h = (h << 4) | ((v - 1) & 0xf);
+    }
+    if (invalid) {
+        return E_FAILED;
+    }
+    *out = h;
+    return E_SUCCESS;
+}
+
+/** Number of hex digits in `h`, without leading zeros */
+static inline int _hexLength(H3Index h) {
+    int len = 1;
+    while (len < 16 && (h >> (4 * len))) {
+        len++;
+    }
+    return len;
+}
+
+/** Write the `len` low hex digits of `h` */
+static inline void _encodeHex(H3Index h, int len, char *str) {
+    for (int i = len - 1; i >= 0; i--) {
+        str[i] = hexDigits[h & 0xf];
+        h >>= 4;
+    }
+}
+
+/**
+ * Decode a hex string into a valid index: a cell, directed edge or vertex.
+ * @return E_SUCCESS, E_FAILED if the string is not hex as for _decodeHex, or
+ * E_INDEX_INVALID if it is not a valid index. On error, `out` is H3_NULL.
+ */
+static inline H3Error _decodeIndex(const char *str, size_t len,
+                                   H3Index *out) {
+    H3Error err = _decodeHex(str, len, out);
+    if (!err && !H3_EXPORT(isValidIndex)(*out)) {
+        err = E_INDEX_INVALID;
+    }
+    if (err) {
+        *out = H3_NULL;
+    }
+    return err;
+}
+
+/**
+ * Parses a buffer of hex strings separated by `delimiter`, such as a column
+ * of a CSV file. A trailing delimiter is ignored, and if the delimiter is a
+ * newline a carriage return before it is also ignored.
+ *
+ * Unlike stringToH3, every string must consist only of 1 to 16 hex digits:
+ * no whitespace, sign or "0x" prefix, and must be a valid index, as
+ * isValidIndex. Errors are reported per string: a failing string gives
+ * H3_NULL, and has its bit set in errorBitmap.
+ *
+ * @param buf Buffer of strings, not necessarily null terminated
+ * @param size Size of `buf` in bytes
+ * @param delimiter Character separating strings
+ * @param out Output array of indexes
+ * @param maxOut Size of `out`
+ * @param numOut Number of indexes written to `out`
+ * @param errorBitmap Output, error bitmap of the strings (see h3Index.h),
+ *                    with room for maxOut strings. Only the words of the
+ *                    strings parsed are written.
+ * @return E_SUCCESS, the error of the first string that failed (E_FAILED if
+ * it is not hex, E_INDEX_INVALID if it is not a valid index), or
+ * E_MEMORY_BOUNDS if `out` is too small. On E_MEMORY_BOUNDS, `numOut` is the
+ * number of strings parsed.
+ */
+H3Error H3_EXPORT(stringsToH3)(const char *buf, size_t size, char delimiter,
+                               H3Index *out, int64_t maxOut, int64_t *numOut,
+                               uint64_t *errorBitmap) {
+    H3Error firstError = E_SUCCESS;
+    uint64_t errorWord = 0;
+    int64_t n = 0;
+    size_t start = 0;
+    *numOut = 0;
+    while (start < size) {
+        const char *end = memchr(buf + start, delimiter, size - start);
+        size_t stop = end ? (size_t)(end - buf) : size;
+        size_t len = stop - start;
+        if (delimiter == '\n' && len > 0 && buf[stop - 1] == '\r') {
+            len--;
+        }
+        if (n >= maxOut) {
+            firstError = E_MEMORY_BOUNDS;
+            break;
+        }
+        H3Error err = _decodeIndex(buf + start, len, &out[n]);
+        if (err) {
+            errorWord |= (uint64_t)1 << (n % 64);
+            if (!firstError) firstError = err;
+        }
+        *numOut = ++n;
+        if (n % 64 == 0) {
+            if (errorBitmap) errorBitmap[n / 64 - 1] = errorWord;
+            errorWord = 0;
+        }
+        start = stop + 1;
+    }
+    if (errorBitmap && n % 64 != 0) {
+        errorBitmap[n / 64] = errorWord;
+    }
+    return firstError;
+}
+
+/**
+ * Parses `numStrings` hex strings of exactly `width` characters each, packed
+ * without delimiters, such as a fixed width binary column. Strings are
+ * validated as for stringsToH3.
+ *
+ * @param buf Buffer of numStrings * width characters
+ * @param numStrings Number of strings
+ * @param width Characters per string, 1 to 16
+ * @param out Output array of size numStrings
+ * @param errorBitmap Output, error bitmap of the strings (see h3Index.h)
+ * @return E_SUCCESS, E_DOMAIN on an invalid width or count, or the error of
+ * the first string that failed, as for stringsToH3
+ */
+H3Error H3_EXPORT(stringsToH3Fixed)(const char *buf, int64_t numStrings,
+                                    int width, H3Index *out,
+                                    uint64_t *errorBitmap) {
+    if (width < 1 || width > 16 || numStrings < 0) {
+        return E_DOMAIN;
+    }
+    H3Error firstError = E_SUCCESS;
+    for (int64_t start = 0; start < numStrings; start += 64) {
+        int64_t blockSize = numStrings - start < 64 ? numStrings - start : 64;
+        uint64_t errorWord = 0;
+        for (int64_t i = start; i < start + blockSize; i++) {
+            H3Error err = _decodeIndex(buf + i * width, width, &out[i]);
+            if (err) {
+                errorWord |= (uint64_t)1 << (i - start);
+                if (!firstError) firstError = err;
+            }
+        }
+        if (errorBitmap) {
+            errorBitmap[start / 64] = errorWord;
+        }
+    }
+    return firstError;
+}
+
+/**
+ * Formats indexes as hex strings separated by `delimiter`, in the same format
+ * as h3ToString. No delimiter follows the last string, and the output is not
+ * null terminated. At most 17 bytes are needed per index.
+ *
+ * @param h3s Indexes to format
+ * @param numH3s Number of indexes
+ * @param delimiter Character separating strings
+ * @param buf Output buffer
+ * @param size Size of `buf` in bytes
+ * @param written Number of bytes written to `buf`
+ * @return E_SUCCESS, or E_MEMORY_BOUNDS if `buf` is too small
+ */
+H3Error H3_EXPORT(h3sToStrings)(const H3Index *h3s, int64_t numH3s,
+                                char delimiter, char *buf, size_t size,
+                                size_t *written) {
+    size_t pos = 0;
+    *written = 0;
+    for (int64_t i = 0; i < numH3s; i++) {
+        int len = _hexLength(h3s[i]);
+        size_t needed = (size_t)len + (i > 0);
+        if (needed > size - pos) {
+            return E_MEMORY_BOUNDS;
+        }
+        if (i > 0) {
+            buf[pos++] = delimiter;
+        }
+        _encodeHex(h3s[i], len, buf + pos);
+        pos += len;
+    }
+    *written = pos;
+    return E_SUCCESS;
+}
+
+/**
+ * Formats indexes as zero padded hex strings of exactly `width` characters,
+ * packed without delimiters. Valid cells need 15 characters.
+ *
+ * @param h3s Indexes to format
+ * @param numH3s Number of indexes
+ * @param width Characters per string, 1 to 16
+ * @param buf Output buffer of numH3s * width characters
+ * @return E_SUCCESS, E_DOMAIN on an invalid width or count, or
+ * E_MEMORY_BOUNDS if an index needs more than `width` digits
+ */
+H3Error H3_EXPORT(h3sToStringsFixed)(const H3Index *h3s, int64_t numH3s,
+                                     int width, char *buf) {
+    if (width < 1 || width > 16 || numH3s < 0) {
+        return E_DOMAIN;
+    }
+    for (int64_t i = 0; i < numH3s; i++) {
+        if (width < 16 && (h3s[i] >> (4 * width))) {
+            return E_MEMORY_BOUNDS;
+        }
+        _encodeHex(h3s[i], width, buf + i * width);
+    }
+    return E_SUCCESS;
+}
+
 /*
 The top 8 bits of any cell should be a specific constant:
 
@@ -336,11 +613,9 @@ static inline bool _hasDeletedSubsequence(H3Index h, int base_cell) {
 }
 
 /**
- * Returns whether or not an H3 index is a valid cell (hexagon or pentagon).
- * @param h The H3 index to validate.
- * @return 1 if the H3 index if valid, and 0 if it is not.
+ * Inlined body of isValidCell, shared with areValidCells.
  */
-int H3_EXPORT(isValidCell)(H3Index h) {
+static inline bool _isValidCell(H3Index h) {
     /*
     Look for bit patterns that would disqualify an H3Index from
     being valid. If identified, exit early.
@@ -379,6 +654,13 @@ int H3_EXPORT(isValidCell)(H3Index h) {
     return true;
 }
 
+/**
+ * Returns whether or not an H3 index is a valid cell (hexagon or pentagon).
+ * @param h The H3 index to validate.
+ * @return 1 if the H3 index if valid, and 0 if it is not.
+ */
+int H3_EXPORT(isValidCell)(H3Index h) { return _isValidCell(h); }
+
 /**
  * Returns whether or not an H3 index is valid for any mode (cell, directed
  * edge, or vertex).
@@ -390,6 +672,46 @@ int H3_EXPORT(isValidIndex)(H3Index h) {
            H3_EXPORT(isValidVertex)(h);
 }
 
+/**
+ * Validates an array of H3 indexes as cells, as isValidCell.
+ *
+ * Indexes are checked in blocks of 64, one bitmap word at a time. If
+ * validBitmap is NULL, checking stops at the first block containing an
+ * invalid index.
+ *
+ * @param cells Indexes to validate
+ * @param numCells Number of indexes
+ * @param validBitmap Output, bitmap of the indexes that are valid cells (see
+ *                    h3Index.h). May be NULL.
+ * @param allValid Output, 1 if every index is a valid cell, 0 otherwise.
+ * @return E_SUCCESS, or E_DOMAIN if numCells is negative
+ */
+H3Error H3_EXPORT(areValidCells)(const H3Index *cells, int64_t numCells,
+                                 uint64_t *validBitmap, int *allValid) {
+    if (numCells < 0) {
+        return E_DOMAIN;
+    }
+    uint64_t invalid = 0;
+    for (int64_t start = 0; start < numCells; start += 64) {
+        int64_t blockSize = numCells - start < 64 ? numCells - start : 64;
+        const H3Index *block = cells + start;
+        uint64_t word = 0;
+        for (int64_t i = 0; i < blockSize; i++) {
+            word |= (uint64_t)_isValidCell(block[i]) << i;
+        }
+        uint64_t full = blockSize == 64 ? UINT64_MAX
+                                        : ((uint64_t)1 << blockSize) - 1;
+        invalid |= word ^ full;
+        if (validBitmap) {
+            validBitmap[start / 64] = word;
+        } else if (invalid) {
+            break;
+        }
+    }
+    *allValid = invalid == 0;
+    return E_SUCCESS;
+}
+
 /**
  * Initializes an H3 index.
  * @param hp The H3 index to initialize.
@@ -487,21 +809,157 @@ H3Index makeDirectChild(H3Index h, int cellNumber) {
     return childH;
 }
 
+/**
+ * The last 3 digits of the children of a hexagon in order, as octal numbers
+ * whose digits are the cell digits. Children are written by OR'ing these,
+ * shifted to the child resolution, onto the first child, 343 at a time.
+ */
+static const uint16_t childDigitTemplates[343] = {
+    0000, 0001, 0002, 0003, 0004, 0005, 0006,
+    0010, 0011, 0012, 0013, 0014, 0015, 0016,
+    0020, 0021, 0022, 0023, 0024, 0025, 0026,
+    0030, 0031, 0032, 0033, 0034, 0035, 0036,
+    0040, 0041, 0042, 0043, 0044, 0045, 0046,
+    0050, 0051, 0052, 0053, 0054, 0055, 0056,
+    0060, 0061, 0062, 0063, 0064, 0065, 0066,
+    0100, 0101, 0102, 0103, 0104, 0105, 0106,
+    0110, 0111, 0112, 0113, 0114, 0115, 0116,
+    0120, 0121, 0122, 0123, 0124, 0125, 0126,
+    0130, 0131, 0132, 0133, 0134, 0135, 0136,
+    0140, 0141, 0142, 0143, 0144, 0145, 0146,
+    0150, 0151, 0152, 0153, 0154, 0155, 0156,
+    0160, 0161, 0162, 0163, 0164, 0165, 0166,
+    0200, 0201, 0202, 0203, 0204, 0205, 0206,
+    0210, 0211, 0212, 0213, 0214, 0215, 0216,
+    0220, 0221, 0222, 0223, 0224, 0225, 0226,
+    0230, 0231, 0232, 0233, 0234, 0235, 0236,
+    0240, 0241, 0242, 0243, 0244, 0245, 0246,
+    0250, 0251, 0252, 0253, 0254, 0255, 0256,
+    0260, 0261, 0262, 0263, 0264, 0265, 0266,
+    0300, 0301, 0302, 0303, 0304, 0305, 0306,
+    0310, 0311, 0312, 0313, 0314, 0315, 0316,
+    0320, 0321, 0322, 0323, 0324, 0325, 0326,
+    0330, 0331, 0332, 0333, 0334, 0335, 0336,
+    0340, 0341, 0342, 0343, 0344, 0345, 0346,
+    0350, 0351, 0352, 0353, 0354, 0355, 0356,
+    0360, 0361, 0362, 0363, 0364, 0365, 0366,
+    0400, 0401, 0402, 0403, 0404, 0405, 0406,
+    0410, 0411, 0412, 0413, 0414, 0415, 0416,
+    0420, 0421, 0422, 0423, 0424, 0425, 0426,
+    0430, 0431, 0432, 0433, 0434, 0435, 0436,
+    0440, 0441, 0442, 0443, 0444, 0445, 0446,
+    0450, 0451, 0452, 0453, 0454, 0455, 0456,
+    0460, 0461, 0462, 0463, 0464, 0465, 0466,
+    0500, 0501, 0502, 0503, 0504, 0505, 0506,
+    0510, 0511, 0512, 0513, 0514, 0515, 0516,
+    0520, 0521, 0522, 0523, 0524, 0525, 0526,
+    0530, 0531, 0532, 0533, 0534, 0535, 0536,
+    0540, 0541, 0542, 0543, 0544, 0545, 0546,
+    0550, 0551, 0552, 0553, 0554, 0555, 0556,
+    0560, 0561, 0562, 0563, 0564, 0565, 0566,
+    0600, 0601, 0602, 0603, 0604, 0605, 0606,
+    0610, 0611, 0612, 0613, 0614, 0615, 0616,
+    0620, 0621, 0622, 0623, 0624, 0625, 0626,
+    0630, 0631, 0632, 0633, 0634, 0635, 0636,
+    0640, 0641, 0642, 0643, 0644, 0645, 0646,
+    0650, 0651, 0652, 0653, 0654, 0655, 0656,
+    0660, 0661, 0662, 0663, 0664, 0665, 0666,
+};
+
+/**
+ * Writes the children of a hexagon in order, as cellToChildren.
+ *
+ * @param first The first child, whose new digits are 0
+ * @param numDigits Number of new digits, i.e. childRes - parentRes
+ * @param childRes Resolution of the children
+ * @param children Output, 7^numDigits children
+ * @return Number of children written
+ */
+static int64_t _hexagonChildren(H3Index first, int numDigits, int childRes,
+                                H3Index *children) {
+    const int shift = (MAX_H3_RES - childRes) * H3_PER_DIGIT_OFFSET;
+    if (numDigits <= 3) {
+        int64_t count = _ipow(7, numDigits);
+        for (int64_t i = 0; i < count; i++) {
+            children[i] = first | ((uint64_t)childDigitTemplates[i] << shift);
+        }
+        return count;
+    }
+    // Count through the digits above the last 3 in base 7, writing a block
+    // of 343 children for each.
+    const int numHighDigits = numDigits - 3;
+    const int highShift = shift + 3 * H3_PER_DIGIT_OFFSET;
+    const int64_t numBlocks = _ipow(7, numHighDigits);
+    uint64_t high = 0;
+    for (int64_t b = 0; b < numBlocks; b++) {
+        H3Index block = first | high;
+        H3Index *out = children + b * 343;
+        for (int i = 0; i < 343; i++) {
+            out[i] = block | ((uint64_t)childDigitTemplates[i] << shift);
+        }
+        high += (uint64_t)1 << highShift;
+        // A digit of 7 carries: adding 1 makes it 0 and increments the next
+        for (int d = 0; d < numHighDigits - 1; d++) {
+            int digitShift = highShift + d * H3_PER_DIGIT_OFFSET;
+            if (((high >> digitShift) & H3_DIGIT_MASK) != INVALID_DIGIT) {
+                break;
+            }
+            high += (uint64_t)1 << digitShift;
+        }
+    }
+    return numBlocks * 343;
+}
+
+/**
+ * Writes the children of a pentagon in order, as cellToChildren. The
+ * children of its center child come first, then those of its hexagon
+ * children, skipping the deleted digit 1.
+ *
+ * @param first The first child, whose new digits are 0
+ * @param parentRes Resolution of the pentagon
+ * @param childRes Resolution of the children
+ * @param children Output
+ * @return Number of children written
+ */
+static int64_t _pentagonChildren(H3Index first, int parentRes, int childRes,
+                                 H3Index *children) {
+    if (parentRes == childRes) {
+        children[0] = first;
+        return 1;
+    }
+    int64_t count =
+        _pentagonChildren(first, parentRes + 1, childRes, children);
+    for (Direction digit = J_AXES_DIGIT; digit < NUM_DIGITS; digit++) {
+        H3Index hexagon = first;
+        H3_SET_INDEX_DIGIT(hexagon, parentRes + 1, digit);
+        count += _hexagonChildren(hexagon, childRes - parentRes - 1, childRes,
+                                  children + count);
+    }
+    return count;
+}
+
 /**
  * cellToChildren takes the given hexagon id and generates all of the children
  * at the specified resolution storing them into the provided memory pointer.
  * It's assumed that cellToChildrenSize was used to determine the allocation.
  *
+ * Children are written in blocks from precomputed digit templates rather
+ * than stepping an IterCellsChildren per child, in the same order.
+ *
  * @param h H3Index to find the children of
  * @param childRes int the child level to produce
  * @param children H3Index* the memory to store the resulting addresses in
  */
 H3Error H3_EXPORT(cellToChildren)(H3Index h, int childRes, H3Index *children) {
-    int64_t i = 0;
-    for (IterCellsChildren iter = iterInitParent(h, childRes); iter.h;
-         iterStepChild(&iter)) {
-        children[i] = iter.h;
-        i++;
+    if (h == H3_NULL || !_hasChildAtRes(h, childRes)) return E_SUCCESS;
+
+    int parentRes = H3_GET_RESOLUTION(h);
+    H3Index first = _zeroIndexDigits(h, parentRes + 1, childRes);
+    H3_SET_RESOLUTION(first, childRes);
+    if (H3_EXPORT(isPentagon)(first)) {
+        _pentagonChildren(first, parentRes, childRes, children);
+    } else {
+        _hexagonChildren(first, childRes - parentRes, childRes, children);
     }
     return E_SUCCESS;
 }
@@ -543,43 +1001,129 @@ H3Error H3_EXPORT(cellToCenterChild)(H3Index h, int childRes, H3Index *child) {
 }
 
 /**
- * compactCells takes a set of hexagons all at the same resolution and
- * compresses them by pruning full child branches to the parent level. This is
- * also done for all parents recursively to get the minimum number of hex
- * addresses that perfectly cover the defined space.
- * @param h3Set Set of hexagons
- * @param compactedSet The output array of compressed hexagons (preallocated)
- * @param numHexes The size of the input and output arrays (possible that no
- * contiguous regions exist in the set at all and no compression possible)
- * @return an error code on bad input data
+ * Mask of the digits of a cell at `res` that are after its resolution,
+ * i.e. the digits set to 7 in a valid cell.
  */
-H3Error H3_EXPORT(compactCells)(const H3Index *h3Set, H3Index *compactedSet,
-                                const int64_t numHexes) {
-    if (numHexes == 0) {
-        return E_SUCCESS;
+static inline uint64_t _unusedDigitsMask(int res) {
+    return ((uint64_t)1 << ((MAX_H3_RES - res) * H3_PER_DIGIT_OFFSET)) - 1;
+}
+
+/**
+ * Produces the parent of each of an array of cells at one resolution, as
+ * cellToParent.
+ *
+ * Errors are reported per cell rather than stopping at the first: a cell
+ * with a resolution finer than parentRes has its output set to H3_NULL and
+ * its bit set in errorBitmap. The loop has no branches on the cells.
+ *
+ * @param cells Cells to find the parents of
+ * @param numCells Number of cells
+ * @param parentRes Resolution of the parents
+ * @param out Output, numCells parents
+ * @param errorBitmap Output, error bitmap of the cells (see h3Index.h)
+ * @return E_SUCCESS, E_RES_MISMATCH if any cell failed, E_RES_DOMAIN for an
+ * invalid parentRes, or E_DOMAIN if numCells is negative
+ */
+H3Error H3_EXPORT(cellsToParent)(const H3Index *cells, int64_t numCells,
+                                 int parentRes, H3Index *out,
+                                 uint64_t *errorBitmap) {
+    if (parentRes < 0 || parentRes > MAX_H3_RES) {
+        return E_RES_DOMAIN;
     }
-    int res = H3_GET_RESOLUTION(h3Set[0]);
-    if (res == 0) {
-        // No compaction possible, just copy the set to output
-        for (int64_t i = 0; i < numHexes; i++) {
-            compactedSet[i] = h3Set[i];
+    if (numCells < 0) {
+        return E_DOMAIN;
+    }
+    const uint64_t parentDigits = _unusedDigitsMask(parentRes);
+    const uint64_t parentResBits = (uint64_t)parentRes << H3_RES_OFFSET;
+    uint64_t anyError = 0;
+    for (int64_t start = 0; start < numCells; start += 64) {
+        int64_t blockSize = numCells - start < 64 ? numCells - start : 64;
+        uint64_t word = 0;
+        for (int64_t i = 0; i < blockSize; i++) {
+            H3Index h = cells[start + i];
+            int childRes = H3_GET_RESOLUTION(h);
+            uint64_t error = childRes < parentRes;
+            // Set the digits from parentRes + 1 to childRes to 7
+            H3Index parent = (h & ~H3_RES_MASK) | parentResBits |
+                             (parentDigits & ~_unusedDigitsMask(childRes));
+            out[start + i] = parent & (error - 1);
+            word |= error << i;
+        }
+        anyError |= word;
+        if (errorBitmap) {
+            errorBitmap[start / 64] = word;
         }
-        return E_SUCCESS;
     }
-    H3Index *remainingHexes = H3_MEMORY(malloc)(numHexes * sizeof(H3Index));
-    if (!remainingHexes) {
-        return E_MEMORY_ALLOC;
+    return anyError ? E_RES_MISMATCH : E_SUCCESS;
+}
+
+/**
+ * Produces the center child of each of an array of cells at one resolution,
+ * as cellToCenterChild.
+ *
+ * Errors are reported per cell as for cellsToParent: a cell with a
+ * resolution finer than childRes has its output set to H3_NULL and its bit
+ * set in errorBitmap.
+ *
+ * @param cells Cells to find the center children of
+ * @param numCells Number of cells
+ * @param childRes Resolution of the children
+ * @param out Output, numCells children
+ * @param errorBitmap Output, error bitmap of the cells (see h3Index.h)
+ * @return E_SUCCESS, or E_RES_DOMAIN if any cell failed or for an invalid
+ * childRes, or E_DOMAIN if numCells is negative
+ */
+H3Error H3_EXPORT(cellsToCenterChild)(const H3Index *cells, int64_t numCells,
+                                      int childRes, H3Index *out,
+                                      uint64_t *errorBitmap) {
+    if (childRes < 0 || childRes > MAX_H3_RES) {
+        return E_RES_DOMAIN;
     }
-    memcpy(remainingHexes, h3Set, numHexes * sizeof(H3Index));
-    H3Index *hashSetArray = H3_MEMORY(calloc)(numHexes, sizeof(H3Index));
-    if (!hashSetArray) {
-        H3_MEMORY(free)(remainingHexes);
-        return E_MEMORY_ALLOC;
+    if (numCells < 0) {
+        return E_DOMAIN;
+    }
+    const uint64_t childDigits = _unusedDigitsMask(childRes);
+    const uint64_t childResBits = (uint64_t)childRes << H3_RES_OFFSET;
+    uint64_t anyError = 0;
+    for (int64_t start = 0; start < numCells; start += 64) {
+        int64_t blockSize = numCells - start < 64 ? numCells - start : 64;
+        uint64_t word = 0;
+        for (int64_t i = 0; i < blockSize; i++) {
+            H3Index h = cells[start + i];
+            int parentRes = H3_GET_RESOLUTION(h);
+            uint64_t error = childRes < parentRes;
+            // Set the digits from parentRes + 1 to childRes to 0
+            H3Index child =
+                (h & ~H3_RES_MASK &
+                 ~(_unusedDigitsMask(parentRes) & ~childDigits)) |
+                childResBits;
+            out[start + i] = child & (error - 1);
+            word |= error << i;
+        }
+        anyError |= word;
+        if (errorBitmap) {
+            errorBitmap[start / 64] = word;
+        }
     }
+    return anyError ? E_RES_DOMAIN : E_SUCCESS;
+}
+
+/**
+ * Shared implementation of compactCells and compactCellsWithWorkspace.
+ * `remainingHexes` holds a copy of the input and `hashSetArray` is zeroed,
+ * both of size numHexes. `compactableScratch`, of size numHexes / 6, holds
+ * the parents compacted in each round; if it is NULL, they are allocated
+ * for each round instead.
+ */
+static H3Error _compactCellsInternal(H3Index *compactedSet,
+                                     const int64_t numHexes,
+                                     H3Index *remainingHexes,
+                                     H3Index *hashSetArray,
+                                     H3Index *compactableScratch) {
     H3Index *compactedSetOffset = compactedSet;
     int64_t numRemainingHexes = numHexes;
     while (numRemainingHexes) {
-        res = H3_GET_RESOLUTION(remainingHexes[0]);
+        int res = H3_GET_RESOLUTION(remainingHexes[0]);
         int parentRes = res - 1;
 
         // If parentRes is less than zero, we've compacted all the way up to the
@@ -596,8 +1140,6 @@ H3Error H3_EXPORT(compactCells)(const H3Index *h3Set, H3Index *compactedSet,
                     // because it expects to have set the reserved bits
                     // itself.
                     if (H3_GET_RESERVED_BITS(currIndex) != 0) {
-                        H3_MEMORY(free)(remainingHexes);
-                        H3_MEMORY(free)(hashSetArray);
                         return E_CELL_INVALID;
                     }
 
@@ -608,8 +1150,6 @@ H3Error H3_EXPORT(compactCells)(const H3Index *h3Set, H3Index *compactedSet,
                     // algorithm. Can happen if cellToParent errors e.g.
                     // because of incompatible resolutions.
                     if (parentError) {
-                        H3_MEMORY(free)(remainingHexes);
-                        H3_MEMORY(free)(hashSetArray);
                         return parentError;
                     }
                     // Modulus hash the parent into the temp array
@@ -620,8 +1160,6 @@ H3Error H3_EXPORT(compactCells)(const H3Index *h3Set, H3Index *compactedSet,
                             // This case should not be possible because at
                             // most one index is placed into hashSetArray
                             // per numRemainingHexes.
-                            H3_MEMORY(free)(remainingHexes);
-                            H3_MEMORY(free)(hashSetArray);
                             return E_FAILED;
                         }
                         H3Index tempIndex =
@@ -640,8 +1178,6 @@ H3Error H3_EXPORT(compactCells)(const H3Index *h3Set, H3Index *compactedSet,
                             // present.
                             if (count + 1 > limitCount) {
                                 // Only possible on duplicate input
-                                H3_MEMORY(free)(remainingHexes);
-                                H3_MEMORY(free)(hashSetArray);
                                 return E_DUPLICATE_INPUT;
                             }
                             H3_SET_RESERVED_BITS(parent, count);
@@ -666,12 +1202,15 @@ H3Error H3_EXPORT(compactCells)(const H3Index *h3Set, H3Index *compactedSet,
                    numRemainingHexes * sizeof(remainingHexes[0]));
             break;
         }
-        H3Index *compactableHexes =
-            H3_MEMORY(calloc)(maxCompactableCount, sizeof(H3Index));
-        if (!compactableHexes) {
-            H3_MEMORY(free)(remainingHexes);
-            H3_MEMORY(free)(hashSetArray);
-            return E_MEMORY_ALLOC;
+        H3Index *compactableHexes = compactableScratch;
+        if (compactableHexes) {
+            memset(compactableHexes, 0, maxCompactableCount * sizeof(H3Index));
+        } else {
+            compactableHexes =
+                H3_MEMORY(calloc)(maxCompactableCount, sizeof(H3Index));
+            if (!compactableHexes) {
+                return E_MEMORY_ALLOC;
+            }
         }
         for (int64_t i = 0; i < numRemainingHexes; i++) {
             if (hashSetArray[i] == 0) continue;
@@ -707,9 +1246,9 @@ H3Error H3_EXPORT(compactCells)(const H3Index *h3Set, H3Index *compactedSet,
                     H3Error parentError =
                         H3_EXPORT(cellToParent)(currIndex, parentRes, &parent);
                     if (NEVER(parentError)) {
-                        H3_MEMORY(free)(compactableHexes);
-                        H3_MEMORY(free)(remainingHexes);
-                        H3_MEMORY(free)(hashSetArray);
+                        if (!compactableScratch) {
+                            H3_MEMORY(free)(compactableHexes);
+                        }
                         return parentError;
                     }
                     // Modulus hash the parent into the temp array
@@ -722,9 +1261,9 @@ H3Error H3_EXPORT(compactCells)(const H3Index *h3Set, H3Index *compactedSet,
                             // This case should not be possible because at most
                             // one index is placed into hashSetArray per input
                             // hexagon.
-                            H3_MEMORY(free)(compactableHexes);
-                            H3_MEMORY(free)(remainingHexes);
-                            H3_MEMORY(free)(hashSetArray);
+                            if (!compactableScratch) {
+                                H3_MEMORY(free)(compactableHexes);
+                            }
                             return E_FAILED;
                         }
                         H3Index tempIndex =
@@ -754,13 +1293,118 @@ H3Error H3_EXPORT(compactCells)(const H3Index *h3Set, H3Index *compactedSet,
         memcpy(remainingHexes, compactableHexes,
                compactableCount * sizeof(H3Index));
         numRemainingHexes = compactableCount;
-        H3_MEMORY(free)(compactableHexes);
+        if (!compactableScratch) {
+            H3_MEMORY(free)(compactableHexes);
+        }
+    }
+    return E_SUCCESS;
+}
+
+/**
+ * compactCells takes a set of hexagons all at the same resolution and
+ * compresses them by pruning full child branches to the parent level. This is
+ * also done for all parents recursively to get the minimum number of hex
+ * addresses that perfectly cover the defined space.
+ * @param h3Set Set of hexagons
+ * @param compactedSet The output array of compressed hexagons (preallocated)
+ * @param numHexes The size of the input and output arrays (possible that no
+ * contiguous regions exist in the set at all and no compression possible)
+ * @return an error code on bad input data
+ */
+H3Error H3_EXPORT(compactCells)(const H3Index *h3Set, H3Index *compactedSet,
+                                const int64_t numHexes) {
+    if (numHexes == 0) {
+        return E_SUCCESS;
+    }
+    int res = H3_GET_RESOLUTION(h3Set[0]);
+    if (res == 0) {
+        // No compaction possible, just copy the set to output
+        for (int64_t i = 0; i < numHexes; i++) {
+            compactedSet[i] = h3Set[i];
+        }
+        return E_SUCCESS;
     }
+    H3Index *remainingHexes = H3_MEMORY(malloc)(numHexes * sizeof(H3Index));
+    if (!remainingHexes) {
+        return E_MEMORY_ALLOC;
+    }
+    memcpy(remainingHexes, h3Set, numHexes * sizeof(H3Index));
+    H3Index *hashSetArray = H3_MEMORY(calloc)(numHexes, sizeof(H3Index));
+    if (!hashSetArray) {
+        H3_MEMORY(free)(remainingHexes);
+        return E_MEMORY_ALLOC;
+    }
+    H3Error err = _compactCellsInternal(compactedSet, numHexes, remainingHexes,
+                                        hashSetArray, NULL);
     H3_MEMORY(free)(remainingHexes);
     H3_MEMORY(free)(hashSetArray);
+    return err;
+}
+
+/**
+ * compactCellsWorkspaceSize returns the size in bytes of the workspace needed
+ * by compactCellsWithWorkspace for `numHexes` cells.
+ * @param numHexes The size of the input array
+ * @param out Size of the workspace in bytes
+ * @return E_SUCCESS, or E_DOMAIN if numHexes is negative
+ */
+H3Error H3_EXPORT(compactCellsWorkspaceSize)(const int64_t numHexes,
+                                             int64_t *out) {
+    if (numHexes < 0) {
+        return E_DOMAIN;
+    }
+    // remainingHexes, hashSetArray and compactableHexes
+    int64_t numWorkspaceHexes = numHexes / 6;
+    if (numHexes > (INT64_MAX / (int64_t)sizeof(H3Index) -
+                    numWorkspaceHexes) / 2) {
+        return E_MEMORY_BOUNDS;
+    }
+    *out = (2 * numHexes + numWorkspaceHexes) * (int64_t)sizeof(H3Index);
     return E_SUCCESS;
 }
 
+/**
+ * compactCellsWithWorkspace is compactCells using caller-owned scratch memory,
+ * so it makes no allocations. A workspace can be reused across calls.
+ * @param h3Set Set of hexagons
+ * @param compactedSet The output array of compressed hexagons (preallocated)
+ * @param numHexes The size of the input and output arrays
+ * @param workspace Scratch memory, aligned as if returned by malloc
+ * @param workspaceSize Size of `workspace` in bytes, at least
+ * compactCellsWorkspaceSize(numHexes)
+ * @return an error code on bad input data, or E_MEMORY_BOUNDS if the workspace
+ * is too small
+ */
+H3Error H3_EXPORT(compactCellsWithWorkspace)(const H3Index *h3Set,
+                                             H3Index *compactedSet,
+                                             const int64_t numHexes,
+                                             void *workspace,
+                                             int64_t workspaceSize) {
+    int64_t neededSize;
+    H3Error err = H3_EXPORT(compactCellsWorkspaceSize)(numHexes, &neededSize);
+    if (err) {
+        return err;
+    }
+    if (workspaceSize < neededSize) {
+        return E_MEMORY_BOUNDS;
+    }
+    if (numHexes == 0) {
+        return E_SUCCESS;
+    }
+    if (H3_GET_RESOLUTION(h3Set[0]) == 0) {
+        // No compaction possible, just copy the set to output
+        memcpy(compactedSet, h3Set, numHexes * sizeof(H3Index));
+        return E_SUCCESS;
+    }
+    H3Index *remainingHexes = workspace;
+    H3Index *hashSetArray = remainingHexes + numHexes;
+    H3Index *compactableHexes = hashSetArray + numHexes;
+    memcpy(remainingHexes, h3Set, numHexes * sizeof(H3Index));
+    memset(hashSetArray, 0, numHexes * sizeof(H3Index));
+    return _compactCellsInternal(compactedSet, numHexes, remainingHexes,
+                                 hashSetArray, compactableHexes);
+}
+
 /**
  * uncompactCells takes a compressed set of cells and expands back to the
  * original set of cells.
@@ -782,12 +1426,15 @@ H3Error H3_EXPORT(uncompactCells)(const H3Index *compactedSet,
 
     for (int64_t j = 0; j < numCompacted; j++) {
         if (!_hasChildAtRes(compactedSet[j], res)) return E_RES_MISMATCH;
+        if (compactedSet[j] == H3_NULL) continue;
 
-        for (IterCellsChildren iter = iterInitParent(compactedSet[j], res);
-             iter.h; i++, iterStepChild(&iter)) {
-            if (i >= numOut) return E_MEMORY_BOUNDS;  // went too far; abort!
-            outSet[i] = iter.h;
-        }
+        int64_t childrenSize;
+        H3Error sizeError =
+            H3_EXPORT(cellToChildrenSize)(compactedSet[j], res, &childrenSize);
+        if (NEVER(sizeError)) return sizeError;
+        if (childrenSize > numOut - i) return E_MEMORY_BOUNDS;  // too far
+        H3_EXPORT(cellToChildren)(compactedSet[j], res, outSet + i);
+        i += childrenSize;
     }
     return E_SUCCESS;
 }
@@ -822,6 +1469,122 @@ H3Error H3_EXPORT(uncompactCellsSize)(const H3Index *compactedSet,
     return E_SUCCESS;
 }
 
+/**
+ * Returns the smallest and largest index among the children of a cell at a
+ * resolution. Children of a cell are contiguous in index order, so every
+ * valid cell at childRes between min and max (inclusive) is a child of h:
+ * min is the center child, whose new digits are 0, and max is the child
+ * whose new digits are 6.
+ *
+ * @param h         H3Index to find the children range of
+ * @param childRes  The child resolution
+ * @param min       Output: smallest child
+ * @param max       Output: largest child
+ * @return E_SUCCESS, or E_RES_DOMAIN if childRes is not a child resolution
+ */
+H3Error H3_EXPORT(cellToChildrenRange)(H3Index h, int childRes, H3Index *min,
+                                       H3Index *max) {
+    if (!_hasChildAtRes(h, childRes)) return E_RES_DOMAIN;
+
+    // Digits from the cell's resolution + 1 to childRes
+    uint64_t newDigits =
+        _unusedDigitsMask(H3_GET_RESOLUTION(h)) & ~_unusedDigitsMask(childRes);
+    H3Index child = h;
+    H3_SET_RESOLUTION(child, childRes);
+    *min = child & ~newDigits;
+    // Digit 6 is 0b110, so clear the low bit of each new digit
+    const uint64_t MLO = 0b001001001001001001001001001001001001001001001;
+    *max = child & ~(newDigits & MLO);
+    return E_SUCCESS;
+}
+
+/**
+ * Returns the smallest valid-looking cell at the same resolution greater
+ * than h: its digits up to its resolution are incremented as a base 7
+ * number, carrying into the base cell. Pentagon deleted subsequences are not
+ * skipped.
+ */
+static H3Index _nextCellAtRes(H3Index h) {
+    int res = H3_GET_RESOLUTION(h);
+    for (int r = res; r >= 1; r--) {
+        Direction digit = H3_GET_INDEX_DIGIT(h, r);
+        if (digit < INVALID_DIGIT - 1) {
+            H3_SET_INDEX_DIGIT(h, r, digit + 1);
+            return h;
+        }
+        H3_SET_INDEX_DIGIT(h, r, CENTER_DIGIT);
+    }
+    H3_SET_BASE_CELL(h, H3_GET_BASE_CELL(h) + 1);
+    return h;
+}
+
+/** Orders ranges, stored as pairs of H3Index, by their minimum */
+static int _cmpRangeMin(const void *a, const void *b) {
+    H3Index ha = *(const H3Index *)a;
+    H3Index hb = *(const H3Index *)b;
+    if (ha < hb) return -1;
+    if (ha > hb) return +1;
+    return 0;
+}
+
+/**
+ * Converts a set of cells, e.g. a compacted set, into the sorted ranges of
+ * their children at a resolution, as cellToChildrenRange, merging ranges
+ * that overlap or that have no valid cell between them. A database sorted
+ * by index can then answer "all children of the set" with one range scan
+ * per range instead of enumerating the uncompacted cells.
+ *
+ * Skips elements that are H3_NULL (i.e., 0). Ranges are not merged across
+ * the deleted subsequences of pentagons, which contain no valid cells.
+ *
+ * @param   compactedSet  Set of cells
+ * @param   numCompacted  The number of cells in the input set
+ * @param   res           The resolution of the children
+ * @param   ranges        Output: 2 * numCompacted indexes (preallocated), with
+ *                        the min and max of each range in turn
+ * @param   numRanges     Output: number of ranges
+ * @return E_SUCCESS, E_RES_DOMAIN if res is invalid, or E_RES_MISMATCH if
+ *         any cell is finer than res
+ */
+H3Error H3_EXPORT(compactCellsToChildrenRanges)(const H3Index *compactedSet,
+                                                const int64_t numCompacted,
+                                                const int res, H3Index *ranges,
+                                                int64_t *numRanges) {
+    int64_t n = 0;
+    for (int64_t i = 0; i < numCompacted; i++) {
+        if (compactedSet[i] == H3_NULL) continue;
+        if (res >= 0 && res <= MAX_H3_RES &&
+            res < H3_GET_RESOLUTION(compactedSet[i])) {
+            return E_RES_MISMATCH;
+        }
+        H3Error err = H3_EXPORT(cellToChildrenRange)(
+            compactedSet[i], res, &ranges[2 * n], &ranges[2 * n + 1]);
+        if (err) {
+            return err;
+        }
+        n++;
+    }
+    qsort(ranges, n, 2 * sizeof(H3Index), _cmpRangeMin);
+
+    int64_t merged = 0;
+    for (int64_t i = 0; i < n; i++) {
+        H3Index min = ranges[2 * i];
+        H3Index max = ranges[2 * i + 1];
+        if (merged > 0) {
+            H3Index *last = &ranges[2 * (merged - 1)];
+            if (min <= _nextCellAtRes(last[1])) {
+                if (max > last[1]) last[1] = max;
+                continue;
+            }
+        }
+        ranges[2 * merged] = min;
+        ranges[2 * merged + 1] = max;
+        merged++;
+    }
+    *numRanges = merged;
+    return E_SUCCESS;
+}
+
 /**
  * isResClassIII takes a hexagon ID and determines if it is in a
  * Class III resolution (rotated versus the icosahedron and subject
@@ -1211,10 +1974,10 @@ H3Error H3_EXPORT(cellToBoundary)(H3Index h3, CellBoundary *cb) {
     }
     if (H3_EXPORT(isPentagon)(h3)) {
         _faceIjkPentToCellBoundary(&fijk, H3_GET_RESOLUTION(h3), 0,
-                                   NUM_PENT_VERTS, cb);
+                                   NUM_PENT_VERTS, cb, NULL);
     } else {
         _faceIjkToCellBoundary(&fijk, H3_GET_RESOLUTION(h3), 0, NUM_HEX_VERTS,
-                               cb);
+                               cb, NULL);
     }
     return E_SUCCESS;
 }
@@ -1354,23 +2117,123 @@ H3Error H3_EXPORT(getPentagons)(int res, H3Index *out) {
 int isResolutionClassIII(int res) { return res % 2; }
 
 /**
- * Validate a child position in the context of a given parent, returning
- * an error if validation fails.
+ * Number of descendants of a hexagon, by resolution difference: 7^n.
  */
-static H3Error validateChildPos(int64_t childPos, H3Index parent,
-                                int childRes) {
-    int64_t maxChildCount;
-    H3Error sizeError =
-        H3_EXPORT(cellToChildrenSize)(parent, childRes, &maxChildCount);
-    if (NEVER(sizeError)) {
-        return sizeError;
+static const int64_t hexagonChildCount[MAX_H3_RES + 1] = {
+    1,          7,           49,           343,          2401,
+    16807,      117649,      823543,       5764801,      40353607,
+    282475249,  1977326743,  13841287201,  96889010407,  678223072849,
+    4747561509943};
+
+/**
+ * Number of descendants of a pentagon, by resolution difference. See the
+ * explanation for getNumCells in h3api.h: 1 + 5 * (7^n - 1) / 6.
+ */
+static const int64_t pentagonChildCount[MAX_H3_RES + 1] = {
+    1,          6,           41,           286,          2001,
+    14006,      98041,       686286,       4804001,      33628006,
+    235396041,  1647772286,  11534406001,  80740842006,  565185894041,
+    3956301258286};
+
+/**
+ * Returns whether the ancestor of a cell at parentRes is a pentagon: its base
+ * cell is a pentagon and its digits up to parentRes are all 0.
+ */
+static inline bool _isPentagonParent(H3Index h, int parentRes) {
+    return _isBaseCellPentagon(H3_GET_BASE_CELL(h)) &&
+           (h & _unusedDigitsMask(0) & ~_unusedDigitsMask(parentRes)) == 0;
+}
+
+/**
+ * Child position of a cell, for a valid parentRes no finer than the cell.
+ *
+ * Below a pentagon, the position only differs from a hexagon's while the
+ * digits are 0: the first nonzero digit skips the pentagon's own descendants
+ * and the deleted K axes subsequence, after which the remaining digits are a
+ * base 7 number, as for hexagons.
+ */
+static inline H3Error _cellToChildPos(H3Index child, int parentRes,
+                                      int64_t *out) {
+    int childRes = H3_GET_RESOLUTION(child);
+    int res = parentRes + 1;
+    int64_t pos = 0;
+    if (_isPentagonParent(child, parentRes)) {
+        while (res <= childRes &&
+               H3_GET_INDEX_DIGIT(child, res) == CENTER_DIGIT) {
+            res++;
+        }
+        if (res <= childRes) {
+            int digit = H3_GET_INDEX_DIGIT(child, res);
+            if (digit == K_AXES_DIGIT || digit == INVALID_DIGIT) {
+                return E_CELL_INVALID;
+            }
+            pos = pentagonChildCount[childRes - res] +
+                  (digit - 2) * hexagonChildCount[childRes - res];
+            res++;
+        }
     }
-    if (childPos < 0 || childPos >= maxChildCount) {
-        return E_DOMAIN;
+    if (res > childRes) {
+        *out = pos;
+        return E_SUCCESS;
+    }
+    // The digits from res to childRes, with the finest in the low bits
+    int shift = (MAX_H3_RES - childRes) * H3_PER_DIGIT_OFFSET;
+    int numDigits = childRes - res + 1;
+    uint64_t digits = (child >> shift) &
+                      (((uint64_t)1 << (numDigits * H3_PER_DIGIT_OFFSET)) - 1);
+    // A digit is invalid if all three of its bits are set
+    if (digits & (digits >> 1) & (digits >> 2) & 01111111111111111) {
+        return E_CELL_INVALID;
     }
+    // Convert from octal to base 7 by merging adjacent fields in parallel:
+    // pairs of digits into 6 bit fields, then 12, 24 and 48 bit fields.
+    // Each merged value fits in its field, so the multiplies don't carry.
+    digits = ((digits >> 3) & 00707070707070707) * 7 +
+             (digits & 00707070707070707);
+    digits = ((digits >> 6) & 0x3F03F03F03F) * 49 + (digits & 0x3F03F03F03F);
+    digits = ((digits >> 12) & 0xFFF000FFF) * 2401 + (digits & 0xFFF000FFF);
+    digits = ((digits >> 24) & 0xFFFFFF) * 5764801 + (digits & 0xFFFFFF);
+    *out = pos + (int64_t)digits;
     return E_SUCCESS;
 }
 
+/**
+ * Child at a position, for a valid position and childRes no coarser than the
+ * parent. The inverse of _cellToChildPos.
+ */
+static inline H3Index _childPosToCell(int64_t childPos, H3Index parent,
+                                      int parentRes, bool parentIsPentagon,
+                                      int childRes) {
+    H3Index child = (parent & ~H3_RES_MASK &
+                     ~(_unusedDigitsMask(parentRes) &
+                       ~_unusedDigitsMask(childRes))) |
+                    ((uint64_t)childRes << H3_RES_OFFSET);
+    int res = parentRes + 1;
+    if (parentIsPentagon) {
+        // Center digits while the position is among the pentagon's own
+        // descendants
+        while (res <= childRes &&
+               childPos < pentagonChildCount[childRes - res]) {
+            res++;
+        }
+        if (res <= childRes) {
+            int64_t width = hexagonChildCount[childRes - res];
+            childPos -= pentagonChildCount[childRes - res];
+            H3_SET_INDEX_DIGIT(child, res, childPos / width + 2);
+            childPos %= width;
+            res++;
+        }
+    }
+    // The remaining digits are base 7, converted three at a time from the
+    // finest with the children templates
+    int shift = (MAX_H3_RES - childRes) * H3_PER_DIGIT_OFFSET;
+    for (; childPos; childPos /= 343) {
+        child |= (uint64_t)childDigitTemplates[childPos % 343] << shift;
+        shift += 3 * H3_PER_DIGIT_OFFSET;
+    }
+    return child;
+}
+
 /**
  * Returns the position of the cell within an ordered list of all children of
  * the cell's parent at the specified resolution
@@ -1380,75 +2243,13 @@ static H3Error validateChildPos(int64_t childPos, H3Index parent,
  * list of children
  */
 H3Error H3_EXPORT(cellToChildPos)(H3Index child, int parentRes, int64_t *out) {
-    int childRes = H3_GET_RESOLUTION(child);
-    // Get the parent at res. This will catch any resolution errors
-    H3Index originalParent;
-    H3Error parentError =
-        H3_EXPORT(cellToParent(child, parentRes, &originalParent));
-    if (parentError) {
-        return parentError;
-    }
-
-    // Define the initial parent. Note that these variables are reassigned
-    // within the loop.
-    H3Index parent = originalParent;
-    int parentIsPentagon = H3_EXPORT(isPentagon)(parent);
-
-    // Walk up the resolution digits, incrementing the index
-    *out = 0;
-    if (parentIsPentagon) {
-        // Pentagon logic. Pentagon parents skip the 1 digit, so the offsets are
-        // different from hexagons
-        for (int res = childRes; res > parentRes; res--) {
-            H3Error parentError =
-                H3_EXPORT(cellToParent(child, res - 1, &parent));
-            if (NEVER(parentError)) {
-                return parentError;
-            }
-
-            parentIsPentagon = H3_EXPORT(isPentagon)(parent);
-            int rawDigit = H3_GET_INDEX_DIGIT(child, res);
-            // Validate the digit before proceeding
-            if (rawDigit == INVALID_DIGIT ||
-                (parentIsPentagon && rawDigit == K_AXES_DIGIT)) {
-                return E_CELL_INVALID;
-            }
-            int digit =
-                parentIsPentagon && rawDigit > 0 ? rawDigit - 1 : rawDigit;
-            if (digit != CENTER_DIGIT) {
-                int64_t hexChildCount = _ipow(7, childRes - res);
-                // The offset for the 0-digit slot depends on whether the
-                // current index is the child of a pentagon. If so, the offset
-                // is based on the count of pentagon children, otherwise,
-                // hexagon children.
-                *out += (parentIsPentagon
-                             ?  // pentagon children. See the explanation
-                                // for getNumCells in h3api.h.in
-                             1 + (5 * (hexChildCount - 1)) / 6
-                             :  // one hexagon's children
-                             hexChildCount) +
-                        // the other hexagon children
-                        (digit - 1) * hexChildCount;
-            }
-        }
-    } else {
-        // Hexagon logic. Offsets are simple powers of 7
-        for (int res = childRes; res > parentRes; res--) {
-            int digit = H3_GET_INDEX_DIGIT(child, res);
-            if (digit == INVALID_DIGIT) {
-                return E_CELL_INVALID;
-            }
-            *out += digit * _ipow(7, childRes - res);
-        }
+    if (parentRes < 0 || parentRes > MAX_H3_RES) {
+        return E_RES_DOMAIN;
     }
-
-    if (NEVER(validateChildPos(*out, originalParent, childRes))) {
-        // This is the result of an internal error, so return E_FAILED
-        // instead of the validation error
-        return E_FAILED;
+    if (parentRes > H3_GET_RESOLUTION(child)) {
+        return E_RES_MISMATCH;
     }
-
-    return E_SUCCESS;
+    return _cellToChildPos(child, parentRes, out);
 }
 
 /**
@@ -1471,52 +2272,116 @@ H3Error H3_EXPORT(childPosToCell)(int64_t childPos, H3Index parent,
         return E_RES_MISMATCH;
     }
     // Validate child pos
-    H3Error childPosErr = validateChildPos(childPos, parent, childRes);
-    if (childPosErr) {
-        return childPosErr;
-    }
-
-    int resOffset = childRes - parentRes;
-
-    *child = parent;
-    int64_t idx = childPos;
-
-    H3_SET_RESOLUTION(*child, childRes);
-
-    if (H3_EXPORT(isPentagon)(parent)) {
-        // Pentagon tile logic. Pentagon tiles skip the 1 digit, so the offsets
-        // are different
-        bool inPent = true;
-        for (int res = 1; res <= resOffset; res++) {
-            int64_t resWidth = _ipow(7, resOffset - res);
-            if (inPent) {
-                // While we are inside a parent pentagon, we need to check if
-                // this cell is a pentagon, and if not, we need to offset its
-                // digit to account for the skipped direction
-                int64_t pentWidth = 1 + (5 * (resWidth - 1)) / 6;
-                if (idx < pentWidth) {
-                    H3_SET_INDEX_DIGIT(*child, parentRes + res, 0);
-                } else {
-                    idx -= pentWidth;
-                    inPent = false;
-                    H3_SET_INDEX_DIGIT(*child, parentRes + res,
-                                       (idx / resWidth) + 2);
-                    idx %= resWidth;
-                }
-            } else {
-                // We're no longer inside a pentagon, continue as for hex
-                H3_SET_INDEX_DIGIT(*child, parentRes + res, idx / resWidth);
-                idx %= resWidth;
+    bool parentIsPentagon = H3_EXPORT(isPentagon)(parent);
+    int64_t numChildren = parentIsPentagon
+                              ? pentagonChildCount[childRes - parentRes]
+                              : hexagonChildCount[childRes - parentRes];
+    if (childPos < 0 || childPos >= numChildren) {
+        return E_DOMAIN;
+    }
+    *child = _childPosToCell(childPos, parent, parentRes, parentIsPentagon,
+                             childRes);
+    return E_SUCCESS;
+}
+
+/**
+ * Returns the positions of an array of cells within the children of their
+ * parents at parentRes, as cellToChildPos.
+ *
+ * Errors are reported per cell: a cell coarser than parentRes or with an
+ * invalid digit has its output set to -1 and its bit set in errorBitmap.
+ *
+ * @param cells Cells to find the positions of
+ * @param numCells Number of cells
+ * @param parentRes Resolution of the parents
+ * @param out Output, numCells positions
+ * @param errorBitmap Output, error bitmap of the cells (see h3Index.h)
+ * @return E_SUCCESS, the error of the first cell that failed, E_RES_DOMAIN
+ * for an invalid parentRes, or E_DOMAIN if numCells is negative
+ */
+H3Error H3_EXPORT(cellsToChildPos)(const H3Index *cells, int64_t numCells,
+                                   int parentRes, int64_t *out,
+                                   uint64_t *errorBitmap) {
+    if (parentRes < 0 || parentRes > MAX_H3_RES) {
+        return E_RES_DOMAIN;
+    }
+    if (numCells < 0) {
+        return E_DOMAIN;
+    }
+    H3Error firstError = E_SUCCESS;
+    for (int64_t start = 0; start < numCells; start += 64) {
+        int64_t blockSize = numCells - start < 64 ? numCells - start : 64;
+        uint64_t word = 0;
+        for (int64_t i = 0; i < blockSize; i++) {
+            H3Index h = cells[start + i];
+            H3Error err = parentRes > H3_GET_RESOLUTION(h)
+                              ? E_RES_MISMATCH
+                              : _cellToChildPos(h, parentRes, &out[start + i]);
+            if (err) {
+                out[start + i] = -1;
+                word |= (uint64_t)1 << i;
+                if (!firstError) firstError = err;
             }
         }
-    } else {
-        // Hexagon tile logic. Offsets are simple powers of 7
-        for (int res = 1; res <= resOffset; res++) {
-            int64_t resWidth = _ipow(7, resOffset - res);
-            H3_SET_INDEX_DIGIT(*child, parentRes + res, idx / resWidth);
-            idx %= resWidth;
+        if (errorBitmap) {
+            errorBitmap[start / 64] = word;
         }
     }
+    return firstError;
+}
 
-    return E_SUCCESS;
+/**
+ * Returns the children of a parent at an array of positions, as
+ * childPosToCell. The parent is only classified once, so each position is
+ * converted with table lookups and base 7 arithmetic.
+ *
+ * Errors are reported per position: a position out of range has its output
+ * set to H3_NULL and its bit set in errorBitmap.
+ *
+ * @param childPos Positions within the ordered children
+ * @param numPos Number of positions
+ * @param parent Parent of the children
+ * @param childRes Resolution of the children
+ * @param out Output, numPos children
+ * @param errorBitmap Output, error bitmap of the positions (see h3Index.h)
+ * @return E_SUCCESS, E_DOMAIN if any position failed or numPos is negative,
+ * or E_RES_DOMAIN or E_RES_MISMATCH for an invalid childRes
+ */
+H3Error H3_EXPORT(childPosToCells)(const int64_t *childPos, int64_t numPos,
+                                   H3Index parent, int childRes, H3Index *out,
+                                   uint64_t *errorBitmap) {
+    if (childRes < 0 || childRes > MAX_H3_RES) {
+        return E_RES_DOMAIN;
+    }
+    int parentRes = H3_GET_RESOLUTION(parent);
+    if (childRes < parentRes) {
+        return E_RES_MISMATCH;
+    }
+    if (numPos < 0) {
+        return E_DOMAIN;
+    }
+    bool parentIsPentagon = H3_EXPORT(isPentagon)(parent);
+    int64_t numChildren = parentIsPentagon
+                              ? pentagonChildCount[childRes - parentRes]
+                              : hexagonChildCount[childRes - parentRes];
+    uint64_t anyError = 0;
+    for (int64_t start = 0; start < numPos; start += 64) {
+        int64_t blockSize = numPos - start < 64 ? numPos - start : 64;
+        uint64_t word = 0;
+        for (int64_t i = 0; i < blockSize; i++) {
+            int64_t pos = childPos[start + i];
+            if (pos < 0 || pos >= numChildren) {
+                out[start + i] = H3_NULL;
+                word |= (uint64_t)1 << i;
+            } else {
+                out[start + i] = _childPosToCell(
+                    pos, parent, parentRes, parentIsPentagon, childRes);
+            }
+        }
+        anyError |= word;
+        if (errorBitmap) {
+            errorBitmap[start / 64] = word;
+        }
+    }
+    return anyError ? E_DOMAIN : E_SUCCESS;
 }
@@ -21,6 +21,8 @@
 
 #include "iterators.h"
 
+#include "baseCells.h"
+#include "h3Assert.h"
 #include "h3Index.h"
 
 // extract the `res` digit (0--7) of the current cell
@@ -286,6 +288,44 @@ void iterStepChild(IterCellsChildren *it) {
     }
 }
 
+/**
+ * Create a children iterator positioned at one of the children, so that
+ * iteration through the children can be resumed from a saved cell. The
+ * cursor to save is just the parent and the current child.
+ *
+ * For pentagons, the skip digit is just before the first nonzero digit after
+ * the parent, or the child resolution if there is none, as left by
+ * iterStepChild.
+ *
+ * @param h The parent cell
+ * @param child The child to resume at, which is the first iterate
+ * @return The iterator, which is exhausted if child is not a valid
+ * descendant of h
+ */
+IterCellsChildren iterResumeChild(H3Index h, H3Index child) {
+    int parentRes = H3_GET_RESOLUTION(h);
+    int childRes = H3_GET_RESOLUTION(child);
+    H3Index childParent;
+    if (h == H3_NULL || !H3_EXPORT(isValidCell)(child) ||
+        H3_EXPORT(cellToParent)(child, parentRes, &childParent) ||
+        childParent != h) {
+        return _null_iter();
+    }
+
+    IterCellsChildren it = iterInitParent(h, childRes);
+    if (it._skipDigit != -1) {
+        it._skipDigit = childRes;
+        for (int r = parentRes + 1; r <= childRes; r++) {
+            if (H3_GET_INDEX_DIGIT(child, r) != CENTER_DIGIT) {
+                it._skipDigit = r - 1;
+                break;
+            }
+        }
+    }
+    it.h = child;
+    return it;
+}
+
 // create iterator for children of base cell at given resolution
 IterCellsChildren iterInitBaseCellNum(int baseCellNum, int childRes) {
     if (baseCellNum < 0 || baseCellNum >= NUM_BASE_CELLS || childRes < 0 ||
@@ -328,3 +368,279 @@ void iterStepRes(IterCellsResolution *itR) {
     // exhausted in the check above.
     itR->h = itR->_itC.h;
 }
+
+/**
+ * Create an iterator for all cells at a resolution, positioned at a cell,
+ * so that iteration can be resumed from a saved cell. The cursor to save is
+ * just the current cell.
+ *
+ * @param h The cell to resume at, which is the first iterate
+ * @return The iterator, which is exhausted if h is not a valid cell
+ */
+IterCellsResolution iterResumeRes(H3Index h) {
+    int res = H3_GET_RESOLUTION(h);
+    H3Index baseCell;
+    if (!H3_EXPORT(isValidCell)(h) ||
+        H3_EXPORT(cellToParent)(h, 0, &baseCell)) {
+        IterCellsResolution itR = iterInitRes(-1);
+        return itR;
+    }
+    IterCellsChildren itC = iterResumeChild(baseCell, h);
+    IterCellsResolution itR = {.h = itC.h,
+                               ._baseCellNum = H3_GET_BASE_CELL(h),
+                               ._res = res,
+                               ._itC = itC};
+    return itR;
+}
+
+/**
+ * Position of a cell among all cells at its resolution, in iteration order:
+ * the cells of the preceding base cells, then its position within its base
+ * cell.
+ */
+static H3Error _cellOrdinal(H3Index h, int64_t *out) {
+    int res = H3_GET_RESOLUTION(h);
+    int baseCellNum = H3_GET_BASE_CELL(h);
+    int64_t ordinal = 0;
+    for (int b = 0; b < baseCellNum; b++) {
+        H3Index baseCell;
+        setH3Index(&baseCell, 0, b, 0);
+        int64_t size;
+        H3Error err = H3_EXPORT(cellToChildrenSize)(baseCell, res, &size);
+        if (NEVER(err)) return err;
+        ordinal += size;
+    }
+    int64_t pos;
+    H3Error err = H3_EXPORT(cellToChildPos)(h, 0, &pos);
+    if (err) return err;
+    *out = ordinal + pos;
+    return E_SUCCESS;
+}
+
+/**
+ * The cell at a position among all cells at a resolution, in iteration
+ * order, found by base cell and then digit by digit with childPosToCell.
+ */
+static H3Error _cellAtOrdinal(int res, int64_t ordinal, H3Index *out) {
+    for (int b = 0; b < NUM_BASE_CELLS; b++) {
+        H3Index baseCell;
+        setH3Index(&baseCell, 0, b, 0);
+        int64_t size;
+        H3Error err = H3_EXPORT(cellToChildrenSize)(baseCell, res, &size);
+        if (NEVER(err)) return err;
+        if (ordinal < size) {
+            return H3_EXPORT(childPosToCell)(ordinal, baseCell, res, out);
+        }
+        ordinal -= size;
+    }
+    return E_DOMAIN;
+}
+
+/**
+ * Range of positions [start, end) of a shard, splitting the cells at a
+ * resolution into numShards shards whose sizes differ by at most one.
+ */
+static H3Error _shardRange(int res, int64_t shard, int64_t numShards,
+                           int64_t *start, int64_t *end) {
+    if (res < 0 || res > MAX_H3_RES || numShards < 1 || shard < 0 ||
+        shard >= numShards) {
+        return E_DOMAIN;
+    }
+    int64_t total;
+    H3Error err = H3_EXPORT(getNumCells)(res, &total);
+    if (NEVER(err)) return err;
+    int64_t size = total / numShards;
+    int64_t extra = total % numShards;
+    *start = shard * size + (shard < extra ? shard : extra);
+    *end = *start + size + (shard < extra ? 1 : 0);
+    return E_SUCCESS;
+}
+
+/**
+ * Create a finished shard iterator.
+ */
+static IterCellsShard _null_shard_iter(void) {
+    return (IterCellsShard){
+        .h = H3_NULL, ._remaining = 0, ._itR = iterInitRes(-1)};
+}
+
+/**
+ * Create an iterator over one of numShards disjoint shards of the cells at a
+ * resolution. The shards follow iteration order, together cover every cell
+ * once, and have sizes differing by at most one, accounting for the missing
+ * children of pentagons.
+ *
+ * @param res Resolution of the cells
+ * @param shard Which shard, from 0 to numShards - 1
+ * @param numShards Number of shards
+ * @return The iterator, which is exhausted for invalid arguments or an empty
+ * shard
+ */
+IterCellsShard iterInitShard(int res, int64_t shard, int64_t numShards) {
+    int64_t start, end;
+    H3Index first;
+    if (_shardRange(res, shard, numShards, &start, &end) || start == end ||
+        _cellAtOrdinal(res, start, &first)) {
+        return _null_shard_iter();
+    }
+    IterCellsShard it = {
+        .h = first, ._remaining = end - start, ._itR = iterResumeRes(first)};
+    return it;
+}
+
+/**
+ * Create a shard iterator positioned at a cell in the shard, so that
+ * iteration can be resumed from a saved cell. The cursor to save is just the
+ * current cell.
+ *
+ * @param shard Which shard, from 0 to numShards - 1
+ * @param numShards Number of shards
+ * @param h The cell to resume at, which is the first iterate
+ * @return The iterator, which is exhausted if h is not in the shard
+ */
+IterCellsShard iterResumeShard(int64_t shard, int64_t numShards, H3Index h) {
+    int64_t start, end, ordinal;
+    if (!H3_EXPORT(isValidCell)(h) ||
+        _shardRange(H3_GET_RESOLUTION(h), shard, numShards, &start, &end) ||
+        _cellOrdinal(h, &ordinal) || ordinal < start || ordinal >= end) {
+        return _null_shard_iter();
+    }
+    IterCellsShard it = {
+        .h = h, ._remaining = end - ordinal, ._itR = iterResumeRes(h)};
+    return it;
+}
+
+/**
+ * Step an IterCellsShard to the next cell of the shard. When the shard is
+ * finished, IterCellsShard.h will be H3_NULL.
+ */
+void iterStepShard(IterCellsShard *it) {
+    if (it->h == H3_NULL) return;
+
+    it->_remaining--;
+    if (it->_remaining == 0) {
+        *it = _null_shard_iter();
+        return;
+    }
+    iterStepRes(&it->_itR);
+    it->h = it->_itR.h;
+}
+
+/**
+ * Create a finished uncompact iterator, with `error` set.
+ */
+static IterCellsUncompact _null_uncompact_iter(H3Error error) {
+    return (IterCellsUncompact){.h = H3_NULL,
+                                .error = error,
+                                ._compactedSet = NULL,
+                                ._numCompacted = 0,
+                                ._index = 0,
+                                ._res = -1,
+                                ._itC = _null_iter()};
+}
+
+/**
+ * Internal function - start the uncompact iterator at the first child of
+ * the compacted set at or after `it->_index`, skipping H3_NULL. When there
+ * is none, or on error, the iterator finishes with `_index` left in place.
+ */
+static void _iterUncompactSeek(IterCellsUncompact *it) {
+    for (; it->_index < it->_numCompacted; it->_index++) {
+        H3Index parent = it->_compactedSet[it->_index];
+        if (parent == H3_NULL) continue;
+        if (H3_GET_RESOLUTION(parent) > it->_res) {
+            // Stop here, so that resuming from the cursor fails the same way
+            it->error = E_RES_MISMATCH;
+            break;
+        }
+        it->_itC = iterInitParent(parent, it->_res);
+        it->h = it->_itC.h;
+        return;
+    }
+    it->h = H3_NULL;
+    it->_itC = _null_iter();
+}
+
+/**
+ * Create an iterator over the uncompacted cells of a compacted set, as
+ * produced by uncompactCells, using constant memory.
+ *
+ * @param compactedSet Set of compacted cells, which may contain H3_NULL
+ * @param numCompacted Number of cells in the set
+ * @param res Resolution to uncompact to
+ */
+IterCellsUncompact iterInitUncompact(const H3Index *compactedSet,
+                                     int64_t numCompacted, int res) {
+    UncompactCursor start = {.index = 0, .h = H3_NULL};
+    return iterResumeUncompact(compactedSet, numCompacted, res, start);
+}
+
+/**
+ * Create an iterator over the uncompacted cells of a compacted set,
+ * starting at a cursor from `iterUncompactCursor`. The first iterate is
+ * the cell that was current when the cursor was taken.
+ *
+ * @param compactedSet Set of compacted cells, which may contain H3_NULL
+ * @param numCompacted Number of cells in the set
+ * @param res Resolution to uncompact to
+ * @param cursor Position to resume from. A cursor with H3_NULL starts from
+ *               the first child of compactedSet[cursor.index].
+ */
+IterCellsUncompact iterResumeUncompact(const H3Index *compactedSet,
+                                       int64_t numCompacted, int res,
+                                       UncompactCursor cursor) {
+    if (res < 0 || res > MAX_H3_RES || numCompacted < 0) {
+        return _null_uncompact_iter(E_DOMAIN);
+    }
+    if (cursor.index < 0 || cursor.index > numCompacted) {
+        return _null_uncompact_iter(E_DOMAIN);
+    }
+    IterCellsUncompact it = {.h = H3_NULL,
+                             .error = E_SUCCESS,
+                             ._compactedSet = compactedSet,
+                             ._numCompacted = numCompacted,
+                             ._index = cursor.index,
+                             ._res = res,
+                             ._itC = _null_iter()};
+    if (cursor.h == H3_NULL) {
+        _iterUncompactSeek(&it);
+        return it;
+    }
+
+    // The cursor cell must be a child at `res` of the cell at its index
+    if (cursor.index == numCompacted || H3_GET_RESOLUTION(cursor.h) != res) {
+        return _null_uncompact_iter(E_DOMAIN);
+    }
+    it._itC = iterResumeChild(compactedSet[cursor.index], cursor.h);
+    if (it._itC.h == H3_NULL) {
+        return _null_uncompact_iter(E_DOMAIN);
+    }
+    it.h = cursor.h;
+    return it;
+}
+
+/**
+ * Step an IterCellsUncompact to the next uncompacted cell. When the
+ * iteration is over, IterCellsUncompact.h will be H3_NULL.
+ */
+void iterStepUncompact(IterCellsUncompact *it) {
+    if (it->h == H3_NULL) return;
+
+    iterStepChild(&it->_itC);
+    if (it->_itC.h) {
+        it->h = it->_itC.h;
+        return;
+    }
+    it->_index++;
+    _iterUncompactSeek(it);
+}
+
+/**
+ * Returns the position of an IterCellsUncompact, so that iteration can be
+ * resumed from its current iterate, e.g. in another process. Resuming an
+ * exhausted iterator gives an exhausted iterator, and resuming one that
+ * stopped on an error fails again.
+ */
+UncompactCursor iterUncompactCursor(const IterCellsUncompact *it) {
+    return (UncompactCursor){.index = it->_index, .h = it->h};
+}
@@ -20,12 +20,15 @@
 #include "linkedGeo.h"
 
 #include <assert.h>
+#include <math.h>
 #include <stdlib.h>
 
 #include "alloc.h"
+#include "bbox.h"
 #include "cellsToMultiPoly.h"
 #include "h3Assert.h"
 #include "h3api.h"
+#include "mathExtensions.h"
 #include "polygon.h"
 
 /**
@@ -446,54 +449,200 @@ static const LinkedGeoPolygon *findDeepestContainer(
     return parent;
 }
 
+// Maximum number of grid rows or columns in a LoopGrid
+#define LOOP_GRID_MAX_DIM 1024
+// Outer loops covering more grid cells than this are checked for every hole
+#define LOOP_GRID_MAX_CELLS_PER_LOOP 16
+
+/**
+ * A uniform lat/lng grid over the bounding boxes of the outer loops, used to
+ * find the outer loops that may contain a hole without testing all of them.
+ * Each outer loop is listed in every grid cell its bounding box overlaps,
+ * unless it crosses the antimeridian or covers many grid cells, in which case
+ * it is listed in `large` and checked for every hole.
+ */
+typedef struct {
+    BBox extent;
+    int rows;
+    int cols;
+    int *offsets;  // Start of each grid cell's list in `entries`, plus the end
+    int *entries;  // Outer loop indexes, in increasing order per grid cell
+    int *large;    // Outer loop indexes checked for every hole
+    int numLarge;
+} LoopGrid;
+
+static int loopGridRow(const LoopGrid *grid, double lat) {
+    if (grid->rows == 1) return 0;
+    int row = (int)((lat - grid->extent.south) /
+                    (grid->extent.north - grid->extent.south) * grid->rows);
+    return row < 0 ? 0 : (row >= grid->rows ? grid->rows - 1 : row);
+}
+
+static int loopGridCol(const LoopGrid *grid, double lng) {
+    if (grid->cols == 1) return 0;
+    int col = (int)((lng - grid->extent.west) /
+                    (grid->extent.east - grid->extent.west) * grid->cols);
+    return col < 0 ? 0 : (col >= grid->cols ? grid->cols - 1 : col);
+}
+
+/**
+ * Whether an outer loop is listed in the grid cells (rather than in `large`),
+ * and if so, the range of grid cells its bounding box overlaps.
+ */
+static bool loopGridRange(const LoopGrid *grid, const BBox *bbox, int *row0,
+                          int *row1, int *col0, int *col1) {
+    if (grid->rows == 0 || bboxIsTransmeridian(bbox)) {
+        return false;
+    }
+    *row0 = loopGridRow(grid, bbox->south);
+    *row1 = loopGridRow(grid, bbox->north);
+    *col0 = loopGridCol(grid, bbox->west);
+    *col1 = loopGridCol(grid, bbox->east);
+    return (int64_t)(*row1 - *row0 + 1) * (*col1 - *col0 + 1) <=
+           LOOP_GRID_MAX_CELLS_PER_LOOP;
+}
+
+/**
+ * Build the grid index for a set of outer loop bounding boxes.
+ * @param grid       Grid to initialize
+ * @param bboxes     Bounding boxes of the outer loops
+ * @param outerCount Number of outer loops
+ */
+static void createLoopGrid(LoopGrid *grid, const BBox *bboxes,
+                           const int outerCount) {
+    *grid = (LoopGrid){0};
+
+    // The grid covers the union of the non-transmeridian bounding boxes
+    bool hasExtent = false;
+    for (int i = 0; i < outerCount; i++) {
+        const BBox *bbox = &bboxes[i];
+        if (bboxIsTransmeridian(bbox)) {
+            continue;
+        }
+        if (!hasExtent) {
+            grid->extent = *bbox;
+            hasExtent = true;
+            continue;
+        }
+        if (bbox->south < grid->extent.south) grid->extent.south = bbox->south;
+        if (bbox->north > grid->extent.north) grid->extent.north = bbox->north;
+        if (bbox->west < grid->extent.west) grid->extent.west = bbox->west;
+        if (bbox->east > grid->extent.east) grid->extent.east = bbox->east;
+    }
+
+    // Aim for about one outer loop per grid cell
+    int dim = (int)ceil(sqrt((double)outerCount));
+    if (dim > LOOP_GRID_MAX_DIM) dim = LOOP_GRID_MAX_DIM;
+    if (hasExtent) {
+        grid->rows = grid->extent.north > grid->extent.south ? dim : 1;
+        grid->cols = grid->extent.east > grid->extent.west ? dim : 1;
+    }
+
+    int numGridCells = grid->rows * grid->cols;
+    grid->offsets = H3_MEMORY(calloc)(numGridCells + 1, sizeof(int));
+    assert(grid->offsets != NULL);
+    grid->large = H3_MEMORY(malloc)(MAX(outerCount, 1) * sizeof(int));
+    assert(grid->large != NULL);
+
+    // Count the entries in each grid cell, then turn counts into offsets
+    int row0, row1, col0, col1;
+    for (int i = 0; i < outerCount; i++) {
+        if (!loopGridRange(grid, &bboxes[i], &row0, &row1, &col0, &col1)) {
+            grid->large[grid->numLarge++] = i;
+            continue;
+        }
+        for (int r = row0; r <= row1; r++) {
+            for (int c = col0; c <= col1; c++) {
+                grid->offsets[r * grid->cols + c + 1]++;
+            }
+        }
+    }
+    for (int i = 0; i < numGridCells; i++) {
+        grid->offsets[i + 1] += grid->offsets[i];
+    }
+
+    grid->entries =
+        H3_MEMORY(malloc)(MAX(grid->offsets[numGridCells], 1) * sizeof(int));
+    assert(grid->entries != NULL);
+
+    // Fill each grid cell's list, advancing its offset to the next free
+    // entry, then shift the offsets back to the start of each list
+    for (int i = 0; i < outerCount; i++) {
+        if (!loopGridRange(grid, &bboxes[i], &row0, &row1, &col0, &col1)) {
+            continue;
+        }
+        for (int r = row0; r <= row1; r++) {
+            for (int c = col0; c <= col1; c++) {
+                grid->entries[grid->offsets[r * grid->cols + c]++] = i;
+            }
+        }
+    }
+    for (int i = numGridCells; i > 0; i--) {
+        grid->offsets[i] = grid->offsets[i - 1];
+    }
+    grid->offsets[0] = 0;
+}
+
+static void destroyLoopGrid(LoopGrid *grid) {
+    H3_MEMORY(free)(grid->offsets);
+    H3_MEMORY(free)(grid->entries);
+    H3_MEMORY(free)(grid->large);
+}
+
 /**
  * Find the polygon to which a given hole should be allocated. Note that this
  * function will return null if no parent is found.
  * @param  loop         Inner loop describing a hole
- * @param  polygon      Head of a linked list of polygons to check
+ * @param  polygons     Polygons to check, one per outer loop
  * @param  bboxes       Bounding boxes for polygons, used in point-in-poly check
- * @param  polygonCount Number of polygons to check
+ * @param  grid         Grid index of the polygon bounding boxes
+ * @param  candidates   Scratch space for candidate polygons
+ * @param  candidateBBoxes Scratch space for candidate bounding boxes
  * @return              Pointer to parent polygon, or null if not found
  */
 static const LinkedGeoPolygon *findPolygonForHole(
-    const LinkedGeoLoop *loop, const LinkedGeoPolygon *polygon,
-    const BBox *bboxes, const int polygonCount) {
-    // Early exit with no polygons
-    if (polygonCount == 0) {
-        return NULL;
+    const LinkedGeoLoop *loop, const LinkedGeoPolygon **polygons,
+    const BBox *bboxes, const LoopGrid *grid,
+    const LinkedGeoPolygon **candidates, const BBox **candidateBBoxes) {
+    const LatLng *point = &loop->first->vertex;
+
+    // Candidates are the polygons listed in the grid cell of the point, and
+    // the large polygons. Merge the two lists so candidates are checked in
+    // polygon order.
+    const int *cell = NULL;
+    int cellCount = 0;
+    if (grid->rows > 0 && point->lat >= grid->extent.south &&
+        point->lat <= grid->extent.north && point->lng >= grid->extent.west &&
+        point->lng <= grid->extent.east) {
+        int g = loopGridRow(grid, point->lat) * grid->cols +
+                loopGridCol(grid, point->lng);
+        cell = &grid->entries[grid->offsets[g]];
+        cellCount = grid->offsets[g + 1] - grid->offsets[g];
     }
-    // Initialize arrays for candidate loops and their bounding boxes
-    const LinkedGeoPolygon **candidates =
-        H3_MEMORY(malloc)(polygonCount * sizeof(LinkedGeoPolygon *));
-    assert(candidates != NULL);
-    const BBox **candidateBBoxes =
-        H3_MEMORY(malloc)(polygonCount * sizeof(BBox *));
-    assert(candidateBBoxes != NULL);
 
     // Find all polygons that contain the loop
     int candidateCount = 0;
-    int index = 0;
-    while (polygon) {
+    int i = 0;
+    int j = 0;
+    while (i < cellCount || j < grid->numLarge) {
+        int index;
+        if (j == grid->numLarge ||
+            (i < cellCount && cell[i] < grid->large[j])) {
+            index = cell[i++];
+        } else {
+            index = grid->large[j++];
+        }
         // We are guaranteed not to overlap, so just test the first point
-        if (pointInsideLinkedGeoLoop(polygon->first, &bboxes[index],
-                                     &loop->first->vertex)) {
-            candidates[candidateCount] = polygon;
+        if (pointInsideLinkedGeoLoop(polygons[index]->first, &bboxes[index],
+                                     point)) {
+            candidates[candidateCount] = polygons[index];
             candidateBBoxes[candidateCount] = &bboxes[index];
             candidateCount++;
         }
-        polygon = polygon->next;
-        index++;
     }
 
     // The most deeply nested container is the immediate parent
-    const LinkedGeoPolygon *parent =
-        findDeepestContainer(candidates, candidateBBoxes, candidateCount);
-
-    // Free allocated memory
-    H3_MEMORY(free)(candidates);
-    H3_MEMORY(free)(candidateBBoxes);
-
-    return parent;
+    return findDeepestContainer(candidates, candidateBBoxes, candidateCount);
 }
 
 /**
@@ -534,7 +683,10 @@ H3Error normalizeMultiPolygon(LinkedGeoPolygon *root) {
         H3_MEMORY(malloc)(loopCount * sizeof(LinkedGeoLoop *));
     assert(innerLoops != NULL);
 
-    // Create an array to hold the bounding boxes for the outer loops
+    // Create arrays to hold the outer loops' polygons and bounding boxes
+    LinkedGeoPolygon **polygons =
+        H3_MEMORY(malloc)(loopCount * sizeof(LinkedGeoPolygon *));
+    assert(polygons != NULL);
     BBox *bboxes = H3_MEMORY(malloc)(loopCount * sizeof(BBox));
     assert(bboxes != NULL);
 
@@ -551,6 +703,7 @@ H3Error normalizeMultiPolygon(LinkedGeoPolygon *root) {
         } else {
             polygon = polygon == NULL ? root : addNewLinkedPolygon(polygon);
             addLinkedLoop(polygon, loop);
+            polygons[outerCount] = polygon;
             bboxFromLinkedGeoLoop(loop, &bboxes[outerCount]);
             outerCount++;
         }
@@ -560,10 +713,22 @@ H3Error normalizeMultiPolygon(LinkedGeoPolygon *root) {
         loop = next;
     }
 
+    // Index the outer loops so each hole is only checked against the
+    // polygons near it
+    LoopGrid grid;
+    createLoopGrid(&grid, bboxes, outerCount);
+    const LinkedGeoPolygon **candidates =
+        H3_MEMORY(malloc)(MAX(outerCount, 1) * sizeof(LinkedGeoPolygon *));
+    assert(candidates != NULL);
+    const BBox **candidateBBoxes =
+        H3_MEMORY(malloc)(MAX(outerCount, 1) * sizeof(BBox *));
+    assert(candidateBBoxes != NULL);
+
     // Find polygon for each inner loop and assign the hole to it
     for (int i = 0; i < innerCount; i++) {
-        polygon = (LinkedGeoPolygon *)findPolygonForHole(innerLoops[i], root,
-                                                         bboxes, outerCount);
+        polygon = (LinkedGeoPolygon *)findPolygonForHole(
+            innerLoops[i], (const LinkedGeoPolygon **)polygons, bboxes, &grid,
+            candidates, candidateBBoxes);
         if (polygon) {
             addLinkedLoop(polygon, innerLoops[i]);
         } else {
@@ -578,7 +743,11 @@ H3Error normalizeMultiPolygon(LinkedGeoPolygon *root) {
     }
 
     // Free allocated memory
+    destroyLoopGrid(&grid);
+    H3_MEMORY(free)(candidates);
+    H3_MEMORY(free)(candidateBBoxes);
     H3_MEMORY(free)(innerLoops);
+    H3_MEMORY(free)(polygons);
     H3_MEMORY(free)(bboxes);
 
     return resultCode;
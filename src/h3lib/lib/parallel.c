@@ -0,0 +1,120 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file parallel.c
+ * @brief   Minimal fork-join helper for parallel algorithms
+ *
+ * Threads are only used when the library is built with H3_HAVE_PTHREADS
+ * (the ENABLE_THREADS CMake option). Otherwise all tasks run on the calling
+ * thread. Callers must not depend on the order in which tasks run.
+ */
+
+#include "parallel.h"
+
+#include "alloc.h"
+
+#ifdef H3_HAVE_PTHREADS
+#include <pthread.h>
+#include <stdbool.h>
+
+/** Maximum number of threads used by parallelFor */
+#define MAX_THREADS 256
+
+typedef struct {
+    ParallelTask run;
+    void *context;
+    int64_t numTasks;
+    int stride;
+    int first;
+#ifdef H3_THREAD_ALLOCATOR
+    // Allocator of the thread calling parallelFor
+    const H3Allocator *allocator;
+#endif
+} ParallelWorker;
+
+static void runTasks(const ParallelWorker *worker) {
+    for (int64_t task = worker->first; task < worker->numTasks;
+         task += worker->stride) {
+        worker->run(worker->context, task);
+    }
+}
+
+static void *runWorker(void *arg) {
+    const ParallelWorker *worker = (const ParallelWorker *)arg;
+#ifdef H3_THREAD_ALLOCATOR
+    H3_EXPORT(setThreadAllocator)(worker->allocator);
+#endif
+    runTasks(worker);
+    return NULL;
+}
+#endif
+
+/**
+ * Run `run(context, task)` for every task in [0, numTasks), using up to
+ * `numThreads` threads including the calling thread. Returns once all tasks
+ * have completed. Task `i` is run by worker `i % numThreads`, so the
+ * assignment of tasks does not depend on timing. Worker threads use the
+ * calling thread's allocator, if one is set with setThreadAllocator.
+ *
+ * @param numThreads Maximum number of threads to use
+ * @param numTasks   Number of tasks
+ * @param run        Function to run for each task
+ * @param context    Argument passed to each call of `run`
+ */
+void parallelFor(int numThreads, int64_t numTasks, ParallelTask run,
+                 void *context) {
+#ifdef H3_HAVE_PTHREADS
+    if (numThreads > MAX_THREADS) {
+        numThreads = MAX_THREADS;
+    }
+    if (numThreads > numTasks) {
+        numThreads = (int)numTasks;
+    }
+    if (numThreads > 1) {
+        ParallelWorker workers[MAX_THREADS];
+        pthread_t threads[MAX_THREADS];
+        bool started[MAX_THREADS];
+        for (int t = 0; t < numThreads; t++) {
+            workers[t] = (ParallelWorker){.run = run,
+                                          .context = context,
+                                          .numTasks = numTasks,
+                                          .stride = numThreads,
+                                          .first = t};
+#ifdef H3_THREAD_ALLOCATOR
+            workers[t].allocator = H3_EXPORT(getThreadAllocator)();
+#endif
+        }
+        for (int t = 1; t < numThreads; t++) {
+            started[t] = pthread_create(&threads[t], NULL, runWorker,
+                                        &workers[t]) == 0;
+        }
+        runTasks(&workers[0]);
+        for (int t = 1; t < numThreads; t++) {
+            if (started[t]) {
+                pthread_join(threads[t], NULL);
+            } else {
+                // Could not start a thread, so run its tasks here instead
+                runTasks(&workers[t]);
+            }
+        }
+        return;
+    }
+#else
+    (void)numThreads;
+#endif
+    for (int64_t task = 0; task < numTasks; task++) {
+        run(context, task);
+    }
+}
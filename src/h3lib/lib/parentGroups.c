@@ -0,0 +1,126 @@
+/*
+ * Copyright 2026 Uber Technologies, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *         http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/** @file parentGroups.c
+ * @brief   Run-length grouping of cells by their ancestors
+ */
+
+#include "parentGroups.h"
+
+#include <stdlib.h>
+
+#include "h3Index.h"
+
+/**
+ * Mask of the bits a cell shares with its parent at `res`: everything but
+ * the resolution and the digits after `res`.
+ */
+static inline uint64_t _parentKeyMask(int res) {
+    uint64_t unused =
+        ((uint64_t)1 << ((MAX_H3_RES - res) * H3_PER_DIGIT_OFFSET)) - 1;
+    return ~(H3_RES_MASK | unused);
+}
+
+/**
+ * Orders cells by their bits other than the resolution, so that coarser
+ * cells (whose unused digits are 7) sort after their descendants.
+ */
+static int _cmpParentOrder(const void *a, const void *b) {
+    H3Index ha = *(const H3Index *)a;
+    H3Index hb = *(const H3Index *)b;
+    H3Index ka = ha & ~H3_RES_MASK;
+    H3Index kb = hb & ~H3_RES_MASK;
+    if (ka != kb) return ka < kb ? -1 : +1;
+    if (ha != hb) return ha < hb ? -1 : +1;
+    return 0;
+}
+
+/**
+ * Sorts cells so that the descendants of any cell are contiguous. For cells
+ * of a single resolution this is numeric order; cells of mixed resolutions
+ * are ordered ignoring their resolution bits, which keeps them grouped
+ * under their common ancestors.
+ *
+ * @param cells Cells to sort in place
+ * @param numCells Number of cells
+ */
+void H3_EXPORT(sortCells)(H3Index *cells, int64_t numCells) {
+    if (numCells > 1) {
+        qsort(cells, numCells, sizeof(H3Index), _cmpParentOrder);
+    }
+}
+
+/**
+ * Groups runs of consecutive cells that share a parent, at several parent
+ * resolutions in one pass. When the cells are sorted (see sortCells), each
+ * parent appears in exactly one group per resolution, so aggregating to the
+ * parents is a scan over the groups instead of a hash table of parents.
+ *
+ * Two cells share a parent at `res` if their bits other than the resolution
+ * and the digits after `res` are equal, so each cell is compared with the
+ * previous one using one mask per resolution.
+ *
+ * @param cells Cells to group, of resolution at least each groups[i].res
+ * @param numCells Number of cells
+ * @param groups One entry per parent resolution. `res`, `parents` and
+ *               `counts` are set by the caller, with room for numCells
+ *               groups. `numGroups`, `parents` and `counts` are output.
+ * @param numResolutions Number of entries in groups
+ * @return E_SUCCESS, E_RES_DOMAIN for an invalid parent resolution,
+ * E_RES_MISMATCH if a cell is coarser than a parent resolution, or E_DOMAIN
+ * for a negative count
+ */
+H3Error H3_EXPORT(cellsToParentGroups)(const H3Index *cells, int64_t numCells,
+                                       ParentGroups *groups,
+                                       int numResolutions) {
+    if (numCells < 0 || numResolutions < 0) {
+        return E_DOMAIN;
+    }
+    int maxRes = 0;
+    for (int r = 0; r < numResolutions; r++) {
+        if (groups[r].res < 0 || groups[r].res > MAX_H3_RES) {
+            return E_RES_DOMAIN;
+        }
+        if (groups[r].res > maxRes) {
+            maxRes = groups[r].res;
+        }
+        groups[r].numGroups = 0;
+    }
+
+    H3Index prev = H3_NULL;
+    for (int64_t i = 0; i < numCells; i++) {
+        H3Index cell = cells[i];
+        if (H3_GET_RESOLUTION(cell) < maxRes) {
+            return E_RES_MISMATCH;
+        }
+        uint64_t diff = i ? prev ^ cell : UINT64_MAX;
+        for (int r = 0; r < numResolutions; r++) {
+            ParentGroups *g = &groups[r];
+            uint64_t keyMask = _parentKeyMask(g->res);
+            if (diff & keyMask) {
+                H3Index parent = (cell & keyMask) |
+                                 ((uint64_t)g->res << H3_RES_OFFSET) |
+                                 ~(keyMask | H3_RES_MASK);
+                g->parents[g->numGroups] = parent;
+                g->counts[g->numGroups] = 1;
+                g->numGroups++;
+            } else {
+                g->counts[g->numGroups - 1]++;
+            }
+        }
+        prev = cell;
+    }
+    return E_SUCCESS;
+}
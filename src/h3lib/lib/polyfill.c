@@ -64,6 +64,11 @@ static H3Index SOUTH_POLE_CELLS[MAX_H3_RES + 1] = {
     0x88f29380e1fffff, 0x89f29380e0fffff, 0x8af29380e0d7fff, 0x8bf29380e0d0fff,
     0x8cf29380e0d0dff, 0x8df29380e0d0cff, 0x8ef29380e0d0cc7, 0x8ff29380e0d0cc4};
 
+// Generated by generateCellBBoxTable. Defines CELL_BBOXES, the bounding
+// boxes covering the children of all cells up to CELL_BBOX_TABLE_RES, and
+// CELL_BBOXES_OFFSETS, the offset of each resolution in that table.
+#include "cellBBoxTable.h"
+
 /** Pre-calculated bounding boxes for all res 0 cells */
 static BBox RES0_BBOXES[NUM_BASE_CELLS] = {
     {1.52480158339146, 1.20305471830087, -0.60664883654036, 0.00568297271999},
@@ -209,16 +214,65 @@ static BBox RES0_BBOXES[NUM_BASE_CELLS] = {
 
 static BBox VALID_RANGE_BBOX = {M_PI_2, -M_PI_2, M_PI, -M_PI};
 
+/**
+ * Look up the bounding box covering the children of a cell in the
+ * precomputed table, if the table covers the cell's resolution. Cells with
+ * invalid digits are not in the table.
+ *
+ * @param cell Cell to look up
+ * @param out  BBox to hold output
+ * @return     Whether the bounding box was found in the table
+ */
+static bool cellBBoxFromTable(H3Index cell, BBox *out) {
+    int res = H3_GET_RESOLUTION(cell);
+    if (res > CELL_BBOX_TABLE_RES) {
+        return false;
+    }
+    int baseCell = H3_GET_BASE_CELL(cell);
+    if (baseCell >= NUM_BASE_CELLS) {
+        return false;
+    }
+    int64_t index = baseCell;
+    for (int r = 1; r <= res; r++) {
+        Direction digit = H3_GET_INDEX_DIGIT(cell, r);
+        if (digit == INVALID_DIGIT) {
+            return false;
+        }
+        index = index * 7 + digit;
+    }
+    *out = CELL_BBOXES[CELL_BBOXES_OFFSETS[res] + index];
+    return true;
+}
+
 /**
  * For a given cell, return its bounding box. If coverChildren is true, the bbox
  * will be guaranteed to contain its children at any finer resolution. Note that
  * no guarantee is provided as to the level of accuracy, and the bounding box
  * may have a significant margin of error.
+ *
+ * Boxes covering the children of coarse cells, as used by the polygon
+ * traversal, are looked up in a precomputed table.
+ *
  * @param cell Cell to calculate bbox for
  * @param out  BBox to hold output
  * @param coverChildren Whether the bounding box should cover all children
  */
 H3Error cellToBBox(H3Index cell, BBox *out, bool coverChildren) {
+    if (coverChildren && cellBBoxFromTable(cell, out)) {
+        return E_SUCCESS;
+    }
+    return _cellToBBoxComputed(cell, out, coverChildren);
+}
+
+/**
+ * Compute the bounding box of a cell as cellToBBox does, without the
+ * precomputed table. Used to generate the table.
+ *
+ * @param cell Cell to calculate bbox for
+ * @param out  BBox to hold output
+ * @param coverChildren Whether the bounding box should cover all children
+ */
+H3Error _cellToBBoxComputed(H3Index cell, BBox *out, bool coverChildren) {
     // Adjust the BBox to handle poles, if needed
     int res = H3_GET_RESOLUTION(cell);
 
@@ -389,6 +443,156 @@ IterCellsPolygonCompact iterInitPolygonCompact(const GeoPolygon *polygon,
     return iter;
 }
 
+/**
+ * Whether a cell at the target resolution should be included in the output
+ * for the given polygon, according to the containment mode.
+ *
+ * @param  polygon Polygon to test against
+ * @param  bboxes  Bounding boxes for the polygon and its holes
+ * @param  cell    Cell at the target resolution
+ * @param  mode    Containment mode
+ * @param  out     Output: whether the cell matches the polygon
+ * @return         E_SUCCESS, or an error if the cell geometry failed
+ */
+static H3Error cellMatchesPolygon(const GeoPolygon *polygon, const BBox *bboxes,
+                                  H3Index cell, ContainmentMode mode,
+                                  bool *out) {
+    *out = false;
+    if (mode == CONTAINMENT_CENTER || mode == CONTAINMENT_OVERLAPPING ||
+        mode == CONTAINMENT_OVERLAPPING_BBOX) {
+        // Check if the cell center is inside the polygon
+        LatLng center;
+        H3Error centerErr = H3_EXPORT(cellToLatLng)(cell, &center);
+        if (centerErr != E_SUCCESS) {
+            return centerErr;
+        }
+        if (pointInsidePolygon(polygon, bboxes, &center)) {
+            *out = true;
+            return E_SUCCESS;
+        }
+    }
+    if (mode == CONTAINMENT_OVERLAPPING ||
+        mode == CONTAINMENT_OVERLAPPING_BBOX) {
+        // For overlapping, we need to do a quick check to determine
+        // whether the polygon is wholly contained by the cell. We
+        // check the first polygon vertex, which if it is contained
+        // could also mean we simply intersect.
+
+        // Deferencing verts[0] is safe because callers check numVerts
+        LatLng firstVertex = polygon->geoloop.verts[0];
+
+        // We have to check whether the point is in the expected range
+        // first, because out-of-bounds values will yield false
+        // positives with latLngToCell
+        if (bboxContains(&VALID_RANGE_BBOX, &firstVertex)) {
+            H3Index polygonCell;
+            H3Error polygonCellErr = H3_EXPORT(latLngToCell)(
+                &firstVertex, H3_GET_RESOLUTION(cell), &polygonCell);
+            if (NEVER(polygonCellErr != E_SUCCESS)) {
+                // This should be unreachable with the bbox check
+                return polygonCellErr;
+            }
+            if (polygonCell == cell) {
+                *out = true;
+                return E_SUCCESS;
+            }
+        }
+    }
+    if (mode == CONTAINMENT_FULL || mode == CONTAINMENT_OVERLAPPING ||
+        mode == CONTAINMENT_OVERLAPPING_BBOX) {
+        CellBoundary boundary;
+        H3Error boundaryErr = H3_EXPORT(cellToBoundary)(cell, &boundary);
+        if (boundaryErr != E_SUCCESS) {
+            return boundaryErr;
+        }
+        BBox bbox;
+        H3Error bboxErr = cellToBBox(cell, &bbox, false);
+        if (NEVER(bboxErr != E_SUCCESS)) {
+            // Should be unreachable - invalid cells would be caught in
+            // the previous boundaryErr
+            return bboxErr;
+        }
+        // Check if the cell is fully contained by the polygon
+        if ((mode == CONTAINMENT_FULL ||
+             mode == CONTAINMENT_OVERLAPPING_BBOX) &&
+            cellBoundaryInsidePolygon(polygon, bboxes, &boundary, &bbox)) {
+            *out = true;
+            return E_SUCCESS;
+        }
+        // For overlap, we've already checked for center point inclusion
+        // above; if that failed, we only need to check for line
+        // intersection
+        else if ((mode == CONTAINMENT_OVERLAPPING ||
+                  mode == CONTAINMENT_OVERLAPPING_BBOX) &&
+                 cellBoundaryCrossesPolygon(polygon, bboxes, &boundary,
+                                            &bbox)) {
+            *out = true;
+            return E_SUCCESS;
+        }
+    }
+    if (mode == CONTAINMENT_OVERLAPPING_BBOX) {
+        // Get a bounding box containing all the cell's children, so
+        // this can work for the max size calculation
+        BBox bbox;
+        H3Error bboxErr = cellToBBox(cell, &bbox, true);
+        if (bboxErr) {
+            return bboxErr;
+        }
+        if (bboxOverlapsBBox(&bboxes[0], &bbox)) {
+            CellBoundary bboxBoundary = bboxToCellBoundary(&bbox);
+            if (
+                // cell bbox contains the polygon
+                bboxContainsBBox(&bbox, &bboxes[0]) ||
+                // polygon contains cell bbox
+                pointInsidePolygon(polygon, bboxes, &bboxBoundary.verts[0]) ||
+                // polygon crosses cell bbox
+                cellBoundaryCrossesPolygon(polygon, bboxes, &bboxBoundary,
+                                           &bbox)) {
+                *out = true;
+                return E_SUCCESS;
+            }
+        }
+    }
+    return E_SUCCESS;
+}
+
+/**
+ * Relationship between a polygon and the bounding box of all children of a
+ * coarse cell.
+ */
+typedef enum {
+    BBOX_DISJOINT,    ///< No child of the cell can touch the polygon
+    BBOX_INTERSECTS,  ///< Some children may touch the polygon
+    BBOX_CONTAINED    ///< All children are inside the polygon
+} ChildrenBBoxCoverage;
+
+/**
+ * Determine how a polygon covers the children of a coarser cell, given a
+ * bounding box guaranteed to contain all of those children.
+ *
+ * @param  polygon  Polygon to test against
+ * @param  bboxes   Bounding boxes for the polygon and its holes
+ * @param  cellBBox Bounding box containing all children of the cell
+ * @return          Coverage of the children by the polygon
+ */
+static ChildrenBBoxCoverage childrenBBoxCoverage(const GeoPolygon *polygon,
+                                                 const BBox *bboxes,
+                                                 const BBox *cellBBox) {
+    if (!bboxOverlapsBBox(&bboxes[0], cellBBox)) {
+        return BBOX_DISJOINT;
+    }
+    // Quick check for possible containment
+    if (bboxContainsBBox(&bboxes[0], cellBBox)) {
+        CellBoundary bboxBoundary = bboxToCellBoundary(cellBBox);
+        // Do a fine-grained, more expensive check on the polygon
+        if (cellBoundaryInsidePolygon(polygon, bboxes, &bboxBoundary,
+                                      cellBBox)) {
+            return BBOX_CONTAINED;
+        }
+    }
+    return BBOX_INTERSECTS;
+}
+
 /**
  * Increment the polyfill iterator, running the polygon to cells algorithm.
  *
@@ -433,115 +637,17 @@ void iterStepPolygonCompact(IterCellsPolygonCompact *iter) {
 
         // Target res: Do a fine-grained check
         if (cellRes == iter->_res) {
-            if (mode == CONTAINMENT_CENTER || mode == CONTAINMENT_OVERLAPPING ||
-                mode == CONTAINMENT_OVERLAPPING_BBOX) {
-                // Check if the cell center is inside the polygon
-                LatLng center;
-                H3Error centerErr = H3_EXPORT(cellToLatLng)(cell, &center);
-                if (centerErr != E_SUCCESS) {
-                    iterErrorPolygonCompact(iter, centerErr);
-                    return;
-                }
-                if (pointInsidePolygon(iter->_polygon, iter->_bboxes,
-                                       &center)) {
-                    // Set to next output
-                    iter->cell = cell;
-                    return;
-                }
-            }
-            if (mode == CONTAINMENT_OVERLAPPING ||
-                mode == CONTAINMENT_OVERLAPPING_BBOX) {
-                // For overlapping, we need to do a quick check to determine
-                // whether the polygon is wholly contained by the cell. We
-                // check the first polygon vertex, which if it is contained
-                // could also mean we simply intersect.
-
-                // Deferencing verts[0] is safe because we check numVerts above
-                LatLng firstVertex = iter->_polygon->geoloop.verts[0];
-
-                // We have to check whether the point is in the expected range
-                // first, because out-of-bounds values will yield false
-                // positives with latLngToCell
-                if (bboxContains(&VALID_RANGE_BBOX, &firstVertex)) {
-                    H3Index polygonCell;
-                    H3Error polygonCellErr = H3_EXPORT(latLngToCell)(
-                        &(iter->_polygon->geoloop.verts[0]), cellRes,
-                        &polygonCell);
-                    if (NEVER(polygonCellErr != E_SUCCESS)) {
-                        // This should be unreachable with the bbox check
-                        iterErrorPolygonCompact(iter, polygonCellErr);
-                        return;
-                    }
-                    if (polygonCell == cell) {
-                        // Set to next output
-                        iter->cell = cell;
-                        return;
-                    }
-                }
-            }
-            if (mode == CONTAINMENT_FULL || mode == CONTAINMENT_OVERLAPPING ||
-                mode == CONTAINMENT_OVERLAPPING_BBOX) {
-                CellBoundary boundary;
-                H3Error boundaryErr =
-                    H3_EXPORT(cellToBoundary)(cell, &boundary);
-                if (boundaryErr != E_SUCCESS) {
-                    iterErrorPolygonCompact(iter, boundaryErr);
-                    return;
-                }
-                BBox bbox;
-                H3Error bboxErr = cellToBBox(cell, &bbox, false);
-                if (NEVER(bboxErr != E_SUCCESS)) {
-                    // Should be unreachable - invalid cells would be caught in
-                    // the previous boundaryErr
-                    iterErrorPolygonCompact(iter, bboxErr);
-                    return;
-                }
-                // Check if the cell is fully contained by the polygon
-                if ((mode == CONTAINMENT_FULL ||
-                     mode == CONTAINMENT_OVERLAPPING_BBOX) &&
-                    cellBoundaryInsidePolygon(iter->_polygon, iter->_bboxes,
-                                              &boundary, &bbox)) {
-                    // Set to next output
-                    iter->cell = cell;
-                    return;
-                }
-                // For overlap, we've already checked for center point inclusion
-                // above; if that failed, we only need to check for line
-                // intersection
-                else if ((mode == CONTAINMENT_OVERLAPPING ||
-                          mode == CONTAINMENT_OVERLAPPING_BBOX) &&
-                         cellBoundaryCrossesPolygon(
-                             iter->_polygon, iter->_bboxes, &boundary, &bbox)) {
-                    // Set to next output
-                    iter->cell = cell;
-                    return;
-                }
+            bool matches;
+            H3Error matchErr = cellMatchesPolygon(
+                iter->_polygon, iter->_bboxes, cell, mode, &matches);
+            if (matchErr) {
+                iterErrorPolygonCompact(iter, matchErr);
+                return;
             }
-            if (mode == CONTAINMENT_OVERLAPPING_BBOX) {
-                // Get a bounding box containing all the cell's children, so
-                // this can work for the max size calculation
-                BBox bbox;
-                H3Error bboxErr = cellToBBox(cell, &bbox, true);
-                if (bboxErr) {
-                    iterErrorPolygonCompact(iter, bboxErr);
-                    return;
-                }
-                if (bboxOverlapsBBox(&iter->_bboxes[0], &bbox)) {
-                    CellBoundary bboxBoundary = bboxToCellBoundary(&bbox);
-                    if (
-                        // cell bbox contains the polygon
-                        bboxContainsBBox(&bbox, &iter->_bboxes[0]) ||
-                        // polygon contains cell bbox
-                        pointInsidePolygon(iter->_polygon, iter->_bboxes,
-                                           &bboxBoundary.verts[0]) ||
-                        // polygon crosses cell bbox
-                        cellBoundaryCrossesPolygon(iter->_polygon,
-                                                   iter->_bboxes, &bboxBoundary,
-                                                   &bbox)) {
-                        iter->cell = cell;
-                        return;
-                    }
-                }
+            if (matches) {
+                // Set to next output
+                iter->cell = cell;
+                return;
             }
         }
 
@@ -554,19 +660,15 @@ void iterStepPolygonCompact(IterCellsPolygonCompact *iter) {
                 iterErrorPolygonCompact(iter, bboxErr);
                 return;
             }
-            if (bboxOverlapsBBox(&iter->_bboxes[0], &bbox)) {
-                // Quick check for possible containment
-                if (bboxContainsBBox(&iter->_bboxes[0], &bbox)) {
-                    CellBoundary bboxBoundary = bboxToCellBoundary(&bbox);
-                    // Do a fine-grained, more expensive check on the polygon
-                    if (cellBoundaryInsidePolygon(iter->_polygon, iter->_bboxes,
-                                                  &bboxBoundary, &bbox)) {
-                        // Bounding box is fully contained, so all children are
-                        // included. Set to next output.
-                        iter->cell = cell;
-                        return;
-                    }
-                }
+            ChildrenBBoxCoverage coverage =
+                childrenBBoxCoverage(iter->_polygon, iter->_bboxes, &bbox);
+            if (coverage == BBOX_CONTAINED) {
+                // Bounding box is fully contained, so all children are
+                // included. Set to next output.
+                iter->cell = cell;
+                return;
+            }
+            if (coverage == BBOX_INTERSECTS) {
                 // Otherwise, the intersecting bbox means we need to test all
                 // children, starting with the first child
                 H3Index child;
@@ -685,6 +787,326 @@ void iterDestroyPolygon(IterCellsPolygon *iter) {
     iter->error = E_SUCCESS;
 }
 
+static void iterErrorMultiPolygonCompact(IterCellsMultiPolygonCompact *iter,
+                                         H3Error error) {
+    iterDestroyMultiPolygonCompact(iter);
+    iter->error = error;
+}
+
+/**
+ * Internal function - initialize the multipolygon iterator without stepping
+ * to the first value
+ */
+static IterCellsMultiPolygonCompact _iterInitMultiPolygonCompact(
+    const GeoMultiPolygon *multiPolygon, int res, uint32_t flags) {
+    IterCellsMultiPolygonCompact iter = {// Initialize output properties. The
+                                         // first valid cell will be set in
+                                         // iterStep
+                                         .cell = baseCellNumToCell(0),
+                                         .part = -1,
+                                         .error = E_SUCCESS,
+                                         // Save input arguments
+                                         ._multiPolygon = multiPolygon,
+                                         ._res = res,
+                                         ._flags = flags,
+                                         ._bboxes = NULL,
+                                         ._bboxOffsets = NULL,
+                                         ._parentBBox = VALID_RANGE_BBOX,
+                                         ._started = false};
+
+    if (res < 0 || res > MAX_H3_RES) {
+        iterErrorMultiPolygonCompact(&iter, E_RES_DOMAIN);
+        return iter;
+    }
+
+    H3Error flagErr = validatePolygonFlags(flags);
+    if (flagErr) {
+        iterErrorMultiPolygonCompact(&iter, flagErr);
+        return iter;
+    }
+
+    if (multiPolygon->numPolygons < 0) {
+        iterErrorMultiPolygonCompact(&iter, E_DOMAIN);
+        return iter;
+    }
+
+    // Short-circuit iteration for an empty multipolygon
+    if (multiPolygon->numPolygons == 0) {
+        iterDestroyMultiPolygonCompact(&iter);
+        return iter;
+    }
+
+    // Bounding boxes for every part and its holes are stored in a single
+    // array, with the offset of each part's boxes recorded separately.
+    // Memory allocated here must be released through
+    // iterDestroyMultiPolygonCompact
+    iter._bboxOffsets =
+        H3_MEMORY(calloc)(multiPolygon->numPolygons, sizeof(int64_t));
+    if (!iter._bboxOffsets) {
+        iterErrorMultiPolygonCompact(&iter, E_MEMORY_ALLOC);
+        return iter;
+    }
+    int64_t numBBoxes = 0;
+    for (int i = 0; i < multiPolygon->numPolygons; i++) {
+        iter._bboxOffsets[i] = numBBoxes;
+        numBBoxes += multiPolygon->polygons[i].numHoles + 1;
+    }
+    iter._bboxes = H3_MEMORY(calloc)(numBBoxes, sizeof(BBox));
+    if (!iter._bboxes) {
+        iterErrorMultiPolygonCompact(&iter, E_MEMORY_ALLOC);
+        return iter;
+    }
+    for (int i = 0; i < multiPolygon->numPolygons; i++) {
+        bboxesFromGeoPolygon(&multiPolygon->polygons[i],
+                             &iter._bboxes[iter._bboxOffsets[i]]);
+    }
+
+    return iter;
+}
+
+/**
+ * Initialize a IterCellsMultiPolygonCompact struct representing the sequence
+ * of compact cells within any of the parts of the target multipolygon. The
+ * traversal of the global grid is shared by all parts: each coarse candidate
+ * cell is visited (and its bounding box computed) once, regardless of the
+ * number of parts.
+ *
+ * Each output cell is tagged with the index of the part that contains it in
+ * the `part` property. Cells are never output more than once; if more than one
+ * part matches a cell, the cell is assigned to the part with the lowest index.
+ *
+ * Initialization of this object may fail, in which case the `error` property
+ * will be set and all iteration will return H3_NULL. It is the responsibility
+ * of the caller to check the error property after initialization.
+ *
+ * Note that initializing the iterator allocates memory. If an iterator is
+ * exhausted or returns an error that memory is released; otherwise it must be
+ * released manually with iterDestroyMultiPolygonCompact.
+ *
+ * @param  multiPolygon Multipolygon to fill with compact cells
+ * @param  res          Finest resolution for output cells
+ * @param  flags        Bit mask of option flags
+ * @return              Initialized iterator, with the first value available
+ */
+IterCellsMultiPolygonCompact iterInitMultiPolygonCompact(
+    const GeoMultiPolygon *multiPolygon, int res, uint32_t flags) {
+    IterCellsMultiPolygonCompact iter =
+        _iterInitMultiPolygonCompact(multiPolygon, res, flags);
+
+    // Start the iterator by taking the first step.
+    // This is necessary to have a valid value after initialization.
+    iterStepMultiPolygonCompact(&iter);
+
+    return iter;
+}
+
+/**
+ * Increment the multipolygon iterator. This follows the same hierarchical
+ * traversal as iterStepPolygonCompact, testing each candidate cell against
+ * the parts in order:
+ * - A coarse cell is output if the first part whose bounding box intersects
+ *   the cell's children contains all of them; if that part only intersects,
+ *   we recurse into the children.
+ * - A cell at the target resolution is output with the first part it matches
+ *   under the containment mode. Only parts intersecting the bounding box of
+ *   the parent's children are tested, so no bounding box is computed for
+ *   cells at the target resolution.
+ *
+ * @param  iter Iterator to increment
+ */
+void iterStepMultiPolygonCompact(IterCellsMultiPolygonCompact *iter) {
+    H3Index cell = iter->cell;
+
+    // once the cell is H3_NULL, the iterator returns an infinite sequence of
+    // H3_NULL
+    if (cell == H3_NULL) return;
+
+    // For the first step, we need to evaluate the current cell; after that, we
+    // should start with the next cell.
+    if (iter->_started) {
+        cell = nextCell(cell);
+    } else {
+        iter->_started = true;
+    }
+
+    const GeoMultiPolygon *multiPolygon = iter->_multiPolygon;
+    ContainmentMode mode = FLAG_GET_CONTAINMENT_MODE(iter->_flags);
+
+    while (cell) {
+        int cellRes = H3_GET_RESOLUTION(cell);
+
+        // Get a bounding box for all of the children of a coarse cell,
+        // shared by all parts. Cells at the target res are filtered by their
+        // parent's box instead, which covers all of its children.
+        BBox bbox = iter->_parentBBox;
+        if (cellRes < iter->_res) {
+            H3Error bboxErr = cellToBBox(cell, &bbox, true);
+            if (bboxErr) {
+                iterErrorMultiPolygonCompact(iter, bboxErr);
+                return;
+            }
+        }
+
+        bool descend = false;
+        for (int i = 0; i < multiPolygon->numPolygons; i++) {
+            const GeoPolygon *polygon = &multiPolygon->polygons[i];
+            const BBox *bboxes = &iter->_bboxes[iter->_bboxOffsets[i]];
+            if (polygon->geoloop.numVerts == 0 ||
+                !bboxOverlapsBBox(&bboxes[0], &bbox)) {
+                continue;
+            }
+
+            // Target res: Do a fine-grained check
+            if (cellRes == iter->_res) {
+                bool matches;
+                H3Error matchErr =
+                    cellMatchesPolygon(polygon, bboxes, cell, mode, &matches);
+                if (matchErr) {
+                    iterErrorMultiPolygonCompact(iter, matchErr);
+                    return;
+                }
+                if (matches) {
+                    iter->cell = cell;
+                    iter->part = i;
+                    return;
+                }
+                continue;
+            }
+
+            // Coarser cell: the first part touching the children decides.
+            // Emitting the cell for a later part could take children that an
+            // earlier part would otherwise claim.
+            if (childrenBBoxCoverage(polygon, bboxes, &bbox) ==
+                BBOX_CONTAINED) {
+                iter->cell = cell;
+                iter->part = i;
+                return;
+            }
+            descend = true;
+            break;
+        }
+
+        if (descend) {
+            H3Index child;
+            H3Error childErr =
+                H3_EXPORT(cellToCenterChild)(cell, cellRes + 1, &child);
+            if (childErr) {
+                iterErrorMultiPolygonCompact(iter, childErr);
+                return;
+            }
+            // All cells until we next move up a level are siblings of the
+            // child
+            iter->_parentBBox = bbox;
+            // Restart the loop with the child cell
+            cell = child;
+            continue;
+        }
+
+        // Find the next cell in the sequence of all cells and continue
+        cell = nextCell(cell);
+    }
+    // If we make it out of the loop, we're done
+    iterDestroyMultiPolygonCompact(iter);
+}
+
+/**
+ * Destroy a multipolygon iterator, releasing any allocated memory. Iterators
+ * destroyed in this manner are safe to use but will always return H3_NULL.
+ * @param  iter Iterator to destroy
+ */
+void iterDestroyMultiPolygonCompact(IterCellsMultiPolygonCompact *iter) {
+    if (iter->_bboxes) {
+        H3_MEMORY(free)(iter->_bboxes);
+    }
+    if (iter->_bboxOffsets) {
+        H3_MEMORY(free)(iter->_bboxOffsets);
+    }
+    iter->cell = H3_NULL;
+    iter->part = -1;
+    iter->error = E_SUCCESS;
+    iter->_multiPolygon = NULL;
+    iter->_res = -1;
+    iter->_flags = 0;
+    iter->_bboxes = NULL;
+    iter->_bboxOffsets = NULL;
+}
+
+/**
+ * Initialize a IterCellsMultiPolygon struct representing the sequence of
+ * cells within the parts of the target multipolygon, at the target
+ * resolution. See iterInitMultiPolygonCompact for the handling of parts.
+ *
+ * Note that initializing the iterator allocates memory. If an iterator is
+ * exhausted or returns an error that memory is released; otherwise it must be
+ * released manually with iterDestroyMultiPolygon.
+ *
+ * @param  multiPolygon Multipolygon to fill with cells
+ * @param  res          Resolution for output cells
+ * @param  flags        Bit mask of option flags
+ * @return              Initialized iterator, with the first value available
+ */
+IterCellsMultiPolygon iterInitMultiPolygon(const GeoMultiPolygon *multiPolygon,
+                                           int res, uint32_t flags) {
+    // Create the sub-iterator for compact cells
+    IterCellsMultiPolygonCompact cellIter =
+        iterInitMultiPolygonCompact(multiPolygon, res, flags);
+    // Create the sub-iterator for children
+    IterCellsChildren childIter = iterInitParent(cellIter.cell, res);
+
+    IterCellsMultiPolygon iter = {.cell = childIter.h,
+                                  .part = cellIter.part,
+                                  .error = cellIter.error,
+                                  ._cellIter = cellIter,
+                                  ._childIter = childIter};
+    return iter;
+}
+
+/**
+ * Increment the multipolygon iterator, outputting the latest cell at the
+ * desired resolution along with its part index.
+ *
+ * @param  iter Iterator to increment
+ */
+void iterStepMultiPolygon(IterCellsMultiPolygon *iter) {
+    if (iter->cell == H3_NULL) return;
+
+    // See if there are more children to output
+    iterStepChild(&(iter->_childIter));
+    if (iter->_childIter.h) {
+        iter->cell = iter->_childIter.h;
+        return;
+    }
+
+    // Otherwise, increment the polyfill iterator
+    iterStepMultiPolygonCompact(&(iter->_cellIter));
+    if (iter->_cellIter.cell) {
+        _iterInitParent(iter->_cellIter.cell, iter->_cellIter._res,
+                        &(iter->_childIter));
+        iter->cell = iter->_childIter.h;
+        iter->part = iter->_cellIter.part;
+        return;
+    }
+
+    // All done, set to null and report errors if any
+    iter->cell = H3_NULL;
+    iter->part = -1;
+    iter->error = iter->_cellIter.error;
+}
+
+/**
+ * Destroy an iterator, releasing any allocated memory. Iterators destroyed in
+ * this manner are safe to use but will always return H3_NULL.
+ * @param  iter Iterator to destroy
+ */
+void iterDestroyMultiPolygon(IterCellsMultiPolygon *iter) {
+    iterDestroyMultiPolygonCompact(&(iter->_cellIter));
+    // null out the child iterator by passing H3_NULL
+    _iterInitParent(H3_NULL, 0, &(iter->_childIter));
+    iter->cell = H3_NULL;
+    iter->part = -1;
+    iter->error = E_SUCCESS;
+}
+
 /**
  * polygonToCells takes a given GeoJSON-like data structure and preallocated,
  * zeroed memory, and fills it with the hexagons that are contained by
@@ -720,6 +1142,29 @@ static double getAverageCellArea(int res) {
     return hexAreaKm2;
 }
 
+/**
+ * Determine the res for the size estimate of a polygon, based on a (very)
+ * rough estimate of the number of cells at various resolutions that would fit
+ * in its bounding box. All we need here is a general order of magnitude.
+ *
+ * @param bbox Bounding box of the polygon
+ * @param res  Target resolution
+ * @return     Resolution, no finer than res, at which to count cells
+ */
+static int sizeEstimateRes(const BBox *bbox, int res) {
+    // Get a (very) rough area of the polygon bounding box
+    double polygonBBoxAreaKm2 =
+        bboxHeightRads(bbox) * bboxWidthRads(bbox) /
+        cos(fmin(fabs(bbox->north), fabs(bbox->south))) * EARTH_RADIUS_KM *
+        EARTH_RADIUS_KM;
+
+    while (res > 0 && polygonBBoxAreaKm2 / getAverageCellArea(res - 1) >
+                          MAX_SIZE_CELL_THRESHOLD) {
+        res--;
+    }
+    return res;
+}
+
 /**
  * maxPolygonToCellsSize returns the number of cells to allocate space for
  * when performing a polygonToCells on the given GeoJSON-like data structure.
@@ -749,21 +1194,8 @@ H3Error H3_EXPORT(maxPolygonToCellsSizeExperimental)(const GeoPolygon *polygon,
     // Ignore the requested flags and use the faster overlapping-bbox mode
     iter._flags = CONTAINMENT_OVERLAPPING_BBOX;
 
-    // Get a (very) rough area of the polygon bounding box
-    BBox *polygonBBox = &iter._bboxes[0];
-    double polygonBBoxAreaKm2 =
-        bboxHeightRads(polygonBBox) * bboxWidthRads(polygonBBox) /
-        cos(fmin(fabs(polygonBBox->north), fabs(polygonBBox->south))) *
-        EARTH_RADIUS_KM * EARTH_RADIUS_KM;
-
-    // Determine the res for the size estimate, based on a (very) rough estimate
-    // of the number of cells at various resolutions that would fit in the
-    // polygon. All we need here is a general order of magnitude.
-    while (iter._res > 0 &&
-           polygonBBoxAreaKm2 / getAverageCellArea(iter._res - 1) >
-               MAX_SIZE_CELL_THRESHOLD) {
-        iter._res--;
-    }
+    // Count cells at a coarser res, depending on the polygon size
+    iter._res = sizeEstimateRes(&iter._bboxes[0], res);
 
     // Now run the polyfill, counting the output in the target res.
     // We have to take the first step outside the loop, to get the first
@@ -779,3 +1211,143 @@ H3Error H3_EXPORT(maxPolygonToCellsSizeExperimental)(const GeoPolygon *polygon,
 
     return iter.error;
 }
+
+/**
+ * multiPolygonToCellsExperimental fills all parts of a multipolygon in a
+ * single traversal of the grid, writing each cell at most once. Polygons are
+ * considered in Cartesian space.
+ *
+ * If a cell matches more than one part (for overlapping parts), it is
+ * assigned to the part with the lowest index.
+ *
+ * @param multiPolygon The polygons (each with a geoloop and holes) to fill
+ * @param res The Hexagon resolution (0-15)
+ * @param flags Algorithm flags such as containment mode
+ * @param size Maximum number of indexes to write to `out`.
+ * @param out The slab of zeroed memory to write to. Must be at least of size
+ * `size`.
+ * @param partIds Optional (may be NULL) array of at least `size` elements.
+ * If provided, the index of the part containing each output cell is written
+ * at the same offset as the cell.
+ */
+H3Error H3_EXPORT(multiPolygonToCellsExperimental)(
+    const GeoMultiPolygon *multiPolygon, int res, uint32_t flags, int64_t size,
+    H3Index *out, int *partIds) {
+    IterCellsMultiPolygon iter = iterInitMultiPolygon(multiPolygon, res, flags);
+    int64_t i = 0;
+    for (; iter.cell; iterStepMultiPolygon(&iter)) {
+        if (i >= size) {
+            iterDestroyMultiPolygon(&iter);
+            return E_MEMORY_BOUNDS;
+        }
+        if (partIds) {
+            partIds[i] = iter.part;
+        }
+        out[i++] = iter.cell;
+    }
+    return iter.error;
+}
+
+/**
+ * maxMultiPolygonToCellsSizeExperimental returns the number of cells to
+ * allocate space for when performing multiPolygonToCellsExperimental on the
+ * given multipolygon.
+ *
+ * As for maxPolygonToCellsSizeExperimental, each part is counted in the
+ * overlapping-bbox mode at a coarser res depending on its size. All parts are
+ * counted in a single traversal of the grid, and a cell counted for one part
+ * is not counted again for the others.
+ *
+ * @param multiPolygon The polygons to fill
+ * @param res Hexagon resolution (0-15)
+ * @param flags Bit mask of option flags
+ * @param out number of cells to allocate for
+ * @return 0 (E_SUCCESS) on success.
+ */
+H3Error H3_EXPORT(maxMultiPolygonToCellsSizeExperimental)(
+    const GeoMultiPolygon *multiPolygon, int res, uint32_t flags,
+    int64_t *out) {
+    // Initialize the iterator without stepping, to validate the arguments
+    // and get the bounding boxes of the parts
+    IterCellsMultiPolygonCompact iter =
+        _iterInitMultiPolygonCompact(multiPolygon, res, flags);
+    if (iter.error) {
+        return iter.error;
+    }
+    *out = 0;
+    if (iter.cell == H3_NULL) {
+        // Empty multipolygon
+        return E_SUCCESS;
+    }
+
+    // Res at which to count each part, or -1 to skip a 0-vertex part
+    int *partRes = H3_MEMORY(malloc)(multiPolygon->numPolygons * sizeof(int));
+    if (!partRes) {
+        iterDestroyMultiPolygonCompact(&iter);
+        return E_MEMORY_ALLOC;
+    }
+    H3Index cell = H3_NULL;
+    for (int i = 0; i < multiPolygon->numPolygons; i++) {
+        partRes[i] = -1;
+        if (multiPolygon->polygons[i].geoloop.numVerts > 0) {
+            partRes[i] =
+                sizeEstimateRes(&iter._bboxes[iter._bboxOffsets[i]], res);
+            cell = iter.cell;
+        }
+    }
+
+    H3Error err = E_SUCCESS;
+    while (cell) {
+        int cellRes = H3_GET_RESOLUTION(cell);
+        BBox bbox;
+        err = cellToBBox(cell, &bbox, true);
+        if (err) {
+            break;
+        }
+
+        // A cell counted for any part covers all of its children, so it is
+        // only descended into if no part counts it
+        bool counted = false;
+        bool descend = false;
+        for (int i = 0; i < multiPolygon->numPolygons && !counted; i++) {
+            const GeoPolygon *polygon = &multiPolygon->polygons[i];
+            const BBox *bboxes = &iter._bboxes[iter._bboxOffsets[i]];
+            if (partRes[i] < cellRes || !bboxOverlapsBBox(&bboxes[0], &bbox)) {
+                continue;
+            }
+            if (cellRes == partRes[i]) {
+                err = cellMatchesPolygon(polygon, bboxes, cell,
+                                         CONTAINMENT_OVERLAPPING_BBOX,
+                                         &counted);
+                if (err) {
+                    break;
+                }
+            } else if (childrenBBoxCoverage(polygon, bboxes, &bbox) ==
+                       BBOX_CONTAINED) {
+                counted = true;
+            } else {
+                descend = true;
+            }
+        }
+        if (err) {
+            break;
+        }
+
+        if (counted) {
+            int64_t childrenSize;
+            H3_EXPORT(cellToChildrenSize)(cell, res, &childrenSize);
+            *out += childrenSize;
+        } else if (descend) {
+            err = H3_EXPORT(cellToCenterChild)(cell, cellRes + 1, &cell);
+            if (err) {
+                break;
+            }
+            continue;
+        }
+        cell = nextCell(cell);
+    }
+
+    H3_MEMORY(free)(partRes);
+    iterDestroyMultiPolygonCompact(&iter);
+    return err;
+}
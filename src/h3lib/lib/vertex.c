@@ -47,16 +47,11 @@ static const PentagonDirectionFaces pentagonDirectionFaces[NUM_PENTAGONS] = {
 
 /**
  * Get the number of CCW rotations of the cell's vertex numbers
- * compared to the directional layout of its neighbors.
+ * compared to the directional layout of its neighbors, given the cell's
+ * FaceIJK address.
  * @param out Number of CCW rotations for the cell
  */
-static H3Error vertexRotations(H3Index cell, int *out) {
-    // Get the face and other info for the origin
-    FaceIJK fijk;
-    H3Error err = _h3ToFaceIjk(cell, &fijk);
-    if (err) {
-        return err;
-    }
+static H3Error vertexRotationsFaceIjk(H3Index cell, FaceIJK fijk, int *out) {
     int baseCell = H3_EXPORT(getBaseCellNumber)(cell);
     int cellLeadingDigit = _h3LeadingNonZeroDigit(cell);
 
@@ -108,6 +103,21 @@ static H3Error vertexRotations(H3Index cell, int *out) {
     return E_SUCCESS;
 }
 
+/**
+ * Get the number of CCW rotations of the cell's vertex numbers
+ * compared to the directional layout of its neighbors.
+ * @param out Number of CCW rotations for the cell
+ */
+static H3Error vertexRotations(H3Index cell, int *out) {
+    // Get the face and other info for the origin
+    FaceIJK fijk;
+    H3Error err = _h3ToFaceIjk(cell, &fijk);
+    if (err) {
+        return err;
+    }
+    return vertexRotationsFaceIjk(cell, fijk, out);
+}
+
 /** @brief Hexagon direction to vertex number relationships (same face).
  *         Note that we don't use direction 0 (center).
  */
@@ -153,6 +163,37 @@ int vertexNumForDirection(const H3Index origin, const Direction direction) {
     }
 }
 
+/**
+ * Get the first vertex number for each direction of a cell, as
+ * vertexNumForDirection, given the cell's FaceIJK address. This finds the
+ * cell's vertex rotations once for all of its directions.
+ * @param vertexNums Output: NUM_DIGITS vertex numbers, by direction, with
+ *                   INVALID_VERTEX_NUM for directions not valid for the cell
+ */
+H3Error vertexNumsForDirections(const H3Index origin, const FaceIJK *fijk,
+                                int *vertexNums) {
+    int rotations;
+    H3Error err = vertexRotationsFaceIjk(origin, *fijk, &rotations);
+    if (err) {
+        return err;
+    }
+    int isPent = H3_EXPORT(isPentagon)(origin);
+    for (Direction d = CENTER_DIGIT; d < NUM_DIGITS; d++) {
+        if (d == CENTER_DIGIT || (isPent && d == K_AXES_DIGIT)) {
+            vertexNums[d] = INVALID_VERTEX_NUM;
+        } else if (isPent) {
+            vertexNums[d] = (directionToVertexNumPent[d] + NUM_PENT_VERTS -
+                             rotations) %
+                            NUM_PENT_VERTS;
+        } else {
+            vertexNums[d] =
+                (directionToVertexNumHex[d] + NUM_HEX_VERTS - rotations) %
+                NUM_HEX_VERTS;
+        }
+    }
+    return E_SUCCESS;
+}
+
 /** @brief Vertex number to hexagon direction relationships (same face).
  */
 static const Direction vertexNumToDirectionHex[NUM_HEX_VERTS] = {
@@ -293,27 +334,194 @@ H3Error H3_EXPORT(cellToVertex)(H3Index cell, int vertexNum, H3Index *out) {
 }
 
 /**
- * Get all vertexes for the given cell
+ * The neighbors of a cell across its vertexes, each found at most once while
+ * getting all of the cell's vertexes.
+ */
+typedef struct {
+    H3Index cell;
+    int cellIsPentagon;
+    /** The vertex rotations of the cell */
+    int rotations;
+    /** The neighbor in each direction, or H3_NULL if not found yet */
+    H3Index neighbors[NUM_DIGITS];
+    /** The rotations from h3NeighborRotations for each neighbor */
+    int neighborRotations[NUM_DIGITS];
+    /** The vertex rotations of each neighbor, or -1 if not found yet */
+    int ownerRotations[NUM_DIGITS];
+} VertexNeighbors;
+
+/**
+ * Get the direction for a vertex number of the cell, as
+ * directionForVertexNum.
+ */
+static Direction _vertexNeighborsDirection(const VertexNeighbors *vn,
+                                           int vertexNum) {
+    return vn->cellIsPentagon
+               ? vertexNumToDirectionPent[(vertexNum + vn->rotations) %
+                                          NUM_PENT_VERTS]
+               : vertexNumToDirectionHex[(vertexNum + vn->rotations) %
+                                         NUM_HEX_VERTS];
+}
+
+/**
+ * Get the neighbor of the cell in a direction, finding it the first time.
+ */
+static H3Error _vertexNeighbor(VertexNeighbors *vn, Direction dir,
+                               H3Index *out) {
+    if (vn->neighbors[dir] == H3_NULL) {
+        int rotations = 0;
+        H3Error err =
+            h3NeighborRotations(vn->cell, dir, &rotations, &vn->neighbors[dir]);
+        if (err) {
+            vn->neighbors[dir] = H3_NULL;
+            return err;
+        }
+        vn->neighborRotations[dir] = rotations;
+    }
+    *out = vn->neighbors[dir];
+    return E_SUCCESS;
+}
+
+/**
+ * Get the first vertex number of the edge from the neighbor in a direction
+ * back to the cell, as vertexNumForDirection, finding the vertex rotations
+ * of a hexagon neighbor the first time.
+ */
+static int _vertexNeighborVertexNum(VertexNeighbors *vn, Direction dir) {
+    H3Index owner = vn->neighbors[dir];
+    if (H3_EXPORT(isPentagon)(owner)) {
+        return vertexNumForDirection(owner,
+                                     directionForNeighbor(owner, vn->cell));
+    }
+    if (vn->ownerRotations[dir] == -1 &&
+        vertexRotations(owner, &vn->ownerRotations[dir])) {
+        vn->ownerRotations[dir] = -1;
+        return INVALID_VERTEX_NUM;
+    }
+    Direction revDir = DIRECTIONS[(revNeighborDirectionsHex[dir] +
+                                   vn->neighborRotations[dir]) %
+                                  NUM_HEX_VERTS];
+    return (directionToVertexNumHex[revDir] + NUM_HEX_VERTS -
+            vn->ownerRotations[dir]) %
+           NUM_HEX_VERTS;
+}
+
+/**
+ * Get all vertexes for the given cell. This finds the same vertexes as
+ * cellToVertex for each vertex number, but finds each neighbor of the cell
+ * once for the two vertexes it shares with the cell.
  * @param cell      Cell to get the vertexes for
  * @param vertexes  Array to hold vertex output. Must have length >= 6.
  */
 H3Error H3_EXPORT(cellToVertexes)(H3Index cell, H3Index *vertexes) {
     // Get all vertexes. If the cell is a pentagon, will fill the final slot
     // with H3_NULL.
-    bool isPent = H3_EXPORT(isPentagon)(cell);
-    for (int i = 0; i < NUM_HEX_VERTS; i++) {
-        if (i == 5 && isPent) {
-            vertexes[i] = H3_NULL;
-        } else {
-            H3Error cellError = H3_EXPORT(cellToVertex)(cell, i, &vertexes[i]);
-            if (cellError) {
-                return cellError;
+    VertexNeighbors vn = {.cell = cell,
+                          .cellIsPentagon = H3_EXPORT(isPentagon)(cell)};
+    int cellNumVerts = vn.cellIsPentagon ? NUM_PENT_VERTS : NUM_HEX_VERTS;
+    int res = H3_GET_RESOLUTION(cell);
+
+    // If the cell is the center child of its parent, it will always have
+    // the lowest index of any neighbor, so it owns all of its vertexes
+    bool ownsAll = res != 0 && H3_GET_INDEX_DIGIT(cell, res) == CENTER_DIGIT;
+    if (!ownsAll && vertexRotations(cell, &vn.rotations)) {
+        return E_FAILED;
+    }
+    for (int d = 0; d < NUM_DIGITS; d++) {
+        vn.ownerRotations[d] = -1;
+    }
+
+    for (int vertexNum = 0; vertexNum < cellNumVerts; vertexNum++) {
+        // Determine the owner as cellToVertex does, looking at the three
+        // cells that share the vertex.
+        H3Index owner = cell;
+        int ownerVertexNum = vertexNum;
+        if (!ownsAll) {
+            Direction left = _vertexNeighborsDirection(&vn, vertexNum);
+            H3Index leftNeighbor;
+            H3Error err = _vertexNeighbor(&vn, left, &leftNeighbor);
+            if (err) return err;
+            if (leftNeighbor < owner) owner = leftNeighbor;
+
+            // As above, skip the right neighbor if the left is known lowest
+            if (res == 0 ||
+                H3_GET_INDEX_DIGIT(leftNeighbor, res) != CENTER_DIGIT) {
+                // Note that vertex - 1 is the right side, as vertex numbers
+                // are CCW
+                Direction right = _vertexNeighborsDirection(
+                    &vn, (vertexNum - 1 + cellNumVerts) % cellNumVerts);
+                H3Index rightNeighbor;
+                err = _vertexNeighbor(&vn, right, &rightNeighbor);
+                if (err) return err;
+                if (rightNeighbor < owner) {
+                    owner = rightNeighbor;
+                    ownerVertexNum = _vertexNeighborVertexNum(&vn, right);
+                }
+            }
+
+            // For the left neighbor, we need the second vertex of the edge,
+            // which may involve looping around the vertex nums
+            if (owner == leftNeighbor) {
+                ownerVertexNum = _vertexNeighborVertexNum(&vn, left) + 1;
+                if (ownerVertexNum == NUM_HEX_VERTS ||
+                    (H3_EXPORT(isPentagon)(owner) &&
+                     ownerVertexNum == NUM_PENT_VERTS)) {
+                    ownerVertexNum = 0;
+                }
             }
         }
+
+        H3Index vertex = owner;
+        H3_SET_MODE(vertex, H3_VERTEX_MODE);
+        H3_SET_RESERVED_BITS(vertex, ownerVertexNum);
+        vertexes[vertexNum] = vertex;
+    }
+    if (vn.cellIsPentagon) {
+        vertexes[5] = H3_NULL;
     }
     return E_SUCCESS;
 }
 
+/**
+ * Get all vertexes for each of an array of cells, as cellToVertexes.
+ *
+ * Errors are reported per cell: a failing cell has H3_NULL vertexes, and has
+ * its bit set in errorBitmap.
+ *
+ * @param cells     Cells to get the vertexes for
+ * @param numCells  Number of cells
+ * @param vertexes  Output: 6 * numCells vertexes, 6 per cell
+ * @param errorBitmap Output, error bitmap of the cells (see h3Index.h)
+ * @return E_SUCCESS, the error of the first cell that failed, or E_DOMAIN if
+ * numCells is negative
+ */
+H3Error H3_EXPORT(cellsToVertexes)(const H3Index *cells, int64_t numCells,
+                                   H3Index *vertexes, uint64_t *errorBitmap) {
+    if (numCells < 0) {
+        return E_DOMAIN;
+    }
+    H3Error firstError = E_SUCCESS;
+    for (int64_t start = 0; start < numCells; start += 64) {
+        int64_t blockSize = numCells - start < 64 ? numCells - start : 64;
+        uint64_t errorWord = 0;
+        for (int64_t i = start; i < start + blockSize; i++) {
+            H3Error err =
+                H3_EXPORT(cellToVertexes)(cells[i], &vertexes[6 * i]);
+            if (err) {
+                for (int v = 0; v < NUM_HEX_VERTS; v++) {
+                    vertexes[6 * i + v] = H3_NULL;
+                }
+                errorWord |= (uint64_t)1 << (i - start);
+                if (!firstError) firstError = err;
+            }
+        }
+        if (errorBitmap) {
+            errorBitmap[start / 64] = errorWord;
+        }
+    }
+    return firstError;
+}
+
 /**
  * Get the geocoordinates of an H3 vertex
  * @param vertex H3 index describing a vertex
@@ -336,9 +544,9 @@ H3Error H3_EXPORT(vertexToLatLng)(H3Index vertex, LatLng *coord) {
     int res = H3_GET_RESOLUTION(owner);
 
     if (H3_EXPORT(isPentagon)(owner)) {
-        _faceIjkPentToCellBoundary(&fijk, res, vertexNum, 1, &gb);
+        _faceIjkPentToCellBoundary(&fijk, res, vertexNum, 1, &gb, NULL);
     } else {
-        _faceIjkToCellBoundary(&fijk, res, vertexNum, 1, &gb);
+        _faceIjkToCellBoundary(&fijk, res, vertexNum, 1, &gb, NULL);
     }
 
     // Copy from boundary to output coord